@@ -33,6 +33,8 @@ setup(
 	author_email='',
 	license='GNU GPLv3',
 	packages=setuptools.find_packages(),
+	# the native module built by CMake (-DBUILD_PYTHON_MODULE=ON) and copied to the package directory
+	package_data={'shortestdistances': ['_shortestpaths*.so', '_shortestpaths*.pyd']},
 	install_requires=[
 		'numpy',
 		'pandas',
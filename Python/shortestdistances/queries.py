@@ -0,0 +1,128 @@
+#
+# MIT License
+#
+# Copyright (c) 2024 Czech Technical University in Prague
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in all
+# copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.#
+"""
+Distance queries answered by the native shortest paths library.
+
+The query managers load a data structure created by the preprocessor together with a mapping file and answer
+queries between nodes given by their original IDs. Batches of queries given as NumPy arrays (or anything convertible
+to them, e.g., pandas columns) are answered in C++ without holding the GIL, optionally in parallel.
+
+A query manager can be shared by several Python threads, but it answers the calls one at a time: a call waits until
+the batch of another thread is finished. Threads that should query in parallel either use ``set_threads`` or their
+own query managers.
+
+The native module ``_shortestpaths`` is built by CMake with ``-DBUILD_PYTHON_MODULE=ON``. It has to be either copied
+to this package directory or placed on ``PYTHONPATH``.
+"""
+import os
+
+import numpy as np
+
+try:
+    from . import _shortestpaths
+except ImportError:
+    import _shortestpaths
+
+UNREACHABLE = _shortestpaths.UNREACHABLE
+"""The distance returned for the queries whose goal is not reachable from the start."""
+
+
+def _as_ids(ids, name: str) -> np.ndarray:
+    ids = np.asarray(ids)
+    if ids.size and not np.issubdtype(ids.dtype, np.integer):
+        raise TypeError(f"'{name}' has to contain integer node IDs, not {ids.dtype}.")
+    return np.ascontiguousarray(ids, dtype=np.int64)
+
+
+class _QueryManager:
+    _native_type = None
+
+    def __init__(self, structure_file: str, mapping_file: str, threads: int = 1):
+        # The loaders of some structures terminate the process if the file is missing, so check it here.
+        for path in (structure_file, mapping_file):
+            if not os.path.isfile(path):
+                raise FileNotFoundError(f"File not found: {path}")
+        self._native = self._native_type(os.fspath(structure_file), os.fspath(mapping_file))
+        if threads != 1:
+            self.set_threads(threads)
+
+    def distance(self, start: int, goal: int) -> int:
+        """Returns the distance from ``start`` to ``goal`` or ``UNREACHABLE``."""
+        return self._native.distance(int(start), int(goal))
+
+    def distances(self, starts, goals) -> np.ndarray:
+        """
+        Answers a batch of queries from ``starts[i]`` to ``goals[i]``.
+
+        :param starts: Array-like of the original IDs of the start nodes.
+        :param goals: Array-like of the original IDs of the goal nodes, it has to have the same shape as ``starts``.
+        :return: An int64 array of the same shape with the distances (``UNREACHABLE`` for unreachable goals).
+        :raises KeyError: If some of the IDs is not contained in the mapping.
+        """
+        starts = _as_ids(starts, "starts")
+        goals = _as_ids(goals, "goals")
+        if starts.shape != goals.shape:
+            raise ValueError(f"The shapes of starts {starts.shape} and goals {goals.shape} differ.")
+        distances = np.empty(starts.shape, dtype=np.int64)
+        self._native.distances(starts.reshape(-1), goals.reshape(-1), distances.reshape(-1))
+        return distances
+
+    def set_threads(self, threads: int):
+        """
+        Sets the number of threads used by ``distances``. All the threads share the loaded data structure, every
+        additional thread only needs its own query manager (a few bytes per node).
+        """
+        self._native.set_threads(threads)
+
+    def close(self):
+        """Releases the data structures. This also happens when the query manager is garbage collected."""
+        self._native.close()
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, exc_type, exc_value, traceback):
+        self.close()
+
+
+class CHQueryManager(_QueryManager):
+    """Contraction Hierarchies, ``structure_file`` is a ``.ch`` file created by the preprocessor."""
+    _native_type = _shortestpaths.CHQueryManager
+
+
+class TNRQueryManager(_QueryManager):
+    """Transit Node Routing, ``structure_file`` is a ``.tnrg`` file created by the preprocessor."""
+    _native_type = _shortestpaths.TNRQueryManager
+
+
+class TNRAFQueryManager(_QueryManager):
+    """Transit Node Routing with Arc Flags, ``structure_file`` is a ``.tgaf`` file created by the preprocessor."""
+    _native_type = _shortestpaths.TNRAFQueryManager
+
+
+class DMQueryManager(_QueryManager):
+    """
+    Distance matrix lookups, ``structure_file`` is a distance matrix created by the preprocessor (``.xdm``,
+    ``.hdf5`` or ``.cdm``). The threads share a single matrix.
+    """
+    _native_type = _shortestpaths.DMQueryManager
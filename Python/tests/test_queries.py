@@ -0,0 +1,87 @@
+#
+# MIT License
+#
+# Copyright (c) 2024 Czech Technical University in Prague
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in all
+# copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.#
+import unittest
+from concurrent.futures import ThreadPoolExecutor
+from pathlib import Path
+
+import numpy as np
+
+from shortestdistances.queries import CHQueryManager
+
+DATA_DIR = Path(__file__).resolve().parents[2] / "javatests" / "data"
+
+
+def load_queries(name: str) -> np.ndarray:
+    return np.loadtxt(DATA_DIR / name, skiprows=1, dtype=np.int64, ndmin=2)
+
+
+class CHQueriesTest(unittest.TestCase):
+    def setUp(self):
+        self.manager = CHQueryManager(str(DATA_DIR / "PragueCH.ch"), str(DATA_DIR / "PragueMapping.xeni"))
+
+    def tearDown(self):
+        self.manager.close()
+
+    def test_batch_matches_reference(self):
+        queries = load_queries("test5000queries.txt")
+        reference = np.loadtxt(DATA_DIR / "test5000reference.txt").astype(np.int64)
+
+        distances = self.manager.distances(queries[:, 0], queries[:, 1])
+        np.testing.assert_array_equal(distances, reference)
+
+        self.manager.set_threads(4)
+        np.testing.assert_array_equal(self.manager.distances(queries[:, 0], queries[:, 1]), reference)
+
+    def test_shared_between_threads(self):
+        queries = load_queries("test5000queries.txt")
+        reference = np.loadtxt(DATA_DIR / "test5000reference.txt").astype(np.int64)
+
+        self.manager.set_threads(2)
+        with ThreadPoolExecutor(max_workers=4) as pool:
+            results = list(pool.map(lambda _: self.manager.distances(queries[:, 0], queries[:, 1]), range(8)))
+        for distances in results:
+            np.testing.assert_array_equal(distances, reference)
+
+    def test_single_queries_match_batch(self):
+        queries = load_queries("test15queries.txt")
+        distances = self.manager.distances(queries[:, 0], queries[:, 1])
+        for (start, goal), distance in zip(queries, distances):
+            self.assertEqual(self.manager.distance(start, goal), distance)
+
+    def test_shape_is_kept(self):
+        queries = load_queries("test15queries.txt")[:12]
+        distances = self.manager.distances(queries[:, 0].reshape(3, 4), queries[:, 1].reshape(3, 4))
+        self.assertEqual(distances.shape, (3, 4))
+        self.assertEqual(distances.dtype, np.int64)
+
+    def test_invalid_input(self):
+        with self.assertRaises(KeyError):
+            self.manager.distances([1, 2], [3, 4])
+        with self.assertRaises(TypeError):
+            self.manager.distances([1.5], [2.5])
+        with self.assertRaises(ValueError):
+            self.manager.distances([1, 2], [3])
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,74 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Czech Technical University in Prague
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. */
+#include <climits>
+#include <fstream>
+#include <memory>
+#include <random>
+#include <vector>
+#include "gtest/gtest.h"
+#include "common.h"
+#include "Astar/ALTQueryManager.h"
+#include "Astar/Landmarks.h"
+#include "Dijkstra/BasicDijkstra.h"
+#include "GraphBuilding/Structures/Graph.h"
+
+TEST(alt_test, from_xengraph2) {
+    run_preprocessor("-m alt --landmarks 2 -i functest/02_xengraph.xeng -o alt_from_xengraph2");
+    const auto expected = load_dm_csv("functest/02_dm.csv");
+
+    std::ifstream input("alt_from_xengraph2.alt", std::ios::binary);
+    ASSERT_TRUE(input.is_open());
+    std::unique_ptr<Graph> graph;
+    const Landmarks landmarks = Landmarks::read(input, graph);
+    ASSERT_EQ(landmarks.count(), 2);
+
+    ALTQueryManager queryManager(*graph, landmarks);
+    for (unsigned int start = 0; start < expected.size(); start++) {
+        for (unsigned int goal = 0; goal < expected.size(); goal++) {
+            ASSERT_EQ(queryManager.findDistance(start, goal), expected[start][goal]);
+        }
+    }
+}
+
+TEST(alt_test, random_graph) {
+    const Graph graph = build_graph<Graph>(random_grid_network(20, 1));
+    for (const auto selection : {Landmarks::Selection::FARTHEST, Landmarks::Selection::AVOID}) {
+        const Landmarks landmarks = Landmarks::select(graph, 8, selection);
+        for (unsigned int node = 0; node < graph.nodes(); node++) {
+            for (unsigned int i = 0; i < landmarks.count(); i++) {
+                ASSERT_EQ(landmarks.fromLandmark(node, i),
+                          BasicDijkstra::run(landmarks.landmarkNodes()[i], node, graph));
+            }
+        }
+
+        ALTQueryManager queryManager(graph, landmarks);
+        std::mt19937 generator(2);
+        std::uniform_int_distribution<unsigned int> node(0, graph.nodes() - 1);
+        for (unsigned int i = 0; i < 500; i++) {
+            const unsigned int start = node(generator);
+            const unsigned int goal = node(generator);
+            ASSERT_EQ(queryManager.findDistance(start, goal), BasicDijkstra::run(start, goal, graph))
+                << "query " << start << " -> " << goal;
+        }
+    }
+}
@@ -0,0 +1,115 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Czech Technical University in Prague
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. */
+#include <climits>
+#include <fstream>
+#include <memory>
+#include <random>
+#include <vector>
+#include "gtest/gtest.h"
+#include "common.h"
+#include "CCH/CCHCustomizer.h"
+#include "CCH/CCHDistanceQueryManager.h"
+#include "CCH/NestedDissection.h"
+#include "CH/CHDistanceQueryManager.h"
+#include "Dijkstra/BasicDijkstra.h"
+#include "Error/Error.h"
+#include "GraphBuilding/Structures/Graph.h"
+
+namespace {
+
+// The same edges as in 'graph', with new random weights.
+SimpleGraph reweight(const SimpleGraph& graph, unsigned int seed) {
+    std::mt19937 generator(seed);
+    std::uniform_int_distribution<unsigned int> weight(1, 1000);
+    SimpleGraph reweighted(graph.nodes());
+    for (unsigned int from = 0; from < graph.nodes(); from++) {
+        for (const auto& [to, oldWeight] : graph.edges(from)) {
+            reweighted.addEdge(from, to, weight(generator));
+        }
+    }
+    return reweighted;
+}
+
+void compare_with_dijkstra(const SimpleGraph& graph, CCHDistanceQueryManager& queryManager, unsigned int seed) {
+    SimpleGraph copy = graph;
+    const Graph dijkstraGraph(copy);
+    std::mt19937 generator(seed);
+    std::uniform_int_distribution<unsigned int> node(0, graph.nodes() - 1);
+    for (unsigned int i = 0; i < 500; i++) {
+        const unsigned int start = node(generator);
+        const unsigned int goal = node(generator);
+        ASSERT_EQ(queryManager.findDistance(start, goal), BasicDijkstra::run(start, goal, dijkstraGraph))
+            << "query " << start << " -> " << goal;
+    }
+}
+
+}
+
+TEST(cch_test, from_xengraph2) {
+    run_preprocessor("-m cch -i functest/02_xengraph.xeng -o cch_from_xengraph2");
+    const auto expected = load_dm_csv("functest/02_dm.csv");
+
+    std::ifstream input("cch_from_xengraph2.cch", std::ios::binary);
+    ASSERT_TRUE(input.is_open());
+    std::vector<dist_t> weights;
+    const CCHTopology topology = CCHTopology::read(input, weights);
+    auto metric = std::make_shared<const CCHMetric>(CCHCustomizer::customize(topology, weights));
+
+    CCHDistanceQueryManager queryManager(topology, metric);
+    std::unique_ptr<FlagsGraph<NodeData>> ch(metric->createFlagsGraph(topology));
+    CHDistanceQueryManager<NodeData> chQueryManager(*ch);
+    for (unsigned int start = 0; start < expected.size(); start++) {
+        for (unsigned int goal = 0; goal < expected.size(); goal++) {
+            ASSERT_EQ(queryManager.findDistance(start, goal), expected[start][goal]);
+            ASSERT_EQ(chQueryManager.findDistance(start, goal), expected[start][goal]);
+        }
+    }
+}
+
+TEST(cch_test, random_graph_customization) {
+    const SimpleGraph graph = build_graph<SimpleGraph>(random_grid_network(20, 1));
+    const CCHTopology topology = CCHTopology::build(graph, NestedDissection::computeRanks(graph));
+
+    auto metric = std::make_shared<const CCHMetric>(CCHCustomizer::customize(topology, topology.edgeWeights(graph), 1));
+    const CCHMetric parallelMetric = CCHCustomizer::customize(topology, topology.edgeWeights(graph), 4);
+    ASSERT_EQ(metric->upWeights, parallelMetric.upWeights);
+    ASSERT_EQ(metric->downWeights, parallelMetric.downWeights);
+
+    CCHDistanceQueryManager queryManager(topology, metric);
+    compare_with_dijkstra(graph, queryManager, 2);
+
+    // the topology stays, only the weights change
+    const SimpleGraph reweighted = reweight(graph, 3);
+    queryManager.setMetric(std::make_shared<const CCHMetric>(
+        CCHCustomizer::customize(topology, topology.edgeWeights(reweighted))));
+    compare_with_dijkstra(reweighted, queryManager, 4);
+}
+
+TEST(cch_test, unknown_edge) {
+    const SimpleGraph graph = build_graph<SimpleGraph>(random_grid_network(5, 1));
+    const CCHTopology topology = CCHTopology::build(graph, NestedDissection::computeRanks(graph));
+
+    SimpleGraph other(graph.nodes());
+    other.addEdge(0, 24, 1);
+    ASSERT_THROW(topology.edgeWeights(other), input_error);
+}
@@ -20,11 +20,23 @@
  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
  * SOFTWARE. */
+#include <algorithm>
+#include <climits>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <random>
+#include <tuple>
+#include <vector>
 #include "gtest/gtest.h"
 #include "common.h"
 #include "expected_graphs.h"
 
+#include "CH/CHDistanceQueryManager.h"
+#include "Dijkstra/BasicDijkstra.h"
 #include "GraphBuilding/Loaders/DDSGLoader.h"
+#include "GraphBuilding/Structures/CompressedFlagsGraph.h"
+#include "GraphBuilding/Structures/Graph.h"
 
 
 TEST(ch_test, from_xengraph1) {
@@ -88,3 +100,152 @@ TEST(ch_test, from_dimacs2) {
     FlagsGraph<NodeData>* expected = build_flags_graph_02_div100();
     compare_flags_graphs(*loaded, *expected);
 }
+
+TEST(ch_test, random_graph) {
+    // one-way streets and isolated nodes, so that many pairs are only reachable in one direction or not at all
+    const Graph graph = write_dimacs_graph<Graph>("ch_random.gr", random_grid_network(20, 11, false, 20));
+    run_preprocessor("-m ch -i ch_random.gr -o ch_random");
+    std::unique_ptr<FlagsGraph<NodeData>> ch(DDSGLoader("ch_random.ch").loadFlagsGraph());
+    ASSERT_EQ(ch->nodes(), graph.nodes());
+
+    CHDistanceQueryManager queryManager(*ch);
+    std::vector<unsigned int> expected(graph.nodes());
+    unsigned int unreachable = 0;
+    for (unsigned int start = 0; start < graph.nodes(); start += 3) {
+        BasicDijkstra::computeOneToAllDistances(start, graph, expected);
+        for (unsigned int goal = 0; goal < graph.nodes(); goal++) {
+            ASSERT_EQ(queryManager.findDistance(start, goal), expected[goal]) << "query " << start << " -> " << goal;
+            if (expected[goal] == UINT_MAX) {
+                unreachable++;
+            }
+        }
+    }
+    ASSERT_GT(unreachable, 0u);
+}
+
+TEST(ch_test, query_statistics) {
+#ifdef SHORTEST_PATHS_NO_QUERY_STATISTICS
+    GTEST_SKIP() << "The query statistics were disabled at compile time.";
+#endif
+    const Graph graph = write_dimacs_graph<Graph>("ch_statistics.gr", random_grid_network(15, 4, true));
+    run_preprocessor("-m ch -i ch_statistics.gr -o ch_statistics");
+    std::unique_ptr<FlagsGraph<NodeData>> ch(DDSGLoader("ch_statistics.ch").loadFlagsGraph());
+
+    CHDistanceQueryManager queryManager(*ch);
+    QueryStatistics statistics;
+    QueryStatistics total;
+    queryManager.setStatistics(&statistics);
+    std::mt19937 generator(5);
+    std::uniform_int_distribution<unsigned int> node(0, graph.nodes() - 1);
+    for (unsigned int query = 0; query < 200; query++) {
+        const unsigned int start = node(generator);
+        const unsigned int goal = node(generator);
+        statistics.reset();
+        ASSERT_EQ(queryManager.findDistance(start, goal), BasicDijkstra::run(start, goal, graph));
+        ASSERT_GT(statistics.settledNodes, 0u) << "query " << start << " -> " << goal;
+        ASSERT_GE(statistics.heapPushes, statistics.settledNodes) << "query " << start << " -> " << goal;
+        ASSERT_EQ(statistics.localQueryFallbacks, 0u);
+        ASSERT_EQ(statistics.accessNodePairs, 0u);
+        total += statistics;
+    }
+    ASSERT_GT(total.settledNodes, 0u);
+    ASSERT_GT(total.relaxedEdges, 0u);
+    ASSERT_GT(total.heapPushes, 0u);
+
+    statistics.reset();
+    ASSERT_EQ(statistics.settledNodes, 0u);
+    ASSERT_EQ(statistics.relaxedEdges, 0u);
+    ASSERT_EQ(statistics.stalledNodes, 0u);
+    ASSERT_EQ(statistics.heapPushes, 0u);
+
+    // without an instance, nothing is counted
+    queryManager.setStatistics(nullptr);
+    queryManager.findDistance(0, graph.nodes() - 1);
+    ASSERT_EQ(statistics.settledNodes, 0u);
+    ASSERT_EQ(statistics.relaxedEdges, 0u);
+}
+
+TEST(ch_test, compressed_graph) {
+    // a grid with long weights (multi-byte varints) and random long edges (targets far below and above the node)
+    const unsigned int side = 25;
+    std::mt19937 generator(7);
+    std::uniform_int_distribution<unsigned int> weight(1, 10000000);
+    std::uniform_int_distribution<unsigned int> node(0, side * side - 1);
+    std::vector<std::tuple<unsigned int, unsigned int, unsigned int>> edges;
+    for (unsigned int current = 0; current < side * side; current++) {
+        if (current % side + 1 < side) {
+            edges.emplace_back(current, current + 1, weight(generator));
+            edges.emplace_back(current + 1, current, weight(generator));
+        }
+        if (current + side < side * side) {
+            edges.emplace_back(current, current + side, weight(generator));
+        }
+    }
+    for (unsigned int i = 0; i < side; i++) {
+        edges.emplace_back(node(generator), node(generator), weight(generator));
+    }
+    std::ofstream output("compressed_random.gr");
+    output << "p sp " << side * side << " " << edges.size() << std::endl;
+    for (const auto& [from, to, length] : edges) {
+        output << "a " << from + 1 << " " << to + 1 << " " << length << std::endl;
+    }
+    output.close();
+
+    run_preprocessor("-m ch -i compressed_random.gr -o compressed_random");
+    std::unique_ptr<FlagsGraph<NodeData>> ch(DDSGLoader("compressed_random.ch").loadFlagsGraph());
+    CompressedFlagsGraph compressed(*ch);
+    ASSERT_EQ(compressed.nodes(), ch->nodes());
+    ASSERT_LT(compressed.memoryUsage(), ch->memoryUsage());
+
+    auto key = [](const QueryEdge& edge) {
+        return std::make_tuple(edge.targetNode, edge.weight, edge.forward, edge.backward);
+    };
+    size_t edgesCnt = 0;
+    for (unsigned int i = 0; i < ch->nodes(); i++) {
+        std::vector<std::tuple<unsigned int, unsigned int, bool, bool>> expected, decoded;
+        for (const QueryEdge& edge : ch->nextNodes(i)) {
+            expected.push_back(key(edge));
+        }
+        for (const QueryEdge& edge : compressed.nextNodes(i)) {
+            decoded.push_back(key(edge));
+        }
+        std::sort(expected.begin(), expected.end());
+        ASSERT_EQ(decoded, expected) << "node " << i;
+        edgesCnt += expected.size();
+    }
+    ASSERT_EQ(compressed.edges(), edgesCnt);
+
+    CHDistanceQueryManager expectedQm(*ch);
+    CHDistanceQueryManager compressedQm(compressed);
+    for (unsigned int query = 0; query < 2000; query++) {
+        const unsigned int start = node(generator);
+        const unsigned int goal = node(generator);
+        ASSERT_EQ(compressedQm.findDistance(start, goal), expectedQm.findDistance(start, goal))
+            << "query " << start << " -> " << goal;
+    }
+
+    // the graph encoded while reading the file (in one chunk and in many chunks) is the same
+    for (const size_t chunkEdges : {size_t(1) << 20, size_t(100), size_t(1)}) {
+        std::unique_ptr<CompressedFlagsGraph> loaded(DDSGLoader("compressed_random.ch").loadCompressedFlagsGraph(chunkEdges));
+        ASSERT_EQ(loaded->nodes(), compressed.nodes());
+        ASSERT_EQ(loaded->edges(), compressed.edges());
+        ASSERT_EQ(loaded->memoryUsage(), compressed.memoryUsage());
+        for (unsigned int i = 0; i < ch->nodes(); i++) {
+            ASSERT_EQ(loaded->data(i), compressed.data(i));
+            std::vector<std::tuple<unsigned int, unsigned int, bool, bool>> expected, decoded;
+            for (const QueryEdge& edge : compressed.nextNodes(i)) {
+                expected.push_back(key(edge));
+            }
+            for (const QueryEdge& edge : loaded->nextNodes(i)) {
+                decoded.push_back(key(edge));
+            }
+            ASSERT_EQ(decoded, expected) << "node " << i << ", chunk " << chunkEdges;
+        }
+    }
+
+    // the temporary file the ranges are bucketed into is removed
+    for (const auto& entry : std::filesystem::directory_iterator(std::filesystem::temp_directory_path())) {
+        const std::string name = entry.path().filename().string();
+        ASSERT_FALSE(name.starts_with("compressed_random.ch.") && name.ends_with(".buckets")) << name;
+    }
+}
@@ -0,0 +1,92 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Czech Technical University in Prague
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. */
+#include <filesystem>
+#include "gtest/gtest.h"
+#include "common.h"
+#include "expected_graphs.h"
+
+#include "GraphBuilding/Loaders/TGAFLoader.h"
+#include "GraphBuilding/Loaders/TNRGLoader.h"
+
+/**
+ * A run resumed from the checkpoints of a complete run only loads the phases, it must still produce the same structure.
+ */
+TEST(checkpoint_test, tnraf_resume_complete_run) {
+    std::filesystem::remove_all("checkpoints_tnraf");
+    run_preprocessor("-m tnraf --preprocessing-mode slow --tnodes-cnt 3 -i functest/01_xengraph.xeng --output-path checkpointed --checkpoint-dir checkpoints_tnraf");
+    ASSERT_TRUE(std::filesystem::exists("checkpoints_tnraf/tnraf-backward-flags.ckpt"));
+    std::remove("checkpointed.tgaf");
+
+    run_preprocessor("-m tnraf --preprocessing-mode dm --tnodes-cnt 3 -i functest/01_xengraph.xeng --output-path checkpointed --checkpoint-dir checkpoints_tnraf --resume");
+    TransitNodeRoutingArcFlagsGraph* loaded = TGAFLoader("checkpointed.tgaf").loadTNRAFforDistanceQueries();
+    TransitNodeRoutingArcFlagsGraph* expected = build_tnraf_graph_01_3();
+    compare_tnraf_graphs(*loaded, *expected);
+    delete loaded;
+    delete expected;
+    std::remove("checkpointed.tgaf");
+    std::filesystem::remove_all("checkpoints_tnraf");
+}
+
+/**
+ * Only the missing phases are recomputed, and the phases with different parameters (here the transit node set size)
+ * are recomputed while the Contraction Hierarchy is reused.
+ */
+TEST(checkpoint_test, tnraf_resume_partial_run) {
+    std::filesystem::remove_all("checkpoints_tnraf_partial");
+    run_preprocessor("-m tnraf --preprocessing-mode fast --tnodes-cnt 3 -i functest/01_xengraph.xeng --output-path checkpointed --checkpoint-dir checkpoints_tnraf_partial");
+    std::filesystem::remove("checkpoints_tnraf_partial/tnraf-backward-flags.ckpt");
+    std::filesystem::remove("checkpoints_tnraf_partial/tnraf-backward-access-nodes.ckpt");
+
+    run_preprocessor("-m tnraf --preprocessing-mode fast --tnodes-cnt 3 -i functest/01_xengraph.xeng --output-path checkpointed --checkpoint-dir checkpoints_tnraf_partial --resume");
+    TransitNodeRoutingArcFlagsGraph* loaded = TGAFLoader("checkpointed.tgaf").loadTNRAFforDistanceQueries();
+    TransitNodeRoutingArcFlagsGraph* expected = build_tnraf_graph_01_3();
+    compare_tnraf_graphs(*loaded, *expected);
+    delete loaded;
+    delete expected;
+
+    run_preprocessor("-m tnraf --preprocessing-mode fast --tnodes-cnt 2 -i functest/01_xengraph.xeng --output-path checkpointed --checkpoint-dir checkpoints_tnraf_partial --resume");
+    loaded = TGAFLoader("checkpointed.tgaf").loadTNRAFforDistanceQueries();
+    expected = build_tnraf_graph_01_2();
+    compare_tnraf_graphs(*loaded, *expected);
+    delete loaded;
+    delete expected;
+    std::remove("checkpointed.tgaf");
+    std::filesystem::remove_all("checkpoints_tnraf_partial");
+}
+
+/**
+ * Checkpoints created for a different graph must be ignored.
+ */
+TEST(checkpoint_test, tnr_ignores_checkpoints_of_other_graph) {
+    std::filesystem::remove_all("checkpoints_tnr");
+    run_preprocessor("-m tnr --preprocessing-mode slow --tnodes-cnt 2 -i functest/01_xengraph.xeng --output-path checkpointed --checkpoint-dir checkpoints_tnr");
+    run_preprocessor("-m tnr --preprocessing-mode slow --tnodes-cnt 2 -i functest/02_xengraph.xeng --precision-loss 100 --output-path checkpointed --checkpoint-dir checkpoints_tnr --resume");
+    run_preprocessor("-m tnr --preprocessing-mode slow --tnodes-cnt 2 -i functest/01_xengraph.xeng --output-path checkpointed --checkpoint-dir checkpoints_tnr --resume");
+    TransitNodeRoutingGraph<NodeData>* loaded = TNRGLoader("checkpointed.tnrg").loadTNRforDistanceQueries();
+    TransitNodeRoutingGraph<NodeData>* expected = build_tnr_graph_01_2();
+    compare_tnr_graphs(*loaded, *expected);
+    delete loaded;
+    delete expected;
+    std::remove("checkpointed.tnrg");
+    std::filesystem::remove_all("checkpoints_tnr");
+}
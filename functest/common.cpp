@@ -23,6 +23,8 @@
 
 #include "gtest/gtest.h"
 #include <fstream>
+#include <random>
+#include <sstream>
 #include <string>
 #include <algorithm>
 #include "common.h"
@@ -37,7 +39,149 @@ void run_preprocessor(const char* args) {
     std::system(command.c_str());
 }
 
+std::vector<std::vector<unsigned int>> load_dm_csv(const std::string& path) {
+    std::vector<std::vector<unsigned int>> matrix;
+    std::ifstream input(path);
+    std::string line;
+    while (std::getline(input, line)) {
+        matrix.emplace_back();
+        std::stringstream row(line);
+        std::string value;
+        while (std::getline(row, value, ',')) {
+            matrix.back().push_back(static_cast<unsigned int>(std::stoul(value)));
+        }
+    }
+    return matrix;
+}
+
+RandomNetwork random_grid_network(unsigned int side, unsigned int seed, bool undirected, unsigned int isolated) {
+    std::mt19937 generator(seed);
+    std::uniform_int_distribution<unsigned int> weight(1, 1000);
+    std::uniform_int_distribution<unsigned int> node(0, side * side - 1);
+    std::bernoulli_distribution oneWay(0.2);
+
+    RandomNetwork network{side * side + isolated, {}};
+    auto connect = [&](unsigned int a, unsigned int b) {
+        if (undirected) {
+            const unsigned int length = weight(generator);
+            network.edges.emplace_back(a, b, length);
+            network.edges.emplace_back(b, a, length);
+            return;
+        }
+        if (!oneWay(generator)) {
+            network.edges.emplace_back(b, a, weight(generator));
+        }
+        network.edges.emplace_back(a, b, weight(generator));
+    };
+    for (unsigned int row = 0; row < side; row++) {
+        for (unsigned int column = 0; column < side; column++) {
+            const unsigned int current = row * side + column;
+            if (column + 1 < side) {
+                connect(current, current + 1);
+            }
+            if (row + 1 < side) {
+                connect(current, current + side);
+            }
+        }
+    }
+    for (unsigned int i = 0; i < side; i++) {
+        if (undirected) {
+            connect(node(generator), node(generator));
+        } else {
+            network.edges.emplace_back(node(generator), node(generator), weight(generator));
+        }
+    }
+    return network;
+}
+
+RandomNetwork random_sparse_network(unsigned int nodes, unsigned int seed) {
+    std::mt19937 generator(seed);
+    std::uniform_int_distribution<unsigned int> weight(1, 1000);
+    std::uniform_int_distribution<unsigned int> heavyWeight(1, 500000);
+    std::uniform_int_distribution<unsigned int> node(0, nodes - 1);
+    std::bernoulli_distribution heavy(0.05);
+
+    RandomNetwork network{nodes, {}};
+    for (unsigned int i = 0; i < nodes * 3; i++) {
+        const unsigned int from = node(generator);
+        const unsigned int to = node(generator);
+        if (from != to) {
+            network.edges.emplace_back(from, to, heavy(generator) ? heavyWeight(generator) : weight(generator));
+        }
+    }
+    return network;
+}
 
+RandomNetwork random_road_network(unsigned int seed) {
+    std::mt19937 generator(seed);
+    std::uniform_int_distribution<unsigned int> weight(1, 100);
+    std::bernoulli_distribution oneWay(0.2);
+    std::bernoulli_distribution reversed(0.5);
+
+    RandomNetwork network{0, {}};
+    auto& edges = network.edges;
+    unsigned int& nodes = network.nodes;
+    auto connect = [&](unsigned int a, unsigned int b) {
+        if (!oneWay(generator)) {
+            edges.emplace_back(b, a, weight(generator));
+            edges.emplace_back(a, b, weight(generator));
+        } else if (reversed(generator)) {
+            edges.emplace_back(b, a, weight(generator));
+        } else {
+            edges.emplace_back(a, b, weight(generator));
+        }
+    };
+    auto random_node = [&](unsigned int below) {
+        return std::uniform_int_distribution<unsigned int>(0, below - 1)(generator);
+    };
+
+    const unsigned int side = 6;
+    for (unsigned int row = 0; row < side; row++) {
+        for (unsigned int column = 0; column < side; column++) {
+            const unsigned int current = row * side + column;
+            if (column + 1 < side) {
+                connect(current, current + 1);
+            }
+            if (row + 1 < side) {
+                connect(current, current + side);
+            }
+        }
+    }
+    nodes = side * side;
+
+    for (unsigned int chain = 0; chain < 20; chain++) {
+        const unsigned int first = random_node(side * side);
+        const unsigned int last = chain == 0 ? first : random_node(side * side);
+        unsigned int previous = first;
+        for (unsigned int i = 1 + random_node(5); i > 0; i--) {
+            connect(previous, nodes);
+            previous = nodes++;
+        }
+        connect(previous, last);
+    }
+
+    for (unsigned int i = 0; i < 40; i++) {
+        connect(random_node(nodes), nodes);
+        nodes++;
+    }
+
+    const unsigned int cycle = nodes;
+    for (unsigned int i = 0; i < 5; i++) {
+        connect(cycle + i, cycle + (i + 1) % 5);
+    }
+    connect(cycle, cycle + 5);
+    nodes += 6;
+    for (unsigned int i = 0; i < 3; i++) {
+        connect(nodes + i, nodes + i + 1);
+    }
+    nodes += 4;
+
+    for (unsigned int i = 0; i < 15; i++) {
+        const auto [from, to, length] = edges[random_node(static_cast<unsigned int>(edges.size()))];
+        edges.emplace_back(from, to, i % 3 == 0 ? length - 1 : length + 5);
+    }
+    return network;
+}
 
 void compare_tnraf_graphs(const TransitNodeRoutingArcFlagsGraph& computed, const TransitNodeRoutingArcFlagsGraph& expected) {
     compare_tnr_graphs(computed, expected);
@@ -28,6 +28,8 @@
 #include <fstream>
 #include <iterator>
 #include <string>
+#include <tuple>
+#include <vector>
 #include <algorithm>
 #include "common.h"
 
@@ -37,6 +39,60 @@
 
 void run_preprocessor(const char* args);
 
+std::vector<std::vector<unsigned int>> load_dm_csv(const std::string& path);
+
+/**
+ * A generated test network: the number of nodes and its (from, to, length) edges.
+ */
+struct RandomNetwork {
+    unsigned int nodes;
+    std::vector<std::tuple<unsigned int, unsigned int, unsigned int>> edges;
+};
+
+/**
+ * A side x side grid of streets with 'side' long random edges and 'isolated' extra nodes without any edges. In a
+ * directed network, every street is one-way with probability 0.2, so the network is not strongly connected. In an
+ * undirected network, both directions of every edge (including the random ones) have the same length.
+ */
+RandomNetwork random_grid_network(unsigned int side, unsigned int seed, bool undirected = false,
+                                  unsigned int isolated = 0);
+
+/**
+ * 3 * nodes random edges between random nodes, so some nodes are unreachable. Every 20th edge is heavy (up to
+ * 500000 instead of up to 1000).
+ */
+RandomNetwork random_sparse_network(unsigned int nodes, unsigned int seed);
+
+/**
+ * A small grid with chains of nodes between some of its nodes (one of them returning to the node it starts at),
+ * dead-end trees hanging on all kinds of nodes, a separate cycle, a separate tree and parallel edges, so that the
+ * graph simplification removes nodes of all kinds. Some of the edges are one-way, so some chains and trees can only
+ * be passed in one direction.
+ */
+RandomNetwork random_road_network(unsigned int seed);
+
+template<class G>
+G build_graph(const RandomNetwork& network) {
+    G graph(network.nodes);
+    for (const auto& [from, to, length] : network.edges) {
+        graph.addEdge(from, to, length);
+    }
+    return graph;
+}
+
+/**
+ * Writes the network in the DIMACS format and returns it as a graph.
+ */
+template<class G>
+G write_dimacs_graph(const std::string& path, const RandomNetwork& network) {
+    std::ofstream output(path);
+    output << "p sp " << network.nodes << " " << network.edges.size() << std::endl;
+    for (const auto& [from, to, length] : network.edges) {
+        output << "a " << from + 1 << " " << to + 1 << " " << length << std::endl;
+    }
+    return build_graph<G>(network);
+}
+
 template<class T>
 void compare_flags_graphs(
         const FlagsGraph<T>& computed,
@@ -50,14 +106,6 @@ void compare_flags_graphs(
     for (size_t i = 0; i < computed_nodes_data.size(); ++i) {
         std::cout << "i: " << i <<std::endl;
         ASSERT_EQ(computed_nodes_data[i].rank, expected_nodes_data[i].rank);
-        ASSERT_EQ(computed_nodes_data[i].backwardDist, expected_nodes_data[i].backwardDist);
-        ASSERT_EQ(computed_nodes_data[i].forwardDist, expected_nodes_data[i].forwardDist);
-        ASSERT_EQ(computed_nodes_data[i].backwardReached, expected_nodes_data[i].backwardReached);
-        ASSERT_EQ(computed_nodes_data[i].backwardSettled, expected_nodes_data[i].backwardSettled);
-        ASSERT_EQ(computed_nodes_data[i].backwardStalled, expected_nodes_data[i].backwardStalled);
-        ASSERT_EQ(computed_nodes_data[i].forwardReached, expected_nodes_data[i].forwardReached);
-        ASSERT_EQ(computed_nodes_data[i].forwardSettled, expected_nodes_data[i].forwardSettled);
-        ASSERT_EQ(computed_nodes_data[i].forwardStalled, expected_nodes_data[i].forwardStalled);
     }
 
     const auto& computed_neighbours = computed.getNeighbours();
@@ -0,0 +1,68 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Czech Technical University in Prague
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. */
+#include <climits>
+#include <random>
+#include <vector>
+#include "gtest/gtest.h"
+#include "common.h"
+#include "Dijkstra/BasicDijkstra.h"
+#include "Dijkstra/DijkstraEngine.h"
+#include "Error/Error.h"
+#include "GraphBuilding/Structures/Graph.h"
+
+TEST(dijkstra_test, all_heaps_match_basic_dijkstra) {
+    Graph graph = build_graph<Graph>(random_sparse_network(400, 7));
+    std::mt19937 generator(11);
+    std::uniform_int_distribution<unsigned int> node(0, graph.nodes() - 1);
+
+    for (const auto heap: {DijkstraEngine::Heap::RADIX, DijkstraEngine::Heap::QUATERNARY, DijkstraEngine::Heap::DIAL}) {
+        DijkstraEngine engine(graph, heap);
+        for (unsigned int i = 0; i < 300; i++) {
+            const unsigned int start = node(generator);
+            const unsigned int goal = node(generator);
+            const unsigned int expected = BasicDijkstra::run(start, goal, graph);
+            ASSERT_EQ(engine.run(start, goal), expected) << "start " << start << ", goal " << goal;
+            ASSERT_EQ(engine.runBidirectional(start, goal), expected) << "start " << start << ", goal " << goal;
+        }
+    }
+}
+
+TEST(dijkstra_test, one_to_all_distances) {
+    Graph graph = build_graph<Graph>(random_sparse_network(200, 3));
+    DijkstraEngine engine(graph, DijkstraEngine::Heap::QUATERNARY);
+
+    std::vector<unsigned int> forward, backward;
+    for (unsigned int source = 0; source < graph.nodes(); source += 17) {
+        engine.computeOneToAllDistances(source, forward);
+        engine.computeOneToAllDistances(source, backward, true);
+        for (unsigned int other = 0; other < graph.nodes(); other++) {
+            ASSERT_EQ(forward[other], BasicDijkstra::run(source, other, graph));
+            ASSERT_EQ(backward[other], BasicDijkstra::run(other, source, graph));
+        }
+    }
+}
+
+TEST(dijkstra_test, invalid_heap) {
+    EXPECT_EQ(DijkstraEngine::parseHeap("dial"), DijkstraEngine::Heap::DIAL);
+    EXPECT_THROW(DijkstraEngine::parseHeap("fibonacci"), input_error);
+}
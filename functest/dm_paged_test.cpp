@@ -0,0 +1,104 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Czech Technical University in Prague
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. */
+#include <memory>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+#include "gtest/gtest.h"
+#include "common.h"
+#include "GraphBuilding/Loaders/DistanceMatrixLoader.h"
+#include "GraphBuilding/Structures/Graph.h"
+
+namespace {
+
+// 53 rows in blocks of 4 rows, so the last block only has one row, and 3 cached blocks (12 rows)
+constexpr unsigned int nodes = 53;
+constexpr unsigned int rowsPerBlock = 4;
+constexpr unsigned int cachedBlocks = 3;
+constexpr unsigned int blocks = (nodes + rowsPerBlock - 1) / rowsPerBlock;
+static_assert(nodes % rowsPerBlock != 0 && cachedBlocks * rowsPerBlock < nodes);
+
+void check_paged_matrix(const DistanceMatrixPagedInterface& paged, const DistanceMatrixInterface& expected) {
+    ASSERT_EQ(paged.nodes(), nodes);
+
+    // row by row, every block is loaded once and the least recently used one is evicted
+    for (unsigned int start = 0; start < nodes; start++) {
+        for (unsigned int goal = 0; goal < nodes; goal++) {
+            ASSERT_EQ(paged.findDistance(start, goal), expected.findDistance(start, goal)) << start << " -> " << goal;
+        }
+    }
+    ASSERT_EQ(paged.cacheMisses(), blocks);
+    ASSERT_EQ(paged.cacheHits(), nodes * nodes - blocks);
+
+    // the last three blocks are cached, the first one has been evicted
+    paged.resetCacheStatistics();
+    ASSERT_EQ(paged.findDistance(nodes - 1, 0), expected.findDistance(nodes - 1, 0));
+    ASSERT_EQ(paged.findDistance(nodes - 1 - 2 * rowsPerBlock, 1), expected.findDistance(nodes - 1 - 2 * rowsPerBlock, 1));
+    ASSERT_EQ(paged.cacheMisses(), 0u);
+    ASSERT_EQ(paged.findDistance(0, 2), expected.findDistance(0, 2));
+    ASSERT_EQ(paged.cacheMisses(), 1u);
+
+    // the prefetched blocks are then queried without loading anything
+    paged.prefetchRows(20, 2 * rowsPerBlock);
+    paged.resetCacheStatistics();
+    for (unsigned int start = 20; start < 20 + 2 * rowsPerBlock; start++) {
+        ASSERT_EQ(paged.findDistance(start, start / 2), expected.findDistance(start, start / 2));
+    }
+    ASSERT_EQ(paged.cacheMisses(), 0u);
+
+    // the batch is reordered by the blocks, but the distances are returned in the order of the queries
+    std::mt19937 generator(3);
+    std::uniform_int_distribution<unsigned int> node(0, nodes - 1);
+    std::vector<std::pair<unsigned int, unsigned int>> queries;
+    for (unsigned int i = 0; i < 1000; i++) {
+        queries.emplace_back(node(generator), node(generator));
+    }
+    paged.resetCacheStatistics();
+    std::vector<dist_t> distances;
+    paged.findDistances(queries, distances);
+    ASSERT_EQ(distances.size(), queries.size());
+    for (size_t i = 0; i < queries.size(); i++) {
+        ASSERT_EQ(distances[i], expected.findDistance(queries[i].first, queries[i].second)) << "query " << i;
+    }
+    ASSERT_LE(paged.cacheMisses(), blocks);
+}
+
+}
+
+TEST(dm_paged_test, xdm_and_hdf) {
+    write_dimacs_graph<Graph>("dm_paged.gr", random_sparse_network(nodes, 11));
+    run_preprocessor("-m dm -i dm_paged.gr --output-format xdm --preprocessing-mode fast -o dm_paged");
+    run_preprocessor("-m dm -i dm_paged.gr --output-format hdf --preprocessing-mode fast -o dm_paged");
+
+    std::unique_ptr<Distance_matrix_travel_time_provider<dist_t>> expected(DistanceMatrixLoader("dm_paged.xdm").loadXDM());
+    ASSERT_EQ(expected->nodes(), nodes);
+
+    std::unique_ptr<DistanceMatrixPagedInterface> xdm(
+        DistanceMatrixLoader("dm_paged.xdm").loadXDMPaged(rowsPerBlock, cachedBlocks));
+    check_paged_matrix(*xdm, *expected);
+
+    std::unique_ptr<DistanceMatrixPagedInterface> hdf(
+        DistanceMatrixLoader("dm_paged.hdf5").loadHDFPaged(rowsPerBlock, cachedBlocks));
+    check_paged_matrix(*hdf, *expected);
+}
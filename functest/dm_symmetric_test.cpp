@@ -0,0 +1,97 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Czech Technical University in Prague
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. */
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+#include "gtest/gtest.h"
+#include "common.h"
+#include "Dijkstra/BasicDijkstra.h"
+#include "GraphBuilding/Loaders/DistanceMatrixLoader.h"
+#include "GraphBuilding/Structures/Graph.h"
+
+namespace {
+
+void check_distances(const DistanceMatrixInterface& dm, const Graph& graph) {
+    std::vector<unsigned int> expected(graph.nodes());
+    for (unsigned int source = 0; source < graph.nodes(); source++) {
+        BasicDijkstra::computeOneToAllDistances(source, graph, expected);
+        for (unsigned int target = 0; target < graph.nodes(); target++) {
+            ASSERT_EQ(dm.findDistance(source, target), expected[target]) << source << " -> " << target;
+        }
+    }
+}
+
+}
+
+TEST(dm_symmetric_test, upper_triangle) {
+    const Graph graph = write_dimacs_graph<Graph>("dm_symmetric.gr", random_grid_network(12, 7, true, 12));
+    ASSERT_TRUE(graph.isSymmetric());
+    const unsigned int n = graph.nodes();
+
+    for (const std::string mode : {"slow", "fast", "floyd-warshall"}) {
+        const std::string output = "dm_symmetric_" + mode;
+        run_preprocessor(("-m dm -i dm_symmetric.gr --output-format xdm --preprocessing-mode " + mode + " --symmetric -o " + output).c_str());
+        run_preprocessor(("-m dm -i dm_symmetric.gr --output-format hdf --preprocessing-mode " + mode + " --symmetric -o " + output).c_str());
+        run_preprocessor(("-m dm -i dm_symmetric.gr --output-format csv --preprocessing-mode " + mode + " --symmetric -o " + output).c_str());
+
+        // only the n * (n + 1) / 2 distances of the upper triangle are stored
+        ASSERT_EQ(std::filesystem::file_size(output + ".xdm"), 3 + sizeof(unsigned int) + upperTriangularEntries(n) * sizeof(dist_t));
+
+        std::unique_ptr<Distance_matrix_travel_time_provider<dist_t>> xdm(DistanceMatrixLoader(output + ".xdm").loadXDM());
+        ASSERT_EQ(xdm->getLayout(), DistanceMatrixLayout::UPPER_TRIANGULAR);
+        check_distances(*xdm, graph);
+
+        std::unique_ptr<DistanceMatrixInterface> hdf(DistanceMatrixLoader(output + ".hdf5").loadHDF());
+        check_distances(*hdf, graph);
+
+        // the CSV output contains the complete matrix
+        const auto csv = load_dm_csv(output + ".csv");
+        ASSERT_EQ(csv.size(), n);
+        for (unsigned int row = 0; row < n; row++) {
+            ASSERT_EQ(csv[row].size(), n);
+            for (unsigned int column = 0; column < n; column++) {
+                ASSERT_EQ(csv[row][column], xdm->findDistance(row, column));
+            }
+        }
+    }
+}
+
+TEST(dm_symmetric_test, full_matrix) {
+    // the whole matrix is stored unless --symmetric is given
+    const Graph graph = write_dimacs_graph<Graph>("dm_symmetric_full.gr", random_grid_network(8, 9, true, 8));
+    run_preprocessor("-m dm -i dm_symmetric_full.gr --output-format xdm --preprocessing-mode fast -o dm_symmetric_full");
+
+    std::unique_ptr<Distance_matrix_travel_time_provider<dist_t>> xdm(DistanceMatrixLoader("dm_symmetric_full.xdm").loadXDM());
+    ASSERT_EQ(xdm->getLayout(), DistanceMatrixLayout::FULL);
+    check_distances(*xdm, graph);
+
+    // --symmetric is ignored for a directed graph
+    const Graph directed = write_dimacs_graph<Graph>("dm_symmetric_directed.gr", random_grid_network(8, 9));
+    ASSERT_FALSE(directed.isSymmetric());
+    run_preprocessor("-m dm -i dm_symmetric_directed.gr --output-format xdm --preprocessing-mode fast --symmetric -o dm_symmetric_directed");
+
+    std::unique_ptr<Distance_matrix_travel_time_provider<dist_t>> directedXdm(DistanceMatrixLoader("dm_symmetric_directed.xdm").loadXDM());
+    ASSERT_EQ(directedXdm->getLayout(), DistanceMatrixLayout::FULL);
+    check_distances(*directedXdm, directed);
+}
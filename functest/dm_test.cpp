@@ -140,3 +140,21 @@ TEST(dm_test, from_csv_fast2) {
     run_preprocessor("-m dm --output-format csv --preprocessing-mode fast --input-path functest/02_csv -o from_csv_fast2 --precision-loss 100");
 	compare_dm_files("functest/02_dm_div100.csv", "from_csv_fast2.csv");
 }
+
+TEST(dm_test, csv_to_standard_output) {
+    // the matrix is the only content of the standard output
+    run_preprocessor("-m dm --output-format csv --preprocessing-mode fast -i functest/01_xengraph.xeng -o - > from_xengraph_stdout.csv");
+	compare_dm_files("functest/01_dm.csv", "from_xengraph_stdout.csv");
+}
+
+TEST(dm_test, from_xengraph_floyd_warshall1) {
+    // floyd-warshall without precision loss
+    run_preprocessor("-m dm --output-format csv --preprocessing-mode floyd-warshall --input-path functest/01_xengraph.xeng -o from_xengraph_floyd_warshall1");
+	compare_dm_files("functest/01_dm.csv", "from_xengraph_floyd_warshall1.csv");
+}
+
+TEST(dm_test, from_dimacs_floyd_warshall2) {
+    // floyd-warshall with precision loss and 16-bit integers
+    run_preprocessor("-m dm --input-format dimacs --output-format csv --preprocessing-mode floyd-warshall --int-size 16 --input-path functest/02_dimacs.gr -o from_dimacs_floyd_warshall2 --precision-loss 100");
+	compare_dm_files("functest/02_dm_div100.csv", "from_dimacs_floyd_warshall2.csv");
+}
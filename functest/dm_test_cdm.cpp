@@ -0,0 +1,66 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Czech Technical University in Prague
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. */
+#include <fstream>
+#include <vector>
+#include "gtest/gtest.h"
+#include "common.h"
+#include "DistanceMatrix/CSV_reader.h"
+#include "DistanceMatrix/DistanceMatrixCompressedProvider.h"
+
+void check_cdm(const std::string& computed, const std::string& expected) {
+	std::ifstream input(computed, std::ios::binary);
+	ASSERT_TRUE(input.is_open());
+	const auto dm = DistanceMatrixCompressedProvider::read(input);
+
+	CSV_reader csv_reader;
+	const auto& [dm_expected, size_expected] = csv_reader.read_matrix(expected);
+
+	ASSERT_EQ(dm->nodes(), size_expected);
+
+	std::vector<dist_t> row(dm->nodes());
+	for (unsigned int i = 0; i < dm->nodes(); i++) {
+		dm->decodeRow(i, row.data());
+		for (unsigned int j = 0; j < dm->nodes(); j++) {
+			ASSERT_EQ(dm_expected[static_cast<size_t>(i) * size_expected + j], dm->findDistance(i, j));
+			ASSERT_EQ(dm_expected[static_cast<size_t>(i) * size_expected + j], row[j]);
+		}
+	}
+}
+
+TEST(dm_cdm_test, from_xengraph_slow1) {
+    // slow without precision loss
+    run_preprocessor("--method dm --output-format cdm --preprocessing-mode slow --input-path functest/01_xengraph.xeng --output-path cdm_from_xengraph_slow1");
+    check_cdm("cdm_from_xengraph_slow1.cdm", "functest/01_dm.csv");
+}
+
+TEST(dm_cdm_test, from_xengraph_fast2) {
+    // fast with precision loss
+    run_preprocessor("--method dm --input-format xengraph --output-format cdm --preprocessing-mode fast --input-path functest/02_xengraph.xeng -o cdm_from_xengraph_fast2 --precision-loss 100");
+    check_cdm("cdm_from_xengraph_fast2.cdm", "functest/02_dm_div100.csv");
+}
+
+TEST(dm_cdm_test, from_csv_fast2) {
+    // fast with precision loss, 16-bit integers
+    run_preprocessor("--method dm --input-format csv --output-format cdm --preprocessing-mode fast --input-path functest/02_csv -o cdm_from_csv_fast2 --precision-loss 100 --int-size 16");
+    check_cdm("cdm_from_csv_fast2.cdm", "functest/02_dm_div100.csv");
+}
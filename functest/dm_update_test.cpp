@@ -0,0 +1,114 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Czech Technical University in Prague
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. */
+#include <climits>
+#include <fstream>
+#include <random>
+#include <string>
+#include <tuple>
+#include <vector>
+#include "gtest/gtest.h"
+#include "H5Cpp.h"
+#include "common.h"
+#include "Dijkstra/BasicDijkstra.h"
+#include "DistanceMatrix/DistanceMatrixUpdater.h"
+
+namespace {
+
+void fill_matrix(Distance_matrix_travel_time_provider<dist_t>& dm, const Graph& graph) {
+    std::vector<unsigned int> distances(graph.nodes());
+    for (unsigned int row = 0; row < graph.nodes(); row++) {
+        BasicDijkstra::computeOneToAllDistances(row, graph, distances);
+        for (unsigned int column = 0; column < graph.nodes(); column++) {
+            dm.setDistance(row, column, distances[column]);
+        }
+    }
+}
+
+std::vector<dist_t> read_hdf(const std::string& path) {
+    H5::H5File file(path, H5F_ACC_RDONLY);
+    auto dataset = file.openDataSet("dm");
+    hsize_t dims[2];
+    dataset.getSpace().getSimpleExtentDims(dims);
+    std::vector<dist_t> values(dims[0] * dims[1]);
+    dataset.read(values.data(), H5::PredType::NATIVE_UINT);
+    return values;
+}
+
+}
+
+TEST(dm_update_test, random_changes) {
+    // a ring with random chords, so that most shortest paths avoid any single edge
+    const unsigned int nodes = 200;
+    std::mt19937 generator(7);
+    std::uniform_int_distribution<unsigned int> node(0, nodes - 1);
+    std::uniform_int_distribution<unsigned int> weight(10, 100);
+    std::vector<std::tuple<unsigned int, unsigned int, unsigned int>> edges;
+    for (unsigned int i = 0; i < nodes; i++) {
+        edges.emplace_back(i, (i + 1) % nodes, weight(generator));
+        edges.emplace_back((i + 1) % nodes, i, weight(generator));
+        edges.emplace_back(i, node(generator), 5 * weight(generator));
+    }
+
+    Graph previous(nodes);
+    for (const auto& [from, to, w] : edges) {
+        previous.addEdge(from, to, w);
+    }
+    Distance_matrix_travel_time_provider<dist_t> dm(nodes);
+    fill_matrix(dm, previous);
+
+    // one longer edge, one shorter edge, one removed edge and one new edge
+    std::get<2>(edges[0]) += 50;
+    std::get<2>(edges[100]) = 1;
+    edges.erase(edges.begin() + 301);
+    edges.emplace_back(17, 18, 1);
+    Graph current(nodes);
+    for (const auto& [from, to, w] : edges) {
+        current.addEdge(from, to, w);
+    }
+
+    const auto changes = DistanceMatrixUpdater<dist_t>::changedEdges(previous, current);
+    ASSERT_EQ(changes.size(), 4);
+    const auto rows = DistanceMatrixUpdater<dist_t>::update(dm, current, changes);
+    ASSERT_LT(rows.size(), nodes);
+
+    Distance_matrix_travel_time_provider<dist_t> expected(nodes);
+    fill_matrix(expected, current);
+    for (unsigned int row = 0; row < nodes; row++) {
+        for (unsigned int column = 0; column < nodes; column++) {
+            ASSERT_EQ(dm.findDistance(row, column), expected.findDistance(row, column)) << row << " -> " << column;
+        }
+    }
+}
+
+TEST(dm_update_test, hdf_in_place) {
+    run_preprocessor("-m dm --output-format hdf --preprocessing-mode slow -i functest/02_xengraph.xeng -o dm_update");
+
+    std::ofstream graph("dm_update.xeng");
+    graph << "XGI 4 5\n0 1 668357 1\n1 0 672314 1\n2 1 866307 1\n1 3 500000 1\n3 2 331010 1\n";
+    graph.close();
+    run_preprocessor("-m dm --output-format hdf --preprocessing-mode slow -i dm_update.xeng -o dm_update_expected");
+
+    run_preprocessor("-m dm-update -i dm_update.xeng --previous-graph functest/02_xengraph.xeng "
+                     "--input-structure dm_update.hdf5");
+    ASSERT_EQ(read_hdf("dm_update.hdf5"), read_hdf("dm_update_expected.hdf5"));
+}
@@ -0,0 +1,132 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Czech Technical University in Prague
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. */
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <string>
+#include <vector>
+#include "gtest/gtest.h"
+#include "common.h"
+#include "Dijkstra/DijkstraEngine.h"
+#include "GraphBuilding/Generators/QuerySetGenerator.h"
+#include "GraphBuilding/Generators/RoadNetworkGenerator.h"
+
+namespace {
+
+SyntheticRoadNetwork generate_network(unsigned int nodes, unsigned int seed) {
+    RoadNetworkGenerator::Options options;
+    options.nodes = nodes;
+    options.seed = seed;
+    options.arterialSpacing = 4;
+    options.highwaySpacing = 8;
+    options.oneWayProbability = 0.5;
+    options.missingProbability = 0.1;
+    return RoadNetworkGenerator(options).generate();
+}
+
+// The number of nodes closer to the start than the goal and the number of nodes at most as far as the goal, so
+// the Dijkstra rank of the goal is between the two values.
+std::pair<unsigned int, unsigned int> rank_bounds(const std::vector<unsigned int>& distances, unsigned int goal) {
+    unsigned int closer = 0, notFarther = 0;
+    for (const auto distance : distances) {
+        closer += distance < distances[goal];
+        notFarther += distance <= distances[goal];
+    }
+    return {closer, notFarther};
+}
+
+}
+
+TEST(generator_test, strongly_connected_road_network) {
+    const auto network = generate_network(2500, 3);
+    ASSERT_LE(network.nodes(), 2500);
+    ASSERT_GE(network.nodes(), 2000);
+    ASSERT_TRUE(std::any_of(network.roads.begin(), network.roads.end(), [](const auto& road) { return road.oneWay; }));
+    EXPECT_EQ(generate_network(2500, 3).roads.size(), network.roads.size());
+
+    // the weights are never smaller than the straight line distance in meters
+    for (const auto& road : network.roads) {
+        const auto& from = network.locations[road.from];
+        const auto& to = network.locations[road.to];
+        const double meters = std::hypot((from.first - to.first) * 111320 * std::cos(from.second * M_PI / 180),
+                                         (from.second - to.second) * 111320);
+        ASSERT_GE(road.weight + 1, meters);
+    }
+
+    const Graph graph = network.toGraph();
+    DijkstraEngine engine(graph);
+    std::vector<unsigned int> forward, backward;
+    engine.computeOneToAllDistances(0, forward);
+    engine.computeOneToAllDistances(0, backward, true);
+    EXPECT_EQ(std::count(forward.begin(), forward.end(), UINT_MAX), 0);
+    EXPECT_EQ(std::count(backward.begin(), backward.end(), UINT_MAX), 0);
+}
+
+TEST(generator_test, all_formats_give_the_same_distances) {
+    const auto network = generate_network(150, 5);
+    network.writeXenGraph("generated.xeng");
+    network.writeDIMACS("generated.gr");
+    network.writeCsv("generated");
+    network.writeAdjacencyMatrix("generated.csv");
+
+    const Graph graph = network.toGraph();
+    DijkstraEngine engine(graph);
+    std::vector<std::vector<unsigned int>> expected(graph.nodes());
+    for (unsigned int node = 0; node < graph.nodes(); node++) {
+        engine.computeOneToAllDistances(node, expected[node]);
+    }
+
+    for (const std::string input : {"generated.xeng", "generated.gr", "generated", "generated.csv"}) {
+        run_preprocessor(("-m dm --output-format csv --preprocessing-mode fast -i " + input
+                          + " -o generated_dm").c_str());
+        EXPECT_EQ(load_dm_csv("generated_dm.csv"), expected) << input;
+    }
+}
+
+TEST(generator_test, dijkstra_rank_and_local_queries) {
+    const auto network = generate_network(1000, 7);
+    const Graph graph = network.toGraph();
+    DijkstraEngine engine(graph);
+    std::vector<unsigned int> distances;
+
+    QuerySetGenerator queryGenerator(network, 1);
+    const auto sets = queryGenerator.byDijkstraRank(10);
+    ASSERT_GE(sets.size(), 10);
+    EXPECT_TRUE(sets[0].empty());
+    for (unsigned int rank = 1; rank < sets.size(); rank++) {
+        ASSERT_EQ(sets[rank].size(), 10);
+        for (const auto& [start, goal] : sets[rank]) {
+            engine.computeOneToAllDistances(start, distances);
+            const auto [closer, notFarther] = rank_bounds(distances, goal);
+            EXPECT_LE(closer, 1u << rank);
+            EXPECT_GT(notFarther, 1u << rank);
+        }
+    }
+
+    for (const auto& [start, goal] : queryGenerator.local(50, 64)) {
+        engine.computeOneToAllDistances(start, distances);
+        EXPECT_LE(rank_bounds(distances, goal).first, 64);
+    }
+
+    EXPECT_EQ(queryGenerator.longDistance(50).size(), 50);
+}
@@ -0,0 +1,120 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Czech Technical University in Prague
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. */
+#include <climits>
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+#include "gtest/gtest.h"
+#include "common.h"
+#include "Dijkstra/BasicDijkstra.h"
+#include "GraphBuilding/Structures/Graph.h"
+#include "HL/HLDistanceQueryManager.h"
+#include "HL/Structures/HubLabels.h"
+
+namespace {
+
+void compare_with_dm(const HubLabels& labels, const std::vector<std::vector<unsigned int>>& expected) {
+    ASSERT_EQ(labels.nodes(), expected.size());
+    const HLDistanceQueryManager merge(labels, HLDistanceQueryManager::Intersection::MERGE);
+    const HLDistanceQueryManager simd(labels, HLDistanceQueryManager::Intersection::SIMD);
+    for (unsigned int start = 0; start < expected.size(); start++) {
+        for (unsigned int goal = 0; goal < expected.size(); goal++) {
+            ASSERT_EQ(merge.findDistance(start, goal), expected[start][goal]);
+            ASSERT_EQ(simd.findDistance(start, goal), expected[start][goal]);
+        }
+    }
+}
+
+}
+
+TEST(hl_test, from_xengraph2) {
+    run_preprocessor("-m hl -i functest/02_xengraph.xeng -o hl_from_xengraph2");
+    const auto expected = load_dm_csv("functest/02_dm.csv");
+
+    compare_with_dm(HubLabels::load("hl_from_xengraph2.hl", false), expected);
+    compare_with_dm(HubLabels::load("hl_from_xengraph2.hl", true), expected);
+}
+
+TEST(hl_test, random_graph) {
+    const Graph graph = write_dimacs_graph<Graph>("hl_random.gr", random_grid_network(25, 1));
+    run_preprocessor("-m hl -i hl_random.gr -o hl_random");
+    run_preprocessor("-m hl -i hl_random.gr -o hl_random_compressed --compressed-labels");
+
+    const HubLabels labels = HubLabels::load("hl_random.hl", true);
+    const HubLabels compressed = HubLabels::load("hl_random_compressed.hl", true);
+    ASSERT_FALSE(labels.compressed());
+    ASSERT_TRUE(compressed.compressed());
+    ASSERT_EQ(labels.entries(true), compressed.entries(true));
+    ASSERT_EQ(labels.entries(false), compressed.entries(false));
+    ASSERT_LT(compressed.memoryUsage(), labels.memoryUsage());
+
+    const HLDistanceQueryManager merge(labels, HLDistanceQueryManager::Intersection::MERGE);
+    const HLDistanceQueryManager simd(labels, HLDistanceQueryManager::Intersection::SIMD);
+    const HLDistanceQueryManager decoding(compressed);
+    std::mt19937 generator(2);
+    std::uniform_int_distribution<unsigned int> node(0, graph.nodes() - 1);
+    for (unsigned int i = 0; i < 1000; i++) {
+        const unsigned int start = node(generator);
+        const unsigned int goal = node(generator);
+        const unsigned int expected = BasicDijkstra::run(start, goal, graph);
+        ASSERT_EQ(merge.findDistance(start, goal), expected) << "query " << start << " -> " << goal;
+        ASSERT_EQ(simd.findDistance(start, goal), expected) << "query " << start << " -> " << goal;
+        ASSERT_EQ(decoding.findDistance(start, goal), expected) << "query " << start << " -> " << goal;
+    }
+}
+
+TEST(hl_test, sums_saturate) {
+    // all the labels share 20 hubs (more than one SIMD block), the sums through all the hubs but hub 5 exceed UINT_MAX
+    // and would wrap below the distance through hub 5, between nodes 2 and 3 no sum fits
+    const uint32_t large = 0xC0000000u;
+    std::vector<std::vector<HubLabelEntry>> forward(4), backward(4);
+    for (uint32_t hub = 0; hub < 20; hub++) {
+        forward[0].push_back({hub, hub == 5 ? 1000000000u : large});
+        backward[1].push_back({hub, hub == 5 ? 1500000000u : large});
+        forward[2].push_back({hub, large});
+        backward[3].push_back({hub, large});
+    }
+
+    for (const bool compressed : {false, true}) {
+        const HubLabels labels = HubLabels::create(forward, backward, compressed);
+        const HLDistanceQueryManager merge(labels, HLDistanceQueryManager::Intersection::MERGE);
+        const HLDistanceQueryManager simd(labels, HLDistanceQueryManager::Intersection::SIMD);
+        for (const HLDistanceQueryManager* queryManager : {&merge, &simd}) {
+            ASSERT_EQ(queryManager->findDistance(0, 1), 2500000000u) << "compressed " << compressed;
+            ASSERT_EQ(queryManager->findDistance(2, 3), UINT_MAX) << "compressed " << compressed;
+        }
+    }
+}
+
+TEST(hl_test, truncated_file) {
+    run_preprocessor("-m hl -i functest/01_xengraph.xeng -o hl_truncated");
+    std::ifstream input("hl_truncated.hl", std::ios::binary);
+    std::string content((std::istreambuf_iterator<char>(input)), std::istreambuf_iterator<char>());
+    input.close();
+    std::ofstream output("hl_truncated.hl", std::ios::binary | std::ios::trunc);
+    output.write(content.data(), static_cast<std::streamsize>(content.size() / 2));
+    output.close();
+
+    ASSERT_THROW(HubLabels::load("hl_truncated.hl", false), std::runtime_error);
+}
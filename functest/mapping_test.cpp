@@ -0,0 +1,71 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Czech Technical University in Prague
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. */
+#include <fstream>
+#include <random>
+#include <stdexcept>
+#include <vector>
+#include "gtest/gtest.h"
+#include "common.h"
+#include "GraphBuilding/Loaders/NodeMappingLoader.h"
+
+void check_mapping(const NodeMapping& mapping, const std::vector<long long unsigned int>& ids) {
+	ASSERT_EQ(mapping.nodes(), ids.size());
+	for (unsigned int i = 0; i < ids.size(); i++) {
+		ASSERT_EQ(mapping.originalID(i), ids[i]);
+		ASSERT_TRUE(mapping.contains(ids[i]));
+		ASSERT_EQ(mapping.originalID(mapping.internalID(ids[i])), ids[i]);
+	}
+}
+
+TEST(mapping_test, text_and_binary) {
+	// random sparse IDs, the last one is a duplicate that must keep the first internal ID
+	std::mt19937_64 generator(42);
+	std::vector<long long unsigned int> ids;
+	for (unsigned int i = 0; i < 1000; i++) {
+		ids.push_back(generator() >> 4);
+	}
+	ids.push_back(ids[10]);
+
+	std::ofstream output("mapping_test.xeni");
+	output << "XID " << ids.size() << "\n";
+	for (const auto id : ids) {
+		output << id << "\n";
+	}
+	output.close();
+
+	run_preprocessor("--method mapping --input-path mapping_test.xeni --output-path mapping_test");
+
+	NodeMappingLoader textLoader("mapping_test.xeni");
+	NodeMappingLoader binaryLoader("mapping_test.xidb");
+	const NodeMapping text = textLoader.loadMapping();
+	const NodeMapping binary = binaryLoader.loadMapping();
+
+	check_mapping(text, ids);
+	check_mapping(binary, ids);
+	ASSERT_EQ(binary.internalID(ids.back()), 10u);
+
+	for (const auto id : {0ull, ids[5] + 1, ~0ull}) {
+		ASSERT_FALSE(binary.contains(id));
+		ASSERT_THROW(binary.internalID(id), std::out_of_range);
+	}
+}
@@ -0,0 +1,143 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Czech Technical University in Prague
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. */
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+#include "gtest/gtest.h"
+#include "common.h"
+#include "CH/CHDistanceQueryManager.h"
+#include "Dijkstra/BasicDijkstra.h"
+#include "GraphBuilding/Loaders/DDSGLoader.h"
+#include "GraphBuilding/Loaders/NodeMappingLoader.h"
+#include "GraphBuilding/Structures/Graph.h"
+
+namespace {
+
+constexpr unsigned int GRID_SIDE = 12;
+
+// A grid with the nodes numbered in a random order, written in the CSV format with the locations of the nodes. Some of
+// the edges are one-way and the grid is split into two components, so every ordering has to handle several components.
+Graph write_shuffled_grid(const std::string& directory, unsigned int seed) {
+    std::mt19937 generator(seed);
+    std::uniform_int_distribution<unsigned int> weight(1, 100);
+    std::bernoulli_distribution oneWay(0.2);
+
+    const unsigned int nodes = GRID_SIDE * GRID_SIDE;
+    std::vector<unsigned int> ids(nodes);
+    std::iota(ids.begin(), ids.end(), 0);
+    std::shuffle(ids.begin(), ids.end(), generator);
+
+    std::filesystem::create_directories(directory);
+    std::ofstream nodesOutput(directory + "/nodes.csv");
+    nodesOutput << "id\tx\ty\n";
+    for (unsigned int cell = 0; cell < nodes; cell++) {
+        nodesOutput << ids[cell] << "\t" << 14.4 + 0.001 * (cell % GRID_SIDE) << "\t" << 50.1 + 0.001 * (cell / GRID_SIDE)
+                    << "\n";
+    }
+
+    Graph graph(nodes);
+    std::ofstream edgesOutput(directory + "/edges.csv");
+    edgesOutput << "u\tv\tcost\n";
+    auto addEdge = [&](unsigned int from, unsigned int to) {
+        const unsigned int cost = weight(generator);
+        graph.addEdge(ids[from], ids[to], cost);
+        edgesOutput << ids[from] << "\t" << ids[to] << "\t" << cost << "\n";
+    };
+    for (unsigned int cell = 0; cell < nodes; cell++) {
+        const unsigned int column = cell % GRID_SIDE;
+        const unsigned int row = cell / GRID_SIDE;
+        for (const unsigned int neighbour : {cell + 1, cell + GRID_SIDE}) {
+            if ((neighbour == cell + 1 && column + 1 == GRID_SIDE) || neighbour >= nodes || (row == GRID_SIDE / 2 - 1
+                    && neighbour == cell + GRID_SIDE)) {
+                continue;
+            }
+            addEdge(cell, neighbour);
+            if (!oneWay(generator)) {
+                addEdge(neighbour, cell);
+            }
+        }
+    }
+    return graph;
+}
+
+void check_ch_with_mapping(const Graph& graph, const std::string& chPath, const NodeMapping& mapping,
+                           long long unsigned int (*originalID)(unsigned int)) {
+    DDSGLoader loader(chPath);
+    std::unique_ptr<FlagsGraph<NodeData>> ch(loader.loadFlagsGraph());
+    ASSERT_EQ(ch->nodes(), graph.nodes());
+    ASSERT_EQ(mapping.nodes(), graph.nodes());
+    CHDistanceQueryManager<NodeData> queryManager(*ch);
+
+    for (unsigned int start = 0; start < graph.nodes(); start++) {
+        for (unsigned int goal = 0; goal < graph.nodes(); goal++) {
+            const unsigned int expected = BasicDijkstra::run(start, goal, graph);
+            const unsigned int distance = queryManager.findDistance(mapping.internalID(originalID(start)),
+                                                                    mapping.internalID(originalID(goal)));
+            ASSERT_EQ(distance, expected) << "query " << start << " -> " << goal;
+        }
+    }
+}
+
+long long unsigned int sparse_id(unsigned int node) {
+    return 1000000ull + 7ull * node;
+}
+
+}
+
+TEST(reordering_test, ch_with_every_ordering) {
+    const Graph graph = write_shuffled_grid("reordering", 1);
+    for (const std::string ordering : {"bfs", "hilbert", "partition"}) {
+        run_preprocessor(("-m ch -f csv -i reordering -o reordering_" + ordering + " --reorder " + ordering).c_str());
+
+        NodeMappingLoader mappingLoader("reordering_" + ordering + ".xidb");
+        const NodeMapping mapping = mappingLoader.loadMapping();
+        for (unsigned int node = 0; node < graph.nodes(); node++) {
+            ASSERT_EQ(mapping.originalID(mapping.internalID(node)), node);
+        }
+        SCOPED_TRACE(ordering);
+        check_ch_with_mapping(graph, "reordering_" + ordering + ".ch", mapping,
+                              [](unsigned int node) { return static_cast<long long unsigned int>(node); });
+    }
+}
+
+TEST(reordering_test, composed_mapping) {
+    const Graph graph = write_shuffled_grid("reordering_composed", 2);
+    std::ofstream output("reordering_composed.xeni");
+    output << "XID " << graph.nodes() << "\n";
+    for (unsigned int node = 0; node < graph.nodes(); node++) {
+        output << sparse_id(node) << "\n";
+    }
+    output.close();
+
+    run_preprocessor("-m ch -f csv -i reordering_composed -o reordering_composed --reorder bfs "
+                     "--mapping-file reordering_composed.xeni");
+
+    NodeMappingLoader mappingLoader("reordering_composed.xidb");
+    const NodeMapping mapping = mappingLoader.loadMapping();
+    check_ch_with_mapping(graph, "reordering_composed.ch", mapping, sparse_id);
+}
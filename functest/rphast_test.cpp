@@ -0,0 +1,102 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Czech Technical University in Prague
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. */
+#include <climits>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+#include "gtest/gtest.h"
+#include "common.h"
+#include "CH/RPHASTQueryManager.h"
+#include "Dijkstra/BasicDijkstra.h"
+#include "GraphBuilding/Loaders/DDSGLoader.h"
+#include "GraphBuilding/Structures/Graph.h"
+
+TEST(rphast_test, one_to_many) {
+    const Graph graph = write_dimacs_graph<Graph>("rphast_random.gr", random_grid_network(20, 3, false, 20));
+    run_preprocessor("-m ch -i rphast_random.gr -o rphast_random");
+    std::unique_ptr<const FlagsGraph<NodeData>> ch(DDSGLoader("rphast_random.ch").loadFlagsGraph());
+
+    RPHASTQueryManager qm(*ch);
+    std::mt19937 generator(4);
+    std::uniform_int_distribution<unsigned int> node(0, graph.nodes() - 1);
+    std::vector<unsigned int> expected(graph.nodes());
+    std::vector<unsigned int> distances;
+    for (unsigned int selection = 0; selection < 5; selection++) {
+        // the targets may repeat
+        std::vector<unsigned int> targets(50);
+        for (unsigned int& target : targets) {
+            target = node(generator);
+        }
+        qm.selectTargets(targets);
+        ASSERT_EQ(qm.targets(), targets.size());
+        ASSERT_LT(qm.selectedNodes(), graph.nodes());
+
+        for (unsigned int query = 0; query < 20; query++) {
+            const unsigned int source = node(generator);
+            BasicDijkstra::computeOneToAllDistances(source, graph, expected);
+            qm.findDistances(source, distances);
+            ASSERT_EQ(distances.size(), targets.size());
+            for (size_t i = 0; i < targets.size(); i++) {
+                ASSERT_EQ(distances[i], expected[targets[i]]) << "query " << source << " -> " << targets[i];
+            }
+
+            const unsigned int limit = 3000;
+            qm.findDistances(source, distances, limit);
+            for (size_t i = 0; i < targets.size(); i++) {
+                ASSERT_EQ(distances[i], expected[targets[i]] <= limit ? expected[targets[i]] : UINT_MAX);
+            }
+        }
+    }
+}
+
+TEST(rphast_test, isochrone) {
+    const Graph graph = write_dimacs_graph<Graph>("rphast_isochrone.gr", random_grid_network(15, 5, false, 15));
+    run_preprocessor("-m ch -i rphast_isochrone.gr -o rphast_isochrone");
+    std::unique_ptr<FlagsGraph<NodeData>> ch(DDSGLoader("rphast_isochrone.ch").loadFlagsGraph());
+
+    RPHASTQueryManager qm(*ch);
+    qm.selectAllNodes();
+    ASSERT_EQ(qm.targets(), graph.nodes());
+    ASSERT_EQ(qm.selectedNodes(), graph.nodes());
+
+    std::vector<unsigned int> expected(graph.nodes());
+    std::vector<unsigned int> nodes;
+    std::vector<unsigned int> distances;
+    for (unsigned int source = 0; source < graph.nodes(); source += 7) {
+        BasicDijkstra::computeOneToAllDistances(source, graph, expected);
+        for (const unsigned int limit : {0u, 1000u, 5000u, UINT_MAX - 1}) {
+            qm.findTargetsInRange(source, limit, nodes, distances);
+            std::vector<unsigned int> expectedNodes;
+            for (unsigned int node = 0; node < graph.nodes(); node++) {
+                if (expected[node] <= limit) {
+                    expectedNodes.push_back(node);
+                }
+            }
+            ASSERT_EQ(nodes, expectedNodes) << "source " << source << ", limit " << limit;
+            for (size_t i = 0; i < nodes.size(); i++) {
+                ASSERT_EQ(distances[i], expected[nodes[i]]);
+            }
+        }
+    }
+}
@@ -0,0 +1,174 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Czech Technical University in Prague
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. */
+#include <climits>
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <utility>
+#include <vector>
+#include "gtest/gtest.h"
+#include "common.h"
+#include "Dijkstra/BasicDijkstra.h"
+#include "GraphBuilding/Structures/Graph.h"
+#include "Server/QueryBackend.h"
+#include "Server/QueryClient.h"
+#include "Server/QueryServer.h"
+
+TEST(server_test, ch_queries) {
+	run_preprocessor("-m ch -i functest/02_xengraph.xeng -o server_test");
+	const auto expected = load_dm_csv("functest/02_dm.csv");
+	const std::vector<unsigned long long> ids = {100, 200, 300, 400};
+	const NodeMapping mapping(ids);
+
+	auto backend = QueryBackend::create("ch", "server_test.ch", 2, true);
+	QueryServer server(*backend, &mapping, 8);
+	server.listen("server_test.sock");
+	std::thread serverThread([&server]() { server.run(); });
+
+	{
+		QueryClient client("server_test.sock");
+		ASSERT_EQ(client.distance(100, 300), expected[0][2]);
+
+		std::vector<unsigned int> matrix;
+		client.matrix(ids, ids, matrix);
+		ASSERT_EQ(matrix.size(), 16);
+		for (size_t i = 0; i < ids.size(); i++) {
+			for (size_t j = 0; j < ids.size(); j++) {
+				ASSERT_EQ(matrix[i * ids.size() + j], expected[i][j]);
+			}
+		}
+
+		std::vector<unsigned long long> path;
+		ASSERT_EQ(client.path(100, 300, path), expected[0][2]);
+		ASSERT_EQ(path, std::vector<unsigned long long>({100, 200, 400, 300}));
+
+		// an unknown ID is reported, but the connection stays usable
+		ASSERT_THROW(client.distance(100, 500), std::runtime_error);
+		ASSERT_EQ(client.distance(400, 200), expected[3][1]);
+	}
+
+	// concurrent clients, their requests are coalesced into shared batches
+	std::vector<std::thread> clients;
+	std::vector<int> failures(4, 0);
+	for (int c = 0; c < 4; c++) {
+		clients.emplace_back([&, c]() {
+			QueryClient client("server_test.sock");
+			for (int q = 0; q < 200; q++) {
+				const size_t start = static_cast<size_t>(q + c) % 4;
+				const size_t goal = static_cast<size_t>(q / 4 + c) % 4;
+				std::vector<unsigned int> distances;
+				client.distances({{ids[start], ids[goal]}, {ids[goal], ids[start]}}, distances);
+				failures[c] += distances[0] != expected[start][goal] || distances[1] != expected[goal][start];
+			}
+		});
+	}
+	for (auto& client : clients) {
+		client.join();
+	}
+	ASSERT_EQ(failures, std::vector<int>(4, 0));
+
+	server.stop();
+	serverThread.join();
+	const auto statistics = server.statistics();
+	ASSERT_EQ(statistics.requests, 804);
+	ASSERT_LE(statistics.batches, statistics.requests);
+}
+
+TEST(server_test, distance_only_backend) {
+	run_preprocessor("-m ch -i functest/02_xengraph.xeng -o server_test_internal");
+	const auto expected = load_dm_csv("functest/02_dm.csv");
+
+	auto backend = QueryBackend::create("ch", "server_test_internal.ch", 1, false);
+	QueryServer server(*backend, nullptr, 4096);
+	server.listen("server_test_internal.sock");
+	std::thread serverThread([&server]() { server.run(); });
+
+	{
+		QueryClient client("server_test_internal.sock");
+		std::vector<unsigned int> distances;
+		client.distances({{0, 1}, {2, 3}, {3, 0}}, distances);
+		ASSERT_EQ(distances, std::vector<unsigned int>({expected[0][1], expected[2][3], expected[3][0]}));
+
+		std::vector<unsigned long long> path;
+		ASSERT_THROW(client.path(0, 2, path), std::runtime_error);
+		ASSERT_THROW(client.distance(0, 4), std::runtime_error);
+		ASSERT_EQ(client.distance(1, 2), expected[1][2]);
+	}
+
+	server.stop();
+	serverThread.join();
+}
+
+TEST(server_test, simplified_structure) {
+	const Graph graph = write_dimacs_graph<Graph>("server_test_simplified.gr", random_road_network(3));
+	run_preprocessor("-m ch -i server_test_simplified.gr -o server_test_simplified --simplify");
+	run_preprocessor("-m tnr --preprocessing-mode slow --tnodes-cnt 5 -i server_test_simplified.gr "
+			"-o server_test_simplified --simplify");
+
+	std::vector<long long> starts;
+	std::vector<long long> goals;
+	std::vector<std::pair<unsigned int, unsigned int>> queries;
+	std::vector<long long> expected;
+	for (unsigned int start = 0; start < graph.nodes(); start++) {
+		for (unsigned int goal = 0; goal < graph.nodes(); goal++) {
+			starts.push_back(start);
+			goals.push_back(goal);
+			queries.emplace_back(start, goal);
+			expected.push_back(BasicDijkstra::run(start, goal, graph));
+		}
+	}
+
+	// the backends load the simplification table next to the structure and answer the queries in the original IDs
+	for (const auto& [method, file, paths] : std::vector<std::tuple<std::string, std::string, bool>>({
+			{"ch", "server_test_simplified.ch", false},
+			{"ch", "server_test_simplified.ch", true},
+			{"tnr", "server_test_simplified.tnrg", false}})) {
+		auto backend = QueryBackend::create(method, file, 2, paths);
+		ASSERT_EQ(backend->nodes(), graph.nodes());
+
+		std::vector<long long> distances;
+		backend->distances(starts, goals, distances);
+		ASSERT_EQ(distances, expected);
+
+		if (paths) {
+			std::vector<unsigned int> pathDistances;
+			std::vector<std::vector<unsigned int>> nodes;
+			backend->paths(queries, pathDistances, nodes);
+			for (size_t i = 0; i < queries.size(); i++) {
+				ASSERT_EQ(pathDistances[i], expected[i]);
+				if (pathDistances[i] != UINT_MAX) {
+					ASSERT_EQ(nodes[i].front(), queries[i].first);
+					ASSERT_EQ(nodes[i].back(), queries[i].second);
+				}
+			}
+		}
+	}
+
+	// a table which doesn't belong to the structure is rejected
+	run_preprocessor("-m ch -i server_test_simplified.gr -o server_test_not_simplified");
+	std::filesystem::copy_file("server_test_simplified.simp", "server_test_not_simplified.simp",
+			std::filesystem::copy_options::overwrite_existing);
+	ASSERT_THROW(QueryBackend::create("ch", "server_test_not_simplified.ch", 1, false), std::runtime_error);
+}
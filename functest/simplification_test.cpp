@@ -0,0 +1,157 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Czech Technical University in Prague
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. */
+#include <climits>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+#include "gtest/gtest.h"
+#include "common.h"
+#include "CH/CHDistanceQueryManager.h"
+#include "CH/CHPathQueryManager.h"
+#include "Dijkstra/BasicDijkstra.h"
+#include "GraphBuilding/Loaders/DDSGLoader.h"
+#include "GraphBuilding/Simplification/SimplificationTable.h"
+#include "GraphBuilding/Structures/Graph.h"
+
+namespace {
+
+SimplificationTable load_table(const std::string& path) {
+    std::ifstream input(path, std::ios::binary);
+    return SimplificationTable::read(input);
+}
+
+// Checks that the path leads from start to goal using the edges of the graph and that its length is the distance.
+void check_path(const Graph& graph, unsigned int start, unsigned int goal, const std::vector<SimpleEdge>& path, unsigned int distance) {
+    if (distance == UINT_MAX || start == goal) {
+        ASSERT_TRUE(path.empty());
+        return;
+    }
+
+    unsigned int current = start;
+    unsigned int length = 0;
+    for (const SimpleEdge& edge : path) {
+        ASSERT_EQ(edge.from, current);
+        unsigned int edgeLength = UINT_MAX;
+        for (const auto& [target, weight] : graph.outgoingEdges(edge.from)) {
+            if (target == edge.to) {
+                edgeLength = std::min(edgeLength, weight);
+            }
+        }
+        ASSERT_NE(edgeLength, UINT_MAX) << "edge " << edge.from << " -> " << edge.to;
+        length += edgeLength;
+        current = edge.to;
+    }
+    ASSERT_EQ(current, goal);
+    ASSERT_EQ(length, distance);
+}
+
+}
+
+TEST(simplification_test, ch_distances_and_paths) {
+    const Graph graph = write_dimacs_graph<Graph>("simplification.gr", random_road_network(1));
+    run_preprocessor("-m ch -i simplification.gr -o simplification --simplify");
+
+    const SimplificationTable table = load_table("simplification.simp");
+    ASSERT_EQ(table.nodes(), graph.nodes());
+    ASSERT_GT(table.treeNodes(), 0u);
+    ASSERT_GT(table.chainNodes(), 0u);
+    ASSERT_EQ(table.coreNodes() + table.treeNodes() + table.chainNodes(), graph.nodes());
+
+    DDSGLoader loader("simplification.ch");
+    std::unique_ptr<FlagsGraph<NodeData>> ch(loader.loadFlagsGraph());
+    ASSERT_EQ(ch->nodes(), table.coreNodes());
+    CHDistanceQueryManager<NodeData> distanceQueryManager(*ch);
+    std::unique_ptr<FlagsGraphWithUnpackingData> unpackingCh(DDSGLoader("simplification.ch").loadFlagsGraphWithUnpackingData());
+    CHPathQueryManager pathQueryManager(*unpackingCh);
+
+    auto coreDistance = [&](unsigned int start, unsigned int goal) {
+        return distanceQueryManager.findDistance(start, goal);
+    };
+    auto corePath = [&](unsigned int start, unsigned int goal, std::vector<SimpleEdge>& edges) {
+        return pathQueryManager.findPath(start, goal, edges);
+    };
+
+    std::vector<SimpleEdge> path;
+    for (unsigned int start = 0; start < graph.nodes(); start++) {
+        for (unsigned int goal = 0; goal < graph.nodes(); goal++) {
+            const unsigned int expected = BasicDijkstra::run(start, goal, graph);
+            ASSERT_EQ(table.findDistance(start, goal, coreDistance), expected) << "query " << start << " -> " << goal;
+            ASSERT_EQ(table.findPath(start, goal, corePath, path), expected) << "query " << start << " -> " << goal;
+            check_path(graph, start, goal, path, expected);
+        }
+    }
+}
+
+TEST(simplification_test, original_edge_preferred_to_equal_chain) {
+    // the core nodes 0-3 are fully connected and the chain 0 - 4 - 1 is as long as the edge 0 - 1, so the core edge
+    // between 0 and 1 is the original edge and the path uses it instead of the chain
+    RandomNetwork network{5, {}};
+    auto addEdge = [&network](unsigned int from, unsigned int to, unsigned int length) {
+        network.edges.emplace_back(from, to, length);
+        network.edges.emplace_back(to, from, length);
+    };
+    addEdge(0, 1, 5);
+    addEdge(0, 2, 7);
+    addEdge(0, 3, 7);
+    addEdge(1, 2, 7);
+    addEdge(1, 3, 7);
+    addEdge(2, 3, 7);
+    addEdge(0, 4, 2);
+    addEdge(4, 1, 3);
+    const Graph graph = write_dimacs_graph<Graph>("simplification_equal.gr", network);
+    run_preprocessor("-m ch -i simplification_equal.gr -o simplification_equal --simplify");
+
+    const SimplificationTable table = load_table("simplification_equal.simp");
+    ASSERT_EQ(table.coreNodes(), 4u);
+    ASSERT_EQ(table.chainNodes(), 1u);
+
+    std::unique_ptr<FlagsGraphWithUnpackingData> unpackingCh(DDSGLoader("simplification_equal.ch").loadFlagsGraphWithUnpackingData());
+    CHPathQueryManager pathQueryManager(*unpackingCh);
+    auto corePath = [&](unsigned int start, unsigned int goal, std::vector<SimpleEdge>& edges) {
+        return pathQueryManager.findPath(start, goal, edges);
+    };
+
+    std::vector<SimpleEdge> path;
+    for (const auto& [start, goal] : {std::make_pair(0u, 1u), std::make_pair(1u, 0u)}) {
+        ASSERT_EQ(table.findPath(start, goal, corePath, path), 5u);
+        ASSERT_EQ(path.size(), 1u) << "query " << start << " -> " << goal;
+        ASSERT_EQ(path[0].from, start);
+        ASSERT_EQ(path[0].to, goal);
+    }
+    ASSERT_EQ(table.findPath(0, 4, corePath, path), 2u);
+    check_path(graph, 0, 4, path, 2);
+}
+
+TEST(simplification_test, truncated_file) {
+    write_dimacs_graph<Graph>("simplification_truncated.gr", random_road_network(2));
+    run_preprocessor("-m ch -i simplification_truncated.gr -o simplification_truncated --simplify");
+    std::ifstream input("simplification_truncated.simp", std::ios::binary);
+    std::string content((std::istreambuf_iterator<char>(input)), std::istreambuf_iterator<char>());
+    input.close();
+    std::ofstream output("simplification_truncated.simp", std::ios::binary | std::ios::trunc);
+    output.write(content.data(), static_cast<std::streamsize>(content.size() - 4));
+    output.close();
+
+    ASSERT_THROW(load_table("simplification_truncated.simp"), std::runtime_error);
+}
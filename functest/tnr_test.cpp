@@ -20,11 +20,16 @@
  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
  * SOFTWARE. */
+#include <memory>
+#include <random>
 #include "gtest/gtest.h"
 #include "common.h"
 #include "expected_graphs.h"
 
+#include "Dijkstra/BasicDijkstra.h"
 #include "GraphBuilding/Loaders/TNRGLoader.h"
+#include "GraphBuilding/Structures/Graph.h"
+#include "TNR/TNRDistanceQueryManager.h"
 
 TEST(tnr_test, from_xengraph1) {
     run_preprocessor("--method tnr --input-format xengraph --preprocessing-mode fast --tnodes-cnt 1 --input-path functest/01_xengraph.xeng --output-path from_xengraph1");
@@ -143,3 +148,46 @@ TEST(tnr_test, from_csv4) {
     TransitNodeRoutingGraph<NodeData>* expected = build_tnr_graph_02_2_div100();
     compare_tnr_graphs(*loaded, *expected);
 }
+
+TEST(tnr_test, query_statistics) {
+#ifdef SHORTEST_PATHS_NO_QUERY_STATISTICS
+    GTEST_SKIP() << "The query statistics were disabled at compile time.";
+#endif
+    const Graph graph = write_dimacs_graph<Graph>("tnr_statistics.gr", random_grid_network(15, 4, true));
+    run_preprocessor("-m tnr --preprocessing-mode fast --tnodes-cnt 20 -i tnr_statistics.gr -o tnr_statistics");
+    std::unique_ptr<TransitNodeRoutingGraph<NodeData>> tnr(TNRGLoader("tnr_statistics.tnrg").loadTNRforDistanceQueries());
+
+    // every query is either local (answered by the Contraction Hierarchies search) or a transit query (answered from
+    // the access nodes and the distance table without any search)
+    TNRDistanceQueryManager queryManager(*tnr);
+    QueryStatistics statistics;
+    queryManager.setStatistics(&statistics);
+    std::mt19937 generator(6);
+    std::uniform_int_distribution<unsigned int> node(0, graph.nodes() - 1);
+    unsigned int queries = 0;
+    unsigned int local = 0;
+    unsigned int transit = 0;
+    while (queries < 300) {
+        const unsigned int start = node(generator);
+        const unsigned int goal = node(generator);
+        if (start == goal) {
+            continue;
+        }
+        queries++;
+        statistics.reset();
+        ASSERT_EQ(queryManager.findDistance(start, goal), BasicDijkstra::run(start, goal, graph));
+        if (statistics.localQueryFallbacks == 1 && statistics.settledNodes > 0 && statistics.accessNodePairs == 0) {
+            local++;
+        } else if (statistics.localQueryFallbacks == 0 && statistics.settledNodes == 0 && statistics.accessNodePairs > 0) {
+            transit++;
+        }
+    }
+    ASSERT_GT(local, 0u);
+    ASSERT_GT(transit, 0u);
+    ASSERT_EQ(local + transit, queries);
+
+    statistics.reset();
+    ASSERT_EQ(statistics.localQueryFallbacks, 0u);
+    ASSERT_EQ(statistics.accessNodePairs, 0u);
+    ASSERT_EQ(statistics.settledNodes, 0u);
+}
@@ -24,6 +24,10 @@
 #include "common.h"
 #include "expected_graphs.h"
 #include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
 
 #include "GraphBuilding/Loaders/TGAFLoader.h"
 
@@ -451,3 +455,60 @@ TEST(tnraf_test, from_csv3_dm) {
     delete expected;
     std::remove("from_csv3.tgaf");
 }
+
+
+/**
+ * The preprocessing modes only differ in how the distances are computed, so they have to write the same file.
+ */
+std::string read_tgaf(const std::string& path) {
+    std::ifstream input(path, std::ios::binary);
+    return std::string((std::istreambuf_iterator<char>(input)), std::istreambuf_iterator<char>());
+}
+
+TEST(tnraf_test, modes_write_identical_files) {
+    write_dimacs_graph<Graph>("tnraf_modes.gr", random_grid_network(12, 5, false, 4));
+    run_preprocessor("-m tnraf --preprocessing-mode slow --tnodes-cnt 20 -i tnraf_modes.gr -o tnraf_modes_slow");
+    run_preprocessor("-m tnraf --preprocessing-mode fast --tnodes-cnt 20 -i tnraf_modes.gr -o tnraf_modes_fast");
+    run_preprocessor("-m tnraf --preprocessing-mode dm --tnodes-cnt 20 -i tnraf_modes.gr -o tnraf_modes_dm");
+
+    const std::string slow = read_tgaf("tnraf_modes_slow.tgaf");
+    ASSERT_FALSE(slow.empty());
+    ASSERT_TRUE(slow == read_tgaf("tnraf_modes_fast.tgaf"));
+    ASSERT_TRUE(slow == read_tgaf("tnraf_modes_dm.tgaf"));
+
+    for (const std::string mode : {"slow", "fast", "dm"}) {
+        std::remove(("tnraf_modes_" + mode + ".tgaf").c_str());
+    }
+    std::remove("tnraf_modes.gr");
+}
+
+TEST(tnraf_test, memory_budget) {
+    write_dimacs_graph<Graph>("tnraf_budget.gr", random_road_network(4));
+    run_preprocessor("-m tnraf --preprocessing-mode dm --tnodes-cnt 20 -i tnraf_budget.gr -o tnraf_budget_unlimited");
+
+    // the preprocessor alone uses more than 1 MiB, so nothing fits into the budget: the forward access nodes are
+    // spilled into a temporary file, and the 'dm' mode is downgraded to 'slow'
+    run_preprocessor("-m tnraf --preprocessing-mode slow --tnodes-cnt 20 -i tnraf_budget.gr -o tnraf_budget_spilled "
+                     "--memory-budget 1 > tnraf_budget_spilled.log");
+    run_preprocessor("-m tnraf --preprocessing-mode dm --tnodes-cnt 20 -i tnraf_budget.gr -o tnraf_budget_downgraded "
+                     "--memory-budget 1 > tnraf_budget_downgraded.log");
+
+    const std::string spilledLog = read_tgaf("tnraf_budget_spilled.log");
+    ASSERT_NE(spilledLog.find("Memory budget: 1 MiB"), std::string::npos);
+    ASSERT_EQ(spilledLog.find("The preprocessing mode was changed"), std::string::npos);
+    ASSERT_NE(read_tgaf("tnraf_budget_downgraded.log").find("The preprocessing mode was changed to 'slow'"),
+              std::string::npos);
+
+    const std::string unlimited = read_tgaf("tnraf_budget_unlimited.tgaf");
+    ASSERT_FALSE(unlimited.empty());
+    ASSERT_TRUE(unlimited == read_tgaf("tnraf_budget_spilled.tgaf"));
+    ASSERT_TRUE(unlimited == read_tgaf("tnraf_budget_downgraded.tgaf"));
+    ASSERT_FALSE(std::filesystem::exists("tnraf_budget_spilled.tgaf.spill"));
+    ASSERT_FALSE(std::filesystem::exists("tnraf_budget_downgraded.tgaf.spill"));
+
+    for (const std::string name : {"unlimited", "spilled", "downgraded"}) {
+        std::remove(("tnraf_budget_" + name + ".tgaf").c_str());
+        std::remove(("tnraf_budget_" + name + ".log").c_str());
+    }
+    std::remove("tnraf_budget.gr");
+}
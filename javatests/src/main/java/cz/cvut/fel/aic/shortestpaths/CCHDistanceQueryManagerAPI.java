@@ -0,0 +1,101 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Czech Technical University in Prague
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. */
+
+/* ----------------------------------------------------------------------------
+ * This file was automatically generated by SWIG (http://www.swig.org).
+ * Version 3.0.8
+ *
+ * Do not make changes to this file unless you know what you are doing--modify
+ * the SWIG interface file instead.
+ * ----------------------------------------------------------------------------- */
+
+package cz.cvut.fel.aic.shortestpaths;
+
+public class CCHDistanceQueryManagerAPI {
+  private transient long swigCPtr;
+  protected transient boolean swigCMemOwn;
+
+  protected CCHDistanceQueryManagerAPI(long cPtr, boolean cMemoryOwn) {
+    swigCMemOwn = cMemoryOwn;
+    swigCPtr = cPtr;
+  }
+
+  protected static long getCPtr(CCHDistanceQueryManagerAPI obj) {
+    return (obj == null) ? 0 : obj.swigCPtr;
+  }
+
+  protected void finalize() {
+    delete();
+  }
+
+  public synchronized void delete() {
+    if (swigCPtr != 0) {
+      if (swigCMemOwn) {
+        swigCMemOwn = false;
+        shortestPathsJNI.delete_CCHDistanceQueryManagerAPI(swigCPtr);
+      }
+      swigCPtr = 0;
+    }
+  }
+
+  public void initializeCCH(String cchFile, String mappingFile) {
+    shortestPathsJNI.CCHDistanceQueryManagerAPI_initializeCCH(swigCPtr, this, cchFile, mappingFile);
+  }
+
+  public long distanceQuery(java.math.BigInteger start, java.math.BigInteger goal) {
+    return shortestPathsJNI.CCHDistanceQueryManagerAPI_distanceQuery(swigCPtr, this, start, goal);
+  }
+
+  public void distanceQueries(long[] starts, long[] goals, long[] distances, int count) {
+    shortestPathsJNI.CCHDistanceQueryManagerAPI_distanceQueries(swigCPtr, this, starts, goals, distances, count);
+  }
+
+  public void distanceQueriesDirect(java.nio.ByteBuffer startsBuffer, java.nio.ByteBuffer goalsBuffer, java.nio.ByteBuffer distancesBuffer, int count) {
+    shortestPathsJNI.CCHDistanceQueryManagerAPI_distanceQueriesDirect(swigCPtr, this, startsBuffer, goalsBuffer, distancesBuffer, count);
+  }
+
+  public void customize(String graphFile) {
+    shortestPathsJNI.CCHDistanceQueryManagerAPI_customize(swigCPtr, this, graphFile);
+  }
+
+  public void setThreads(long threads) {
+    shortestPathsJNI.CCHDistanceQueryManagerAPI_setThreads(swigCPtr, this, threads);
+  }
+
+  public void clearStructures() {
+    shortestPathsJNI.CCHDistanceQueryManagerAPI_clearStructures(swigCPtr, this);
+  }
+
+  public void setStatisticsEnabled(boolean enabled) {
+    shortestPathsJNI.CCHDistanceQueryManagerAPI_setStatisticsEnabled(swigCPtr, this, enabled);
+  }
+
+  public QueryStatistics getLastQueryStatistics() {
+    return new QueryStatistics(shortestPathsJNI.CCHDistanceQueryManagerAPI_getLastQueryStatistics(swigCPtr, this), true);
+  }
+
+  public CCHDistanceQueryManagerAPI() {
+    this(shortestPathsJNI.new_CCHDistanceQueryManagerAPI(), true);
+  }
+
+}
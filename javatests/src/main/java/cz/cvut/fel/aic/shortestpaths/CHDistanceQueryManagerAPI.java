@@ -66,10 +66,50 @@ public class CHDistanceQueryManagerAPI {
     return shortestPathsJNI.CHDistanceQueryManagerAPI_distanceQuery(swigCPtr, this, start, goal);
   }
 
+  public void distanceQueries(long[] starts, long[] goals, long[] distances, int count) {
+    shortestPathsJNI.CHDistanceQueryManagerAPI_distanceQueries(swigCPtr, this, starts, goals, distances, count);
+  }
+
+  public void distanceQueriesDirect(java.nio.ByteBuffer startsBuffer, java.nio.ByteBuffer goalsBuffer, java.nio.ByteBuffer distancesBuffer, int count) {
+    shortestPathsJNI.CHDistanceQueryManagerAPI_distanceQueriesDirect(swigCPtr, this, startsBuffer, goalsBuffer, distancesBuffer, count);
+  }
+
+  public void selectTargets(long[] targets, int count) {
+    shortestPathsJNI.CHDistanceQueryManagerAPI_selectTargets(swigCPtr, this, targets, count);
+  }
+
+  public void selectAllNodes() {
+    shortestPathsJNI.CHDistanceQueryManagerAPI_selectAllNodes(swigCPtr, this);
+  }
+
+  public int getTargetCount() {
+    return shortestPathsJNI.CHDistanceQueryManagerAPI_getTargetCount(swigCPtr, this);
+  }
+
+  public void oneToManyQuery(long source, long[] distances, int count) {
+    shortestPathsJNI.CHDistanceQueryManagerAPI_oneToManyQuery(swigCPtr, this, source, distances, count);
+  }
+
+  public int rangeQuery(long source, long limit, long[] nodes, long[] distances, int count) {
+    return shortestPathsJNI.CHDistanceQueryManagerAPI_rangeQuery(swigCPtr, this, source, limit, nodes, distances, count);
+  }
+
+  public void setThreads(long threads) {
+    shortestPathsJNI.CHDistanceQueryManagerAPI_setThreads(swigCPtr, this, threads);
+  }
+
   public void clearStructures() {
     shortestPathsJNI.CHDistanceQueryManagerAPI_clearStructures(swigCPtr, this);
   }
 
+  public void setStatisticsEnabled(boolean enabled) {
+    shortestPathsJNI.CHDistanceQueryManagerAPI_setStatisticsEnabled(swigCPtr, this, enabled);
+  }
+
+  public QueryStatistics getLastQueryStatistics() {
+    return new QueryStatistics(shortestPathsJNI.CHDistanceQueryManagerAPI_getLastQueryStatistics(swigCPtr, this), true);
+  }
+
   public CHDistanceQueryManagerAPI() {
     this(shortestPathsJNI.new_CHDistanceQueryManagerAPI(), true);
   }
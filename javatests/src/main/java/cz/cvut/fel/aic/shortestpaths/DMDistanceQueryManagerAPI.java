@@ -0,0 +1,77 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Czech Technical University in Prague
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. */
+
+/* ----------------------------------------------------------------------------
+ * This file was automatically generated by SWIG (http://www.swig.org).
+ * Version 3.0.8
+ *
+ * Do not make changes to this file unless you know what you are doing--modify
+ * the SWIG interface file instead.
+ * ----------------------------------------------------------------------------- */
+
+package cz.cvut.fel.aic.shortestpaths;
+
+public class DMDistanceQueryManagerAPI {
+  private transient long swigCPtr;
+  protected transient boolean swigCMemOwn;
+
+  protected DMDistanceQueryManagerAPI(long cPtr, boolean cMemoryOwn) {
+    swigCMemOwn = cMemoryOwn;
+    swigCPtr = cPtr;
+  }
+
+  protected static long getCPtr(DMDistanceQueryManagerAPI obj) {
+    return (obj == null) ? 0 : obj.swigCPtr;
+  }
+
+  protected void finalize() {
+    delete();
+  }
+
+  public synchronized void delete() {
+    if (swigCPtr != 0) {
+      if (swigCMemOwn) {
+        swigCMemOwn = false;
+        shortestPathsJNI.delete_DMDistanceQueryManagerAPI(swigCPtr);
+      }
+      swigCPtr = 0;
+    }
+  }
+
+  public void initializeDM(String dmFile, String mappingFile) {
+    shortestPathsJNI.DMDistanceQueryManagerAPI_initializeDM(swigCPtr, this, dmFile, mappingFile);
+  }
+
+  public long distanceQuery(java.math.BigInteger start, java.math.BigInteger goal) {
+    return shortestPathsJNI.DMDistanceQueryManagerAPI_distanceQuery(swigCPtr, this, start, goal);
+  }
+
+  public void clearStructures() {
+    shortestPathsJNI.DMDistanceQueryManagerAPI_clearStructures(swigCPtr, this);
+  }
+
+  public DMDistanceQueryManagerAPI() {
+    this(shortestPathsJNI.new_DMDistanceQueryManagerAPI(), true);
+  }
+
+}
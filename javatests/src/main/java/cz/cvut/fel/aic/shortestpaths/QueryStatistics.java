@@ -0,0 +1,97 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Czech Technical University in Prague
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. */
+
+/* ----------------------------------------------------------------------------
+ * This file was automatically generated by SWIG (http://www.swig.org).
+ * Version 3.0.8
+ *
+ * Do not make changes to this file unless you know what you are doing--modify
+ * the SWIG interface file instead.
+ * ----------------------------------------------------------------------------- */
+
+package cz.cvut.fel.aic.shortestpaths;
+
+public class QueryStatistics {
+  private transient long swigCPtr;
+  protected transient boolean swigCMemOwn;
+
+  protected QueryStatistics(long cPtr, boolean cMemoryOwn) {
+    swigCMemOwn = cMemoryOwn;
+    swigCPtr = cPtr;
+  }
+
+  protected static long getCPtr(QueryStatistics obj) {
+    return (obj == null) ? 0 : obj.swigCPtr;
+  }
+
+  protected void finalize() {
+    delete();
+  }
+
+  public synchronized void delete() {
+    if (swigCPtr != 0) {
+      if (swigCMemOwn) {
+        swigCMemOwn = false;
+        shortestPathsJNI.delete_QueryStatistics(swigCPtr);
+      }
+      swigCPtr = 0;
+    }
+  }
+
+  public void reset() {
+    shortestPathsJNI.QueryStatistics_reset(swigCPtr, this);
+  }
+
+  public long getSettledNodes() {
+    return shortestPathsJNI.QueryStatistics_settledNodes_get(swigCPtr, this);
+  }
+
+  public long getRelaxedEdges() {
+    return shortestPathsJNI.QueryStatistics_relaxedEdges_get(swigCPtr, this);
+  }
+
+  public long getStalledNodes() {
+    return shortestPathsJNI.QueryStatistics_stalledNodes_get(swigCPtr, this);
+  }
+
+  public long getHeapPushes() {
+    return shortestPathsJNI.QueryStatistics_heapPushes_get(swigCPtr, this);
+  }
+
+  public long getLocalQueryFallbacks() {
+    return shortestPathsJNI.QueryStatistics_localQueryFallbacks_get(swigCPtr, this);
+  }
+
+  public long getAccessNodePairs() {
+    return shortestPathsJNI.QueryStatistics_accessNodePairs_get(swigCPtr, this);
+  }
+
+  public long getArcFlagPrunes() {
+    return shortestPathsJNI.QueryStatistics_arcFlagPrunes_get(swigCPtr, this);
+  }
+
+  public QueryStatistics() {
+    this(shortestPathsJNI.new_QueryStatistics(), true);
+  }
+
+}
@@ -66,10 +66,30 @@ public class TNRAFDistanceQueryManagerAPI {
     return shortestPathsJNI.TNRAFDistanceQueryManagerAPI_distanceQuery(swigCPtr, this, start, goal);
   }
 
+  public void distanceQueries(long[] starts, long[] goals, long[] distances, int count) {
+    shortestPathsJNI.TNRAFDistanceQueryManagerAPI_distanceQueries(swigCPtr, this, starts, goals, distances, count);
+  }
+
+  public void distanceQueriesDirect(java.nio.ByteBuffer startsBuffer, java.nio.ByteBuffer goalsBuffer, java.nio.ByteBuffer distancesBuffer, int count) {
+    shortestPathsJNI.TNRAFDistanceQueryManagerAPI_distanceQueriesDirect(swigCPtr, this, startsBuffer, goalsBuffer, distancesBuffer, count);
+  }
+
+  public void setThreads(long threads) {
+    shortestPathsJNI.TNRAFDistanceQueryManagerAPI_setThreads(swigCPtr, this, threads);
+  }
+
   public void clearStructures() {
     shortestPathsJNI.TNRAFDistanceQueryManagerAPI_clearStructures(swigCPtr, this);
   }
 
+  public void setStatisticsEnabled(boolean enabled) {
+    shortestPathsJNI.TNRAFDistanceQueryManagerAPI_setStatisticsEnabled(swigCPtr, this, enabled);
+  }
+
+  public QueryStatistics getLastQueryStatistics() {
+    return new QueryStatistics(shortestPathsJNI.TNRAFDistanceQueryManagerAPI_getLastQueryStatistics(swigCPtr, this), true);
+  }
+
   public TNRAFDistanceQueryManagerAPI() {
     this(shortestPathsJNI.new_TNRAFDistanceQueryManagerAPI(), true);
   }
@@ -66,10 +66,30 @@ public class TNRDistanceQueryManagerAPI {
     return shortestPathsJNI.TNRDistanceQueryManagerAPI_distanceQuery(swigCPtr, this, start, goal);
   }
 
+  public void distanceQueries(long[] starts, long[] goals, long[] distances, int count) {
+    shortestPathsJNI.TNRDistanceQueryManagerAPI_distanceQueries(swigCPtr, this, starts, goals, distances, count);
+  }
+
+  public void distanceQueriesDirect(java.nio.ByteBuffer startsBuffer, java.nio.ByteBuffer goalsBuffer, java.nio.ByteBuffer distancesBuffer, int count) {
+    shortestPathsJNI.TNRDistanceQueryManagerAPI_distanceQueriesDirect(swigCPtr, this, startsBuffer, goalsBuffer, distancesBuffer, count);
+  }
+
+  public void setThreads(long threads) {
+    shortestPathsJNI.TNRDistanceQueryManagerAPI_setThreads(swigCPtr, this, threads);
+  }
+
   public void clearStructures() {
     shortestPathsJNI.TNRDistanceQueryManagerAPI_clearStructures(swigCPtr, this);
   }
 
+  public void setStatisticsEnabled(boolean enabled) {
+    shortestPathsJNI.TNRDistanceQueryManagerAPI_setStatisticsEnabled(swigCPtr, this, enabled);
+  }
+
+  public QueryStatistics getLastQueryStatistics() {
+    return new QueryStatistics(shortestPathsJNI.TNRDistanceQueryManagerAPI_getLastQueryStatistics(swigCPtr, this), true);
+  }
+
   public TNRDistanceQueryManagerAPI() {
     this(shortestPathsJNI.new_TNRDistanceQueryManagerAPI(), true);
   }
@@ -32,19 +32,65 @@
 package cz.cvut.fel.aic.shortestpaths;
 
 public class shortestPathsJNI {
+  public final static native void QueryStatistics_reset(long jarg1, QueryStatistics jarg1_);
+  public final static native long QueryStatistics_settledNodes_get(long jarg1, QueryStatistics jarg1_);
+  public final static native long QueryStatistics_relaxedEdges_get(long jarg1, QueryStatistics jarg1_);
+  public final static native long QueryStatistics_stalledNodes_get(long jarg1, QueryStatistics jarg1_);
+  public final static native long QueryStatistics_heapPushes_get(long jarg1, QueryStatistics jarg1_);
+  public final static native long QueryStatistics_localQueryFallbacks_get(long jarg1, QueryStatistics jarg1_);
+  public final static native long QueryStatistics_accessNodePairs_get(long jarg1, QueryStatistics jarg1_);
+  public final static native long QueryStatistics_arcFlagPrunes_get(long jarg1, QueryStatistics jarg1_);
+  public final static native long new_QueryStatistics();
+  public final static native void delete_QueryStatistics(long jarg1);
   public final static native void CHDistanceQueryManagerAPI_initializeCH(long jarg1, CHDistanceQueryManagerAPI jarg1_, String jarg2, String jarg3);
   public final static native long CHDistanceQueryManagerAPI_distanceQuery(long jarg1, CHDistanceQueryManagerAPI jarg1_, java.math.BigInteger jarg2, java.math.BigInteger jarg3);
+  public final static native void CHDistanceQueryManagerAPI_distanceQueries(long jarg1, CHDistanceQueryManagerAPI jarg1_, long[] jarg2, long[] jarg3, long[] jarg4, int jarg5);
+  public final static native void CHDistanceQueryManagerAPI_distanceQueriesDirect(long jarg1, CHDistanceQueryManagerAPI jarg1_, java.nio.ByteBuffer jarg2, java.nio.ByteBuffer jarg3, java.nio.ByteBuffer jarg4, int jarg5);
+  public final static native void CHDistanceQueryManagerAPI_selectTargets(long jarg1, CHDistanceQueryManagerAPI jarg1_, long[] jarg2, int jarg3);
+  public final static native void CHDistanceQueryManagerAPI_selectAllNodes(long jarg1, CHDistanceQueryManagerAPI jarg1_);
+  public final static native int CHDistanceQueryManagerAPI_getTargetCount(long jarg1, CHDistanceQueryManagerAPI jarg1_);
+  public final static native void CHDistanceQueryManagerAPI_oneToManyQuery(long jarg1, CHDistanceQueryManagerAPI jarg1_, long jarg2, long[] jarg3, int jarg4);
+  public final static native int CHDistanceQueryManagerAPI_rangeQuery(long jarg1, CHDistanceQueryManagerAPI jarg1_, long jarg2, long jarg3, long[] jarg4, long[] jarg5, int jarg6);
+  public final static native void CHDistanceQueryManagerAPI_setThreads(long jarg1, CHDistanceQueryManagerAPI jarg1_, long jarg2);
   public final static native void CHDistanceQueryManagerAPI_clearStructures(long jarg1, CHDistanceQueryManagerAPI jarg1_);
+  public final static native void CHDistanceQueryManagerAPI_setStatisticsEnabled(long jarg1, CHDistanceQueryManagerAPI jarg1_, boolean jarg2);
+  public final static native long CHDistanceQueryManagerAPI_getLastQueryStatistics(long jarg1, CHDistanceQueryManagerAPI jarg1_);
   public final static native long new_CHDistanceQueryManagerAPI();
   public final static native void delete_CHDistanceQueryManagerAPI(long jarg1);
+  public final static native void CCHDistanceQueryManagerAPI_initializeCCH(long jarg1, CCHDistanceQueryManagerAPI jarg1_, String jarg2, String jarg3);
+  public final static native long CCHDistanceQueryManagerAPI_distanceQuery(long jarg1, CCHDistanceQueryManagerAPI jarg1_, java.math.BigInteger jarg2, java.math.BigInteger jarg3);
+  public final static native void CCHDistanceQueryManagerAPI_distanceQueries(long jarg1, CCHDistanceQueryManagerAPI jarg1_, long[] jarg2, long[] jarg3, long[] jarg4, int jarg5);
+  public final static native void CCHDistanceQueryManagerAPI_distanceQueriesDirect(long jarg1, CCHDistanceQueryManagerAPI jarg1_, java.nio.ByteBuffer jarg2, java.nio.ByteBuffer jarg3, java.nio.ByteBuffer jarg4, int jarg5);
+  public final static native void CCHDistanceQueryManagerAPI_customize(long jarg1, CCHDistanceQueryManagerAPI jarg1_, String jarg2);
+  public final static native void CCHDistanceQueryManagerAPI_setThreads(long jarg1, CCHDistanceQueryManagerAPI jarg1_, long jarg2);
+  public final static native void CCHDistanceQueryManagerAPI_clearStructures(long jarg1, CCHDistanceQueryManagerAPI jarg1_);
+  public final static native void CCHDistanceQueryManagerAPI_setStatisticsEnabled(long jarg1, CCHDistanceQueryManagerAPI jarg1_, boolean jarg2);
+  public final static native long CCHDistanceQueryManagerAPI_getLastQueryStatistics(long jarg1, CCHDistanceQueryManagerAPI jarg1_);
+  public final static native long new_CCHDistanceQueryManagerAPI();
+  public final static native void delete_CCHDistanceQueryManagerAPI(long jarg1);
   public final static native void TNRDistanceQueryManagerAPI_initializeTNR(long jarg1, TNRDistanceQueryManagerAPI jarg1_, String jarg2, String jarg3);
   public final static native long TNRDistanceQueryManagerAPI_distanceQuery(long jarg1, TNRDistanceQueryManagerAPI jarg1_, java.math.BigInteger jarg2, java.math.BigInteger jarg3);
+  public final static native void TNRDistanceQueryManagerAPI_distanceQueries(long jarg1, TNRDistanceQueryManagerAPI jarg1_, long[] jarg2, long[] jarg3, long[] jarg4, int jarg5);
+  public final static native void TNRDistanceQueryManagerAPI_distanceQueriesDirect(long jarg1, TNRDistanceQueryManagerAPI jarg1_, java.nio.ByteBuffer jarg2, java.nio.ByteBuffer jarg3, java.nio.ByteBuffer jarg4, int jarg5);
+  public final static native void TNRDistanceQueryManagerAPI_setThreads(long jarg1, TNRDistanceQueryManagerAPI jarg1_, long jarg2);
   public final static native void TNRDistanceQueryManagerAPI_clearStructures(long jarg1, TNRDistanceQueryManagerAPI jarg1_);
+  public final static native void TNRDistanceQueryManagerAPI_setStatisticsEnabled(long jarg1, TNRDistanceQueryManagerAPI jarg1_, boolean jarg2);
+  public final static native long TNRDistanceQueryManagerAPI_getLastQueryStatistics(long jarg1, TNRDistanceQueryManagerAPI jarg1_);
   public final static native long new_TNRDistanceQueryManagerAPI();
   public final static native void delete_TNRDistanceQueryManagerAPI(long jarg1);
   public final static native void TNRAFDistanceQueryManagerAPI_initializeTNRAF(long jarg1, TNRAFDistanceQueryManagerAPI jarg1_, String jarg2, String jarg3);
   public final static native long TNRAFDistanceQueryManagerAPI_distanceQuery(long jarg1, TNRAFDistanceQueryManagerAPI jarg1_, java.math.BigInteger jarg2, java.math.BigInteger jarg3);
+  public final static native void TNRAFDistanceQueryManagerAPI_distanceQueries(long jarg1, TNRAFDistanceQueryManagerAPI jarg1_, long[] jarg2, long[] jarg3, long[] jarg4, int jarg5);
+  public final static native void TNRAFDistanceQueryManagerAPI_distanceQueriesDirect(long jarg1, TNRAFDistanceQueryManagerAPI jarg1_, java.nio.ByteBuffer jarg2, java.nio.ByteBuffer jarg3, java.nio.ByteBuffer jarg4, int jarg5);
+  public final static native void TNRAFDistanceQueryManagerAPI_setThreads(long jarg1, TNRAFDistanceQueryManagerAPI jarg1_, long jarg2);
   public final static native void TNRAFDistanceQueryManagerAPI_clearStructures(long jarg1, TNRAFDistanceQueryManagerAPI jarg1_);
+  public final static native void TNRAFDistanceQueryManagerAPI_setStatisticsEnabled(long jarg1, TNRAFDistanceQueryManagerAPI jarg1_, boolean jarg2);
+  public final static native long TNRAFDistanceQueryManagerAPI_getLastQueryStatistics(long jarg1, TNRAFDistanceQueryManagerAPI jarg1_);
   public final static native long new_TNRAFDistanceQueryManagerAPI();
   public final static native void delete_TNRAFDistanceQueryManagerAPI(long jarg1);
+  public final static native void DMDistanceQueryManagerAPI_initializeDM(long jarg1, DMDistanceQueryManagerAPI jarg1_, String jarg2, String jarg3);
+  public final static native long DMDistanceQueryManagerAPI_distanceQuery(long jarg1, DMDistanceQueryManagerAPI jarg1_, java.math.BigInteger jarg2, java.math.BigInteger jarg3);
+  public final static native void DMDistanceQueryManagerAPI_clearStructures(long jarg1, DMDistanceQueryManagerAPI jarg1_);
+  public final static native long new_DMDistanceQueryManagerAPI();
+  public final static native void delete_DMDistanceQueryManagerAPI(long jarg1);
 }
@@ -22,6 +22,7 @@
  * SOFTWARE. */
 package cz.cvut.fel.aic.sptests;
 
+import static org.junit.jupiter.api.Assertions.assertArrayEquals;
 import static org.junit.jupiter.api.Assertions.assertEquals;
 
 import cz.cvut.fel.aic.shortestpaths.TNRAFDistanceQueryManagerAPI;
@@ -34,7 +35,11 @@ import org.junit.jupiter.api.Test;
 
 import java.io.FileNotFoundException;
 import java.math.BigInteger;
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.nio.LongBuffer;
 import java.util.ArrayList;
+import java.util.Arrays;
 
 // This class can be used to test that the API works correctly and one can call the library functions from Java.
 // All tests are conducted on a graph of Prague that is precomputed for various methods (CH, TNR and TNRAF).
@@ -245,4 +250,158 @@ class ShortestPathsLibraryTests {
         dqmm.clearStructures();
 
     }
+
+    @Test
+    @DisplayName("Test 7 - Contraction Hierarchies - 5000 queries answered in batches - mapping required")
+    void chBatchTest() {
+        System.loadLibrary("shortestPaths");
+
+        CHDistanceQueryManagerAPI dqmm = new CHDistanceQueryManagerAPI();
+        dqmm.initializeCH("./data/PragueCH.ch", "./data/PragueMapping.xeni");
+        Loader l = new Loader();
+        ArrayList<Pair<BigInteger, BigInteger>> testQueries = new ArrayList<Pair<BigInteger, BigInteger>>();
+        ArrayList<Double> testDistances = new ArrayList<Double>();
+        try {
+            testQueries = l.loadQueriesBigInteger("./data/test5000queries.txt");
+            testDistances = l.loadTrueDistances("./data/test5000reference.txt", testQueries.size());
+        } catch (FileNotFoundException e) {
+            System.out.println("Error reading input files for the test.");
+            e.printStackTrace();
+        }
+
+        int count = testQueries.size();
+        long[] starts = new long[count];
+        long[] goals = new long[count];
+        long[] distances = new long[count];
+        for (int i = 0; i < count; i++) {
+            starts[i] = testQueries.get(i).getElement0().longValue();
+            goals[i] = testQueries.get(i).getElement1().longValue();
+        }
+
+        // The per-query overhead of crossing the language boundary is shown by comparing the single queries
+        // with one batch answered in a single native call.
+        long singleStart = System.nanoTime();
+        for (int i = 0; i < count; i++) {
+            dqmm.distanceQuery(testQueries.get(i).getElement0(), testQueries.get(i).getElement1());
+        }
+        long singleTime = System.nanoTime() - singleStart;
+
+        long batchStart = System.nanoTime();
+        dqmm.distanceQueries(starts, goals, distances, count);
+        long batchTime = System.nanoTime() - batchStart;
+
+        for (int i = 0; i < count; i++) {
+            assertEquals(testDistances.get(i), distances[i], eps);
+        }
+
+        dqmm.setThreads(4);
+        long[] parallelDistances = new long[count];
+        long parallelStart = System.nanoTime();
+        dqmm.distanceQueries(starts, goals, parallelDistances, count);
+        long parallelTime = System.nanoTime() - parallelStart;
+
+        assertArrayEquals(distances, parallelDistances);
+
+        System.out.printf("Single queries: %.3f us per query%n", singleTime / 1000.0 / count);
+        System.out.printf("Batch: %.3f us per query%n", batchTime / 1000.0 / count);
+        System.out.printf("Batch with 4 threads: %.3f us per query%n", parallelTime / 1000.0 / count);
+
+        dqmm.clearStructures();
+
+    }
+
+    @Test
+    @DisplayName("Test 8 - Transit Node Routing with Arc Flags - 5000 queries in direct buffers - mapping required")
+    void tnrafDirectBatchTest() {
+        System.loadLibrary("shortestPaths");
+
+        TNRAFDistanceQueryManagerAPI dqmm = new TNRAFDistanceQueryManagerAPI();
+        dqmm.initializeTNRAF("./data/PragueTNRAF1000tnodes.tgaf", "./data/PragueMapping.xeni");
+        Loader l = new Loader();
+        ArrayList<Pair<BigInteger, BigInteger>> testQueries = new ArrayList<Pair<BigInteger, BigInteger>>();
+        ArrayList<Double> testDistances = new ArrayList<Double>();
+        try {
+            testQueries = l.loadQueriesBigInteger("./data/test5000queries.txt");
+            testDistances = l.loadTrueDistances("./data/test5000reference.txt", testQueries.size());
+        } catch (FileNotFoundException e) {
+            System.out.println("Error reading input files for the test.");
+            e.printStackTrace();
+        }
+
+        // The direct buffers must contain 64-bit values in the native byte order.
+        int count = testQueries.size();
+        ByteBuffer startsBuffer = ByteBuffer.allocateDirect(count * Long.BYTES).order(ByteOrder.nativeOrder());
+        ByteBuffer goalsBuffer = ByteBuffer.allocateDirect(count * Long.BYTES).order(ByteOrder.nativeOrder());
+        ByteBuffer distancesBuffer = ByteBuffer.allocateDirect(count * Long.BYTES).order(ByteOrder.nativeOrder());
+        for (int i = 0; i < count; i++) {
+            startsBuffer.putLong(i * Long.BYTES, testQueries.get(i).getElement0().longValue());
+            goalsBuffer.putLong(i * Long.BYTES, testQueries.get(i).getElement1().longValue());
+        }
+
+        dqmm.setThreads(2);
+        dqmm.distanceQueriesDirect(startsBuffer, goalsBuffer, distancesBuffer, count);
+
+        LongBuffer distances = distancesBuffer.asLongBuffer();
+        for (int i = 0; i < count; i++) {
+            assertEquals(testDistances.get(i), distances.get(i), eps);
+        }
+
+        dqmm.clearStructures();
+
+    }
+
+    @Test
+    @DisplayName("Test 9 - Contraction Hierarchies - one-to-many and range queries to 5000 targets - mapping required")
+    void chOneToManyTest() {
+        System.loadLibrary("shortestPaths");
+
+        CHDistanceQueryManagerAPI dqmm = new CHDistanceQueryManagerAPI();
+        dqmm.initializeCH("./data/PragueCH.ch", "./data/PragueMapping.xeni");
+        Loader l = new Loader();
+        ArrayList<Pair<BigInteger, BigInteger>> testQueries = new ArrayList<Pair<BigInteger, BigInteger>>();
+        try {
+            testQueries = l.loadQueriesBigInteger("./data/test5000queries.txt");
+        } catch (FileNotFoundException e) {
+            System.out.println("Error reading input files for the test.");
+            e.printStackTrace();
+        }
+
+        // The goals of the test queries are the targets, the starts of the first queries are the sources.
+        int count = testQueries.size();
+        long[] targets = new long[count];
+        for (int i = 0; i < count; i++) {
+            targets[i] = testQueries.get(i).getElement1().longValue();
+        }
+        dqmm.selectTargets(targets, count);
+        assertEquals(count, dqmm.getTargetCount());
+
+        long[] distances = new long[count];
+        long[] nodes = new long[count];
+        long[] rangeDistances = new long[count];
+        long[] sources = new long[count];
+        long[] expected = new long[count];
+        for (int query = 0; query < 10; query++) {
+            long source = testQueries.get(query).getElement0().longValue();
+            dqmm.oneToManyQuery(source, distances, count);
+
+            Arrays.fill(sources, source);
+            dqmm.distanceQueries(sources, targets, expected, count);
+            assertArrayEquals(expected, distances);
+
+            long limit = 600000;
+            int found = dqmm.rangeQuery(source, limit, nodes, rangeDistances, count);
+            int j = 0;
+            for (int i = 0; i < count; i++) {
+                if (expected[i] <= limit) {
+                    assertEquals(targets[i], nodes[j]);
+                    assertEquals(expected[i], rangeDistances[j]);
+                    j++;
+                }
+            }
+            assertEquals(j, found);
+        }
+
+        dqmm.clearStructures();
+
+    }
 }
@@ -0,0 +1,83 @@
+%module shortestPaths
+
+/* The batched queries take the node IDs and return the distances in 'long[]' arrays. The start and goal IDs are
+ * only read, so the possible copies made by the JVM are released without being copied back. */
+%typemap(jni) const long long *IDS, long long *DISTANCES "jlongArray"
+%typemap(jtype) const long long *IDS, long long *DISTANCES "long[]"
+%typemap(jstype) const long long *IDS, long long *DISTANCES "long[]"
+%typemap(javain) const long long *IDS, long long *DISTANCES "$javainput"
+%typemap(in) const long long *IDS, long long *DISTANCES {
+    if (!$input) {
+        SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null array");
+        return $null;
+    }
+    $1 = (long long *) jenv->GetLongArrayElements($input, 0);
+}
+%typemap(freearg) const long long *IDS {
+    jenv->ReleaseLongArrayElements($input, (jlong *) $1, JNI_ABORT);
+}
+%typemap(freearg) long long *DISTANCES {
+    jenv->ReleaseLongArrayElements($input, (jlong *) $1, 0);
+}
+
+/* The direct variant works with the memory of direct ByteBuffers, nothing is copied at all. */
+%typemap(jni) const long long *ID_BUFFER, long long *DISTANCE_BUFFER "jobject"
+%typemap(jtype) const long long *ID_BUFFER, long long *DISTANCE_BUFFER "java.nio.ByteBuffer"
+%typemap(jstype) const long long *ID_BUFFER, long long *DISTANCE_BUFFER "java.nio.ByteBuffer"
+%typemap(javain) const long long *ID_BUFFER, long long *DISTANCE_BUFFER "$javainput"
+%typemap(in) const long long *ID_BUFFER, long long *DISTANCE_BUFFER {
+    $1 = $input ? (long long *) jenv->GetDirectBufferAddress($input) : 0;
+    if (!$1) {
+        SWIG_JavaThrowException(jenv, SWIG_JavaIllegalArgumentException, "a direct ByteBuffer is required");
+        return $null;
+    }
+}
+
+%apply const long long *IDS { const long long *starts, const long long *goals, const long long *targets };
+%apply long long *DISTANCES { long long *distances, long long *nodes };
+%apply const long long *ID_BUFFER { const long long *startsBuffer, const long long *goalsBuffer };
+%apply long long *DISTANCE_BUFFER { long long *distancesBuffer };
+
+/* Unknown node IDs in a batch are reported as exceptions instead of terminating the JVM. */
+%exception distanceQueries {
+    try {
+        $action
+    } catch (const std::exception & e) {
+        SWIG_JavaThrowException(jenv, SWIG_JavaIllegalArgumentException, e.what());
+    }
+}
+%exception distanceQueriesDirect {
+    try {
+        $action
+    } catch (const std::exception & e) {
+        SWIG_JavaThrowException(jenv, SWIG_JavaIllegalArgumentException, e.what());
+    }
+}
+%exception selectTargets {
+    try {
+        $action
+    } catch (const std::exception & e) {
+        SWIG_JavaThrowException(jenv, SWIG_JavaIllegalArgumentException, e.what());
+    }
+}
+%exception selectAllNodes {
+    try {
+        $action
+    } catch (const std::exception & e) {
+        SWIG_JavaThrowException(jenv, SWIG_JavaIllegalArgumentException, e.what());
+    }
+}
+%exception oneToManyQuery {
+    try {
+        $action
+    } catch (const std::exception & e) {
+        SWIG_JavaThrowException(jenv, SWIG_JavaIllegalArgumentException, e.what());
+    }
+}
+%exception rangeQuery {
+    try {
+        $action
+    } catch (const std::exception & e) {
+        SWIG_JavaThrowException(jenv, SWIG_JavaIllegalArgumentException, e.what());
+    }
+}
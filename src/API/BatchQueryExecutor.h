@@ -0,0 +1,149 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Czech Technical University in Prague
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. */
+
+/******************************************************************************
+* File:             BatchQueryExecutor.h
+*
+* Description:      Answers batches of distance queries, optionally in parallel
+*****************************************************************************/
+
+#ifndef SHORTEST_PATHS_BATCHQUERYEXECUTOR_H
+#define SHORTEST_PATHS_BATCHQUERYEXECUTOR_H
+
+#include <algorithm>
+#include <exception>
+#include <memory>
+#include <vector>
+#include <omp.h>
+#include "../GraphBuilding/Simplification/SimplificationTable.h"
+
+/**
+ * Answers whole batches of distance queries for the API classes, so that the languages using the library through SWIG
+ * only cross the language boundary once per batch. The query managers keep the state of the running query themselves
+ * and only read the graph, so every thread gets its own query manager and all of them share the one graph loaded by
+ * the API class. Each additional thread only adds the search workspace of its manager (a few bytes per node).
+ * If the structure was preprocessed from a simplified graph, the distance queries are answered through its
+ * simplification table.
+ *
+ * @tparam Graph The data structure used by the query manager (for example FlagsGraph<NodeData>).
+ * @tparam QueryManager The query manager, it has to be constructible from 'const Graph&' and provide
+ * 'findDistance(unsigned int, unsigned int)'.
+ */
+template <class Graph, class QueryManager>
+class BatchQueryExecutor {
+public:
+    /**
+     * Prepares the query managers for the given number of threads. Previously prepared managers are released.
+     *
+     * @param graph[in] The data structure loaded by the API class, shared by all the threads. It must outlive the
+     * managers.
+     * @param threads[in] The number of threads used to answer the batches, at least one thread is always used.
+     * @param simplification[in] The simplification table of the structure, or nullptr if the structure was
+     * preprocessed without the simplification. It must outlive the managers.
+     */
+    void initialize(const Graph& graph, unsigned int threads, const SimplificationTable* simplification = nullptr) {
+        clear();
+        this->simplification = simplification;
+        threads = std::max(threads, 1u);
+        for (unsigned int i = 0; i < threads; ++i) {
+            managers.push_back(std::make_unique<QueryManager>(graph));
+        }
+    }
+
+    /**
+     * Releases the query managers.
+     */
+    void clear() {
+        managers.clear();
+        simplification = nullptr;
+    }
+
+    /**
+     * Answers 'count' queries from 'starts[i]' to 'goals[i]' and stores the distances into 'distances[i]'. The node
+     * IDs are translated to the IDs used in the data structure (the IDs of the graph before the simplification, if
+     * it was simplified) using 'toInternalID'. If the translation throws
+     * (for example because of an unknown ID), the first exception is rethrown after all the threads finish.
+     *
+     * @param starts[in] The start nodes of the queries.
+     * @param goals[in] The goal nodes of the queries.
+     * @param distances[out] The array the distances are written to, 'UINT_MAX' is used for unreachable goals.
+     * @param count[in] The number of queries, all the arrays must have at least this many elements.
+     * @param toInternalID[in] Translates the IDs used in the queries to the IDs used in the data structure.
+     */
+    template <class IDMapping>
+    void run(
+            const long long* starts,
+            const long long* goals,
+            long long* distances,
+            int count,
+            const IDMapping& toInternalID) {
+        forEach(count, [&](QueryManager& queryManager, int i) {
+            const unsigned int start = toInternalID(starts[i]);
+            const unsigned int goal = toInternalID(goals[i]);
+            if (simplification) {
+                distances[i] = simplification->findDistance(start, goal, [&queryManager](unsigned int from, unsigned int to) {
+                    return queryManager.findDistance(from, to);
+                });
+            } else {
+                distances[i] = queryManager.findDistance(start, goal);
+            }
+        });
+    }
+
+    /**
+     * Calls 'query(queryManager, i)' for every 'i' from 0 to 'count' - 1, distributing the calls between the threads.
+     * Every thread passes its own query manager. If some of the calls throws, the first exception is rethrown after
+     * all the threads finish.
+     *
+     * @param count[in] The number of calls.
+     * @param query[in] The function answering the 'i'-th query using the given query manager.
+     * @param chunk[in] The number of consecutive calls assigned to a thread at once. Small chunks suit expensive
+     * queries (for example path queries), the default suits the distance queries.
+     */
+    template <class Query>
+    void forEach(int count, const Query& query, int chunk = 256) {
+        std::exception_ptr error = nullptr;
+
+        #pragma omp parallel for num_threads(static_cast<int>(managers.size())) schedule(dynamic, chunk)
+        for (int i = 0; i < count; ++i) {
+            try {
+                query(*managers[omp_get_thread_num()], i);
+            } catch (...) {
+                #pragma omp critical
+                if (!error) {
+                    error = std::current_exception();
+                }
+            }
+        }
+
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+
+private:
+    std::vector<std::unique_ptr<QueryManager>> managers;
+    const SimplificationTable* simplification = nullptr;
+};
+
+#endif //SHORTEST_PATHS_BATCHQUERYEXECUTOR_H
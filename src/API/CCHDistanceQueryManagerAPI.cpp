@@ -0,0 +1,172 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Czech Technical University in Prague
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. */
+
+/******************************************************************************
+* File:             CCHDistanceQueryManagerAPI.cpp
+*****************************************************************************/
+
+#include <exception>
+#include <fstream>
+#include <stdexcept>
+#include <omp.h>
+#include "CCHDistanceQueryManagerAPI.h"
+#include "../CCH/CCHCustomizer.h"
+#include "../GraphBuilding/Loaders/NodeMappingLoader.h"
+#include "../GraphBuilding/Loaders/XenGraphLoader.h"
+
+//______________________________________________________________________________________________________________________
+void CCHDistanceQueryManagerAPI::initializeCCH(std::string cchFile, std::string mappingFile) {
+    std::ifstream input(cchFile, std::ios::binary);
+    if (!input.is_open()) {
+        throw std::runtime_error("Couldn't open file '" + cchFile + "'!");
+    }
+
+    clearStructures();
+    std::vector<dist_t> weights;
+    topology = CCHTopology::read(input, weights);
+    metric.store(std::make_shared<const CCHMetric>(CCHCustomizer::customize(topology, weights)));
+    simplification = SimplificationTable::loadForStructure(cchFile, topology.nodes());
+
+    NodeMappingLoader mappingLoader(mappingFile);
+    mapping = mappingLoader.loadMapping(simplification ? simplification->nodes() : topology.nodes());
+
+    qm = new CCHDistanceQueryManager(topology, metric.load());
+    qm->setStatistics(statisticsEnabled ? &statistics : nullptr);
+    createBatchManagers();
+}
+
+//______________________________________________________________________________________________________________________
+unsigned int CCHDistanceQueryManagerAPI::distanceQuery(long long unsigned int start, long long unsigned int goal) {
+    statistics.reset();
+    qm->setMetric(metric.load());
+    return findDistance(*qm, mapping.internalID(start), mapping.internalID(goal));
+}
+
+//______________________________________________________________________________________________________________________
+void CCHDistanceQueryManagerAPI::distanceQueries(
+        const long long* starts,
+        const long long* goals,
+        long long* distances,
+        int count) {
+    // All the queries of the batch use the same weights, even if the metric is replaced in the meantime.
+    const std::shared_ptr<const CCHMetric> current = metric.load();
+    for (auto& manager : batchManagers) {
+        manager->setMetric(current);
+    }
+
+    std::exception_ptr error;
+    #pragma omp parallel for num_threads(static_cast<int>(batchManagers.size())) schedule(dynamic, 256)
+    for (int i = 0; i < count; i++) {
+        try {
+            distances[i] = findDistance(
+                *batchManagers[static_cast<size_t>(omp_get_thread_num())],
+                mapping.internalID(static_cast<long long unsigned int>(starts[i])),
+                mapping.internalID(static_cast<long long unsigned int>(goals[i])));
+        } catch (...) {
+            #pragma omp critical
+            if (!error) {
+                error = std::current_exception();
+            }
+        }
+    }
+
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+//______________________________________________________________________________________________________________________
+void CCHDistanceQueryManagerAPI::distanceQueriesDirect(
+        const long long* startsBuffer,
+        const long long* goalsBuffer,
+        long long* distancesBuffer,
+        int count) {
+    distanceQueries(startsBuffer, goalsBuffer, distancesBuffer, count);
+}
+
+//______________________________________________________________________________________________________________________
+void CCHDistanceQueryManagerAPI::customize(std::string graphFile) {
+    if (simplification) {
+        throw std::logic_error("The weights of a structure preprocessed with '--simplify' can not be changed.");
+    }
+    XenGraphLoader graphLoader(graphFile);
+    SimpleGraph graph(graphLoader.nodes());
+    graphLoader.loadGraph(graph, 1);
+
+    const std::vector<dist_t> weights = topology.edgeWeights(graph);
+    metric.store(std::make_shared<const CCHMetric>(CCHCustomizer::customize(topology, weights)));
+}
+
+//______________________________________________________________________________________________________________________
+unsigned int CCHDistanceQueryManagerAPI::findDistance(
+        CCHDistanceQueryManager& queryManager,
+        unsigned int start,
+        unsigned int goal) const {
+    if (simplification) {
+        return simplification->findDistance(start, goal, [&queryManager](unsigned int from, unsigned int to) {
+            return queryManager.findDistance(from, to);
+        });
+    }
+    return queryManager.findDistance(start, goal);
+}
+
+//______________________________________________________________________________________________________________________
+void CCHDistanceQueryManagerAPI::setThreads(unsigned int threads) {
+    this->threads = threads;
+    if (qm) {
+        createBatchManagers();
+    }
+}
+
+//______________________________________________________________________________________________________________________
+void CCHDistanceQueryManagerAPI::createBatchManagers() {
+    batchManagers.clear();
+    for (unsigned int i = 0; i < std::max(threads, 1u); i++) {
+        batchManagers.push_back(std::make_unique<CCHDistanceQueryManager>(topology, metric.load()));
+    }
+}
+
+//______________________________________________________________________________________________________________________
+void CCHDistanceQueryManagerAPI::clearStructures() {
+    batchManagers.clear();
+    delete qm;
+    qm = nullptr;
+    metric.store(nullptr);
+    topology = CCHTopology();
+    mapping.clear();
+    simplification.reset();
+}
+
+//______________________________________________________________________________________________________________________
+void CCHDistanceQueryManagerAPI::setStatisticsEnabled(bool enabled) {
+    statisticsEnabled = enabled;
+    statistics.reset();
+    if (qm) {
+        qm->setStatistics(enabled ? &statistics : nullptr);
+    }
+}
+
+//______________________________________________________________________________________________________________________
+QueryStatistics CCHDistanceQueryManagerAPI::getLastQueryStatistics() {
+    return statistics;
+}
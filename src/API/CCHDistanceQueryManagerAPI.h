@@ -0,0 +1,166 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Czech Technical University in Prague
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. */
+
+/******************************************************************************
+* File:             CCHDistanceQueryManagerAPI.h
+*
+* Description:      Java API for the Customizable Contraction Hierarchies
+*****************************************************************************/
+
+#ifndef SHORTEST_PATHS_CCHDISTANCEQUERYMANAGERAPI_H
+#define SHORTEST_PATHS_CCHDISTANCEQUERYMANAGERAPI_H
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+#include "../CCH/CCHDistanceQueryManager.h"
+#include "../GraphBuilding/Simplification/SimplificationTable.h"
+#include "../GraphBuilding/Structures/NodeMapping.h"
+
+/**
+ * This class serves as the API which will be used to call the Customizable Contraction Hierarchies functionality
+ * from Java. It is used the same way as the other APIs (load the structures, answer the queries, clear
+ * the structures), but additionally, the weights of the graph can be changed by 'customize' at any time, even
+ * while other threads are answering queries. The queries that already started finish with the previous weights,
+ * the following ones use the new weights.
+ *
+ * Unlike the other methods, the query managers do not modify the data structure, so the batches are answered
+ * by multiple threads without copying the data structure.
+ */
+class CCHDistanceQueryManagerAPI {
+public:
+    /**
+     * Initializes all the structures needed to then answer queries. Loads the Customizable Contraction Hierarchies
+     * data structure from a given file, customizes it for the weights stored in the file and also loads the mapping.
+     * If the structure was preprocessed with '--simplify', its simplification table (the '.simp' file next to the
+     * structure) is loaded as well, and the mapping then leads to the nodes of the graph before the simplification.
+     *
+     * @param cchFile[in] The path to the Customizable Contraction Hierarchies data structure file.
+     * @param mappingFile[in] The path to the mapping file.
+     */
+    void initializeCCH(std::string cchFile, std::string mappingFile);
+
+    /**
+     * This function will answer a query using the current weights.
+     *
+     * @param start[in] The start node of the query.
+     * @param goal[in] The goal node of the query.
+     * @return Returns the shortest distance from 'start' to 'goal' or 'UINT_MAX' if goal is not reachable from start.
+     */
+    unsigned int distanceQuery(long long unsigned int start, long long unsigned int goal);
+
+    /**
+     * Answers a whole batch of queries in a single call, see 'CHDistanceQueryManagerAPI::distanceQueries'.
+     *
+     * @param starts[in] The start nodes of the queries.
+     * @param goals[in] The goal nodes of the queries.
+     * @param distances[out] The array the distances are written to ('UINT_MAX' if the goal is not reachable).
+     * @param count[in] The number of queries, all the arrays must have at least this many elements.
+     */
+    void distanceQueries(const long long* starts, const long long* goals, long long* distances, int count);
+
+    /**
+     * Same as 'distanceQueries', but the node IDs and the distances are passed in direct 'java.nio.ByteBuffer's
+     * containing 64-bit integers in the native byte order, so the data are not copied at all.
+     *
+     * @param startsBuffer[in] The start nodes of the queries.
+     * @param goalsBuffer[in] The goal nodes of the queries.
+     * @param distancesBuffer[out] The buffer the distances are written to ('UINT_MAX' if the goal is not reachable).
+     * @param count[in] The number of queries, all the buffers must have room for at least this many values.
+     */
+    void distanceQueriesDirect(
+            const long long* startsBuffer,
+            const long long* goalsBuffer,
+            long long* distancesBuffer,
+            int count);
+
+    /**
+     * Replaces the weights of the graph. The graph file must contain the same nodes as the graph the structure was
+     * created from (using the internal IDs) and must not contain any new edges, the edges that are missing get
+     * infinite weights (they are closed). The customization uses all the available cores and the new weights are
+     * used by the queries started after it finishes. The weights of a structure preprocessed with '--simplify' can
+     * not be changed, the graph file describes the graph before the simplification.
+     *
+     * @param graphFile[in] The path to the graph with the new weights in the XenGraph format.
+     */
+    void customize(std::string graphFile);
+
+    /**
+     * Sets the number of threads used to answer the batches of queries ('distanceQueries' and
+     * 'distanceQueriesDirect'). One thread is used by default. The setting is kept when the structures are
+     * initialized again. The search statistics are not collected for the batches.
+     *
+     * @param threads[in] The number of threads used for the batches.
+     */
+    void setThreads(unsigned int threads);
+
+    /**
+     * Clears all the memory required by the structures. This needs to be called explicitly when using those managers,
+     * otherwise memory leaks will occur.
+     */
+    void clearStructures();
+
+    /**
+     * Enables or disables the collection of the search statistics. The collection is disabled by default. The setting
+     * is kept when the structures are initialized again.
+     *
+     * @param enabled[in] Whether the statistics should be collected for the following queries.
+     */
+    void setStatisticsEnabled(bool enabled);
+
+    /**
+     * Returns the search statistics of the last query. All the counters are zero if the collection is disabled.
+     *
+     * @return The statistics of the last query answered by 'distanceQuery'.
+     */
+    QueryStatistics getLastQueryStatistics();
+
+private:
+    /**
+     * Creates a query manager for each thread used for the batches.
+     */
+    void createBatchManagers();
+
+    /**
+     * Answers a query using the given query manager, through the simplification table if the structure has one.
+     *
+     * @param queryManager[in] The query manager with the current metric.
+     * @param start[in] The start node (the internal ID given by the mapping).
+     * @param goal[in] The goal node (the internal ID given by the mapping).
+     * @return The shortest distance from 'start' to 'goal' or 'UINT_MAX' if goal is not reachable from start.
+     */
+    unsigned int findDistance(CCHDistanceQueryManager& queryManager, unsigned int start, unsigned int goal) const;
+
+    CCHTopology topology;
+    NodeMapping mapping;
+    std::unique_ptr<SimplificationTable> simplification;
+    std::atomic<std::shared_ptr<const CCHMetric>> metric;
+    CCHDistanceQueryManager* qm = nullptr;
+    std::vector<std::unique_ptr<CCHDistanceQueryManager>> batchManagers;
+    unsigned int threads = 1;
+    QueryStatistics statistics;
+    bool statisticsEnabled = false;
+};
+
+#endif //SHORTEST_PATHS_CCHDISTANCEQUERYMANAGERAPI_H
@@ -0,0 +1,19 @@
+%module shortestPaths
+%include "std_string.i"
+%{
+/* Includes the header in the wrapper code */
+#include "CCHDistanceQueryManagerAPI.h"
+
+%}
+
+/* Invalid graph files are reported as exceptions, the previous weights are kept in that case. */
+%exception customize {
+    try {
+        $action
+    } catch (const std::exception & e) {
+        SWIG_JavaThrowException(jenv, SWIG_JavaIllegalArgumentException, e.what());
+    }
+}
+
+/* Parse the header file to generate wrappers */
+%include "CCHDistanceQueryManagerAPI.h"
@@ -28,21 +28,152 @@
 
 #include "CHDistanceQueryManagerAPI.h"
 #include "../GraphBuilding/Loaders/DDSGLoader.h"
+#include <climits>
+#include <stdexcept>
+#include <boost/numeric/conversion/cast.hpp>
 
 //______________________________________________________________________________________________________________________
 void CHDistanceQueryManagerAPI::initializeCH(std::string chFile, std::string mappingFile) {
     DDSGLoader chLoader = DDSGLoader(chFile);
     graph = chLoader.loadFlagsGraph();
-    qm = new CHDistanceQueryManagerWithMapping(*graph, mappingFile);
+    simplification = SimplificationTable::loadForStructure(chFile, graph->nodes()).release();
+    qm = new CHDistanceQueryManagerWithMapping(*graph, mappingFile, simplification);
+    qm->setStatistics(statisticsEnabled ? &statistics : nullptr);
+    batchExecutor.initialize(*graph, threads, simplification);
 }
 
 //______________________________________________________________________________________________________________________
 unsigned int CHDistanceQueryManagerAPI::distanceQuery(long long unsigned int start, long long unsigned int goal) {
+    statistics.reset();
     return qm -> findDistance(start, goal);
 }
 
+//______________________________________________________________________________________________________________________
+void CHDistanceQueryManagerAPI::distanceQueries(
+        const long long* starts,
+        const long long* goals,
+        long long* distances,
+        int count) {
+    batchExecutor.run(starts, goals, distances, count, [this](long long id) {
+        return qm->internalID(static_cast<long long unsigned int>(id));
+    });
+}
+
+//______________________________________________________________________________________________________________________
+void CHDistanceQueryManagerAPI::distanceQueriesDirect(
+        const long long* startsBuffer,
+        const long long* goalsBuffer,
+        long long* distancesBuffer,
+        int count) {
+    distanceQueries(startsBuffer, goalsBuffer, distancesBuffer, count);
+}
+
+//______________________________________________________________________________________________________________________
+RPHASTQueryManager & CHDistanceQueryManagerAPI::oneToManyManager() {
+    if (! graph) {
+        throw std::logic_error("The Contraction Hierarchy is not initialized.");
+    }
+    if (simplification) {
+        throw std::logic_error("The one-to-many queries are not supported for structures preprocessed with '--simplify'.");
+    }
+    if (! rphast) {
+        rphast = new RPHASTQueryManager(*graph);
+    }
+    return *rphast;
+}
+
+//______________________________________________________________________________________________________________________
+void CHDistanceQueryManagerAPI::selectTargets(const long long* targets, int count) {
+    std::vector<unsigned int> internalTargets(static_cast<size_t>(count));
+    for (int i = 0; i < count; i++) {
+        internalTargets[i] = qm->internalID(static_cast<long long unsigned int>(targets[i]));
+    }
+    oneToManyManager().selectTargets(internalTargets);
+    targetIDs.assign(targets, targets + count);
+}
+
+//______________________________________________________________________________________________________________________
+void CHDistanceQueryManagerAPI::selectAllNodes() {
+    oneToManyManager().selectAllNodes();
+    targetIDs.resize(graph->nodes());
+    for (unsigned int i = 0; i < graph->nodes(); i++) {
+        targetIDs[i] = static_cast<long long>(qm->originalID(i));
+    }
+}
+
+//______________________________________________________________________________________________________________________
+int CHDistanceQueryManagerAPI::getTargetCount() {
+    return boost::numeric_cast<int>(targetIDs.size());
+}
+
+//______________________________________________________________________________________________________________________
+void CHDistanceQueryManagerAPI::oneToManyQuery(long long source, long long* distances, int count) {
+    if (count < getTargetCount()) {
+        throw std::invalid_argument("The output array is smaller than the number of targets.");
+    }
+    std::vector<unsigned int> targetDistances;
+    oneToManyManager().findDistances(qm->internalID(static_cast<long long unsigned int>(source)), targetDistances);
+    for (size_t i = 0; i < targetDistances.size(); i++) {
+        distances[i] = targetDistances[i];
+    }
+}
+
+//______________________________________________________________________________________________________________________
+int CHDistanceQueryManagerAPI::rangeQuery(
+        long long source,
+        long long limit,
+        long long* nodes,
+        long long* distances,
+        int count) {
+    if (limit < 0) {
+        throw std::invalid_argument("The limit of the range query must not be negative.");
+    }
+    std::vector<unsigned int> targets;
+    std::vector<unsigned int> targetDistances;
+    oneToManyManager().findTargetsInRange(
+            qm->internalID(static_cast<long long unsigned int>(source)),
+            limit < UINT_MAX ? static_cast<unsigned int>(limit) : UINT_MAX - 1,
+            targets,
+            targetDistances);
+    for (size_t i = 0; i < targets.size() && i < static_cast<size_t>(count); i++) {
+        nodes[i] = targetIDs[targets[i]];
+        distances[i] = targetDistances[i];
+    }
+    return boost::numeric_cast<int>(targets.size());
+}
+
+//______________________________________________________________________________________________________________________
+void CHDistanceQueryManagerAPI::setThreads(unsigned int threads) {
+    this->threads = threads;
+    if (graph) {
+        batchExecutor.initialize(*graph, threads, simplification);
+    }
+}
+
 //______________________________________________________________________________________________________________________
 void CHDistanceQueryManagerAPI::clearStructures() {
+    batchExecutor.clear();
+    delete rphast;
     delete qm;
     delete graph;
+    delete simplification;
+    rphast = nullptr;
+    qm = nullptr;
+    graph = nullptr;
+    simplification = nullptr;
+    targetIDs.clear();
+}
+
+//______________________________________________________________________________________________________________________
+void CHDistanceQueryManagerAPI::setStatisticsEnabled(bool enabled) {
+    statisticsEnabled = enabled;
+    statistics.reset();
+    if (qm) {
+        qm->setStatistics(enabled ? &statistics : nullptr);
+    }
+}
+
+//______________________________________________________________________________________________________________________
+QueryStatistics CHDistanceQueryManagerAPI::getLastQueryStatistics() {
+    return statistics;
 }
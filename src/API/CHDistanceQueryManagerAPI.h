@@ -31,7 +31,11 @@
 
 
 #include "../CH/CHDistanceQueryManagerWithMapping.h"
+#include "../CH/CHDistanceQueryManager.h"
+#include "../CH/RPHASTQueryManager.h"
+#include "BatchQueryExecutor.h"
 #include <string>
+#include <vector>
 
 
 
@@ -46,7 +50,8 @@ class CHDistanceQueryManagerAPI {
 public:
     /**
      * Initializes all the structures needed to then answer queries. Loads the Contraction Hierarchies data structure
-     * from a given file and also loads the mapping.
+     * from a given file and also loads the mapping. If the structure was preprocessed with '--simplify', its simplification table (the '.simp' file next to
+     * the structure) is loaded as well, and the mapping then leads to the nodes of the graph before the simplification.
      *
      * @param chFile[in] The path to the Contraction Hierarchies data structure file.
      * @param mappingFile[in] The path to the mapping file.
@@ -62,15 +67,124 @@ public:
      */
     unsigned int distanceQuery(long long unsigned int start, long long unsigned int goal);
 
+    /**
+     * Answers a whole batch of queries using the Contraction Hierarchies query algorithm in a single call. This is
+     * considerably faster than calling 'distanceQuery' repeatedly from Java, as the language boundary is only crossed
+     * once per batch. In Java, the arguments are 'long[]' arrays.
+     *
+     * @param starts[in] The start nodes of the queries.
+     * @param goals[in] The goal nodes of the queries.
+     * @param distances[out] The array the distances are written to ('UINT_MAX' if the goal is not reachable).
+     * @param count[in] The number of queries, all the arrays must have at least this many elements.
+     */
+    void distanceQueries(const long long* starts, const long long* goals, long long* distances, int count);
+
+    /**
+     * Same as 'distanceQueries', but the node IDs and the distances are passed in direct 'java.nio.ByteBuffer's
+     * containing 64-bit integers in the native byte order, so the data are not copied at all.
+     *
+     * @param startsBuffer[in] The start nodes of the queries.
+     * @param goalsBuffer[in] The goal nodes of the queries.
+     * @param distancesBuffer[out] The buffer the distances are written to ('UINT_MAX' if the goal is not reachable).
+     * @param count[in] The number of queries, all the buffers must have room for at least this many values.
+     */
+    void distanceQueriesDirect(
+            const long long* startsBuffer,
+            const long long* goalsBuffer,
+            long long* distancesBuffer,
+            int count);
+
+    /**
+     * Selects the targets of the following 'oneToManyQuery' and 'rangeQuery' calls. The part of the Contraction
+     * Hierarchy needed for the targets is extracted once (restricted PHAST), every query from a source is then answered
+     * by one upward search and a linear sweep over this part, which is much faster than answering the queries to the
+     * individual targets. In Java, the argument is a 'long[]' array. The one-to-many and range queries are not
+     * supported for structures preprocessed with '--simplify'.
+     *
+     * @param targets[in] The original IDs of the targets.
+     * @param count[in] The number of targets.
+     */
+    void selectTargets(const long long* targets, int count);
+
+    /**
+     * Selects all the nodes of the graph as the targets, in the order of the internal IDs. The range queries then
+     * return the isochrones, that is all the nodes reachable within the limit.
+     */
+    void selectAllNodes();
+
+    /**
+     * @return The number of the targets selected by the last 'selectTargets' or 'selectAllNodes' call.
+     */
+    int getTargetCount();
+
+    /**
+     * Finds the distances from the source to all the selected targets. In Java, the output is a 'long[]' array.
+     *
+     * @param source[in] The original ID of the source.
+     * @param distances[out] The distances to the targets in the order in which they were selected ('UINT_MAX' if the
+     * target is not reachable).
+     * @param count[in] The size of the output array, at least the number of targets.
+     */
+    void oneToManyQuery(long long source, long long* distances, int count);
+
+    /**
+     * Finds the selected targets within the limit from the source. In Java, the outputs are 'long[]' arrays.
+     *
+     * @param source[in] The original ID of the source.
+     * @param limit[in] The maximal distance of the reported targets (inclusive).
+     * @param nodes[out] The original IDs of the targets within the limit, in the order in which they were selected.
+     * @param distances[out] The distances to those targets.
+     * @param count[in] The size of the output arrays, at most this many targets are written.
+     * @return The number of targets within the limit, if it is larger than 'count', the output was truncated.
+     */
+    int rangeQuery(long long source, long long limit, long long* nodes, long long* distances, int count);
+
+    /**
+     * Sets the number of threads used to answer the batches of queries ('distanceQueries' and
+     * 'distanceQueriesDirect'). One thread is used by default. All the threads share the loaded data structure, every
+     * additional thread only needs its own query manager (a few bytes per node). The setting is kept when the
+     * structures are initialized again. The search statistics are not collected for the batches.
+     *
+     * @param threads[in] The number of threads used for the batches.
+     */
+    void setThreads(unsigned int threads);
+
     /**
      * Clears all the memory required by the structures. This needs to be called explicitly when using those managers,
      * otherwise memory leaks will occur.
      */
     void clearStructures();
 
+    /**
+     * Enables or disables the collection of the search statistics (settled nodes, relaxed edges and so on).
+     * The collection is disabled by default. The setting is kept when the structures are initialized again.
+     *
+     * @param enabled[in] Whether the statistics should be collected for the following queries.
+     */
+    void setStatisticsEnabled(bool enabled);
+
+    /**
+     * Returns the search statistics of the last query. All the counters are zero if the collection is disabled.
+     *
+     * @return The statistics of the last query answered by 'distanceQuery'.
+     */
+    QueryStatistics getLastQueryStatistics();
+
 private:
-    CHDistanceQueryManagerWithMapping * qm;
-    FlagsGraph<NodeData>* graph;
+    /**
+     * @return The manager for the one-to-many and range queries, created when the targets are selected first.
+     */
+    RPHASTQueryManager & oneToManyManager();
+
+    CHDistanceQueryManagerWithMapping * qm = nullptr;
+    FlagsGraph<NodeData>* graph = nullptr;
+    SimplificationTable* simplification = nullptr;
+    RPHASTQueryManager * rphast = nullptr;
+    std::vector<long long> targetIDs;
+    BatchQueryExecutor<FlagsGraph<NodeData>, CHDistanceQueryManager<NodeData>> batchExecutor;
+    unsigned int threads = 1;
+    QueryStatistics statistics;
+    bool statisticsEnabled = false;
 };
 
 
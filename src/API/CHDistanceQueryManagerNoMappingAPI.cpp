@@ -33,11 +33,17 @@
 void CHDistanceQueryManagerNoMappingAPI::initializeCH(std::string chFile) {
     DDSGLoader chLoader = DDSGLoader(chFile);
     graph = chLoader.loadFlagsGraph();
+    simplification = SimplificationTable::loadForStructure(chFile, graph->nodes()).release();
     qm = new CHDistanceQueryManager(*graph);
 }
 
 //______________________________________________________________________________________________________________________
 unsigned int CHDistanceQueryManagerNoMappingAPI::distanceQuery(unsigned int start, unsigned int goal) {
+    if (simplification) {
+        return simplification->findDistance(start, goal, [this](unsigned int from, unsigned int to) {
+            return qm -> findDistance(from, to);
+        });
+    }
     return qm -> findDistance(start, goal);
 }
 
@@ -45,4 +51,6 @@ unsigned int CHDistanceQueryManagerNoMappingAPI::distanceQuery(unsigned int star
 void CHDistanceQueryManagerNoMappingAPI::clearStructures() {
     delete qm;
     delete graph;
+    delete simplification;
+    simplification = nullptr;
 }
@@ -31,6 +31,7 @@
 
 
 #include "../CH/CHDistanceQueryManager.h"
+#include "../GraphBuilding/Simplification/SimplificationTable.h"
 #include <string>
 
 
@@ -50,7 +51,9 @@ public:
     /**
      * Initializes the Contraction Hierarchy for queries. This means loading the graph from the given input file,
      * creating an instance of a 'FlagsGraph', and then also creating an instance of the 'CHDistanceQueryManager',
-     * which can then be used to answer queries.
+     * which can then be used to answer queries. If the structure was preprocessed with '--simplify', its
+     * simplification table (the '.simp' file next to the structure) is loaded as well and the queries use the IDs of
+     * the graph before the simplification.
      *
      * @param chFile[in] The path to the Contraction Hierarchy data structure that will be used to answer queries.
      */
@@ -78,6 +81,7 @@ public:
 private:
     CHDistanceQueryManager<NodeData>* qm;
     FlagsGraph<NodeData>* graph;
+    SimplificationTable* simplification = nullptr;
 };
 
 
@@ -0,0 +1,58 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Czech Technical University in Prague
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. */
+
+/******************************************************************************
+* File:             DMDistanceQueryManagerAPI.cpp
+*****************************************************************************/
+
+#include <filesystem>
+#include "DMDistanceQueryManagerAPI.h"
+#include "../GraphBuilding/Loaders/DistanceMatrixLoader.h"
+#include "../GraphBuilding/Loaders/NodeMappingLoader.h"
+
+//______________________________________________________________________________________________________________________
+void DMDistanceQueryManagerAPI::initializeDM(std::string dmFile, std::string mappingFile) {
+    DistanceMatrixLoader dmLoader = DistanceMatrixLoader(dmFile);
+    const auto extension = std::filesystem::path(dmFile).extension();
+    if (extension == ".cdm") {
+        dm = dmLoader.loadCDM();
+    } else if (extension == ".hdf5") {
+        dm = dmLoader.loadHDF();
+    } else {
+        dm = dmLoader.loadXDM();
+    }
+
+    NodeMappingLoader mappingLoader(mappingFile);
+    mapping = mappingLoader.loadMapping();
+}
+
+//______________________________________________________________________________________________________________________
+unsigned int DMDistanceQueryManagerAPI::distanceQuery(long long unsigned int start, long long unsigned int goal) {
+    return dm -> findDistance(mapping.internalID(start), mapping.internalID(goal));
+}
+
+//______________________________________________________________________________________________________________________
+void DMDistanceQueryManagerAPI::clearStructures() {
+    delete dm;
+    mapping.clear();
+}
@@ -0,0 +1,10 @@
+%module shortestPaths
+%include "std_string.i"
+%{
+/* Includes the header in the wrapper code */
+#include "DMDistanceQueryManagerAPI.h"
+
+%}
+
+/* Parse the header file to generate wrappers */
+%include "DMDistanceQueryManagerAPI.h"
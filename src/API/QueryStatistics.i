@@ -0,0 +1,12 @@
+%module shortestPaths
+%{
+/* Includes the header in the wrapper code */
+#include "../CH/Structures/QueryStatistics.h"
+
+%}
+
+/* The counters are read-only from the other languages, the aggregation operator is not needed there. */
+%ignore QueryStatistics::operator+=;
+%immutable;
+%include "../CH/Structures/QueryStatistics.h"
+%mutable;
@@ -33,16 +33,67 @@
 void TNRAFDistanceQueryManagerAPI::initializeTNRAF(std::string tnrafFile, std::string mappingFile) {
     TGAFLoader tnrafLoader = TGAFLoader(tnrafFile);
     graph = tnrafLoader.loadTNRAFforDistanceQueries();
-    qm = new TNRAFDistanceQueryManagerWithMapping(*graph, mappingFile);
+    simplification = SimplificationTable::loadForStructure(tnrafFile, graph->nodes()).release();
+    qm = new TNRAFDistanceQueryManagerWithMapping(*graph, mappingFile, simplification);
+    qm->setStatistics(statisticsEnabled ? &statistics : nullptr);
+    batchExecutor.initialize(*graph, threads, simplification);
 }
 
 //______________________________________________________________________________________________________________________
 unsigned int TNRAFDistanceQueryManagerAPI::distanceQuery(long long unsigned int start, long long unsigned int goal) {
+    statistics.reset();
     return qm -> findDistance(start, goal);
 }
 
+//______________________________________________________________________________________________________________________
+void TNRAFDistanceQueryManagerAPI::distanceQueries(
+        const long long* starts,
+        const long long* goals,
+        long long* distances,
+        int count) {
+    batchExecutor.run(starts, goals, distances, count, [this](long long id) {
+        return qm->internalID(static_cast<long long unsigned int>(id));
+    });
+}
+
+//______________________________________________________________________________________________________________________
+void TNRAFDistanceQueryManagerAPI::distanceQueriesDirect(
+        const long long* startsBuffer,
+        const long long* goalsBuffer,
+        long long* distancesBuffer,
+        int count) {
+    distanceQueries(startsBuffer, goalsBuffer, distancesBuffer, count);
+}
+
+//______________________________________________________________________________________________________________________
+void TNRAFDistanceQueryManagerAPI::setThreads(unsigned int threads) {
+    this->threads = threads;
+    if (graph) {
+        batchExecutor.initialize(*graph, threads, simplification);
+    }
+}
+
 //______________________________________________________________________________________________________________________
 void TNRAFDistanceQueryManagerAPI::clearStructures() {
+    batchExecutor.clear();
     delete qm;
     delete graph;
-}
\ No newline at end of file
+    delete simplification;
+    qm = nullptr;
+    graph = nullptr;
+    simplification = nullptr;
+}
+
+//______________________________________________________________________________________________________________________
+void TNRAFDistanceQueryManagerAPI::setStatisticsEnabled(bool enabled) {
+    statisticsEnabled = enabled;
+    statistics.reset();
+    if (qm) {
+        qm->setStatistics(enabled ? &statistics : nullptr);
+    }
+}
+
+//______________________________________________________________________________________________________________________
+QueryStatistics TNRAFDistanceQueryManagerAPI::getLastQueryStatistics() {
+    return statistics;
+}
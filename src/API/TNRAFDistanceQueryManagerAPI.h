@@ -31,6 +31,8 @@
 
 
 #include "../TNRAF/TNRAFDistanceQueryManagerWithMapping.h"
+#include "../TNRAF/TNRAFDistanceQueryManager.h"
+#include "BatchQueryExecutor.h"
 
 
 
@@ -47,6 +49,8 @@ public:
     /**
      * Initializes all the structures needed to then answer queries. Loads the Transit Node Routing with Arc Flags
      * data structure from a given file and also loads the mapping.
+     * If the structure was preprocessed with '--simplify', its simplification table (the '.simp' file next to the
+     * structure) is loaded as well, and the mapping then leads to the nodes of the graph before the simplification.
      *
      * @param tnrafFile[in] The path to the Transit Node Routing with Arc Flags data structure file.
      * @param mappingFile[in] The path to the mapping file.
@@ -62,15 +66,72 @@ public:
      */
     unsigned int distanceQuery(long long unsigned int start, long long unsigned int goal);
 
+    /**
+     * Answers a whole batch of queries using the Transit Node Routing with Arc Flags query algorithm in a single
+     * call. This is considerably faster than calling 'distanceQuery' repeatedly from Java, as the language boundary is
+     * only crossed once per batch. In Java, the arguments are 'long[]' arrays.
+     *
+     * @param starts[in] The start nodes of the queries.
+     * @param goals[in] The goal nodes of the queries.
+     * @param distances[out] The array the distances are written to ('UINT_MAX' if the goal is not reachable).
+     * @param count[in] The number of queries, all the arrays must have at least this many elements.
+     */
+    void distanceQueries(const long long* starts, const long long* goals, long long* distances, int count);
+
+    /**
+     * Same as 'distanceQueries', but the node IDs and the distances are passed in direct 'java.nio.ByteBuffer's
+     * containing 64-bit integers in the native byte order, so the data are not copied at all.
+     *
+     * @param startsBuffer[in] The start nodes of the queries.
+     * @param goalsBuffer[in] The goal nodes of the queries.
+     * @param distancesBuffer[out] The buffer the distances are written to ('UINT_MAX' if the goal is not reachable).
+     * @param count[in] The number of queries, all the buffers must have room for at least this many values.
+     */
+    void distanceQueriesDirect(
+            const long long* startsBuffer,
+            const long long* goalsBuffer,
+            long long* distancesBuffer,
+            int count);
+
+    /**
+     * Sets the number of threads used to answer the batches of queries ('distanceQueries' and
+     * 'distanceQueriesDirect'). One thread is used by default. All the threads share the loaded data structure, every
+     * additional thread only needs its own query manager (a few bytes per node). The setting is kept when the
+     * structures are initialized again. The search statistics are not collected for the batches.
+     *
+     * @param threads[in] The number of threads used for the batches.
+     */
+    void setThreads(unsigned int threads);
+
     /**
      * Clears all the memory required by the structures. This needs to be called explicitly when using those managers,
      * otherwise memory leaks will occur.
      */
     void clearStructures();
 
+    /**
+     * Enables or disables the collection of the search statistics (settled nodes, relaxed edges and so on).
+     * The collection is disabled by default. The setting is kept when the structures are initialized again.
+     *
+     * @param enabled[in] Whether the statistics should be collected for the following queries.
+     */
+    void setStatisticsEnabled(bool enabled);
+
+    /**
+     * Returns the search statistics of the last query. All the counters are zero if the collection is disabled.
+     *
+     * @return The statistics of the last query answered by 'distanceQuery'.
+     */
+    QueryStatistics getLastQueryStatistics();
+
 private:
-    TNRAFDistanceQueryManagerWithMapping * qm;
-    TransitNodeRoutingArcFlagsGraph * graph;
+    TNRAFDistanceQueryManagerWithMapping * qm = nullptr;
+    TransitNodeRoutingArcFlagsGraph * graph = nullptr;
+    SimplificationTable* simplification = nullptr;
+    BatchQueryExecutor<TransitNodeRoutingArcFlagsGraph, TNRAFDistanceQueryManager> batchExecutor;
+    unsigned int threads = 1;
+    QueryStatistics statistics;
+    bool statisticsEnabled = false;
 };
 
 
@@ -33,16 +33,67 @@
 void TNRDistanceQueryManagerAPI::initializeTNR(std::string tnrFile, std::string mappingFile) {
     TNRGLoader tnrloader = TNRGLoader(tnrFile);
     graph = tnrloader.loadTNRforDistanceQueries();
-    qm = new TNRDistanceQueryManagerWithMapping(*graph, mappingFile);
+    simplification = SimplificationTable::loadForStructure(tnrFile, graph->nodes()).release();
+    qm = new TNRDistanceQueryManagerWithMapping(*graph, mappingFile, simplification);
+    qm->setStatistics(statisticsEnabled ? &statistics : nullptr);
+    batchExecutor.initialize(*graph, threads, simplification);
 }
 
 //______________________________________________________________________________________________________________________
 unsigned int TNRDistanceQueryManagerAPI::distanceQuery(long long unsigned int start, long long unsigned int goal) {
+    statistics.reset();
     return qm -> findDistance(start, goal);
 }
 
+//______________________________________________________________________________________________________________________
+void TNRDistanceQueryManagerAPI::distanceQueries(
+        const long long* starts,
+        const long long* goals,
+        long long* distances,
+        int count) {
+    batchExecutor.run(starts, goals, distances, count, [this](long long id) {
+        return qm->internalID(static_cast<long long unsigned int>(id));
+    });
+}
+
+//______________________________________________________________________________________________________________________
+void TNRDistanceQueryManagerAPI::distanceQueriesDirect(
+        const long long* startsBuffer,
+        const long long* goalsBuffer,
+        long long* distancesBuffer,
+        int count) {
+    distanceQueries(startsBuffer, goalsBuffer, distancesBuffer, count);
+}
+
+//______________________________________________________________________________________________________________________
+void TNRDistanceQueryManagerAPI::setThreads(unsigned int threads) {
+    this->threads = threads;
+    if (graph) {
+        batchExecutor.initialize(*graph, threads, simplification);
+    }
+}
+
 //______________________________________________________________________________________________________________________
 void TNRDistanceQueryManagerAPI::clearStructures() {
+    batchExecutor.clear();
     delete qm;
     delete graph;
-}
\ No newline at end of file
+    delete simplification;
+    qm = nullptr;
+    graph = nullptr;
+    simplification = nullptr;
+}
+
+//______________________________________________________________________________________________________________________
+void TNRDistanceQueryManagerAPI::setStatisticsEnabled(bool enabled) {
+    statisticsEnabled = enabled;
+    statistics.reset();
+    if (qm) {
+        qm->setStatistics(enabled ? &statistics : nullptr);
+    }
+}
+
+//______________________________________________________________________________________________________________________
+QueryStatistics TNRDistanceQueryManagerAPI::getLastQueryStatistics() {
+    return statistics;
+}
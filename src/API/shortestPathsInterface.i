@@ -1,4 +1,8 @@
 %module shortestPaths
+%include QueryStatistics.i
+%include BatchQueries.i
 %include CHDistanceQueryManagerAPI.i
+%include CCHDistanceQueryManagerAPI.i
 %include TNRDistanceQueryManagerAPI.i
-%include TNRAFDistanceQueryManagerAPI.i
\ No newline at end of file
+%include TNRAFDistanceQueryManagerAPI.i
+%include DMDistanceQueryManagerAPI.i
\ No newline at end of file
@@ -259,29 +259,874 @@ static void SWIGUNUSED SWIG_JavaThrowException(JNIEnv *jenv, SWIG_JavaExceptionC
 
 
 
+/* Includes the header in the wrapper code */
+#include "CCHDistanceQueryManagerAPI.h"
+
+
+
 /* Includes the header in the wrapper code */
 #include "TNRDistanceQueryManagerAPI.h"
 
 
 
-/* Includes the header in the wrapper code */
-#include "TNRAFDistanceQueryManagerAPI.h"
+/* Includes the header in the wrapper code */
+#include "TNRAFDistanceQueryManagerAPI.h"
+
+
+
+/* Includes the header in the wrapper code */
+#include "DMDistanceQueryManagerAPI.h"
+
+
+
+/* Includes the header in the wrapper code */
+#include "../CH/Structures/QueryStatistics.h"
+
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+SWIGEXPORT void JNICALL Java_cz_cvut_fel_aic_shortestpaths_shortestPathsJNI_QueryStatistics_1reset(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+    QueryStatistics *arg1 = (QueryStatistics *) 0 ;
+
+    (void)jenv;
+    (void)jcls;
+    (void)jarg1_;
+    arg1 = *(QueryStatistics **)&jarg1;
+    (arg1)->reset();
+}
+
+
+SWIGEXPORT jlong JNICALL Java_cz_cvut_fel_aic_shortestpaths_shortestPathsJNI_QueryStatistics_1settledNodes_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+    jlong jresult = 0 ;
+    QueryStatistics *arg1 = (QueryStatistics *) 0 ;
+    size_t result;
+
+    (void)jenv;
+    (void)jcls;
+    (void)jarg1_;
+    arg1 = *(QueryStatistics **)&jarg1;
+    result =  ((arg1)->settledNodes);
+    jresult = (jlong)result;
+    return jresult;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_cz_cvut_fel_aic_shortestpaths_shortestPathsJNI_QueryStatistics_1relaxedEdges_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+    jlong jresult = 0 ;
+    QueryStatistics *arg1 = (QueryStatistics *) 0 ;
+    size_t result;
+
+    (void)jenv;
+    (void)jcls;
+    (void)jarg1_;
+    arg1 = *(QueryStatistics **)&jarg1;
+    result =  ((arg1)->relaxedEdges);
+    jresult = (jlong)result;
+    return jresult;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_cz_cvut_fel_aic_shortestpaths_shortestPathsJNI_QueryStatistics_1stalledNodes_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+    jlong jresult = 0 ;
+    QueryStatistics *arg1 = (QueryStatistics *) 0 ;
+    size_t result;
+
+    (void)jenv;
+    (void)jcls;
+    (void)jarg1_;
+    arg1 = *(QueryStatistics **)&jarg1;
+    result =  ((arg1)->stalledNodes);
+    jresult = (jlong)result;
+    return jresult;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_cz_cvut_fel_aic_shortestpaths_shortestPathsJNI_QueryStatistics_1heapPushes_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+    jlong jresult = 0 ;
+    QueryStatistics *arg1 = (QueryStatistics *) 0 ;
+    size_t result;
+
+    (void)jenv;
+    (void)jcls;
+    (void)jarg1_;
+    arg1 = *(QueryStatistics **)&jarg1;
+    result =  ((arg1)->heapPushes);
+    jresult = (jlong)result;
+    return jresult;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_cz_cvut_fel_aic_shortestpaths_shortestPathsJNI_QueryStatistics_1localQueryFallbacks_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+    jlong jresult = 0 ;
+    QueryStatistics *arg1 = (QueryStatistics *) 0 ;
+    size_t result;
+
+    (void)jenv;
+    (void)jcls;
+    (void)jarg1_;
+    arg1 = *(QueryStatistics **)&jarg1;
+    result =  ((arg1)->localQueryFallbacks);
+    jresult = (jlong)result;
+    return jresult;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_cz_cvut_fel_aic_shortestpaths_shortestPathsJNI_QueryStatistics_1accessNodePairs_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+    jlong jresult = 0 ;
+    QueryStatistics *arg1 = (QueryStatistics *) 0 ;
+    size_t result;
+
+    (void)jenv;
+    (void)jcls;
+    (void)jarg1_;
+    arg1 = *(QueryStatistics **)&jarg1;
+    result =  ((arg1)->accessNodePairs);
+    jresult = (jlong)result;
+    return jresult;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_cz_cvut_fel_aic_shortestpaths_shortestPathsJNI_QueryStatistics_1arcFlagPrunes_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+    jlong jresult = 0 ;
+    QueryStatistics *arg1 = (QueryStatistics *) 0 ;
+    size_t result;
+
+    (void)jenv;
+    (void)jcls;
+    (void)jarg1_;
+    arg1 = *(QueryStatistics **)&jarg1;
+    result =  ((arg1)->arcFlagPrunes);
+    jresult = (jlong)result;
+    return jresult;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_cz_cvut_fel_aic_shortestpaths_shortestPathsJNI_new_1QueryStatistics(JNIEnv *jenv, jclass jcls) {
+    jlong jresult = 0 ;
+    QueryStatistics *result = 0 ;
+
+    (void)jenv;
+    (void)jcls;
+    result = (QueryStatistics *)new QueryStatistics();
+    *(QueryStatistics **)&jresult = result;
+    return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_cz_cvut_fel_aic_shortestpaths_shortestPathsJNI_delete_1QueryStatistics(JNIEnv *jenv, jclass jcls, jlong jarg1) {
+    QueryStatistics *arg1 = (QueryStatistics *) 0 ;
+
+    (void)jenv;
+    (void)jcls;
+    arg1 = *(QueryStatistics **)&jarg1;
+    delete arg1;
+}
+
+
+SWIGEXPORT void JNICALL Java_cz_cvut_fel_aic_shortestpaths_shortestPathsJNI_CHDistanceQueryManagerAPI_1initializeCH(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2, jstring jarg3) {
+    CHDistanceQueryManagerAPI *arg1 = (CHDistanceQueryManagerAPI *) 0 ;
+    std::string arg2 ;
+    std::string arg3 ;
+
+    (void)jenv;
+    (void)jcls;
+    (void)jarg1_;
+    arg1 = *(CHDistanceQueryManagerAPI **)&jarg1;
+    if(!jarg2) {
+        SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
+        return ;
+    }
+    const char *arg2_pstr = (const char *)jenv->GetStringUTFChars(jarg2, 0);
+    if (!arg2_pstr) return ;
+    (&arg2)->assign(arg2_pstr);
+    jenv->ReleaseStringUTFChars(jarg2, arg2_pstr);
+    if(!jarg3) {
+        SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
+        return ;
+    }
+    const char *arg3_pstr = (const char *)jenv->GetStringUTFChars(jarg3, 0);
+    if (!arg3_pstr) return ;
+    (&arg3)->assign(arg3_pstr);
+    jenv->ReleaseStringUTFChars(jarg3, arg3_pstr);
+    (arg1)->initializeCH(arg2,arg3);
+}
+
+
+SWIGEXPORT jlong JNICALL Java_cz_cvut_fel_aic_shortestpaths_shortestPathsJNI_CHDistanceQueryManagerAPI_1distanceQuery(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jobject jarg2, jobject jarg3) {
+    jlong jresult = 0 ;
+    CHDistanceQueryManagerAPI *arg1 = (CHDistanceQueryManagerAPI *) 0 ;
+    unsigned long long arg2 ;
+    unsigned long long arg3 ;
+    unsigned int result;
+
+    (void)jenv;
+    (void)jcls;
+    (void)jarg1_;
+    arg1 = *(CHDistanceQueryManagerAPI **)&jarg1;
+    {
+        jclass clazz;
+        jmethodID mid;
+        jbyteArray ba;
+        jbyte* bae;
+        jsize sz;
+        int i;
+
+        if (!jarg2) {
+            SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "BigInteger null");
+            return 0;
+        }
+        clazz = jenv->GetObjectClass(jarg2);
+        mid = jenv->GetMethodID(clazz, "toByteArray", "()[B");
+        ba = (jbyteArray)jenv->CallObjectMethod(jarg2, mid);
+        bae = jenv->GetByteArrayElements(ba, 0);
+        sz = jenv->GetArrayLength(ba);
+        arg2 = 0;
+        for(i=0; i<sz; i++) {
+            arg2 = (arg2 << 8) | (unsigned long long)(unsigned char)bae[i];
+        }
+        jenv->ReleaseByteArrayElements(ba, bae, 0);
+    }
+    {
+        jclass clazz;
+        jmethodID mid;
+        jbyteArray ba;
+        jbyte* bae;
+        jsize sz;
+        int i;
+
+        if (!jarg3) {
+            SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "BigInteger null");
+            return 0;
+        }
+        clazz = jenv->GetObjectClass(jarg3);
+        mid = jenv->GetMethodID(clazz, "toByteArray", "()[B");
+        ba = (jbyteArray)jenv->CallObjectMethod(jarg3, mid);
+        bae = jenv->GetByteArrayElements(ba, 0);
+        sz = jenv->GetArrayLength(ba);
+        arg3 = 0;
+        for(i=0; i<sz; i++) {
+            arg3 = (arg3 << 8) | (unsigned long long)(unsigned char)bae[i];
+        }
+        jenv->ReleaseByteArrayElements(ba, bae, 0);
+    }
+    result = (arg1)->distanceQuery(arg2,arg3);
+    jresult = (jlong)result;
+    return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_cz_cvut_fel_aic_shortestpaths_shortestPathsJNI_CHDistanceQueryManagerAPI_1distanceQueries(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlongArray jarg2, jlongArray jarg3, jlongArray jarg4, jint jarg5) {
+    CHDistanceQueryManagerAPI *arg1 = (CHDistanceQueryManagerAPI *) 0 ;
+    long long *arg2 = (long long *) 0 ;
+    long long *arg3 = (long long *) 0 ;
+    long long *arg4 = (long long *) 0 ;
+    int arg5 ;
+
+    (void)jenv;
+    (void)jcls;
+    (void)jarg1_;
+    arg1 = *(CHDistanceQueryManagerAPI **)&jarg1;
+    {
+        if (!jarg2) {
+            SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null array");
+            return ;
+        }
+        arg2 = (long long *) jenv->GetLongArrayElements(jarg2, 0);
+    }
+    {
+        if (!jarg3) {
+            SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null array");
+            return ;
+        }
+        arg3 = (long long *) jenv->GetLongArrayElements(jarg3, 0);
+    }
+    {
+        if (!jarg4) {
+            SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null array");
+            return ;
+        }
+        arg4 = (long long *) jenv->GetLongArrayElements(jarg4, 0);
+    }
+    arg5 = (int)jarg5;
+    {
+        try {
+            (arg1)->distanceQueries((long long const *)arg2,(long long const *)arg3,arg4,arg5);
+        } catch (const std::exception & e) {
+            SWIG_JavaThrowException(jenv, SWIG_JavaIllegalArgumentException, e.what());
+        }
+    }
+    {
+        jenv->ReleaseLongArrayElements(jarg2, (jlong *) arg2, JNI_ABORT);
+    }
+    {
+        jenv->ReleaseLongArrayElements(jarg3, (jlong *) arg3, JNI_ABORT);
+    }
+    {
+        jenv->ReleaseLongArrayElements(jarg4, (jlong *) arg4, 0);
+    }
+}
+
+
+SWIGEXPORT void JNICALL Java_cz_cvut_fel_aic_shortestpaths_shortestPathsJNI_CHDistanceQueryManagerAPI_1distanceQueriesDirect(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jobject jarg2, jobject jarg3, jobject jarg4, jint jarg5) {
+    CHDistanceQueryManagerAPI *arg1 = (CHDistanceQueryManagerAPI *) 0 ;
+    long long *arg2 = (long long *) 0 ;
+    long long *arg3 = (long long *) 0 ;
+    long long *arg4 = (long long *) 0 ;
+    int arg5 ;
+
+    (void)jenv;
+    (void)jcls;
+    (void)jarg1_;
+    arg1 = *(CHDistanceQueryManagerAPI **)&jarg1;
+    {
+        arg2 = jarg2 ? (long long *) jenv->GetDirectBufferAddress(jarg2) : 0;
+        if (!arg2) {
+            SWIG_JavaThrowException(jenv, SWIG_JavaIllegalArgumentException, "a direct ByteBuffer is required");
+            return ;
+        }
+    }
+    {
+        arg3 = jarg3 ? (long long *) jenv->GetDirectBufferAddress(jarg3) : 0;
+        if (!arg3) {
+            SWIG_JavaThrowException(jenv, SWIG_JavaIllegalArgumentException, "a direct ByteBuffer is required");
+            return ;
+        }
+    }
+    {
+        arg4 = jarg4 ? (long long *) jenv->GetDirectBufferAddress(jarg4) : 0;
+        if (!arg4) {
+            SWIG_JavaThrowException(jenv, SWIG_JavaIllegalArgumentException, "a direct ByteBuffer is required");
+            return ;
+        }
+    }
+    arg5 = (int)jarg5;
+    {
+        try {
+            (arg1)->distanceQueriesDirect((long long const *)arg2,(long long const *)arg3,arg4,arg5);
+        } catch (const std::exception & e) {
+            SWIG_JavaThrowException(jenv, SWIG_JavaIllegalArgumentException, e.what());
+        }
+    }
+}
+
+
+SWIGEXPORT void JNICALL Java_cz_cvut_fel_aic_shortestpaths_shortestPathsJNI_CHDistanceQueryManagerAPI_1selectTargets(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlongArray jarg2, jint jarg3) {
+    CHDistanceQueryManagerAPI *arg1 = (CHDistanceQueryManagerAPI *) 0 ;
+    long long *arg2 = (long long *) 0 ;
+    int arg3 ;
+
+    (void)jenv;
+    (void)jcls;
+    (void)jarg1_;
+    arg1 = *(CHDistanceQueryManagerAPI **)&jarg1;
+    {
+        if (!jarg2) {
+            SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null array");
+            return ;
+        }
+        arg2 = (long long *) jenv->GetLongArrayElements(jarg2, 0);
+    }
+    arg3 = (int)jarg3;
+    {
+        try {
+            (arg1)->selectTargets((long long const *)arg2,arg3);
+        } catch (const std::exception & e) {
+            SWIG_JavaThrowException(jenv, SWIG_JavaIllegalArgumentException, e.what());
+        }
+    }
+    {
+        jenv->ReleaseLongArrayElements(jarg2, (jlong *) arg2, JNI_ABORT);
+    }
+}
+
+
+SWIGEXPORT void JNICALL Java_cz_cvut_fel_aic_shortestpaths_shortestPathsJNI_CHDistanceQueryManagerAPI_1selectAllNodes(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+    CHDistanceQueryManagerAPI *arg1 = (CHDistanceQueryManagerAPI *) 0 ;
+
+    (void)jenv;
+    (void)jcls;
+    (void)jarg1_;
+    arg1 = *(CHDistanceQueryManagerAPI **)&jarg1;
+    {
+        try {
+            (arg1)->selectAllNodes();
+        } catch (const std::exception & e) {
+            SWIG_JavaThrowException(jenv, SWIG_JavaIllegalArgumentException, e.what());
+        }
+    }
+}
+
+
+SWIGEXPORT jint JNICALL Java_cz_cvut_fel_aic_shortestpaths_shortestPathsJNI_CHDistanceQueryManagerAPI_1getTargetCount(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+    jint jresult = 0 ;
+    CHDistanceQueryManagerAPI *arg1 = (CHDistanceQueryManagerAPI *) 0 ;
+    int result;
+
+    (void)jenv;
+    (void)jcls;
+    (void)jarg1_;
+    arg1 = *(CHDistanceQueryManagerAPI **)&jarg1;
+    result = (int)(arg1)->getTargetCount();
+    jresult = (jint)result;
+    return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_cz_cvut_fel_aic_shortestpaths_shortestPathsJNI_CHDistanceQueryManagerAPI_1oneToManyQuery(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jlongArray jarg3, jint jarg4) {
+    CHDistanceQueryManagerAPI *arg1 = (CHDistanceQueryManagerAPI *) 0 ;
+    long long arg2 ;
+    long long *arg3 = (long long *) 0 ;
+    int arg4 ;
+
+    (void)jenv;
+    (void)jcls;
+    (void)jarg1_;
+    arg1 = *(CHDistanceQueryManagerAPI **)&jarg1;
+    arg2 = (long long)jarg2;
+    {
+        if (!jarg3) {
+            SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null array");
+            return ;
+        }
+        arg3 = (long long *) jenv->GetLongArrayElements(jarg3, 0);
+    }
+    arg4 = (int)jarg4;
+    {
+        try {
+            (arg1)->oneToManyQuery(arg2,arg3,arg4);
+        } catch (const std::exception & e) {
+            SWIG_JavaThrowException(jenv, SWIG_JavaIllegalArgumentException, e.what());
+        }
+    }
+    {
+        jenv->ReleaseLongArrayElements(jarg3, (jlong *) arg3, 0);
+    }
+}
+
+
+SWIGEXPORT jint JNICALL Java_cz_cvut_fel_aic_shortestpaths_shortestPathsJNI_CHDistanceQueryManagerAPI_1rangeQuery(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jlong jarg3, jlongArray jarg4, jlongArray jarg5, jint jarg6) {
+    jint jresult = 0 ;
+    CHDistanceQueryManagerAPI *arg1 = (CHDistanceQueryManagerAPI *) 0 ;
+    long long arg2 ;
+    long long arg3 ;
+    long long *arg4 = (long long *) 0 ;
+    long long *arg5 = (long long *) 0 ;
+    int arg6 ;
+    int result;
+
+    (void)jenv;
+    (void)jcls;
+    (void)jarg1_;
+    arg1 = *(CHDistanceQueryManagerAPI **)&jarg1;
+    arg2 = (long long)jarg2;
+    arg3 = (long long)jarg3;
+    {
+        if (!jarg4) {
+            SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null array");
+            return 0;
+        }
+        arg4 = (long long *) jenv->GetLongArrayElements(jarg4, 0);
+    }
+    {
+        if (!jarg5) {
+            SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null array");
+            return 0;
+        }
+        arg5 = (long long *) jenv->GetLongArrayElements(jarg5, 0);
+    }
+    arg6 = (int)jarg6;
+    {
+        try {
+            result = (int)(arg1)->rangeQuery(arg2,arg3,arg4,arg5,arg6);
+        } catch (const std::exception & e) {
+            SWIG_JavaThrowException(jenv, SWIG_JavaIllegalArgumentException, e.what());
+            result = 0;
+        }
+    }
+    jresult = (jint)result;
+    {
+        jenv->ReleaseLongArrayElements(jarg4, (jlong *) arg4, 0);
+    }
+    {
+        jenv->ReleaseLongArrayElements(jarg5, (jlong *) arg5, 0);
+    }
+    return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_cz_cvut_fel_aic_shortestpaths_shortestPathsJNI_CHDistanceQueryManagerAPI_1setThreads(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
+    CHDistanceQueryManagerAPI *arg1 = (CHDistanceQueryManagerAPI *) 0 ;
+    unsigned int arg2 ;
+
+    (void)jenv;
+    (void)jcls;
+    (void)jarg1_;
+    arg1 = *(CHDistanceQueryManagerAPI **)&jarg1;
+    arg2 = (unsigned int)jarg2;
+    (arg1)->setThreads(arg2);
+}
+
+
+SWIGEXPORT void JNICALL Java_cz_cvut_fel_aic_shortestpaths_shortestPathsJNI_CHDistanceQueryManagerAPI_1clearStructures(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+    CHDistanceQueryManagerAPI *arg1 = (CHDistanceQueryManagerAPI *) 0 ;
+
+    (void)jenv;
+    (void)jcls;
+    (void)jarg1_;
+    arg1 = *(CHDistanceQueryManagerAPI **)&jarg1;
+    (arg1)->clearStructures();
+}
+
+
+SWIGEXPORT void JNICALL Java_cz_cvut_fel_aic_shortestpaths_shortestPathsJNI_CHDistanceQueryManagerAPI_1setStatisticsEnabled(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jboolean jarg2) {
+    CHDistanceQueryManagerAPI *arg1 = (CHDistanceQueryManagerAPI *) 0 ;
+    bool arg2 ;
+
+    (void)jenv;
+    (void)jcls;
+    (void)jarg1_;
+    arg1 = *(CHDistanceQueryManagerAPI **)&jarg1;
+    arg2 = jarg2 ? true : false;
+    (arg1)->setStatisticsEnabled(arg2);
+}
+
+
+SWIGEXPORT jlong JNICALL Java_cz_cvut_fel_aic_shortestpaths_shortestPathsJNI_CHDistanceQueryManagerAPI_1getLastQueryStatistics(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+    jlong jresult = 0 ;
+    CHDistanceQueryManagerAPI *arg1 = (CHDistanceQueryManagerAPI *) 0 ;
+    QueryStatistics result;
+
+    (void)jenv;
+    (void)jcls;
+    (void)jarg1_;
+    arg1 = *(CHDistanceQueryManagerAPI **)&jarg1;
+    result = (arg1)->getLastQueryStatistics();
+    *(QueryStatistics **)&jresult = new QueryStatistics((const QueryStatistics &)result);
+    return jresult;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_cz_cvut_fel_aic_shortestpaths_shortestPathsJNI_new_1CHDistanceQueryManagerAPI(JNIEnv *jenv, jclass jcls) {
+    jlong jresult = 0 ;
+    CHDistanceQueryManagerAPI *result = 0 ;
+
+    (void)jenv;
+    (void)jcls;
+    result = (CHDistanceQueryManagerAPI *)new CHDistanceQueryManagerAPI();
+    *(CHDistanceQueryManagerAPI **)&jresult = result;
+    return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_cz_cvut_fel_aic_shortestpaths_shortestPathsJNI_delete_1CHDistanceQueryManagerAPI(JNIEnv *jenv, jclass jcls, jlong jarg1) {
+    CHDistanceQueryManagerAPI *arg1 = (CHDistanceQueryManagerAPI *) 0 ;
+
+    (void)jenv;
+    (void)jcls;
+    arg1 = *(CHDistanceQueryManagerAPI **)&jarg1;
+    delete arg1;
+}
+
+
+SWIGEXPORT void JNICALL Java_cz_cvut_fel_aic_shortestpaths_shortestPathsJNI_CCHDistanceQueryManagerAPI_1initializeCCH(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2, jstring jarg3) {
+    CCHDistanceQueryManagerAPI *arg1 = (CCHDistanceQueryManagerAPI *) 0 ;
+    std::string arg2 ;
+    std::string arg3 ;
+
+    (void)jenv;
+    (void)jcls;
+    (void)jarg1_;
+    arg1 = *(CCHDistanceQueryManagerAPI **)&jarg1;
+    if(!jarg2) {
+        SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
+        return ;
+    }
+    const char *arg2_pstr = (const char *)jenv->GetStringUTFChars(jarg2, 0);
+    if (!arg2_pstr) return ;
+    (&arg2)->assign(arg2_pstr);
+    jenv->ReleaseStringUTFChars(jarg2, arg2_pstr);
+    if(!jarg3) {
+        SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
+        return ;
+    }
+    const char *arg3_pstr = (const char *)jenv->GetStringUTFChars(jarg3, 0);
+    if (!arg3_pstr) return ;
+    (&arg3)->assign(arg3_pstr);
+    jenv->ReleaseStringUTFChars(jarg3, arg3_pstr);
+    (arg1)->initializeCCH(arg2,arg3);
+}
+
+
+SWIGEXPORT jlong JNICALL Java_cz_cvut_fel_aic_shortestpaths_shortestPathsJNI_CCHDistanceQueryManagerAPI_1distanceQuery(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jobject jarg2, jobject jarg3) {
+    jlong jresult = 0 ;
+    CCHDistanceQueryManagerAPI *arg1 = (CCHDistanceQueryManagerAPI *) 0 ;
+    unsigned long long arg2 ;
+    unsigned long long arg3 ;
+    unsigned int result;
+
+    (void)jenv;
+    (void)jcls;
+    (void)jarg1_;
+    arg1 = *(CCHDistanceQueryManagerAPI **)&jarg1;
+    {
+        jclass clazz;
+        jmethodID mid;
+        jbyteArray ba;
+        jbyte* bae;
+        jsize sz;
+        int i;
+
+        if (!jarg2) {
+            SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "BigInteger null");
+            return 0;
+        }
+        clazz = jenv->GetObjectClass(jarg2);
+        mid = jenv->GetMethodID(clazz, "toByteArray", "()[B");
+        ba = (jbyteArray)jenv->CallObjectMethod(jarg2, mid);
+        bae = jenv->GetByteArrayElements(ba, 0);
+        sz = jenv->GetArrayLength(ba);
+        arg2 = 0;
+        for(i=0; i<sz; i++) {
+            arg2 = (arg2 << 8) | (unsigned long long)(unsigned char)bae[i];
+        }
+        jenv->ReleaseByteArrayElements(ba, bae, 0);
+    }
+    {
+        jclass clazz;
+        jmethodID mid;
+        jbyteArray ba;
+        jbyte* bae;
+        jsize sz;
+        int i;
+
+        if (!jarg3) {
+            SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "BigInteger null");
+            return 0;
+        }
+        clazz = jenv->GetObjectClass(jarg3);
+        mid = jenv->GetMethodID(clazz, "toByteArray", "()[B");
+        ba = (jbyteArray)jenv->CallObjectMethod(jarg3, mid);
+        bae = jenv->GetByteArrayElements(ba, 0);
+        sz = jenv->GetArrayLength(ba);
+        arg3 = 0;
+        for(i=0; i<sz; i++) {
+            arg3 = (arg3 << 8) | (unsigned long long)(unsigned char)bae[i];
+        }
+        jenv->ReleaseByteArrayElements(ba, bae, 0);
+    }
+    result = (arg1)->distanceQuery(arg2,arg3);
+    jresult = (jlong)result;
+    return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_cz_cvut_fel_aic_shortestpaths_shortestPathsJNI_CCHDistanceQueryManagerAPI_1distanceQueries(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlongArray jarg2, jlongArray jarg3, jlongArray jarg4, jint jarg5) {
+    CCHDistanceQueryManagerAPI *arg1 = (CCHDistanceQueryManagerAPI *) 0 ;
+    long long *arg2 = (long long *) 0 ;
+    long long *arg3 = (long long *) 0 ;
+    long long *arg4 = (long long *) 0 ;
+    int arg5 ;
+
+    (void)jenv;
+    (void)jcls;
+    (void)jarg1_;
+    arg1 = *(CCHDistanceQueryManagerAPI **)&jarg1;
+    {
+        if (!jarg2) {
+            SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null array");
+            return ;
+        }
+        arg2 = (long long *) jenv->GetLongArrayElements(jarg2, 0);
+    }
+    {
+        if (!jarg3) {
+            SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null array");
+            return ;
+        }
+        arg3 = (long long *) jenv->GetLongArrayElements(jarg3, 0);
+    }
+    {
+        if (!jarg4) {
+            SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null array");
+            return ;
+        }
+        arg4 = (long long *) jenv->GetLongArrayElements(jarg4, 0);
+    }
+    arg5 = (int)jarg5;
+    {
+        try {
+            (arg1)->distanceQueries((long long const *)arg2,(long long const *)arg3,arg4,arg5);
+        } catch (const std::exception & e) {
+            SWIG_JavaThrowException(jenv, SWIG_JavaIllegalArgumentException, e.what());
+        }
+    }
+    {
+        jenv->ReleaseLongArrayElements(jarg2, (jlong *) arg2, JNI_ABORT);
+    }
+    {
+        jenv->ReleaseLongArrayElements(jarg3, (jlong *) arg3, JNI_ABORT);
+    }
+    {
+        jenv->ReleaseLongArrayElements(jarg4, (jlong *) arg4, 0);
+    }
+}
+
+
+SWIGEXPORT void JNICALL Java_cz_cvut_fel_aic_shortestpaths_shortestPathsJNI_CCHDistanceQueryManagerAPI_1distanceQueriesDirect(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jobject jarg2, jobject jarg3, jobject jarg4, jint jarg5) {
+    CCHDistanceQueryManagerAPI *arg1 = (CCHDistanceQueryManagerAPI *) 0 ;
+    long long *arg2 = (long long *) 0 ;
+    long long *arg3 = (long long *) 0 ;
+    long long *arg4 = (long long *) 0 ;
+    int arg5 ;
+
+    (void)jenv;
+    (void)jcls;
+    (void)jarg1_;
+    arg1 = *(CCHDistanceQueryManagerAPI **)&jarg1;
+    {
+        arg2 = jarg2 ? (long long *) jenv->GetDirectBufferAddress(jarg2) : 0;
+        if (!arg2) {
+            SWIG_JavaThrowException(jenv, SWIG_JavaIllegalArgumentException, "a direct ByteBuffer is required");
+            return ;
+        }
+    }
+    {
+        arg3 = jarg3 ? (long long *) jenv->GetDirectBufferAddress(jarg3) : 0;
+        if (!arg3) {
+            SWIG_JavaThrowException(jenv, SWIG_JavaIllegalArgumentException, "a direct ByteBuffer is required");
+            return ;
+        }
+    }
+    {
+        arg4 = jarg4 ? (long long *) jenv->GetDirectBufferAddress(jarg4) : 0;
+        if (!arg4) {
+            SWIG_JavaThrowException(jenv, SWIG_JavaIllegalArgumentException, "a direct ByteBuffer is required");
+            return ;
+        }
+    }
+    arg5 = (int)jarg5;
+    {
+        try {
+            (arg1)->distanceQueriesDirect((long long const *)arg2,(long long const *)arg3,arg4,arg5);
+        } catch (const std::exception & e) {
+            SWIG_JavaThrowException(jenv, SWIG_JavaIllegalArgumentException, e.what());
+        }
+    }
+}
+
+
+SWIGEXPORT void JNICALL Java_cz_cvut_fel_aic_shortestpaths_shortestPathsJNI_CCHDistanceQueryManagerAPI_1customize(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2) {
+    CCHDistanceQueryManagerAPI *arg1 = (CCHDistanceQueryManagerAPI *) 0 ;
+    std::string arg2 ;
+
+    (void)jenv;
+    (void)jcls;
+    (void)jarg1_;
+    arg1 = *(CCHDistanceQueryManagerAPI **)&jarg1;
+    if(!jarg2) {
+        SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
+        return ;
+    }
+    const char *arg2_pstr = (const char *)jenv->GetStringUTFChars(jarg2, 0);
+    if (!arg2_pstr) return ;
+    (&arg2)->assign(arg2_pstr);
+    jenv->ReleaseStringUTFChars(jarg2, arg2_pstr);
+    {
+        try {
+            (arg1)->customize(arg2);
+        } catch (const std::exception & e) {
+            SWIG_JavaThrowException(jenv, SWIG_JavaIllegalArgumentException, e.what());
+        }
+    }
+}
+
+
+SWIGEXPORT void JNICALL Java_cz_cvut_fel_aic_shortestpaths_shortestPathsJNI_CCHDistanceQueryManagerAPI_1setThreads(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
+    CCHDistanceQueryManagerAPI *arg1 = (CCHDistanceQueryManagerAPI *) 0 ;
+    unsigned int arg2 ;
+
+    (void)jenv;
+    (void)jcls;
+    (void)jarg1_;
+    arg1 = *(CCHDistanceQueryManagerAPI **)&jarg1;
+    arg2 = (unsigned int)jarg2;
+    (arg1)->setThreads(arg2);
+}
+
+
+SWIGEXPORT void JNICALL Java_cz_cvut_fel_aic_shortestpaths_shortestPathsJNI_CCHDistanceQueryManagerAPI_1clearStructures(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+    CCHDistanceQueryManagerAPI *arg1 = (CCHDistanceQueryManagerAPI *) 0 ;
+
+    (void)jenv;
+    (void)jcls;
+    (void)jarg1_;
+    arg1 = *(CCHDistanceQueryManagerAPI **)&jarg1;
+    (arg1)->clearStructures();
+}
+
+
+SWIGEXPORT void JNICALL Java_cz_cvut_fel_aic_shortestpaths_shortestPathsJNI_CCHDistanceQueryManagerAPI_1setStatisticsEnabled(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jboolean jarg2) {
+    CCHDistanceQueryManagerAPI *arg1 = (CCHDistanceQueryManagerAPI *) 0 ;
+    bool arg2 ;
+
+    (void)jenv;
+    (void)jcls;
+    (void)jarg1_;
+    arg1 = *(CCHDistanceQueryManagerAPI **)&jarg1;
+    arg2 = jarg2 ? true : false;
+    (arg1)->setStatisticsEnabled(arg2);
+}
+
+
+SWIGEXPORT jlong JNICALL Java_cz_cvut_fel_aic_shortestpaths_shortestPathsJNI_CCHDistanceQueryManagerAPI_1getLastQueryStatistics(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+    jlong jresult = 0 ;
+    CCHDistanceQueryManagerAPI *arg1 = (CCHDistanceQueryManagerAPI *) 0 ;
+    QueryStatistics result;
+
+    (void)jenv;
+    (void)jcls;
+    (void)jarg1_;
+    arg1 = *(CCHDistanceQueryManagerAPI **)&jarg1;
+    result = (arg1)->getLastQueryStatistics();
+    *(QueryStatistics **)&jresult = new QueryStatistics((const QueryStatistics &)result);
+    return jresult;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_cz_cvut_fel_aic_shortestpaths_shortestPathsJNI_new_1CCHDistanceQueryManagerAPI(JNIEnv *jenv, jclass jcls) {
+    jlong jresult = 0 ;
+    CCHDistanceQueryManagerAPI *result = 0 ;
+
+    (void)jenv;
+    (void)jcls;
+    result = (CCHDistanceQueryManagerAPI *)new CCHDistanceQueryManagerAPI();
+    *(CCHDistanceQueryManagerAPI **)&jresult = result;
+    return jresult;
+}
+
 
+SWIGEXPORT void JNICALL Java_cz_cvut_fel_aic_shortestpaths_shortestPathsJNI_delete_1CCHDistanceQueryManagerAPI(JNIEnv *jenv, jclass jcls, jlong jarg1) {
+    CCHDistanceQueryManagerAPI *arg1 = (CCHDistanceQueryManagerAPI *) 0 ;
 
+    (void)jenv;
+    (void)jcls;
+    arg1 = *(CCHDistanceQueryManagerAPI **)&jarg1;
+    delete arg1;
+}
 
-#ifdef __cplusplus
-extern "C" {
-#endif
 
-SWIGEXPORT void JNICALL Java_cz_cvut_fel_aic_shortestpaths_shortestPathsJNI_CHDistanceQueryManagerAPI_1initializeCH(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2, jstring jarg3) {
-    CHDistanceQueryManagerAPI *arg1 = (CHDistanceQueryManagerAPI *) 0 ;
+SWIGEXPORT void JNICALL Java_cz_cvut_fel_aic_shortestpaths_shortestPathsJNI_TNRDistanceQueryManagerAPI_1initializeTNR(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2, jstring jarg3) {
+    TNRDistanceQueryManagerAPI *arg1 = (TNRDistanceQueryManagerAPI *) 0 ;
     std::string arg2 ;
     std::string arg3 ;
 
     (void)jenv;
     (void)jcls;
     (void)jarg1_;
-    arg1 = *(CHDistanceQueryManagerAPI **)&jarg1;
+    arg1 = *(TNRDistanceQueryManagerAPI **)&jarg1;
     if(!jarg2) {
         SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
         return ;
@@ -298,13 +1143,13 @@ SWIGEXPORT void JNICALL Java_cz_cvut_fel_aic_shortestpaths_shortestPathsJNI_CHDi
     if (!arg3_pstr) return ;
     (&arg3)->assign(arg3_pstr);
     jenv->ReleaseStringUTFChars(jarg3, arg3_pstr);
-    (arg1)->initializeCH(arg2,arg3);
+    (arg1)->initializeTNR(arg2,arg3);
 }
 
 
-SWIGEXPORT jlong JNICALL Java_cz_cvut_fel_aic_shortestpaths_shortestPathsJNI_CHDistanceQueryManagerAPI_1distanceQuery(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jobject jarg2, jobject jarg3) {
+SWIGEXPORT jlong JNICALL Java_cz_cvut_fel_aic_shortestpaths_shortestPathsJNI_TNRDistanceQueryManagerAPI_1distanceQuery(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jobject jarg2, jobject jarg3) {
     jlong jresult = 0 ;
-    CHDistanceQueryManagerAPI *arg1 = (CHDistanceQueryManagerAPI *) 0 ;
+    TNRDistanceQueryManagerAPI *arg1 = (TNRDistanceQueryManagerAPI *) 0 ;
     unsigned long long arg2 ;
     unsigned long long arg3 ;
     unsigned int result;
@@ -312,7 +1157,7 @@ SWIGEXPORT jlong JNICALL Java_cz_cvut_fel_aic_shortestpaths_shortestPathsJNI_CHD
     (void)jenv;
     (void)jcls;
     (void)jarg1_;
-    arg1 = *(CHDistanceQueryManagerAPI **)&jarg1;
+    arg1 = *(TNRDistanceQueryManagerAPI **)&jarg1;
     {
         jclass clazz;
         jmethodID mid;
@@ -365,48 +1210,184 @@ SWIGEXPORT jlong JNICALL Java_cz_cvut_fel_aic_shortestpaths_shortestPathsJNI_CHD
 }
 
 
-SWIGEXPORT void JNICALL Java_cz_cvut_fel_aic_shortestpaths_shortestPathsJNI_CHDistanceQueryManagerAPI_1clearStructures(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-    CHDistanceQueryManagerAPI *arg1 = (CHDistanceQueryManagerAPI *) 0 ;
+SWIGEXPORT void JNICALL Java_cz_cvut_fel_aic_shortestpaths_shortestPathsJNI_TNRDistanceQueryManagerAPI_1distanceQueries(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlongArray jarg2, jlongArray jarg3, jlongArray jarg4, jint jarg5) {
+    TNRDistanceQueryManagerAPI *arg1 = (TNRDistanceQueryManagerAPI *) 0 ;
+    long long *arg2 = (long long *) 0 ;
+    long long *arg3 = (long long *) 0 ;
+    long long *arg4 = (long long *) 0 ;
+    int arg5 ;
 
     (void)jenv;
     (void)jcls;
     (void)jarg1_;
-    arg1 = *(CHDistanceQueryManagerAPI **)&jarg1;
+    arg1 = *(TNRDistanceQueryManagerAPI **)&jarg1;
+    {
+        if (!jarg2) {
+            SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null array");
+            return ;
+        }
+        arg2 = (long long *) jenv->GetLongArrayElements(jarg2, 0);
+    }
+    {
+        if (!jarg3) {
+            SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null array");
+            return ;
+        }
+        arg3 = (long long *) jenv->GetLongArrayElements(jarg3, 0);
+    }
+    {
+        if (!jarg4) {
+            SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null array");
+            return ;
+        }
+        arg4 = (long long *) jenv->GetLongArrayElements(jarg4, 0);
+    }
+    arg5 = (int)jarg5;
+    {
+        try {
+            (arg1)->distanceQueries((long long const *)arg2,(long long const *)arg3,arg4,arg5);
+        } catch (const std::exception & e) {
+            SWIG_JavaThrowException(jenv, SWIG_JavaIllegalArgumentException, e.what());
+        }
+    }
+    {
+        jenv->ReleaseLongArrayElements(jarg2, (jlong *) arg2, JNI_ABORT);
+    }
+    {
+        jenv->ReleaseLongArrayElements(jarg3, (jlong *) arg3, JNI_ABORT);
+    }
+    {
+        jenv->ReleaseLongArrayElements(jarg4, (jlong *) arg4, 0);
+    }
+}
+
+
+SWIGEXPORT void JNICALL Java_cz_cvut_fel_aic_shortestpaths_shortestPathsJNI_TNRDistanceQueryManagerAPI_1distanceQueriesDirect(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jobject jarg2, jobject jarg3, jobject jarg4, jint jarg5) {
+    TNRDistanceQueryManagerAPI *arg1 = (TNRDistanceQueryManagerAPI *) 0 ;
+    long long *arg2 = (long long *) 0 ;
+    long long *arg3 = (long long *) 0 ;
+    long long *arg4 = (long long *) 0 ;
+    int arg5 ;
+
+    (void)jenv;
+    (void)jcls;
+    (void)jarg1_;
+    arg1 = *(TNRDistanceQueryManagerAPI **)&jarg1;
+    {
+        arg2 = jarg2 ? (long long *) jenv->GetDirectBufferAddress(jarg2) : 0;
+        if (!arg2) {
+            SWIG_JavaThrowException(jenv, SWIG_JavaIllegalArgumentException, "a direct ByteBuffer is required");
+            return ;
+        }
+    }
+    {
+        arg3 = jarg3 ? (long long *) jenv->GetDirectBufferAddress(jarg3) : 0;
+        if (!arg3) {
+            SWIG_JavaThrowException(jenv, SWIG_JavaIllegalArgumentException, "a direct ByteBuffer is required");
+            return ;
+        }
+    }
+    {
+        arg4 = jarg4 ? (long long *) jenv->GetDirectBufferAddress(jarg4) : 0;
+        if (!arg4) {
+            SWIG_JavaThrowException(jenv, SWIG_JavaIllegalArgumentException, "a direct ByteBuffer is required");
+            return ;
+        }
+    }
+    arg5 = (int)jarg5;
+    {
+        try {
+            (arg1)->distanceQueriesDirect((long long const *)arg2,(long long const *)arg3,arg4,arg5);
+        } catch (const std::exception & e) {
+            SWIG_JavaThrowException(jenv, SWIG_JavaIllegalArgumentException, e.what());
+        }
+    }
+}
+
+
+SWIGEXPORT void JNICALL Java_cz_cvut_fel_aic_shortestpaths_shortestPathsJNI_TNRDistanceQueryManagerAPI_1setThreads(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
+    TNRDistanceQueryManagerAPI *arg1 = (TNRDistanceQueryManagerAPI *) 0 ;
+    unsigned int arg2 ;
+
+    (void)jenv;
+    (void)jcls;
+    (void)jarg1_;
+    arg1 = *(TNRDistanceQueryManagerAPI **)&jarg1;
+    arg2 = (unsigned int)jarg2;
+    (arg1)->setThreads(arg2);
+}
+
+
+SWIGEXPORT void JNICALL Java_cz_cvut_fel_aic_shortestpaths_shortestPathsJNI_TNRDistanceQueryManagerAPI_1clearStructures(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+    TNRDistanceQueryManagerAPI *arg1 = (TNRDistanceQueryManagerAPI *) 0 ;
+
+    (void)jenv;
+    (void)jcls;
+    (void)jarg1_;
+    arg1 = *(TNRDistanceQueryManagerAPI **)&jarg1;
     (arg1)->clearStructures();
 }
 
 
-SWIGEXPORT jlong JNICALL Java_cz_cvut_fel_aic_shortestpaths_shortestPathsJNI_new_1CHDistanceQueryManagerAPI(JNIEnv *jenv, jclass jcls) {
+SWIGEXPORT void JNICALL Java_cz_cvut_fel_aic_shortestpaths_shortestPathsJNI_TNRDistanceQueryManagerAPI_1setStatisticsEnabled(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jboolean jarg2) {
+    TNRDistanceQueryManagerAPI *arg1 = (TNRDistanceQueryManagerAPI *) 0 ;
+    bool arg2 ;
+
+    (void)jenv;
+    (void)jcls;
+    (void)jarg1_;
+    arg1 = *(TNRDistanceQueryManagerAPI **)&jarg1;
+    arg2 = jarg2 ? true : false;
+    (arg1)->setStatisticsEnabled(arg2);
+}
+
+
+SWIGEXPORT jlong JNICALL Java_cz_cvut_fel_aic_shortestpaths_shortestPathsJNI_TNRDistanceQueryManagerAPI_1getLastQueryStatistics(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
     jlong jresult = 0 ;
-    CHDistanceQueryManagerAPI *result = 0 ;
+    TNRDistanceQueryManagerAPI *arg1 = (TNRDistanceQueryManagerAPI *) 0 ;
+    QueryStatistics result;
 
     (void)jenv;
     (void)jcls;
-    result = (CHDistanceQueryManagerAPI *)new CHDistanceQueryManagerAPI();
-    *(CHDistanceQueryManagerAPI **)&jresult = result;
+    (void)jarg1_;
+    arg1 = *(TNRDistanceQueryManagerAPI **)&jarg1;
+    result = (arg1)->getLastQueryStatistics();
+    *(QueryStatistics **)&jresult = new QueryStatistics((const QueryStatistics &)result);
     return jresult;
 }
 
 
-SWIGEXPORT void JNICALL Java_cz_cvut_fel_aic_shortestpaths_shortestPathsJNI_delete_1CHDistanceQueryManagerAPI(JNIEnv *jenv, jclass jcls, jlong jarg1) {
-    CHDistanceQueryManagerAPI *arg1 = (CHDistanceQueryManagerAPI *) 0 ;
+SWIGEXPORT jlong JNICALL Java_cz_cvut_fel_aic_shortestpaths_shortestPathsJNI_new_1TNRDistanceQueryManagerAPI(JNIEnv *jenv, jclass jcls) {
+    jlong jresult = 0 ;
+    TNRDistanceQueryManagerAPI *result = 0 ;
 
     (void)jenv;
     (void)jcls;
-    arg1 = *(CHDistanceQueryManagerAPI **)&jarg1;
-    delete arg1;
+    result = (TNRDistanceQueryManagerAPI *)new TNRDistanceQueryManagerAPI();
+    *(TNRDistanceQueryManagerAPI **)&jresult = result;
+    return jresult;
 }
 
 
-SWIGEXPORT void JNICALL Java_cz_cvut_fel_aic_shortestpaths_shortestPathsJNI_TNRDistanceQueryManagerAPI_1initializeTNR(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2, jstring jarg3) {
+SWIGEXPORT void JNICALL Java_cz_cvut_fel_aic_shortestpaths_shortestPathsJNI_delete_1TNRDistanceQueryManagerAPI(JNIEnv *jenv, jclass jcls, jlong jarg1) {
     TNRDistanceQueryManagerAPI *arg1 = (TNRDistanceQueryManagerAPI *) 0 ;
+
+    (void)jenv;
+    (void)jcls;
+    arg1 = *(TNRDistanceQueryManagerAPI **)&jarg1;
+    delete arg1;
+}
+
+
+SWIGEXPORT void JNICALL Java_cz_cvut_fel_aic_shortestpaths_shortestPathsJNI_TNRAFDistanceQueryManagerAPI_1initializeTNRAF(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2, jstring jarg3) {
+    TNRAFDistanceQueryManagerAPI *arg1 = (TNRAFDistanceQueryManagerAPI *) 0 ;
     std::string arg2 ;
     std::string arg3 ;
 
     (void)jenv;
     (void)jcls;
     (void)jarg1_;
-    arg1 = *(TNRDistanceQueryManagerAPI **)&jarg1;
+    arg1 = *(TNRAFDistanceQueryManagerAPI **)&jarg1;
     if(!jarg2) {
         SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
         return ;
@@ -423,13 +1404,13 @@ SWIGEXPORT void JNICALL Java_cz_cvut_fel_aic_shortestpaths_shortestPathsJNI_TNRD
     if (!arg3_pstr) return ;
     (&arg3)->assign(arg3_pstr);
     jenv->ReleaseStringUTFChars(jarg3, arg3_pstr);
-    (arg1)->initializeTNR(arg2,arg3);
+    (arg1)->initializeTNRAF(arg2,arg3);
 }
 
 
-SWIGEXPORT jlong JNICALL Java_cz_cvut_fel_aic_shortestpaths_shortestPathsJNI_TNRDistanceQueryManagerAPI_1distanceQuery(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jobject jarg2, jobject jarg3) {
+SWIGEXPORT jlong JNICALL Java_cz_cvut_fel_aic_shortestpaths_shortestPathsJNI_TNRAFDistanceQueryManagerAPI_1distanceQuery(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jobject jarg2, jobject jarg3) {
     jlong jresult = 0 ;
-    TNRDistanceQueryManagerAPI *arg1 = (TNRDistanceQueryManagerAPI *) 0 ;
+    TNRAFDistanceQueryManagerAPI *arg1 = (TNRAFDistanceQueryManagerAPI *) 0 ;
     unsigned long long arg2 ;
     unsigned long long arg3 ;
     unsigned int result;
@@ -437,7 +1418,7 @@ SWIGEXPORT jlong JNICALL Java_cz_cvut_fel_aic_shortestpaths_shortestPathsJNI_TNR
     (void)jenv;
     (void)jcls;
     (void)jarg1_;
-    arg1 = *(TNRDistanceQueryManagerAPI **)&jarg1;
+    arg1 = *(TNRAFDistanceQueryManagerAPI **)&jarg1;
     {
         jclass clazz;
         jmethodID mid;
@@ -490,48 +1471,184 @@ SWIGEXPORT jlong JNICALL Java_cz_cvut_fel_aic_shortestpaths_shortestPathsJNI_TNR
 }
 
 
-SWIGEXPORT void JNICALL Java_cz_cvut_fel_aic_shortestpaths_shortestPathsJNI_TNRDistanceQueryManagerAPI_1clearStructures(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-    TNRDistanceQueryManagerAPI *arg1 = (TNRDistanceQueryManagerAPI *) 0 ;
+SWIGEXPORT void JNICALL Java_cz_cvut_fel_aic_shortestpaths_shortestPathsJNI_TNRAFDistanceQueryManagerAPI_1distanceQueries(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlongArray jarg2, jlongArray jarg3, jlongArray jarg4, jint jarg5) {
+    TNRAFDistanceQueryManagerAPI *arg1 = (TNRAFDistanceQueryManagerAPI *) 0 ;
+    long long *arg2 = (long long *) 0 ;
+    long long *arg3 = (long long *) 0 ;
+    long long *arg4 = (long long *) 0 ;
+    int arg5 ;
 
     (void)jenv;
     (void)jcls;
     (void)jarg1_;
-    arg1 = *(TNRDistanceQueryManagerAPI **)&jarg1;
+    arg1 = *(TNRAFDistanceQueryManagerAPI **)&jarg1;
+    {
+        if (!jarg2) {
+            SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null array");
+            return ;
+        }
+        arg2 = (long long *) jenv->GetLongArrayElements(jarg2, 0);
+    }
+    {
+        if (!jarg3) {
+            SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null array");
+            return ;
+        }
+        arg3 = (long long *) jenv->GetLongArrayElements(jarg3, 0);
+    }
+    {
+        if (!jarg4) {
+            SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null array");
+            return ;
+        }
+        arg4 = (long long *) jenv->GetLongArrayElements(jarg4, 0);
+    }
+    arg5 = (int)jarg5;
+    {
+        try {
+            (arg1)->distanceQueries((long long const *)arg2,(long long const *)arg3,arg4,arg5);
+        } catch (const std::exception & e) {
+            SWIG_JavaThrowException(jenv, SWIG_JavaIllegalArgumentException, e.what());
+        }
+    }
+    {
+        jenv->ReleaseLongArrayElements(jarg2, (jlong *) arg2, JNI_ABORT);
+    }
+    {
+        jenv->ReleaseLongArrayElements(jarg3, (jlong *) arg3, JNI_ABORT);
+    }
+    {
+        jenv->ReleaseLongArrayElements(jarg4, (jlong *) arg4, 0);
+    }
+}
+
+
+SWIGEXPORT void JNICALL Java_cz_cvut_fel_aic_shortestpaths_shortestPathsJNI_TNRAFDistanceQueryManagerAPI_1distanceQueriesDirect(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jobject jarg2, jobject jarg3, jobject jarg4, jint jarg5) {
+    TNRAFDistanceQueryManagerAPI *arg1 = (TNRAFDistanceQueryManagerAPI *) 0 ;
+    long long *arg2 = (long long *) 0 ;
+    long long *arg3 = (long long *) 0 ;
+    long long *arg4 = (long long *) 0 ;
+    int arg5 ;
+
+    (void)jenv;
+    (void)jcls;
+    (void)jarg1_;
+    arg1 = *(TNRAFDistanceQueryManagerAPI **)&jarg1;
+    {
+        arg2 = jarg2 ? (long long *) jenv->GetDirectBufferAddress(jarg2) : 0;
+        if (!arg2) {
+            SWIG_JavaThrowException(jenv, SWIG_JavaIllegalArgumentException, "a direct ByteBuffer is required");
+            return ;
+        }
+    }
+    {
+        arg3 = jarg3 ? (long long *) jenv->GetDirectBufferAddress(jarg3) : 0;
+        if (!arg3) {
+            SWIG_JavaThrowException(jenv, SWIG_JavaIllegalArgumentException, "a direct ByteBuffer is required");
+            return ;
+        }
+    }
+    {
+        arg4 = jarg4 ? (long long *) jenv->GetDirectBufferAddress(jarg4) : 0;
+        if (!arg4) {
+            SWIG_JavaThrowException(jenv, SWIG_JavaIllegalArgumentException, "a direct ByteBuffer is required");
+            return ;
+        }
+    }
+    arg5 = (int)jarg5;
+    {
+        try {
+            (arg1)->distanceQueriesDirect((long long const *)arg2,(long long const *)arg3,arg4,arg5);
+        } catch (const std::exception & e) {
+            SWIG_JavaThrowException(jenv, SWIG_JavaIllegalArgumentException, e.what());
+        }
+    }
+}
+
+
+SWIGEXPORT void JNICALL Java_cz_cvut_fel_aic_shortestpaths_shortestPathsJNI_TNRAFDistanceQueryManagerAPI_1setThreads(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
+    TNRAFDistanceQueryManagerAPI *arg1 = (TNRAFDistanceQueryManagerAPI *) 0 ;
+    unsigned int arg2 ;
+
+    (void)jenv;
+    (void)jcls;
+    (void)jarg1_;
+    arg1 = *(TNRAFDistanceQueryManagerAPI **)&jarg1;
+    arg2 = (unsigned int)jarg2;
+    (arg1)->setThreads(arg2);
+}
+
+
+SWIGEXPORT void JNICALL Java_cz_cvut_fel_aic_shortestpaths_shortestPathsJNI_TNRAFDistanceQueryManagerAPI_1clearStructures(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+    TNRAFDistanceQueryManagerAPI *arg1 = (TNRAFDistanceQueryManagerAPI *) 0 ;
+
+    (void)jenv;
+    (void)jcls;
+    (void)jarg1_;
+    arg1 = *(TNRAFDistanceQueryManagerAPI **)&jarg1;
     (arg1)->clearStructures();
 }
 
 
-SWIGEXPORT jlong JNICALL Java_cz_cvut_fel_aic_shortestpaths_shortestPathsJNI_new_1TNRDistanceQueryManagerAPI(JNIEnv *jenv, jclass jcls) {
+SWIGEXPORT void JNICALL Java_cz_cvut_fel_aic_shortestpaths_shortestPathsJNI_TNRAFDistanceQueryManagerAPI_1setStatisticsEnabled(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jboolean jarg2) {
+    TNRAFDistanceQueryManagerAPI *arg1 = (TNRAFDistanceQueryManagerAPI *) 0 ;
+    bool arg2 ;
+
+    (void)jenv;
+    (void)jcls;
+    (void)jarg1_;
+    arg1 = *(TNRAFDistanceQueryManagerAPI **)&jarg1;
+    arg2 = jarg2 ? true : false;
+    (arg1)->setStatisticsEnabled(arg2);
+}
+
+
+SWIGEXPORT jlong JNICALL Java_cz_cvut_fel_aic_shortestpaths_shortestPathsJNI_TNRAFDistanceQueryManagerAPI_1getLastQueryStatistics(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
     jlong jresult = 0 ;
-    TNRDistanceQueryManagerAPI *result = 0 ;
+    TNRAFDistanceQueryManagerAPI *arg1 = (TNRAFDistanceQueryManagerAPI *) 0 ;
+    QueryStatistics result;
 
     (void)jenv;
     (void)jcls;
-    result = (TNRDistanceQueryManagerAPI *)new TNRDistanceQueryManagerAPI();
-    *(TNRDistanceQueryManagerAPI **)&jresult = result;
+    (void)jarg1_;
+    arg1 = *(TNRAFDistanceQueryManagerAPI **)&jarg1;
+    result = (arg1)->getLastQueryStatistics();
+    *(QueryStatistics **)&jresult = new QueryStatistics((const QueryStatistics &)result);
     return jresult;
 }
 
 
-SWIGEXPORT void JNICALL Java_cz_cvut_fel_aic_shortestpaths_shortestPathsJNI_delete_1TNRDistanceQueryManagerAPI(JNIEnv *jenv, jclass jcls, jlong jarg1) {
-    TNRDistanceQueryManagerAPI *arg1 = (TNRDistanceQueryManagerAPI *) 0 ;
+SWIGEXPORT jlong JNICALL Java_cz_cvut_fel_aic_shortestpaths_shortestPathsJNI_new_1TNRAFDistanceQueryManagerAPI(JNIEnv *jenv, jclass jcls) {
+    jlong jresult = 0 ;
+    TNRAFDistanceQueryManagerAPI *result = 0 ;
 
     (void)jenv;
     (void)jcls;
-    arg1 = *(TNRDistanceQueryManagerAPI **)&jarg1;
-    delete arg1;
+    result = (TNRAFDistanceQueryManagerAPI *)new TNRAFDistanceQueryManagerAPI();
+    *(TNRAFDistanceQueryManagerAPI **)&jresult = result;
+    return jresult;
 }
 
 
-SWIGEXPORT void JNICALL Java_cz_cvut_fel_aic_shortestpaths_shortestPathsJNI_TNRAFDistanceQueryManagerAPI_1initializeTNRAF(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2, jstring jarg3) {
+SWIGEXPORT void JNICALL Java_cz_cvut_fel_aic_shortestpaths_shortestPathsJNI_delete_1TNRAFDistanceQueryManagerAPI(JNIEnv *jenv, jclass jcls, jlong jarg1) {
     TNRAFDistanceQueryManagerAPI *arg1 = (TNRAFDistanceQueryManagerAPI *) 0 ;
+
+    (void)jenv;
+    (void)jcls;
+    arg1 = *(TNRAFDistanceQueryManagerAPI **)&jarg1;
+    delete arg1;
+}
+
+
+SWIGEXPORT void JNICALL Java_cz_cvut_fel_aic_shortestpaths_shortestPathsJNI_DMDistanceQueryManagerAPI_1initializeDM(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2, jstring jarg3) {
+    DMDistanceQueryManagerAPI *arg1 = (DMDistanceQueryManagerAPI *) 0 ;
     std::string arg2 ;
     std::string arg3 ;
 
     (void)jenv;
     (void)jcls;
     (void)jarg1_;
-    arg1 = *(TNRAFDistanceQueryManagerAPI **)&jarg1;
+    arg1 = *(DMDistanceQueryManagerAPI **)&jarg1;
     if(!jarg2) {
         SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
         return ;
@@ -548,13 +1665,13 @@ SWIGEXPORT void JNICALL Java_cz_cvut_fel_aic_shortestpaths_shortestPathsJNI_TNRA
     if (!arg3_pstr) return ;
     (&arg3)->assign(arg3_pstr);
     jenv->ReleaseStringUTFChars(jarg3, arg3_pstr);
-    (arg1)->initializeTNRAF(arg2,arg3);
+    (arg1)->initializeDM(arg2,arg3);
 }
 
 
-SWIGEXPORT jlong JNICALL Java_cz_cvut_fel_aic_shortestpaths_shortestPathsJNI_TNRAFDistanceQueryManagerAPI_1distanceQuery(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jobject jarg2, jobject jarg3) {
+SWIGEXPORT jlong JNICALL Java_cz_cvut_fel_aic_shortestpaths_shortestPathsJNI_DMDistanceQueryManagerAPI_1distanceQuery(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jobject jarg2, jobject jarg3) {
     jlong jresult = 0 ;
-    TNRAFDistanceQueryManagerAPI *arg1 = (TNRAFDistanceQueryManagerAPI *) 0 ;
+    DMDistanceQueryManagerAPI *arg1 = (DMDistanceQueryManagerAPI *) 0 ;
     unsigned long long arg2 ;
     unsigned long long arg3 ;
     unsigned int result;
@@ -562,7 +1679,7 @@ SWIGEXPORT jlong JNICALL Java_cz_cvut_fel_aic_shortestpaths_shortestPathsJNI_TNR
     (void)jenv;
     (void)jcls;
     (void)jarg1_;
-    arg1 = *(TNRAFDistanceQueryManagerAPI **)&jarg1;
+    arg1 = *(DMDistanceQueryManagerAPI **)&jarg1;
     {
         jclass clazz;
         jmethodID mid;
@@ -615,35 +1732,35 @@ SWIGEXPORT jlong JNICALL Java_cz_cvut_fel_aic_shortestpaths_shortestPathsJNI_TNR
 }
 
 
-SWIGEXPORT void JNICALL Java_cz_cvut_fel_aic_shortestpaths_shortestPathsJNI_TNRAFDistanceQueryManagerAPI_1clearStructures(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-    TNRAFDistanceQueryManagerAPI *arg1 = (TNRAFDistanceQueryManagerAPI *) 0 ;
+SWIGEXPORT void JNICALL Java_cz_cvut_fel_aic_shortestpaths_shortestPathsJNI_DMDistanceQueryManagerAPI_1clearStructures(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+    DMDistanceQueryManagerAPI *arg1 = (DMDistanceQueryManagerAPI *) 0 ;
 
     (void)jenv;
     (void)jcls;
     (void)jarg1_;
-    arg1 = *(TNRAFDistanceQueryManagerAPI **)&jarg1;
+    arg1 = *(DMDistanceQueryManagerAPI **)&jarg1;
     (arg1)->clearStructures();
 }
 
 
-SWIGEXPORT jlong JNICALL Java_cz_cvut_fel_aic_shortestpaths_shortestPathsJNI_new_1TNRAFDistanceQueryManagerAPI(JNIEnv *jenv, jclass jcls) {
+SWIGEXPORT jlong JNICALL Java_cz_cvut_fel_aic_shortestpaths_shortestPathsJNI_new_1DMDistanceQueryManagerAPI(JNIEnv *jenv, jclass jcls) {
     jlong jresult = 0 ;
-    TNRAFDistanceQueryManagerAPI *result = 0 ;
+    DMDistanceQueryManagerAPI *result = 0 ;
 
     (void)jenv;
     (void)jcls;
-    result = (TNRAFDistanceQueryManagerAPI *)new TNRAFDistanceQueryManagerAPI();
-    *(TNRAFDistanceQueryManagerAPI **)&jresult = result;
+    result = (DMDistanceQueryManagerAPI *)new DMDistanceQueryManagerAPI();
+    *(DMDistanceQueryManagerAPI **)&jresult = result;
     return jresult;
 }
 
 
-SWIGEXPORT void JNICALL Java_cz_cvut_fel_aic_shortestpaths_shortestPathsJNI_delete_1TNRAFDistanceQueryManagerAPI(JNIEnv *jenv, jclass jcls, jlong jarg1) {
-    TNRAFDistanceQueryManagerAPI *arg1 = (TNRAFDistanceQueryManagerAPI *) 0 ;
+SWIGEXPORT void JNICALL Java_cz_cvut_fel_aic_shortestpaths_shortestPathsJNI_delete_1DMDistanceQueryManagerAPI(JNIEnv *jenv, jclass jcls, jlong jarg1) {
+    DMDistanceQueryManagerAPI *arg1 = (DMDistanceQueryManagerAPI *) 0 ;
 
     (void)jenv;
     (void)jcls;
-    arg1 = *(TNRAFDistanceQueryManagerAPI **)&jarg1;
+    arg1 = *(DMDistanceQueryManagerAPI **)&jarg1;
     delete arg1;
 }
 
@@ -0,0 +1,160 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Czech Technical University in Prague
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. */
+
+/******************************************************************************
+* File:             ALTQueryManager.cpp
+*****************************************************************************/
+
+#include <algorithm>
+#include <climits>
+#include <functional>
+#include <stdexcept>
+#include "ALTQueryManager.h"
+
+//______________________________________________________________________________________________________________________
+ALTQueryManager::ALTQueryManager(const Graph& graph, const Landmarks& landmarks)
+    : graph(graph), landmarks(landmarks), start(0), goal(0), shortest(UINT_MAX), stamps(graph.nodes(), 0),
+      currentStamp(0), forwardDist(graph.nodes()), backwardDist(graph.nodes()), potentials(graph.nodes()),
+      statistics(nullptr) {
+    if (landmarks.nodes() != graph.nodes()) {
+        throw std::invalid_argument("The landmarks were computed for a different graph.");
+    }
+}
+
+//______________________________________________________________________________________________________________________
+void ALTQueryManager::setStatistics(QueryStatistics* queryStatistics) {
+    statistics = queryStatistics;
+}
+
+//______________________________________________________________________________________________________________________
+void ALTQueryManager::selectActiveLandmarks(const unsigned int start, const unsigned int goal) {
+    landmarkBounds.clear();
+    for (unsigned int i = 0; i < landmarks.count(); i++) {
+        landmarkBounds.emplace_back(landmarks.lowerBound(start, goal, i), i);
+    }
+    const auto active = landmarkBounds.begin() + std::min<unsigned int>(ACTIVE_LANDMARKS, landmarks.count());
+    std::partial_sort(landmarkBounds.begin(), active, landmarkBounds.end(), std::greater<>());
+
+    activeLandmarks.clear();
+    for (auto it = landmarkBounds.begin(); it != active; ++it) {
+        activeLandmarks.push_back(it->second);
+    }
+}
+
+//______________________________________________________________________________________________________________________
+void ALTQueryManager::visit(const unsigned int node) {
+    if (stamps[node] == currentStamp) {
+        return;
+    }
+
+    stamps[node] = currentStamp;
+    forwardDist[node] = UINT_MAX;
+    backwardDist[node] = UINT_MAX;
+
+    dist_t toGoal = 0;
+    dist_t fromStart = 0;
+    for (unsigned int landmark : activeLandmarks) {
+        toGoal = std::max(toGoal, landmarks.lowerBound(node, goal, landmark));
+        fromStart = std::max(fromStart, landmarks.lowerBound(start, node, landmark));
+    }
+    potentials[node] = static_cast<long long>(toGoal) - static_cast<long long>(fromStart);
+}
+
+//______________________________________________________________________________________________________________________
+void ALTQueryManager::settleNext(
+        std::vector<QueueEntry>& queue,
+        std::vector<dist_t>& distances,
+        const std::vector<dist_t>& otherDistances,
+        const bool backward) {
+    std::pop_heap(queue.begin(), queue.end(), std::greater<>());
+    const auto [key, node] = queue.back();
+    queue.pop_back();
+
+    const long long sign = backward ? -1 : 1;
+    const dist_t distance = distances[node];
+    if (key != 2 * static_cast<long long>(distance) + sign * potentials[node]) {
+        return;
+    }
+    COUNT_QUERY_STATISTIC(statistics, settledNodes, 1);
+
+    const auto& edges = backward ? graph.incomingEdges(node) : graph.outgoingEdges(node);
+    for (const auto& [neighbour, weight] : edges) {
+        COUNT_QUERY_STATISTIC(statistics, relaxedEdges, 1);
+        visit(neighbour);
+        const unsigned long long candidate = static_cast<unsigned long long>(distance) + weight;
+        if (candidate >= distances[neighbour]) {
+            continue;
+        }
+
+        distances[neighbour] = static_cast<dist_t>(candidate);
+        if (otherDistances[neighbour] != UINT_MAX) {
+            shortest = std::min(shortest, candidate + otherDistances[neighbour]);
+        }
+        queue.emplace_back(2 * static_cast<long long>(candidate) + sign * potentials[neighbour], neighbour);
+        std::push_heap(queue.begin(), queue.end(), std::greater<>());
+    }
+}
+
+//______________________________________________________________________________________________________________________
+unsigned int ALTQueryManager::findDistance(const unsigned int start, const unsigned int goal) {
+    if (start == goal) {
+        return 0;
+    }
+
+    // The stamps of all the nodes are only reset once the counter wraps around.
+    if (++currentStamp == 0) {
+        std::fill(stamps.begin(), stamps.end(), 0);
+        currentStamp = 1;
+    }
+    this->start = start;
+    this->goal = goal;
+    shortest = UINT_MAX;
+    selectActiveLandmarks(start, goal);
+
+    forwardQueue.clear();
+    backwardQueue.clear();
+    visit(start);
+    visit(goal);
+    forwardDist[start] = 0;
+    backwardDist[goal] = 0;
+    forwardQueue.emplace_back(potentials[start], start);
+    backwardQueue.emplace_back(-potentials[goal], goal);
+
+    // Both searches work on the same reduced costs, so the usual bidirectional Dijkstra stopping criterion applies to
+    // the (doubled) keys. Once either queue is empty, every path has been seen by the meeting test.
+    while (!forwardQueue.empty() && !backwardQueue.empty()) {
+        const long long forwardKey = forwardQueue.front().first;
+        const long long backwardKey = backwardQueue.front().first;
+        if (shortest != UINT_MAX && forwardKey + backwardKey >= 2 * static_cast<long long>(shortest)) {
+            break;
+        }
+
+        if (forwardKey <= backwardKey) {
+            settleNext(forwardQueue, forwardDist, backwardDist, false);
+        } else {
+            settleNext(backwardQueue, backwardDist, forwardDist, true);
+        }
+    }
+
+    return shortest >= UINT_MAX ? UINT_MAX : static_cast<unsigned int>(shortest);
+}
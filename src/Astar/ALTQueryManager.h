@@ -0,0 +1,115 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Czech Technical University in Prague
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. */
+
+/******************************************************************************
+* File:             ALTQueryManager.h
+*
+* Description:      Bidirectional A* distance queries guided by the landmark lower bounds
+*****************************************************************************/
+
+#ifndef SHORTEST_PATHS_ALTQUERYMANAGER_H
+#define SHORTEST_PATHS_ALTQUERYMANAGER_H
+
+#include <utility>
+#include <vector>
+#include "Landmarks.h"
+#include "../CH/Structures/QueryStatistics.h"
+#include "../GraphBuilding/Structures/Graph.h"
+
+/**
+ * Answers the distance queries using the bidirectional ALT algorithm. Both searches use the average potential
+ * '(pi_t(v) - pi_s(v)) / 2' from the Goldberg and Harrelson article, where 'pi_t(v)' is the landmark lower bound on
+ * the distance from 'v' to the goal and 'pi_s(v)' the lower bound on the distance from the start to 'v'. With this
+ * potential both searches see the same reduced edge costs, so the query is a bidirectional Dijkstra on the reduced
+ * graph and can stop as soon as the sum of the two smallest keys reaches the best distance found. The keys are kept
+ * doubled so that all the computations stay in integers.
+ *
+ * Only the few landmarks giving the best lower bound for the start and the goal are used by a query. The manager
+ * keeps all its working arrays between the queries and recognizes the stale values by a query stamp, so a query
+ * does not allocate anything and does not have to reset the nodes it visited. The graph and the landmarks are only
+ * read, so any number of managers (one for each thread) can share them.
+ */
+class ALTQueryManager {
+public:
+    /**
+     * The maximum number of landmarks used by a single query.
+     */
+    static constexpr unsigned int ACTIVE_LANDMARKS = 4;
+
+    /**
+     * A simple constructor.
+     *
+     * @param graph[in] The graph, it must outlive the manager.
+     * @param landmarks[in] The landmarks computed for the graph, they must outlive the manager.
+     */
+    ALTQueryManager(const Graph& graph, const Landmarks& landmarks);
+
+    /**
+     * Finds the shortest distance.
+     *
+     * @param start[in] The start node for the query.
+     * @param goal[in] The goal node for the query.
+     * @return Returns the shortest distance from start to goal or 'UINT_MAX' if goal is not reachable from start.
+     */
+    unsigned int findDistance(unsigned int start, unsigned int goal);
+
+    /**
+     * Enables or disables the collection of the search statistics. When enabled, the following queries add their
+     * counters to the given instance, which is not reset between the queries.
+     *
+     * @param queryStatistics[in] The instance the counters are added to, or nullptr to disable the collection.
+     */
+    void setStatistics(QueryStatistics* queryStatistics);
+
+private:
+    using QueueEntry = std::pair<long long, unsigned int>;
+
+    void selectActiveLandmarks(unsigned int start, unsigned int goal);
+
+    void visit(unsigned int node);
+
+    void settleNext(
+            std::vector<QueueEntry>& queue,
+            std::vector<dist_t>& distances,
+            const std::vector<dist_t>& otherDistances,
+            bool backward);
+
+    const Graph& graph;
+    const Landmarks& landmarks;
+    std::vector<std::pair<dist_t, unsigned int>> landmarkBounds;
+    std::vector<unsigned int> activeLandmarks;
+    unsigned int start;
+    unsigned int goal;
+    unsigned long long shortest;
+
+    std::vector<unsigned int> stamps;
+    unsigned int currentStamp;
+    std::vector<dist_t> forwardDist;
+    std::vector<dist_t> backwardDist;
+    std::vector<long long> potentials;
+    std::vector<QueueEntry> forwardQueue;
+    std::vector<QueueEntry> backwardQueue;
+    QueryStatistics* statistics;
+};
+
+#endif //SHORTEST_PATHS_ALTQUERYMANAGER_H
@@ -0,0 +1,408 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Czech Technical University in Prague
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. */
+
+/******************************************************************************
+* File:             Landmarks.cpp
+*****************************************************************************/
+
+#include <algorithm>
+#include <functional>
+#include <queue>
+#include <random>
+#include <stdexcept>
+#include <utility>
+#include "Landmarks.h"
+
+namespace {
+    /**
+     * The seed of the random roots used by the 'avoid' selection, fixed so that the selection is reproducible.
+     */
+    constexpr unsigned int AVOID_SEED = 42;
+
+    /**
+     * The number of random roots tried by the 'avoid' selection before it gives up and takes any node.
+     */
+    constexpr unsigned int AVOID_ATTEMPTS = 16;
+
+    template <class T>
+    void writeArray(std::ostream& output, const std::vector<T>& values) {
+        output.write(reinterpret_cast<const char*>(values.data()), static_cast<std::streamsize>(values.size() * sizeof(T)));
+    }
+
+    template <class T>
+    void readArray(std::istream& input, std::vector<T>& values, size_t size) {
+        values.resize(size);
+        input.read(reinterpret_cast<char*>(values.data()), static_cast<std::streamsize>(size * sizeof(T)));
+    }
+
+    /**
+     * Dijkstra search that only lowers the given distances, so that it can also extend a search from other sources.
+     * The nodes are appended to 'settled' in the order they are settled and the tree edges are stored in 'parents'
+     * if those are given.
+     */
+    void search(
+            const Graph& graph,
+            const unsigned int source,
+            const bool reversed,
+            std::vector<dist_t>& distances,
+            std::vector<unsigned int>* settled = nullptr,
+            std::vector<unsigned int>* parents = nullptr) {
+        using QueueEntry = std::pair<dist_t, unsigned int>;
+        std::priority_queue<QueueEntry, std::vector<QueueEntry>, std::greater<>> queue;
+        distances[source] = 0;
+        if (parents) {
+            (*parents)[source] = UINT_MAX;
+        }
+        queue.emplace(0, source);
+
+        while (!queue.empty()) {
+            const auto [distance, node] = queue.top();
+            queue.pop();
+            if (distance != distances[node]) {
+                continue;
+            }
+            if (settled) {
+                settled->push_back(node);
+            }
+
+            const auto& edges = reversed ? graph.incomingEdges(node) : graph.outgoingEdges(node);
+            for (const auto& [neighbour, weight] : edges) {
+                if (distance + weight < distances[neighbour]) {
+                    distances[neighbour] = distance + weight;
+                    if (parents) {
+                        (*parents)[neighbour] = node;
+                    }
+                    queue.emplace(distance + weight, neighbour);
+                }
+            }
+        }
+    }
+
+    /**
+     * Returns the node that is not a landmark yet with the largest distance, the unreachable nodes come first.
+     */
+    unsigned int farthestNode(const std::vector<dist_t>& distances, const std::vector<bool>& isLandmark) {
+        unsigned int farthest = UINT_MAX;
+        for (unsigned int node = 0; node < distances.size(); node++) {
+            if (!isLandmark[node] && (farthest == UINT_MAX || distances[node] > distances[farthest])) {
+                farthest = node;
+            }
+        }
+        return farthest;
+    }
+}
+
+//______________________________________________________________________________________________________________________
+Landmarks::Selection Landmarks::parseSelection(const std::string& name) {
+    if (name == "farthest") {
+        return Selection::FARTHEST;
+    }
+    if (name == "avoid") {
+        return Selection::AVOID;
+    }
+    throw std::invalid_argument("Unknown landmark selection '" + name + "', expected 'farthest' or 'avoid'.");
+}
+
+//______________________________________________________________________________________________________________________
+Landmarks Landmarks::select(const Graph& graph, const unsigned int count, const Selection selection) {
+    if (count == 0 || count > graph.nodes()) {
+        throw std::invalid_argument("The number of landmarks must be between 1 and the number of nodes.");
+    }
+
+    if (selection == Selection::AVOID) {
+        return selectAvoid(graph, count);
+    }
+    return compute(graph, selectFarthest(graph, count));
+}
+
+//______________________________________________________________________________________________________________________
+std::vector<unsigned int> Landmarks::selectFarthest(const Graph& graph, const unsigned int count) {
+    const unsigned int nodes = graph.nodes();
+    std::vector<bool> isLandmark(nodes, false);
+
+    // The first landmark is the node farthest from an arbitrary node, the next ones are the nodes farthest from all
+    // the landmarks so far. Each search only has to update the distances the new landmark improves.
+    std::vector<dist_t> distances(nodes, UINT_MAX);
+    search(graph, 0, false, distances);
+    std::vector<unsigned int> landmarkNodes{farthestNode(distances, isLandmark)};
+    isLandmark[landmarkNodes.back()] = true;
+
+    std::fill(distances.begin(), distances.end(), UINT_MAX);
+    while (landmarkNodes.size() < count) {
+        search(graph, landmarkNodes.back(), false, distances);
+        landmarkNodes.push_back(farthestNode(distances, isLandmark));
+        isLandmark[landmarkNodes.back()] = true;
+    }
+
+    return landmarkNodes;
+}
+
+//______________________________________________________________________________________________________________________
+Landmarks Landmarks::selectAvoid(const Graph& graph, const unsigned int count) {
+    const unsigned int nodes = graph.nodes();
+    std::mt19937 generator(AVOID_SEED);
+    std::uniform_int_distribution<unsigned int> randomNode(0, nodes - 1);
+
+    // The roots are drawn with the probability proportional to the squared distance from the nearest landmark, so
+    // that the new landmarks are placed where the current ones are far away (uniformly for the first landmark).
+    std::vector<double> rootWeights(nodes, 1.0);
+    std::vector<dist_t> nearestLandmark(nodes, UINT_MAX);
+
+    std::vector<unsigned int> landmarkNodes;
+    std::vector<std::vector<dist_t>> fromLandmarkColumns;
+    std::vector<std::vector<dist_t>> toLandmarkColumns;
+    std::vector<bool> isLandmark(nodes, false);
+
+    std::vector<dist_t> rootDistances(nodes);
+    std::vector<unsigned int> parents(nodes);
+    std::vector<unsigned int> settled;
+    std::vector<unsigned long long> sizes(nodes);
+    std::vector<bool> coveredSubtree(nodes);
+    std::vector<unsigned int> firstChild(nodes + 1);
+    std::vector<unsigned int> children;
+
+    while (landmarkNodes.size() < count) {
+        std::discrete_distribution<unsigned int> randomRoot(rootWeights.begin(), rootWeights.end());
+        unsigned int landmark = UINT_MAX;
+        for (unsigned int attempt = 0; attempt < AVOID_ATTEMPTS && landmark == UINT_MAX; attempt++) {
+            const unsigned int root = randomRoot(generator);
+            std::fill(rootDistances.begin(), rootDistances.end(), UINT_MAX);
+            settled.clear();
+            search(graph, root, false, rootDistances, &settled, &parents);
+
+            // The weight of a node is how much the current landmarks underestimate its distance from the root. The
+            // size of a node is the total weight of its subtree, or zero if the subtree already contains a landmark.
+            for (unsigned int node : settled) {
+                dist_t bound = 0;
+                for (unsigned int i = 0; i < landmarkNodes.size(); i++) {
+                    bound = std::max(bound, triangleBound(fromLandmarkColumns[i][root], fromLandmarkColumns[i][node],
+                                                          toLandmarkColumns[i][root], toLandmarkColumns[i][node]));
+                }
+                sizes[node] = rootDistances[node] - std::min(bound, rootDistances[node]);
+                coveredSubtree[node] = isLandmark[node];
+            }
+            std::fill(firstChild.begin(), firstChild.end(), 0);
+            for (auto it = settled.rbegin(); it != settled.rend(); ++it) {
+                const unsigned int parent = parents[*it];
+                if (coveredSubtree[*it]) {
+                    sizes[*it] = 0;
+                }
+                if (parent != UINT_MAX) {
+                    sizes[parent] += sizes[*it];
+                    coveredSubtree[parent] = coveredSubtree[parent] || coveredSubtree[*it];
+                    firstChild[parent + 1]++;
+                }
+            }
+            unsigned int largest = root;
+            for (unsigned int node : settled) {
+                if (sizes[node] > sizes[largest]) {
+                    largest = node;
+                }
+            }
+            if (sizes[largest] == 0) {
+                continue;
+            }
+
+            for (unsigned int node = 0; node < nodes; node++) {
+                firstChild[node + 1] += firstChild[node];
+            }
+            children.resize(firstChild[nodes]);
+            std::vector<unsigned int> position(firstChild.begin(), firstChild.end() - 1);
+            for (unsigned int node : settled) {
+                if (parents[node] != UINT_MAX) {
+                    children[position[parents[node]]++] = node;
+                }
+            }
+
+            // The subtree of the root contains all the previous landmarks, so the descent starts at the largest
+            // uncovered subtree and follows the largest child down to a leaf (or to a node whose children are all
+            // covered).
+            landmark = largest;
+            while (true) {
+                unsigned int next = UINT_MAX;
+                for (unsigned int i = firstChild[landmark]; i < firstChild[landmark + 1]; i++) {
+                    if (sizes[children[i]] > 0 && (next == UINT_MAX || sizes[children[i]] > sizes[next])) {
+                        next = children[i];
+                    }
+                }
+                if (next == UINT_MAX) {
+                    break;
+                }
+                landmark = next;
+            }
+        }
+
+        if (landmark == UINT_MAX) {
+            landmark = randomNode(generator);
+            while (isLandmark[landmark]) {
+                landmark = (landmark + 1) % nodes;
+            }
+        }
+
+        landmarkNodes.push_back(landmark);
+        isLandmark[landmark] = true;
+        fromLandmarkColumns.emplace_back(nodes, UINT_MAX);
+        toLandmarkColumns.emplace_back(nodes, UINT_MAX);
+        #pragma omp parallel for
+        for (int direction = 0; direction < 2; direction++) {
+            search(graph, landmark, direction == 1, direction == 1 ? toLandmarkColumns.back() : fromLandmarkColumns.back());
+        }
+
+        dist_t farthest = 0;
+        for (unsigned int node = 0; node < nodes; node++) {
+            nearestLandmark[node] = std::min(nearestLandmark[node], fromLandmarkColumns.back()[node]);
+            if (nearestLandmark[node] != UINT_MAX) {
+                farthest = std::max(farthest, nearestLandmark[node]);
+            }
+        }
+        // The nodes no landmark reaches are treated as the farthest ones.
+        for (unsigned int node = 0; node < nodes; node++) {
+            const double distance = nearestLandmark[node] == UINT_MAX ? farthest : nearestLandmark[node];
+            rootWeights[node] = distance * distance;
+        }
+    }
+
+    return fromColumns(landmarkNodes, fromLandmarkColumns, toLandmarkColumns);
+}
+
+//______________________________________________________________________________________________________________________
+Landmarks Landmarks::compute(const Graph& graph, const std::vector<unsigned int>& landmarkNodes) {
+    const auto count = static_cast<int>(landmarkNodes.size());
+    std::vector<std::vector<dist_t>> fromLandmarkColumns(landmarkNodes.size());
+    std::vector<std::vector<dist_t>> toLandmarkColumns(landmarkNodes.size());
+
+    #pragma omp parallel for schedule(dynamic)
+    for (int i = 0; i < 2 * count; i++) {
+        const bool reversed = i >= count;
+        std::vector<dist_t>& column = reversed ? toLandmarkColumns[i - count] : fromLandmarkColumns[i];
+        column.assign(graph.nodes(), UINT_MAX);
+        search(graph, landmarkNodes[reversed ? i - count : i], reversed, column);
+    }
+
+    return fromColumns(landmarkNodes, fromLandmarkColumns, toLandmarkColumns);
+}
+
+//______________________________________________________________________________________________________________________
+Landmarks Landmarks::fromColumns(
+        const std::vector<unsigned int>& landmarkNodes,
+        const std::vector<std::vector<dist_t>>& fromColumns,
+        const std::vector<std::vector<dist_t>>& toColumns) {
+    const size_t count = landmarkNodes.size();
+    const auto nodes = static_cast<int>(fromColumns.front().size());
+
+    Landmarks result;
+    result.landmarks = landmarkNodes;
+    result.fromLandmarkDistances.resize(nodes * count);
+    result.toLandmarkDistances.resize(nodes * count);
+    #pragma omp parallel for
+    for (int node = 0; node < nodes; node++) {
+        for (size_t i = 0; i < count; i++) {
+            result.fromLandmarkDistances[node * count + i] = fromColumns[i][node];
+            result.toLandmarkDistances[node * count + i] = toColumns[i][node];
+        }
+    }
+
+    return result;
+}
+
+//______________________________________________________________________________________________________________________
+void Landmarks::write(std::ostream& output, const Graph& graph) const {
+    static_assert(sizeof(dist_t) == sizeof(unsigned int), "The distances are stored as 32-bit values.");
+    if (graph.nodes() != nodes()) {
+        throw std::invalid_argument("The landmarks were computed for a different graph.");
+    }
+
+    std::vector<unsigned int> firstEdge(graph.nodes() + 1, 0);
+    std::vector<unsigned int> edgeTargets;
+    std::vector<dist_t> edgeWeights;
+    for (unsigned int node = 0; node < graph.nodes(); node++) {
+        for (const auto& [target, weight] : graph.outgoingEdges(node)) {
+            edgeTargets.push_back(target);
+            edgeWeights.push_back(weight);
+        }
+        firstEdge[node + 1] = static_cast<unsigned int>(edgeTargets.size());
+    }
+
+    const unsigned int nodesCnt = graph.nodes();
+    const unsigned int edgesCnt = firstEdge.back();
+    const unsigned int landmarksCnt = count();
+
+    output.write("ALT1", 4);
+    output.write(reinterpret_cast<const char*>(&nodesCnt), sizeof(nodesCnt));
+    output.write(reinterpret_cast<const char*>(&edgesCnt), sizeof(edgesCnt));
+    output.write(reinterpret_cast<const char*>(&landmarksCnt), sizeof(landmarksCnt));
+    writeArray(output, firstEdge);
+    writeArray(output, edgeTargets);
+    writeArray(output, edgeWeights);
+    writeArray(output, landmarks);
+    writeArray(output, fromLandmarkDistances);
+    writeArray(output, toLandmarkDistances);
+}
+
+//______________________________________________________________________________________________________________________
+Landmarks Landmarks::read(std::istream& input, std::unique_ptr<Graph>& graph) {
+    char header[4];
+    input.read(header, sizeof(header));
+    if (!input || header[0] != 'A' || header[1] != 'L' || header[2] != 'T' || header[3] != '1') {
+        throw std::runtime_error("The input file is missing the ALT landmarks header.");
+    }
+
+    unsigned int nodesCnt;
+    unsigned int edgesCnt;
+    unsigned int landmarksCnt;
+    input.read(reinterpret_cast<char*>(&nodesCnt), sizeof(nodesCnt));
+    input.read(reinterpret_cast<char*>(&edgesCnt), sizeof(edgesCnt));
+    input.read(reinterpret_cast<char*>(&landmarksCnt), sizeof(landmarksCnt));
+    if (!input || nodesCnt == 0 || landmarksCnt == 0 || landmarksCnt > nodesCnt) {
+        throw std::runtime_error("The ALT landmarks header is corrupted.");
+    }
+
+    std::vector<unsigned int> firstEdge;
+    std::vector<unsigned int> edgeTargets;
+    std::vector<dist_t> edgeWeights;
+    Landmarks result;
+    readArray(input, firstEdge, static_cast<size_t>(nodesCnt) + 1);
+    readArray(input, edgeTargets, edgesCnt);
+    readArray(input, edgeWeights, edgesCnt);
+    readArray(input, result.landmarks, landmarksCnt);
+    readArray(input, result.fromLandmarkDistances, static_cast<size_t>(nodesCnt) * landmarksCnt);
+    readArray(input, result.toLandmarkDistances, static_cast<size_t>(nodesCnt) * landmarksCnt);
+    if (!input) {
+        throw std::runtime_error("The ALT landmarks file is truncated.");
+    }
+
+    graph = std::make_unique<Graph>(nodesCnt);
+    for (unsigned int node = 0; node < nodesCnt; node++) {
+        if (firstEdge[node] > firstEdge[node + 1] || firstEdge[node + 1] > edgesCnt) {
+            throw std::runtime_error("The ALT landmarks file is corrupted.");
+        }
+        for (unsigned int edge = firstEdge[node]; edge < firstEdge[node + 1]; edge++) {
+            if (edgeTargets[edge] >= nodesCnt) {
+                throw std::runtime_error("The ALT landmarks file is corrupted.");
+            }
+            graph->addEdge(node, edgeTargets[edge], edgeWeights[edge]);
+        }
+    }
+
+    return result;
+}
@@ -0,0 +1,211 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Czech Technical University in Prague
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. */
+
+/******************************************************************************
+* File:             Landmarks.h
+*
+* Description:      Landmark distances used as the lower bounds by the ALT queries
+*****************************************************************************/
+
+#ifndef SHORTEST_PATHS_LANDMARKS_H
+#define SHORTEST_PATHS_LANDMARKS_H
+
+#include <climits>
+#include <istream>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <vector>
+#include "../constants.h"
+#include "../GraphBuilding/Structures/Graph.h"
+
+/**
+ * The precomputed part of the ALT algorithm (A*, Landmarks and the Triangle inequality) described in the "Computing
+ * the Shortest Path: A* Search Meets Graph Theory" article by Andrew V. Goldberg and Chris Harrelson. For a small set
+ * of landmark nodes, the distances from every landmark to every node and from every node to every landmark are
+ * stored. By the triangle inequality, 'd(l, t) - d(l, v)' and 'd(v, l) - d(t, l)' are then lower bounds on the
+ * distance from 'v' to 't' for any landmark 'l'.
+ *
+ * The distances are stored node by node (all the landmark distances of a node are next to each other), because the
+ * queries need the distances of one node to all the (active) landmarks at once. Unreachable pairs are stored as
+ * 'UINT_MAX'.
+ */
+class Landmarks {
+public:
+    /**
+     * The strategies for choosing the landmark nodes.
+     */
+    enum class Selection {
+        /**
+         * Each landmark is the node farthest from all the previously selected landmarks.
+         */
+        FARTHEST,
+
+        /**
+         * The 'avoid' heuristic from the Goldberg and Harrelson article: each landmark is placed at the end of the
+         * part of a shortest path tree that is worst covered by the previously selected landmarks.
+         */
+        AVOID
+    };
+
+    /**
+     * Parses the name of a selection strategy.
+     *
+     * @param name[in] Either 'farthest' or 'avoid'.
+     * @return The strategy.
+     */
+    static Selection parseSelection(const std::string& name);
+
+    /**
+     * Creates an empty instance without any landmarks.
+     */
+    Landmarks() = default;
+
+    /**
+     * Selects the landmarks using the given strategy and computes their distances.
+     *
+     * @param graph[in] The graph.
+     * @param count[in] The number of landmarks, at most the number of nodes.
+     * @param selection[in] The selection strategy.
+     * @return The landmarks with all their distances.
+     */
+    static Landmarks select(const Graph& graph, unsigned int count, Selection selection);
+
+    /**
+     * Computes the distances for the given landmark nodes. The Dijkstra searches of all the landmarks (one in each
+     * direction) run in parallel.
+     *
+     * @param graph[in] The graph.
+     * @param landmarkNodes[in] The landmark nodes.
+     * @return The landmarks with all their distances.
+     */
+    static Landmarks compute(const Graph& graph, const std::vector<unsigned int>& landmarkNodes);
+
+    /**
+     * @return The number of landmarks.
+     */
+    unsigned int count() const {
+        return static_cast<unsigned int>(landmarks.size());
+    }
+
+    /**
+     * @return The number of nodes of the graph the landmarks were computed for.
+     */
+    unsigned int nodes() const {
+        return landmarks.empty() ? 0 : static_cast<unsigned int>(fromLandmarkDistances.size() / landmarks.size());
+    }
+
+    /**
+     * @return The landmark nodes.
+     */
+    const std::vector<unsigned int>& landmarkNodes() const {
+        return landmarks;
+    }
+
+    /**
+     * @param node[in] A node.
+     * @param landmark[in] The index of the landmark (not its node).
+     * @return The distance from the landmark to the node or 'UINT_MAX' if the node is not reachable from it.
+     */
+    dist_t fromLandmark(unsigned int node, unsigned int landmark) const {
+        return fromLandmarkDistances[static_cast<size_t>(node) * landmarks.size() + landmark];
+    }
+
+    /**
+     * @param node[in] A node.
+     * @param landmark[in] The index of the landmark (not its node).
+     * @return The distance from the node to the landmark or 'UINT_MAX' if the landmark is not reachable from it.
+     */
+    dist_t toLandmark(unsigned int node, unsigned int landmark) const {
+        return toLandmarkDistances[static_cast<size_t>(node) * landmarks.size() + landmark];
+    }
+
+    /**
+     * Computes the lower bound on the distance between two nodes provided by a single landmark.
+     *
+     * @param from[in] The source node.
+     * @param to[in] The target node.
+     * @param landmark[in] The index of the landmark.
+     * @return The lower bound, zero if the landmark cannot tell anything about the pair.
+     */
+    dist_t lowerBound(unsigned int from, unsigned int to, unsigned int landmark) const {
+        return triangleBound(fromLandmark(from, landmark), fromLandmark(to, landmark), toLandmark(from, landmark),
+                             toLandmark(to, landmark));
+    }
+
+    /**
+     * Computes the lower bound on the distance from 's' to 't' given their distances to and from a landmark 'l'.
+     *
+     * @param fromLandmarkToS[in] The distance 'd(l, s)'.
+     * @param fromLandmarkToT[in] The distance 'd(l, t)'.
+     * @param fromSToLandmark[in] The distance 'd(s, l)'.
+     * @param fromTToLandmark[in] The distance 'd(t, l)'.
+     * @return The lower bound, the terms with unknown ('UINT_MAX') distances are skipped.
+     */
+    static dist_t triangleBound(dist_t fromLandmarkToS, dist_t fromLandmarkToT, dist_t fromSToLandmark,
+                                dist_t fromTToLandmark) {
+        dist_t bound = 0;
+        if (fromLandmarkToT != UINT_MAX && fromLandmarkToS < fromLandmarkToT) {
+            bound = fromLandmarkToT - fromLandmarkToS;
+        }
+        if (fromSToLandmark != UINT_MAX && fromTToLandmark < fromSToLandmark
+                && fromSToLandmark - fromTToLandmark > bound) {
+            bound = fromSToLandmark - fromTToLandmark;
+        }
+        return bound;
+    }
+
+    /**
+     * Writes the graph together with the landmarks in the binary format loaded by 'read'. The graph is stored too,
+     * so that the file is all the ALT queries need.
+     *
+     * @param output[in] The binary output stream.
+     * @param graph[in] The graph the landmarks were computed for.
+     */
+    void write(std::ostream& output, const Graph& graph) const;
+
+    /**
+     * Reads the graph and the landmarks written by 'write'.
+     *
+     * @param input[in] The binary input stream.
+     * @param graph[out] The loaded graph.
+     * @return The landmarks.
+     */
+    static Landmarks read(std::istream& input, std::unique_ptr<Graph>& graph);
+
+private:
+    static std::vector<unsigned int> selectFarthest(const Graph& graph, unsigned int count);
+
+    static Landmarks selectAvoid(const Graph& graph, unsigned int count);
+
+    static Landmarks fromColumns(
+            const std::vector<unsigned int>& landmarkNodes,
+            const std::vector<std::vector<dist_t>>& fromColumns,
+            const std::vector<std::vector<dist_t>>& toColumns);
+
+    std::vector<unsigned int> landmarks;
+    std::vector<dist_t> fromLandmarkDistances;
+    std::vector<dist_t> toLandmarkDistances;
+};
+
+#endif //SHORTEST_PATHS_LANDMARKS_H
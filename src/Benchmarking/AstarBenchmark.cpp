@@ -28,11 +28,12 @@
 
 #include <string>
 #include <iostream>
+#include "../Astar/ALTQueryManager.h"
 #include "../Astar/Astar.h"
 #include "../Timer/Timer.h"
 #include "AstarBenchmark.h"
 #include "../GraphBuilding/Loaders/CsvGraphLoader.h"
-#include "../GraphBuilding/Loaders/XenGraphLoader.h"
+#include "../GraphBuilding/Loaders/NodeMappingLoader.h"
 
 //______________________________________________________________________________________________________________________
 double AstarBenchmark::benchmark(const std::vector < std::pair< unsigned int, unsigned int> > & trips, const Graph & graph, const std::vector<std::pair<double, double>>& locations, std::vector < unsigned int > & distances) {
@@ -49,17 +50,48 @@ double AstarBenchmark::benchmark(const std::vector < std::pair< unsigned int, un
 
 //______________________________________________________________________________________________________________________
 double AstarBenchmark::benchmarkUsingMapping(const std::vector < std::pair< long long unsigned int, long long unsigned int> > & trips, const Graph & graph, const std::vector<std::pair<double, double>>& locations, std::vector < unsigned int > & distances, std::string mappingFilePath) {
-    XenGraphLoader mappingLoader(mappingFilePath);
-    std::unordered_map<long long unsigned int, unsigned int> mapping;
-    mappingLoader.loadNodesMapping(mapping);
+    NodeMappingLoader mappingLoader(mappingFilePath);
+    NodeMapping mapping = mappingLoader.loadMapping();
 
     Timer aStarTimer("Astar trips benchmark");
     aStarTimer.begin();
 
     for(size_t i = 0; i < trips.size(); i++) {
-        distances[i] = Astar::run(mapping.at(trips.at(i).first), mapping.at(trips.at(i).second), graph, locations);
+        distances[i] = Astar::run(mapping.internalID(trips.at(i).first), mapping.internalID(trips.at(i).second), graph, locations);
     }
 
     aStarTimer.finish();
     return aStarTimer.getRealTimeSeconds();
 }
+
+//______________________________________________________________________________________________________________________
+double AstarBenchmark::benchmarkALT(const std::vector < std::pair< unsigned int, unsigned int> > & trips, const Graph & graph, const Landmarks & landmarks, std::vector < unsigned int > & distances) {
+    ALTQueryManager queryManager(graph, landmarks);
+
+    Timer altTimer("ALT trips benchmark");
+    altTimer.begin();
+
+    for(size_t i = 0; i < trips.size(); i++) {
+        distances[i] = queryManager.findDistance(trips.at(i).first, trips.at(i).second);
+    }
+
+    altTimer.finish();
+    return altTimer.getRealTimeSeconds();
+}
+
+//______________________________________________________________________________________________________________________
+double AstarBenchmark::benchmarkALTUsingMapping(const std::vector < std::pair< long long unsigned int, long long unsigned int> > & trips, const Graph & graph, const Landmarks & landmarks, std::vector < unsigned int > & distances, const std::string& mappingFilePath) {
+    NodeMappingLoader mappingLoader(mappingFilePath);
+    NodeMapping mapping = mappingLoader.loadMapping();
+    ALTQueryManager queryManager(graph, landmarks);
+
+    Timer altTimer("ALT trips benchmark");
+    altTimer.begin();
+
+    for(size_t i = 0; i < trips.size(); i++) {
+        distances[i] = queryManager.findDistance(mapping.internalID(trips.at(i).first), mapping.internalID(trips.at(i).second));
+    }
+
+    altTimer.finish();
+    return altTimer.getRealTimeSeconds();
+}
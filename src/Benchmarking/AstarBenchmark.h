@@ -29,7 +29,9 @@
 #ifndef ASTARBENCHMARK_H
 #define ASTARBENCHMARK_H
 
+#include <string>
 #include <vector>
+#include "../Astar/Landmarks.h"
 #include "../GraphBuilding/Structures/Graph.h"
 
 /**
@@ -77,6 +79,41 @@ public:
             const std::vector<std::pair<double, double>>& locations,
             std::vector < unsigned int > & distances,
             std::string mappingFilePath);
+
+    /**
+     * Runs the bidirectional ALT (landmark) A* Algorithm on a set of queries (trips). One query manager is created
+     * before the time measurement starts and reused for all the queries. Returns the cumulative time the queries took
+     * in seconds.
+     *
+     * @param trips[in] The set of queries (trips) that will be used for the benchmark.
+     * @param graph[in] The graph that will be used for the benchmark.
+     * @param landmarks[in] The landmarks computed for the graph.
+     * @param distances[out] The std::vector that the results of the queries will be saved into.
+     * @return Returns the cumulative time required to answer all the queries in seconds.
+     */
+    static double benchmarkALT(
+            const std::vector < std::pair< unsigned int, unsigned int> > & trips,
+            const Graph & graph,
+            const Landmarks & landmarks,
+            std::vector < unsigned int > & distances);
+
+    /**
+     * Runs the bidirectional ALT (landmark) A* Algorithm on a set of queries (trips) using the original node IDs.
+     * Returns the cumulative time the queries took in seconds.
+     *
+     * @param trips[in] The set of queries (trips) that will be used for the benchmark.
+     * @param graph[in] The graph that will be used for the benchmark.
+     * @param landmarks[in] The landmarks computed for the graph.
+     * @param distances[out] The std::vector that the results of the queries will be saved into.
+     * @param mappingFilePath[in] The path to the mapping file.
+     * @return Returns the cumulative time required to answer all the queries in seconds.
+     */
+    static double benchmarkALTUsingMapping(
+            const std::vector < std::pair< long long unsigned int, long long unsigned int> > & trips,
+            const Graph & graph,
+            const Landmarks & landmarks,
+            std::vector < unsigned int > & distances,
+            const std::string& mappingFilePath);
 };
 
 
@@ -0,0 +1,81 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Czech Technical University in Prague
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. */
+
+/******************************************************************************
+* File:             CCHBenchmark.h
+*
+* Description:      Benchmark of the Customizable Contraction Hierarchies queries
+*****************************************************************************/
+
+#ifndef SHORTEST_PATHS_CCHBENCHMARK_H
+#define SHORTEST_PATHS_CCHBENCHMARK_H
+
+#include <memory>
+#include <string>
+#include <vector>
+#include "../CCH/Structures/CCHMetric.h"
+#include "../CCH/Structures/CCHTopology.h"
+
+/**
+ * This class is responsible for running a Customizable Contraction Hierarchies benchmark and outputing the time.
+ * It mirrors 'CHBenchmark', only the customization has to be done by the caller, so that the query time is measured
+ * separately from the customization time.
+ */
+class CCHBenchmark {
+public:
+    /**
+     * Runs the given set of queries, records the time required for those queries, and puts the results
+     * inside the provided std::vector. Returns the time it took to answer all queries in seconds.
+     *
+     * @param trips[in] The set of queries (trips) that will be used for the benchmark.
+     * @param topology[in] The topology of the Customizable Contraction Hierarchy.
+     * @param metric[in] The customized metric.
+     * @param distances[out] The std::vector that the results of the queries will be saved into.
+     * @return Returns the cumulative time required to answer all the queries in seconds.
+     */
+    static double benchmark(
+            const std::vector < std::pair< unsigned int, unsigned int> > & trips,
+            const CCHTopology& topology,
+            std::shared_ptr<const CCHMetric> metric,
+            std::vector < unsigned int > & distances);
+
+    /**
+     * Runs the given set of queries using the original node IDs, records the time required for those queries,
+     * and puts the results inside the provided std::vector. Returns the time it took to answer all queries in seconds.
+     *
+     * @param trips[in] The set of queries (trips) that will be used for the benchmark.
+     * @param topology[in] The topology of the Customizable Contraction Hierarchy.
+     * @param metric[in] The customized metric.
+     * @param distances[out] The std::vector that the results of the queries will be saved into.
+     * @param mappingFilePath[in] The path to the mapping file.
+     * @return Returns the cumulative time required to answer all the queries in seconds.
+     */
+    static double benchmarkUsingMapping(
+            const std::vector < std::pair< long long unsigned int, long long unsigned int> > & trips,
+            const CCHTopology& topology,
+            std::shared_ptr<const CCHMetric> metric,
+            std::vector < unsigned int > & distances,
+            const std::string& mappingFilePath);
+};
+
+#endif //SHORTEST_PATHS_CCHBENCHMARK_H
@@ -30,6 +30,7 @@
 #include "../CH/CHDistanceQueryManager.h"
 #include "../Timer/Timer.h"
 #include "../CH/CHDistanceQueryManagerWithMapping.h"
+#include "../GraphBuilding/Loaders/NodeMappingLoader.h"
 
 //______________________________________________________________________________________________________________________
 double CHBenchmark::benchmark(const std::vector < std::pair< unsigned int, unsigned int> > & trips, FlagsGraph<NodeData>& graph, std::vector < unsigned int > & distances) {
@@ -60,3 +61,35 @@ double CHBenchmark::benchmarkUsingMapping(const std::vector < std::pair< long lo
     chTimer.finish();
     return chTimer.getRealTimeSeconds();
 }
+
+//______________________________________________________________________________________________________________________
+double CHBenchmark::benchmark(const std::vector < std::pair< unsigned int, unsigned int> > & trips, CompressedFlagsGraph& graph, std::vector < unsigned int > & distances) {
+    CHDistanceQueryManager queryManager(graph);
+
+    Timer chTimer("Contraction hierarchies trips benchmark with the compressed graph");
+    chTimer.begin();
+
+    for(size_t i = 0; i < trips.size(); i++) {
+        distances[i] = queryManager.findDistance(trips.at(i).first, trips.at(i).second);
+    }
+
+    chTimer.finish();
+    return chTimer.getRealTimeSeconds();
+}
+
+//______________________________________________________________________________________________________________________
+double CHBenchmark::benchmarkUsingMapping(const std::vector < std::pair< long long unsigned int, long long unsigned int> > & trips, CompressedFlagsGraph& graph, std::vector < unsigned int > & distances, std::string mappingFilePath) {
+    CHDistanceQueryManager queryManager(graph);
+    NodeMappingLoader mappingLoader(mappingFilePath);
+    const NodeMapping mapping = mappingLoader.loadMapping();
+
+    Timer chTimer("Contraction hierarchies trips benchmark with the compressed graph and mapping");
+    chTimer.begin();
+
+    for(size_t i = 0; i < trips.size(); i++) {
+        distances[i] = queryManager.findDistance(mapping.internalID(trips.at(i).first), mapping.internalID(trips.at(i).second));
+    }
+
+    chTimer.finish();
+    return chTimer.getRealTimeSeconds();
+}
@@ -29,6 +29,7 @@
 #ifndef TRANSIT_NODE_ROUTING_CHBENCHMARKWITHRANKS_H
 #define TRANSIT_NODE_ROUTING_CHBENCHMARKWITHRANKS_H
 
+#include "../GraphBuilding/Structures/CompressedFlagsGraph.h"
 #include "../GraphBuilding/Structures/FlagsGraph.h"
 #include "../GraphBuilding/Structures/Graph.h"
 
@@ -75,6 +76,35 @@ public:
             FlagsGraph<NodeData> & graph,
             std::vector < unsigned int > & distances,
             std::string mappingFilePath);
+
+    /**
+     * The same as the 'benchmark' function above, but the queries are answered using the compressed query graph.
+     *
+     * @param trips[in] The set of queries (trips) that will be used for the benchmark.
+     * @param graph[in] The compressed Contraction Hierarchies data structure that will be used for the benchmark.
+     * @param distances[out] The std::vector that the results of the queries will be saved into.
+     * @return Returns the cumulative time required to answer all the queries in seconds.
+     */
+    static double benchmark(
+            const std::vector < std::pair< unsigned int, unsigned int> > & trips,
+            CompressedFlagsGraph& graph,
+            std::vector < unsigned int > & distances);
+
+    /**
+     * The same as the 'benchmarkUsingMapping' function above, but the queries are answered using the compressed query
+     * graph.
+     *
+     * @param trips[in] The set of queries (trips) that will be used for the benchmark.
+     * @param graph[in] The compressed Contraction Hierarchies data structure that will be used for the benchmark.
+     * @param distances[out] The std::vector that the results of the queries will be saved into.
+     * @param mappingFilePath[in] The path to the mapping file.
+     * @return Returns the cumulative time required to answer all the queries in seconds.
+     */
+    static double benchmarkUsingMapping(
+            const std::vector < std::pair< long long unsigned int, long long unsigned int> > & trips,
+            CompressedFlagsGraph& graph,
+            std::vector < unsigned int > & distances,
+            std::string mappingFilePath);
 };
 
 
@@ -53,3 +53,27 @@ bool CorrectnessValidator::validateVerbose(std::vector<dist_t> &a, std::vector<d
     //std::cout << "Validated returned distances, std::vectors are similar." << std::endl;
     return true;
 }
+
+//______________________________________________________________________________________________________________________
+size_t CorrectnessValidator::validateAgainstDijkstra(const std::vector<std::pair<unsigned int, unsigned int>> &trips, const std::vector<dist_t> &distances, const Graph &graph, DijkstraEngine::Heap heap) {
+    std::vector<dist_t> reference(trips.size());
+    #pragma omp parallel
+    {
+        DijkstraEngine engine(graph, heap);
+        #pragma omp for schedule(dynamic, 64)
+        for(long long i = 0; i < static_cast<long long>(trips.size()); i++) {
+            reference[i] = engine.runBidirectional(trips[i].first, trips[i].second);
+        }
+    }
+
+    size_t mmcnt = 0;
+    for(size_t i = 0; i < trips.size(); i++) {
+        if (distances.at(i) != reference[i]) {
+            std::cout << "Found mismatch at trip " << i << " (" << trips[i].first << " -> " << trips[i].second << "): ";
+            std::cout << "the distance is " << distances.at(i) << ", while Dijkstra returned " << reference[i] << '.' << std::endl;
+            mmcnt++;
+        }
+    }
+    std::cout << "Mismatches: " << mmcnt << std::endl;
+    return mmcnt;
+}
@@ -29,8 +29,11 @@
 #ifndef TRANSIT_NODE_ROUTING_CORECTNESSVALIDATOR_H
 #define TRANSIT_NODE_ROUTING_CORECTNESSVALIDATOR_H
 
+#include <utility>
 #include <vector>
 #include "../constants.h"
+#include "../Dijkstra/DijkstraEngine.h"
+#include "../GraphBuilding/Structures/Graph.h"
 
 
 
@@ -65,6 +68,24 @@ public:
      */
     static bool validateVerbose(std::vector<dist_t> &a, std::vector<dist_t> &b);
 
+    /**
+     * Computes the reference distances for the given trips using the bidirectional Dijkstra's algorithm and compares
+     * them with the distances computed by some other method. The reference queries are answered in parallel, every
+     * thread has its own 'DijkstraEngine'. Prints out the mismatches along with both values and the number of
+     * mismatches at the end.
+     *
+     * @param trips[in] The queries (using the internal node IDs) the distances were computed for.
+     * @param distances[in] The distances to validate, one for each trip.
+     * @param graph[in] The original graph.
+     * @param heap[in] The priority queue used by the Dijkstra's algorithm.
+     * @return The number of mismatches.
+     */
+    static size_t validateAgainstDijkstra(
+            const std::vector<std::pair<unsigned int, unsigned int>> &trips,
+            const std::vector<dist_t> &distances,
+            const Graph &graph,
+            DijkstraEngine::Heap heap = DijkstraEngine::Heap::RADIX);
+
 private:
 };
 
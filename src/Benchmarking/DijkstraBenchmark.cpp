@@ -27,18 +27,21 @@
 //
 
 #include <string>
-#include "../Dijkstra/BasicDijkstra.h"
 #include "../Timer/Timer.h"
 #include "DijkstraBenchmark.h"
-#include "../GraphBuilding/Loaders/XenGraphLoader.h"
+#include "../GraphBuilding/Loaders/NodeMappingLoader.h"
 
 //______________________________________________________________________________________________________________________
-double DijkstraBenchmark::benchmark(const std::vector < std::pair< unsigned int, unsigned int> > & trips, const Graph & graph, std::vector < unsigned int > & distances) {
+double DijkstraBenchmark::benchmark(const std::vector < std::pair< unsigned int, unsigned int> > & trips, const Graph & graph, std::vector < unsigned int > & distances, DijkstraEngine::Heap heap, bool bidirectional) {
+    DijkstraEngine engine(graph, heap);
+
     Timer dijkstraTimer("Dijkstra trips benchmark");
     dijkstraTimer.begin();
 
     for(size_t i = 0; i < trips.size(); i++) {
-        distances[i] = BasicDijkstra::run(trips.at(i).first, trips.at(i).second, graph);
+        const unsigned int start = trips.at(i).first;
+        const unsigned int goal = trips.at(i).second;
+        distances[i] = bidirectional ? engine.runBidirectional(start, goal) : engine.run(start, goal);
     }
 
     dijkstraTimer.finish();
@@ -46,16 +49,18 @@ double DijkstraBenchmark::benchmark(const std::vector < std::pair< unsigned int,
 }
 
 //______________________________________________________________________________________________________________________
-double DijkstraBenchmark::benchmarkUsingMapping(const std::vector < std::pair< long long unsigned int, long long unsigned int> > & trips, const Graph & graph, std::vector < unsigned int > & distances, std::string mappingFilePath) {
-    XenGraphLoader mappingLoader(mappingFilePath);
-    std::unordered_map<long long unsigned int, unsigned int> mapping;
-    mappingLoader.loadNodesMapping(mapping);
+double DijkstraBenchmark::benchmarkUsingMapping(const std::vector < std::pair< long long unsigned int, long long unsigned int> > & trips, const Graph & graph, std::vector < unsigned int > & distances, std::string mappingFilePath, DijkstraEngine::Heap heap, bool bidirectional) {
+    NodeMappingLoader mappingLoader(mappingFilePath);
+    NodeMapping mapping = mappingLoader.loadMapping();
+    DijkstraEngine engine(graph, heap);
 
     Timer dijkstraTimer("Dijkstra trips benchmark");
     dijkstraTimer.begin();
 
     for(size_t i = 0; i < trips.size(); i++) {
-        distances[i] = BasicDijkstra::run(mapping.at(trips.at(i).first), mapping.at(trips.at(i).second), graph);
+        const unsigned int start = mapping.internalID(trips.at(i).first);
+        const unsigned int goal = mapping.internalID(trips.at(i).second);
+        distances[i] = bidirectional ? engine.runBidirectional(start, goal) : engine.run(start, goal);
     }
 
     dijkstraTimer.finish();
@@ -29,7 +29,9 @@
 #ifndef TRANSIT_NODE_ROUTING_DIJKSTRABENCHMARK_H
 #define TRANSIT_NODE_ROUTING_DIJKSTRABENCHMARK_H
 
+#include <string>
 #include <vector>
+#include "../Dijkstra/DijkstraEngine.h"
 #include "../GraphBuilding/Structures/Graph.h"
 
 
@@ -41,23 +43,28 @@
 class DijkstraBenchmark {
 public:
     /**
-     * Runs the basic Dijkstra's Algorithm on a set set of queries (trips).
+     * Runs the Dijkstra's Algorithm on a set set of queries (trips).
      * Returns the cumulative time the queries took in seconds. Additionally stores the returned distances
-     * into a std::vector so that their correctness can be later verified.
+     * into a std::vector so that their correctness can be later verified. The queries are answered by one
+     * 'DijkstraEngine' created before the time measurement starts.
      *
      * @param trips[in] The set of queries (trips) that will be used for the benchmark.
      * @param graph[in] The graph that will be used for the benchmark.
      * @param distances[out] The std::vector that the results of the queries will be saved into. The values in the std::vector
      * can then be used to verify that the returned distances were correct.
+     * @param heap[in] The priority queue used by the engine.
+     * @param bidirectional[in] Whether the bidirectional search should be used.
      * @return Returns the cumulative time required to answer all the queries in seconds.
      */
     static double benchmark(
             const std::vector < std::pair< unsigned int, unsigned int> > & trips,
             const Graph & graph,
-            std::vector < unsigned int > & distances);
+            std::vector < unsigned int > & distances,
+            DijkstraEngine::Heap heap = DijkstraEngine::Heap::RADIX,
+            bool bidirectional = false);
 
     /**
-     * Runs the basic Dijkstra's Algorithm on a set set of queries (trips).
+     * Runs the Dijkstra's Algorithm on a set set of queries (trips).
      * Returns the cumulative time the queries took in seconds. Additionally stores the returned distances
      * into a std::vector so that their correctness can be later verified. This variants allows us to query using
      * the IDs in the original graph, because we can provide a mapping from the original IDs to IDs used
@@ -68,13 +75,17 @@ public:
      * @param distances[out] The std::vector that the results of the queries will be saved into. The values in the std::vector
      * can then be used to verify that the returned distances were correct.
      * @param mappingFilePath[in] The path to the mapping file.
+     * @param heap[in] The priority queue used by the engine.
+     * @param bidirectional[in] Whether the bidirectional search should be used.
      * @return Returns the cumulative time required to answer all the queries in seconds.
      */
     static double benchmarkUsingMapping(
             const std::vector < std::pair< long long unsigned int, long long unsigned int> > & trips,
             const Graph & graph,
             std::vector < unsigned int > & distances,
-            std::string mappingFilePath);
+            std::string mappingFilePath,
+            DijkstraEngine::Heap heap = DijkstraEngine::Heap::RADIX,
+            bool bidirectional = false);
 };
 
 
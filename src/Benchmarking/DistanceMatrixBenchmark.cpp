@@ -26,9 +26,11 @@
 // Created on: 05.10.19
 //
 
+#include <algorithm>
+#include <numeric>
 #include "DistanceMatrixBenchmark.h"
 #include "../Timer/Timer.h"
-#include "../GraphBuilding/Loaders/XenGraphLoader.h"
+#include "../GraphBuilding/Loaders/NodeMappingLoader.h"
 
 //______________________________________________________________________________________________________________________
 double DistanceMatrixBenchmark::benchmark(const std::vector < std::pair< unsigned int, unsigned int> > & trips, DistanceMatrixInterface& matrix, std::vector <dist_t> & distances) {
@@ -45,17 +47,46 @@ double DistanceMatrixBenchmark::benchmark(const std::vector < std::pair< unsigne
 
 //______________________________________________________________________________________________________________________
 double DistanceMatrixBenchmark::benchmarkUsingMapping(const std::vector < std::pair< long long unsigned int, long long unsigned int> > & trips, DistanceMatrixInterface& matrix, std::vector <dist_t> & distances, std::string mappingFilePath) {
-    XenGraphLoader mappingLoader(mappingFilePath);
-    std::unordered_map<long long unsigned int, unsigned int> mapping;
-    mappingLoader.loadNodesMapping(mapping);
+    NodeMappingLoader mappingLoader(mappingFilePath);
+    NodeMapping mapping = mappingLoader.loadMapping();
     
     Timer dijkstraTimer("Distance Matrix trips benchmark");
     dijkstraTimer.begin();
 
     for(size_t i = 0; i < trips.size(); i++) {
-        distances[i] = matrix.findDistance(mapping.at(trips.at(i).first), mapping.at(trips.at(i).second));
+        distances[i] = matrix.findDistance(mapping.internalID(trips.at(i).first), mapping.internalID(trips.at(i).second));
     }
 
     dijkstraTimer.finish();
     return dijkstraTimer.getRealTimeSeconds();
 }
+
+//______________________________________________________________________________________________________________________
+double DistanceMatrixBenchmark::benchmarkRowLocal(const std::vector < std::pair< unsigned int, unsigned int> > & trips, DistanceMatrixInterface& matrix, std::vector <dist_t> & distances) {
+    std::vector<size_t> order(trips.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&trips](size_t a, size_t b) {
+        return trips[a].first < trips[b].first;
+    });
+
+    Timer dijkstraTimer("Distance Matrix row-local trips benchmark");
+    dijkstraTimer.begin();
+
+    for(const size_t i : order) {
+        distances[i] = matrix.findDistance(trips[i].first, trips[i].second);
+    }
+
+    dijkstraTimer.finish();
+    return dijkstraTimer.getRealTimeSeconds();
+}
+
+//______________________________________________________________________________________________________________________
+double DistanceMatrixBenchmark::benchmarkBatch(const std::vector < std::pair< unsigned int, unsigned int> > & trips, DistanceMatrixInterface& matrix, std::vector <dist_t> & distances) {
+    Timer dijkstraTimer("Distance Matrix batch trips benchmark");
+    dijkstraTimer.begin();
+
+    matrix.findDistances(trips, distances);
+
+    dijkstraTimer.finish();
+    return dijkstraTimer.getRealTimeSeconds();
+}
@@ -77,6 +77,34 @@ public:
             DistanceMatrixInterface& matrix,
             std::vector < dist_t > & distances,
             std::string mappingFilePath);
+
+    /**
+     * Same as 'benchmark', but the queries are answered in the order of their start nodes. This simulates a
+     * row-local access pattern (for example all distances from a set of origins), which is the favourable case for
+     * the paged distance matrix. The results are still stored at the indices of the original queries.
+     *
+     * @param trips[in] The set of queries (trips) that will be used for the benchmark.
+     * @param matrix[in] The distance matrix that will be used for the benchmark.
+     * @param distances[out] The std::vector that the results of the queries will be saved into.
+     * @return Returns the cumulative time required to answer all the queries in seconds (the sorting is not included).
+     */
+    static double benchmarkRowLocal(
+            const std::vector < std::pair< unsigned int, unsigned int> > & trips,
+            DistanceMatrixInterface& matrix,
+            std::vector < dist_t > & distances);
+
+    /**
+     * Same as 'benchmark', but all queries are passed to the matrix at once using 'findDistances'.
+     *
+     * @param trips[in] The set of queries (trips) that will be used for the benchmark.
+     * @param matrix[in] The distance matrix that will be used for the benchmark.
+     * @param distances[out] The std::vector that the results of the queries will be saved into.
+     * @return Returns the cumulative time required to answer all the queries in seconds.
+     */
+    static double benchmarkBatch(
+            const std::vector < std::pair< unsigned int, unsigned int> > & trips,
+            DistanceMatrixInterface& matrix,
+            std::vector < dist_t > & distances);
 };
 
 
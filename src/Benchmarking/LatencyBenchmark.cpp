@@ -0,0 +1,248 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Czech Technical University in Prague
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. */
+
+/******************************************************************************
+* File:             LatencyBenchmark.cpp
+*****************************************************************************/
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <stdexcept>
+#include <omp.h>
+#include "LatencyBenchmark.h"
+
+namespace {
+
+/**
+ * Returns the latency at the given percentile using the nearest-rank method.
+ *
+ * @param sorted[in] The latencies sorted in ascending order, must not be empty.
+ * @param percentile[in] The percentile in the range (0, 100].
+ * @return The latency at the percentile.
+ */
+double percentileOf(const std::vector<double>& sorted, double percentile) {
+    auto rank = (size_t) std::ceil(percentile / 100.0 * (double) sorted.size());
+    return sorted[std::clamp<size_t>(rank, 1, sorted.size()) - 1];
+}
+
+/**
+ * Returns the histogram bucket for the given latency, see 'LatencyStatistics::histogram'.
+ *
+ * @param latency[in] The latency in microseconds.
+ * @return The index of the bucket.
+ */
+unsigned int bucketOf(double latency) {
+    unsigned int bucket = 0;
+    auto whole = (unsigned long long) (latency * 1000.0);
+    while (whole > 0 && bucket < LatencyStatistics::HISTOGRAM_BUCKETS - 1) {
+        whole >>= 1;
+        ++bucket;
+    }
+    return bucket;
+}
+
+}
+
+//______________________________________________________________________________________________________________________
+LatencyStatistics LatencyBenchmark::benchmark(
+        const std::vector<std::pair<unsigned int, unsigned int>> & trips,
+        const QueryFunctionFactory & factory,
+        unsigned int threads,
+        size_t warmupQueries,
+        std::vector<unsigned int> & distances) {
+    threads = std::max(threads, 1u);
+    distances.resize(trips.size());
+
+    std::vector<QueryFunction> queryFunctions;
+    queryFunctions.reserve(threads);
+    for (unsigned int thread = 0; thread < threads; ++thread) {
+        queryFunctions.push_back(factory(thread));
+    }
+
+    std::vector<double> latencies(trips.size());
+    std::exception_ptr error = nullptr;
+    std::chrono::steady_clock::time_point start, end;
+
+    // Exceptions can not leave the parallel region, so the first one is stored and rethrown afterwards.
+    #pragma omp parallel num_threads(threads)
+    {
+        auto& query = queryFunctions[omp_get_thread_num()];
+        try {
+            for (size_t i = 0; i < warmupQueries && !trips.empty(); ++i) {
+                const auto& trip = trips[i % trips.size()];
+                query(trip.first, trip.second);
+            }
+        } catch (...) {
+            #pragma omp critical
+            if (!error) {
+                error = std::current_exception();
+            }
+        }
+
+        #pragma omp barrier
+        #pragma omp single
+        start = std::chrono::steady_clock::now();
+
+        #pragma omp for schedule(dynamic, 64)
+        for (size_t i = 0; i < trips.size(); ++i) {
+            try {
+                auto queryStart = std::chrono::steady_clock::now();
+                distances[i] = query(trips[i].first, trips[i].second);
+                auto queryEnd = std::chrono::steady_clock::now();
+                latencies[i] = std::chrono::duration<double, std::micro>(queryEnd - queryStart).count();
+            } catch (...) {
+                #pragma omp critical
+                if (!error) {
+                    error = std::current_exception();
+                }
+            }
+        }
+
+        #pragma omp single
+        end = std::chrono::steady_clock::now();
+    }
+
+    if (error) {
+        std::rethrow_exception(error);
+    }
+
+    LatencyStatistics statistics;
+    statistics.queries = trips.size();
+    statistics.threads = threads;
+    statistics.warmupQueries = warmupQueries;
+    statistics.totalSeconds = std::chrono::duration<double>(end - start).count();
+    if (trips.empty()) {
+        return statistics;
+    }
+
+    statistics.throughput = statistics.totalSeconds > 0 ? (double) trips.size() / statistics.totalSeconds : 0;
+
+    double sum = 0;
+    for (double latency : latencies) {
+        sum += latency;
+        ++statistics.histogram[bucketOf(latency)];
+    }
+    statistics.meanLatency = sum / (double) latencies.size();
+
+    std::sort(latencies.begin(), latencies.end());
+    statistics.minLatency = latencies.front();
+    statistics.p50Latency = percentileOf(latencies, 50);
+    statistics.p90Latency = percentileOf(latencies, 90);
+    statistics.p99Latency = percentileOf(latencies, 99);
+    statistics.p999Latency = percentileOf(latencies, 99.9);
+    statistics.maxLatency = latencies.back();
+
+    return statistics;
+}
+
+//______________________________________________________________________________________________________________________
+void LatencyBenchmark::print(const LatencyStatistics & statistics, std::ostream & out) {
+    out << "Run " << statistics.queries << " queries on " << statistics.threads << " thread(s) in "
+        << statistics.totalSeconds << " seconds (" << statistics.warmupQueries << " warm-up queries per thread)." << std::endl;
+    out << "Throughput: " << statistics.throughput << " queries per second." << std::endl;
+    out << "Latency [us]: mean " << statistics.meanLatency << ", min " << statistics.minLatency
+        << ", p50 " << statistics.p50Latency << ", p90 " << statistics.p90Latency
+        << ", p99 " << statistics.p99Latency << ", p99.9 " << statistics.p999Latency
+        << ", max " << statistics.maxLatency << std::endl;
+
+    out << "Latency histogram:" << std::endl;
+    for (unsigned int i = 0; i < LatencyStatistics::HISTOGRAM_BUCKETS; ++i) {
+        if (statistics.histogram[i] == 0) {
+            continue;
+        }
+        unsigned long long lower = i == 0 ? 0 : 1ull << (i - 1);
+        out << "  " << std::setw(10) << lower << " ns";
+        if (i + 1 < LatencyStatistics::HISTOGRAM_BUCKETS) {
+            out << " - " << std::setw(10) << (1ull << i) << " ns";
+        } else {
+            out << " and more    ";
+        }
+        out << ": " << statistics.histogram[i] << std::endl;
+    }
+}
+
+//______________________________________________________________________________________________________________________
+void LatencyBenchmark::writeJson(
+        const LatencyStatistics & statistics,
+        const std::string & method,
+        const std::string & querySet,
+        const std::string & path) {
+    std::ofstream output(path);
+    if (!output.is_open()) {
+        throw std::runtime_error("Could not open '" + path + "' for writing.");
+    }
+
+    output << std::setprecision(10);
+    output << "{" << std::endl;
+    output << "  \"method\": " << std::quoted(method) << "," << std::endl;
+    output << "  \"query_set\": " << std::quoted(querySet) << "," << std::endl;
+    output << "  \"queries\": " << statistics.queries << "," << std::endl;
+    output << "  \"threads\": " << statistics.threads << "," << std::endl;
+    output << "  \"warmup_queries\": " << statistics.warmupQueries << "," << std::endl;
+    output << "  \"total_seconds\": " << statistics.totalSeconds << "," << std::endl;
+    output << "  \"throughput_qps\": " << statistics.throughput << "," << std::endl;
+    output << "  \"latency_us\": {" << std::endl;
+    output << "    \"mean\": " << statistics.meanLatency << "," << std::endl;
+    output << "    \"min\": " << statistics.minLatency << "," << std::endl;
+    output << "    \"p50\": " << statistics.p50Latency << "," << std::endl;
+    output << "    \"p90\": " << statistics.p90Latency << "," << std::endl;
+    output << "    \"p99\": " << statistics.p99Latency << "," << std::endl;
+    output << "    \"p99.9\": " << statistics.p999Latency << "," << std::endl;
+    output << "    \"max\": " << statistics.maxLatency << std::endl;
+    output << "  }," << std::endl;
+    output << "  \"histogram_log2_ns\": [";
+    for (unsigned int i = 0; i < LatencyStatistics::HISTOGRAM_BUCKETS; ++i) {
+        output << (i == 0 ? "" : ", ") << statistics.histogram[i];
+    }
+    output << "]" << std::endl;
+    output << "}" << std::endl;
+}
+
+//______________________________________________________________________________________________________________________
+void LatencyBenchmark::appendCsv(
+        const LatencyStatistics & statistics,
+        const std::string & method,
+        const std::string & querySet,
+        const std::string & path) {
+    const bool writeHeader = !std::filesystem::exists(path);
+    std::ofstream output(path, std::ios::app);
+    if (!output.is_open()) {
+        throw std::runtime_error("Could not open '" + path + "' for writing.");
+    }
+
+    output << std::setprecision(10);
+    if (writeHeader) {
+        output << "method,query_set,queries,threads,warmup_queries,total_seconds,throughput_qps,"
+                  "mean_us,min_us,p50_us,p90_us,p99_us,p99.9_us,max_us" << std::endl;
+    }
+    output << method << "," << std::quoted(querySet, '"', '"') << "," << statistics.queries << "," << statistics.threads << ","
+        << statistics.warmupQueries << "," << statistics.totalSeconds << "," << statistics.throughput << ","
+        << statistics.meanLatency << "," << statistics.minLatency << "," << statistics.p50Latency << ","
+        << statistics.p90Latency << "," << statistics.p99Latency << "," << statistics.p999Latency << ","
+        << statistics.maxLatency << std::endl;
+}
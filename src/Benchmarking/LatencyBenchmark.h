@@ -0,0 +1,136 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Czech Technical University in Prague
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. */
+
+/******************************************************************************
+* File:             LatencyBenchmark.h
+*
+* Description:      Per-query latency percentiles and multi-threaded throughput
+*****************************************************************************/
+
+#ifndef SHORTEST_PATHS_LATENCYBENCHMARK_H
+#define SHORTEST_PATHS_LATENCYBENCHMARK_H
+
+#include <array>
+#include <functional>
+#include <ostream>
+#include <string>
+#include <vector>
+
+/**
+ * Results of one latency benchmark run. All latencies are in microseconds.
+ */
+struct LatencyStatistics {
+    /**
+     * The number of histogram buckets. Bucket 'i' contains the queries with latency in [2^(i-1), 2^i) nanoseconds,
+     * bucket 0 contains the queries faster than one nanosecond and the last bucket contains everything slower.
+     */
+    static constexpr unsigned int HISTOGRAM_BUCKETS = 32;
+
+    size_t queries = 0;
+    unsigned int threads = 1;
+    size_t warmupQueries = 0;
+    double totalSeconds = 0;
+    double throughput = 0;
+    double meanLatency = 0;
+    double minLatency = 0;
+    double p50Latency = 0;
+    double p90Latency = 0;
+    double p99Latency = 0;
+    double p999Latency = 0;
+    double maxLatency = 0;
+    std::array<size_t, HISTOGRAM_BUCKETS> histogram{};
+};
+
+/**
+ * Measures the latency of every single query and the throughput of a query engine, optionally using multiple
+ * threads. Unlike the other benchmarks, this one does not work with a concrete data structure, but with query
+ * functions. Each thread obtains its own query function from the factory, so engines that keep the query state
+ * in a query manager (CH, CCH, TNR, TNRAF) can give every thread its own manager over one shared data structure.
+ */
+class LatencyBenchmark {
+public:
+    using QueryFunction = std::function<unsigned int(unsigned int, unsigned int)>;
+    using QueryFunctionFactory = std::function<QueryFunction(unsigned int)>;
+
+    /**
+     * Lets every thread run the warm-up queries (the first 'warmupQueries' trips, repeated if needed) and then runs
+     * all the trips while measuring the time of each query separately. The trips are distributed dynamically
+     * between the threads.
+     * The distances are not validated inside this function.
+     *
+     * @param trips[in] The set of queries (trips) that will be used for the benchmark.
+     * @param factory[in] Creates the query function for the given thread (0 to threads - 1). It is called
+     * sequentially for all the threads before the measurement starts.
+     * @param threads[in] The number of threads used to run the queries.
+     * @param warmupQueries[in] The number of queries each thread runs before the measurement starts.
+     * @param distances[out] The std::vector that the results of the queries will be saved into.
+     * @return The latency and throughput statistics of the run.
+     */
+    static LatencyStatistics benchmark(
+            const std::vector<std::pair<unsigned int, unsigned int>> & trips,
+            const QueryFunctionFactory & factory,
+            unsigned int threads,
+            size_t warmupQueries,
+            std::vector<unsigned int> & distances);
+
+    /**
+     * Prints a human-readable summary of the statistics including the histogram.
+     *
+     * @param statistics[in] The statistics to print.
+     * @param out[in] The stream the summary is written to.
+     */
+    static void print(
+            const LatencyStatistics & statistics,
+            std::ostream & out);
+
+    /**
+     * Writes the statistics of a run as a JSON object to the given file, replacing its previous content.
+     *
+     * @param statistics[in] The statistics to write.
+     * @param method[in] The name of the benchmarked method.
+     * @param querySet[in] The path to the query set used for the run.
+     * @param path[in] The output file path.
+     */
+    static void writeJson(
+            const LatencyStatistics & statistics,
+            const std::string & method,
+            const std::string & querySet,
+            const std::string & path);
+
+    /**
+     * Appends the statistics of a run as one CSV line to the given file, so that results of repeated runs
+     * can be collected in one file. The header is written only if the file does not exist yet.
+     *
+     * @param statistics[in] The statistics to write.
+     * @param method[in] The name of the benchmarked method.
+     * @param querySet[in] The path to the query set used for the run.
+     * @param path[in] The output file path.
+     */
+    static void appendCsv(
+            const LatencyStatistics & statistics,
+            const std::string & method,
+            const std::string & querySet,
+            const std::string & path);
+};
+
+#endif //SHORTEST_PATHS_LATENCYBENCHMARK_H
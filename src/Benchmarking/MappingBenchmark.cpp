@@ -0,0 +1,80 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Czech Technical University in Prague
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. */
+
+/******************************************************************************
+* File:             MappingBenchmark.cpp
+*****************************************************************************/
+
+#include <chrono>
+#include <iostream>
+#include "MappingBenchmark.h"
+#include "../GraphBuilding/Loaders/NodeMappingLoader.h"
+
+// The IDs from the queries are translated repeatedly until at least this many lookups are made.
+constexpr size_t MIN_LOOKUPS = 1000000;
+
+//______________________________________________________________________________________________________________________
+template <class Lookup>
+double measureLookup(
+        const std::vector < std::pair< long long unsigned int, long long unsigned int> > & trips,
+        const Lookup& lookup,
+        size_t& checksum) {
+    const size_t rounds = (MIN_LOOKUPS + 2 * trips.size() - 1) / (2 * trips.size());
+
+    // One round without measuring brings the structure into the cache.
+    for (const auto& trip : trips) {
+        checksum += lookup(trip.first) + lookup(trip.second);
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t round = 0; round < rounds; round++) {
+        for (const auto& trip : trips) {
+            checksum += lookup(trip.first) + lookup(trip.second);
+        }
+    }
+    const auto end = std::chrono::steady_clock::now();
+
+    return std::chrono::duration<double, std::nano>(end - start).count() / static_cast<double>(rounds * 2 * trips.size());
+}
+
+//______________________________________________________________________________________________________________________
+void MappingBenchmark::benchmark(const std::vector < std::pair< long long unsigned int, long long unsigned int> > & trips, const std::string& mappingFilePath) {
+    if (trips.empty()) {
+        return;
+    }
+
+    const auto loadStart = std::chrono::steady_clock::now();
+    NodeMappingLoader mappingLoader(mappingFilePath);
+    const NodeMapping mapping = mappingLoader.loadMapping();
+    const auto loadEnd = std::chrono::steady_clock::now();
+
+    size_t checksum = 0;
+    const double mappingLookup = measureLookup(trips, [&mapping](long long unsigned int id) {
+        return mapping.internalID(id);
+    }, checksum);
+
+    std::cout << "Mapping of " << mapping.nodes() << " nodes loaded in "
+              << std::chrono::duration<double, std::milli>(loadEnd - loadStart).count() << " ms, it requires "
+              << mapping.memoryUsage() / 1024 << " KiB." << std::endl;
+    std::cout << "Mapping lookup: " << mappingLookup << " ns per ID (checksum " << checksum << ")." << std::endl;
+}
@@ -0,0 +1,56 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Czech Technical University in Prague
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. */
+
+/******************************************************************************
+* File:             MappingBenchmark.h
+*
+* Description:      Measures the cost of translating the original node IDs
+*****************************************************************************/
+
+#ifndef SHORTEST_PATHS_MAPPINGBENCHMARK_H
+#define SHORTEST_PATHS_MAPPINGBENCHMARK_H
+
+#include <string>
+#include <vector>
+
+/**
+ * A class that measures how long it takes to load a mapping file and to translate the original node IDs of a set
+ * of queries to the IDs used by the query algorithms. It is run by the benchmark with '--mapping-benchmark', so
+ * the text and the binary mapping formats can be compared.
+ */
+class MappingBenchmark {
+public:
+    /**
+     * Loads the mapping, translates all the IDs from the queries repeatedly and prints the load time, the memory
+     * required by the mapping and the average time of a single lookup.
+     *
+     * @param trips[in] The set of queries (trips) using the original IDs.
+     * @param mappingFilePath[in] The path to the mapping file.
+     */
+    static void benchmark(
+            const std::vector < std::pair< long long unsigned int, long long unsigned int> > & trips,
+            const std::string& mappingFilePath);
+};
+
+
+#endif //SHORTEST_PATHS_MAPPINGBENCHMARK_H
@@ -0,0 +1,100 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Czech Technical University in Prague
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. */
+
+/******************************************************************************
+* File:             CCHCustomizer.cpp
+*****************************************************************************/
+
+#include <algorithm>
+#include <climits>
+#include <stdexcept>
+#include <omp.h>
+#include "CCHCustomizer.h"
+
+//______________________________________________________________________________________________________________________
+CCHMetric CCHCustomizer::customize(const CCHTopology& topology, const std::vector<dist_t>& weights, unsigned int threads) {
+    if (weights.size() != topology.edges()) {
+        throw std::invalid_argument("A weight must be given for each original edge of the Customizable Contraction "
+                                    "Hierarchy.");
+    }
+
+    const int threadsCnt = threads == 0 ? omp_get_max_threads() : static_cast<int>(threads);
+
+    CCHMetric metric;
+    metric.upWeights.assign(topology.arcs(), UINT_MAX);
+    metric.downWeights.assign(topology.arcs(), UINT_MAX);
+
+    // The original edges are distinct, so every arc direction gets at most one weight.
+    const auto edges = static_cast<long long>(topology.edges());
+    #pragma omp parallel for num_threads(threadsCnt) schedule(static)
+    for (long long edge = 0; edge < edges; edge++) {
+        const unsigned int arc = topology.edgeArc(static_cast<unsigned int>(edge));
+        if (arc != CCHTopology::NONE) {
+            auto& arcWeights = (arc & 1) ? metric.downWeights : metric.upWeights;
+            arcWeights[arc >> 1] = weights[static_cast<size_t>(edge)];
+        }
+    }
+
+    std::vector<dist_t>& up = metric.upWeights;
+    std::vector<dist_t>& down = metric.downWeights;
+    const std::vector<unsigned int>& levelStart = topology.levelStart();
+    const std::vector<unsigned int>& levelNodes = topology.levelNodes();
+    for (size_t level = 1; level + 1 < levelStart.size(); level++) {
+        const auto begin = static_cast<long long>(levelStart[level]);
+        const auto end = static_cast<long long>(levelStart[level + 1]);
+
+        #pragma omp parallel for num_threads(threadsCnt) schedule(dynamic, 16)
+        for (long long i = begin; i < end; i++) {
+            const unsigned int x = levelNodes[static_cast<size_t>(i)];
+            for (unsigned int index = topology.firstLowerArc(x); index < topology.firstLowerArc(x + 1); index++) {
+                // The arc (v, x) together with the arcs (v, y) going above x form the lower triangles (v, x, y).
+                // Both the arcs of v and the arcs of x are sorted by the upper endpoint, and every upper neighbour of
+                // v above x is also an upper neighbour of x, so the arc (x, y) is found by a single merge pass.
+                const unsigned int lowerArc = topology.lowerArc(index);
+                const unsigned int v = topology.lowerArcTail(index);
+                const dist_t xToV = down[lowerArc];
+                const dist_t vToX = up[lowerArc];
+                if (xToV == UINT_MAX && vToX == UINT_MAX) {
+                    continue;
+                }
+
+                unsigned int xArc = topology.firstArc(x);
+                for (unsigned int vArc = lowerArc + 1; vArc < topology.firstArc(v + 1); vArc++) {
+                    const unsigned int y = topology.head(vArc);
+                    while (topology.head(xArc) < y) {
+                        xArc++;
+                    }
+
+                    if (xToV != UINT_MAX && up[vArc] != UINT_MAX) {
+                        up[xArc] = std::min(up[xArc], xToV + up[vArc]);
+                    }
+                    if (vToX != UINT_MAX && down[vArc] != UINT_MAX) {
+                        down[xArc] = std::min(down[xArc], down[vArc] + vToX);
+                    }
+                }
+            }
+        }
+    }
+
+    return metric;
+}
@@ -0,0 +1,61 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Czech Technical University in Prague
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. */
+
+/******************************************************************************
+* File:             CCHCustomizer.h
+*
+* Description:      Customization of the Customizable Contraction Hierarchies for a new metric
+*****************************************************************************/
+
+#ifndef SHORTEST_PATHS_CCHCUSTOMIZER_H
+#define SHORTEST_PATHS_CCHCUSTOMIZER_H
+
+#include <vector>
+#include "Structures/CCHMetric.h"
+#include "Structures/CCHTopology.h"
+
+/**
+ * Computes the weights of all the arcs of a Customizable Contraction Hierarchy from the weights of the original
+ * edges. We use the basic customization described in the "Customizable Contraction Hierarchies" article by Julian
+ * Dibbelt, Ben Strasser and Dorothea Wagner: every arc first gets the weight of the corresponding original edge
+ * and then, going from the lowest ranked nodes up, each arc (x, y) is improved using all the lower triangles
+ * (v, x, y), where v is ranked lower than both x and y. Only the arcs of a single node are written when the node is
+ * processed and all its lower neighbours are processed before it, so the nodes with the same height in the
+ * elimination tree are processed in parallel. No shortest path searches are needed, so the customization is much
+ * faster than the Contraction Hierarchies preprocessing.
+ */
+class CCHCustomizer {
+public:
+    /**
+     * Customizes the topology for the given weights.
+     *
+     * @param topology[in] The topology.
+     * @param weights[in] The weights of the original edges (in the order given by the topology), UINT_MAX can be
+     * used for the edges that can not be used.
+     * @param threads[in] The number of threads, 0 uses the OpenMP default.
+     * @return The customized metric.
+     */
+    static CCHMetric customize(const CCHTopology& topology, const std::vector<dist_t>& weights, unsigned int threads = 0);
+};
+
+#endif //SHORTEST_PATHS_CCHCUSTOMIZER_H
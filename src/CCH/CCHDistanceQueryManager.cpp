@@ -0,0 +1,106 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Czech Technical University in Prague
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. */
+
+/******************************************************************************
+* File:             CCHDistanceQueryManager.cpp
+*****************************************************************************/
+
+#include <climits>
+#include <utility>
+#include "CCHDistanceQueryManager.h"
+
+//______________________________________________________________________________________________________________________
+CCHDistanceQueryManager::CCHDistanceQueryManager(const CCHTopology& topology, std::shared_ptr<const CCHMetric> metric)
+    : topology(topology), metric(std::move(metric)), forwardDist(topology.nodes(), UINT_MAX),
+      backwardDist(topology.nodes(), UINT_MAX), statistics(nullptr) {
+
+}
+
+//______________________________________________________________________________________________________________________
+void CCHDistanceQueryManager::setMetric(std::shared_ptr<const CCHMetric> newMetric) {
+    metric = std::move(newMetric);
+}
+
+//______________________________________________________________________________________________________________________
+void CCHDistanceQueryManager::setStatistics(QueryStatistics* queryStatistics) {
+    statistics = queryStatistics;
+}
+
+//______________________________________________________________________________________________________________________
+unsigned int CCHDistanceQueryManager::findDistance(const unsigned int start, const unsigned int goal) {
+    if (start == goal) {
+        return 0;
+    }
+
+    const std::vector<dist_t>& up = metric->upWeights;
+    const std::vector<dist_t>& down = metric->downWeights;
+    const unsigned int source = topology.rank(start);
+    const unsigned int target = topology.rank(goal);
+
+    // The distances are only ever set for the ancestors of the start (or the goal), so scanning the ancestors again
+    // resets everything the query changed.
+    forwardDist[source] = 0;
+    for (unsigned int node = source; node != CCHTopology::NONE; node = topology.parent(node)) {
+        COUNT_QUERY_STATISTIC(statistics, settledNodes, 1);
+        const unsigned int distance = forwardDist[node];
+        if (distance == UINT_MAX) {
+            continue;
+        }
+        for (unsigned int arc = topology.firstArc(node); arc < topology.firstArc(node + 1); arc++) {
+            COUNT_QUERY_STATISTIC(statistics, relaxedEdges, 1);
+            if (up[arc] != UINT_MAX && distance + up[arc] < forwardDist[topology.head(arc)]) {
+                forwardDist[topology.head(arc)] = distance + up[arc];
+            }
+        }
+    }
+
+    unsigned int shortest = UINT_MAX;
+    backwardDist[target] = 0;
+    for (unsigned int node = target; node != CCHTopology::NONE; node = topology.parent(node)) {
+        COUNT_QUERY_STATISTIC(statistics, settledNodes, 1);
+        const unsigned int distance = backwardDist[node];
+        backwardDist[node] = UINT_MAX;
+        if (distance == UINT_MAX) {
+            continue;
+        }
+        if (forwardDist[node] != UINT_MAX && forwardDist[node] + distance < shortest) {
+            shortest = forwardDist[node] + distance;
+        }
+        // Every path found by continuing the backward search from this node is at least as long as the best one.
+        if (distance >= shortest) {
+            continue;
+        }
+        for (unsigned int arc = topology.firstArc(node); arc < topology.firstArc(node + 1); arc++) {
+            COUNT_QUERY_STATISTIC(statistics, relaxedEdges, 1);
+            if (down[arc] != UINT_MAX && distance + down[arc] < backwardDist[topology.head(arc)]) {
+                backwardDist[topology.head(arc)] = distance + down[arc];
+            }
+        }
+    }
+
+    for (unsigned int node = source; node != CCHTopology::NONE; node = topology.parent(node)) {
+        forwardDist[node] = UINT_MAX;
+    }
+
+    return shortest;
+}
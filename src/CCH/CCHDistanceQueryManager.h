@@ -0,0 +1,94 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Czech Technical University in Prague
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. */
+
+/******************************************************************************
+* File:             CCHDistanceQueryManager.h
+*
+* Description:      Elimination tree distance queries on the Customizable Contraction Hierarchies
+*****************************************************************************/
+
+#ifndef SHORTEST_PATHS_CCHDISTANCEQUERYMANAGER_H
+#define SHORTEST_PATHS_CCHDISTANCEQUERYMANAGER_H
+
+#include <memory>
+#include <vector>
+#include "Structures/CCHMetric.h"
+#include "Structures/CCHTopology.h"
+#include "../CH/Structures/QueryStatistics.h"
+
+/**
+ * Answers the distance queries using a Customizable Contraction Hierarchy. We use the elimination tree search
+ * described in the "Customizable Contraction Hierarchies" article by Julian Dibbelt, Ben Strasser and Dorothea
+ * Wagner: all the nodes reachable by the upward search from a node are its ancestors in the elimination tree, so
+ * instead of a priority queue, the forward search simply scans the ancestors of the start node and the backward
+ * search scans the ancestors of the goal node, both from the bottom up. The shortest distance is the minimum over
+ * the common ancestors.
+ *
+ * Unlike the other query managers, the manager does not store anything in the data structure, the topology and
+ * the metric are only read. Any number of managers (one for each thread) can therefore share them and the metric
+ * can be replaced by a newly customized one between the queries.
+ */
+class CCHDistanceQueryManager {
+public:
+    /**
+     * A simple constructor.
+     *
+     * @param topology[in] The topology, it must outlive the manager.
+     * @param metric[in] The customized metric used by the queries.
+     */
+    CCHDistanceQueryManager(const CCHTopology& topology, std::shared_ptr<const CCHMetric> metric);
+
+    /**
+     * Finds the shortest distance.
+     *
+     * @param start[in] The start node for the query.
+     * @param goal[in] The goal node for the query.
+     * @return Returns the shortest distance from start to goal or 'UINT_MAX' if goal is not reachable from start.
+     */
+    unsigned int findDistance(unsigned int start, unsigned int goal);
+
+    /**
+     * Replaces the metric used by the following queries.
+     *
+     * @param newMetric[in] A metric customized for the same topology.
+     */
+    void setMetric(std::shared_ptr<const CCHMetric> newMetric);
+
+    /**
+     * Enables or disables the collection of the search statistics. When enabled, the following queries add their
+     * counters to the given instance, which is not reset between the queries. The nodes scanned by either search
+     * are counted as the settled nodes.
+     *
+     * @param queryStatistics[in] The instance the counters are added to, or nullptr to disable the collection.
+     */
+    void setStatistics(QueryStatistics* queryStatistics);
+
+private:
+    const CCHTopology& topology;
+    std::shared_ptr<const CCHMetric> metric;
+    std::vector<unsigned int> forwardDist;
+    std::vector<unsigned int> backwardDist;
+    QueryStatistics* statistics;
+};
+
+#endif //SHORTEST_PATHS_CCHDISTANCEQUERYMANAGER_H
@@ -0,0 +1,392 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Czech Technical University in Prague
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. */
+
+/******************************************************************************
+* File:             NestedDissection.cpp
+*****************************************************************************/
+
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+#include "NestedDissection.h"
+
+namespace {
+
+// The roles of the nodes in the minimum vertex cut computation.
+constexpr unsigned char INNER = 0;
+constexpr unsigned char SOURCE = 1;
+constexpr unsigned char TARGET = 2;
+
+}
+
+//______________________________________________________________________________________________________________________
+std::vector<unsigned int> NestedDissection::computeRanks(const SimpleGraph& graph) {
+    NestedDissection dissection(graph);
+    return dissection.run();
+}
+
+//______________________________________________________________________________________________________________________
+NestedDissection::NestedDissection(const SimpleGraph& graph) : currentPart(0), visitStamp(0) {
+    const unsigned int nodes = graph.nodes();
+
+    std::vector<std::vector<unsigned int>> adjacency(nodes);
+    for (unsigned int from = 0; from < nodes; from++) {
+        for (const auto& edge : graph.edges(from)) {
+            if (edge.first != from) {
+                adjacency[from].push_back(edge.first);
+                adjacency[edge.first].push_back(from);
+            }
+        }
+    }
+
+    firstNeighbour.assign(nodes + 1, 0);
+    for (unsigned int node = 0; node < nodes; node++) {
+        std::sort(adjacency[node].begin(), adjacency[node].end());
+        adjacency[node].erase(std::unique(adjacency[node].begin(), adjacency[node].end()), adjacency[node].end());
+        neighbours.insert(neighbours.end(), adjacency[node].begin(), adjacency[node].end());
+        firstNeighbour[node + 1] = static_cast<unsigned int>(neighbours.size());
+        adjacency[node] = {};
+    }
+
+    // The neighbour lists are sorted, so the opposite direction of every edge can be found by a binary search.
+    reverseNeighbour.resize(neighbours.size());
+    for (unsigned int node = 0; node < nodes; node++) {
+        for (unsigned int i = firstNeighbour[node]; i < firstNeighbour[node + 1]; i++) {
+            const auto begin = neighbours.begin() + firstNeighbour[neighbours[i]];
+            const auto end = neighbours.begin() + firstNeighbour[neighbours[i] + 1];
+            reverseNeighbour[i] = static_cast<unsigned int>(std::lower_bound(begin, end, node) - neighbours.begin());
+        }
+    }
+
+    owner.assign(nodes, 0);
+    fromA.assign(nodes, UINT_MAX);
+    fromB.assign(nodes, UINT_MAX);
+    fromC.assign(nodes, UINT_MAX);
+    fromD.assign(nodes, UINT_MAX);
+    role.assign(nodes, INNER);
+    nodeFlow.assign(nodes, 0);
+    edgeFlow.assign(neighbours.size(), 0);
+    visited.assign(2 * static_cast<size_t>(nodes), 0);
+    parent.assign(2 * static_cast<size_t>(nodes), UINT_MAX);
+    parentEdge.assign(2 * static_cast<size_t>(nodes), UINT_MAX);
+}
+
+//______________________________________________________________________________________________________________________
+std::vector<unsigned int> NestedDissection::run() {
+    const unsigned int nodes = static_cast<unsigned int>(owner.size());
+    std::vector<unsigned int> ranks(nodes, UINT_MAX);
+
+    std::vector<Part> parts;
+    parts.push_back({std::vector<unsigned int>(nodes), nodes});
+    for (unsigned int node = 0; node < nodes; node++) {
+        parts.back().nodes[node] = node;
+    }
+
+    while (!parts.empty()) {
+        Part part = std::move(parts.back());
+        parts.pop_back();
+
+        const unsigned int size = static_cast<unsigned int>(part.nodes.size());
+        if (size <= LEAF_SIZE) {
+            for (unsigned int i = 0; i < size; i++) {
+                ranks[part.nodes[i]] = part.rankEnd - size + i;
+            }
+            continue;
+        }
+
+        currentPart++;
+        for (unsigned int node : part.nodes) {
+            owner[node] = currentPart;
+        }
+
+        // A part that is not connected is split into its components, which are ordered independently.
+        resetDistances(part.nodes, fromA);
+        breadthFirstSearch(part.nodes[0], fromA);
+        if (reached.size() < size) {
+            unsigned int rankEnd = part.rankEnd;
+            parts.push_back({reached, rankEnd});
+            rankEnd -= static_cast<unsigned int>(reached.size());
+            for (unsigned int node : part.nodes) {
+                if (fromA[node] == UINT_MAX) {
+                    breadthFirstSearch(node, fromA);
+                    parts.push_back({reached, rankEnd});
+                    rankEnd -= static_cast<unsigned int>(reached.size());
+                }
+            }
+            continue;
+        }
+
+        const std::vector<unsigned int> separator = findSeparator(part.nodes);
+        const unsigned int separatorSize = static_cast<unsigned int>(separator.size());
+        for (unsigned int i = 0; i < separatorSize; i++) {
+            ranks[separator[i]] = part.rankEnd - separatorSize + i;
+            owner[separator[i]] = 0;
+        }
+
+        // The rest is no longer connected, it is split into the components when it is taken from the stack.
+        std::vector<unsigned int> rest;
+        rest.reserve(size - separatorSize);
+        for (unsigned int node : part.nodes) {
+            if (owner[node] == currentPart) {
+                rest.push_back(node);
+            }
+        }
+        if (!rest.empty()) {
+            parts.push_back({std::move(rest), part.rankEnd - separatorSize});
+        }
+    }
+
+    return ranks;
+}
+
+//______________________________________________________________________________________________________________________
+void NestedDissection::breadthFirstSearch(const unsigned int source, std::vector<unsigned int>& distances) {
+    reached.clear();
+    reached.push_back(source);
+    distances[source] = 0;
+
+    for (size_t i = 0; i < reached.size(); i++) {
+        const unsigned int node = reached[i];
+        for (unsigned int j = firstNeighbour[node]; j < firstNeighbour[node + 1]; j++) {
+            const unsigned int neighbour = neighbours[j];
+            if (owner[neighbour] == currentPart && distances[neighbour] == UINT_MAX) {
+                distances[neighbour] = distances[node] + 1;
+                reached.push_back(neighbour);
+            }
+        }
+    }
+}
+
+//______________________________________________________________________________________________________________________
+std::vector<unsigned int> NestedDissection::findSeparator(const std::vector<unsigned int>& nodes) {
+    // A and B are approximately the two most distant nodes of the part, C is as far as possible from both of them
+    // and D is the most distant node from C. The differences of the distances then work as two directions.
+    const unsigned int a = reached.back();
+    resetDistances(nodes, fromA);
+    breadthFirstSearch(a, fromA);
+    const unsigned int b = reached.back();
+    resetDistances(nodes, fromB);
+    breadthFirstSearch(b, fromB);
+
+    unsigned int c = a;
+    for (unsigned int node : nodes) {
+        if (std::min(fromA[node], fromB[node]) > std::min(fromA[c], fromB[c])) {
+            c = node;
+        }
+    }
+    resetDistances(nodes, fromC);
+    breadthFirstSearch(c, fromC);
+    const unsigned int d = reached.back();
+    resetDistances(nodes, fromD);
+    breadthFirstSearch(d, fromD);
+
+    auto first = [&](unsigned int node) {
+        return static_cast<long long>(fromA[node]) - static_cast<long long>(fromB[node]);
+    };
+    auto second = [&](unsigned int node) {
+        return static_cast<long long>(fromC[node]) - static_cast<long long>(fromD[node]);
+    };
+
+    std::vector<unsigned int> best;
+    std::vector<unsigned int> separator;
+    std::vector<unsigned int> order(nodes);
+    for (int direction = 0; direction < 4; direction++) {
+        auto key = [&](unsigned int node) {
+            switch (direction) {
+                case 0: return first(node);
+                case 1: return second(node);
+                case 2: return first(node) + second(node);
+                default: return first(node) - second(node);
+            }
+        };
+        std::stable_sort(order.begin(), order.end(), [&](unsigned int x, unsigned int y) {
+            return key(x) < key(y);
+        });
+
+        const size_t limit = best.empty() ? SIZE_MAX : best.size();
+        if (minimumVertexCut(order, limit, separator)) {
+            best.swap(separator);
+        }
+    }
+
+    if (best.empty()) {
+        best = levelSeparator(a, nodes);
+    }
+    return best;
+}
+
+//______________________________________________________________________________________________________________________
+bool NestedDissection::minimumVertexCut(
+        const std::vector<unsigned int>& order,
+        const size_t limit,
+        std::vector<unsigned int>& separator) {
+    const size_t size = order.size();
+    const size_t terminals = std::max<size_t>(1, size / TERMINAL_DIVISOR);
+    for (size_t i = 0; i < size; i++) {
+        const unsigned int node = order[i];
+        role[node] = i < terminals ? SOURCE : (i >= size - terminals ? TARGET : INNER);
+        nodeFlow[node] = 0;
+        for (unsigned int j = firstNeighbour[node]; j < firstNeighbour[node + 1]; j++) {
+            edgeFlow[j] = 0;
+        }
+    }
+
+    auto finish = [&](bool found) {
+        for (unsigned int node : order) {
+            role[node] = INNER;
+        }
+        return found;
+    };
+
+    // No vertex cut exists if the source and the target are adjacent.
+    for (size_t i = 0; i < terminals; i++) {
+        const unsigned int node = order[i];
+        for (unsigned int j = firstNeighbour[node]; j < firstNeighbour[node + 1]; j++) {
+            if (owner[neighbours[j]] == currentPart && role[neighbours[j]] == TARGET) {
+                return finish(false);
+            }
+        }
+    }
+
+    // Each node is split into two states, the entry (2 * node) and the exit (2 * node + 1), connected by an arc with
+    // the capacity one. The edges have an unlimited capacity, 'edgeFlow' holds the net flow along each of them.
+    // The flow is increased by breadth-first searches for augmenting paths in the residual graph.
+    std::vector<unsigned int> queue;
+    size_t flow = 0;
+    while (true) {
+        visitStamp++;
+        queue.clear();
+        for (size_t i = 0; i < terminals; i++) {
+            const unsigned int node = order[i];
+            visited[2 * node] = visitStamp;
+            visited[2 * node + 1] = visitStamp;
+            parent[2 * node + 1] = UINT_MAX;
+            queue.push_back(2 * node + 1);
+        }
+
+        auto visit = [&](unsigned int state, unsigned int from, unsigned int edge) {
+            if (visited[state] == visitStamp) {
+                return false;
+            }
+            visited[state] = visitStamp;
+            parent[state] = from;
+            parentEdge[state] = edge;
+            queue.push_back(state);
+            return true;
+        };
+
+        unsigned int found = UINT_MAX;
+        for (size_t i = 0; i < queue.size() && found == UINT_MAX; i++) {
+            const unsigned int state = queue[i];
+            const unsigned int node = state / 2;
+            if (state % 2 == 1) {
+                for (unsigned int j = firstNeighbour[node]; j < firstNeighbour[node + 1]; j++) {
+                    const unsigned int neighbour = neighbours[j];
+                    if (owner[neighbour] == currentPart && visit(2 * neighbour, state, j) && role[neighbour] == TARGET) {
+                        found = 2 * neighbour;
+                        break;
+                    }
+                }
+                if (nodeFlow[node] == 1) {
+                    visit(2 * node, state, UINT_MAX);
+                }
+            } else {
+                if (nodeFlow[node] == 0) {
+                    visit(2 * node + 1, state, UINT_MAX);
+                }
+                for (unsigned int j = firstNeighbour[node]; j < firstNeighbour[node + 1]; j++) {
+                    if (edgeFlow[j] < 0 && owner[neighbours[j]] == currentPart) {
+                        visit(2 * neighbours[j] + 1, state, j);
+                    }
+                }
+            }
+        }
+
+        if (found == UINT_MAX) {
+            break;
+        }
+        if (++flow >= limit) {
+            return finish(false);
+        }
+
+        for (unsigned int state = found; parent[state] != UINT_MAX; state = parent[state]) {
+            const unsigned int edge = parentEdge[state];
+            if (edge == UINT_MAX) {
+                nodeFlow[state / 2] = state % 2 == 1 ? 1 : 0;
+            } else {
+                edgeFlow[edge]++;
+                edgeFlow[reverseNeighbour[edge]]--;
+            }
+        }
+    }
+
+    // The cut consists of the nodes whose entry is reachable in the residual graph after the last search, but
+    // whose exit is not.
+    separator.clear();
+    for (unsigned int node : order) {
+        if (visited[2 * node] == visitStamp && visited[2 * node + 1] != visitStamp) {
+            separator.push_back(node);
+        }
+    }
+    return finish(true);
+}
+
+//______________________________________________________________________________________________________________________
+std::vector<unsigned int> NestedDissection::levelSeparator(
+        const unsigned int source,
+        const std::vector<unsigned int>& nodes) {
+    resetDistances(nodes, fromA);
+    breadthFirstSearch(source, fromA);
+
+    const unsigned int separatorLevel = fromA[reached[reached.size() / 2]];
+    std::vector<unsigned int> separator;
+    for (unsigned int node : reached) {
+        if (fromA[node] != separatorLevel) {
+            continue;
+        }
+        // Nodes without a neighbour in the next level do not separate anything.
+        for (unsigned int i = firstNeighbour[node]; i < firstNeighbour[node + 1]; i++) {
+            if (owner[neighbours[i]] == currentPart && fromA[neighbours[i]] == separatorLevel + 1) {
+                separator.push_back(node);
+                break;
+            }
+        }
+    }
+
+    // The separator level is the last one, so the whole level is used to make progress.
+    if (separator.empty()) {
+        for (unsigned int node : reached) {
+            if (fromA[node] == separatorLevel) {
+                separator.push_back(node);
+            }
+        }
+    }
+    return separator;
+}
+
+//______________________________________________________________________________________________________________________
+void NestedDissection::resetDistances(const std::vector<unsigned int>& nodes, std::vector<unsigned int>& distances) {
+    for (unsigned int node : nodes) {
+        distances[node] = UINT_MAX;
+    }
+}
@@ -0,0 +1,158 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Czech Technical University in Prague
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. */
+
+/******************************************************************************
+* File:             NestedDissection.h
+*
+* Description:      Metric-independent node ordering for Customizable Contraction Hierarchies
+*****************************************************************************/
+
+#ifndef SHORTEST_PATHS_NESTEDDISSECTION_H
+#define SHORTEST_PATHS_NESTEDDISSECTION_H
+
+#include <vector>
+#include "../GraphBuilding/Structures/SimpleGraph.h"
+
+/**
+ * Computes a nested dissection ordering of the nodes of a graph. The ordering only depends on the structure of the
+ * graph and not on the weights, so it stays valid when the weights change. The graph is recursively split into two
+ * parts by a small set of nodes (a separator), the separator gets the highest ranks of the part and the two parts
+ * are ordered recursively below it. Contracting the nodes in this order only creates shortcuts inside the parts and
+ * towards their separators, which keeps the number of shortcuts low for any metric.
+ *
+ * The separators are found similarly to the Inertial Flow algorithm, only the graphs have no coordinates, so
+ * the directions are approximated using breadth-first search distances from a few nodes on the border of the part:
+ * the nodes are sorted by the difference of the distances from two opposite border nodes, the first quarter of
+ * them is used as the source and the last quarter as the target, and a minimum vertex cut between them is found
+ * using a unit capacity maximum flow. The smallest cut out of four such directions is used. Road networks are close
+ * to planar, so such cuts are small. The edge directions are ignored.
+ */
+class NestedDissection {
+public:
+    /**
+     * Computes the ordering.
+     *
+     * @param graph[in] The graph, both the edge directions and the weights are ignored.
+     * @return The ranks of the nodes, 'ranks[i]' is the position of the node 'i' in the contraction order.
+     */
+    static std::vector<unsigned int> computeRanks(const SimpleGraph& graph);
+
+private:
+    /**
+     * Parts with at most this many nodes are not split any further, their nodes get the ranks in an arbitrary order.
+     */
+    static constexpr unsigned int LEAF_SIZE = 4;
+
+    /**
+     * The source and the target of the cut each get 1 / TERMINAL_DIVISOR of the nodes of the part.
+     */
+    static constexpr unsigned int TERMINAL_DIVISOR = 4;
+
+    /**
+     * A part of the graph that still has to be ordered, its nodes get the ranks lower than 'rankEnd'.
+     */
+    struct Part {
+        std::vector<unsigned int> nodes;
+        unsigned int rankEnd;
+    };
+
+    /**
+     * Builds the undirected adjacency lists of the graph.
+     *
+     * @param graph[in] The graph.
+     */
+    explicit NestedDissection(const SimpleGraph& graph);
+
+    /**
+     * Runs the recursive dissection.
+     *
+     * @return The ranks of the nodes.
+     */
+    std::vector<unsigned int> run();
+
+    /**
+     * Runs a breadth-first search restricted to the nodes of the current part. The reached nodes are stored in
+     * 'reached' in the order they were reached.
+     *
+     * @param source[in] The node the search starts from.
+     * @param distances[in, out] The distances from the source, must be set to UINT_MAX for the nodes of the part.
+     */
+    void breadthFirstSearch(unsigned int source, std::vector<unsigned int>& distances);
+
+    /**
+     * Finds a separator of a connected part using the minimum vertex cuts, falls back to 'levelSeparator' if
+     * no cut can be found.
+     *
+     * @param nodes[in] The nodes of the part.
+     * @return The separator, never empty.
+     */
+    std::vector<unsigned int> findSeparator(const std::vector<unsigned int>& nodes);
+
+    /**
+     * Finds a minimum vertex cut between the first and the last quarter of the given nodes.
+     *
+     * @param order[in] The nodes of the part sorted along some direction.
+     * @param limit[in] The search is stopped when the cut can not be smaller than this value.
+     * @param separator[out] The cut if one was found.
+     * @return True if a cut smaller than the limit was found.
+     */
+    bool minimumVertexCut(const std::vector<unsigned int>& order, size_t limit, std::vector<unsigned int>& separator);
+
+    /**
+     * Finds a separator using the breadth-first search levels, the level at which half of the part is reached is used,
+     * without the nodes that have no neighbour in the next level.
+     *
+     * @param source[in] The node the search starts from.
+     * @param nodes[in] The nodes of the part.
+     * @return The separator, never empty.
+     */
+    std::vector<unsigned int> levelSeparator(unsigned int source, const std::vector<unsigned int>& nodes);
+
+    /**
+     * Sets the distances of the nodes of the part to UINT_MAX.
+     *
+     * @param nodes[in] The nodes of the part.
+     * @param distances[in, out] The distances to reset.
+     */
+    static void resetDistances(const std::vector<unsigned int>& nodes, std::vector<unsigned int>& distances);
+
+    std::vector<unsigned int> firstNeighbour;
+    std::vector<unsigned int> neighbours;
+    std::vector<unsigned int> reverseNeighbour;
+    std::vector<unsigned int> owner;
+    unsigned int currentPart;
+    std::vector<unsigned int> reached;
+    std::vector<unsigned int> fromA;
+    std::vector<unsigned int> fromB;
+    std::vector<unsigned int> fromC;
+    std::vector<unsigned int> fromD;
+    std::vector<unsigned char> role;
+    std::vector<unsigned char> nodeFlow;
+    std::vector<int> edgeFlow;
+    std::vector<unsigned int> visited;
+    std::vector<unsigned int> parent;
+    std::vector<unsigned int> parentEdge;
+    unsigned int visitStamp;
+};
+
+#endif //SHORTEST_PATHS_NESTEDDISSECTION_H
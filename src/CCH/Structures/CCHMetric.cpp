@@ -0,0 +1,57 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Czech Technical University in Prague
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. */
+
+/******************************************************************************
+* File:             CCHMetric.cpp
+*****************************************************************************/
+
+#include <climits>
+#include "CCHMetric.h"
+
+//______________________________________________________________________________________________________________________
+FlagsGraph<NodeData>* CCHMetric::createFlagsGraph(const CCHTopology& topology) const {
+    auto* graph = new FlagsGraph<NodeData>(topology.nodes());
+    for (unsigned int rank = 0; rank < topology.nodes(); rank++) {
+        const unsigned int lower = topology.node(rank);
+        graph->data(lower).rank = rank;
+
+        for (unsigned int arc = topology.firstArc(rank); arc < topology.firstArc(rank + 1); arc++) {
+            const unsigned int upper = topology.node(topology.head(arc));
+            if (upWeights[arc] == downWeights[arc]) {
+                if (upWeights[arc] != UINT_MAX) {
+                    graph->addEdge(lower, upper, upWeights[arc], true, true);
+                }
+                continue;
+            }
+
+            if (upWeights[arc] != UINT_MAX) {
+                graph->addEdge(lower, upper, upWeights[arc], true, false);
+            }
+            if (downWeights[arc] != UINT_MAX) {
+                graph->addEdge(lower, upper, downWeights[arc], false, true);
+            }
+        }
+    }
+
+    return graph;
+}
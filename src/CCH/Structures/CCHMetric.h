@@ -0,0 +1,67 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Czech Technical University in Prague
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. */
+
+/******************************************************************************
+* File:             CCHMetric.h
+*
+* Description:      Arc weights of a customized Customizable Contraction Hierarchy
+*****************************************************************************/
+
+#ifndef SHORTEST_PATHS_CCHMETRIC_H
+#define SHORTEST_PATHS_CCHMETRIC_H
+
+#include <vector>
+#include "CCHTopology.h"
+#include "../../constants.h"
+#include "../../GraphBuilding/Structures/FlagsGraph.h"
+
+/**
+ * The weights of the arcs of a Customizable Contraction Hierarchy for one metric, created by the 'CCHCustomizer'.
+ * The metric is never modified after the customization, so it can be shared by any number of query managers and
+ * replaced by a newly customized one while the queries are running. The weight of every arc is the length of
+ * the shortest path between its endpoints that only uses lower ranked nodes, UINT_MAX if there is no such path.
+ */
+class CCHMetric {
+public:
+    /**
+     * Creates a FlagsGraph with the customized weights, so that the metric can be also used with the Contraction
+     * Hierarchies query algorithm ('CHDistanceQueryManager') or stored in the Contraction Hierarchies format.
+     * The arcs that can not be used in any direction are left out.
+     *
+     * @param topology[in] The topology the metric was customized for.
+     * @return A new FlagsGraph, the caller is responsible for deleting it.
+     */
+    FlagsGraph<NodeData>* createFlagsGraph(const CCHTopology& topology) const;
+
+    /**
+     * The weights for the arcs used from the lower to the upper endpoint.
+     */
+    std::vector<dist_t> upWeights;
+
+    /**
+     * The weights for the arcs used from the upper to the lower endpoint.
+     */
+    std::vector<dist_t> downWeights;
+};
+
+#endif //SHORTEST_PATHS_CCHMETRIC_H
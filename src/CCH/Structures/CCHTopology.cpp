@@ -0,0 +1,298 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Czech Technical University in Prague
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. */
+
+/******************************************************************************
+* File:             CCHTopology.cpp
+*****************************************************************************/
+
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include "CCHTopology.h"
+#include "../../Error/Error.h"
+
+namespace {
+    template <class T>
+    void writeArray(std::ostream& output, const std::vector<T>& values) {
+        output.write(reinterpret_cast<const char*>(values.data()), static_cast<std::streamsize>(values.size() * sizeof(T)));
+    }
+
+    template <class T>
+    void readArray(std::istream& input, std::vector<T>& values, size_t size) {
+        values.resize(size);
+        input.read(reinterpret_cast<char*>(values.data()), static_cast<std::streamsize>(size * sizeof(T)));
+    }
+}
+
+//______________________________________________________________________________________________________________________
+CCHTopology CCHTopology::build(const SimpleGraph& graph, std::vector<unsigned int> ranks) {
+    const unsigned int nodes = graph.nodes();
+    if (ranks.size() != nodes) {
+        throw std::invalid_argument("The contraction order must contain a rank for each node of the graph.");
+    }
+
+    CCHTopology topology;
+    topology.ranks = std::move(ranks);
+
+    // Every original edge is first stored at its lower ranked endpoint.
+    std::vector<std::vector<unsigned int>> upperNeighbours(nodes);
+    for (unsigned int from = 0; from < nodes; from++) {
+        for (const auto& edge : graph.edges(from)) {
+            if (edge.first != from) {
+                const unsigned int fromRank = topology.ranks[from];
+                const unsigned int toRank = topology.ranks[edge.first];
+                upperNeighbours[std::min(fromRank, toRank)].push_back(std::max(fromRank, toRank));
+            }
+        }
+    }
+
+    // Contracting a node connects all its upper neighbours with each other. It is enough to add them to the lowest
+    // of them (the parent), because the parent is contracted next out of them and passes the rest further up.
+    std::vector<unsigned int> merged;
+    for (unsigned int rank = 0; rank < nodes; rank++) {
+        auto& neighbours = upperNeighbours[rank];
+        std::sort(neighbours.begin(), neighbours.end());
+        neighbours.erase(std::unique(neighbours.begin(), neighbours.end()), neighbours.end());
+        if (neighbours.size() < 2) {
+            continue;
+        }
+
+        auto& parentNeighbours = upperNeighbours[neighbours[0]];
+        std::sort(parentNeighbours.begin(), parentNeighbours.end());
+        merged.clear();
+        std::set_union(neighbours.begin() + 1, neighbours.end(), parentNeighbours.begin(), parentNeighbours.end(),
+                       std::back_inserter(merged));
+        parentNeighbours.swap(merged);
+    }
+
+    topology.firstOut.resize(nodes + 1);
+    topology.firstOut[0] = 0;
+    for (unsigned int rank = 0; rank < nodes; rank++) {
+        topology.arcHead.insert(topology.arcHead.end(), upperNeighbours[rank].begin(), upperNeighbours[rank].end());
+        topology.firstOut[rank + 1] = static_cast<unsigned int>(topology.arcHead.size());
+        upperNeighbours[rank] = {};
+    }
+
+    topology.firstEdge.resize(nodes + 1);
+    topology.firstEdge[0] = 0;
+    for (unsigned int from = 0; from < nodes; from++) {
+        for (const auto& edge : graph.edges(from)) {
+            topology.edgeTargets.push_back(edge.first);
+        }
+        topology.firstEdge[from + 1] = static_cast<unsigned int>(topology.edgeTargets.size());
+    }
+
+    topology.edgeArcs.resize(topology.edgeTargets.size());
+    for (unsigned int from = 0; from < nodes; from++) {
+        for (unsigned int edge = topology.firstEdge[from]; edge < topology.firstEdge[from + 1]; edge++) {
+            const unsigned int to = topology.edgeTargets[edge];
+            if (to == from) {
+                topology.edgeArcs[edge] = NONE;
+                continue;
+            }
+
+            const unsigned int fromRank = topology.ranks[from];
+            const unsigned int toRank = topology.ranks[to];
+            const unsigned int lower = std::min(fromRank, toRank);
+            const auto begin = topology.arcHead.begin() + topology.firstOut[lower];
+            const auto end = topology.arcHead.begin() + topology.firstOut[lower + 1];
+            const auto arc = static_cast<unsigned int>(std::lower_bound(begin, end, std::max(fromRank, toRank))
+                - topology.arcHead.begin());
+            topology.edgeArcs[edge] = 2 * arc + (fromRank > toRank ? 1 : 0);
+        }
+    }
+
+    topology.initialize();
+    return topology;
+}
+
+//______________________________________________________________________________________________________________________
+void CCHTopology::initialize() {
+    const unsigned int nodes = static_cast<unsigned int>(ranks.size());
+
+    order.assign(nodes, NONE);
+    for (unsigned int node = 0; node < nodes; node++) {
+        if (ranks[node] >= nodes || order[ranks[node]] != NONE) {
+            throw std::runtime_error("The node ranks of the Customizable Contraction Hierarchy are not a permutation.");
+        }
+        order[ranks[node]] = node;
+    }
+
+    // The arcs are grouped by their upper endpoint. The lower endpoints are visited in increasing order, so the arcs
+    // of each group end up sorted by the lower endpoint.
+    firstIn.assign(nodes + 1, 0);
+    for (unsigned int head : arcHead) {
+        firstIn[head + 1]++;
+    }
+    for (unsigned int rank = 0; rank < nodes; rank++) {
+        firstIn[rank + 1] += firstIn[rank];
+    }
+    inArc.resize(arcHead.size());
+    inTail.resize(arcHead.size());
+    std::vector<unsigned int> position(firstIn.begin(), firstIn.end() - 1);
+    for (unsigned int rank = 0; rank < nodes; rank++) {
+        for (unsigned int arc = firstOut[rank]; arc < firstOut[rank + 1]; arc++) {
+            const unsigned int index = position[arcHead[arc]]++;
+            inArc[index] = arc;
+            inTail[index] = rank;
+        }
+    }
+
+    std::vector<unsigned int> height(nodes, 0);
+    unsigned int maxHeight = 0;
+    for (unsigned int rank = 0; rank < nodes; rank++) {
+        maxHeight = std::max(maxHeight, height[rank]);
+        for (unsigned int arc = firstOut[rank]; arc < firstOut[rank + 1]; arc++) {
+            height[arcHead[arc]] = std::max(height[arcHead[arc]], height[rank] + 1);
+        }
+    }
+
+    levelFirst.assign(nodes == 0 ? 1 : maxHeight + 2, 0);
+    for (unsigned int rank = 0; rank < nodes; rank++) {
+        levelFirst[height[rank] + 1]++;
+    }
+    for (size_t level = 1; level < levelFirst.size(); level++) {
+        levelFirst[level] += levelFirst[level - 1];
+    }
+    levelNode.resize(nodes);
+    position.assign(levelFirst.begin(), levelFirst.end() - 1);
+    for (unsigned int rank = 0; rank < nodes; rank++) {
+        levelNode[position[height[rank]]++] = rank;
+    }
+}
+
+//______________________________________________________________________________________________________________________
+unsigned int CCHTopology::edgeSource(const unsigned int edge) const {
+    return static_cast<unsigned int>(std::upper_bound(firstEdge.begin(), firstEdge.end(), edge) - firstEdge.begin()) - 1;
+}
+
+//______________________________________________________________________________________________________________________
+unsigned int CCHTopology::edgeIndex(const unsigned int from, const unsigned int to) const {
+    if (from >= nodes()) {
+        return NONE;
+    }
+
+    const auto begin = edgeTargets.begin() + firstEdge[from];
+    const auto end = edgeTargets.begin() + firstEdge[from + 1];
+    const auto edge = std::lower_bound(begin, end, to);
+    return edge != end && *edge == to ? static_cast<unsigned int>(edge - edgeTargets.begin()) : NONE;
+}
+
+//______________________________________________________________________________________________________________________
+std::vector<dist_t> CCHTopology::edgeWeights(const SimpleGraph& graph) const {
+    if (graph.nodes() != nodes()) {
+        throw input_error("The graph has " + std::to_string(graph.nodes()) + " nodes, but the Customizable "
+                          "Contraction Hierarchy has " + std::to_string(nodes()) + " nodes.\n");
+    }
+
+    std::vector<dist_t> weights(edges(), UINT_MAX);
+    for (unsigned int from = 0; from < graph.nodes(); from++) {
+        for (const auto& edge : graph.edges(from)) {
+            const unsigned int index = edgeIndex(from, edge.first);
+            if (index == NONE) {
+                throw input_error("The edge from " + std::to_string(from) + " to " + std::to_string(edge.first) +
+                                  " is not present in the Customizable Contraction Hierarchy, new edges can not be "
+                                  "added by the customization.\n");
+            }
+            weights[index] = edge.second;
+        }
+    }
+
+    return weights;
+}
+
+//______________________________________________________________________________________________________________________
+size_t CCHTopology::memoryUsage() const {
+    size_t values = 0;
+    for (const auto* array : {&ranks, &order, &firstOut, &arcHead, &firstIn, &inArc, &inTail, &levelFirst, &levelNode,
+                              &firstEdge, &edgeTargets, &edgeArcs}) {
+        values += array->size();
+    }
+    return values * sizeof(unsigned int);
+}
+
+//______________________________________________________________________________________________________________________
+void CCHTopology::write(std::ostream& output, const std::vector<dist_t>& weights) const {
+    static_assert(sizeof(dist_t) == sizeof(unsigned int), "The weights are stored as 32-bit values.");
+    if (weights.size() != edges()) {
+        throw std::invalid_argument("A weight must be given for each original edge.");
+    }
+
+    const unsigned int nodesCnt = nodes();
+    const unsigned int edgesCnt = edges();
+    const unsigned int arcsCnt = arcs();
+
+    output.write("CCH1", 4);
+    output.write(reinterpret_cast<const char*>(&nodesCnt), sizeof(nodesCnt));
+    output.write(reinterpret_cast<const char*>(&edgesCnt), sizeof(edgesCnt));
+    output.write(reinterpret_cast<const char*>(&arcsCnt), sizeof(arcsCnt));
+    writeArray(output, ranks);
+    writeArray(output, firstEdge);
+    writeArray(output, edgeTargets);
+    writeArray(output, weights);
+    writeArray(output, firstOut);
+    writeArray(output, arcHead);
+    writeArray(output, edgeArcs);
+}
+
+//______________________________________________________________________________________________________________________
+CCHTopology CCHTopology::read(std::istream& input, std::vector<dist_t>& weights) {
+    char header[4];
+    input.read(header, sizeof(header));
+    if (!input || header[0] != 'C' || header[1] != 'C' || header[2] != 'H' || header[3] != '1') {
+        throw std::runtime_error("The input file is missing the Customizable Contraction Hierarchy header.");
+    }
+
+    unsigned int nodesCnt;
+    unsigned int edgesCnt;
+    unsigned int arcsCnt;
+    input.read(reinterpret_cast<char*>(&nodesCnt), sizeof(nodesCnt));
+    input.read(reinterpret_cast<char*>(&edgesCnt), sizeof(edgesCnt));
+    input.read(reinterpret_cast<char*>(&arcsCnt), sizeof(arcsCnt));
+    if (!input || nodesCnt == UINT_MAX) {
+        throw std::runtime_error("The Customizable Contraction Hierarchy header is corrupted.");
+    }
+
+    CCHTopology topology;
+    readArray(input, topology.ranks, nodesCnt);
+    readArray(input, topology.firstEdge, static_cast<size_t>(nodesCnt) + 1);
+    readArray(input, topology.edgeTargets, edgesCnt);
+    readArray(input, weights, edgesCnt);
+    readArray(input, topology.firstOut, static_cast<size_t>(nodesCnt) + 1);
+    readArray(input, topology.arcHead, arcsCnt);
+    readArray(input, topology.edgeArcs, edgesCnt);
+    if (!input) {
+        throw std::runtime_error("The Customizable Contraction Hierarchy file is truncated.");
+    }
+
+    if (topology.firstEdge.back() != edgesCnt || topology.firstOut.back() != arcsCnt
+        || std::any_of(topology.arcHead.begin(), topology.arcHead.end(), [nodesCnt](unsigned int head) {
+            return head >= nodesCnt;
+        })) {
+        throw std::runtime_error("The Customizable Contraction Hierarchy file is corrupted.");
+    }
+
+    topology.initialize();
+    return topology;
+}
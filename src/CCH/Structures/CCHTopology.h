@@ -0,0 +1,267 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Czech Technical University in Prague
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. */
+
+/******************************************************************************
+* File:             CCHTopology.h
+*
+* Description:      Metric-independent part of the Customizable Contraction Hierarchies
+*****************************************************************************/
+
+#ifndef SHORTEST_PATHS_CCHTOPOLOGY_H
+#define SHORTEST_PATHS_CCHTOPOLOGY_H
+
+#include <climits>
+#include <istream>
+#include <ostream>
+#include <vector>
+#include "../../constants.h"
+#include "../../GraphBuilding/Structures/SimpleGraph.h"
+
+/**
+ * The structure of a Customizable Contraction Hierarchy: the contraction order and all the edges (arcs) that are
+ * created when the nodes are contracted in that order for any metric. Unlike the Contraction Hierarchies created by
+ * the 'CHPreprocessor', the shortcuts are not chosen using the weights, so the structure only has to be computed
+ * once and the weights can then be changed by the much faster customization (see 'CCHCustomizer').
+ *
+ * The nodes are stored by their ranks and every arc is stored at its lower ranked endpoint, the arcs of a node are
+ * sorted by the rank of the upper endpoint. The arcs are undirected, the metric stores a weight for each direction.
+ * The lowest ranked upper neighbour of a node is its parent in the elimination tree, all the upper neighbours of
+ * a node are its ancestors in this tree.
+ *
+ * The topology also contains the edges of the original graph (the distinct directed edges sorted by their source
+ * and target node), because the weights given to the customization belong to those edges.
+ */
+class CCHTopology {
+public:
+    /**
+     * Value used for the original self-loops that do not belong to any arc and for the nodes without a parent.
+     */
+    static constexpr unsigned int NONE = UINT_MAX;
+
+    /**
+     * Creates an empty topology.
+     */
+    CCHTopology() = default;
+
+    /**
+     * Computes the arcs created by contracting the nodes of the graph in the given order.
+     *
+     * @param graph[in] The original graph.
+     * @param ranks[in] The contraction order, 'ranks[i]' is the rank of the node 'i'. It should be computed by the
+     * 'NestedDissection', any other permutation works too, but can create many more arcs.
+     * @return The topology.
+     */
+    static CCHTopology build(const SimpleGraph& graph, std::vector<unsigned int> ranks);
+
+    /**
+     * @return The number of nodes.
+     */
+    unsigned int nodes() const {
+        return static_cast<unsigned int>(order.size());
+    }
+
+    /**
+     * @return The number of arcs (the original edges together with the shortcuts, each pair of nodes only once).
+     */
+    unsigned int arcs() const {
+        return static_cast<unsigned int>(arcHead.size());
+    }
+
+    /**
+     * @return The number of the original edges.
+     */
+    unsigned int edges() const {
+        return static_cast<unsigned int>(edgeTargets.size());
+    }
+
+    /**
+     * @param node[in] The node ID.
+     * @return The rank of the node.
+     */
+    unsigned int rank(const unsigned int node) const {
+        return ranks[node];
+    }
+
+    /**
+     * @param rank[in] The rank.
+     * @return The node with the given rank.
+     */
+    unsigned int node(const unsigned int rank) const {
+        return order[rank];
+    }
+
+    /**
+     * @param rank[in] The rank of the node.
+     * @return The index of the first arc of the node, the arcs of the node end at 'firstArc(rank + 1)'.
+     */
+    unsigned int firstArc(const unsigned int rank) const {
+        return firstOut[rank];
+    }
+
+    /**
+     * @param arc[in] The arc index.
+     * @return The rank of the upper endpoint of the arc.
+     */
+    unsigned int head(const unsigned int arc) const {
+        return arcHead[arc];
+    }
+
+    /**
+     * @param rank[in] The rank of the node.
+     * @return The rank of the parent of the node in the elimination tree or NONE for the roots.
+     */
+    unsigned int parent(const unsigned int rank) const {
+        return firstOut[rank] == firstOut[rank + 1] ? NONE : arcHead[firstOut[rank]];
+    }
+
+    /**
+     * @param rank[in] The rank of the node.
+     * @return The index of the first arc ending in the node in 'lowerArcs', the arcs end at 'firstLowerArc(rank + 1)'.
+     */
+    unsigned int firstLowerArc(const unsigned int rank) const {
+        return firstIn[rank];
+    }
+
+    /**
+     * @param index[in] The index between 'firstLowerArc(rank)' and 'firstLowerArc(rank + 1)'.
+     * @return The arc index of an arc ending in the node, the arcs are sorted by the rank of their lower endpoint.
+     */
+    unsigned int lowerArc(const unsigned int index) const {
+        return inArc[index];
+    }
+
+    /**
+     * @param index[in] The index between 'firstLowerArc(rank)' and 'firstLowerArc(rank + 1)'.
+     * @return The rank of the lower endpoint of the arc 'lowerArc(index)'.
+     */
+    unsigned int lowerArcTail(const unsigned int index) const {
+        return inTail[index];
+    }
+
+    /**
+     * @return The nodes (ranks) grouped by their height in the elimination tree, the group 'i' spans the indices from
+     * 'levelStart()[i]' to 'levelStart()[i + 1]' of 'levelNodes()'. All the lower neighbours of a node belong to
+     * the lower groups, so the nodes of one group can be customized in parallel.
+     */
+    const std::vector<unsigned int>& levelStart() const {
+        return levelFirst;
+    }
+
+    /**
+     * @return The nodes (ranks) sorted by their height in the elimination tree, see 'levelStart'.
+     */
+    const std::vector<unsigned int>& levelNodes() const {
+        return levelNode;
+    }
+
+    /**
+     * @param edge[in] The index of the original edge.
+     * @return The source node of the edge.
+     */
+    unsigned int edgeSource(unsigned int edge) const;
+
+    /**
+     * @param edge[in] The index of the original edge.
+     * @return The target node of the edge.
+     */
+    unsigned int edgeTarget(const unsigned int edge) const {
+        return edgeTargets[edge];
+    }
+
+    /**
+     * Finds the arc of an original edge.
+     *
+     * @param edge[in] The index of the original edge.
+     * @return The arc index multiplied by two, plus one if the edge goes from the upper to the lower endpoint of
+     * the arc. NONE for self-loops.
+     */
+    unsigned int edgeArc(const unsigned int edge) const {
+        return edgeArcs[edge];
+    }
+
+    /**
+     * Finds an original edge.
+     *
+     * @param from[in] The source node.
+     * @param to[in] The target node.
+     * @return The index of the edge or NONE if the graph does not contain such edge.
+     */
+    unsigned int edgeIndex(unsigned int from, unsigned int to) const;
+
+    /**
+     * Creates the weight vector for the customization from a graph with the same nodes, for example the original graph
+     * loaded with the current travel times. The edges missing in the graph get the weight UINT_MAX, so they are
+     * treated as closed.
+     *
+     * @param graph[in] The graph with the current weights.
+     * @return The weights of all the original edges.
+     */
+    std::vector<dist_t> edgeWeights(const SimpleGraph& graph) const;
+
+    /**
+     * @return The number of bytes occupied by the topology.
+     */
+    size_t memoryUsage() const;
+
+    /**
+     * Writes the topology together with a weight for every original edge in a binary format. The format starts with
+     * the 'CCH1' header followed by the number of nodes, original edges and arcs (all 32-bit). Then the ranks of
+     * the nodes, the offsets of the edges of each node (nodes + 1 values), the edge targets, the edge weights,
+     * the offsets of the arcs of each rank (nodes + 1 values), the arc heads and the edge arcs follow, all of them
+     * as 32-bit values.
+     *
+     * @param output[in, out] The binary stream the topology will be written to.
+     * @param weights[in] The weights of the original edges.
+     */
+    void write(std::ostream& output, const std::vector<dist_t>& weights) const;
+
+    /**
+     * Reads the topology written by 'write'.
+     *
+     * @param input[in, out] The binary stream the topology will be read from.
+     * @param weights[out] The weights of the original edges stored with the topology.
+     * @return The loaded topology.
+     */
+    static CCHTopology read(std::istream& input, std::vector<dist_t>& weights);
+
+private:
+    /**
+     * Computes the order, the lower arcs and the levels from the stored arrays.
+     */
+    void initialize();
+
+    std::vector<unsigned int> ranks;
+    std::vector<unsigned int> order;
+    std::vector<unsigned int> firstOut;
+    std::vector<unsigned int> arcHead;
+    std::vector<unsigned int> firstIn;
+    std::vector<unsigned int> inArc;
+    std::vector<unsigned int> inTail;
+    std::vector<unsigned int> levelFirst;
+    std::vector<unsigned int> levelNode;
+    std::vector<unsigned int> firstEdge;
+    std::vector<unsigned int> edgeTargets;
+    std::vector<unsigned int> edgeArcs;
+};
+
+#endif //SHORTEST_PATHS_CCHTOPOLOGY_H
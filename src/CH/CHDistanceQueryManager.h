@@ -33,22 +33,29 @@
 #include <vector>
 #include <queue>
 #include "../GraphBuilding/Structures/FlagsGraph.h"
+#include "Structures/CHSearchState.h"
+#include "Structures/QueryStatistics.h"
 
 
 
 /**
  * This class is responsible for the Contraction Hierarchies 'distance' queries - when we only require the 'distance'
- * between two points and do not care about the actual path.
+ * between two points and do not care about the actual path. The graph is a FlagsGraph by default, the
+ * CompressedFlagsGraph (or any class with the same 'nodes', 'nextNodes' and 'data' functions) can be used instead.
+ *
+ * The information changed by the queries is kept in the manager, the graph is only read. Any number of managers (one
+ * for each thread) can therefore share one graph, but one manager must not be used by two threads at once.
  */
-template <class T = NodeData>
+template <class T = NodeData, class G = FlagsGraph<T>>
 class CHDistanceQueryManager {
 public:
     /**
      * A simple constructor.
      *
-     * @param g[in] The FlagsGraph instance we will be using to answer shortest distance queries.
+     * @param g[in] The graph instance we will be using to answer shortest distance queries, it must outlive the
+     * manager.
      */
-    CHDistanceQueryManager(FlagsGraph<T>& g);
+    CHDistanceQueryManager(const G& g);
 
     /**
      * We use the query algorithm that was described in the "Contraction Hierarchies: Faster and Simpler Hierarchical
@@ -56,7 +63,9 @@ public:
      * Basically, the query is a modified bidirectional Dijkstra query, where from the start node we only expand
      * following nodes with higher contraction rank than the current node and from the goal we only expand previous
      * nodes with higher contraction rank than the current node. Both scopes will eventually meet in the node with the
-     * highest contraction rank from all nodes in the path.
+     * highest contraction rank from all nodes in the path. Nodes that are provably reached by a suboptimal path are
+     * not expanded (stall-on-demand), the direction with the smaller queue key is always expanded first and each
+     * direction stops once its smallest key reaches the length of the best path found so far.
      *
      * @param start[in] The start node for the query.
      * @param goal[in] The goal node for the query.
@@ -64,7 +73,34 @@ public:
      */
     unsigned int findDistance(const unsigned int start, const unsigned int goal);
 
+    /**
+     * Enables or disables the collection of the search statistics. When enabled, the following queries add their
+     * counters to the given instance, which is not reset between the queries.
+     *
+     * @param queryStatistics[in] The instance the counters are added to, or nullptr to disable the collection.
+     */
+    void setStatistics(QueryStatistics* queryStatistics);
+
 protected:
+    /**
+     * Checks whether the node can be stalled in the forward search, that is whether some of its neighbours reached by
+     * the forward search together with the edge from that neighbour to the node give a path shorter than 'distance'.
+     *
+     * @param node[in] The node that is about to be settled.
+     * @param distance[in] The current forward distance of the node.
+     * @return True if the node does not have to be expanded.
+     */
+    bool forwardStallable(const unsigned int node, const unsigned int distance);
+
+    /**
+     * The backward counterpart of 'forwardStallable'.
+     *
+     * @param node[in] The node that is about to be settled.
+     * @param distance[in] The current backward distance of the node.
+     * @return True if the node does not have to be expanded.
+     */
+    bool backwardStallable(const unsigned int node, const unsigned int distance);
+
     /**
      * Reset information for the nodes that were changed in the current query. This is required so that following
      * queries are not influenced by the current query. Using this function ensures that following queries also
@@ -72,14 +108,18 @@ protected:
      */
     void prepareStructuresForNextQuery();
 
-    FlagsGraph<T>& graph;
+    const G& graph;
+    std::vector<CHSearchState> searchState;
     unsigned int upperbound;
     std::vector<unsigned int> forwardChanged;
     std::vector<unsigned int> backwardChanged;
     std::vector<unsigned int> forwardStallChanged;
     std::vector<unsigned int> backwardStallChanged;
+    QueryStatistics* statistics;
 };
 
+template <class T> CHDistanceQueryManager(const FlagsGraph<T>&) -> CHDistanceQueryManager<T>;
+
 #include "CHDistanceQueryManager.tpp"
 
 #endif //TRANSIT_NODE_ROUTING_CHFLAGSGRAPHQUERYMANAGER_H
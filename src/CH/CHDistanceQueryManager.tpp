@@ -7,79 +7,91 @@
 #include "../Dijkstra/DijkstraNode.h"
 
 //______________________________________________________________________________________________________________________
-template<class T> CHDistanceQueryManager<T>::CHDistanceQueryManager(FlagsGraph<T>& g) : graph(g) {
+template<class T, class G> CHDistanceQueryManager<T, G>::CHDistanceQueryManager(const G& g) : graph(g), searchState(g.nodes()), statistics(nullptr) {
 
 }
 
 //______________________________________________________________________________________________________________________
-template<class T> unsigned int CHDistanceQueryManager<T>::findDistance(const unsigned int start, const unsigned int goal) {
+template<class T, class G> void CHDistanceQueryManager<T, G>::setStatistics(QueryStatistics* queryStatistics) {
+    statistics = queryStatistics;
+}
+
+//______________________________________________________________________________________________________________________
+template<class T, class G> unsigned int CHDistanceQueryManager<T, G>::findDistance(const unsigned int start, const unsigned int goal) {
     auto cmp = [](DijkstraNode left, DijkstraNode right) { return (left.weight) > (right.weight);};
     std::priority_queue<DijkstraNode, std::vector<DijkstraNode>, decltype(cmp)> forwardQ(cmp);
     std::priority_queue<DijkstraNode, std::vector<DijkstraNode>, decltype(cmp)> backwardQ(cmp);
 
     forwardQ.push(DijkstraNode(start, 0));
     backwardQ.push(DijkstraNode(goal, 0));
+    COUNT_QUERY_STATISTIC(statistics, heapPushes, 2);
 
     bool forwardFinished = false;
     bool backwardFinished = false;
 
-    graph.data(start).forwardDist = 0;
-    graph.data(goal).backwardDist = 0;
+    searchState[start].forwardDist = 0;
+    searchState[goal].backwardDist = 0;
     forwardChanged.push_back(start);
     backwardChanged.push_back(goal);
-    graph.data(start).forwardReached = true;
-    graph.data(goal).backwardReached = true;
+    searchState[start].forwardReached = true;
+    searchState[goal].backwardReached = true;
 
-    bool forward = false;
     upperbound = UINT_MAX;
 
-    while (! (forwardQ.empty() && backwardQ.empty())) {
-        // Determine the search direction for the current iteration (forward of backward)
-        // The directions take turns unless one of the directions is already finished (that means either the first
-        // element in the priority queue already has weight bigger than the upperbound or the queue in that direction
-        // doesn't contain any more elements).
-        if (forwardFinished || forwardQ.empty()) {
-            forward = false;
-        } else if (backwardFinished || backwardQ.empty()) {
-            forward = true;
-        } else {
-            forward = ! forward;
+    while (! (forwardFinished && backwardFinished)) {
+        // A direction is finished when its queue is empty or when its smallest key is not smaller than the upperbound,
+        // because then no node it could still settle can improve the upperbound. Out of the unfinished directions,
+        // we always continue with the one with the smaller key, so that both searches grow at the same distance.
+        if (! forwardFinished && (forwardQ.empty() || forwardQ.top().weight >= upperbound)) {
+            forwardFinished = true;
+        }
+        if (! backwardFinished && (backwardQ.empty() || backwardQ.top().weight >= upperbound)) {
+            backwardFinished = true;
+        }
+        if (forwardFinished && backwardFinished) {
+            break;
         }
 
-        if (forward) {
-            if (forwardQ.empty()) {
-                break;
-            }
+        bool forward = ! forwardFinished && (backwardFinished || forwardQ.top().weight <= backwardQ.top().weight);
 
+        if (forward) {
             unsigned int curNode = forwardQ.top().ID;
             unsigned int curLen = forwardQ.top().weight;
             forwardQ.pop();
 
-            if (graph.data(curNode).forwardSettled || graph.data(curNode).forwardStalled) {
+            // Skip nodes that were already settled and queue entries that were superseded by a shorter distance.
+            if (searchState[curNode].forwardSettled || curLen > searchState[curNode].forwardDist) {
                 continue;
             }
 
+            // Stall-on-demand: if the node can be reached through a higher ranked node (using the edge from that node
+            // in the downward direction) by a path shorter than 'curLen', the current distance is not the shortest
+            // one and no shortest path found by the upward search can continue through this node, so we do not
+            // expand it. The node can still be unstalled later if it is reached by a path short enough.
+            if (searchState[curNode].forwardStalled) {
+                continue;
+            }
+            if (forwardStallable(curNode, curLen)) {
+                searchState[curNode].forwardStalled = true;
+                forwardStallChanged.push_back(curNode);
+                COUNT_QUERY_STATISTIC(statistics, stalledNodes, 1);
+                continue;
+            }
 
-            graph.data(curNode).forwardSettled = true;
-            // Check if the node was already settled in the opposite direction - if yes, we get a new candidate
+            searchState[curNode].forwardSettled = true;
+            COUNT_QUERY_STATISTIC(statistics, settledNodes, 1);
+            // Check if the node was already reached in the opposite direction - if yes, we get a new candidate
             // for the shortest path.
-            if ( graph.data(curNode).backwardSettled ) {
-                unsigned int newUpperboundCandidate = curLen +  graph.data(curNode).backwardDist;
+            if (searchState[curNode].backwardReached) {
+                unsigned int newUpperboundCandidate = curLen + searchState[curNode].backwardDist;
                 if (newUpperboundCandidate < upperbound) {
                     upperbound = newUpperboundCandidate;
                 }
             }
 
             // Classic edges relaxation
-            const std::vector<QueryEdge> & neighbours = graph.nextNodes(curNode);
+            const auto & neighbours = graph.nextNodes(curNode);
             for(auto iter = neighbours.begin(); iter != neighbours.end(); ++iter) {
-                if ((*iter).backward && graph.data((*iter).targetNode).forwardReached) {
-                    unsigned int newdistance = graph.data((*iter).targetNode).forwardDist + (*iter).weight;
-                    if (newdistance < curLen) {
-                        graph.data(curNode).forwardDist = newdistance;
-                    }
-                }
-
                 if (! (*iter).forward) {
                     continue;
                 }
@@ -88,81 +100,72 @@ template<class T> unsigned int CHDistanceQueryManager<T>::findDistance(const uns
                 // if it was stalled previously, because it might be now reached on the optimal path.
                 if (graph.data((*iter).targetNode).rank > graph.data(curNode).rank) {
                     unsigned int newlen = curLen + (*iter).weight;
+                    COUNT_QUERY_STATISTIC(statistics, relaxedEdges, 1);
 
-                    if (newlen < graph.data((*iter).targetNode).forwardDist) {
+                    if (newlen < searchState[(*iter).targetNode].forwardDist) {
                         forwardQ.push(DijkstraNode((*iter).targetNode, newlen));
-                        if (graph.data((*iter).targetNode).forwardDist == UINT_MAX) {
+                        COUNT_QUERY_STATISTIC(statistics, heapPushes, 1);
+                        if (searchState[(*iter).targetNode].forwardDist == UINT_MAX) {
                             forwardChanged.push_back((*iter).targetNode);
                         }
-                        graph.data((*iter).targetNode).forwardDist = newlen;
-                        graph.data((*iter).targetNode).forwardReached = true;
-                        graph.data((*iter).targetNode).forwardStalled = false;
+                        searchState[(*iter).targetNode].forwardDist = newlen;
+                        searchState[(*iter).targetNode].forwardReached = true;
+                        searchState[(*iter).targetNode].forwardStalled = false;
                     }
                 }
             }
-
-            if(! forwardQ.empty() && forwardQ.top().weight > upperbound) {
-                forwardFinished = true;
-            }
             // The backward direction is symmetrical to the forward direction.
         } else {
-            if (backwardQ.empty()) {
-                break;
-            }
-
             unsigned int curNode = backwardQ.top().ID;
             unsigned int curLen = backwardQ.top().weight;
             backwardQ.pop();
 
-            if (graph.data(curNode).backwardSettled || graph.data(curNode).backwardStalled) {
+            if (searchState[curNode].backwardSettled || curLen > searchState[curNode].backwardDist) {
                 continue;
             }
 
-            graph.data(curNode).backwardSettled = true;
-            if (graph.data(curNode).forwardSettled) {
-                unsigned int newUpperboundCandidate = curLen + graph.data(curNode).forwardDist;
+            if (searchState[curNode].backwardStalled) {
+                continue;
+            }
+            if (backwardStallable(curNode, curLen)) {
+                searchState[curNode].backwardStalled = true;
+                backwardStallChanged.push_back(curNode);
+                COUNT_QUERY_STATISTIC(statistics, stalledNodes, 1);
+                continue;
+            }
+
+            searchState[curNode].backwardSettled = true;
+            COUNT_QUERY_STATISTIC(statistics, settledNodes, 1);
+            if (searchState[curNode].forwardReached) {
+                unsigned int newUpperboundCandidate = curLen + searchState[curNode].forwardDist;
                 if (newUpperboundCandidate < upperbound) {
                     upperbound = newUpperboundCandidate;
                 }
             }
 
-            const std::vector<QueryEdge> & neighbours = graph.nextNodes(curNode);
+            const auto & neighbours = graph.nextNodes(curNode);
             for(auto iter = neighbours.begin(); iter != neighbours.end(); ++iter) {
-                if ((*iter).forward && graph.data((*iter).targetNode).backwardReached) {
-                    unsigned int newdistance = graph.data((*iter).targetNode).backwardDist + (*iter).weight;
-                    if (newdistance < curLen) {
-                        graph.data(curNode).backwardDist = newdistance;
-                    }
-                }
-
                 if (! (*iter).backward) {
                     continue;
                 }
 
                 if(graph.data((*iter).targetNode).rank > graph.data(curNode).rank) {
                     unsigned int newlen = curLen + (*iter).weight;
+                    COUNT_QUERY_STATISTIC(statistics, relaxedEdges, 1);
 
-                    if (newlen < graph.data((*iter).targetNode).backwardDist) {
+                    if (newlen < searchState[(*iter).targetNode].backwardDist) {
                         backwardQ.push(DijkstraNode((*iter).targetNode, newlen));
-                        if (graph.data((*iter).targetNode).backwardDist == UINT_MAX) {
+                        COUNT_QUERY_STATISTIC(statistics, heapPushes, 1);
+                        if (searchState[(*iter).targetNode].backwardDist == UINT_MAX) {
                             backwardChanged.push_back((*iter).targetNode);
                         }
-                        graph.data((*iter).targetNode).backwardDist = newlen;
-                        graph.data((*iter).targetNode).backwardReached = true;
-                        graph.data((*iter).targetNode).backwardStalled = false;
+                        searchState[(*iter).targetNode].backwardDist = newlen;
+                        searchState[(*iter).targetNode].backwardReached = true;
+                        searchState[(*iter).targetNode].backwardStalled = false;
                     }
                 }
             }
-
-            if(! backwardQ.empty() && backwardQ.top().weight > upperbound) {
-                backwardFinished = true;
-            }
-        }
-
-        if (backwardFinished && forwardFinished) {
-            break;
         }
-
     }
 
     prepareStructuresForNextQuery();
@@ -171,24 +174,48 @@ template<class T> unsigned int CHDistanceQueryManager<T>::findDistance(const uns
 }
 
 //______________________________________________________________________________________________________________________
-template<class T> void CHDistanceQueryManager<T>::prepareStructuresForNextQuery() {
+template<class T, class G> bool CHDistanceQueryManager<T, G>::forwardStallable(const unsigned int node, const unsigned int distance) {
+    const auto & neighbours = graph.nextNodes(node);
+    for(auto iter = neighbours.begin(); iter != neighbours.end(); ++iter) {
+        if ((*iter).backward && searchState[(*iter).targetNode].forwardReached
+            && searchState[(*iter).targetNode].forwardDist + (*iter).weight < distance) {
+            return true;
+        }
+    }
+    return false;
+}
+
+//______________________________________________________________________________________________________________________
+template<class T, class G> bool CHDistanceQueryManager<T, G>::backwardStallable(const unsigned int node, const unsigned int distance) {
+    const auto & neighbours = graph.nextNodes(node);
+    for(auto iter = neighbours.begin(); iter != neighbours.end(); ++iter) {
+        if ((*iter).forward && searchState[(*iter).targetNode].backwardReached
+            && searchState[(*iter).targetNode].backwardDist + (*iter).weight < distance) {
+            return true;
+        }
+    }
+    return false;
+}
+
+//______________________________________________________________________________________________________________________
+template<class T, class G> void CHDistanceQueryManager<T, G>::prepareStructuresForNextQuery() {
     for(size_t i = 0; i < forwardChanged.size(); i++) {
-        graph.resetForwardInfo(forwardChanged[i]);
+        searchState[forwardChanged[i]].resetForwardInfo();
     }
     forwardChanged.clear();
 
     for(size_t i = 0; i < backwardChanged.size(); i++) {
-       graph.resetBackwardInfo(backwardChanged[i]);
+        searchState[backwardChanged[i]].resetBackwardInfo();
     }
     backwardChanged.clear();
 
     for(size_t i = 0; i < forwardStallChanged.size(); i++) {
-        graph.resetForwardStall(forwardStallChanged[i]);
+        searchState[forwardStallChanged[i]].forwardStalled = false;
     }
     forwardStallChanged.clear();
 
     for(size_t i = 0; i < backwardStallChanged.size(); i++) {
-        graph.resetBackwardStall(backwardStallChanged[i]);
+        searchState[backwardStallChanged[i]].backwardStalled = false;
     }
     backwardStallChanged.clear();
 }
\ No newline at end of file
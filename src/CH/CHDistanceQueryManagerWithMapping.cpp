@@ -26,18 +26,43 @@
 // Created on: 31.07.19
 //
 
-#include "../GraphBuilding/Loaders/XenGraphLoader.h"
+#include "../GraphBuilding/Loaders/NodeMappingLoader.h"
 #include "CHDistanceQueryManagerWithMapping.h"
 
 // Initializes the query manager. Here, the mapping from the original indices to our indices is loaded.
 //______________________________________________________________________________________________________________________
-CHDistanceQueryManagerWithMapping::CHDistanceQueryManagerWithMapping(FlagsGraph<NodeData>& g, std::string mappingFilepath) : qm(g) {
-    XenGraphLoader mappingLoader(mappingFilepath);
-    mappingLoader.loadNodesMapping(mapping);
+CHDistanceQueryManagerWithMapping::CHDistanceQueryManagerWithMapping(
+        FlagsGraph<NodeData>& g,
+        std::string mappingFilepath,
+        const SimplificationTable* simplification) : qm(g), simplification(simplification) {
+    NodeMappingLoader mappingLoader(mappingFilepath);
+    mapping = mappingLoader.loadMapping(simplification ? simplification->nodes() : g.nodes());
 }
 
 // Used to find the shortest distance from start to goal where start and goal are the original indices.
 //______________________________________________________________________________________________________________________
 unsigned int CHDistanceQueryManagerWithMapping::findDistance(const long long unsigned int start, const long long unsigned int goal) {
-    return qm.findDistance(mapping.at(start), mapping.at(goal));
-}
\ No newline at end of file
+    const unsigned int internalStart = mapping.internalID(start);
+    const unsigned int internalGoal = mapping.internalID(goal);
+    if (simplification) {
+        return simplification->findDistance(internalStart, internalGoal, [this](unsigned int from, unsigned int to) {
+            return qm.findDistance(from, to);
+        });
+    }
+    return qm.findDistance(internalStart, internalGoal);
+}
+
+//______________________________________________________________________________________________________________________
+void CHDistanceQueryManagerWithMapping::setStatistics(QueryStatistics* queryStatistics) {
+    qm.setStatistics(queryStatistics);
+}
+
+//______________________________________________________________________________________________________________________
+unsigned int CHDistanceQueryManagerWithMapping::internalID(const long long unsigned int originalID) const {
+    return mapping.internalID(originalID);
+}
+
+//______________________________________________________________________________________________________________________
+long long unsigned int CHDistanceQueryManagerWithMapping::originalID(const unsigned int internalID) const {
+    return mapping.originalID(internalID);
+}
@@ -33,7 +33,8 @@
 #include "../GraphBuilding/Structures/FlagsGraph.h"
 #include "CHDistanceQueryManager.h"
 #include <string>
-#include <unordered_map>
+#include "../GraphBuilding/Structures/NodeMapping.h"
+#include "../GraphBuilding/Simplification/SimplificationTable.h"
 
 
 
@@ -51,8 +52,14 @@ public:
      * @param g[in] The Contraction Hierarchies data structure that will be used to answer queries.
      * @param mappingFilepath[in] The path to the file that contains the mapping from original indices to indices
      * in the data structure.
+     * @param simplification[in] The simplification table of the data structure, or nullptr if it was preprocessed
+     * without the simplification. With the table, the mapping leads to the nodes of the graph before the
+     * simplification. The table must outlive the query manager.
      */
-    CHDistanceQueryManagerWithMapping(FlagsGraph<NodeData>& g, std::string mappingFilepath);
+    CHDistanceQueryManagerWithMapping(
+            FlagsGraph<NodeData>& g,
+            std::string mappingFilepath,
+            const SimplificationTable* simplification = nullptr);
 
     /**
      * Used to find the shortest distance from start to goal where start and goal are the original indices.
@@ -64,9 +71,33 @@ public:
      */
     unsigned int findDistance(const long long unsigned int start, const long long unsigned int goal);
 
+    /**
+     * Enables or disables the collection of the search statistics, see 'setStatistics' of the underlying query manager.
+     *
+     * @param queryStatistics[in] The instance the counters are added to, or nullptr to disable the collection.
+     */
+    void setStatistics(QueryStatistics* queryStatistics);
+
+    /**
+     * Translates an original node ID to the ID used in the data structure.
+     *
+     * @param originalID[in] The original ID of the node.
+     * @return The ID of the node in the data structure. Throws std::out_of_range for unknown IDs.
+     */
+    unsigned int internalID(const long long unsigned int originalID) const;
+
+    /**
+     * Translates an ID used in the data structure back to the original ID of the node.
+     *
+     * @param internalID[in] The ID of the node in the data structure.
+     * @return The original ID of the node.
+     */
+    long long unsigned int originalID(const unsigned int internalID) const;
+
 private:
     CHDistanceQueryManager<NodeData> qm;
-    std::unordered_map<long long unsigned int, unsigned int> mapping;
+    NodeMapping mapping;
+    const SimplificationTable* simplification;
 };
 
 
@@ -33,7 +33,8 @@
 #include "../GraphBuilding/Structures/constants_defines.h"
 
 //______________________________________________________________________________________________________________________
-CHPathQueryManager::CHPathQueryManager(FlagsGraphWithUnpackingData & g) : graph(g) {
+CHPathQueryManager::CHPathQueryManager(const FlagsGraphWithUnpackingData & g) : graph(g), searchState(g.nodes()),
+    forwardPrev(g.nodes(), UINT_MAX), backwardPrev(g.nodes(), UINT_MAX) {
 
 }
 
@@ -55,12 +56,12 @@ unsigned int CHPathQueryManager::processQuery(const unsigned int source, const u
     bool forwardFinished = false;
     bool backwardFinished = false;
 
-    graph.data(source).forwardDist = 0;
-    graph.data(target).backwardDist = 0;
+    searchState[source].forwardDist = 0;
+    searchState[target].backwardDist = 0;
     forwardChanged.push_back(source);
     backwardChanged.push_back(target);
-    graph.data(source).forwardReached = true;
-    graph.data(target).backwardReached = true;
+    searchState[source].forwardReached = true;
+    searchState[target].backwardReached = true;
 
     bool forward = false;
     upperbound = UINT_MAX;
@@ -88,16 +89,16 @@ unsigned int CHPathQueryManager::processQuery(const unsigned int source, const u
             unsigned int curLen = forwardQ.top().weight;
             forwardQ.pop();
 
-            if (graph.data(curNode).forwardSettled || graph.data(curNode).forwardStalled) {
+            if (searchState[curNode].forwardSettled || searchState[curNode].forwardStalled) {
                 continue;
             }
 
 
-            graph.data(curNode).forwardSettled = true;
+            searchState[curNode].forwardSettled = true;
             // Check if the node was already settled in the opposite direction - if yes, we get a new candidate
             // for the shortest path.
-            if ( graph.data(curNode).backwardSettled ) {
-                unsigned int newUpperboundCandidate = curLen +  graph.data(curNode).backwardDist;
+            if ( searchState[curNode].backwardSettled ) {
+                unsigned int newUpperboundCandidate = curLen +  searchState[curNode].backwardDist;
                 if (newUpperboundCandidate < upperbound) {
                     upperbound = newUpperboundCandidate;
                     meetingNode = curNode;
@@ -111,10 +112,10 @@ unsigned int CHPathQueryManager::processQuery(const unsigned int source, const u
                 // Hierarchies query algorithm, because we can reach a node from the wrong direction (for example
                 // we reach a node on a suboptimal path in the forward direction, because the actual optimal path
                 // will be later found in the backward direction)
-                /*if ((*iter).backward && graph.data((*iter).targetNode).forwardReached) {
-                    unsigned int newdistance = graph.data((*iter).targetNode).forwardDist + (*iter).weight;
+                /*if ((*iter).backward && searchState[(*iter).targetNode].forwardReached) {
+                    unsigned int newdistance = searchState[(*iter).targetNode].forwardDist + (*iter).weight;
                     if (newdistance < curLen) {
-                        //graph.data(curNode).forwardDist = newdistance;
+                        //searchState[curNode].forwardDist = newdistance;
                         //forwardStall(curNode, newdistance);
                     }
                 }*/
@@ -128,15 +129,15 @@ unsigned int CHPathQueryManager::processQuery(const unsigned int source, const u
                 if (graph.data((*iter).targetNode).rank > graph.data(curNode).rank) {
                     unsigned int newlen = curLen + (*iter).weight;
 
-                    if (newlen < graph.data((*iter).targetNode).forwardDist) {
+                    if (newlen < searchState[(*iter).targetNode].forwardDist) {
                         forwardQ.push(DijkstraNode((*iter).targetNode, newlen));
-                        if (graph.data((*iter).targetNode).forwardDist == UINT_MAX) {
+                        if (searchState[(*iter).targetNode].forwardDist == UINT_MAX) {
                             forwardChanged.push_back((*iter).targetNode);
                         }
-                        graph.data((*iter).targetNode).forwardDist = newlen;
-                        graph.data((*iter).targetNode).forwardReached = true;
-                        graph.data((*iter).targetNode).forwardStalled = false;
-                        graph.setForwardPrev((*iter).targetNode, curNode);
+                        searchState[(*iter).targetNode].forwardDist = newlen;
+                        searchState[(*iter).targetNode].forwardReached = true;
+                        searchState[(*iter).targetNode].forwardStalled = false;
+                        forwardPrev[(*iter).targetNode] = curNode;
                     }
                 }
             }
@@ -154,13 +155,13 @@ unsigned int CHPathQueryManager::processQuery(const unsigned int source, const u
             unsigned int curLen = backwardQ.top().weight;
             backwardQ.pop();
 
-            if (graph.data(curNode).backwardSettled || graph.data(curNode).backwardStalled) {
+            if (searchState[curNode].backwardSettled || searchState[curNode].backwardStalled) {
                 continue;
             }
 
-            graph.data(curNode).backwardSettled = true;
-            if (graph.data(curNode).forwardSettled) {
-                unsigned int newUpperboundCandidate = curLen + graph.data(curNode).forwardDist;
+            searchState[curNode].backwardSettled = true;
+            if (searchState[curNode].forwardSettled) {
+                unsigned int newUpperboundCandidate = curLen + searchState[curNode].forwardDist;
                 if (newUpperboundCandidate < upperbound) {
                     upperbound = newUpperboundCandidate;
                     meetingNode = curNode;
@@ -169,10 +170,10 @@ unsigned int CHPathQueryManager::processQuery(const unsigned int source, const u
 
             const std::vector<QueryEdgeWithUnpackingData> & neighbours = graph.nextNodes(curNode);
             for(auto iter = neighbours.begin(); iter != neighbours.end(); ++iter) {
-                /*if ((*iter).forward && graph.data((*iter).targetNode).backwardReached) {
-                    unsigned int newdistance = graph.data((*iter).targetNode).backwardDist + (*iter).weight;
+                /*if ((*iter).forward && searchState[(*iter).targetNode].backwardReached) {
+                    unsigned int newdistance = searchState[(*iter).targetNode].backwardDist + (*iter).weight;
                     if (newdistance < curLen) {
-                        graph.data(curNode).backwardDist = newdistance;
+                        searchState[curNode].backwardDist = newdistance;
                         //backwardStall(curNode, newdistance);
                     }
                 }*/
@@ -184,15 +185,15 @@ unsigned int CHPathQueryManager::processQuery(const unsigned int source, const u
                 if(graph.data((*iter).targetNode).rank > graph.data(curNode).rank) {
                     unsigned int newlen = curLen + (*iter).weight;
 
-                    if (newlen < graph.data((*iter).targetNode).backwardDist) {
+                    if (newlen < searchState[(*iter).targetNode].backwardDist) {
                         backwardQ.push(DijkstraNode((*iter).targetNode, newlen));
-                        if (graph.data((*iter).targetNode).backwardDist == UINT_MAX) {
+                        if (searchState[(*iter).targetNode].backwardDist == UINT_MAX) {
                             backwardChanged.push_back((*iter).targetNode);
                         }
-                        graph.data((*iter).targetNode).backwardDist = newlen;
-                        graph.data((*iter).targetNode).backwardReached = true;
-                        graph.data((*iter).targetNode).backwardStalled = false;
-                        graph.setBackwardPrev((*iter).targetNode, curNode);
+                        searchState[(*iter).targetNode].backwardDist = newlen;
+                        searchState[(*iter).targetNode].backwardReached = true;
+                        searchState[(*iter).targetNode].backwardStalled = false;
+                        backwardPrev[(*iter).targetNode] = curNode;
                     }
                 }
             }
@@ -295,7 +296,7 @@ void CHPathQueryManager::forwardStall(unsigned int stallnode, unsigned int stall
         unsigned int curNode = stallQueue.front().ID;
         unsigned int curDist = stallQueue.front().weight;
         stallQueue.pop();
-        graph.data(curNode).forwardStalled = true;
+        searchState[curNode].forwardStalled = true;
         forwardStallChanged.push_back(curNode);
 
         const std::vector<QueryEdgeWithUnpackingData> & neighbours = graph.nextNodes(curNode);
@@ -304,16 +305,16 @@ void CHPathQueryManager::forwardStall(unsigned int stallnode, unsigned int stall
                 continue;
             }
 
-            if (graph.data((*iter).targetNode).forwardReached) {
+            if (searchState[(*iter).targetNode].forwardReached) {
                 unsigned int newdistance = curDist + (*iter).weight;
 
-                if (newdistance < graph.data((*iter).targetNode).forwardDist) {
-                    if (! graph.data((*iter).targetNode).forwardStalled) {
+                if (newdistance < searchState[(*iter).targetNode].forwardDist) {
+                    if (! searchState[(*iter).targetNode].forwardStalled) {
                         stallQueue.push(DijkstraNode((*iter).targetNode, newdistance));
-                        if (graph.data((*iter).targetNode).forwardDist == UINT_MAX) {
+                        if (searchState[(*iter).targetNode].forwardDist == UINT_MAX) {
                             forwardChanged.push_back((*iter).targetNode);
                         }
-                        graph.data((*iter).targetNode).forwardDist = newdistance;
+                        searchState[(*iter).targetNode].forwardDist = newdistance;
                     }
                 }
             }
@@ -333,7 +334,7 @@ void CHPathQueryManager::backwardStall(unsigned int stallnode, unsigned int stal
         unsigned int curNode = stallQueue.front().ID;
         unsigned int curDist = stallQueue.front().weight;
         stallQueue.pop();
-        graph.data(curNode).backwardStalled = true;
+        searchState[curNode].backwardStalled = true;
         backwardStallChanged.push_back(curNode);
 
         const std::vector<QueryEdgeWithUnpackingData> & neighbours = graph.nextNodes(curNode);
@@ -342,16 +343,16 @@ void CHPathQueryManager::backwardStall(unsigned int stallnode, unsigned int stal
                 continue;
             }
 
-            if (graph.data((*iter).targetNode).backwardReached) {
+            if (searchState[(*iter).targetNode].backwardReached) {
                 unsigned int newdistance = curDist + (*iter).weight;
 
-                if (newdistance < graph.data((*iter).targetNode).backwardDist) {
-                    if (! graph.data((*iter).targetNode).backwardStalled) {
+                if (newdistance < searchState[(*iter).targetNode].backwardDist) {
+                    if (! searchState[(*iter).targetNode].backwardStalled) {
                         stallQueue.push(DijkstraNode((*iter).targetNode, newdistance));
-                        if (graph.data((*iter).targetNode).backwardDist == UINT_MAX) {
+                        if (searchState[(*iter).targetNode].backwardDist == UINT_MAX) {
                             backwardChanged.push_back((*iter).targetNode);
                         }
-                        graph.data((*iter).targetNode).backwardDist = newdistance;
+                        searchState[(*iter).targetNode].backwardDist = newdistance;
                     }
                 }
             }
@@ -363,24 +364,24 @@ void CHPathQueryManager::backwardStall(unsigned int stallnode, unsigned int stal
 //______________________________________________________________________________________________________________________
 void CHPathQueryManager::prepareStructuresForNextQuery() {
     for (size_t i = 0; i < forwardChanged.size(); i++) {
-        graph.resetForwardInfo(forwardChanged[i]);
-        graph.resetForwardPrev(forwardChanged[i]);
+        searchState[forwardChanged[i]].resetForwardInfo();
+        forwardPrev[forwardChanged[i]] = UINT_MAX;
     }
     forwardChanged.clear();
 
     for (size_t i = 0; i < backwardChanged.size(); i++) {
-        graph.resetBackwardInfo(backwardChanged[i]);
-        graph.resetBackwardPrev(backwardChanged[i]);
+        searchState[backwardChanged[i]].resetBackwardInfo();
+        backwardPrev[backwardChanged[i]] = UINT_MAX;
     }
     backwardChanged.clear();
 
     for (size_t i = 0; i < forwardStallChanged.size(); i++) {
-        graph.resetForwardStall(forwardStallChanged[i]);
+        searchState[forwardStallChanged[i]].forwardStalled = false;
     }
     forwardStallChanged.clear();
 
     for (size_t i = 0; i < backwardStallChanged.size(); i++) {
-        graph.resetBackwardStall(backwardStallChanged[i]);
+        searchState[backwardStallChanged[i]].backwardStalled = false;
     }
     backwardStallChanged.clear();
 }
@@ -450,18 +451,18 @@ void CHPathQueryManager::fillPathInfoEdgesOnly(const unsigned int meetingNode, s
 //______________________________________________________________________________________________________________________
 void CHPathQueryManager::fillFromPath(const unsigned int meetingNode, std::vector<std::pair<unsigned int, unsigned int> > & fromPath) {
     unsigned int current = meetingNode;
-    while(graph.getForwardPrev(current) != UINT_MAX) {
-        fromPath.push_back(std::make_pair(graph.getForwardPrev(current), current));
-        current = graph.getForwardPrev(current);
+    while(forwardPrev[current] != UINT_MAX) {
+        fromPath.push_back(std::make_pair(forwardPrev[current], current));
+        current = forwardPrev[current];
     }
 }
 
 //______________________________________________________________________________________________________________________
 void CHPathQueryManager::fillToPath(const unsigned int meetingNode, std::vector<std::pair<unsigned int, unsigned int> > & toPath) {
     unsigned int current = meetingNode;
-    while(graph.getBackwardPrev(current) != UINT_MAX) {
-        toPath.push_back(std::make_pair(current, graph.getBackwardPrev(current)));
-        current = graph.getBackwardPrev(current);
+    while(backwardPrev[current] != UINT_MAX) {
+        toPath.push_back(std::make_pair(current, backwardPrev[current]));
+        current = backwardPrev[current];
     }
 }
 
@@ -33,16 +33,19 @@
 #include <queue>
 #include "../GraphBuilding/Structures/FlagsGraphWithUnpackingData.h"
 #include "../GraphBuilding/Structures/SimpleEdge.h"
+#include "Structures/CHSearchState.h"
 
 
 
 /**
  * This class is responsible for the Contraction Hierarchies 'path' queries - when we require the actual path and not
- * only the distance between two points.
+ * only the distance between two points. The information changed by the queries (including the predecessors used to
+ * reconstruct the path) is kept in the manager, the graph is only read, so any number of managers (one for each thread)
+ * can share one graph.
  */
 class CHPathQueryManager {
 public:
-    CHPathQueryManager(FlagsGraphWithUnpackingData & g);
+    CHPathQueryManager(const FlagsGraphWithUnpackingData & g);
     unsigned int findDistanceOutputPath(const unsigned int source, const unsigned int target);
     unsigned int findDistanceOnly(const unsigned int source, const unsigned int target);
     unsigned int findPath(const unsigned int source, const unsigned int target, std::vector<std::pair<unsigned int, unsigned int>> & edges, std::vector<unsigned int> & edgeLengths);
@@ -76,7 +79,10 @@ protected:
     void getBackwardEdgeWithoutLength(unsigned int s, unsigned int t, std::vector<std::pair<unsigned int, unsigned int>> & edges);
     void getForwardEdgeWithoutLength(unsigned int s, unsigned int t, std::vector<SimpleEdge> & path);
     void getBackwardEdgeWithoutLength(unsigned int s, unsigned int t, std::vector<SimpleEdge> & path);
-    FlagsGraphWithUnpackingData & graph;
+    const FlagsGraphWithUnpackingData & graph;
+    std::vector<CHSearchState> searchState;
+    std::vector<unsigned int> forwardPrev;
+    std::vector<unsigned int> backwardPrev;
     unsigned int upperbound;
     unsigned int meetingNode;
     std::vector<unsigned int> forwardChanged;
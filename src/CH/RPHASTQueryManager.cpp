@@ -0,0 +1,197 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Czech Technical University in Prague
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. */
+
+/******************************************************************************
+* File:             RPHASTQueryManager.cpp
+*****************************************************************************/
+
+#include <algorithm>
+#include <numeric>
+#include <queue>
+#include <boost/numeric/conversion/cast.hpp>
+#include "RPHASTQueryManager.h"
+#include "../Dijkstra/DijkstraNode.h"
+
+//______________________________________________________________________________________________________________________
+RPHASTQueryManager::RPHASTQueryManager(const FlagsGraph<NodeData>& graph)
+    : graph(graph), localIDs(graph.nodes(), UINT_MAX), edgeOffsets(1, 0), upwardDistances(graph.nodes(), UINT_MAX) {
+}
+
+//______________________________________________________________________________________________________________________
+void RPHASTQueryManager::selectTargets(const std::vector<unsigned int>& targets) {
+    // the selection is collected by a graph search from the targets following the downward edges backwards, that is
+    // the edges stored at a node towards a higher ranked node which can be used in the backward direction
+    std::fill(localIDs.begin(), localIDs.end(), UINT_MAX);
+    std::vector<unsigned int> nodes;
+    for (const unsigned int target : targets) {
+        if (localIDs.at(target) == UINT_MAX) {
+            localIDs[target] = 0;
+            nodes.push_back(target);
+        }
+    }
+    for (size_t i = 0; i < nodes.size(); i++) {
+        const unsigned int node = nodes[i];
+        for (const QueryEdge& edge : graph.nextNodes(node)) {
+            if (edge.backward && graph.data(edge.targetNode).rank > graph.data(node).rank
+                && localIDs[edge.targetNode] == UINT_MAX) {
+                localIDs[edge.targetNode] = 0;
+                nodes.push_back(edge.targetNode);
+            }
+        }
+    }
+
+    extract(std::move(nodes));
+
+    targetPositions.resize(targets.size());
+    for (size_t i = 0; i < targets.size(); i++) {
+        targetPositions[i] = localIDs[targets[i]];
+    }
+}
+
+//______________________________________________________________________________________________________________________
+void RPHASTQueryManager::selectAllNodes() {
+    std::vector<unsigned int> nodes(graph.nodes());
+    std::iota(nodes.begin(), nodes.end(), 0);
+    extract(nodes);
+
+    targetPositions.assign(localIDs.begin(), localIDs.end());
+}
+
+//______________________________________________________________________________________________________________________
+void RPHASTQueryManager::extract(std::vector<unsigned int> nodes) {
+    std::sort(nodes.begin(), nodes.end(), [this](unsigned int a, unsigned int b) {
+        return graph.data(a).rank > graph.data(b).rank;
+    });
+    selection = std::move(nodes);
+    for (size_t i = 0; i < selection.size(); i++) {
+        localIDs[selection[i]] = boost::numeric_cast<unsigned int>(i);
+    }
+
+    edgeOffsets.clear();
+    edges.clear();
+    edgeOffsets.push_back(0);
+    for (const unsigned int node : selection) {
+        for (const QueryEdge& edge : graph.nextNodes(node)) {
+            if (edge.backward && graph.data(edge.targetNode).rank > graph.data(node).rank) {
+                edges.push_back({localIDs[edge.targetNode], edge.weight});
+            }
+        }
+        edgeOffsets.push_back(edges.size());
+    }
+    edgeOffsets.shrink_to_fit();
+    edges.shrink_to_fit();
+
+    sweepDistances.assign(selection.size(), UINT_MAX);
+}
+
+//______________________________________________________________________________________________________________________
+void RPHASTQueryManager::sweep(unsigned int source, unsigned int limit) {
+    std::fill(sweepDistances.begin(), sweepDistances.end(), UINT_MAX);
+
+    // the forward upward search, the distances of the selected nodes it settles are the initial values of the sweep
+    auto cmp = [](DijkstraNode left, DijkstraNode right) { return (left.weight) > (right.weight);};
+    std::priority_queue<DijkstraNode, std::vector<DijkstraNode>, decltype(cmp)> queue(cmp);
+    upwardDistances.at(source) = 0;
+    upwardReached.push_back(source);
+    queue.push(DijkstraNode(source, 0));
+    while (! queue.empty()) {
+        const unsigned int node = queue.top().ID;
+        const unsigned int distance = queue.top().weight;
+        queue.pop();
+        if (distance > upwardDistances[node]) {
+            continue;
+        }
+
+        if (localIDs[node] != UINT_MAX) {
+            sweepDistances[localIDs[node]] = distance;
+        }
+
+        for (const QueryEdge& edge : graph.nextNodes(node)) {
+            if (! edge.forward || graph.data(edge.targetNode).rank <= graph.data(node).rank) {
+                continue;
+            }
+            const unsigned int newDistance = distance + edge.weight;
+            if (newDistance <= limit && newDistance < upwardDistances[edge.targetNode]) {
+                if (upwardDistances[edge.targetNode] == UINT_MAX) {
+                    upwardReached.push_back(edge.targetNode);
+                }
+                upwardDistances[edge.targetNode] = newDistance;
+                queue.push(DijkstraNode(edge.targetNode, newDistance));
+            }
+        }
+    }
+    for (const unsigned int node : upwardReached) {
+        upwardDistances[node] = UINT_MAX;
+    }
+    upwardReached.clear();
+
+    // the downward sweep, the nodes are sorted by the rank, so all the predecessors of a node are already final
+    for (size_t i = 0; i < selection.size(); i++) {
+        unsigned int distance = sweepDistances[i];
+        for (size_t j = edgeOffsets[i]; j < edgeOffsets[i + 1]; j++) {
+            const unsigned int sourceDistance = sweepDistances[edges[j].source];
+            if (sourceDistance != UINT_MAX && sourceDistance + edges[j].weight < distance) {
+                distance = sourceDistance + edges[j].weight;
+            }
+        }
+        sweepDistances[i] = distance;
+    }
+}
+
+//______________________________________________________________________________________________________________________
+void RPHASTQueryManager::findDistances(unsigned int source, std::vector<unsigned int>& distances, unsigned int limit) {
+    sweep(source, limit);
+    distances.resize(targetPositions.size());
+    for (size_t i = 0; i < targetPositions.size(); i++) {
+        const unsigned int distance = sweepDistances[targetPositions[i]];
+        distances[i] = distance <= limit ? distance : UINT_MAX;
+    }
+}
+
+//______________________________________________________________________________________________________________________
+void RPHASTQueryManager::findTargetsInRange(
+        unsigned int source,
+        unsigned int limit,
+        std::vector<unsigned int>& targets,
+        std::vector<unsigned int>& distances) {
+    sweep(source, limit);
+    targets.clear();
+    distances.clear();
+    for (size_t i = 0; i < targetPositions.size(); i++) {
+        const unsigned int distance = sweepDistances[targetPositions[i]];
+        if (distance <= limit) {
+            targets.push_back(boost::numeric_cast<unsigned int>(i));
+            distances.push_back(distance);
+        }
+    }
+}
+
+//______________________________________________________________________________________________________________________
+size_t RPHASTQueryManager::targets() const {
+    return targetPositions.size();
+}
+
+//______________________________________________________________________________________________________________________
+size_t RPHASTQueryManager::selectedNodes() const {
+    return selection.size();
+}
@@ -0,0 +1,151 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Czech Technical University in Prague
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. */
+
+/******************************************************************************
+* File:             RPHASTQueryManager.h
+*
+* Description:      One-to-many and range queries over a target set using
+*                   restricted PHAST on the Contraction Hierarchy
+*****************************************************************************/
+
+#ifndef SHORTEST_PATHS_RPHASTQUERYMANAGER_H
+#define SHORTEST_PATHS_RPHASTQUERYMANAGER_H
+
+#include <climits>
+#include <vector>
+#include "../GraphBuilding/Structures/FlagsGraph.h"
+
+/**
+ * Answers one-to-many queries from a single source to a fixed set of targets using restricted PHAST as described in
+ * "Faster Batched Shortest Paths in Road Networks" by Daniel Delling, Andrew V. Goldberg and Renato F. Werneck.
+ *
+ * The target set is selected once: the selection is the union of the backward upward search spaces of the targets,
+ * which are exactly the nodes from which some target can be reached using only the downward edges of the hierarchy.
+ * The selected nodes are sorted by the rank in the decreasing order and their incoming downward edges are copied into
+ * a compact array, so a query only runs the forward upward search from the source and then one linear sweep over the
+ * selection, in which every node takes the minimum over its incoming downward edges. When the sweep gets to a node,
+ * all its downward predecessors have higher ranks and are already final.
+ *
+ * Selecting all the nodes of the graph gives the plain PHAST, which computes the distances to all the nodes, this is
+ * used for the isochrones. The range queries stop the upward search at the limit and only report the targets within
+ * the limit.
+ *
+ * The manager only reads the graph, so any number of managers can share one graph, but one manager can only be used
+ * by one thread at a time.
+ */
+class RPHASTQueryManager {
+public:
+    /**
+     * A simple constructor.
+     *
+     * @param graph[in] The Contraction Hierarchy, each edge stored at its lower ranked endpoint. The graph must outlive
+     * the manager.
+     */
+    explicit RPHASTQueryManager(const FlagsGraph<NodeData>& graph);
+
+    /**
+     * Extracts the part of the hierarchy needed for the given targets, replacing the previous selection.
+     *
+     * @param targets[in] The targets, a node can be present more than once.
+     */
+    void selectTargets(const std::vector<unsigned int>& targets);
+
+    /**
+     * Selects all the nodes of the graph as the targets, in the order of their IDs.
+     */
+    void selectAllNodes();
+
+    /**
+     * Finds the distances from the source to all the selected targets.
+     *
+     * @param source[in] The source node.
+     * @param distances[out] The distances to the targets in the order in which they were selected, 'UINT_MAX' for the
+     * targets that are not reachable.
+     * @param limit[in] The distances greater than the limit are reported as 'UINT_MAX', this allows the upward search
+     * to stop earlier.
+     */
+    void findDistances(unsigned int source, std::vector<unsigned int>& distances, unsigned int limit = UINT_MAX);
+
+    /**
+     * Finds the targets within the given distance from the source.
+     *
+     * @param source[in] The source node.
+     * @param limit[in] The maximal distance of the reported targets (inclusive).
+     * @param targets[out] The positions of the targets within the limit in the selection, in the increasing order.
+     * @param distances[out] The distances to those targets.
+     */
+    void findTargetsInRange(
+            unsigned int source,
+            unsigned int limit,
+            std::vector<unsigned int>& targets,
+            std::vector<unsigned int>& distances);
+
+    /**
+     * @return The number of the selected targets.
+     */
+    [[nodiscard]] size_t targets() const;
+
+    /**
+     * @return The number of the nodes in the extracted part of the hierarchy.
+     */
+    [[nodiscard]] size_t selectedNodes() const;
+
+private:
+    struct DownwardEdge {
+        unsigned int source;
+        unsigned int weight;
+    };
+
+    /**
+     * Builds the sweep structures for the selected nodes.
+     *
+     * @param nodes[in] The selected nodes, in any order.
+     */
+    void extract(std::vector<unsigned int> nodes);
+
+    /**
+     * Runs the upward search and the sweep, the results are left in 'sweepDistances'.
+     *
+     * @param source[in] The source node.
+     * @param limit[in] The upward search does not continue from the nodes farther than the limit.
+     */
+    void sweep(unsigned int source, unsigned int limit);
+
+    const FlagsGraph<NodeData>& graph;
+
+    // the position of every node in the selection, 'UINT_MAX' for the nodes that are not selected
+    std::vector<unsigned int> localIDs;
+    // the selected nodes sorted by the rank in the decreasing order
+    std::vector<unsigned int> selection;
+    // the incoming downward edges of the selected node 'i' are 'edges[edgeOffsets[i]]' to 'edges[edgeOffsets[i + 1] - 1]'
+    std::vector<size_t> edgeOffsets;
+    std::vector<DownwardEdge> edges;
+    // the positions of the targets in the selection
+    std::vector<unsigned int> targetPositions;
+
+    std::vector<unsigned int> sweepDistances;
+    std::vector<unsigned int> upwardDistances;
+    std::vector<unsigned int> upwardReached;
+};
+
+#endif //SHORTEST_PATHS_RPHASTQUERYMANAGER_H
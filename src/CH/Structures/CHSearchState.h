@@ -0,0 +1,68 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Czech Technical University in Prague
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. */
+
+/******************************************************************************
+* File:             CHSearchState.h
+*
+* Description:      The information about a node changed by a Contraction Hierarchies query
+*****************************************************************************/
+
+#pragma once
+
+#include <climits>
+
+/**
+ * The information about a node that is changed by the Contraction Hierarchies query algorithm. The query managers
+ * keep one instance for every node of the graph, the graph itself only holds the ranks, so it is never changed by the
+ * queries and any number of managers (one for each thread) can share it.
+ */
+class CHSearchState {
+public:
+    /**
+     * Resets the forward distance, reached and settled flags, so that the following queries are not influenced by
+     * the current query.
+     */
+    void resetForwardInfo() {
+        forwardDist = UINT_MAX;
+        forwardReached = false;
+        forwardSettled = false;
+    }
+
+    /**
+     * The backward counterpart of 'resetForwardInfo'.
+     */
+    void resetBackwardInfo() {
+        backwardDist = UINT_MAX;
+        backwardReached = false;
+        backwardSettled = false;
+    }
+
+    unsigned int forwardDist = UINT_MAX;
+    unsigned int backwardDist = UINT_MAX;
+    bool forwardReached = false;
+    bool backwardReached = false;
+    bool forwardSettled = false;
+    bool backwardSettled = false;
+    bool forwardStalled = false;
+    bool backwardStalled = false;
+};
@@ -29,8 +29,8 @@
 #pragma once
 
 /**
- * A simple structure encapsulating all the important information about a node for the Contraction Hierarchies
- * query algorithm.
+ * A simple structure encapsulating the information about a node stored in the Contraction Hierarchies graph. The
+ * information changed by the queries is kept by the query managers (see 'CHSearchState'), so the graph is only read.
  */
 class NodeData {
 public:
@@ -41,13 +41,5 @@ public:
 
 	bool operator==(const NodeData& rhs) const = default;
 
-	unsigned int forwardDist;
-    unsigned int backwardDist;
     unsigned int rank;
-    bool forwardReached;
-    bool backwardReached;
-    bool forwardSettled;
-    bool backwardSettled;
-    bool forwardStalled;
-    bool backwardStalled;
 };
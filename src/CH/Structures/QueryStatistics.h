@@ -0,0 +1,113 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Czech Technical University in Prague
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. */
+
+/******************************************************************************
+* File:             QueryStatistics.h
+*
+* Description:      Counters describing the work done by the distance queries
+*****************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+
+/**
+ * Counters describing the work done by the Contraction Hierarchies, Transit Node Routing and Transit Node Routing
+ * with Arc Flags distance queries. A query manager only counts when it was given an instance using its
+ * 'setStatistics' function, otherwise the counting costs one not-taken branch per event. The counting can also be
+ * removed completely at compile time by defining 'SHORTEST_PATHS_NO_QUERY_STATISTICS' (the 'QUERY_STATISTICS'
+ * CMake option). The counters are never reset by the query managers, the caller has to call 'reset' before each query
+ * in order to get the values for a single query.
+ */
+class QueryStatistics {
+public:
+    /**
+     * Sets all the counters to zero.
+     */
+    void reset() {
+        *this = QueryStatistics();
+    }
+
+    /**
+     * Adds the counters of another instance to this one, useful for aggregating the statistics of multiple queries.
+     *
+     * @param other[in] The statistics to add.
+     * @return This instance.
+     */
+    QueryStatistics& operator+=(const QueryStatistics& other) {
+        settledNodes += other.settledNodes;
+        relaxedEdges += other.relaxedEdges;
+        stalledNodes += other.stalledNodes;
+        heapPushes += other.heapPushes;
+        localQueryFallbacks += other.localQueryFallbacks;
+        accessNodePairs += other.accessNodePairs;
+        arcFlagPrunes += other.arcFlagPrunes;
+        return *this;
+    }
+
+    /**
+     * Nodes settled by the Contraction Hierarchies search, both directions together.
+     */
+    size_t settledNodes = 0;
+
+    /**
+     * Upward edges relaxed by the Contraction Hierarchies search.
+     */
+    size_t relaxedEdges = 0;
+
+    /**
+     * Nodes that were not expanded by the Contraction Hierarchies search because they were stalled.
+     */
+    size_t stalledNodes = 0;
+
+    /**
+     * Insertions into the priority queues of the Contraction Hierarchies search.
+     */
+    size_t heapPushes = 0;
+
+    /**
+     * Transit Node Routing queries that were found local and answered by the Contraction Hierarchies fallback.
+     */
+    size_t localQueryFallbacks = 0;
+
+    /**
+     * Pairs of forward and backward access nodes for which the distance table was consulted.
+     */
+    size_t accessNodePairs = 0;
+
+    /**
+     * Pairs of access nodes skipped by Transit Node Routing with Arc Flags because the flag of one of them for
+     * the opposite region was not set.
+     */
+    size_t arcFlagPrunes = 0;
+};
+
+#ifndef SHORTEST_PATHS_NO_QUERY_STATISTICS
+/**
+ * Adds 'amount' to the given counter if 'statistics' (a pointer to QueryStatistics) is not null.
+ */
+#define COUNT_QUERY_STATISTIC(statistics, counter, amount) \
+    do { if (statistics) { (statistics)->counter += (amount); } } while (false)
+#else
+#define COUNT_QUERY_STATISTIC(statistics, counter, amount) do { } while (false)
+#endif
@@ -0,0 +1,159 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Czech Technical University in Prague
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. */
+
+/******************************************************************************
+* File:             PreprocessingCheckpoints.cpp
+*****************************************************************************/
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include "PreprocessingCheckpoints.h"
+
+namespace {
+
+const char checkpointMagic[4] = {'X', 'C', 'P', '1'};
+const char checkpointTerminator[4] = {'X', 'C', 'P', 'E'};
+
+uint64_t mix(uint64_t value) {
+    value += 0x9e3779b97f4a7c15ULL;
+    value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    value = (value ^ (value >> 27)) * 0x94d049bb133111ebULL;
+    return value ^ (value >> 31);
+}
+
+}
+
+//______________________________________________________________________________________________________________________
+PreprocessingCheckpoints::PreprocessingCheckpoints(std::string directory, bool resume, const UpdateableGraph & graph)
+        : directory(std::move(directory)), resume(resume), active(true), graphFingerprint(fingerprint(graph)) {
+    std::filesystem::create_directories(this->directory);
+}
+
+//______________________________________________________________________________________________________________________
+bool PreprocessingCheckpoints::enabled() const {
+    return active;
+}
+
+//______________________________________________________________________________________________________________________
+uint64_t PreprocessingCheckpoints::fingerprint(const UpdateableGraph & graph) {
+    uint64_t sum = 0;
+    uint64_t edges = 0;
+    for (unsigned int from = 0; from < graph.nodes(); from++) {
+        for (const auto & [to, data] : graph.outgoingEdges(from)) {
+            sum += mix(mix((uint64_t(from) << 32) | to) ^ data.weight);
+            edges++;
+        }
+    }
+    return mix(sum ^ mix(graph.nodes()) ^ mix(edges << 1));
+}
+
+//______________________________________________________________________________________________________________________
+std::string PreprocessingCheckpoints::pathFor(const std::string & phase) const {
+    return (std::filesystem::path(directory) / (phase + ".ckpt")).string();
+}
+
+//______________________________________________________________________________________________________________________
+bool PreprocessingCheckpoints::load(
+        const std::string & phase,
+        const std::string & parameters,
+        const std::function<void(std::istream &)> & reader) const {
+    if (! active || ! resume) {
+        return false;
+    }
+
+    const std::string path = pathFor(phase);
+    std::ifstream input(path, std::ios::binary);
+    if (! input.is_open()) {
+        return false;
+    }
+
+    input.exceptions(std::ios::failbit | std::ios::badbit);
+    try {
+        char terminator[4];
+        input.seekg(-std::streamoff(sizeof(terminator)), std::ios::end);
+        input.read(terminator, sizeof(terminator));
+        input.seekg(0);
+        char magic[4];
+        input.read(magic, sizeof(magic));
+        if (std::memcmp(magic, checkpointMagic, sizeof(magic)) != 0
+                || std::memcmp(terminator, checkpointTerminator, sizeof(terminator)) != 0) {
+            std::cout << "Ignoring the damaged checkpoint '" << path << "'." << std::endl;
+            return false;
+        }
+
+        const auto storedFingerprint = readValue<uint64_t>(input);
+        std::string storedParameters(readValue<uint32_t>(input), '\0');
+        input.read(storedParameters.data(), std::streamsize(storedParameters.size()));
+        if (storedFingerprint != graphFingerprint) {
+            std::cout << "Ignoring the checkpoint '" << path << "', it was created for a different graph." << std::endl;
+            return false;
+        }
+        if (storedParameters != parameters) {
+            std::cout << "Ignoring the checkpoint '" << path << "', it was created with different parameters ("
+                      << storedParameters << ")." << std::endl;
+            return false;
+        }
+
+        reader(input);
+    } catch (const std::exception & e) {
+        std::cout << "Ignoring the damaged checkpoint '" << path << "' (" << e.what() << ")." << std::endl;
+        return false;
+    }
+
+    std::cout << "Loaded the '" << phase << "' phase from the checkpoint '" << path << "'." << std::endl;
+    return true;
+}
+
+//______________________________________________________________________________________________________________________
+void PreprocessingCheckpoints::save(
+        const std::string & phase,
+        const std::string & parameters,
+        const std::function<void(std::ostream &)> & writer) const {
+    if (! active) {
+        return;
+    }
+
+    const std::string path = pathFor(phase);
+    const std::string temporaryPath = path + ".tmp";
+    {
+        std::ofstream output(temporaryPath, std::ios::binary | std::ios::trunc);
+        if (! output.is_open()) {
+            throw std::runtime_error("Couldn't open the checkpoint file '" + temporaryPath + "' for writing.");
+        }
+
+        output.write(checkpointMagic, sizeof(checkpointMagic));
+        writeValue<uint64_t>(output, graphFingerprint);
+        writeValue<uint32_t>(output, uint32_t(parameters.size()));
+        output.write(parameters.data(), std::streamsize(parameters.size()));
+        writer(output);
+        output.write(checkpointTerminator, sizeof(checkpointTerminator));
+        output.close();
+        if (output.fail()) {
+            throw std::runtime_error("Couldn't write the checkpoint file '" + temporaryPath + "'.");
+        }
+    }
+    std::filesystem::rename(temporaryPath, path);
+    std::cout << "Saved the '" << phase << "' phase into the checkpoint '" << path << "'." << std::endl;
+}
@@ -0,0 +1,180 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Czech Technical University in Prague
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. */
+
+/******************************************************************************
+* File:             PreprocessingCheckpoints.h
+*
+* Description:      Checkpoint files allowing to resume interrupted preprocessing
+*****************************************************************************/
+
+#ifndef SHORTEST_PATHS_PREPROCESSINGCHECKPOINTS_H
+#define SHORTEST_PATHS_PREPROCESSINGCHECKPOINTS_H
+
+#include <cstdint>
+#include <functional>
+#include <istream>
+#include <ostream>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include "../GraphBuilding/Structures/UpdateableGraph.h"
+
+/**
+ * Stores the results of the individual phases of a long preprocessing run (the Contraction Hierarchy, the transit node
+ * distance table, the access nodes, the Arc Flags, ...) in a directory, so that a run that was interrupted can be
+ * restarted without repeating the phases that were already completed. The same mechanism allows to only rerun the
+ * later phases when their parameters change, for example when tuning the size of the transit node set, the
+ * Contraction Hierarchy is then loaded from its checkpoint and only the Transit Node Routing phases are recomputed.
+ *
+ * Every phase is saved in its own file '<directory>/<phase>.ckpt'. The file starts with a fingerprint of the input
+ * graph and with a description of the parameters the phase depends on, a checkpoint is only used if both match the
+ * current run. The files are first written under a temporary name and renamed once complete, and they end with
+ * a terminator, so a checkpoint interrupted while being written is never used.
+ *
+ * A default constructed instance is disabled, it never loads nor saves anything, so the preprocessing code can always
+ * be given an instance and does not have to check whether the checkpoints were requested.
+ */
+class PreprocessingCheckpoints {
+public:
+    /**
+     * Creates a disabled instance.
+     */
+    PreprocessingCheckpoints() = default;
+
+    /**
+     * Creates an instance saving the checkpoints into the given directory. The directory is created if it does not
+     * exist.
+     *
+     * @param directory[in] The directory where the checkpoints are saved.
+     * @param resume[in] If true, valid checkpoints found in the directory are loaded instead of recomputing the phases.
+     * If false, the existing checkpoints are ignored and overwritten.
+     * @param graph[in] The input graph before any preprocessing. Its fingerprint is saved with every checkpoint so that
+     * checkpoints created for a different graph are never used.
+     */
+    PreprocessingCheckpoints(
+            std::string directory,
+            bool resume,
+            const UpdateableGraph & graph);
+
+    /**
+     * @return True if the checkpoints are saved, false for a disabled instance.
+     */
+    bool enabled() const;
+
+    /**
+     * Tries to load the result of a phase from its checkpoint. Nothing happens if the instance is not resuming,
+     * if there is no checkpoint for the phase or if the checkpoint was created for a different graph or with different
+     * parameters.
+     *
+     * @param phase[in] The name of the phase, also used as the name of the checkpoint file.
+     * @param parameters[in] A description of all the parameters the result of the phase depends on.
+     * @param reader[in] A function reading the result of the phase from the checkpoint. It is only called for a valid
+     * checkpoint and it should only modify its targets after it has read all the data, since an exception thrown
+     * when reading a damaged checkpoint results in the phase being recomputed.
+     * @return True if the result was loaded and the phase can be skipped, false if the phase has to be computed.
+     */
+    bool load(
+            const std::string & phase,
+            const std::string & parameters,
+            const std::function<void(std::istream &)> & reader) const;
+
+    /**
+     * Saves the result of a phase into its checkpoint. Nothing happens for a disabled instance.
+     *
+     * @param phase[in] The name of the phase, also used as the name of the checkpoint file.
+     * @param parameters[in] A description of all the parameters the result of the phase depends on.
+     * @param writer[in] A function writing the result of the phase into the checkpoint.
+     */
+    void save(
+            const std::string & phase,
+            const std::string & parameters,
+            const std::function<void(std::ostream &)> & writer) const;
+
+    /**
+     * Computes a fingerprint of a graph. The fingerprint does not depend on the order of the edges.
+     *
+     * @param graph[in] The graph.
+     * @return The fingerprint of the graph.
+     */
+    static uint64_t fingerprint(
+            const UpdateableGraph & graph);
+
+    // Binary helpers used by the functions reading and writing the results of the individual phases. The readers
+    // expect the input stream to throw on failure, which is how 'load' passes the stream to them.
+
+    template<typename T>
+    static void writeValue(std::ostream & output, const T & value) {
+        static_assert(std::is_trivially_copyable_v<T>);
+        output.write(reinterpret_cast<const char *>(&value), sizeof(T));
+    }
+
+    template<typename T>
+    static T readValue(std::istream & input) {
+        static_assert(std::is_trivially_copyable_v<T>);
+        T value;
+        input.read(reinterpret_cast<char *>(&value), sizeof(T));
+        return value;
+    }
+
+    template<typename T>
+    static void writeVector(std::ostream & output, const std::vector<T> & values) {
+        static_assert(std::is_trivially_copyable_v<T>);
+        writeValue<uint64_t>(output, values.size());
+        output.write(reinterpret_cast<const char *>(values.data()), std::streamsize(values.size() * sizeof(T)));
+    }
+
+    template<typename T>
+    static std::vector<T> readVector(std::istream & input) {
+        static_assert(std::is_trivially_copyable_v<T>);
+        std::vector<T> values(readValue<uint64_t>(input));
+        input.read(reinterpret_cast<char *>(values.data()), std::streamsize(values.size() * sizeof(T)));
+        return values;
+    }
+
+    template<typename T>
+    static void writeTable(std::ostream & output, const std::vector<std::vector<T>> & rows) {
+        writeValue<uint64_t>(output, rows.size());
+        for (const auto & row : rows) {
+            writeVector(output, row);
+        }
+    }
+
+    template<typename T>
+    static std::vector<std::vector<T>> readTable(std::istream & input) {
+        std::vector<std::vector<T>> rows(readValue<uint64_t>(input));
+        for (auto & row : rows) {
+            row = readVector<T>(input);
+        }
+        return rows;
+    }
+
+private:
+    std::string pathFor(const std::string & phase) const;
+
+    std::string directory;
+    bool resume = false;
+    bool active = false;
+    uint64_t graphFingerprint = 0;
+};
+
+#endif //SHORTEST_PATHS_PREPROCESSINGCHECKPOINTS_H
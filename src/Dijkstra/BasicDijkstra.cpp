@@ -30,6 +30,7 @@
 #include <queue>
 #include <cstdio>
 #include "BasicDijkstra.h"
+#include "DijkstraEngine.h"
 #include "DijkstraNode.h"
 
 //______________________________________________________________________________________________________________________
@@ -147,62 +148,10 @@ void BasicDijkstra::outputPath(const unsigned int x, const unsigned int * dist,
 
 //______________________________________________________________________________________________________________________
 void BasicDijkstra::computeOneToAllDistances(const unsigned int source, const Graph & graph, std::vector<unsigned int> & distances) {
-    size_t n = (size_t) graph.nodes();
-
-    for(size_t i = 0; i < (size_t) n; i++) {
-        distances[i] = UINT_MAX;
-    }
-
-    distances[source] = 0;
-
-    auto cmp = [](DijkstraNode left, DijkstraNode right) { return (left.weight) > (right.weight);};
-    std::priority_queue<DijkstraNode, std::vector<DijkstraNode>, decltype(cmp)> q(cmp);
-    q.push(DijkstraNode(source, 0));
-
-    while(! q.empty() ) {
-        const DijkstraNode current = q.top();
-
-        const std::vector < std::pair< unsigned int, unsigned int > > & neighbours = graph.outgoingEdges(current.ID);
-        for ( unsigned int i = 0; i < neighbours.size(); i++ ) {
-            unsigned int newDistance = current.weight + neighbours.at(i).second;
-            if (newDistance < distances[neighbours.at(i).first]) {
-                distances[neighbours.at(i).first] = newDistance;
-                q.push(DijkstraNode(neighbours.at(i).first, newDistance));
-            }
-        }
-
-        q.pop();
-
-    }
+    DijkstraEngine::computeOneToAllDistances(source, graph, distances);
 }
 
 //______________________________________________________________________________________________________________________
 void BasicDijkstra::computeOneToAllDistancesInReversedGraph(const unsigned int source, const Graph & graph, std::vector<unsigned int> & distances) {
-    size_t n = (size_t) graph.nodes();
-
-    for(size_t i = 0; i < (size_t) n; i++) {
-        distances[i] = UINT_MAX;
-    }
-
-    distances[source] = 0;
-
-    auto cmp = [](DijkstraNode left, DijkstraNode right) { return (left.weight) > (right.weight);};
-    std::priority_queue<DijkstraNode, std::vector<DijkstraNode>, decltype(cmp)> q(cmp);
-    q.push(DijkstraNode(source, 0));
-
-    while(! q.empty() ) {
-        const DijkstraNode current = q.top();
-
-        const std::vector < std::pair< unsigned int, unsigned int > > & neighbours = graph.incomingEdges(current.ID);
-        for ( unsigned int i = 0; i < neighbours.size(); i++ ) {
-            unsigned int newDistance = current.weight + neighbours.at(i).second;
-            if (newDistance < distances[neighbours.at(i).first]) {
-                distances[neighbours.at(i).first] = newDistance;
-                q.push(DijkstraNode(neighbours.at(i).first, newDistance));
-            }
-        }
-
-        q.pop();
-
-    }
+    DijkstraEngine::computeOneToAllDistances(source, graph, distances, true);
 }
@@ -69,12 +69,13 @@ public:
      * Compute distances from source to all nodes in the graph. Fills those distances into the parameter
      * std::vector distances. Can be used for example to fill the full distance matrix - each call of this function
      * will compute one row of the matrix. This is also used in some of the preprocessing functions of some of the
-     * methods.
+     * methods. The search is done by 'DijkstraEngine' using a radix heap that the calling thread reuses between the
+     * calls.
      *
      * @param source[in] The node we want to start the search from.
      * @param graph[in] The graph we are interested in.
      * @param distances[out] A std::vector that will be filled with shortest distances from 'source' to all nodes.
-     * The std::vector must be resized before this function is called to be able to contain values for all nodes.
+     * The std::vector is resized to the number of nodes.
      */
     static void computeOneToAllDistances(
             const unsigned int source,
@@ -88,8 +89,7 @@ public:
      * @param source[in] The node we want to start the search from.
      * @param graph[in] The graph we are interested in.
      * @param distances[out] A std::vector that will be filled with shortest distances from 'source' to all nodes in the
-     * reversed graph. The std::vector must be resized before this function is called to be able to contain values for
-     * all nodes.
+     * reversed graph. The std::vector is resized to the number of nodes.
      */
     static void computeOneToAllDistancesInReversedGraph(
             const unsigned int source,
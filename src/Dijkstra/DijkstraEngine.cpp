@@ -0,0 +1,251 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Czech Technical University in Prague
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. */
+
+/******************************************************************************
+* File:             DijkstraEngine.cpp
+*****************************************************************************/
+
+#include <algorithm>
+#include <climits>
+#include "DijkstraEngine.h"
+#include "../Error/Error.h"
+
+namespace {
+    template <class Q>
+    void oneToAll(
+            Q& queue,
+            const Graph& graph,
+            const unsigned int source,
+            std::vector<unsigned int>& distances,
+            const bool reversed) {
+        distances.assign(graph.nodes(), UINT_MAX);
+        queue.clear();
+        distances[source] = 0;
+        queue.push(source, 0);
+
+        while (!queue.empty()) {
+            const auto [distance, node] = queue.pop();
+            if (distance != distances[node]) {
+                continue;
+            }
+
+            const auto& edges = reversed ? graph.incomingEdges(node) : graph.outgoingEdges(node);
+            for (const auto& [neighbour, weight] : edges) {
+                if (distance + weight < distances[neighbour]) {
+                    distances[neighbour] = distance + weight;
+                    queue.push(neighbour, distance + weight);
+                }
+            }
+        }
+    }
+}
+
+//______________________________________________________________________________________________________________________
+DijkstraEngine::Heap DijkstraEngine::parseHeap(const std::string& name) {
+    if (name == "radix") {
+        return Heap::RADIX;
+    }
+    if (name == "quaternary") {
+        return Heap::QUATERNARY;
+    }
+    if (name == "dial") {
+        return Heap::DIAL;
+    }
+    throw input_error("Unknown Dijkstra heap '" + name + "', expected 'radix', 'quaternary' or 'dial'.\n");
+}
+
+//______________________________________________________________________________________________________________________
+DijkstraEngine::Queue DijkstraEngine::createQueue(const Graph& graph, const Heap heap) {
+    if (heap == Heap::QUATERNARY) {
+        return QuaternaryHeap(graph.nodes());
+    }
+    if (heap == Heap::DIAL) {
+        dist_t maxWeight = 0;
+        for (unsigned int node = 0; node < graph.nodes(); node++) {
+            for (const auto& edge : graph.outgoingEdges(node)) {
+                maxWeight = std::max(maxWeight, edge.second);
+            }
+        }
+        if (maxWeight > DIAL_MAX_WEIGHT) {
+            throw input_error("The largest edge weight (" + std::to_string(maxWeight) + ") is too large for the "
+                              "'dial' heap, use 'radix' instead.\n");
+        }
+        return DialBuckets(maxWeight);
+    }
+    return RadixHeap();
+}
+
+//______________________________________________________________________________________________________________________
+DijkstraEngine::DijkstraEngine(const Graph& graph, const Heap heap)
+    : graph(graph), forwardQueue(createQueue(graph, heap)), backwardQueue(forwardQueue), stamps(graph.nodes(), 0),
+      currentStamp(0), forwardDist(graph.nodes()), backwardDist(graph.nodes()), statistics(nullptr) {
+
+}
+
+//______________________________________________________________________________________________________________________
+void DijkstraEngine::setStatistics(QueryStatistics* queryStatistics) {
+    statistics = queryStatistics;
+}
+
+//______________________________________________________________________________________________________________________
+void DijkstraEngine::newQuery() {
+    // The stamps of all the nodes are only reset once the counter wraps around.
+    if (++currentStamp == 0) {
+        std::fill(stamps.begin(), stamps.end(), 0);
+        currentStamp = 1;
+    }
+}
+
+//______________________________________________________________________________________________________________________
+unsigned int DijkstraEngine::run(const unsigned int start, const unsigned int goal) {
+    return std::visit([&](auto& queue) { return search(queue, start, goal); }, forwardQueue);
+}
+
+//______________________________________________________________________________________________________________________
+unsigned int DijkstraEngine::runBidirectional(const unsigned int start, const unsigned int goal) {
+    return std::visit([&](auto& queue) {
+        return bidirectionalSearch(queue, std::get<std::decay_t<decltype(queue)>>(backwardQueue), start, goal);
+    }, forwardQueue);
+}
+
+//______________________________________________________________________________________________________________________
+void DijkstraEngine::computeOneToAllDistances(
+        const unsigned int source,
+        std::vector<unsigned int>& distances,
+        const bool reversed) {
+    std::visit([&](auto& queue) { oneToAll(queue, graph, source, distances, reversed); }, forwardQueue);
+}
+
+//______________________________________________________________________________________________________________________
+void DijkstraEngine::computeOneToAllDistances(
+        const unsigned int source,
+        const Graph& graph,
+        std::vector<unsigned int>& distances,
+        const bool reversed) {
+    thread_local RadixHeap queue;
+    oneToAll(queue, graph, source, distances, reversed);
+}
+
+//______________________________________________________________________________________________________________________
+template <class Q>
+unsigned int DijkstraEngine::search(Q& queue, const unsigned int start, const unsigned int goal) {
+    newQuery();
+    queue.clear();
+    reach(start);
+    forwardDist[start] = 0;
+    queue.push(start, 0);
+
+    while (!queue.empty()) {
+        const auto [distance, node] = queue.pop();
+        if (distance != forwardDist[node]) {
+            continue;
+        }
+        COUNT_QUERY_STATISTIC(statistics, settledNodes, 1);
+        if (node == goal) {
+            return distance;
+        }
+
+        for (const auto& [neighbour, weight] : graph.outgoingEdges(node)) {
+            COUNT_QUERY_STATISTIC(statistics, relaxedEdges, 1);
+            reach(neighbour);
+            if (distance + weight < forwardDist[neighbour]) {
+                forwardDist[neighbour] = distance + weight;
+                queue.push(neighbour, distance + weight);
+                COUNT_QUERY_STATISTIC(statistics, heapPushes, 1);
+            }
+        }
+    }
+
+    return UINT_MAX;
+}
+
+//______________________________________________________________________________________________________________________
+template <class Q>
+void DijkstraEngine::settle(
+        Q& queue,
+        std::vector<dist_t>& distances,
+        const std::vector<dist_t>& otherDistances,
+        const bool backward,
+        unsigned long long& shortest) {
+    const auto [distance, node] = queue.pop();
+    if (distance != distances[node]) {
+        return;
+    }
+    COUNT_QUERY_STATISTIC(statistics, settledNodes, 1);
+
+    const auto& edges = backward ? graph.incomingEdges(node) : graph.outgoingEdges(node);
+    for (const auto& [neighbour, weight] : edges) {
+        COUNT_QUERY_STATISTIC(statistics, relaxedEdges, 1);
+        reach(neighbour);
+        if (distance + weight < distances[neighbour]) {
+            distances[neighbour] = distance + weight;
+            queue.push(neighbour, distance + weight);
+            COUNT_QUERY_STATISTIC(statistics, heapPushes, 1);
+            if (otherDistances[neighbour] != UINT_MAX) {
+                shortest = std::min(shortest, static_cast<unsigned long long>(distance + weight)
+                                              + otherDistances[neighbour]);
+            }
+        }
+    }
+}
+
+//______________________________________________________________________________________________________________________
+template <class Q>
+unsigned int DijkstraEngine::bidirectionalSearch(
+        Q& forwardQueue,
+        Q& backwardQueue,
+        const unsigned int start,
+        const unsigned int goal) {
+    if (start == goal) {
+        return 0;
+    }
+
+    newQuery();
+    forwardQueue.clear();
+    backwardQueue.clear();
+    reach(start);
+    reach(goal);
+    forwardDist[start] = 0;
+    backwardDist[goal] = 0;
+    forwardQueue.push(start, 0);
+    backwardQueue.push(goal, 0);
+
+    // Every path is seen by the meeting test of the search that reaches its meeting node second, so once either
+    // queue is empty, the best distance found is final.
+    unsigned long long shortest = UINT_MAX;
+    while (!forwardQueue.empty() && !backwardQueue.empty()) {
+        const dist_t forwardKey = forwardQueue.minKey();
+        const dist_t backwardKey = backwardQueue.minKey();
+        if (static_cast<unsigned long long>(forwardKey) + backwardKey >= shortest) {
+            break;
+        }
+
+        if (forwardKey <= backwardKey) {
+            settle(forwardQueue, forwardDist, backwardDist, false, shortest);
+        } else {
+            settle(backwardQueue, backwardDist, forwardDist, true, shortest);
+        }
+    }
+
+    return static_cast<unsigned int>(shortest);
+}
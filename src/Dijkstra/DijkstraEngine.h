@@ -0,0 +1,183 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Czech Technical University in Prague
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. */
+
+/******************************************************************************
+* File:             DijkstraEngine.h
+*
+* Description:      Reusable Dijkstra search with a choice of priority queues
+*****************************************************************************/
+
+#ifndef SHORTEST_PATHS_DIJKSTRAENGINE_H
+#define SHORTEST_PATHS_DIJKSTRAENGINE_H
+
+#include <string>
+#include <variant>
+#include <vector>
+#include "Structures/DialBuckets.h"
+#include "Structures/QuaternaryHeap.h"
+#include "Structures/RadixHeap.h"
+#include "../CH/Structures/QueryStatistics.h"
+#include "../GraphBuilding/Structures/Graph.h"
+
+/**
+ * A Dijkstra's algorithm implementation meant for answering many queries on the same graph, for example when computing
+ * the reference distances for the validation of the other methods. Unlike 'BasicDijkstra', the engine keeps its
+ * distance arrays and priority queues between the queries. The distances set by the previous queries are recognized
+ * by a query stamp stored for every node, so a query does not allocate anything and does not have to reset the
+ * arrays, its cost only depends on the part of the graph it explores.
+ *
+ * The queries can be answered by a unidirectional search that stops when the goal is settled, or by a bidirectional
+ * search that alternates between a forward search from the start and a backward search from the goal and stops once
+ * the sum of the smallest keys in the two queues reaches the best distance found. The engine only reads the graph,
+ * so any number of engines (one for each thread) can share it.
+ */
+class DijkstraEngine {
+public:
+    /**
+     * The priority queues the engine can use.
+     */
+    enum class Heap {
+        /**
+         * 'RadixHeap', the default, works well for any integer weights.
+         */
+        RADIX,
+
+        /**
+         * 'QuaternaryHeap', an indexed 4-ary heap with a decrease key operation.
+         */
+        QUATERNARY,
+
+        /**
+         * 'DialBuckets', suitable for graphs where the largest weight is small.
+         */
+        DIAL
+    };
+
+    /**
+     * The largest edge weight allowed for the 'DIAL' queue, each possible weight needs one bucket.
+     */
+    static constexpr dist_t DIAL_MAX_WEIGHT = 1 << 20;
+
+    /**
+     * Parses the name of a priority queue.
+     *
+     * @param name[in] One of 'radix', 'quaternary' and 'dial'.
+     * @return The priority queue.
+     */
+    static Heap parseHeap(const std::string& name);
+
+    /**
+     * A simple constructor.
+     *
+     * @param graph[in] The graph, it must outlive the engine.
+     * @param heap[in] The priority queue used by the searches.
+     */
+    explicit DijkstraEngine(const Graph& graph, Heap heap = Heap::RADIX);
+
+    /**
+     * Finds the shortest distance using the unidirectional search.
+     *
+     * @param start[in] The start node for the query.
+     * @param goal[in] The goal node for the query.
+     * @return Returns the shortest distance from start to goal or 'UINT_MAX' if goal is not reachable from start.
+     */
+    unsigned int run(unsigned int start, unsigned int goal);
+
+    /**
+     * Finds the shortest distance using the bidirectional search.
+     *
+     * @param start[in] The start node for the query.
+     * @param goal[in] The goal node for the query.
+     * @return Returns the shortest distance from start to goal or 'UINT_MAX' if goal is not reachable from start.
+     */
+    unsigned int runBidirectional(unsigned int start, unsigned int goal);
+
+    /**
+     * Computes the distances from the source to all the nodes.
+     *
+     * @param source[in] The node we want to start the search from.
+     * @param distances[out] The distances, resized to the number of nodes. Unreachable nodes get 'UINT_MAX'.
+     * @param reversed[in] If true, the search follows the edges backwards, so the distances are from all the nodes
+     * to the source.
+     */
+    void computeOneToAllDistances(unsigned int source, std::vector<unsigned int>& distances, bool reversed = false);
+
+    /**
+     * Computes the distances from the source to all the nodes using a radix heap kept by the calling thread between
+     * the calls, for the callers that search from many sources, but do not keep an engine.
+     *
+     * @param source[in] The node we want to start the search from.
+     * @param graph[in] The graph.
+     * @param distances[out] The distances, resized to the number of nodes. Unreachable nodes get 'UINT_MAX'.
+     * @param reversed[in] If true, the search follows the edges backwards.
+     */
+    static void computeOneToAllDistances(
+            unsigned int source,
+            const Graph& graph,
+            std::vector<unsigned int>& distances,
+            bool reversed = false);
+
+    /**
+     * Enables or disables the collection of the search statistics. When enabled, the following queries add their
+     * counters to the given instance, which is not reset between the queries.
+     *
+     * @param queryStatistics[in] The instance the counters are added to, or nullptr to disable the collection.
+     */
+    void setStatistics(QueryStatistics* queryStatistics);
+
+private:
+    using Queue = std::variant<RadixHeap, QuaternaryHeap, DialBuckets>;
+
+    static Queue createQueue(const Graph& graph, Heap heap);
+
+    void newQuery();
+
+    void reach(unsigned int node) {
+        if (stamps[node] != currentStamp) {
+            stamps[node] = currentStamp;
+            forwardDist[node] = UINT_MAX;
+            backwardDist[node] = UINT_MAX;
+        }
+    }
+
+    template <class Q>
+    unsigned int search(Q& queue, unsigned int start, unsigned int goal);
+
+    template <class Q>
+    unsigned int bidirectionalSearch(Q& forwardQueue, Q& backwardQueue, unsigned int start, unsigned int goal);
+
+    template <class Q>
+    void settle(Q& queue, std::vector<dist_t>& distances, const std::vector<dist_t>& otherDistances, bool backward,
+                unsigned long long& shortest);
+
+    const Graph& graph;
+    Queue forwardQueue;
+    Queue backwardQueue;
+    std::vector<unsigned int> stamps;
+    unsigned int currentStamp;
+    std::vector<dist_t> forwardDist;
+    std::vector<dist_t> backwardDist;
+    QueryStatistics* statistics;
+};
+
+#endif //SHORTEST_PATHS_DIJKSTRAENGINE_H
@@ -0,0 +1,121 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Czech Technical University in Prague
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. */
+
+/******************************************************************************
+* File:             DialBuckets.h
+*
+* Description:      Dial's bucket queue for graphs with small integer weights
+*****************************************************************************/
+
+#ifndef SHORTEST_PATHS_DIALBUCKETS_H
+#define SHORTEST_PATHS_DIALBUCKETS_H
+
+#include <utility>
+#include <vector>
+#include "../../constants.h"
+
+/**
+ * The bucket queue from Dial's variant of the Dijkstra's algorithm. During the Dijkstra's algorithm, all the keys in
+ * the queue lie between the current minimum and the current minimum plus the largest edge weight, so a circular array
+ * of 'maxWeight + 1' buckets holds every key in its own bucket. Pushing is constant time, popping scans the buckets
+ * from the current minimum, so the queue is a good fit for graphs with small weights (for example travel times
+ * in seconds) and a poor one when the largest weight is much larger than the typical one. Like 'RadixHeap', the keys
+ * must be monotone and the outdated entries are skipped by the caller.
+ */
+class DialBuckets {
+public:
+    /**
+     * Creates an empty queue.
+     *
+     * @param maxWeight[in] The largest edge weight in the graph.
+     */
+    explicit DialBuckets(dist_t maxWeight = 0) : buckets(static_cast<size_t>(maxWeight) + 1), current(0), count(0) {
+
+    }
+
+    /**
+     * @return True if there are no entries in the queue.
+     */
+    bool empty() const {
+        return count == 0;
+    }
+
+    /**
+     * Removes all the entries and resets the current minimum to zero.
+     */
+    void clear() {
+        if (count > 0) {
+            for (auto& bucket : buckets) {
+                bucket.clear();
+            }
+        }
+        current = 0;
+        count = 0;
+    }
+
+    /**
+     * Inserts an entry.
+     *
+     * @param node[in] The node.
+     * @param key[in] The key, at least the current minimum and at most the current minimum plus the largest weight.
+     */
+    void push(unsigned int node, dist_t key) {
+        buckets[key % buckets.size()].emplace_back(key, node);
+        count++;
+    }
+
+    /**
+     * @return The smallest key in the queue, the queue must not be empty.
+     */
+    dist_t minKey() {
+        advance();
+        return current;
+    }
+
+    /**
+     * Removes an entry with the smallest key, the queue must not be empty.
+     *
+     * @return The key and the node of the removed entry.
+     */
+    std::pair<dist_t, unsigned int> pop() {
+        advance();
+        auto& bucket = buckets[current % buckets.size()];
+        const auto entry = bucket.back();
+        bucket.pop_back();
+        count--;
+        return entry;
+    }
+
+private:
+    void advance() {
+        while (buckets[current % buckets.size()].empty()) {
+            current++;
+        }
+    }
+
+    std::vector<std::vector<std::pair<dist_t, unsigned int>>> buckets;
+    dist_t current;
+    size_t count;
+};
+
+#endif //SHORTEST_PATHS_DIALBUCKETS_H
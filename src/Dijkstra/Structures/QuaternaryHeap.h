@@ -0,0 +1,166 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Czech Technical University in Prague
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. */
+
+/******************************************************************************
+* File:             QuaternaryHeap.h
+*
+* Description:      Indexed 4-ary heap with a decrease key operation
+*****************************************************************************/
+
+#ifndef SHORTEST_PATHS_QUATERNARYHEAP_H
+#define SHORTEST_PATHS_QUATERNARYHEAP_H
+
+#include <algorithm>
+#include <climits>
+#include <utility>
+#include <vector>
+#include "../../constants.h"
+
+/**
+ * An indexed 4-ary heap. Every node is in the heap at most once: pushing a node that is already present only decreases
+ * its key (if the new key is smaller), so no outdated entries are ever popped. The position of every node in the heap
+ * is stored in an array with one element for each node of the graph. The array only has to be allocated once, because
+ * the positions of the popped nodes are reset when they leave the heap. The four children of an element are next to
+ * each other, so a sift down touches fewer cache lines than in a binary heap.
+ */
+class QuaternaryHeap {
+public:
+    /**
+     * Creates an empty heap.
+     *
+     * @param nodes[in] The number of nodes in the graph, the nodes pushed into the heap must be smaller.
+     */
+    explicit QuaternaryHeap(unsigned int nodes = 0) : positions(nodes, NONE) {
+
+    }
+
+    /**
+     * @return True if there are no entries in the heap.
+     */
+    bool empty() const {
+        return entries.empty();
+    }
+
+    /**
+     * Removes all the entries.
+     */
+    void clear() {
+        for (const auto& entry : entries) {
+            positions[entry.second] = NONE;
+        }
+        entries.clear();
+    }
+
+    /**
+     * Inserts the node, or decreases its key if it is already in the heap.
+     *
+     * @param node[in] The node.
+     * @param key[in] The key.
+     */
+    void push(unsigned int node, dist_t key) {
+        unsigned int position = positions[node];
+        if (position == NONE) {
+            position = static_cast<unsigned int>(entries.size());
+            entries.emplace_back(key, node);
+        } else if (key < entries[position].first) {
+            entries[position].first = key;
+        } else {
+            return;
+        }
+        siftUp(position);
+    }
+
+    /**
+     * @return The smallest key in the heap, the heap must not be empty.
+     */
+    dist_t minKey() const {
+        return entries.front().first;
+    }
+
+    /**
+     * Removes the entry with the smallest key, the heap must not be empty.
+     *
+     * @return The key and the node of the removed entry.
+     */
+    std::pair<dist_t, unsigned int> pop() {
+        const auto top = entries.front();
+        positions[top.second] = NONE;
+        const auto lastEntry = entries.back();
+        entries.pop_back();
+        if (!entries.empty()) {
+            entries[0] = lastEntry;
+            siftDown(0);
+        }
+        return top;
+    }
+
+private:
+    static constexpr unsigned int NONE = UINT_MAX;
+    static constexpr unsigned int ARITY = 4;
+
+    void siftUp(unsigned int position) {
+        const auto entry = entries[position];
+        while (position > 0) {
+            const unsigned int parent = (position - 1) / ARITY;
+            if (entries[parent].first <= entry.first) {
+                break;
+            }
+            entries[position] = entries[parent];
+            positions[entries[position].second] = position;
+            position = parent;
+        }
+        entries[position] = entry;
+        positions[entry.second] = position;
+    }
+
+    void siftDown(unsigned int position) {
+        const auto entry = entries[position];
+        const auto size = static_cast<unsigned int>(entries.size());
+        while (true) {
+            const unsigned int firstChild = position * ARITY + 1;
+            if (firstChild >= size) {
+                break;
+            }
+            unsigned int smallest = firstChild;
+            const unsigned int lastChild = std::min(firstChild + ARITY, size);
+            for (unsigned int child = firstChild + 1; child < lastChild; child++) {
+                if (entries[child].first < entries[smallest].first) {
+                    smallest = child;
+                }
+            }
+            if (entries[smallest].first >= entry.first) {
+                break;
+            }
+            entries[position] = entries[smallest];
+            positions[entries[position].second] = position;
+            position = smallest;
+        }
+        entries[position] = entry;
+        positions[entry.second] = position;
+    }
+
+    std::vector<std::pair<dist_t, unsigned int>> entries;
+    std::vector<unsigned int> positions;
+};
+
+#endif //SHORTEST_PATHS_QUATERNARYHEAP_H
@@ -0,0 +1,135 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Czech Technical University in Prague
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. */
+
+/******************************************************************************
+* File:             RadixHeap.h
+*
+* Description:      Monotone radix heap for integer Dijkstra keys
+*****************************************************************************/
+
+#ifndef SHORTEST_PATHS_RADIXHEAP_H
+#define SHORTEST_PATHS_RADIXHEAP_H
+
+#include <algorithm>
+#include <bit>
+#include <utility>
+#include <vector>
+#include "../../constants.h"
+
+/**
+ * A radix heap (Ahuja, Mehlhorn, Orlin and Tarjan) for 32-bit keys. It relies on the keys being monotone: no key smaller
+ * than the last extracted minimum may be pushed, which holds for the Dijkstra's algorithm with non-negative weights.
+ * An entry with the key 'k' is kept in the bucket given by the highest bit in which 'k' differs from the last minimum,
+ * so every entry moves to a lower bucket at most 32 times in total. The heap does not support decreasing a key, the
+ * caller pushes the node again and skips the outdated entries when they are popped (lazy deletion).
+ */
+class RadixHeap {
+public:
+    /**
+     * Creates an empty heap.
+     */
+    RadixHeap() : buckets(BUCKETS), last(0), count(0) {
+
+    }
+
+    /**
+     * @return True if there are no entries in the heap.
+     */
+    bool empty() const {
+        return count == 0;
+    }
+
+    /**
+     * Removes all the entries and resets the last minimum to zero.
+     */
+    void clear() {
+        for (auto& bucket : buckets) {
+            bucket.clear();
+        }
+        last = 0;
+        count = 0;
+    }
+
+    /**
+     * Inserts an entry.
+     *
+     * @param node[in] The node.
+     * @param key[in] The key, at least the last extracted minimum.
+     */
+    void push(unsigned int node, dist_t key) {
+        buckets[bucketIndex(key)].emplace_back(key, node);
+        count++;
+    }
+
+    /**
+     * @return The smallest key in the heap, the heap must not be empty.
+     */
+    dist_t minKey() {
+        refill();
+        return last;
+    }
+
+    /**
+     * Removes an entry with the smallest key, the heap must not be empty.
+     *
+     * @return The key and the node of the removed entry.
+     */
+    std::pair<dist_t, unsigned int> pop() {
+        refill();
+        const auto entry = buckets[0].back();
+        buckets[0].pop_back();
+        count--;
+        return entry;
+    }
+
+private:
+    static constexpr unsigned int BUCKETS = 33;
+
+    unsigned int bucketIndex(dist_t key) const {
+        return key == last ? 0 : 32 - static_cast<unsigned int>(std::countl_zero(key ^ last));
+    }
+
+    // Makes sure the first bucket is not empty: the smallest key of the first non-empty bucket becomes the new last
+    // minimum and the entries of that bucket are redistributed into the lower buckets.
+    void refill() {
+        if (!buckets[0].empty()) {
+            return;
+        }
+
+        unsigned int i = 1;
+        while (buckets[i].empty()) {
+            i++;
+        }
+        last = std::min_element(buckets[i].begin(), buckets[i].end())->first;
+        for (const auto& entry : buckets[i]) {
+            buckets[bucketIndex(entry.first)].push_back(entry);
+        }
+        buckets[i].clear();
+    }
+
+    std::vector<std::vector<std::pair<dist_t, unsigned int>>> buckets;
+    dist_t last;
+    size_t count;
+};
+
+#endif //SHORTEST_PATHS_RADIXHEAP_H
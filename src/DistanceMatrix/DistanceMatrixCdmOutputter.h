@@ -0,0 +1,48 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Czech Technical University in Prague
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. */
+
+/******************************************************************************
+* File:             DistanceMatrixCdmOutputter.h
+*
+* Description:      Stores the distance matrix in the compressed CDM format
+*****************************************************************************/
+
+#ifndef SHORTEST_PATHS_DISTANCEMATRIXCDMOUTPUTTER_H
+#define SHORTEST_PATHS_DISTANCEMATRIXCDMOUTPUTTER_H
+
+#include "DistanceMatrixOutputter.h"
+
+/**
+ * Allows to store the distance matrix to disk compressed using the 'DistanceMatrixCompressedProvider'. The distance
+ * matrix will be saved into a file specified by the path argument, suffix '.cdm' is added automatically.
+ * The format is described in 'FORMATS.md'.
+ */
+template <class IntType>
+class DistanceMatrixCdmOutputter : public DistanceMatrixOutputter<IntType> {
+public:
+    void store(Distance_matrix_travel_time_provider<IntType>& dm, const std::string &path) override;
+};
+
+#include "DistanceMatrixCdmOutputter.tpp"
+
+#endif //SHORTEST_PATHS_DISTANCEMATRIXCDMOUTPUTTER_H
@@ -0,0 +1,29 @@
+/******************************************************************************
+* File:             DistanceMatrixCdmOutputter.tpp
+*****************************************************************************/
+
+#include <fstream>
+#include <filesystem>
+#include "DistanceMatrixCompressedProvider.h"
+
+template <class IntType> void DistanceMatrixCdmOutputter<IntType>::store(Distance_matrix_travel_time_provider<IntType>& dm, const std::string &path) {
+    printf("Compressing the distance matrix.\n");
+    const auto compressed = DistanceMatrixCompressedProvider::compress(dm);
+    compressed->printInfo();
+
+    std::filesystem::space_info si = std::filesystem::space(".");
+    const unsigned long long total_bytes = compressed->memoryUsage();
+    if (total_bytes > si.available) {
+        throw std::runtime_error("Not enough free disk space." + std::to_string(total_bytes/1024) + "KiB required");
+    }
+
+    printf("Storing the distance matrix.\n");
+    std::ofstream output;
+    output.open(path + ".cdm", std::ios::binary);
+    if (!output.is_open()) {
+        throw std::runtime_error("Couldn't open file '" + path + ".cdm'!");
+    }
+
+    compressed->write(output);
+    output.close();
+}
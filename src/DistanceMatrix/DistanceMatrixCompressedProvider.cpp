@@ -0,0 +1,340 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Czech Technical University in Prague
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. */
+
+/******************************************************************************
+* File:             DistanceMatrixCompressedProvider.cpp
+*****************************************************************************/
+
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <boost/numeric/conversion/cast.hpp>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include "DistanceMatrixCompressedProvider.h"
+
+namespace {
+    // One exception is stored as the position inside the tile followed by the value.
+    constexpr size_t EXCEPTION_BYTES = sizeof(uint8_t) + sizeof(dist_t);
+
+    /**
+     * Decodes 'length' deltas of the given width and adds the base to them. Exceptions are decoded as
+     * base + the maximum value of the width and have to be patched by the caller.
+     */
+    void decodeTile(const uint8_t* deltas, const uint32_t width, const dist_t base, const unsigned int length, dist_t* out) {
+        unsigned int i = 0;
+        if (width == 1) {
+#if defined(__AVX2__)
+            const __m256i baseVector = _mm256_set1_epi32(static_cast<int>(base));
+            for (; i + 8 <= length; i += 8) {
+                const __m128i bytes = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(deltas + i));
+                const __m256i values = _mm256_add_epi32(_mm256_cvtepu8_epi32(bytes), baseVector);
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), values);
+            }
+#elif defined(__SSE2__)
+            const __m128i baseVector = _mm_set1_epi32(static_cast<int>(base));
+            const __m128i zero = _mm_setzero_si128();
+            for (; i + 16 <= length; i += 16) {
+                const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(deltas + i));
+                const __m128i low = _mm_unpacklo_epi8(bytes, zero);
+                const __m128i high = _mm_unpackhi_epi8(bytes, zero);
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_add_epi32(_mm_unpacklo_epi16(low, zero), baseVector));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i + 4), _mm_add_epi32(_mm_unpackhi_epi16(low, zero), baseVector));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i + 8), _mm_add_epi32(_mm_unpacklo_epi16(high, zero), baseVector));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i + 12), _mm_add_epi32(_mm_unpackhi_epi16(high, zero), baseVector));
+            }
+#endif
+            for (; i < length; i++) {
+                out[i] = base + deltas[i];
+            }
+        } else if (width == 2) {
+#if defined(__AVX2__)
+            const __m256i baseVector = _mm256_set1_epi32(static_cast<int>(base));
+            for (; i + 8 <= length; i += 8) {
+                const __m128i words = _mm_loadu_si128(reinterpret_cast<const __m128i*>(deltas + 2 * i));
+                const __m256i values = _mm256_add_epi32(_mm256_cvtepu16_epi32(words), baseVector);
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), values);
+            }
+#elif defined(__SSE2__)
+            const __m128i baseVector = _mm_set1_epi32(static_cast<int>(base));
+            const __m128i zero = _mm_setzero_si128();
+            for (; i + 8 <= length; i += 8) {
+                const __m128i words = _mm_loadu_si128(reinterpret_cast<const __m128i*>(deltas + 2 * i));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_add_epi32(_mm_unpacklo_epi16(words, zero), baseVector));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i + 4), _mm_add_epi32(_mm_unpackhi_epi16(words, zero), baseVector));
+            }
+#endif
+            for (; i < length; i++) {
+                uint16_t delta;
+                std::memcpy(&delta, deltas + 2 * i, sizeof(delta));
+                out[i] = base + delta;
+            }
+        } else {
+            std::memcpy(out, deltas, length * sizeof(dist_t));
+            for (; i < length; i++) {
+                out[i] += base;
+            }
+        }
+    }
+}
+
+//______________________________________________________________________________________________________________________
+DistanceMatrixCompressedProvider::DistanceMatrixCompressedProvider(const unsigned int nodes):
+    nodesCnt(nodes),
+    tilesPerRow((nodes + TILE_SIZE - 1) / TILE_SIZE),
+    compressedRows(0),
+    rowOffsets(nodes, 0) {
+    // The size of one row must fit into the tile offset.
+    if (static_cast<uint64_t>(nodes) * (sizeof(dist_t) + 1) > OFFSET_MASK) {
+        throw std::runtime_error("The distance matrix is too large to be compressed.");
+    }
+    tiles.reserve(static_cast<size_t>(tilesPerRow) * nodes);
+}
+
+//______________________________________________________________________________________________________________________
+void DistanceMatrixCompressedProvider::compressTile(const dist_t* values, const unsigned int length) {
+    const dist_t base = *std::min_element(values, values + length);
+
+    size_t over8 = 0;
+    size_t over16 = 0;
+    for (unsigned int i = 0; i < length; i++) {
+        const dist_t delta = values[i] - base;
+        over8 += delta >= std::numeric_limits<uint8_t>::max();
+        over16 += delta >= std::numeric_limits<uint16_t>::max();
+    }
+
+    // The narrow tiles are followed by one byte with the number of exceptions and the exceptions themselves.
+    const size_t cost8 = length + 1 + over8 * EXCEPTION_BYTES;
+    const size_t cost16 = 2 * static_cast<size_t>(length) + 1 + over16 * EXCEPTION_BYTES;
+    const size_t cost32 = 4 * static_cast<size_t>(length);
+
+    uint32_t widthLog;
+    dist_t sentinel;
+    size_t exceptionsCnt;
+    if (cost8 <= cost16 && cost8 <= cost32) {
+        widthLog = 0;
+        sentinel = std::numeric_limits<uint8_t>::max();
+        exceptionsCnt = over8;
+    } else if (cost16 <= cost32) {
+        widthLog = 1;
+        sentinel = std::numeric_limits<uint16_t>::max();
+        exceptionsCnt = over16;
+    } else {
+        widthLog = 2;
+        sentinel = std::numeric_limits<dist_t>::max();
+        exceptionsCnt = 0;
+    }
+    const uint32_t width = 1u << widthLog;
+
+    const size_t offset = data.size();
+    const auto relativeOffset = static_cast<uint32_t>(offset - rowOffsets[compressedRows]);
+    tiles.push_back(Tile{base, relativeOffset | (widthLog << WIDTH_SHIFT)});
+
+    const size_t deltasBytes = static_cast<size_t>(width) * length;
+    data.resize(offset + deltasBytes + (width == 4 ? 0 : 1 + exceptionsCnt * EXCEPTION_BYTES));
+    uint8_t* deltas = data.data() + offset;
+    uint8_t* exceptions = deltas + deltasBytes;
+    if (width != 4) {
+        *exceptions++ = static_cast<uint8_t>(exceptionsCnt);
+    }
+
+    for (unsigned int i = 0; i < length; i++) {
+        dist_t delta = values[i] - base;
+        if (width != 4 && delta >= sentinel) {
+            *exceptions++ = static_cast<uint8_t>(i);
+            std::memcpy(exceptions, &values[i], sizeof(dist_t));
+            exceptions += sizeof(dist_t);
+            delta = sentinel;
+        }
+        if (width == 1) {
+            deltas[i] = static_cast<uint8_t>(delta);
+        } else if (width == 2) {
+            const auto narrow = static_cast<uint16_t>(delta);
+            std::memcpy(deltas + 2 * i, &narrow, sizeof(narrow));
+        } else {
+            std::memcpy(deltas + 4 * i, &delta, sizeof(delta));
+        }
+    }
+}
+
+//______________________________________________________________________________________________________________________
+dist_t DistanceMatrixCompressedProvider::findDistance(const unsigned int start, const unsigned int goal) const {
+    if (start >= compressedRows || goal >= nodesCnt) {
+        throw std::out_of_range("Requested distance is out of bounds of the distance matrix.");
+    }
+
+    const Tile tile = tiles[static_cast<size_t>(start) * tilesPerRow + goal / TILE_SIZE];
+    const unsigned int position = goal % TILE_SIZE;
+    const uint8_t* deltas = data.data() + rowOffsets[start] + (tile.offsetAndWidth & OFFSET_MASK);
+
+    switch (tile.offsetAndWidth >> WIDTH_SHIFT) {
+        case 0: {
+            const uint8_t delta = deltas[position];
+            if (delta != std::numeric_limits<uint8_t>::max()) {
+                return tile.base + delta;
+            }
+            const unsigned int length = std::min(TILE_SIZE, nodesCnt - (goal - position));
+            return findException(deltas + length, position);
+        }
+        case 1: {
+            uint16_t delta;
+            std::memcpy(&delta, deltas + 2 * position, sizeof(delta));
+            if (delta != std::numeric_limits<uint16_t>::max()) {
+                return tile.base + delta;
+            }
+            const unsigned int length = std::min(TILE_SIZE, nodesCnt - (goal - position));
+            return findException(deltas + 2 * length, position);
+        }
+        default: {
+            dist_t delta;
+            std::memcpy(&delta, deltas + 4 * position, sizeof(delta));
+            return tile.base + delta;
+        }
+    }
+}
+
+//______________________________________________________________________________________________________________________
+dist_t DistanceMatrixCompressedProvider::findException(const uint8_t* exceptions, const unsigned int position) {
+    const unsigned int exceptionsCnt = *exceptions++;
+    for (unsigned int i = 0; i < exceptionsCnt; i++, exceptions += EXCEPTION_BYTES) {
+        if (exceptions[0] == position) {
+            dist_t value;
+            std::memcpy(&value, exceptions + 1, sizeof(value));
+            return value;
+        }
+    }
+    throw std::runtime_error("The compressed distance matrix is corrupted, missing exception value.");
+}
+
+//______________________________________________________________________________________________________________________
+void DistanceMatrixCompressedProvider::setDistance(unsigned int, unsigned int, dist_t) {
+    throw std::runtime_error("The compressed distance matrix is read-only.");
+}
+
+//______________________________________________________________________________________________________________________
+void DistanceMatrixCompressedProvider::decodeRow(const unsigned int row, dist_t* distances) const {
+    if (row >= compressedRows) {
+        throw std::out_of_range("Requested row is out of bounds of the distance matrix.");
+    }
+
+    const Tile* rowTiles = tiles.data() + static_cast<size_t>(row) * tilesPerRow;
+    const uint8_t* rowData = data.data() + rowOffsets[row];
+    for (unsigned int t = 0; t < tilesPerRow; t++) {
+        const Tile tile = rowTiles[t];
+        const unsigned int first = t * TILE_SIZE;
+        const unsigned int length = std::min(TILE_SIZE, nodesCnt - first);
+        const uint32_t width = 1u << (tile.offsetAndWidth >> WIDTH_SHIFT);
+        const uint8_t* deltas = rowData + (tile.offsetAndWidth & OFFSET_MASK);
+        decodeTile(deltas, width, tile.base, length, distances + first);
+
+        if (width != 4) {
+            const uint8_t* exceptions = deltas + static_cast<size_t>(width) * length;
+            const unsigned int exceptionsCnt = *exceptions++;
+            for (unsigned int i = 0; i < exceptionsCnt; i++, exceptions += EXCEPTION_BYTES) {
+                std::memcpy(distances + first + exceptions[0], exceptions + 1, sizeof(dist_t));
+            }
+        }
+    }
+}
+
+//______________________________________________________________________________________________________________________
+unsigned int DistanceMatrixCompressedProvider::nodes() const {
+    return nodesCnt;
+}
+
+//______________________________________________________________________________________________________________________
+size_t DistanceMatrixCompressedProvider::memoryUsage() const {
+    return rowOffsets.size() * sizeof(uint64_t) + tiles.size() * sizeof(Tile) + data.size();
+}
+
+//______________________________________________________________________________________________________________________
+void DistanceMatrixCompressedProvider::printInfo() const {
+    size_t widths[3] = {0, 0, 0};
+    for (const Tile& tile : tiles) {
+        widths[tile.offsetAndWidth >> WIDTH_SHIFT]++;
+    }
+
+    const double uncompressed = static_cast<double>(nodesCnt) * nodesCnt * sizeof(dist_t);
+    const double tilesCnt = tiles.empty() ? 1.0 : static_cast<double>(tiles.size());
+    std::cout << "Compressed distance matrix info." << std::endl;
+    std::cout << "Compressed size " << memoryUsage() / 1024 << " KiB, that is "
+        << static_cast<double>(memoryUsage()) / uncompressed * 100.0 << " % of the uncompressed matrix." << std::endl;
+    std::cout << "Tiles with 8-bit deltas: " << static_cast<double>(widths[0]) / tilesCnt * 100.0 << " %, 16-bit: "
+        << static_cast<double>(widths[1]) / tilesCnt * 100.0 << " %, 32-bit: "
+        << static_cast<double>(widths[2]) / tilesCnt * 100.0 << " %." << std::endl;
+}
+
+//______________________________________________________________________________________________________________________
+void DistanceMatrixCompressedProvider::write(std::ostream& output) const {
+    if (compressedRows != nodesCnt) {
+        throw std::runtime_error("Cannot store a partially filled compressed distance matrix.");
+    }
+
+    const unsigned int tileSize = TILE_SIZE;
+    const uint64_t dataBytes = data.size();
+
+    output.write("CDM", 3);
+    output.write(reinterpret_cast<const char*>(&nodesCnt), sizeof(nodesCnt));
+    output.write(reinterpret_cast<const char*>(&tileSize), sizeof(tileSize));
+    output.write(reinterpret_cast<const char*>(&dataBytes), sizeof(dataBytes));
+    output.write(reinterpret_cast<const char*>(rowOffsets.data()), static_cast<std::streamsize>(rowOffsets.size() * sizeof(uint64_t)));
+    output.write(reinterpret_cast<const char*>(tiles.data()), static_cast<std::streamsize>(tiles.size() * sizeof(Tile)));
+    output.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));
+}
+
+//______________________________________________________________________________________________________________________
+std::unique_ptr<DistanceMatrixCompressedProvider> DistanceMatrixCompressedProvider::read(std::istream& input) {
+    char header[3];
+    input.read(header, sizeof(header));
+    if (!input || header[0] != 'C' || header[1] != 'D' || header[2] != 'M') {
+        throw std::runtime_error("The input file is missing the Compressed Distance Matrix header.");
+    }
+
+    unsigned int nodes;
+    unsigned int tileSize;
+    uint64_t dataBytes;
+    input.read(reinterpret_cast<char*>(&nodes), sizeof(nodes));
+    input.read(reinterpret_cast<char*>(&tileSize), sizeof(tileSize));
+    input.read(reinterpret_cast<char*>(&dataBytes), sizeof(dataBytes));
+    if (tileSize != TILE_SIZE) {
+        throw std::runtime_error("Unsupported tile size " + std::to_string(tileSize) + " of the compressed distance matrix.");
+    }
+
+    auto dm = std::make_unique<DistanceMatrixCompressedProvider>(nodes);
+    dm->tiles.resize(static_cast<size_t>(dm->tilesPerRow) * nodes);
+    dm->data.resize(boost::numeric_cast<size_t>(dataBytes));
+    input.read(reinterpret_cast<char*>(dm->rowOffsets.data()), static_cast<std::streamsize>(dm->rowOffsets.size() * sizeof(uint64_t)));
+    input.read(reinterpret_cast<char*>(dm->tiles.data()), static_cast<std::streamsize>(dm->tiles.size() * sizeof(Tile)));
+    input.read(reinterpret_cast<char*>(dm->data.data()), static_cast<std::streamsize>(dm->data.size()));
+    if (!input) {
+        throw std::runtime_error("The compressed distance matrix file is truncated.");
+    }
+    dm->compressedRows = nodes;
+
+    return dm;
+}
@@ -0,0 +1,220 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Czech Technical University in Prague
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. */
+
+/******************************************************************************
+* File:             DistanceMatrixCompressedProvider.h
+*
+* Description:      Distance matrix compressed into tiles of narrow deltas
+*****************************************************************************/
+
+#ifndef SHORTEST_PATHS_DISTANCEMATRIXCOMPRESSEDPROVIDER_H
+#define SHORTEST_PATHS_DISTANCEMATRIXCOMPRESSEDPROVIDER_H
+
+#include <algorithm>
+#include <cstdint>
+#include <istream>
+#include <memory>
+#include <ostream>
+#include <stdexcept>
+#include <vector>
+
+#include "../constants.h"
+#include "DistanceMatrixInterface.h"
+#include "Distance_matrix_travel_time_provider.h"
+
+/**
+ * Distance matrix compressed in memory. Each row is split into tiles of TILE_SIZE consecutive columns. For each tile,
+ * the minimum of the tile is stored as a base value and the values of the tile are stored as deltas from the base
+ * using 1, 2 or 4 bytes, whichever results in the smallest tile. Deltas that do not fit into the selected width
+ * (typically unreachable nodes or a few distant nodes in an otherwise close tile) are replaced by the maximum value of
+ * the width and stored in an exception list placed right after the deltas of the tile. The tile header takes 8 bytes
+ * (the base and the offset of the tile data inside the row combined with the width).
+ *
+ * Random lookups stay O(1): one tile header read, one delta read, and only for exceptions a scan of the (at most
+ * TILE_SIZE) exceptions of the tile. Whole rows can be decoded using 'decodeRow', which uses SIMD instructions when
+ * the library is compiled with SSE2 or AVX2 support.
+ *
+ * The matrix is filled row by row using 'compressRow' and is read-only afterwards. The values are stored exactly as
+ * they were given, so the results are the same as with the uncompressed matrix the values were taken from.
+ */
+class DistanceMatrixCompressedProvider : public DistanceMatrixInterface {
+public:
+    static constexpr unsigned int TILE_SIZE = 64;
+
+    /**
+     * Creates an empty matrix, the rows have to be added using 'compressRow'.
+     *
+     * @param nodes[in] The number of nodes (rows and columns) in the square matrix.
+     */
+    explicit DistanceMatrixCompressedProvider(unsigned int nodes);
+
+    /**
+     * Compresses a whole uncompressed distance matrix.
+     *
+     * @param dm[in] The distance matrix to compress.
+     * @return The compressed distance matrix.
+     */
+    template <class IntType>
+    static std::unique_ptr<DistanceMatrixCompressedProvider> compress(Distance_matrix_travel_time_provider<IntType>& dm);
+
+    /**
+     * Compresses one row of the matrix. The rows must be added in order, starting with row 0.
+     *
+     * @param row[in] The index of the row, used to check that the rows are added in order.
+     * @param values[in] The 'nodes' values of the row.
+     */
+    template <class IntType>
+    void compressRow(unsigned int row, const IntType* values);
+
+    /**
+     * @param start[in] The start node for the query.
+     * @param goal[in] The goal node for the query.
+     * @return Returns the shortest distance from start to goal or 'std::numeric_limits<dist_t>::max()' if goal is not reachable from start.
+     */
+    [[nodiscard]] dist_t findDistance(unsigned int start, unsigned int goal) const override;
+
+    /**
+     * The compressed matrix is read-only, always throws std::runtime_error.
+     */
+    void setDistance(unsigned int source, unsigned int target, dist_t distance) override;
+
+    /**
+     * Decodes a whole row of the matrix.
+     *
+     * @param row[in] The row to decode.
+     * @param distances[out] Buffer for 'nodes' values that will be filled with the distances from 'row' to all nodes.
+     */
+    void decodeRow(unsigned int row, dist_t* distances) const;
+
+    /**
+     * @return The number of nodes (rows and columns) of the matrix.
+     */
+    [[nodiscard]] unsigned int nodes() const;
+
+    /**
+     * @return The number of bytes occupied by the compressed data (row offsets, tile headers, deltas and exceptions).
+     */
+    [[nodiscard]] size_t memoryUsage() const;
+
+    /**
+     * Prints the compression ratio and the distribution of the tile widths.
+     */
+    void printInfo() const;
+
+    /**
+     * Writes the compressed matrix into the stream in the CDM format (see 'FORMATS.md').
+     *
+     * @param output[in] The binary output stream.
+     */
+    void write(std::ostream& output) const;
+
+    /**
+     * Reads the compressed matrix from the stream in the CDM format (see 'FORMATS.md').
+     *
+     * @param input[in] The binary input stream positioned at the beginning of the CDM header.
+     * @return The compressed matrix.
+     */
+    static std::unique_ptr<DistanceMatrixCompressedProvider> read(std::istream& input);
+
+private:
+    struct Tile {
+        dist_t base;
+        uint32_t offsetAndWidth;
+    };
+    static_assert(sizeof(Tile) == 8, "The tiles are stored to the CDM file as they are in memory.");
+
+    // The offset of the tile data relative to the beginning of its row is stored in the lower bits of
+    // 'offsetAndWidth', the upper two bits contain log2 of the delta width in bytes.
+    static constexpr unsigned int WIDTH_SHIFT = 30;
+    static constexpr uint32_t OFFSET_MASK = (1u << WIDTH_SHIFT) - 1;
+
+    /**
+     * Selects the cheapest delta width for the tile and appends the tile.
+     *
+     * @param values[in] The values of the tile.
+     * @param length[in] The number of values in the tile (TILE_SIZE, possibly less for the last tile of a row).
+     */
+    void compressTile(const dist_t* values, unsigned int length);
+
+    /**
+     * Finds the value of an exception of a tile.
+     *
+     * @param exceptions[in] Pointer to the exception list of the tile (right after the deltas).
+     * @param position[in] The position of the value inside the tile.
+     * @return The exception value.
+     */
+    [[nodiscard]] static dist_t findException(const uint8_t* exceptions, unsigned int position);
+
+    unsigned int nodesCnt;
+    unsigned int tilesPerRow;
+    unsigned int compressedRows;
+    std::vector<uint64_t> rowOffsets;
+    std::vector<Tile> tiles;
+    std::vector<uint8_t> data;
+};
+
+//______________________________________________________________________________________________________________________
+template <class IntType>
+std::unique_ptr<DistanceMatrixCompressedProvider> DistanceMatrixCompressedProvider::compress(
+        Distance_matrix_travel_time_provider<IntType>& dm
+) {
+    const unsigned int nodes = dm.nodes();
+    auto compressed = std::make_unique<DistanceMatrixCompressedProvider>(nodes);
+    if (dm.getLayout() == DistanceMatrixLayout::FULL) {
+        const IntType* values = dm.getRawData().get();
+        for (unsigned int row = 0; row < nodes; row++) {
+            compressed->compressRow(row, values + static_cast<size_t>(row) * nodes);
+        }
+        return compressed;
+    }
+
+    // The rows of an upper triangular matrix are copied as complete rows, a tile of rows at a time.
+    std::vector<IntType> rows(static_cast<size_t>(TILE_SIZE) * nodes);
+    for (unsigned int first = 0; first < nodes; first += TILE_SIZE) {
+        const unsigned int count = std::min(TILE_SIZE, nodes - first);
+        dm.copyRows(first, count, rows.data());
+        for (unsigned int row = 0; row < count; row++) {
+            compressed->compressRow(first + row, rows.data() + static_cast<size_t>(row) * nodes);
+        }
+    }
+    return compressed;
+}
+
+//______________________________________________________________________________________________________________________
+template <class IntType>
+void DistanceMatrixCompressedProvider::compressRow(const unsigned int row, const IntType* values) {
+    if (row != compressedRows || row >= nodesCnt) {
+        throw std::runtime_error("The rows of the compressed distance matrix must be added in order.");
+    }
+
+    rowOffsets[row] = data.size();
+    dist_t tile[TILE_SIZE];
+    for (unsigned int first = 0; first < nodesCnt; first += TILE_SIZE) {
+        const unsigned int length = std::min(TILE_SIZE, nodesCnt - first);
+        std::copy(values + first, values + first + length, tile);
+        compressTile(tile, length);
+    }
+    compressedRows++;
+}
+
+#endif //SHORTEST_PATHS_DISTANCEMATRIXCOMPRESSEDPROVIDER_H
@@ -33,6 +33,8 @@
 #define SHORTEST_PATHS_DISTANCEMATRIXCOMPUTOR_H
 
 #include "../GraphBuilding/Loaders/GraphLoader.h"
+#include "DistanceMatrixLayout.h"
+#include <algorithm>
 #include <memory>
 
 /**
@@ -62,6 +64,14 @@ public:
         return std::move(distanceTable);
     }
 
+    /**
+     * @return The layout of the computed distances, UPPER_TRIANGULAR if the matrix was computed by one of the
+     * 'computeSymmetricDistanceMatrix' functions.
+     */
+    DistanceMatrixLayout getLayout() const {
+        return layout;
+    }
+
     virtual ~DistanceMatrixComputor() = default;
 
     virtual std::unique_ptr<IntType[]> compute_and_get_distance_matrix(GraphLoader& graphLoader, int scaling_factor) = 0;
@@ -72,6 +82,24 @@ public:
 protected:
     std::unique_ptr<IntType[]> distanceTable;
     unsigned int size;
+    DistanceMatrixLayout layout = DistanceMatrixLayout::FULL;
+
+    /**
+     * Converts the full symmetric matrix into its upper triangle (the UPPER_TRIANGULAR layout). The triangle is copied
+     * into a new array of 'upperTriangularEntries(size)' values and the full matrix is released, so both of them are
+     * only held while the triangle is being copied.
+     */
+    void packUpperTriangle() {
+        const size_t n = size;
+        const IntType* matrix = distanceTable.get();
+        auto triangle = std::make_unique<IntType[]>(upperTriangularEntries(size));
+        for (unsigned int row = 0; row < size; row++) {
+            const IntType* fullRow = matrix + row * n;
+            std::copy(fullRow + row, fullRow + n, triangle.get() + upperTriangularIndex(row, row, size));
+        }
+        distanceTable = std::move(triangle);
+        layout = DistanceMatrixLayout::UPPER_TRIANGULAR;
+    }
 };
 
 #endif // SHORTEST_PATHS_DISTANCEMATRIXCOMPUTOR_H
@@ -34,6 +34,7 @@
 #include <vector>
 #include "Distance_matrix_travel_time_provider.h"
 #include "DistanceMatrixComputor.h"
+#include "../GraphBuilding/Structures/Graph.h"
 
 
 template <class IntType>
@@ -45,6 +46,21 @@ public:
     std::unique_ptr<IntType[]> compute_and_get_distance_matrix(GraphLoader& graphLoader, int scaling_factor) override;
 
     void computeDistanceMatrix(const std::vector<dist_t>& graphAdjMatrix);
+
+    /**
+     * Computes the full distance matrix for a graph that has already been loaded.
+     *
+     * @param graph[in] The graph for which we want to compute the distance matrix.
+     */
+    void computeDistanceMatrix(const Graph& graph);
+
+    /**
+     * Computes the distance matrix of an undirected graph (see 'Graph::isSymmetric') and stores it in the
+     * UPPER_TRIANGULAR layout. The full matrix is needed during the computation, only the triangle is kept afterwards.
+     *
+     * @param graph[in] The undirected graph for which we want to compute the distance matrix.
+     */
+    void computeSymmetricDistanceMatrix(const Graph& graph);
 };
 
 #include "DistanceMatrixComputorFast.tpp"
@@ -25,10 +25,28 @@ void DistanceMatrixComputorFast<IntType>::computeDistanceMatrix(const std::vecto
     this->distanceTable = std::make_unique<IntType[]>(graphAdjMatrix.size());
 
     this->size = static_cast<unsigned>(std::sqrt(graphAdjMatrix.size()));
+    this->layout = DistanceMatrixLayout::FULL;
     johnson::johnson_parallel(graph, this->distanceTable.get());
     delete graph;
 }
 
+template<class IntType>
+void DistanceMatrixComputorFast<IntType>::computeDistanceMatrix(const Graph& graph) {
+    AdjMatrixGraph adjMatrixGraph(graph.nodes());
+    for (unsigned int from = 0; from < graph.nodes(); from++) {
+        for (const auto& [to, weight] : graph.outgoingEdges(from)) {
+            adjMatrixGraph.addEdge(from, to, weight);
+        }
+    }
+    computeDistanceMatrix(adjMatrixGraph.matrix());
+}
+
+template<class IntType>
+void DistanceMatrixComputorFast<IntType>::computeSymmetricDistanceMatrix(const Graph& graph) {
+    computeDistanceMatrix(graph);
+    this->packUpperTriangle();
+}
+
 template<class IntType>
 std::vector<dist_t> DistanceMatrixComputorFast<IntType>::loadGraph(GraphLoader& graphLoader, int scaling_factor) {
     AdjMatrixGraph graph(graphLoader.nodes());
@@ -0,0 +1,112 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Czech Technical University in Prague
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. */
+
+/******************************************************************************
+ * File:             DistanceMatrixComputorFloydWarshall.h
+ *
+ * Description:      Blocked Floyd-Warshall distance matrix computation
+ *****************************************************************************/
+
+#ifndef SHORTEST_PATHS_DISTANCEMATRIXCOMPUTORFLOYDWARSHALL_H
+#define SHORTEST_PATHS_DISTANCEMATRIXCOMPUTORFLOYDWARSHALL_H
+
+#include "../GraphBuilding/Structures/Graph.h"
+#include "DistanceMatrixComputor.h"
+
+/**
+ * Computes the full distance matrix using the Floyd-Warshall algorithm. The matrix is computed in place in the output
+ * buffer (no intermediate matrix of a wider integer type is allocated) and the computation is split into square blocks
+ * so that the three blocks used by each step fit into the cache. For every block of intermediate nodes, the diagonal
+ * block is computed first, then the blocks in the same row and column (in parallel) and finally all the remaining
+ * blocks (in parallel).
+ *
+ * The algorithm needs O(n^3) time independently of the number of edges, so it only pays off for small graphs (a few
+ * thousand nodes) that are dense or for which the vectorised inner loop beats the n runs of Dijkstra. The inner loop
+ * is a min-plus update of a matrix row; it uses AVX-512 or AVX2 when the compiler targets them and a portable loop
+ * otherwise.
+ *
+ * All additions saturate at the maximum of IntType, which is also the value of the unreachable pairs. Consequently,
+ * a distance that does not fit into IntType is stored as unreachable instead of overflowing.
+ */
+template <class IntType>
+class DistanceMatrixComputorFloydWarshall : public DistanceMatrixComputor<IntType> {
+public:
+    /**
+     * The size of the square blocks (in matrix entries). Three blocks of 32-bit integers take 48 KiB.
+     */
+    static constexpr unsigned int BLOCK_SIZE = 64;
+
+    std::unique_ptr<IntType[]> compute_and_get_distance_matrix(GraphLoader& graphLoader, int scaling_factor) override;
+
+    /**
+     * Computes the full distance matrix for the given graph. The matrix is stored in the instance of the
+     * DistanceMatrixComputor class, so that it can be output or used further.
+     *
+     * @param graph[in] The graph for which we want to compute the distance matrix.
+     * @throws boost::bad_numeric_cast If some edge weight does not fit into IntType.
+     */
+    void computeDistanceMatrix(const Graph& graph);
+
+    /**
+     * Computes the distance matrix of an undirected graph (see 'Graph::isSymmetric') and stores it in the
+     * UPPER_TRIANGULAR layout. The matrix stays symmetric after every step of the algorithm, so only the blocks on and
+     * above the diagonal are relaxed and each of them is then copied (transposed) below the diagonal, which halves the
+     * computation. The full matrix is needed during the computation, only the triangle is kept afterwards.
+     *
+     * @param graph[in] The undirected graph for which we want to compute the distance matrix.
+     * @throws boost::bad_numeric_cast If some edge weight does not fit into IntType.
+     */
+    void computeSymmetricDistanceMatrix(const Graph& graph);
+
+private:
+    /**
+     * Runs the blocked algorithm on the matrix filled by 'initializeMatrix'.
+     *
+     * @param symmetric[in] Whether the matrix is symmetric, only the blocks on and above the diagonal are relaxed then.
+     */
+    void computeBlocks(bool symmetric);
+
+    /**
+     * Fills the matrix with the edge weights: zeros on the diagonal, the weight of the shortest edge between each pair
+     * of nodes connected by an edge and the maximum of IntType for all the other pairs.
+     */
+    void initializeMatrix(const Graph& graph);
+
+    /**
+     * Relaxes the block of rows x columns entries starting at 'c' with paths going through 'depth' intermediate nodes:
+     * c[i][j] = min(c[i][j], a[i][k] + b[k][j]). The blocks may overlap (the diagonal block and the blocks in its row
+     * and column), in which case the intermediate nodes have to be processed in order, which is what 'dependent'
+     * does. Otherwise, the loops are ordered so that the row of 'c' stays in the cache.
+     */
+    void relaxBlock(IntType* c, const IntType* a, const IntType* b, unsigned int rows, unsigned int columns,
+                    unsigned int depth, bool dependent) const;
+
+    /**
+     * Copies the block of rows x columns entries starting at 'source' transposed to 'target'.
+     */
+    void transposeBlock(const IntType* source, IntType* target, unsigned int rows, unsigned int columns) const;
+};
+
+#include "DistanceMatrixComputorFloydWarshall.tpp"
+
+#endif //SHORTEST_PATHS_DISTANCEMATRIXCOMPUTORFLOYDWARSHALL_H
@@ -0,0 +1,249 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Czech Technical University in Prague
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. */
+
+/******************************************************************************
+ * File:             DistanceMatrixComputorFloydWarshall.tpp
+ *****************************************************************************/
+
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <boost/numeric/conversion/cast.hpp>
+
+#if defined(__AVX2__) || defined(__AVX512F__)
+#include <immintrin.h>
+#endif
+
+namespace floyd_warshall {
+    /**
+     * c[j] = min(c[j], a + b[j]) for 'length' entries, the addition saturates at the maximum of T. The saturating
+     * addition is written as b + min(a, max - b) which does not overflow and which the compiler can vectorise. The rows
+     * 'c' and 'b' must not overlap.
+     */
+    template<class T>
+    inline void minPlusRowScalar(T* c, const T* b, const T a, const unsigned int start, const unsigned int length) {
+        constexpr T max = std::numeric_limits<T>::max();
+#pragma omp simd
+        for (unsigned int j = start; j < length; j++) {
+            const T sum = static_cast<T>(b[j] + std::min(a, static_cast<T>(max - b[j])));
+            c[j] = std::min(c[j], sum);
+        }
+    }
+
+    template<class T>
+    inline void minPlusRow(T* c, const T* b, const T a, const unsigned int length) {
+        minPlusRowScalar(c, b, a, 0, length);
+    }
+
+    inline void minPlusRow(uint32_t* c, const uint32_t* b, const uint32_t a, const unsigned int length) {
+        unsigned int j = 0;
+#if defined(__AVX512F__)
+        const __m512i aVector = _mm512_set1_epi32(static_cast<int>(a));
+        const __m512i ones = _mm512_set1_epi32(-1);
+        for (; j + 16 <= length; j += 16) {
+            const __m512i bVector = _mm512_loadu_si512(b + j);
+            const __m512i sum = _mm512_add_epi32(bVector, _mm512_min_epu32(aVector, _mm512_xor_si512(bVector, ones)));
+            _mm512_storeu_si512(c + j, _mm512_min_epu32(_mm512_loadu_si512(c + j), sum));
+        }
+#elif defined(__AVX2__)
+        const __m256i aVector = _mm256_set1_epi32(static_cast<int>(a));
+        const __m256i ones = _mm256_set1_epi32(-1);
+        for (; j + 8 <= length; j += 8) {
+            const __m256i bVector = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + j));
+            const __m256i sum = _mm256_add_epi32(bVector, _mm256_min_epu32(aVector, _mm256_xor_si256(bVector, ones)));
+            const __m256i cVector = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(c + j));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(c + j), _mm256_min_epu32(cVector, sum));
+        }
+#endif
+        minPlusRowScalar(c, b, a, j, length);
+    }
+
+    inline void minPlusRow(uint16_t* c, const uint16_t* b, const uint16_t a, const unsigned int length) {
+        unsigned int j = 0;
+#if defined(__AVX512BW__)
+        const __m512i aVector = _mm512_set1_epi16(static_cast<short>(a));
+        for (; j + 32 <= length; j += 32) {
+            const __m512i sum = _mm512_adds_epu16(_mm512_loadu_si512(b + j), aVector);
+            _mm512_storeu_si512(c + j, _mm512_min_epu16(_mm512_loadu_si512(c + j), sum));
+        }
+#elif defined(__AVX2__)
+        const __m256i aVector = _mm256_set1_epi16(static_cast<short>(a));
+        for (; j + 16 <= length; j += 16) {
+            const __m256i sum = _mm256_adds_epu16(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + j)), aVector);
+            const __m256i cVector = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(c + j));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(c + j), _mm256_min_epu16(cVector, sum));
+        }
+#endif
+        minPlusRowScalar(c, b, a, j, length);
+    }
+}
+
+//______________________________________________________________________________________________________________________
+template<class IntType> std::unique_ptr<IntType[]> DistanceMatrixComputorFloydWarshall<IntType>::compute_and_get_distance_matrix(
+        GraphLoader& graphLoader,
+        int scaling_factor
+) {
+    Graph graph(graphLoader.nodes());
+    graphLoader.loadGraph(graph, scaling_factor);
+    computeDistanceMatrix(graph);
+    return this->getDistanceMatrixInstance();
+}
+
+//______________________________________________________________________________________________________________________
+template<class IntType> void DistanceMatrixComputorFloydWarshall<IntType>::computeDistanceMatrix(const Graph& graph) {
+    initializeMatrix(graph);
+    computeBlocks(false);
+}
+
+//______________________________________________________________________________________________________________________
+template<class IntType> void DistanceMatrixComputorFloydWarshall<IntType>::computeSymmetricDistanceMatrix(const Graph& graph) {
+    initializeMatrix(graph);
+    computeBlocks(true);
+    this->packUpperTriangle();
+}
+
+//______________________________________________________________________________________________________________________
+template<class IntType> void DistanceMatrixComputorFloydWarshall<IntType>::computeBlocks(const bool symmetric) {
+    const size_t n = this->size;
+    IntType* matrix = this->distanceTable.get();
+    const int blocks = static_cast<int>((n + BLOCK_SIZE - 1) / BLOCK_SIZE);
+    const auto blockLength = [n](const int block) {
+        return static_cast<unsigned int>(std::min<size_t>(BLOCK_SIZE, n - static_cast<size_t>(block) * BLOCK_SIZE));
+    };
+
+    for (int kBlock = 0; kBlock < blocks; kBlock++) {
+        std::cout << "\rProcessed " << kBlock << '/' << blocks << " blocks of the distance matrix.";
+        const size_t k0 = static_cast<size_t>(kBlock) * BLOCK_SIZE;
+        const unsigned int kLength = blockLength(kBlock);
+        IntType* diagonal = matrix + k0 * n + k0;
+
+        // phase 1: the diagonal block depends only on itself
+        relaxBlock(diagonal, diagonal, diagonal, kLength, kLength, kLength, true);
+
+        // phase 2: the blocks in the row and column of the diagonal block depend on themselves and the diagonal block
+#pragma omp parallel for schedule(dynamic)
+        for (int block = 0; block < blocks; block++) {
+            if (block == kBlock) {
+                continue;
+            }
+            const size_t start = static_cast<size_t>(block) * BLOCK_SIZE;
+            const unsigned int length = blockLength(block);
+            IntType* rowBlock = matrix + k0 * n + start;
+            relaxBlock(rowBlock, diagonal, rowBlock, kLength, length, kLength, true);
+            IntType* columnBlock = matrix + start * n + k0;
+            if (symmetric) {
+                transposeBlock(rowBlock, columnBlock, kLength, length);
+            } else {
+                relaxBlock(columnBlock, columnBlock, diagonal, length, kLength, kLength, true);
+            }
+        }
+
+        // phase 3: the remaining blocks depend only on the blocks from phase 2
+#pragma omp parallel for collapse(2) schedule(dynamic)
+        for (int iBlock = 0; iBlock < blocks; iBlock++) {
+            for (int jBlock = 0; jBlock < blocks; jBlock++) {
+                if (iBlock == kBlock || jBlock == kBlock || (symmetric && jBlock < iBlock)) {
+                    continue;
+                }
+                const size_t i0 = static_cast<size_t>(iBlock) * BLOCK_SIZE;
+                const size_t j0 = static_cast<size_t>(jBlock) * BLOCK_SIZE;
+                relaxBlock(matrix + i0 * n + j0, matrix + i0 * n + k0, matrix + k0 * n + j0, blockLength(iBlock),
+                           blockLength(jBlock), kLength, false);
+                if (symmetric && jBlock != iBlock) {
+                    transposeBlock(matrix + i0 * n + j0, matrix + j0 * n + i0, blockLength(iBlock), blockLength(jBlock));
+                }
+            }
+        }
+    }
+
+    std::cout << "\rProcessed " << blocks << '/' << blocks << " blocks of the distance matrix." << std::endl;
+}
+
+//______________________________________________________________________________________________________________________
+template<class IntType> void DistanceMatrixComputorFloydWarshall<IntType>::initializeMatrix(const Graph& graph) {
+    this->size = graph.nodes();
+    this->layout = DistanceMatrixLayout::FULL;
+    const size_t n = this->size;
+    this->distanceTable = std::make_unique<IntType[]>(n * n);
+    IntType* matrix = this->distanceTable.get();
+
+    std::fill(matrix, matrix + n * n, std::numeric_limits<IntType>::max());
+    for (size_t from = 0; from < n; from++) {
+        IntType* row = matrix + from * n;
+        row[from] = 0;
+        for (const auto& [to, weight] : graph.outgoingEdges(static_cast<unsigned int>(from))) {
+            row[to] = std::min(row[to], boost::numeric_cast<IntType>(weight));
+        }
+    }
+}
+
+//______________________________________________________________________________________________________________________
+template<class IntType> void DistanceMatrixComputorFloydWarshall<IntType>::relaxBlock(
+        IntType* c,
+        const IntType* a,
+        const IntType* b,
+        const unsigned int rows,
+        const unsigned int columns,
+        const unsigned int depth,
+        const bool dependent
+) const {
+    constexpr IntType unreachable = std::numeric_limits<IntType>::max();
+    const size_t n = this->size;
+
+    if (dependent) {
+        for (unsigned int k = 0; k < depth; k++) {
+            for (unsigned int i = 0; i < rows; i++) {
+                const IntType viaK = a[i * n + k];
+                // relaxing a row with itself (the row of node k in the blocks of its row) never improves it
+                if (viaK != unreachable && c + i * n != b + k * n) {
+                    floyd_warshall::minPlusRow(c + i * n, b + k * n, viaK, columns);
+                }
+            }
+        }
+    } else {
+        for (unsigned int i = 0; i < rows; i++) {
+            for (unsigned int k = 0; k < depth; k++) {
+                const IntType viaK = a[i * n + k];
+                if (viaK != unreachable) {
+                    floyd_warshall::minPlusRow(c + i * n, b + k * n, viaK, columns);
+                }
+            }
+        }
+    }
+}
+
+//______________________________________________________________________________________________________________________
+template<class IntType> void DistanceMatrixComputorFloydWarshall<IntType>::transposeBlock(
+        const IntType* source,
+        IntType* target,
+        const unsigned int rows,
+        const unsigned int columns
+) const {
+    const size_t n = this->size;
+    for (unsigned int j = 0; j < columns; j++) {
+        for (unsigned int i = 0; i < rows; i++) {
+            target[j * n + i] = source[i * n + j];
+        }
+    }
+}
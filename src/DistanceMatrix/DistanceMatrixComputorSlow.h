@@ -60,6 +60,15 @@ public:
      */
     void computeDistanceMatrixInReversedGraph(const Graph& graph);
 
+    /**
+     * Computes the distance matrix of an undirected graph (see 'Graph::isSymmetric') in the UPPER_TRIANGULAR layout,
+     * which takes half of the memory. Each row still needs a full Dijkstra run, only the distances to the nodes with
+     * higher IDs are stored.
+     *
+     * @param graph[in] The undirected graph for which we want to compute the distance matrix.
+     */
+    void computeSymmetricDistanceMatrix(const Graph& graph);
+
 private:
     /**
      * // This function will compute one row of the full distance matrix. This is done by running a simple Dijkstra from the
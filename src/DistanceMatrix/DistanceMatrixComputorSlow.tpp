@@ -3,6 +3,7 @@
 // Created on: 05.10.19
 //
 
+#include <algorithm>
 #include <boost/numeric/conversion/cast.hpp>
 #include <climits>
 #include <cstddef>
@@ -25,6 +26,7 @@ template<class IntType> std::unique_ptr<IntType[]> DistanceMatrixComputorSlow<In
 //______________________________________________________________________________________________________________________
 template<class IntType> void DistanceMatrixComputorSlow<IntType>::computeDistanceMatrix(const Graph& graph) {
     this->size = graph.nodes();
+    this->layout = DistanceMatrixLayout::FULL;
 
     this->distanceTable = std::make_unique<IntType[]>(((size_t) this->size) * ((size_t) this->size));
 
@@ -44,6 +46,7 @@ template<class IntType> void DistanceMatrixComputorSlow<IntType>::computeDistanc
 
     this->distanceTable = std::make_unique<IntType[]>(((size_t) nodesCnt) * ((size_t) nodesCnt));
     this->size = nodesCnt;
+    this->layout = DistanceMatrixLayout::FULL;
 
     for (unsigned int i = 0; i < nodesCnt; ++i) {
         if (i % 100 == 0) {
@@ -55,6 +58,23 @@ template<class IntType> void DistanceMatrixComputorSlow<IntType>::computeDistanc
     std::cout << "\rComputed " << nodesCnt << '/' << nodesCnt << " rows of the distance matrix." << std::endl;
 }
 
+//______________________________________________________________________________________________________________________
+template<class IntType> void DistanceMatrixComputorSlow<IntType>::computeSymmetricDistanceMatrix(const Graph& graph) {
+    this->size = graph.nodes();
+    this->layout = DistanceMatrixLayout::UPPER_TRIANGULAR;
+
+    this->distanceTable = std::make_unique<IntType[]>(upperTriangularEntries(this->size));
+
+    for (unsigned int i = 0; i < this->size; ++i) {
+        if (i % 100 == 0) {
+            std::cout << "\rComputed " << i << '/' << this->size << " rows of the distance matrix.";
+        }
+        fillDistanceMatrixRow(i, graph);
+    }
+
+    std::cout << "\rComputed " << this->size << '/' << this->size << " rows of the distance matrix." << std::endl;
+}
+
 //______________________________________________________________________________________________________________________
 template<class IntType> void DistanceMatrixComputorSlow<IntType>::fillDistanceMatrixRow(const unsigned int rowID, const Graph& graph, bool useReversedGraph) {
     auto n = (size_t) graph.nodes();
@@ -98,8 +118,12 @@ template<class IntType> void DistanceMatrixComputorSlow<IntType>::fillDistanceMa
 
     }
 
-    for (size_t i = 0; i < (size_t) n; ++i) {
-        this->distanceTable[((size_t) rowID) * ((size_t) n) + ((size_t) i)] = distance[i];
+    if (this->layout == DistanceMatrixLayout::UPPER_TRIANGULAR) {
+        std::copy(distance + rowID, distance + n, this->distanceTable.get() + upperTriangularIndex(rowID, rowID, this->size));
+    } else {
+        for (size_t i = 0; i < (size_t) n; ++i) {
+            this->distanceTable[((size_t) rowID) * ((size_t) n) + ((size_t) i)] = distance[i];
+        }
     }
     delete [] distance;
 }
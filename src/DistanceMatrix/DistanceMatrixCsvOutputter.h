@@ -34,14 +34,43 @@
 
 #include "DistanceMatrixOutputter.h"
 
+#include <vector>
+
 /**
  * Allows to store the distance matrix to disk in a CSV format. Comma is used as delimiter.
  * The distance matrix will be saved into a file specified by the path argument, suffix '.csv' is added automatically.
+ * The path '-' writes the matrix to the standard output instead.
+ *
+ * The rows are formatted in parallel in batches, a batch is written while the next one is being formatted.
  */
 template <class IntType>
 class DistanceMatrixCsvOutputter : public DistanceMatrixOutputter<IntType> {
 public:
     void store(Distance_matrix_travel_time_provider<IntType>& dm, const std::string &path) override;
+
+private:
+    /**
+     * The approximate size of the text formatted by one thread in one batch.
+     */
+    static constexpr size_t blockSize = 4 * 1024 * 1024;
+
+    /**
+     * Formats the rows [firstRow, lastRow) of the matrix into the buffer, replacing its previous content.
+     *
+     * @param distances[in] The row-major matrix.
+     * @param nodesCnt[in] The number of nodes (rows and columns) of the matrix.
+     * @param firstRow[in] The first row to format.
+     * @param lastRow[in] The row after the last row to format.
+     * @param charsPerRow[in] The maximum length of a formatted row including the line end.
+     * @param buffer[out] The buffer the rows will be formatted into.
+     */
+    static void formatRows(
+            const IntType* distances,
+            unsigned int nodesCnt,
+            size_t firstRow,
+            size_t lastRow,
+            size_t charsPerRow,
+            std::vector<char>& buffer);
 };
 
 #include "DistanceMatrixCsvOutputter.tpp"
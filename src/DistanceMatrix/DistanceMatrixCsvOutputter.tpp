@@ -5,52 +5,97 @@
 * Created:          07/28/20 
 *****************************************************************************/
 
-#include <fstream>
-#include <filesystem>
+#include <algorithm>
+#include <charconv>
+#include <iostream>
+#include <omp.h>
+#include "DistanceMatrixOutputStream.h"
 #include "../progress_bar.h"
 
 template <class IntType> void DistanceMatrixCsvOutputter<IntType>::store(Distance_matrix_travel_time_provider<IntType>& dm, const std::string &path) {
-    const auto& distances = dm.getRawData();
-    const auto nodesCnt = dm.nodes();
+    const IntType* distances = dm.getRawData().get();
+    const unsigned int nodesCnt = dm.nodes();
+    const size_t size = dm.entries();
 
     IntType max_dist = 0;
-    for (size_t i = 0; i < static_cast<unsigned long long>(nodesCnt) * nodesCnt; i++) {
+    for (size_t i = 0; i < size; i++) {
         max_dist = std::max(max_dist, distances[i]);
     }
-    size_t charsPerValue = std::to_string(max_dist).length();
-    unsigned long long totalChars = nodesCnt * (nodesCnt*charsPerValue + nodesCnt + 2);
-    std::filesystem::space_info si = std::filesystem::space(".");
-    if (totalChars > si.available) {
-        throw std::runtime_error("Not enough free disk space." + std::to_string(totalChars/1024) + "KiB required");
-    }
+    // Every value is followed either by a comma or by the line end.
+    const size_t charsPerRow = static_cast<size_t>(nodesCnt) * (std::to_string(max_dist).length() + 1);
+    const unsigned long long totalChars = static_cast<unsigned long long>(nodesCnt) * charsPerRow;
 
-    printf("Storing the distance matrix.\n");
-    std::ofstream output;
-    output.open(path + ".csv");
-    if (!output.is_open()) {
-        printf("Couldn't open file '%s'!", (path + ".csv").c_str());
-    }
+    const std::string outputPath = DistanceMatrixOutputStream::isStandardOutput(path) ? path : path + ".csv";
+    DistanceMatrixOutputStream::checkFreeSpace(outputPath, totalChars);
+
+    std::cout << "Storing the distance matrix." << std::endl;
+    const auto threads = static_cast<unsigned int>(omp_get_max_threads());
+    DistanceMatrixOutputStream output(outputPath, 2 * threads);
 
-    unsigned counter = 0;
     constexpr unsigned progress_bar_step = 1000;
-    
     indicators::ProgressBar progress_bar{
         indicators::option::BarWidth{70},
         indicators::option::PostfixText{"Storing distance matrix"},
         indicators::option::MaxProgress{nodesCnt / progress_bar_step}
     };
-    auto size = static_cast<size_t>(nodesCnt) * nodesCnt;
-    for(size_t i = 0; i < size; i++) {
-        output << distances[i];
-
-        if ((i + 1) % nodesCnt == 0) {
-            output << std::endl;
-            ++counter;
-            if(counter % progress_bar_step == 0) {
-                progress_bar.tick();
+
+    // Each thread formats a contiguous range of rows of the batch into its own buffer, the buffers are then written in
+    // the thread order, so the rows stay in order. The next batch is formatted while the previous one is written.
+    const size_t rowsPerThread = std::max<size_t>(1, blockSize / std::max<size_t>(1, charsPerRow));
+    const size_t rowsPerBatch = rowsPerThread * threads;
+    std::vector<std::vector<char>> buffers(threads);
+    // The rows of an upper triangular matrix are first copied as complete rows.
+    const bool upperTriangular = dm.getLayout() == DistanceMatrixLayout::UPPER_TRIANGULAR;
+    std::vector<std::vector<IntType>> rows(upperTriangular ? threads : 0);
+    size_t ticks = 0;
+    for (size_t batchBegin = 0; batchBegin < nodesCnt; batchBegin += rowsPerBatch) {
+        const size_t batchEnd = std::min<size_t>(nodesCnt, batchBegin + rowsPerBatch);
+
+        #pragma omp parallel for num_threads(threads) schedule(static, 1)
+        for (int thread = 0; thread < static_cast<int>(threads); ++thread) {
+            const size_t firstRow = std::min(batchEnd, batchBegin + thread * rowsPerThread);
+            const size_t lastRow = std::min(batchEnd, firstRow + rowsPerThread);
+            if (upperTriangular) {
+                rows[thread].resize((lastRow - firstRow) * nodesCnt);
+                dm.copyRows(static_cast<unsigned int>(firstRow), static_cast<unsigned int>(lastRow - firstRow),
+                            rows[thread].data());
+                formatRows(rows[thread].data(), nodesCnt, 0, lastRow - firstRow, charsPerRow, buffers[thread]);
+            } else {
+                formatRows(distances, nodesCnt, firstRow, lastRow, charsPerRow, buffers[thread]);
+            }
+        }
+
+        for (auto& buffer : buffers) {
+            if (!buffer.empty()) {
+                output.write(buffer);
             }
-        } else {
-            output << ",";
         }
+
+        for (; ticks < batchEnd / progress_bar_step; ++ticks) {
+            progress_bar.tick();
+        }
+    }
+
+    output.close();
+}
+
+template <class IntType> void DistanceMatrixCsvOutputter<IntType>::formatRows(
+        const IntType* distances,
+        unsigned int nodesCnt,
+        size_t firstRow,
+        size_t lastRow,
+        size_t charsPerRow,
+        std::vector<char>& buffer) {
+    buffer.resize((lastRow - firstRow) * charsPerRow);
+    char* position = buffer.data();
+    char* const end = position + buffer.size();
+    for (size_t row = firstRow; row < lastRow; ++row) {
+        const IntType* values = distances + row * nodesCnt;
+        for (unsigned int column = 0; column < nodesCnt; ++column) {
+            position = std::to_chars(position, end, values[column]).ptr;
+            *position++ = ',';
+        }
+        *(position - 1) = '\n';
     }
+    buffer.resize(static_cast<size_t>(position - buffer.data()));
 }
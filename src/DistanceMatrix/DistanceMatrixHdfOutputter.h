@@ -31,6 +31,7 @@
 #ifndef SHORTEST_PATHS_DISTANCEMATRIXHDFOUTPUTTER_H
 #define SHORTEST_PATHS_DISTANCEMATRIXHDFOUTPUTTER_H
 
+#include <vector>
 #include "DistanceMatrixOutputter.h"
 
 /**
@@ -42,6 +43,20 @@ class DistanceMatrixHdfOutputter : public DistanceMatrixOutputter<IntType> {
 
 public:
     void store(Distance_matrix_travel_time_provider<IntType>& dm, const std::string &path) override;
+
+    /**
+     * Overwrites the given rows of an existing HDF5 file with the rows of the matrix, the rest of the file is not
+     * touched. Used after the rows were recomputed by the 'DistanceMatrixUpdater'. The stored integer type is kept,
+     * so if some of the new distances do not fit into it, nothing is written and an exception is thrown.
+     *
+     * @param dm[in] The updated distance matrix.
+     * @param path[in] The path to the existing HDF5 file, including the extension.
+     * @param rows[in] The rows to write in increasing order.
+     */
+    static void storeRows(
+            Distance_matrix_travel_time_provider<IntType>& dm,
+            const std::string& path,
+            const std::vector<unsigned int>& rows);
 };
 
 #include "DistanceMatrixHdfOutputter.tpp"
@@ -13,31 +13,31 @@ template <class IntType>void DistanceMatrixHdfOutputter<IntType>::store(Distance
 
     const auto& distances = dm.getRawData();
     const auto nodesCnt = dm.nodes();
-    hsize_t dimsf[] = { nodesCnt, nodesCnt };
+    const size_t entries = dm.entries();
     IntType* values = distances.get();
 
     IntType max_dist = 0;
-    for (size_t i = 0; i < static_cast<unsigned long long>(nodesCnt) * nodesCnt; i++) {
+    for (size_t i = 0; i < entries; i++) {
         max_dist = std::max(max_dist, values[i]);
     }
 
     H5::DataType datatype;
-    unsigned int total_bytes;
+    unsigned long long total_bytes;
     if (max_dist < UINT8_MAX) {
         datatype = static_cast<H5::DataType>(H5::PredType::STD_U8LE);
-        total_bytes = nodesCnt * nodesCnt;
+        total_bytes = entries;
     }
     else if (max_dist < UINT16_MAX) {
         datatype = static_cast<H5::DataType>(H5::PredType::STD_U16LE);
-        total_bytes = 2 * nodesCnt * nodesCnt;
+        total_bytes = 2ULL * entries;
     }
     else if (max_dist < UINT32_MAX) {
         datatype = static_cast<H5::DataType>(H5::PredType::STD_U32LE);
-        total_bytes = 4 * nodesCnt * nodesCnt;
+        total_bytes = 4ULL * entries;
     }
     else {
         datatype = static_cast<H5::DataType>(H5::PredType::STD_U64LE);
-        total_bytes = 8 * nodesCnt * nodesCnt;
+        total_bytes = 8ULL * entries;
     }
 
     std::filesystem::space_info si = std::filesystem::space(".");
@@ -48,8 +48,19 @@ template <class IntType>void DistanceMatrixHdfOutputter<IntType>::store(Distance
     try {
         H5::H5File file = H5::H5File(path + ".hdf5", H5F_ACC_TRUNC);
 
-        auto dataspace = H5::DataSpace(2, dimsf, nullptr);
+        // The upper triangle of a symmetric matrix is stored as a one-dimensional dataset with the number of nodes in
+        // the 'nodes' attribute.
+        const bool upperTriangular = dm.getLayout() == DistanceMatrixLayout::UPPER_TRIANGULAR;
+        hsize_t dimsf[] = { nodesCnt, nodesCnt };
+        if (upperTriangular) {
+            dimsf[0] = entries;
+        }
+        auto dataspace = H5::DataSpace(upperTriangular ? 1 : 2, dimsf, nullptr);
         H5::DataSet dataset(file.createDataSet("dm", datatype, dataspace));
+        if (upperTriangular) {
+            H5::Attribute attribute = dataset.createAttribute("nodes", H5::PredType::STD_U32LE, H5::DataSpace(H5S_SCALAR));
+            attribute.write(H5::PredType::NATIVE_UINT, &nodesCnt);
+        }
         if constexpr (std::is_same<IntType, uint_least16_t>::value) {
             dataset.write(values, H5::PredType::NATIVE_UINT_LEAST16);
         } else if constexpr (std::is_same<IntType, uint_least32_t>::value) {
@@ -65,3 +76,63 @@ template <class IntType>void DistanceMatrixHdfOutputter<IntType>::store(Distance
         printf("Couldn't open file '%s'!", (path + ".hdf5").c_str());
     }
 }
+
+//______________________________________________________________________________________________________________________
+template <class IntType> void DistanceMatrixHdfOutputter<IntType>::storeRows(
+        Distance_matrix_travel_time_provider<IntType>& dm,
+        const std::string& path,
+        const std::vector<unsigned int>& rows) {
+    if (dm.getLayout() != DistanceMatrixLayout::FULL) {
+        throw std::runtime_error("Only the rows of a full distance matrix can be stored in place.");
+    }
+    const auto nodesCnt = dm.nodes();
+    IntType* values = dm.getRawData().get();
+
+    H5::H5File file = H5::H5File(path, H5F_ACC_RDWR);
+    H5::DataSet dataset = file.openDataSet("dm");
+    H5::DataSpace fileSpace = dataset.getSpace();
+
+    hsize_t dims[2];
+    fileSpace.getSimpleExtentDims(dims, nullptr);
+    if (dims[0] != nodesCnt || dims[1] != nodesCnt) {
+        throw std::runtime_error("The distance matrix in '" + path + "' has " + std::to_string(dims[0]) + " rows, "
+                                 + "but the updated matrix has " + std::to_string(nodesCnt) + ".");
+    }
+
+    // 'store' chooses the smallest type that can hold all the distances, the new ones have to fit as well.
+    const size_t storedSize = dataset.getIntType().getSize();
+    const unsigned long long storedMax = storedSize >= 8 ? UINT64_MAX : (1ULL << (8 * storedSize)) - 1;
+    for (unsigned int row : rows) {
+        for (size_t i = 0; i < nodesCnt; i++) {
+            if (static_cast<unsigned long long>(values[static_cast<size_t>(row) * nodesCnt + i]) >= storedMax) {
+                throw std::runtime_error("The updated distances do not fit into the integer type stored in '" + path
+                                         + "', the whole distance matrix has to be stored again.");
+            }
+        }
+    }
+
+    // Consecutive rows are written by a single call.
+    for (size_t first = 0; first < rows.size();) {
+        size_t last = first;
+        while (last + 1 < rows.size() && rows[last + 1] == rows[last] + 1) {
+            last++;
+        }
+
+        hsize_t offset[] = { rows[first], 0 };
+        hsize_t count[] = { last - first + 1, nodesCnt };
+        fileSpace.selectHyperslab(H5S_SELECT_SET, count, offset);
+        H5::DataSpace memorySpace(2, count, nullptr);
+        const IntType* block = values + static_cast<size_t>(rows[first]) * nodesCnt;
+        if constexpr (std::is_same<IntType, uint_least16_t>::value) {
+            dataset.write(block, H5::PredType::NATIVE_UINT_LEAST16, memorySpace, fileSpace);
+        } else if constexpr (std::is_same<IntType, uint_least32_t>::value) {
+            dataset.write(block, H5::PredType::NATIVE_UINT_LEAST32, memorySpace, fileSpace);
+        } else {
+            dataset.write(block, H5::PredType::NATIVE_UINT, memorySpace, fileSpace);
+        }
+        first = last + 1;
+    }
+
+    dataset.close();
+    file.close();
+}
@@ -30,6 +30,8 @@
 #ifndef DISTANCEMATRIXINTERFACE_H
 #define DISTANCEMATRIXINTERFACE_H
 
+#include <utility>
+#include <vector>
 #include "../constants.h"
 
 
@@ -55,6 +57,21 @@ public:
          * @param distance[in] The value (distance) we wnat to put into the table.
          */
     virtual void setDistance(unsigned int source, unsigned int target, dist_t distance) = 0;
+
+    /**
+         * Answers a batch of queries. The default implementation simply calls findDistance for each query,
+         * implementations that benefit from knowing the queries in advance (for example the paged distance matrix)
+         * override this.
+         *
+         * @param queries[in] The (start, goal) pairs of the queries.
+         * @param distances[out] The vector that will be filled with the distances in the order of the queries.
+         */
+    virtual void findDistances(const std::vector<std::pair<unsigned int, unsigned int>>& queries, std::vector<dist_t>& distances) const {
+        distances.resize(queries.size());
+        for (size_t i = 0; i < queries.size(); i++) {
+            distances[i] = findDistance(queries[i].first, queries[i].second);
+        }
+    }
 };
 
 
@@ -0,0 +1,69 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Czech Technical University in Prague
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. */
+
+/******************************************************************************
+ * File:             DistanceMatrixLayout.h
+ *
+ * Description:      The layouts of the distances of a full distance matrix
+ *****************************************************************************/
+
+#ifndef SHORTEST_PATHS_DISTANCEMATRIXLAYOUT_H
+#define SHORTEST_PATHS_DISTANCEMATRIXLAYOUT_H
+
+#include <cstddef>
+#include <utility>
+
+/**
+ * The order of the distances in the memory and in the XDM and HDF5 files.
+ */
+enum class DistanceMatrixLayout {
+    FULL, // all n * n distances, row after row
+    UPPER_TRIANGULAR // the n * (n + 1) / 2 distances d(i, j) with i <= j, row after row; only for undirected graphs
+};
+
+/**
+ * @param nodes[in] The number of nodes (rows and columns) of the matrix.
+ * @return The number of distances stored in the UPPER_TRIANGULAR layout.
+ */
+inline size_t upperTriangularEntries(const unsigned int nodes) {
+    return static_cast<size_t>(nodes) * (static_cast<size_t>(nodes) + 1) / 2;
+}
+
+/**
+ * Finds the position of the distance between two nodes in the UPPER_TRIANGULAR layout, the distance is symmetric, so
+ * the order of the nodes does not matter. Row 'i' starts with d(i, i) at the position i * n - i * (i - 1) / 2.
+ *
+ * @param row[in] One of the nodes.
+ * @param column[in] The other node.
+ * @param nodes[in] The number of nodes (rows and columns) of the matrix.
+ * @return The position of the distance in the array.
+ */
+inline size_t upperTriangularIndex(unsigned int row, unsigned int column, const unsigned int nodes) {
+    if (row > column) {
+        std::swap(row, column);
+    }
+    const auto r = static_cast<size_t>(row);
+    return r * nodes - r * (r + 1) / 2 + column;
+}
+
+#endif //SHORTEST_PATHS_DISTANCEMATRIXLAYOUT_H
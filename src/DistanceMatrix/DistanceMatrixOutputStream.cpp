@@ -0,0 +1,202 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Czech Technical University in Prague
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. */
+
+/******************************************************************************
+* File:             DistanceMatrixOutputStream.cpp
+*****************************************************************************/
+
+#include <algorithm>
+#include <filesystem>
+#include <stdexcept>
+#ifdef _WIN32
+#include <fcntl.h>
+#include <io.h>
+#endif
+#include "DistanceMatrixOutputStream.h"
+
+//______________________________________________________________________________________________________________________
+DistanceMatrixOutputStream::DistanceMatrixOutputStream(const std::string& path, unsigned int maxPendingBlocks) :
+        path(path), file(nullptr), ownsFile(!isStandardOutput(path)), maxPendingBlocks(std::max(maxPendingBlocks, 1u)) {
+    if (ownsFile) {
+        file = std::fopen(path.c_str(), "wb");
+        if (file == nullptr) {
+            throw std::runtime_error("Couldn't open file '" + path + "'!");
+        }
+    } else {
+#ifdef _WIN32
+        _setmode(_fileno(stdout), _O_BINARY);
+#endif
+        std::fflush(stdout);
+        file = stdout;
+    }
+
+    writer = std::thread(&DistanceMatrixOutputStream::writerLoop, this);
+}
+
+//______________________________________________________________________________________________________________________
+DistanceMatrixOutputStream::~DistanceMatrixOutputStream() {
+    if (writer.joinable()) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            closing = true;
+        }
+        blockSubmitted.notify_all();
+        writer.join();
+    }
+    if (file != nullptr && ownsFile) {
+        std::fclose(file);
+    }
+}
+
+//______________________________________________________________________________________________________________________
+bool DistanceMatrixOutputStream::isStandardOutput(const std::string& path) {
+    return path == "-";
+}
+
+//______________________________________________________________________________________________________________________
+void DistanceMatrixOutputStream::checkFreeSpace(const std::string& path, unsigned long long bytes) {
+    if (isStandardOutput(path)) {
+        return;
+    }
+
+    std::filesystem::path directory = std::filesystem::path(path).parent_path();
+    if (directory.empty()) {
+        directory = ".";
+    }
+
+    // A missing directory is reported by the constructor when the file can't be opened.
+    std::error_code error;
+    const std::filesystem::space_info si = std::filesystem::space(directory, error);
+    if (!error && bytes > si.available) {
+        throw std::runtime_error("Not enough free disk space." + std::to_string(bytes/1024) + "KiB required");
+    }
+}
+
+//______________________________________________________________________________________________________________________
+void DistanceMatrixOutputStream::write(std::vector<char>& block) {
+    std::unique_lock<std::mutex> lock(mutex);
+    blockWritten.wait(lock, [this] { return pending.size() < maxPendingBlocks || writerError; });
+    rethrowWriterError();
+
+    pending.push_back(std::move(block));
+    if (recycled.empty()) {
+        block = std::vector<char>();
+    } else {
+        block = std::move(recycled.back());
+        recycled.pop_back();
+    }
+
+    lock.unlock();
+    blockSubmitted.notify_one();
+}
+
+//______________________________________________________________________________________________________________________
+void DistanceMatrixOutputStream::write(const void* data, size_t size) {
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        waitUntilWritten(lock);
+        rethrowWriterError();
+    }
+    writeChunks(static_cast<const char*>(data), size);
+}
+
+//______________________________________________________________________________________________________________________
+void DistanceMatrixOutputStream::close() {
+    if (!writer.joinable()) {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        closing = true;
+    }
+    blockSubmitted.notify_all();
+    writer.join();
+
+    const bool flushed = ownsFile ? std::fclose(file) == 0 : std::fflush(file) == 0;
+    file = nullptr;
+    rethrowWriterError();
+    if (!flushed) {
+        throw std::runtime_error("Couldn't write to '" + path + "'!");
+    }
+}
+
+//______________________________________________________________________________________________________________________
+void DistanceMatrixOutputStream::writerLoop() {
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+        blockSubmitted.wait(lock, [this] { return !pending.empty() || closing; });
+        if (pending.empty()) {
+            return;
+        }
+
+        std::vector<char> block = std::move(pending.front());
+        pending.pop_front();
+        const bool failed = writerError != nullptr;
+        writing = true;
+        lock.unlock();
+
+        // After a failure, the remaining blocks are only discarded so that the producer is never blocked forever.
+        std::exception_ptr error;
+        if (!failed) {
+            try {
+                writeChunks(block.data(), block.size());
+            } catch (...) {
+                error = std::current_exception();
+            }
+        }
+
+        lock.lock();
+        writing = false;
+        if (error) {
+            writerError = error;
+        }
+        block.clear();
+        recycled.push_back(std::move(block));
+        blockWritten.notify_all();
+    }
+}
+
+//______________________________________________________________________________________________________________________
+void DistanceMatrixOutputStream::writeChunks(const char* data, size_t size) {
+    while (size > 0) {
+        const size_t chunk = std::min(size, chunkSize);
+        if (std::fwrite(data, 1, chunk, file) != chunk) {
+            throw std::runtime_error("Couldn't write to '" + path + "'!");
+        }
+        data += chunk;
+        size -= chunk;
+    }
+}
+
+//______________________________________________________________________________________________________________________
+void DistanceMatrixOutputStream::waitUntilWritten(std::unique_lock<std::mutex>& lock) {
+    blockWritten.wait(lock, [this] { return (pending.empty() && !writing) || writerError; });
+}
+
+//______________________________________________________________________________________________________________________
+void DistanceMatrixOutputStream::rethrowWriterError() {
+    if (writerError) {
+        std::rethrow_exception(writerError);
+    }
+}
@@ -0,0 +1,136 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Czech Technical University in Prague
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. */
+
+/******************************************************************************
+* File:             DistanceMatrixOutputStream.h
+*
+* Description:      Buffered block output for the distance matrix exporters
+*****************************************************************************/
+
+#ifndef SHORTEST_PATHS_DISTANCEMATRIXOUTPUTSTREAM_H
+#define SHORTEST_PATHS_DISTANCEMATRIXOUTPUTSTREAM_H
+
+#include <condition_variable>
+#include <cstdio>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * Output of the distance matrix exporters. The data are written in large blocks either into a file or to the standard
+ * output (path '-'), so the matrix can be piped directly into another program.
+ *
+ * Blocks passed to 'write(std::vector<char>&)' are written by a background thread in the order they were submitted,
+ * so the producer can prepare (format, compute) the next block while the previous one is being written. The number of
+ * blocks waiting for the writer is limited, a producer faster than the disk is blocked until a block is written.
+ */
+class DistanceMatrixOutputStream {
+public:
+    /**
+     * Opens the output.
+     *
+     * @param path[in] The path to the output file, '-' for the standard output.
+     * @param maxPendingBlocks[in] The maximum number of submitted blocks that are not written yet.
+     */
+    explicit DistanceMatrixOutputStream(const std::string& path, unsigned int maxPendingBlocks = 4);
+
+    /**
+     * Waits for the background writer and closes the output. Errors are ignored here, call 'close()' to detect them.
+     */
+    ~DistanceMatrixOutputStream();
+
+    DistanceMatrixOutputStream(const DistanceMatrixOutputStream&) = delete;
+
+    DistanceMatrixOutputStream& operator=(const DistanceMatrixOutputStream&) = delete;
+
+    /**
+     * Returns true if the path denotes the standard output instead of a file.
+     *
+     * @param path[in] The output path.
+     * @return True for the path '-'.
+     */
+    static bool isStandardOutput(const std::string& path);
+
+    /**
+     * Throws if the file system the output file will be created in doesn't have the required free space. Nothing is
+     * checked for the standard output.
+     *
+     * @param path[in] The path to the output file, '-' for the standard output.
+     * @param bytes[in] The number of bytes that will be written.
+     */
+    static void checkFreeSpace(const std::string& path, unsigned long long bytes);
+
+    /**
+     * Hands the block over to the background writer. The content of the block is swapped with an empty buffer
+     * recycled from a previously written block, so the capacity can be reused by the producer without new allocations.
+     *
+     * @param block[in, out] The data to write, an empty buffer on return.
+     */
+    void write(std::vector<char>& block);
+
+    /**
+     * Writes the data directly from the caller's memory in large chunks, after all the blocks submitted before are
+     * written. The memory is not copied, so this is the fastest way to write data that are already in the output
+     * layout.
+     *
+     * @param data[in] The data to write.
+     * @param size[in] The number of bytes to write.
+     */
+    void write(const void* data, size_t size);
+
+    /**
+     * Writes all the pending blocks, flushes and closes the output. Throws if any of the writes failed.
+     */
+    void close();
+
+private:
+    static constexpr size_t chunkSize = 8 * 1024 * 1024;
+
+    void writerLoop();
+
+    void writeChunks(const char* data, size_t size);
+
+    void waitUntilWritten(std::unique_lock<std::mutex>& lock);
+
+    void rethrowWriterError();
+
+    std::string path;
+    std::FILE* file;
+    bool ownsFile;
+    unsigned int maxPendingBlocks;
+
+    std::mutex mutex;
+    std::condition_variable blockSubmitted;
+    std::condition_variable blockWritten;
+    std::deque<std::vector<char>> pending;
+    std::vector<std::vector<char>> recycled;
+    bool writing = false;
+    bool closing = false;
+    std::exception_ptr writerError;
+    std::thread writer;
+};
+
+#endif //SHORTEST_PATHS_DISTANCEMATRIXOUTPUTSTREAM_H
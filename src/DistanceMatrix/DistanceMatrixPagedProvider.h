@@ -0,0 +1,173 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Czech Technical University in Prague
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. */
+
+/******************************************************************************
+* File:             DistanceMatrixPagedProvider.h
+*
+* Description:      Distance matrix kept on disk with an LRU cache of row blocks
+*****************************************************************************/
+
+#ifndef SHORTEST_PATHS_DISTANCEMATRIXPAGEDPROVIDER_H
+#define SHORTEST_PATHS_DISTANCEMATRIXPAGEDPROVIDER_H
+
+#include <list>
+#include <memory>
+#include <vector>
+
+#include "DistanceMatrixInterface.h"
+#include "DistanceMatrixRowSource.h"
+
+/**
+ * Non-template part of the paged distance matrix, so that the users (the loader, the benchmark) do not have to care
+ * about the integer type the matrix is stored with.
+ */
+class DistanceMatrixPagedInterface : public DistanceMatrixInterface {
+public:
+    /**
+     * Makes sure the blocks containing the given rows are loaded in the cache. Useful when the caller knows which
+     * rows will be queried next. If more blocks are requested than the cache can hold, only the last ones stay.
+     *
+     * @param firstRow[in] The first row to prefetch.
+     * @param rowsCnt[in] The number of rows to prefetch.
+     */
+    virtual void prefetchRows(unsigned int firstRow, unsigned int rowsCnt) const = 0;
+
+    /**
+     * @return The number of lookups answered from an already loaded block.
+     */
+    [[nodiscard]] virtual unsigned long long cacheHits() const = 0;
+
+    /**
+     * @return The number of lookups that required loading a block from the disk.
+     */
+    [[nodiscard]] virtual unsigned long long cacheMisses() const = 0;
+
+    /**
+     * Resets the hit and miss counters. The cache content is kept.
+     */
+    virtual void resetCacheStatistics() const = 0;
+
+    /**
+     * @return The number of nodes (rows and columns) of the matrix.
+     */
+    [[nodiscard]] virtual unsigned int nodes() const = 0;
+
+    /**
+     * @return The maximum number of bytes the cached blocks can occupy.
+     */
+    [[nodiscard]] virtual size_t cacheCapacityBytes() const = 0;
+};
+
+/**
+ * Distance matrix that is not loaded in memory at once. The rows are read from a DistanceMatrixRowSource in blocks of
+ * 'rowsPerBlock' consecutive rows and at most 'cachedBlocks' blocks are kept in memory, the least recently used block
+ * is evicted when a new block has to be loaded. This bounds the memory consumption to
+ * rowsPerBlock * cachedBlocks * nodes * sizeof(IntType) bytes regardless of the size of the matrix, at the cost of
+ * slower queries whenever the queried row is not cached.
+ *
+ * The matrix is read-only, but the lookups are not thread safe: every lookup (even one answered from the cache) moves
+ * its block to the front of the LRU list and updates the hit and miss counters, so the const methods still modify the
+ * provider. Each thread needs its own provider, or the calls have to be serialized by the caller.
+ */
+template <class IntType>
+class DistanceMatrixPagedProvider : public DistanceMatrixPagedInterface {
+public:
+    /**
+     * @param source[in] The source the rows will be loaded from.
+     * @param rowsPerBlock[in] The number of consecutive rows loaded at once.
+     * @param cachedBlocks[in] The maximum number of blocks kept in memory.
+     */
+    DistanceMatrixPagedProvider(
+        std::unique_ptr<DistanceMatrixRowSource<IntType>> source,
+        unsigned int rowsPerBlock,
+        unsigned int cachedBlocks
+    );
+
+    /**
+     * Returns the distance from the block containing the 'start' row, loading the block if necessary.
+     *
+     * @param start[in] The start node for the query.
+     * @param goal[in] The goal node for the query.
+     * @return Returns the shortest distance from start to goal or 'std::numeric_limits<dist_t>::max()' if goal is not reachable from start.
+     */
+    [[nodiscard]] dist_t findDistance(unsigned int start, unsigned int goal) const override;
+
+    /**
+     * The paged matrix is read-only, always throws std::runtime_error.
+     */
+    void setDistance(unsigned int source, unsigned int target, dist_t distance) override;
+
+    /**
+     * Answers the queries grouped by the block of their start node, so that each needed block is loaded at most once
+     * per batch. The distances are returned in the order of the queries.
+     *
+     * @param queries[in] The (start, goal) pairs of the queries.
+     * @param distances[out] The vector that will be filled with the distances in the order of the queries.
+     */
+    void findDistances(const std::vector<std::pair<unsigned int, unsigned int>>& queries, std::vector<dist_t>& distances) const override;
+
+    void prefetchRows(unsigned int firstRow, unsigned int rowsCnt) const override;
+
+    [[nodiscard]] unsigned long long cacheHits() const override;
+
+    [[nodiscard]] unsigned long long cacheMisses() const override;
+
+    void resetCacheStatistics() const override;
+
+    [[nodiscard]] unsigned int nodes() const override;
+
+    [[nodiscard]] size_t cacheCapacityBytes() const override;
+
+private:
+    struct CachedBlock {
+        unsigned int block;
+        std::unique_ptr<IntType[]> data;
+    };
+
+    using CacheList = std::list<CachedBlock>;
+
+    /**
+     * Returns the data of the given block, loading it (and evicting the least recently used block) if necessary.
+     *
+     * @param block[in] The index of the block.
+     * @return Pointer to the first value of the first row of the block.
+     */
+    const IntType* getBlock(unsigned int block) const;
+
+    std::unique_ptr<DistanceMatrixRowSource<IntType>> source;
+    const unsigned int nodesCnt;
+    const unsigned int rowsPerBlock;
+    const unsigned int cachedBlocks;
+
+    // Most recently used block at the front.
+    mutable CacheList cache;
+    mutable std::vector<typename CacheList::iterator> blockLookup;
+    mutable unsigned int lastBlock;
+    mutable const IntType* lastBlockData;
+    mutable unsigned long long hits;
+    mutable unsigned long long misses;
+};
+
+#include "DistanceMatrixPagedProvider.tpp"
+
+#endif //SHORTEST_PATHS_DISTANCEMATRIXPAGEDPROVIDER_H
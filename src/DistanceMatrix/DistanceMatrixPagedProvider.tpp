@@ -0,0 +1,132 @@
+/******************************************************************************
+* File:             DistanceMatrixPagedProvider.tpp
+*****************************************************************************/
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+
+//______________________________________________________________________________________________________________________
+template<class IntType> DistanceMatrixPagedProvider<IntType>::DistanceMatrixPagedProvider(
+        std::unique_ptr<DistanceMatrixRowSource<IntType>> source,
+        const unsigned int rowsPerBlock,
+        const unsigned int cachedBlocks
+):
+    source(std::move(source)),
+    nodesCnt(this->source->nodes()),
+    rowsPerBlock(rowsPerBlock),
+    cachedBlocks(cachedBlocks),
+    lastBlock(std::numeric_limits<unsigned int>::max()),
+    lastBlockData(nullptr),
+    hits(0),
+    misses(0) {
+    if (rowsPerBlock == 0 || cachedBlocks == 0) {
+        throw std::invalid_argument("The paged distance matrix needs at least one row per block and one cached block.");
+    }
+    blockLookup.resize((static_cast<size_t>(nodesCnt) + rowsPerBlock - 1) / rowsPerBlock, cache.end());
+}
+
+//______________________________________________________________________________________________________________________
+template<class IntType> const IntType* DistanceMatrixPagedProvider<IntType>::getBlock(const unsigned int block) const {
+    if (block == lastBlock) {
+        hits++;
+        return lastBlockData;
+    }
+
+    auto it = blockLookup[block];
+    if (it != cache.end()) {
+        hits++;
+        cache.splice(cache.begin(), cache, it);
+    } else {
+        misses++;
+        std::unique_ptr<IntType[]> data;
+        if (cache.size() >= cachedBlocks) {
+            // Reuse the buffer of the evicted block.
+            auto& evicted = cache.back();
+            blockLookup[evicted.block] = cache.end();
+            data = std::move(evicted.data);
+            cache.pop_back();
+        } else {
+            data = std::make_unique<IntType[]>(static_cast<size_t>(rowsPerBlock) * nodesCnt);
+        }
+
+        const unsigned int firstRow = block * rowsPerBlock;
+        source->readRows(firstRow, std::min(rowsPerBlock, nodesCnt - firstRow), data.get());
+        cache.push_front(CachedBlock{block, std::move(data)});
+        blockLookup[block] = cache.begin();
+    }
+
+    lastBlock = block;
+    lastBlockData = cache.front().data.get();
+    return lastBlockData;
+}
+
+//______________________________________________________________________________________________________________________
+template<class IntType> dist_t DistanceMatrixPagedProvider<IntType>::findDistance(const unsigned int start, const unsigned int goal) const {
+    if (start >= nodesCnt || goal >= nodesCnt) {
+        throw std::out_of_range("Requested distance is out of bounds of the distance matrix.");
+    }
+    const IntType* data = getBlock(start / rowsPerBlock);
+    return data[static_cast<size_t>(start % rowsPerBlock) * nodesCnt + goal];
+}
+
+//______________________________________________________________________________________________________________________
+template<class IntType> void DistanceMatrixPagedProvider<IntType>::setDistance(unsigned int, unsigned int, dist_t) {
+    throw std::runtime_error("The paged distance matrix is read-only.");
+}
+
+//______________________________________________________________________________________________________________________
+template<class IntType> void DistanceMatrixPagedProvider<IntType>::findDistances(
+        const std::vector<std::pair<unsigned int, unsigned int>>& queries,
+        std::vector<dist_t>& distances
+) const {
+    distances.resize(queries.size());
+
+    std::vector<size_t> order(queries.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+        return queries[a].first / rowsPerBlock < queries[b].first / rowsPerBlock;
+    });
+
+    for (const size_t i : order) {
+        distances[i] = findDistance(queries[i].first, queries[i].second);
+    }
+}
+
+//______________________________________________________________________________________________________________________
+template<class IntType> void DistanceMatrixPagedProvider<IntType>::prefetchRows(const unsigned int firstRow, const unsigned int rowsCnt) const {
+    if (rowsCnt == 0 || firstRow >= nodesCnt) {
+        return;
+    }
+    const unsigned int lastRow = std::min(nodesCnt - 1, firstRow + rowsCnt - 1);
+    for (unsigned int block = firstRow / rowsPerBlock; block <= lastRow / rowsPerBlock; block++) {
+        getBlock(block);
+    }
+}
+
+//______________________________________________________________________________________________________________________
+template<class IntType> unsigned long long DistanceMatrixPagedProvider<IntType>::cacheHits() const {
+    return hits;
+}
+
+//______________________________________________________________________________________________________________________
+template<class IntType> unsigned long long DistanceMatrixPagedProvider<IntType>::cacheMisses() const {
+    return misses;
+}
+
+//______________________________________________________________________________________________________________________
+template<class IntType> void DistanceMatrixPagedProvider<IntType>::resetCacheStatistics() const {
+    hits = 0;
+    misses = 0;
+}
+
+//______________________________________________________________________________________________________________________
+template<class IntType> unsigned int DistanceMatrixPagedProvider<IntType>::nodes() const {
+    return nodesCnt;
+}
+
+//______________________________________________________________________________________________________________________
+template<class IntType> size_t DistanceMatrixPagedProvider<IntType>::cacheCapacityBytes() const {
+    return static_cast<size_t>(cachedBlocks) * rowsPerBlock * nodesCnt * sizeof(IntType);
+}
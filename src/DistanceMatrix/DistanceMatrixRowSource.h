@@ -0,0 +1,116 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Czech Technical University in Prague
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. */
+
+/******************************************************************************
+* File:             DistanceMatrixRowSource.h
+*
+* Description:      Sources of distance matrix rows stored on disk
+*****************************************************************************/
+
+#ifndef SHORTEST_PATHS_DISTANCEMATRIXROWSOURCE_H
+#define SHORTEST_PATHS_DISTANCEMATRIXROWSOURCE_H
+
+#include <fstream>
+#include <string>
+#include <H5Cpp.h>
+
+/**
+ * A source of distance matrix rows that are not kept in memory. Used by the DistanceMatrixPagedProvider to load
+ * blocks of consecutive rows on demand, so that matrices bigger than the available memory can be queried.
+ */
+template <class IntType>
+class DistanceMatrixRowSource {
+public:
+    virtual ~DistanceMatrixRowSource() = default;
+
+    /**
+     * Returns the number of nodes (rows and columns) of the square matrix stored in the source.
+     *
+     * @return The number of nodes.
+     */
+    [[nodiscard]] virtual unsigned int nodes() const = 0;
+
+    /**
+     * Reads 'rowsCnt' consecutive rows starting with 'firstRow' into the buffer. The buffer must be able to hold
+     * rowsCnt * nodes() values.
+     *
+     * @param firstRow[in] The first row to read.
+     * @param rowsCnt[in] The number of rows to read.
+     * @param buffer[out] The buffer the rows will be stored into (row-major).
+     */
+    virtual void readRows(unsigned int firstRow, unsigned int rowsCnt, IntType* buffer) = 0;
+};
+
+/**
+ * Reads the rows from a distance matrix stored in the XDM format (see 'DistanceMatrixXdmOutputter.h'). The rows are
+ * read directly from the file at the row offset, the rest of the file is never touched.
+ */
+template <class IntType>
+class DistanceMatrixXdmRowSource : public DistanceMatrixRowSource<IntType> {
+public:
+    /**
+     * Opens the file and parses the header.
+     *
+     * @param inputFile[in] The path to the XDM file.
+     */
+    explicit DistanceMatrixXdmRowSource(const std::string& inputFile);
+
+    [[nodiscard]] unsigned int nodes() const override;
+
+    void readRows(unsigned int firstRow, unsigned int rowsCnt, IntType* buffer) override;
+
+private:
+    static constexpr std::streamoff headerSize = 3 + sizeof(unsigned int);
+
+    std::ifstream input;
+    unsigned int nodesCnt;
+};
+
+/**
+ * Reads the rows from the 'dm' dataset of a HDF5 file (see 'DistanceMatrixHdfOutputter.h') using hyperslab selection,
+ * so only the requested rows are read from the dataset.
+ */
+template <class IntType>
+class DistanceMatrixHdfRowSource : public DistanceMatrixRowSource<IntType> {
+public:
+    /**
+     * Opens the file and the 'dm' dataset.
+     *
+     * @param inputFile[in] The path to the HDF5 file.
+     */
+    explicit DistanceMatrixHdfRowSource(const std::string& inputFile);
+
+    [[nodiscard]] unsigned int nodes() const override;
+
+    void readRows(unsigned int firstRow, unsigned int rowsCnt, IntType* buffer) override;
+
+private:
+    H5::H5File file;
+    H5::DataSet dataset;
+    H5::DataSpace fileSpace;
+    unsigned int nodesCnt;
+};
+
+#include "DistanceMatrixRowSource.tpp"
+
+#endif //SHORTEST_PATHS_DISTANCEMATRIXROWSOURCE_H
@@ -0,0 +1,89 @@
+/******************************************************************************
+* File:             DistanceMatrixRowSource.tpp
+*****************************************************************************/
+
+#include <stdexcept>
+#include <type_traits>
+#include <boost/numeric/conversion/cast.hpp>
+
+//______________________________________________________________________________________________________________________
+template<class IntType> DistanceMatrixXdmRowSource<IntType>::DistanceMatrixXdmRowSource(const std::string& inputFile):
+    input(inputFile, std::ios::binary),
+    nodesCnt(0) {
+    if (!input.is_open()) {
+        throw std::runtime_error("Couldn't open file '" + inputFile + "'!");
+    }
+
+    char header[3];
+    input.read(header, sizeof(header));
+    if (header[0] == 'X' && header[1] == 'D' && header[2] == 'S') {
+        throw std::runtime_error("The file '" + inputFile + "' contains only the upper triangle of a symmetric distance "
+                                 + "matrix, which cannot be loaded by rows, preprocess it without --symmetric.");
+    }
+    if (header[0] != 'X' || header[1] != 'D' || header[2] != 'M') {
+        throw std::runtime_error("The file '" + inputFile + "' is missing the Distance Matrix header.");
+    }
+    input.read(reinterpret_cast<char*>(&nodesCnt), sizeof(nodesCnt));
+}
+
+//______________________________________________________________________________________________________________________
+template<class IntType> unsigned int DistanceMatrixXdmRowSource<IntType>::nodes() const {
+    return nodesCnt;
+}
+
+//______________________________________________________________________________________________________________________
+template<class IntType> void DistanceMatrixXdmRowSource<IntType>::readRows(
+        const unsigned int firstRow,
+        const unsigned int rowsCnt,
+        IntType* buffer
+) {
+    const auto rowBytes = static_cast<std::streamoff>(nodesCnt) * static_cast<std::streamoff>(sizeof(IntType));
+    input.seekg(headerSize + static_cast<std::streamoff>(firstRow) * rowBytes);
+    input.read(reinterpret_cast<char*>(buffer), static_cast<std::streamsize>(rowsCnt) * rowBytes);
+    if (!input) {
+        throw std::runtime_error("Failed to read rows " + std::to_string(firstRow) + " to "
+                                 + std::to_string(firstRow + rowsCnt - 1) + " of the distance matrix.");
+    }
+}
+
+//______________________________________________________________________________________________________________________
+template<class IntType> DistanceMatrixHdfRowSource<IntType>::DistanceMatrixHdfRowSource(const std::string& inputFile):
+    file(inputFile, H5F_ACC_RDONLY),
+    dataset(file.openDataSet("dm")),
+    fileSpace(dataset.getSpace()) {
+    if (fileSpace.getSimpleExtentNdims() != 2) {
+        throw std::runtime_error("The file '" + inputFile + "' contains only the upper triangle of a symmetric distance "
+                                 + "matrix, which cannot be loaded by rows, preprocess it without --symmetric.");
+    }
+    hsize_t dims[2];
+    fileSpace.getSimpleExtentDims(dims, nullptr);
+    if (dims[0] != dims[1]) {
+        throw std::runtime_error("The distance matrix in '" + inputFile + "' is not square.");
+    }
+    nodesCnt = boost::numeric_cast<unsigned int>(dims[0]);
+}
+
+//______________________________________________________________________________________________________________________
+template<class IntType> unsigned int DistanceMatrixHdfRowSource<IntType>::nodes() const {
+    return nodesCnt;
+}
+
+//______________________________________________________________________________________________________________________
+template<class IntType> void DistanceMatrixHdfRowSource<IntType>::readRows(
+        const unsigned int firstRow,
+        const unsigned int rowsCnt,
+        IntType* buffer
+) {
+    const hsize_t offset[2] = {firstRow, 0};
+    const hsize_t count[2] = {rowsCnt, nodesCnt};
+    fileSpace.selectHyperslab(H5S_SELECT_SET, count, offset);
+    H5::DataSpace memorySpace(2, count);
+
+    if constexpr (std::is_same<IntType, uint_least16_t>::value) {
+        dataset.read(buffer, H5::PredType::NATIVE_UINT_LEAST16, memorySpace, fileSpace);
+    } else if constexpr (std::is_same<IntType, uint_least32_t>::value) {
+        dataset.read(buffer, H5::PredType::NATIVE_UINT_LEAST32, memorySpace, fileSpace);
+    } else {
+        dataset.read(buffer, H5::PredType::NATIVE_UINT, memorySpace, fileSpace);
+    }
+}
@@ -0,0 +1,110 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Czech Technical University in Prague
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. */
+
+/******************************************************************************
+* File:             DistanceMatrixUpdater.h
+*
+* Description:      Incremental refresh of a distance matrix after edge weight changes
+*****************************************************************************/
+
+#ifndef SHORTEST_PATHS_DISTANCEMATRIXUPDATER_H
+#define SHORTEST_PATHS_DISTANCEMATRIXUPDATER_H
+
+#include <vector>
+#include "Distance_matrix_travel_time_provider.h"
+#include "../GraphBuilding/Structures/Graph.h"
+
+/**
+ * A change of the weight of one directed edge. An edge that was added has the old weight UINT_MAX, an edge that was
+ * removed (for example a closed road) has the new weight UINT_MAX.
+ */
+struct EdgeWeightChange {
+    unsigned int from;
+    unsigned int to;
+    dist_t oldWeight;
+    dist_t newWeight;
+};
+
+/**
+ * Updates a distance matrix after a few edge weights changed without recomputing all the rows. The row of a source
+ * 's' can only change if some changed edge (u, v) either became shorter and now improves the old distance
+ * (D[s][u] + newWeight < D[s][v]), or became longer and was tight in the old matrix (D[s][u] + oldWeight == D[s][v]),
+ * which means it could be a part of a shortest path from 's'. If neither holds for any of the changes, the old row is
+ * still a valid potential for the new weights and some shortest path tree of 's' avoids all the longer edges, so
+ * the row stays the same. This holds even if several edges change at once. The test only needs the old matrix,
+ * and the rows that fail it are recomputed by Dijkstra's algorithm on the new graph in parallel.
+ */
+template <class IntType>
+class DistanceMatrixUpdater {
+public:
+    /**
+     * Finds the edges that differ between two versions of a graph with the same nodes. If a graph contains more edges
+     * between the same pair of nodes, only the shortest one is considered.
+     *
+     * @param previous[in] The graph the distance matrix was computed for.
+     * @param current[in] The graph with the new weights.
+     * @return The changed, added and removed edges.
+     */
+    static std::vector<EdgeWeightChange> changedEdges(const Graph& previous, const Graph& current);
+
+    /**
+     * Finds the rows of the matrix that can be changed by the given edge weight changes, see the class description.
+     *
+     * @param dm[in] The distance matrix computed for the weights before the changes.
+     * @param changes[in] The edge weight changes.
+     * @return The affected rows in increasing order.
+     */
+    static std::vector<unsigned int> affectedRows(
+            const Distance_matrix_travel_time_provider<IntType>& dm,
+            const std::vector<EdgeWeightChange>& changes);
+
+    /**
+     * Recomputes the given rows of the matrix in place using the new graph. The rows are computed in parallel.
+     *
+     * @param dm[in, out] The distance matrix.
+     * @param graph[in] The graph with the new weights.
+     * @param rows[in] The rows to recompute.
+     * @return The number of the recomputed rows in which at least one distance changed.
+     */
+    static unsigned int recomputeRows(
+            Distance_matrix_travel_time_provider<IntType>& dm,
+            const Graph& graph,
+            const std::vector<unsigned int>& rows);
+
+    /**
+     * Finds the affected rows and recomputes them.
+     *
+     * @param dm[in, out] The distance matrix computed for the weights before the changes.
+     * @param graph[in] The graph with the new weights.
+     * @param changes[in] The edge weight changes.
+     * @return The recomputed rows in increasing order.
+     */
+    static std::vector<unsigned int> update(
+            Distance_matrix_travel_time_provider<IntType>& dm,
+            const Graph& graph,
+            const std::vector<EdgeWeightChange>& changes);
+};
+
+#include "DistanceMatrixUpdater.tpp"
+
+#endif //SHORTEST_PATHS_DISTANCEMATRIXUPDATER_H
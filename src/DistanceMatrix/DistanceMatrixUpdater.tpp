@@ -0,0 +1,158 @@
+/******************************************************************************
+* File:             DistanceMatrixUpdater.tpp
+*****************************************************************************/
+
+#include <algorithm>
+#include <climits>
+#include <exception>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+#include <boost/numeric/conversion/cast.hpp>
+#include "../Dijkstra/BasicDijkstra.h"
+
+//______________________________________________________________________________________________________________________
+template<class IntType> std::vector<EdgeWeightChange> DistanceMatrixUpdater<IntType>::changedEdges(
+        const Graph& previous,
+        const Graph& current) {
+    if (previous.nodes() != current.nodes()) {
+        throw std::invalid_argument("The graphs have a different number of nodes (" + std::to_string(previous.nodes())
+                                    + " and " + std::to_string(current.nodes()) + ").");
+    }
+
+    // Sorts the edges by the target and keeps the shortest edge for each target.
+    auto shortestEdges = [](const std::vector<std::pair<unsigned int, dist_t>>& edges) {
+        std::vector<std::pair<unsigned int, dist_t>> sorted(edges);
+        std::sort(sorted.begin(), sorted.end());
+        sorted.erase(std::unique(sorted.begin(), sorted.end(), [](const auto& a, const auto& b) {
+            return a.first == b.first;
+        }), sorted.end());
+        return sorted;
+    };
+
+    std::vector<EdgeWeightChange> changes;
+    for (unsigned int from = 0; from < current.nodes(); from++) {
+        const auto before = shortestEdges(previous.outgoingEdges(from));
+        const auto after = shortestEdges(current.outgoingEdges(from));
+
+        size_t i = 0;
+        size_t j = 0;
+        while (i < before.size() || j < after.size()) {
+            if (j == after.size() || (i < before.size() && before[i].first < after[j].first)) {
+                changes.push_back({from, before[i].first, before[i].second, UINT_MAX});
+                i++;
+            } else if (i == before.size() || after[j].first < before[i].first) {
+                changes.push_back({from, after[j].first, UINT_MAX, after[j].second});
+                j++;
+            } else {
+                if (before[i].second != after[j].second) {
+                    changes.push_back({from, before[i].first, before[i].second, after[j].second});
+                }
+                i++;
+                j++;
+            }
+        }
+    }
+    return changes;
+}
+
+//______________________________________________________________________________________________________________________
+template<class IntType> std::vector<unsigned int> DistanceMatrixUpdater<IntType>::affectedRows(
+        const Distance_matrix_travel_time_provider<IntType>& dm,
+        const std::vector<EdgeWeightChange>& changes) {
+    const unsigned int nodes = dm.nodes();
+    const IntType* values = dm.getRawData();
+    const unsigned long long infinity = std::numeric_limits<IntType>::max();
+
+    for (const auto& change : changes) {
+        if (change.from >= nodes || change.to >= nodes) {
+            throw std::out_of_range("The changed edge (" + std::to_string(change.from) + ", "
+                                    + std::to_string(change.to) + ") is outside of the distance matrix.");
+        }
+    }
+
+    std::vector<unsigned char> affected(nodes, 0);
+    #pragma omp parallel for schedule(static)
+    for (long long row = 0; row < static_cast<long long>(nodes); row++) {
+        const IntType* distances = values + static_cast<size_t>(row) * nodes;
+        for (const auto& change : changes) {
+            const unsigned long long toFrom = distances[change.from];
+            if (toFrom == infinity) {
+                continue;
+            }
+            const unsigned long long toTo = distances[change.to];
+            const bool improves = change.newWeight != UINT_MAX && toFrom + change.newWeight < toTo;
+            const bool wasTight = change.oldWeight != UINT_MAX && change.newWeight > change.oldWeight
+                                  && toFrom + change.oldWeight == toTo;
+            if (improves || wasTight) {
+                affected[static_cast<size_t>(row)] = 1;
+                break;
+            }
+        }
+    }
+
+    std::vector<unsigned int> rows;
+    for (unsigned int row = 0; row < nodes; row++) {
+        if (affected[row]) {
+            rows.push_back(row);
+        }
+    }
+    return rows;
+}
+
+//______________________________________________________________________________________________________________________
+template<class IntType> unsigned int DistanceMatrixUpdater<IntType>::recomputeRows(
+        Distance_matrix_travel_time_provider<IntType>& dm,
+        const Graph& graph,
+        const std::vector<unsigned int>& rows) {
+    const unsigned int nodes = dm.nodes();
+    if (graph.nodes() != nodes) {
+        throw std::invalid_argument("The graph has " + std::to_string(graph.nodes())
+                                    + " nodes, but the distance matrix has " + std::to_string(nodes) + " rows.");
+    }
+    IntType* values = dm.getRawData().get();
+
+    unsigned int changedRows = 0;
+    std::exception_ptr error;
+    #pragma omp parallel reduction(+:changedRows)
+    {
+        std::vector<unsigned int> distances(nodes);
+        #pragma omp for schedule(dynamic, 1)
+        for (long long i = 0; i < static_cast<long long>(rows.size()); i++) {
+            try {
+                BasicDijkstra::computeOneToAllDistances(rows[static_cast<size_t>(i)], graph, distances);
+
+                IntType* row = values + static_cast<size_t>(rows[static_cast<size_t>(i)]) * nodes;
+                bool changed = false;
+                for (unsigned int column = 0; column < nodes; column++) {
+                    const IntType distance = distances[column] == UINT_MAX
+                                             ? std::numeric_limits<IntType>::max()
+                                             : boost::numeric_cast<IntType>(distances[column]);
+                    changed |= row[column] != distance;
+                    row[column] = distance;
+                }
+                changedRows += changed ? 1 : 0;
+            } catch (...) {
+                #pragma omp critical
+                if (!error) {
+                    error = std::current_exception();
+                }
+            }
+        }
+    }
+
+    if (error) {
+        std::rethrow_exception(error);
+    }
+    return changedRows;
+}
+
+//______________________________________________________________________________________________________________________
+template<class IntType> std::vector<unsigned int> DistanceMatrixUpdater<IntType>::update(
+        Distance_matrix_travel_time_provider<IntType>& dm,
+        const Graph& graph,
+        const std::vector<EdgeWeightChange>& changes) {
+    std::vector<unsigned int> rows = affectedRows(dm, changes);
+    recomputeRows(dm, graph, rows);
+    return rows;
+}
@@ -35,11 +35,13 @@
 
 /**
  * Allows to store the distance matrix to disk in a simple binary format. The distance matrix will be saved into a file
- * specified by the path argument, suffix '.xdm' is added automatically.
+ * specified by the path argument, suffix '.xdm' is added automatically. The path '-' writes the matrix to the standard
+ * output instead.
  *
  * The format is as follows: first three bytes should contain the characters 'x', 'd' and 'm' respectively,
- * following is one unsigned int denoting the number of nodes 'n', and following are n*n unsigned int values
- * representing the actual distances for the matrix.
+ * following is one unsigned int denoting the number of nodes 'n', and following are n*n values of the IntType
+ * representing the actual distances for the matrix (row-major). The matrix is written in large blocks directly from
+ * memory.
  *
  */
 template <class IntType>
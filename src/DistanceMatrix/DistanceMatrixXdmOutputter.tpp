@@ -5,39 +5,26 @@
 * Created:          07/28/20 
 *****************************************************************************/
 
-#include <fstream>
-#include <filesystem>
-#include "../constants.h"
+#include <iostream>
+#include "DistanceMatrixOutputStream.h"
 
 template <class IntType> void DistanceMatrixXdmOutputter<IntType>::store(Distance_matrix_travel_time_provider<IntType>& dm, const std::string &path) {
     const unsigned int nodesCnt = dm.nodes();
-    const auto& distances = dm.getRawData();
+    const IntType* distances = dm.getRawData().get();
 
-    std::filesystem::space_info si = std::filesystem::space(".");
-    unsigned long long total_bytes = nodesCnt * nodesCnt * sizeof(dist_t);
-    if (total_bytes > si.available) {
-        throw std::runtime_error("Not enough free disk space." + std::to_string(total_bytes/1024) + "KiB required");
-    }
+    const std::string outputPath = DistanceMatrixOutputStream::isStandardOutput(path) ? path : path + ".xdm";
+    // The upper triangle of a symmetric matrix is marked by a different header.
+    const char header[] = {'X', 'D', dm.getLayout() == DistanceMatrixLayout::UPPER_TRIANGULAR ? 'S' : 'M'};
+    const unsigned long long matrixBytes = static_cast<unsigned long long>(dm.entries()) * sizeof(IntType);
+    DistanceMatrixOutputStream::checkFreeSpace(outputPath, sizeof(header) + sizeof(nodesCnt) + matrixBytes);
 
-    printf("Storing the distance matrix.\n");
-    std::ofstream output;
-    output.open(path + ".xdm", std::ios::binary);
-    if (!output.is_open()) {
-        printf("Couldn't open file '%s'!", (path + ".xdm").c_str());
-    }
-
-    char c1, c2, c3;
-    c1 = 'X';
-    c2 = 'D';
-    c3 = 'M';
-    output.write(&c1, sizeof(c1));
-    output.write(&c2, sizeof(c2));
-    output.write(&c3, sizeof(c3));
-    output.write((char *) &nodesCnt, sizeof(nodesCnt));
-
-    for (unsigned int i = 0; i < nodesCnt; ++i)
-        for (unsigned int j = 0; j < nodesCnt; ++j)
-            output.write((char *) &distances[((size_t) i) * ((size_t) nodesCnt) + ((size_t) j)], sizeof(IntType));
+    std::cout << "Storing the distance matrix." << std::endl;
+    DistanceMatrixOutputStream output(outputPath);
 
+    // The matrix (or its upper triangle) is stored row-major in one contiguous array, so it is written as is in large
+    // chunks.
+    output.write(header, sizeof(header));
+    output.write(&nodesCnt, sizeof(nodesCnt));
+    output.write(distances, static_cast<size_t>(matrixBytes));
     output.close();
 }
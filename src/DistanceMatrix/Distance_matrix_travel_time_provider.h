@@ -35,6 +35,8 @@
 
 #include "../constants.h"
 #include "DistanceMatrixInterface.h"
+#include "DistanceMatrixLayout.h"
+#include "DistanceMatrixPreprocessingMode.h"
 #include "../GraphBuilding/Loaders/GraphLoader.h"
 
 
@@ -46,6 +48,9 @@
  * complexity, which is really high (n^2). This means, that for bigger graphs, we are not able to store the Distance
  * Matrix in memory at once, making it impossible to use it. Here, the Distance Matrix is used for comparison to get an
  * idea of how much slower the other methods are in comparison with the Distance Matrix approach.
+ *
+ * The matrix of an undirected graph is symmetric, so only its upper triangle can be stored (the UPPER_TRIANGULAR
+ * layout, see 'DistanceMatrixLayout.h'), which halves the memory. Such matrices are always square.
  */
 template <class IntType>
 class Distance_matrix_travel_time_provider : public DistanceMatrixInterface {
@@ -82,6 +87,24 @@ public:
      */
     explicit Distance_matrix_travel_time_provider(std::unique_ptr<IntType[]> distMatrix, unsigned int size);
 
+    /**
+     * A constructor for an empty square matrix with the given layout.
+     *
+     * @param nodes[in] The number of nodes (rows and columns) in the square matrix.
+     * @param layout[in] The layout of the distances.
+     */
+    explicit Distance_matrix_travel_time_provider(unsigned int nodes, DistanceMatrixLayout layout);
+
+    /**
+     * Constructor that takes pre-filled distances of a square matrix in the given layout.
+     *
+     * @param distMatrix[in] The distances, 'upperTriangularEntries(nodes)' of them for the UPPER_TRIANGULAR layout.
+     * @param nodes[in] The number of nodes (rows and columns) in the square matrix.
+     * @param layout[in] The layout of the distances.
+     */
+    explicit Distance_matrix_travel_time_provider(std::unique_ptr<IntType[]> distMatrix, unsigned int nodes,
+                                                  DistanceMatrixLayout layout);
+
     /**
      * Constructor that takes a 2D std::vector of distances (e.g., from TNRAFPreprocessor)
      * and converts it to the internal 1D representation.
@@ -99,7 +122,11 @@ public:
     //     const std::vector<unsigned int>& transit_node_ids_for_columns);
 
 
-    explicit Distance_matrix_travel_time_provider(bool fast, GraphLoader& graphLoader, int scaling_factor);
+    /**
+     * Computes the distance matrix for the graph, see 'computeDistanceMatrix'.
+     */
+    explicit Distance_matrix_travel_time_provider(DistanceMatrixPreprocessingMode mode, GraphLoader& graphLoader,
+                                                  int scaling_factor, bool packSymmetric = false);
 
     /**
      * This is basically a query algorithm.
@@ -111,7 +138,8 @@ public:
     [[nodiscard]] dist_t findDistance(unsigned int start_row, unsigned int goal_col) const override;
 
     /**
-     * Auxiliary function used during initialization to set the distances.
+     * Auxiliary function used during initialization to set the distances. In the UPPER_TRIANGULAR layout, this sets
+     * the distance in both directions.
      *
      * @param source_row[in] The row of the matrix.
      * @param target_col[in] The column of the matrix.
@@ -120,11 +148,17 @@ public:
     void setDistance(unsigned int source_row, unsigned int target_col, dist_t distance) override;
 
     /**
-     * Get the underlying data structure (a 1D array)
+     * Get the underlying data structure (a 1D array), its layout is given by 'getLayout'
      * @return The underlying 1D array
      */
     const std::unique_ptr<IntType[]>& getRawData();
 
+    /**
+     * Get the underlying data structure (a 1D array) of a constant matrix
+     * @return The underlying 1D array
+     */
+    const IntType* getRawData() const;
+
     /**
      * Get rows count
      * @return rows count
@@ -144,6 +178,26 @@ public:
      */
     [[nodiscard]] unsigned int nodes() const;
 
+    /**
+     * @return The layout of the underlying 1D array.
+     */
+    [[nodiscard]] DistanceMatrixLayout getLayout() const;
+
+    /**
+     * @return The number of distances in the underlying 1D array.
+     */
+    [[nodiscard]] size_t entries() const;
+
+    /**
+     * Copies complete rows of the matrix, the lower triangle of an UPPER_TRIANGULAR matrix is mirrored from the
+     * upper one. The mirrored values of consecutive rows are read together, so copying more rows at once is faster.
+     *
+     * @param firstRow[in] The first row to copy.
+     * @param rows[in] The number of consecutive rows to copy.
+     * @param out[out] The array of rows * columns values the rows are copied into.
+     */
+    void copyRows(unsigned int firstRow, unsigned int rows, IntType* out) const;
+
     /**
      * Prints some statistics about the distance matrix.
      */
@@ -153,18 +207,32 @@ private:
     const unsigned int rowsCnt;
     const unsigned int colsCnt;
     std::unique_ptr<IntType[]> distances;
+    DistanceMatrixLayout layout = DistanceMatrixLayout::FULL;
 
    /**
+    * Loads the graph and computes the distance matrix for it. If the graph is undirected (see 'Graph::isSymmetric')
+    * and 'packSymmetric' is set, the matrix is computed in the UPPER_TRIANGULAR layout.
     *
-    *
-    * @param fast[in] Specifies whether to use fast computing algorithm or not.
+    * @param mode[in] The algorithm used to compute the matrix.
     * @param graphLoader[in] instance of GraphLoader that will load the data for which we want to compute
     * the distance matrix.
     * @param scaling_factor[in] This parameter allows us to lose some precision
     * of the weight values. Each loaded weight will be divided by this value before rounding.
+    * @param packSymmetric[in] Whether the matrix of an undirected graph should be stored in the UPPER_TRIANGULAR layout.
     * @param timerName[in] Name of the timer to be used for the computation
     */
-    void computeDistanceMatrix(bool fast, GraphLoader& graphLoader, int scaling_factor, const std::string& timerName);
+    void computeDistanceMatrix(DistanceMatrixPreprocessingMode mode, GraphLoader& graphLoader, int scaling_factor,
+                               bool packSymmetric, const std::string& timerName);
+
+    /**
+     * @return The position of the distance in the underlying 1D array.
+     */
+    [[nodiscard]] size_t index(unsigned int row, unsigned int column) const {
+        if (layout == DistanceMatrixLayout::UPPER_TRIANGULAR) {
+            return upperTriangularIndex(row, column, colsCnt);
+        }
+        return static_cast<size_t>(row) * colsCnt + column;
+    }
 };
 
 #include "Distance_matrix_travel_time_provider.tpp"
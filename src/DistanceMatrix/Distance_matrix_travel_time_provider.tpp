@@ -3,6 +3,7 @@
 // Created on: 05.10.19
 //
 
+#include <algorithm>
 #include <cstdio>
 #include <climits>
 #include <fstream>
@@ -13,7 +14,9 @@
 #include <stdexcept> // For std::runtime_error
 
 #include "DistanceMatrixComputorFast.h"
+#include "DistanceMatrixComputorFloydWarshall.h"
 #include "DistanceMatrixComputorSlow.h"
+#include "../GraphBuilding/Structures/Graph.h"
 #include "../Timer/Timer.h"
 
 //______________________________________________________________________________________________________________________
@@ -38,11 +41,16 @@ template<class IntType> Distance_matrix_travel_time_provider<IntType>::Distance_
 }
 
 //______________________________________________________________________________________________________________________
-template<class IntType> Distance_matrix_travel_time_provider<IntType>::Distance_matrix_travel_time_provider(bool fast, GraphLoader& graphLoader, int scaling_factor):
+template<class IntType> Distance_matrix_travel_time_provider<IntType>::Distance_matrix_travel_time_provider(
+        DistanceMatrixPreprocessingMode mode,
+        GraphLoader& graphLoader,
+        int scaling_factor,
+        bool packSymmetric
+):
     rowsCnt(graphLoader.nodes()),
     colsCnt(graphLoader.nodes()) // Square matrix
 {
-    computeDistanceMatrix(fast, graphLoader, scaling_factor, "Distance Matrix preprocessing");
+    computeDistanceMatrix(mode, graphLoader, scaling_factor, packSymmetric, "Distance Matrix preprocessing");
 }
 
 //______________________________________________________________________________________________________________________
@@ -50,7 +58,7 @@ template<class IntType> dist_t Distance_matrix_travel_time_provider<IntType>::fi
     if (start_row >= rowsCnt || goal_col >= colsCnt) {
         throw std::out_of_range("Requested distance is out of bounds of the distance matrix.");
     }
-    return distances[static_cast<size_t>(start_row) * colsCnt + goal_col];
+    return distances[index(start_row, goal_col)];
 }
 
 //______________________________________________________________________________________________________________________
@@ -59,27 +67,60 @@ template<class IntType> void Distance_matrix_travel_time_provider<IntType>::setD
         // Handle out-of-bounds access, e.g., throw error or log
         return;
     }
-    distances[static_cast<size_t>(source_row) * colsCnt + target_col] = boost::numeric_cast<IntType>(distance);
+    distances[index(source_row, target_col)] = boost::numeric_cast<IntType>(distance);
 }
 
 
 //______________________________________________________________________________________________________________________
-template<class IntType> void Distance_matrix_travel_time_provider<IntType>::computeDistanceMatrix(bool fast, GraphLoader &graphLoader, int scaling_factor, const std::string& timerName) {
+template<class IntType> void Distance_matrix_travel_time_provider<IntType>::computeDistanceMatrix(
+        DistanceMatrixPreprocessingMode mode,
+        GraphLoader &graphLoader,
+        int scaling_factor,
+        bool packSymmetric,
+        const std::string& timerName
+) {
     Timer timer(timerName);
-    if (fast) {
-        DistanceMatrixComputorFast<IntType> computor;
+    timer.begin();
 
-        timer.begin();
-        distances = computor.compute_and_get_distance_matrix(graphLoader, scaling_factor);
-        timer.finish();
-    } else {
-        DistanceMatrixComputorSlow<IntType> computor;
-
-        timer.begin();
-        distances = computor.compute_and_get_distance_matrix(graphLoader, scaling_factor);
-        timer.finish();
+    Graph graph(graphLoader.nodes());
+    graphLoader.loadGraph(graph, scaling_factor);
+    const bool symmetric = packSymmetric && graph.isSymmetric();
+    if (symmetric) {
+        std::cout << "The graph is undirected, only the upper triangle of the distance matrix will be stored." << std::endl;
+    } else if (packSymmetric) {
+        std::cout << "The graph is not undirected, the whole distance matrix will be stored." << std::endl;
+    }
 
+    std::unique_ptr<DistanceMatrixComputor<IntType>> computor;
+    if (mode == DistanceMatrixPreprocessingMode::FAST) {
+        auto fastComputor = std::make_unique<DistanceMatrixComputorFast<IntType>>();
+        if (symmetric) {
+            fastComputor->computeSymmetricDistanceMatrix(graph);
+        } else {
+            fastComputor->computeDistanceMatrix(graph);
+        }
+        computor = std::move(fastComputor);
+    } else if (mode == DistanceMatrixPreprocessingMode::FLOYD_WARSHALL) {
+        auto floydWarshallComputor = std::make_unique<DistanceMatrixComputorFloydWarshall<IntType>>();
+        if (symmetric) {
+            floydWarshallComputor->computeSymmetricDistanceMatrix(graph);
+        } else {
+            floydWarshallComputor->computeDistanceMatrix(graph);
+        }
+        computor = std::move(floydWarshallComputor);
+    } else {
+        auto slowComputor = std::make_unique<DistanceMatrixComputorSlow<IntType>>();
+        if (symmetric) {
+            slowComputor->computeSymmetricDistanceMatrix(graph);
+        } else {
+            slowComputor->computeDistanceMatrix(graph);
+        }
+        computor = std::move(slowComputor);
     }
+    layout = computor->getLayout();
+    distances = computor->getDistanceMatrixInstance();
+
+    timer.finish();
     timer.printMeasuredTime();
 }
 
@@ -95,13 +136,13 @@ template<class IntType> void Distance_matrix_travel_time_provider<IntType>::prin
     }
     for(unsigned int i = 0; i < rowsCnt; i++) {
         for(unsigned int j = 0; j < colsCnt; j++) {
-            if (distances[static_cast<size_t>(i) * colsCnt + j] == static_cast<IntType>(max)) { // Cast max to IntType for comparison
+            if (distances[index(i, j)] == static_cast<IntType>(max)) { // Cast max to IntType for comparison
                 maxCnt++;
             }
             // Be careful with comparing IntType to half of dist_t if IntType is smaller.
             // This comparison might need adjustment based on IntType's range.
             // For simplicity, we assume IntType can represent values comparable to dist_t/2 or dist_t for this info.
-            if (static_cast<dist_t>(distances[static_cast<size_t>(i) * colsCnt + j]) >= half) { 
+            if (static_cast<dist_t>(distances[index(i, j)]) >= half) { 
                 halfCnt++;
             }
         }
@@ -122,6 +163,10 @@ template<class IntType> const std::unique_ptr<IntType[]> &Distance_matrix_travel
     return distances;
 }
 
+template<class IntType> const IntType* Distance_matrix_travel_time_provider<IntType>::getRawData() const {
+    return distances.get();
+}
+
 template<class IntType> unsigned int Distance_matrix_travel_time_provider<IntType>::getRows() const {
     return rowsCnt;
 }
@@ -145,6 +190,67 @@ template<class IntType> Distance_matrix_travel_time_provider<IntType>::Distance_
     Distance_matrix_travel_time_provider(std::move(distMatrix), size, size) { // Calls the (distMatrix, rows, cols) constructor
 }
 
+//______________________________________________________________________________________________________________________
+template<class IntType> Distance_matrix_travel_time_provider<IntType>::Distance_matrix_travel_time_provider(
+        const unsigned int nodes,
+        const DistanceMatrixLayout layout
+):
+    rowsCnt(nodes),
+    colsCnt(nodes),
+    distances(std::make_unique<IntType[]>(layout == DistanceMatrixLayout::UPPER_TRIANGULAR
+                                          ? upperTriangularEntries(nodes) : static_cast<size_t>(nodes) * nodes)),
+    layout(layout) {
+}
+
+//______________________________________________________________________________________________________________________
+template<class IntType> Distance_matrix_travel_time_provider<IntType>::Distance_matrix_travel_time_provider(
+        std::unique_ptr<IntType[]> distMatrix,
+        const unsigned int nodes,
+        const DistanceMatrixLayout layout
+):
+    rowsCnt(nodes),
+    colsCnt(nodes),
+    distances(std::move(distMatrix)),
+    layout(layout) {
+}
+
+//______________________________________________________________________________________________________________________
+template<class IntType> DistanceMatrixLayout Distance_matrix_travel_time_provider<IntType>::getLayout() const {
+    return layout;
+}
+
+//______________________________________________________________________________________________________________________
+template<class IntType> size_t Distance_matrix_travel_time_provider<IntType>::entries() const {
+    return layout == DistanceMatrixLayout::UPPER_TRIANGULAR
+           ? upperTriangularEntries(rowsCnt) : static_cast<size_t>(rowsCnt) * colsCnt;
+}
+
+//______________________________________________________________________________________________________________________
+template<class IntType> void Distance_matrix_travel_time_provider<IntType>::copyRows(
+        const unsigned int firstRow,
+        const unsigned int rows,
+        IntType* out
+) const {
+    const size_t n = colsCnt;
+    if (layout == DistanceMatrixLayout::FULL) {
+        std::copy(distances.get() + firstRow * n, distances.get() + (firstRow + static_cast<size_t>(rows)) * n, out);
+        return;
+    }
+
+    const unsigned int lastRow = firstRow + rows;
+    for (unsigned int row = firstRow; row < lastRow; row++) {
+        const IntType* upper = distances.get() + index(row, row);
+        std::copy(upper, upper + (n - row), out + (row - firstRow) * n + row);
+    }
+    // d(row, column) for column < row is stored in the row 'column', the values for the copied rows are consecutive
+    for (unsigned int column = 0; column + 1 < lastRow; column++) {
+        const IntType* stored = distances.get() + index(column, column);
+        for (unsigned int row = std::max(firstRow, column + 1); row < lastRow; row++) {
+            out[(row - firstRow) * n + column] = stored[row - column];
+        }
+    }
+}
+
 //______________________________________________________________________________________________________________________
 template<class IntType> unsigned int Distance_matrix_travel_time_provider<IntType>::nodes() const {
     if (rowsCnt != colsCnt) {
@@ -0,0 +1,236 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Czech Technical University in Prague
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. */
+
+/******************************************************************************
+* File:             QuerySetGenerator.cpp
+*****************************************************************************/
+
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <fstream>
+#include <numbers>
+#include "QuerySetGenerator.h"
+#include "../../Dijkstra/Structures/RadixHeap.h"
+#include "../../Error/Error.h"
+
+namespace {
+    constexpr double METERS_PER_DEGREE = 111320;
+
+    /**
+     * The number of random pairs tried for every long-distance query before giving up.
+     */
+    constexpr unsigned int LONG_DISTANCE_ATTEMPTS = 1000;
+}
+
+//______________________________________________________________________________________________________________________
+QuerySetGenerator::QuerySetGenerator(const SyntheticRoadNetwork& network, unsigned int seed)
+    : network(network), offsets(network.nodes() + 1, 0), generator(seed) {
+    for (const auto& road : network.roads) {
+        offsets[road.from + 1]++;
+        if (!road.oneWay) {
+            offsets[road.to + 1]++;
+        }
+    }
+    for (unsigned int i = 0; i < network.nodes(); i++) {
+        offsets[i + 1] += offsets[i];
+    }
+
+    edges.resize(offsets.back());
+    std::vector<unsigned int> next(offsets.begin(), offsets.end() - 1);
+    for (const auto& road : network.roads) {
+        edges[next[road.from]++] = {road.to, road.weight};
+        if (!road.oneWay) {
+            edges[next[road.to]++] = {road.from, road.weight};
+        }
+    }
+}
+
+//______________________________________________________________________________________________________________________
+QuerySetGenerator::Trips QuerySetGenerator::random(unsigned int count) {
+    std::uniform_int_distribution<unsigned int> node(0, network.nodes() - 1);
+    Trips trips(count);
+    for (auto& trip : trips) {
+        trip.first = node(generator);
+        trip.second = node(generator);
+    }
+    return trips;
+}
+
+//______________________________________________________________________________________________________________________
+QuerySetGenerator::Trips QuerySetGenerator::local(unsigned int count, unsigned int maxRank) {
+    if (maxRank == 0) {
+        throw input_error("The rank of the local queries must be positive.\n");
+    }
+
+    std::uniform_int_distribution<unsigned int> node(0, network.nodes() - 1);
+    Workspace workspace;
+    std::vector<unsigned int> order;
+    Trips trips(count);
+    for (auto& trip : trips) {
+        trip.first = node(generator);
+        settle(trip.first, static_cast<size_t>(maxRank) + 1, order, workspace);
+        if (order.size() == 1) {
+            trip.second = trip.first;
+            continue;
+        }
+        std::uniform_int_distribution<size_t> rank(1, order.size() - 1);
+        trip.second = order[rank(generator)];
+    }
+    return trips;
+}
+
+//______________________________________________________________________________________________________________________
+QuerySetGenerator::Trips QuerySetGenerator::longDistance(unsigned int count) {
+    double diagonal = 0;
+    if (network.nodes() > 0) {
+        auto [minLongitude, maxLongitude] = std::minmax_element(network.locations.begin(), network.locations.end(),
+            [](const auto& a, const auto& b) { return a.first < b.first; });
+        auto [minLatitude, maxLatitude] = std::minmax_element(network.locations.begin(), network.locations.end(),
+            [](const auto& a, const auto& b) { return a.second < b.second; });
+        const double latitude = (minLatitude->second + maxLatitude->second) / 2;
+        diagonal = std::hypot(
+            (maxLongitude->first - minLongitude->first) * METERS_PER_DEGREE * std::cos(latitude * std::numbers::pi / 180),
+            (maxLatitude->second - minLatitude->second) * METERS_PER_DEGREE);
+    }
+
+    std::uniform_int_distribution<unsigned int> node(0, network.nodes() - 1);
+    Trips trips(count);
+    for (auto& trip : trips) {
+        unsigned int attempt = 0;
+        do {
+            if (attempt++ == LONG_DISTANCE_ATTEMPTS) {
+                throw input_error("Could not find start and goal nodes far enough apart for the long-distance "
+                                  "queries.\n");
+            }
+            trip.first = node(generator);
+            trip.second = node(generator);
+        } while (distance(trip.first, trip.second) < diagonal / 2);
+    }
+    return trips;
+}
+
+//______________________________________________________________________________________________________________________
+std::vector<QuerySetGenerator::Trips> QuerySetGenerator::byDijkstraRank(unsigned int count) {
+    const unsigned int nodes = network.nodes();
+    unsigned int ranks = 0;
+    while (ranks < 31 && (1u << ranks) < nodes) {
+        ranks++;
+    }
+
+    std::uniform_int_distribution<unsigned int> node(0, nodes - 1);
+    std::vector<unsigned int> sources(count);
+    for (auto& source : sources) {
+        source = node(generator);
+    }
+
+    // goals[i * ranks + r] is the goal of rank 2^r for the i-th source.
+    std::vector<unsigned int> goals(static_cast<size_t>(count) * ranks, UINT_MAX);
+    #pragma omp parallel
+    {
+        Workspace workspace;
+        std::vector<unsigned int> order;
+        #pragma omp for schedule(dynamic)
+        for (long long i = 0; i < static_cast<long long>(count); i++) {
+            settle(sources[i], nodes, order, workspace);
+            for (unsigned int rank = 1; rank < ranks; rank++) {
+                if ((size_t{1} << rank) < order.size()) {
+                    goals[static_cast<size_t>(i) * ranks + rank] = order[size_t{1} << rank];
+                }
+            }
+        }
+    }
+
+    std::vector<Trips> sets(ranks);
+    for (unsigned int i = 0; i < count; i++) {
+        for (unsigned int rank = 1; rank < ranks; rank++) {
+            const unsigned int goal = goals[static_cast<size_t>(i) * ranks + rank];
+            if (goal != UINT_MAX) {
+                sets[rank].emplace_back(sources[i], goal);
+            }
+        }
+    }
+    return sets;
+}
+
+//______________________________________________________________________________________________________________________
+void QuerySetGenerator::write(const Trips& trips, const std::string& path) {
+    std::ofstream output(path);
+    if (!output.is_open()) {
+        throw input_error("Couldn't open the file '" + path + "' for writing.\n");
+    }
+    output << trips.size() << '\n';
+    for (const auto& trip : trips) {
+        output << trip.first << " " << trip.second << '\n';
+    }
+}
+
+//______________________________________________________________________________________________________________________
+void QuerySetGenerator::settle(unsigned int source, size_t limit, std::vector<unsigned int>& order,
+                               Workspace& workspace) const {
+    if (workspace.distances.size() != network.nodes()) {
+        workspace.distances.assign(network.nodes(), UINT_MAX);
+        workspace.stamps.assign(network.nodes(), 0);
+        workspace.stamp = 0;
+    }
+    if (++workspace.stamp == 0) {
+        std::fill(workspace.stamps.begin(), workspace.stamps.end(), 0);
+        workspace.stamp = 1;
+    }
+
+    auto distance = [&](unsigned int node) {
+        return workspace.stamps[node] == workspace.stamp ? workspace.distances[node] : UINT_MAX;
+    };
+
+    RadixHeap heap;
+    order.clear();
+    workspace.stamps[source] = workspace.stamp;
+    workspace.distances[source] = 0;
+    heap.push(source, 0);
+    while (!heap.empty() && order.size() < limit) {
+        const auto [key, node] = heap.pop();
+        if (key != distance(node)) {
+            continue;
+        }
+        order.push_back(node);
+
+        for (unsigned int i = offsets[node]; i < offsets[node + 1]; i++) {
+            const auto [neighbour, weight] = edges[i];
+            const dist_t candidate = key + weight;
+            if (candidate < distance(neighbour)) {
+                workspace.stamps[neighbour] = workspace.stamp;
+                workspace.distances[neighbour] = candidate;
+                heap.push(neighbour, candidate);
+            }
+        }
+    }
+}
+
+//______________________________________________________________________________________________________________________
+double QuerySetGenerator::distance(unsigned int a, unsigned int b) const {
+    const auto& first = network.locations[a];
+    const auto& second = network.locations[b];
+    const double latitude = (first.second + second.second) / 2;
+    return std::hypot((first.first - second.first) * METERS_PER_DEGREE * std::cos(latitude * std::numbers::pi / 180),
+                      (first.second - second.second) * METERS_PER_DEGREE);
+}
@@ -0,0 +1,122 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Czech Technical University in Prague
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. */
+
+/******************************************************************************
+* File:             QuerySetGenerator.h
+*
+* Description:      Query sets stratified by the Dijkstra rank and the distance
+*****************************************************************************/
+
+#ifndef SHORTEST_PATHS_QUERYSETGENERATOR_H
+#define SHORTEST_PATHS_QUERYSETGENERATOR_H
+
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+#include "RoadNetworkGenerator.h"
+
+/**
+ * Generates query sets for a synthetic road network. Apart from uniformly random queries, which are mostly long in
+ * a large network, it creates the query sets usually used to evaluate speed-up techniques:
+ *
+ * - Dijkstra rank queries: for a random source, the goal of rank 'r' is the 'r'-th node settled by the Dijkstra's
+ * algorithm started from the source. One query set is created for every rank '2^i', so the query times can be plotted
+ * against the "difficulty" of the query.
+ * - local queries: the goal is chosen randomly among the nodes settled by a Dijkstra search limited to a given rank.
+ * - long-distance queries: the straight line distance of the start and the goal is at least half of the diagonal of
+ * the network.
+ *
+ * All the query sets of one generator are reproducible for a given seed.
+ */
+class QuerySetGenerator {
+public:
+    using Trips = std::vector<std::pair<unsigned int, unsigned int>>;
+
+    /**
+     * Creates the generator, the network must outlive it.
+     *
+     * @param network[in] The network.
+     * @param seed[in] The seed of the random generator.
+     */
+    QuerySetGenerator(const SyntheticRoadNetwork& network, unsigned int seed);
+
+    /**
+     * @param count[in] The number of queries.
+     * @return Queries with uniformly random start and goal nodes.
+     */
+    Trips random(unsigned int count);
+
+    /**
+     * @param count[in] The number of queries.
+     * @param maxRank[in] The largest Dijkstra rank of the goal.
+     * @return Queries whose goal is at most the 'maxRank'-th node settled from the start.
+     */
+    Trips local(unsigned int count, unsigned int maxRank);
+
+    /**
+     * @param count[in] The number of queries.
+     * @return Queries whose start and goal are at least half of the network diagonal apart.
+     */
+    Trips longDistance(unsigned int count);
+
+    /**
+     * Creates the Dijkstra rank query sets. Every start node gives one query for every rank, the searches from the
+     * different start nodes run in parallel.
+     *
+     * @param count[in] The number of start nodes, so the number of queries in each set.
+     * @return The query sets, the i-th set contains the queries of rank '2^i' (the set for 'i = 0' is empty).
+     */
+    std::vector<Trips> byDijkstraRank(unsigned int count);
+
+    /**
+     * Writes queries in the query set format.
+     *
+     * @param trips[in] The queries.
+     * @param path[in] Path to the output file.
+     */
+    static void write(const Trips& trips, const std::string& path);
+
+private:
+    /**
+     * The distances of one search, a distance is only valid if its stamp is the current one.
+     */
+    struct Workspace {
+        std::vector<dist_t> distances;
+        std::vector<unsigned int> stamps;
+        unsigned int stamp = 0;
+    };
+
+    // Runs the Dijkstra's algorithm from the source until 'limit' nodes are settled, 'order' gets the settled nodes.
+    void settle(unsigned int source, size_t limit, std::vector<unsigned int>& order, Workspace& workspace) const;
+
+    // Straight line distance in meters.
+    double distance(unsigned int a, unsigned int b) const;
+
+    const SyntheticRoadNetwork& network;
+    std::vector<unsigned int> offsets;
+    std::vector<std::pair<unsigned int, dist_t>> edges;
+    std::mt19937_64 generator;
+};
+
+#endif //SHORTEST_PATHS_QUERYSETGENERATOR_H
@@ -0,0 +1,358 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Czech Technical University in Prague
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. */
+
+/******************************************************************************
+* File:             RoadNetworkGenerator.cpp
+*****************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <numbers>
+#include <random>
+#include "RoadNetworkGenerator.h"
+#include "../../Error/Error.h"
+
+namespace {
+    /**
+     * The speeds of the road classes in km/h.
+     */
+    constexpr double LOCAL_SPEED = 30;
+    constexpr double ARTERIAL_SPEED = 50;
+    constexpr double HIGHWAY_SPEED = 110;
+
+    /**
+     * The south-west corner of the generated network, so that all the nodes lie in one UTM zone for sizes up to a few
+     * ten million nodes.
+     */
+    constexpr double BASE_LATITUDE = 48.5;
+    constexpr double BASE_LONGITUDE = 12.5;
+
+    constexpr double METERS_PER_DEGREE = 111320;
+
+    enum class RoadClass {
+        LOCAL,
+        ARTERIAL,
+        HIGHWAY
+    };
+
+    double speed(RoadClass roadClass) {
+        switch (roadClass) {
+            case RoadClass::LOCAL:
+                return LOCAL_SPEED;
+            case RoadClass::ARTERIAL:
+                return ARTERIAL_SPEED;
+            default:
+                return HIGHWAY_SPEED;
+        }
+    }
+
+    /**
+     * The largest ratio of the road length and the straight line distance of its end nodes.
+     */
+    double maxDetour(RoadClass roadClass) {
+        switch (roadClass) {
+            case RoadClass::LOCAL:
+                return 1.3;
+            case RoadClass::ARTERIAL:
+                return 1.1;
+            default:
+                return 1.05;
+        }
+    }
+
+    /**
+     * Marks the nodes reachable from the source (or the nodes that can reach the source if 'backward' is set).
+     */
+    std::vector<bool> reachable(unsigned int nodes, const std::vector<SyntheticRoad>& roads, unsigned int source,
+                                bool backward) {
+        std::vector<unsigned int> offsets(nodes + 1, 0);
+        for (const auto& road : roads) {
+            offsets[(backward ? road.to : road.from) + 1]++;
+            if (!road.oneWay) {
+                offsets[(backward ? road.from : road.to) + 1]++;
+            }
+        }
+        for (unsigned int i = 0; i < nodes; i++) {
+            offsets[i + 1] += offsets[i];
+        }
+        std::vector<unsigned int> targets(offsets[nodes]);
+        std::vector<unsigned int> next(offsets.begin(), offsets.end() - 1);
+        for (const auto& road : roads) {
+            const unsigned int tail = backward ? road.to : road.from;
+            const unsigned int head = backward ? road.from : road.to;
+            targets[next[tail]++] = head;
+            if (!road.oneWay) {
+                targets[next[head]++] = tail;
+            }
+        }
+
+        std::vector<bool> visited(nodes, false);
+        std::vector<unsigned int> stack = {source};
+        visited[source] = true;
+        while (!stack.empty()) {
+            const unsigned int node = stack.back();
+            stack.pop_back();
+            for (unsigned int i = offsets[node]; i < offsets[node + 1]; i++) {
+                if (!visited[targets[i]]) {
+                    visited[targets[i]] = true;
+                    stack.push_back(targets[i]);
+                }
+            }
+        }
+        return visited;
+    }
+
+    std::ofstream openOutput(const std::string& path) {
+        std::ofstream output(path);
+        if (!output.is_open()) {
+            throw input_error("Couldn't open the file '" + path + "' for writing.\n");
+        }
+        return output;
+    }
+}
+
+//______________________________________________________________________________________________________________________
+unsigned int SyntheticRoadNetwork::nodes() const {
+    return static_cast<unsigned int>(locations.size());
+}
+
+//______________________________________________________________________________________________________________________
+size_t SyntheticRoadNetwork::edges() const {
+    size_t edges = 0;
+    for (const auto& road : roads) {
+        edges += road.oneWay ? 1 : 2;
+    }
+    return edges;
+}
+
+//______________________________________________________________________________________________________________________
+Graph SyntheticRoadNetwork::toGraph() const {
+    Graph graph(nodes());
+    for (const auto& road : roads) {
+        graph.addEdge(road.from, road.to, road.weight);
+        if (!road.oneWay) {
+            graph.addEdge(road.to, road.from, road.weight);
+        }
+    }
+    return graph;
+}
+
+//______________________________________________________________________________________________________________________
+void SyntheticRoadNetwork::writeXenGraph(const std::string& path) const {
+    auto output = openOutput(path);
+    output << "XGI " << nodes() << " " << roads.size() << '\n';
+    for (const auto& road : roads) {
+        output << road.from << " " << road.to << " " << road.weight << " " << (road.oneWay ? 1 : 0) << '\n';
+    }
+}
+
+//______________________________________________________________________________________________________________________
+void SyntheticRoadNetwork::writeDIMACS(const std::string& path) const {
+    auto output = openOutput(path);
+    output << "p sp " << nodes() << " " << edges() << '\n';
+    for (const auto& road : roads) {
+        output << "a " << road.from + 1 << " " << road.to + 1 << " " << road.weight << '\n';
+        if (!road.oneWay) {
+            output << "a " << road.to + 1 << " " << road.from + 1 << " " << road.weight << '\n';
+        }
+    }
+}
+
+//______________________________________________________________________________________________________________________
+void SyntheticRoadNetwork::writeCsv(const std::string& directory) const {
+    std::filesystem::create_directories(directory);
+
+    auto nodesOutput = openOutput((std::filesystem::path(directory) / "nodes.csv").string());
+    nodesOutput << std::fixed << std::setprecision(7);
+    nodesOutput << "id\tx\ty\n";
+    for (unsigned int i = 0; i < nodes(); i++) {
+        nodesOutput << i << '\t' << locations[i].first << '\t' << locations[i].second << '\n';
+    }
+
+    auto edgesOutput = openOutput((std::filesystem::path(directory) / "edges.csv").string());
+    edgesOutput << "u\tv\tcost\n";
+    for (const auto& road : roads) {
+        edgesOutput << road.from << '\t' << road.to << '\t' << road.weight << '\n';
+        if (!road.oneWay) {
+            edgesOutput << road.to << '\t' << road.from << '\t' << road.weight << '\n';
+        }
+    }
+}
+
+//______________________________________________________________________________________________________________________
+void SyntheticRoadNetwork::writeAdjacencyMatrix(const std::string& path) const {
+    const unsigned int n = nodes();
+    if (n > ADJACENCY_MATRIX_MAX_NODES) {
+        throw input_error("The network has " + std::to_string(n) + " nodes, the adjacency matrix format is only "
+                          "written for at most " + std::to_string(ADJACENCY_MATRIX_MAX_NODES) + " nodes.\n");
+    }
+
+    const dist_t none = std::numeric_limits<dist_t>::max();
+    std::vector<dist_t> matrix(static_cast<size_t>(n) * n, none);
+    auto set = [&](unsigned int from, unsigned int to, dist_t weight) {
+        dist_t& cell = matrix[static_cast<size_t>(from) * n + to];
+        cell = std::min(cell, weight);
+    };
+    for (const auto& road : roads) {
+        set(road.from, road.to, road.weight);
+        if (!road.oneWay) {
+            set(road.to, road.from, road.weight);
+        }
+    }
+
+    auto output = openOutput(path);
+    for (unsigned int i = 0; i < n; i++) {
+        for (unsigned int j = 0; j < n; j++) {
+            const dist_t weight = matrix[static_cast<size_t>(i) * n + j];
+            if (j > 0) {
+                output << ", ";
+            }
+            if (weight == none) {
+                output << "nan";
+            } else {
+                output << weight;
+            }
+        }
+        output << '\n';
+    }
+}
+
+//______________________________________________________________________________________________________________________
+RoadNetworkGenerator::RoadNetworkGenerator(const Options& options) : options(options) {
+    if (options.nodes < 4) {
+        throw input_error("The synthetic network needs at least 4 nodes.\n");
+    }
+    if (!(options.spacing > 0)) {
+        throw input_error("The grid spacing must be positive.\n");
+    }
+    if (options.arterialSpacing == 0 || options.highwaySpacing == 0 || options.highwayExitSpacing == 0) {
+        throw input_error("The arterial, highway and highway exit spacings must be positive.\n");
+    }
+    if (options.oneWayProbability < 0 || options.oneWayProbability > 1 || options.missingProbability < 0
+        || options.missingProbability > 1) {
+        throw input_error("The one-way and missing street probabilities must be between 0 and 1.\n");
+    }
+}
+
+//______________________________________________________________________________________________________________________
+SyntheticRoadNetwork RoadNetworkGenerator::generate() const {
+    const auto columns = static_cast<unsigned int>(std::ceil(std::sqrt(static_cast<double>(options.nodes))));
+    const unsigned int rows = (options.nodes + columns - 1) / columns;
+    const unsigned int gridNodes = rows * columns;
+
+    std::mt19937_64 generator(options.seed);
+    std::uniform_real_distribution<double> jitter(-options.spacing / 3, options.spacing / 3);
+    std::uniform_real_distribution<double> unit(0, 1);
+    std::bernoulli_distribution oneWay(options.oneWayProbability);
+    std::bernoulli_distribution missing(options.missingProbability);
+
+    std::vector<std::pair<double, double>> positions(gridNodes);
+    for (unsigned int row = 0; row < rows; row++) {
+        for (unsigned int column = 0; column < columns; column++) {
+            positions[row * columns + column] = {column * options.spacing + jitter(generator),
+                                                 row * options.spacing + jitter(generator)};
+        }
+    }
+
+    std::vector<SyntheticRoad> roads;
+    auto addRoad = [&](unsigned int from, unsigned int to, RoadClass roadClass, bool isOneWay) {
+        const double straight = std::hypot(positions[from].first - positions[to].first,
+                                           positions[from].second - positions[to].second);
+        const double length = straight * (1 + (maxDetour(roadClass) - 1) * unit(generator));
+        const auto weight = static_cast<dist_t>(std::ceil(length * HIGHWAY_SPEED / speed(roadClass)));
+        roads.push_back({from, to, std::max<dist_t>(weight, 1), isOneWay});
+    };
+
+    // The streets along one line of the grid, 'node(i)' is the i-th node of the line.
+    auto addStreet = [&](unsigned int line, unsigned int lines, unsigned int length, auto node) {
+        const bool arterial = line % options.arterialSpacing == 0 || line + 1 == lines;
+        const bool isOneWay = !arterial && oneWay(generator);
+        const bool reversed = line % 2 == 1;
+        for (unsigned int i = 0; i + 1 < length; i++) {
+            if (!arterial && missing(generator)) {
+                continue;
+            }
+            if (reversed) {
+                addRoad(node(i + 1), node(i), arterial ? RoadClass::ARTERIAL : RoadClass::LOCAL, isOneWay);
+            } else {
+                addRoad(node(i), node(i + 1), arterial ? RoadClass::ARTERIAL : RoadClass::LOCAL, isOneWay);
+            }
+        }
+
+        if (line % options.highwaySpacing == 0) {
+            for (unsigned int i = 0; i + options.highwayExitSpacing < length; i += options.highwayExitSpacing) {
+                addRoad(node(i), node(i + options.highwayExitSpacing), RoadClass::HIGHWAY, false);
+            }
+        }
+    };
+
+    for (unsigned int row = 0; row < rows; row++) {
+        addStreet(row, rows, columns, [&](unsigned int i) { return row * columns + i; });
+    }
+    for (unsigned int column = 0; column < columns; column++) {
+        addStreet(column, columns, rows, [&](unsigned int i) { return i * columns + column; });
+    }
+
+    // Only the strongly connected component of the center is kept.
+    const unsigned int center = (rows / 2) * columns + columns / 2;
+    const auto forward = reachable(gridNodes, roads, center, false);
+    const auto backward = reachable(gridNodes, roads, center, true);
+
+    std::vector<unsigned int> kept;
+    for (unsigned int node = 0; node < gridNodes; node++) {
+        if (forward[node] && backward[node]) {
+            kept.push_back(node);
+        }
+    }
+
+    std::vector<unsigned int> ids(kept.size());
+    for (unsigned int i = 0; i < ids.size(); i++) {
+        ids[i] = i;
+    }
+    if (!options.gridOrder) {
+        std::shuffle(ids.begin(), ids.end(), generator);
+    }
+
+    const unsigned int removed = std::numeric_limits<unsigned int>::max();
+    std::vector<unsigned int> newIds(gridNodes, removed);
+    SyntheticRoadNetwork network;
+    network.locations.resize(kept.size());
+    const double metersPerLongitudeDegree = METERS_PER_DEGREE * std::cos(BASE_LATITUDE * std::numbers::pi / 180);
+    for (unsigned int i = 0; i < kept.size(); i++) {
+        newIds[kept[i]] = ids[i];
+        network.locations[ids[i]] = {BASE_LONGITUDE + positions[kept[i]].first / metersPerLongitudeDegree,
+                                     BASE_LATITUDE + positions[kept[i]].second / METERS_PER_DEGREE};
+    }
+
+    for (const auto& road : roads) {
+        if (newIds[road.from] != removed && newIds[road.to] != removed) {
+            network.roads.push_back({newIds[road.from], newIds[road.to], road.weight, road.oneWay});
+        }
+    }
+
+    return network;
+}
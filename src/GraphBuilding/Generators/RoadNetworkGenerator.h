@@ -0,0 +1,206 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Czech Technical University in Prague
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. */
+
+/******************************************************************************
+* File:             RoadNetworkGenerator.h
+*
+* Description:      Synthetic road-like graphs of configurable size
+*****************************************************************************/
+
+#ifndef SHORTEST_PATHS_ROADNETWORKGENERATOR_H
+#define SHORTEST_PATHS_ROADNETWORKGENERATOR_H
+
+#include <string>
+#include <utility>
+#include <vector>
+#include "../../constants.h"
+#include "../Structures/Graph.h"
+
+/**
+ * One road of a synthetic network. Two-way roads are stored once, a one-way road only leads from 'from' to 'to'.
+ */
+struct SyntheticRoad {
+    unsigned int from;
+    unsigned int to;
+    dist_t weight;
+    bool oneWay;
+};
+
+/**
+ * A generated road network, the roads together with the locations of the nodes. It can be written in all the graph
+ * formats the preprocessor accepts, so that the same network can be used with every method.
+ */
+class SyntheticRoadNetwork {
+public:
+    /**
+     * The largest number of nodes written into the adjacency matrix format, which needs 'n^2' cells.
+     */
+    static constexpr unsigned int ADJACENCY_MATRIX_MAX_NODES = 20000;
+
+    /**
+     * The locations of the nodes as (longitude, latitude) pairs in degrees.
+     */
+    std::vector<std::pair<double, double>> locations;
+
+    /**
+     * The roads of the network.
+     */
+    std::vector<SyntheticRoad> roads;
+
+    /**
+     * @return The number of nodes.
+     */
+    unsigned int nodes() const;
+
+    /**
+     * @return The number of directed edges, two-way roads are counted twice.
+     */
+    size_t edges() const;
+
+    /**
+     * Creates a Graph with the directed edges of the network, mainly for the tests.
+     *
+     * @return The graph.
+     */
+    Graph toGraph() const;
+
+    /**
+     * Writes the network in the XenGraph format, the one-way roads get the one way flag.
+     *
+     * @param path[in] Path to the output file, including the suffix.
+     */
+    void writeXenGraph(const std::string& path) const;
+
+    /**
+     * Writes the network in the DIMACS format, where every edge is directed.
+     *
+     * @param path[in] Path to the output file, including the suffix.
+     */
+    void writeDIMACS(const std::string& path) const;
+
+    /**
+     * Writes the network in the CSV format, 'nodes.csv' with the locations and 'edges.csv' with the directed edges.
+     *
+     * @param directory[in] The directory for the two files, created if it does not exist.
+     */
+    void writeCsv(const std::string& directory) const;
+
+    /**
+     * Writes the network in the adjacency matrix format. The parallel edges are merged into the shortest one.
+     *
+     * @param path[in] Path to the output file, including the suffix.
+     * @throws input_error If the network has more than 'ADJACENCY_MATRIX_MAX_NODES' nodes.
+     */
+    void writeAdjacencyMatrix(const std::string& path) const;
+};
+
+/**
+ * Generates road-like networks of any size, so that the preprocessing and the queries can be benchmarked on large
+ * graphs without proprietary data. The network is a perturbed grid:
+ *
+ * - Every grid node is moved randomly by up to a third of the grid spacing and every road is somewhat longer than
+ * the straight line between its end nodes, so the network is not a perfect grid.
+ * - Most streets are local streets. A local street can be one-way (the directions alternate like in Manhattan) and
+ * some of its segments are missing.
+ * - Every 'arterialSpacing'-th row and column is a faster two-way arterial road.
+ * - Every 'highwaySpacing'-th row and column additionally has a highway with an exit every 'highwayExitSpacing'
+ * grid nodes. The highways form the top level of the road hierarchy.
+ *
+ * The weights are travel times, one unit is the time needed to drive one meter on a highway. So no weight is smaller
+ * than the straight line distance between the nodes in meters, which keeps the heuristic of the A* benchmark
+ * admissible. Only the strongly connected component containing the center of the grid is kept, so every query has an
+ * answer. The node IDs are shuffled by default, because the IDs of real road networks do not follow the geometry.
+ */
+class RoadNetworkGenerator {
+public:
+    /**
+     * The parameters of the generated network.
+     */
+    struct Options {
+        /**
+         * The approximate number of nodes, the grid has 'ceil(sqrt(nodes))' columns. The nodes outside the largest
+         * strongly connected component are removed, so the network has a few nodes less.
+         */
+        unsigned int nodes = 10000;
+
+        /**
+         * The seed of the random generator, the same options and the same seed always give the same network.
+         */
+        unsigned int seed = 1;
+
+        /**
+         * The distance of the neighbouring grid nodes in meters.
+         */
+        double spacing = 100;
+
+        /**
+         * Every this many rows and columns are arterial roads.
+         */
+        unsigned int arterialSpacing = 8;
+
+        /**
+         * Every this many rows and columns have a highway.
+         */
+        unsigned int highwaySpacing = 64;
+
+        /**
+         * The number of grid nodes between two highway exits.
+         */
+        unsigned int highwayExitSpacing = 4;
+
+        /**
+         * The probability that a local street is one-way.
+         */
+        double oneWayProbability = 0.2;
+
+        /**
+         * The probability that a segment of a local street is missing.
+         */
+        double missingProbability = 0.05;
+
+        /**
+         * Keep the node IDs in the row-major order of the grid instead of shuffling them.
+         */
+        bool gridOrder = false;
+    };
+
+    /**
+     * A simple constructor.
+     *
+     * @param options[in] The parameters of the generated network.
+     * @throws input_error If the parameters are not valid.
+     */
+    explicit RoadNetworkGenerator(const Options& options);
+
+    /**
+     * Generates the network.
+     *
+     * @return The generated network.
+     */
+    SyntheticRoadNetwork generate() const;
+
+private:
+    Options options;
+};
+
+#endif //SHORTEST_PATHS_ROADNETWORKGENERATOR_H
@@ -129,7 +129,7 @@ void CsvGraphLoader::loadGraph(BaseGraph& graph, int scaling_factor) {
 }
 
 void CsvGraphLoader::loadLocations(std::vector<std::pair<double, double>>& locations) {
-	io::CSVReader<3, io::trim_chars<>, io::no_quote_escape<'\t'>> node_reader(edges_path.string());
+	io::CSVReader<3, io::trim_chars<>, io::no_quote_escape<'\t'>> node_reader(nodes_path.string());
 	node_reader.read_header(io::ignore_extra_column, "id", "x", "y");
 	unsigned int id;
 	double x;
@@ -137,8 +137,8 @@ void CsvGraphLoader::loadLocations(std::vector<std::pair<double, double>>& locat
 	unsigned counter = 0;
 	constexpr unsigned progress_bar_step = 1'000'000;
 
-	// count edges
-	std::ifstream in_stream(edges_path);
+	// count nodes
+	std::ifstream in_stream(nodes_path);
 	auto count = std::count_if(std::istreambuf_iterator<char>{in_stream}, {}, [](char c) { return c == '\n'; });
 
 	indicators::ProgressBar progress_bar{
@@ -26,10 +26,24 @@
 // Created on: 23.8.18
 //
 
+#include <algorithm>
+#include <filesystem>
 #include <fstream>
+#include <random>
+#include <stdexcept>
 #include "DDSGLoader.h"
 #include "../../Timer/Timer.h"
 
+namespace {
+    // an edge of the query graph together with the node it is stored at, as written into the temporary file
+    struct BucketedEdge {
+        unsigned int node;
+        unsigned int target;
+        unsigned int weight;
+        unsigned int flags;
+    };
+}
+
 //______________________________________________________________________________________________________________________
 DDSGLoader::DDSGLoader(std::string inputFile) : inputFile(inputFile) {
 
@@ -102,6 +116,181 @@ FlagsGraphWithUnpackingData * DDSGLoader::loadFlagsGraphWithUnpackingData() {
     return graph;
 }
 
+//______________________________________________________________________________________________________________________
+template<class Function>
+void DDSGLoader::forEachQueryEdge(
+        std::ifstream & input,
+        unsigned int edges,
+        unsigned int shortcutEdges,
+        const std::vector<NodeData>& nodesData,
+        Function process) {
+    // both kinds of edges start with the source node, the target node, the weight and the flags, the shortcut edges
+    // also contain the middle node, which the query graph does not need
+    unsigned int record[5];
+    for (size_t i = 0; i < static_cast<size_t>(edges) + shortcutEdges; i++) {
+        const size_t recordSize = (i < edges ? 4 : 5) * sizeof(unsigned int);
+        input.read((char*)record, static_cast<std::streamsize>(recordSize));
+        const unsigned int from = record[0];
+        const unsigned int to = record[1];
+        const bool forward = (record[3] & 1) == 1;
+        const bool backward = (record[3] & 2) == 2;
+        if ( nodesData[from].rank < nodesData[to].rank ) {
+            process(from, QueryEdge(to, record[2], forward, backward));
+        } else {
+            process(to, QueryEdge(from, record[2], forward, backward));
+        }
+    }
+}
+
+//______________________________________________________________________________________________________________________
+CompressedFlagsGraph * DDSGLoader::loadCompressedFlagsGraph(size_t chunkEdges) {
+    std::ifstream input;
+    input.open(inputFile, std::ios::binary);
+
+    if ( ! input.is_open() ) {
+        printf("Couldn't open file '%s'!", this->inputFile.c_str());
+        exit(1);
+    }
+
+    if ( verifyHeader(input) == false ) {
+        printf("Something was wrong with the header.\nFile should start with 'CH\\r\\n' followed by the");
+        printf(" version '1', but it didn't.\n");
+        exit(1);
+    }
+
+    unsigned int nodes, edges, shortcutEdges;
+    loadCnts(input, nodes, edges, shortcutEdges);
+    std::vector<NodeData> nodesData(nodes);
+    for (unsigned int i = 0; i < nodes; i++) {
+        input.read((char*)&nodesData[i].rank, sizeof(nodesData[i].rank));
+    }
+    const std::streampos edgesPosition = input.tellg();
+
+    // the first pass only counts the edges stored at each node
+    std::vector<unsigned int> nodeEdges(nodes, 0);
+    forEachQueryEdge(input, edges, shortcutEdges, nodesData, [&nodeEdges](unsigned int node, const QueryEdge&) {
+        nodeEdges[node]++;
+    });
+    if ( verifyFooter(input) == false ) {
+        printf("The file didn't end the expected way!\nThis file should have ended with an unsigned int");
+        printf(" with value '0x12345678', but it didn't.\nThe file could be corrupted, so using it");
+        printf(" might provide unexpected and incorrect results.\n");
+    }
+
+    // the nodes are split into ranges whose edges fit into one chunk (a node with more edges gets its own range),
+    // range r contains the nodes [rangeFirstNodes[r], rangeFirstNodes[r + 1]) and their edges are the edges
+    // [rangeOffsets[r], rangeOffsets[r + 1]) in the order of the ranges
+    std::vector<unsigned int> rangeFirstNodes(1, 0);
+    std::vector<size_t> rangeOffsets(1, 0);
+    size_t rangeSize = 0;
+    for (unsigned int node = 0; node < nodes; node++) {
+        if (rangeSize > 0 && rangeSize + nodeEdges[node] > chunkEdges) {
+            rangeFirstNodes.push_back(node);
+            rangeOffsets.push_back(rangeOffsets.back() + rangeSize);
+            rangeSize = 0;
+        }
+        rangeSize += nodeEdges[node];
+    }
+    rangeFirstNodes.push_back(nodes);
+    rangeOffsets.push_back(rangeOffsets.back() + rangeSize);
+    const size_t ranges = rangeFirstNodes.size() - 1;
+
+    CompressedFlagsGraph * graph = new CompressedFlagsGraph(nodesData);
+    std::vector<size_t> chunkOffsets;
+    std::vector<size_t> positions;
+    std::vector<QueryEdge> chunk;
+    std::vector<QueryEdge> sorted;
+    // collects the edges of one range passed to the 'add' function by 'readEdges' and encodes them
+    auto encodeRange = [&](size_t range, auto readEdges) {
+        const unsigned int first = rangeFirstNodes[range];
+        const unsigned int last = rangeFirstNodes[range + 1];
+        chunkOffsets.assign(1, 0);
+        for (unsigned int node = first; node < last; node++) {
+            chunkOffsets.push_back(chunkOffsets.back() + nodeEdges[node]);
+        }
+        positions.assign(chunkOffsets.begin(), chunkOffsets.end() - 1);
+        chunk.resize(chunkOffsets.back(), QueryEdge(0, 0, false, false));
+        readEdges([&](unsigned int node, const QueryEdge& edge) {
+            chunk[positions[node - first]++] = edge;
+        });
+
+        for (unsigned int node = first; node < last; node++) {
+            sorted.assign(chunk.begin() + static_cast<std::ptrdiff_t>(chunkOffsets[node - first]),
+                          chunk.begin() + static_cast<std::ptrdiff_t>(chunkOffsets[node - first + 1]));
+            graph->addNodeEdges(sorted);
+        }
+    };
+
+    input.clear();
+    input.seekg(edgesPosition);
+    if (ranges == 1) {
+        // all the edges fit into one chunk, they are collected directly from the file
+        encodeRange(0, [&](auto add) {
+            forEachQueryEdge(input, edges, shortcutEdges, nodesData, add);
+        });
+        return graph;
+    }
+
+    // the second pass writes the edges into a temporary file grouped by the ranges (each range at its offset, through
+    // a buffer per range), so that every range can then be read back at once
+    const std::filesystem::path bucketsPath = std::filesystem::temp_directory_path()
+            / (std::filesystem::path(inputFile).filename().string() + "." + std::to_string(std::random_device()())
+               + ".buckets");
+    std::fstream buckets(bucketsPath, std::ios::in | std::ios::out | std::ios::trunc | std::ios::binary);
+    if ( ! buckets.is_open() ) {
+        delete graph;
+        throw std::runtime_error("Couldn't open the temporary file '" + bucketsPath.string() + "'.");
+    }
+
+    std::vector<std::vector<BucketedEdge>> buffers(ranges);
+    std::vector<size_t> written(ranges, 0);
+    const size_t bufferEdges = std::max<size_t>(1, chunkEdges / ranges);
+    auto flush = [&](size_t range) {
+        buckets.seekp(static_cast<std::streamoff>((rangeOffsets[range] + written[range]) * sizeof(BucketedEdge)));
+        buckets.write((const char*) buffers[range].data(),
+                      static_cast<std::streamsize>(buffers[range].size() * sizeof(BucketedEdge)));
+        written[range] += buffers[range].size();
+        buffers[range].clear();
+    };
+    forEachQueryEdge(input, edges, shortcutEdges, nodesData, [&](unsigned int node, const QueryEdge& edge) {
+        const size_t range = static_cast<size_t>(
+                std::upper_bound(rangeFirstNodes.begin(), rangeFirstNodes.end(), node) - rangeFirstNodes.begin()) - 1;
+        buffers[range].push_back(BucketedEdge{node, edge.targetNode, edge.weight,
+                                              (edge.forward ? 1u : 0u) | (edge.backward ? 2u : 0u)});
+        if (buffers[range].size() == bufferEdges) {
+            flush(range);
+        }
+    });
+    for (size_t range = 0; range < ranges; range++) {
+        flush(range);
+    }
+    buffers = std::vector<std::vector<BucketedEdge>>();
+
+    std::vector<BucketedEdge> block(std::min<size_t>(chunkEdges, 1 << 16));
+    for (size_t range = 0; range < ranges && buckets; range++) {
+        encodeRange(range, [&](auto add) {
+            buckets.seekg(static_cast<std::streamoff>(rangeOffsets[range] * sizeof(BucketedEdge)));
+            for (size_t read = rangeOffsets[range]; read < rangeOffsets[range + 1]; read += block.size()) {
+                const size_t count = std::min(block.size(), rangeOffsets[range + 1] - read);
+                buckets.read((char*) block.data(), static_cast<std::streamsize>(count * sizeof(BucketedEdge)));
+                for (size_t i = 0; i < count && buckets; i++) {
+                    const BucketedEdge& edge = block[i];
+                    add(edge.node, QueryEdge(edge.target, edge.weight, (edge.flags & 1) != 0, (edge.flags & 2) != 0));
+                }
+            }
+        });
+    }
+    const bool bucketsValid = static_cast<bool>(buckets);
+    buckets.close();
+    std::filesystem::remove(bucketsPath);
+    if ( ! bucketsValid ) {
+        delete graph;
+        throw std::runtime_error("Couldn't write or read the temporary file '" + bucketsPath.string() + "'.");
+    }
+
+    return graph;
+}
+
 //______________________________________________________________________________________________________________________
 void DDSGLoader::loadRanks(std::ifstream & input, unsigned int nodes, FlagsGraph<NodeData>& graph) {
     for(unsigned int i = 0; i < nodes; i++) {
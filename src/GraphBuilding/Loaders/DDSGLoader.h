@@ -29,7 +29,10 @@
 #ifndef TRANSIT_NODE_ROUTING_DDSGLOADER_H
 #define TRANSIT_NODE_ROUTING_DDSGLOADER_H
 
+#include <cstddef>
 #include <string>
+#include <vector>
+#include "../Structures/CompressedFlagsGraph.h"
 #include "../Structures/Graph.h"
 #include "../Structures/FlagsGraph.h"
 #include "../Structures/FlagsGraphWithUnpackingData.h"
@@ -152,6 +155,24 @@ private:
             unsigned int shortcutEdges,
             FlagsGraphWithUnpackingData & graph);
 
+    /**
+     * Reads the original edges and the shortcut edges one after another and passes each of them to the given function
+     * in the QueryEdge form, together with the node it is stored at (the incident node with the lower rank).
+     *
+     * @param input[in] The input stream positioned at the first original edge.
+     * @param edges[in] The number of original edges.
+     * @param shortcutEdges[in] The number of shortcut edges.
+     * @param nodesData[in] The ranks of all the nodes.
+     * @param process[in] The function called for every edge with the node it is stored at and the edge.
+     */
+    template<class Function>
+    void forEachQueryEdge(
+            std::ifstream & input,
+            unsigned int edges,
+            unsigned int shortcutEdges,
+            const std::vector<NodeData>& nodesData,
+            Function process);
+
 public:
     /**
      * A simple constructor.
@@ -177,6 +198,23 @@ public:
      * the Contraction Hierarchies query algorithm.
      */
     FlagsGraphWithUnpackingData * loadFlagsGraphWithUnpackingData();
+
+    /**
+     * This function reads the input file and encodes the Contraction Hierarchies data into a CompressedFlagsGraph
+     * without building a FlagsGraph first. The edges in the file are read exactly twice regardless of 'chunkEdges':
+     * the first pass counts the edges stored at each node, which splits the nodes into ranges with at most
+     * 'chunkEdges' edges each. If there is only one range, the second pass collects all the edges and encodes them.
+     * Otherwise the second pass writes the edges grouped by the ranges into a temporary file (16 bytes per edge,
+     * written once and read once) and the ranges are then read back from it one by one and encoded. Apart from
+     * the compressed graph, only the ranks and the edge counts of all the nodes and about 'chunkEdges' edges are held
+     * in memory at once.
+     *
+     * @param chunkEdges[in] The maximum number of uncompressed edges held in memory at once (a node with more edges
+     * is still read at once).
+     * @return A CompressedFlagsGraph class instance that can be used to answer distance queries using
+     * the Contraction Hierarchies query algorithm.
+     */
+    CompressedFlagsGraph * loadCompressedFlagsGraph(size_t chunkEdges = 1 << 20);
 };
 
 // ~~~ DESCRIPTION OF THE CH FORMAT ~~~
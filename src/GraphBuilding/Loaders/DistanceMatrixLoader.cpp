@@ -46,9 +46,10 @@ Distance_matrix_travel_time_provider<dist_t>* DistanceMatrixLoader::loadXDM() {
     }
 
     unsigned int nodes;
-    parseHeader(input, nodes);
+    DistanceMatrixLayout layout;
+    parseHeader(input, nodes, layout);
 
-    Distance_matrix_travel_time_provider<dist_t>* distanceMatrix = new Distance_matrix_travel_time_provider<dist_t>(nodes);
+    Distance_matrix_travel_time_provider<dist_t>* distanceMatrix = new Distance_matrix_travel_time_provider<dist_t>(nodes, layout);
 
     parseDistances(input, nodes, *distanceMatrix);
 
@@ -65,32 +66,78 @@ DistanceMatrixInterface* DistanceMatrixLoader::loadHDF() {
     auto size = intType.getSize();
     H5::DataSpace space = dataset.getSpace();
 
-    hsize_t dimsf[2];
-    space.getSimpleExtentDims(dimsf, nullptr);
-    const auto nodes = dimsf[0];
+    // The upper triangle of a symmetric matrix is stored as a one-dimensional dataset with the 'nodes' attribute.
+    DistanceMatrixLayout layout = DistanceMatrixLayout::FULL;
+    unsigned int nodes;
+    if (space.getSimpleExtentNdims() == 1) {
+        layout = DistanceMatrixLayout::UPPER_TRIANGULAR;
+        dataset.openAttribute("nodes").read(H5::PredType::NATIVE_UINT, &nodes);
+    } else {
+        hsize_t dimsf[2];
+        space.getSimpleExtentDims(dimsf, nullptr);
+        nodes = boost::numeric_cast<unsigned int>(dimsf[0]);
+    }
 
     if (size <= 2) {
-        auto dm = new Distance_matrix_travel_time_provider<uint_least16_t>(boost::numeric_cast<unsigned int>(nodes));
+        auto dm = new Distance_matrix_travel_time_provider<uint_least16_t>(nodes, layout);
         dataset.read(dm->getRawData().get(), H5::PredType::NATIVE_UINT_LEAST16);
         return dm;
     } else if (size <= 4) {
-        auto dm = new Distance_matrix_travel_time_provider<uint_least32_t>(boost::numeric_cast<unsigned int>(nodes));
+        auto dm = new Distance_matrix_travel_time_provider<uint_least32_t>(nodes, layout);
         dataset.read(dm->getRawData().get(), H5::PredType::NATIVE_UINT_LEAST32);
         return dm;
     } else {
-        auto dm = new Distance_matrix_travel_time_provider<dist_t>(boost::numeric_cast<unsigned int>(nodes));
+        auto dm = new Distance_matrix_travel_time_provider<dist_t>(nodes, layout);
         dataset.read(dm->getRawData().get(), H5::PredType::NATIVE_UINT);
         return dm;
     }
 }
 
 //______________________________________________________________________________________________________________________
-void DistanceMatrixLoader::parseHeader(std::ifstream & input, unsigned int & nodes) {
+DistanceMatrixCompressedProvider* DistanceMatrixLoader::loadCDM() {
+    std::ifstream input;
+    input.open(this->inputFile, std::ios::binary);
+    if( ! input.is_open() ) {
+        throw std::runtime_error("Couldn't open file '" + this->inputFile + "'!");
+    }
+
+    return DistanceMatrixCompressedProvider::read(input).release();
+}
+
+//______________________________________________________________________________________________________________________
+DistanceMatrixPagedInterface* DistanceMatrixLoader::loadXDMPaged(const unsigned int rowsPerBlock, const unsigned int cachedBlocks) {
+    return new DistanceMatrixPagedProvider<dist_t>(
+        std::make_unique<DistanceMatrixXdmRowSource<dist_t>>(this->inputFile), rowsPerBlock, cachedBlocks);
+}
+
+//______________________________________________________________________________________________________________________
+DistanceMatrixPagedInterface* DistanceMatrixLoader::loadHDFPaged(const unsigned int rowsPerBlock, const unsigned int cachedBlocks) {
+    size_t size;
+    {
+        H5::H5File file{this->inputFile, H5F_ACC_RDONLY};
+        size = file.openDataSet("dm").getIntType().getSize();
+    }
+
+    if (size <= 2) {
+        return new DistanceMatrixPagedProvider<uint_least16_t>(
+            std::make_unique<DistanceMatrixHdfRowSource<uint_least16_t>>(this->inputFile), rowsPerBlock, cachedBlocks);
+    } else if (size <= 4) {
+        return new DistanceMatrixPagedProvider<uint_least32_t>(
+            std::make_unique<DistanceMatrixHdfRowSource<uint_least32_t>>(this->inputFile), rowsPerBlock, cachedBlocks);
+    } else {
+        return new DistanceMatrixPagedProvider<dist_t>(
+            std::make_unique<DistanceMatrixHdfRowSource<dist_t>>(this->inputFile), rowsPerBlock, cachedBlocks);
+    }
+}
+
+//______________________________________________________________________________________________________________________
+void DistanceMatrixLoader::parseHeader(std::ifstream & input, unsigned int & nodes, DistanceMatrixLayout & layout) {
     char c1, c2, c3;
     input.read(&c1, sizeof(c1));
     input.read(&c2, sizeof(c2));
     input.read(&c3, sizeof(c3));
-    if (c1 != 'X' || c2 != 'D' || c3 != 'M') {
+    layout = c3 == 'S' ? DistanceMatrixLayout::UPPER_TRIANGULAR : DistanceMatrixLayout::FULL;
+    if (c1 != 'X' || c2 != 'D' || (c3 != 'M' && c3 != 'S')) {
         printf("The input file is missing the Distance Matrix header.\n");
         printf("Are you sure the input file is in the correct format?\n");
         printf("The loading will proceed but the loaded distance matrix might be corrupted.\n");
@@ -101,6 +148,12 @@ void DistanceMatrixLoader::parseHeader(std::ifstream & input, unsigned int & nod
 
 //______________________________________________________________________________________________________________________
 void DistanceMatrixLoader::parseDistances(std::ifstream & input, const unsigned int nodes, Distance_matrix_travel_time_provider<dist_t>& distanceMatrix) {
+    if (distanceMatrix.getLayout() == DistanceMatrixLayout::UPPER_TRIANGULAR) {
+        input.read(reinterpret_cast<char*>(distanceMatrix.getRawData().get()),
+                   static_cast<std::streamsize>(distanceMatrix.entries() * sizeof(dist_t)));
+        return;
+    }
+
     unsigned int distance;
     for(unsigned int i = 0; i < nodes; i++) {
         for(unsigned int j = 0; j < nodes; j++) {
@@ -31,6 +31,8 @@
 
 #include <string>
 #include "../../DistanceMatrix/Distance_matrix_travel_time_provider.h"
+#include "../../DistanceMatrix/DistanceMatrixPagedProvider.h"
+#include "../../DistanceMatrix/DistanceMatrixCompressedProvider.h"
 
 
 
@@ -61,14 +63,43 @@ public:
      */
     DistanceMatrixInterface* loadHDF();
 
+    /**
+     * Loads the compressed distance matrix (see 'DistanceMatrixCompressedProvider.h') from the file that was given
+     * to the loader during its initialization.
+     *
+     * @return An instance of the compressed distance matrix.
+     */
+    DistanceMatrixCompressedProvider* loadCDM();
+
+    /**
+     * Opens the XDM distance matrix without loading it into memory. The rows are loaded on demand in blocks
+     * (see 'DistanceMatrixPagedProvider.h').
+     *
+     * @param rowsPerBlock[in] The number of consecutive rows loaded at once.
+     * @param cachedBlocks[in] The maximum number of blocks kept in memory.
+     * @return An instance of the paged distance matrix backed by the file.
+     */
+    DistanceMatrixPagedInterface* loadXDMPaged(unsigned int rowsPerBlock, unsigned int cachedBlocks);
+
+    /**
+     * Opens the HDF5 distance matrix without loading it into memory. The rows are loaded on demand in blocks
+     * (see 'DistanceMatrixPagedProvider.h').
+     *
+     * @param rowsPerBlock[in] The number of consecutive rows loaded at once.
+     * @param cachedBlocks[in] The maximum number of blocks kept in memory.
+     * @return An instance of the paged distance matrix backed by the file.
+     */
+    DistanceMatrixPagedInterface* loadHDFPaged(unsigned int rowsPerBlock, unsigned int cachedBlocks);
+
 private:
     /**
      * Auxiliary function used to parse the header (the first line) of the input ifle.
      *
      * @param input[in] The input stream corresponding to the input file.
      * @param nodes[out] The number of nodes in the graph.
+     * @param layout[out] The layout of the distances, the header "XDS" marks the upper triangle of a symmetric matrix.
      */
-    void parseHeader(std::ifstream & input, unsigned int & nodes);
+    void parseHeader(std::ifstream & input, unsigned int & nodes, DistanceMatrixLayout & layout);
 
     /**
      * Auxiliary function used to load the distances into the distance matrix.
@@ -0,0 +1,109 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Czech Technical University in Prague
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. */
+
+/******************************************************************************
+* File:             NodeMappingLoader.cpp
+*****************************************************************************/
+
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "NodeMappingLoader.h"
+
+//______________________________________________________________________________________________________________________
+NodeMappingLoader::NodeMappingLoader(std::string inputFile) : inputFile(std::move(inputFile)) {}
+
+//______________________________________________________________________________________________________________________
+NodeMapping NodeMappingLoader::loadMapping() {
+    std::ifstream input(inputFile, std::ios::binary);
+    if (!input.is_open()) {
+        throw std::runtime_error("Couldn't open the mapping file '" + inputFile + "'.");
+    }
+
+    char header[4] = {};
+    input.read(header, sizeof(header));
+    input.clear();
+    input.seekg(0, std::ios::beg);
+    if (header[0] == 'X' && header[1] == 'I' && header[2] == 'D' && header[3] == 'B') {
+        return NodeMapping::read(input);
+    }
+
+    std::ostringstream content;
+    content << input.rdbuf();
+    return parseText(content.str());
+}
+
+//______________________________________________________________________________________________________________________
+NodeMapping NodeMappingLoader::loadMapping(const unsigned int structureNodes) {
+    NodeMapping mapping = loadMapping();
+    if (mapping.nodes() > structureNodes) {
+        throw std::runtime_error("The mapping file '" + inputFile + "' contains " + std::to_string(mapping.nodes())
+            + " nodes, but the structure only has " + std::to_string(structureNodes) + " nodes. A structure "
+            "preprocessed with '--simplify' needs its '.simp' file next to it.");
+    }
+    return mapping;
+}
+
+//______________________________________________________________________________________________________________________
+NodeMapping NodeMappingLoader::parseText(const std::string& content) {
+    const char* current = content.data();
+    const char* end = content.data() + content.size();
+    auto skipWhitespace = [&]() {
+        while (current != end && std::isspace(static_cast<unsigned char>(*current))) {
+            ++current;
+        }
+    };
+
+    skipWhitespace();
+    if (end - current < 3 || current[0] != 'X' || current[1] != 'I' || current[2] != 'D') {
+        std::cout
+            << "The input file is missing the XenGraph indices file header." << std::endl
+            << "Are you sure the input file is in the correct format?" << std::endl
+            << "The loading will proceed but the mapping might be corrupted."
+            << std::endl;
+    }
+    current = std::min(current + 3, end);
+
+    unsigned int nodes = 0;
+    skipWhitespace();
+    current = std::from_chars(current, end, nodes).ptr;
+
+    std::vector<long long unsigned int> originalIDs(nodes);
+    for (unsigned int i = 0; i < nodes; i++) {
+        skipWhitespace();
+        auto [next, error] = std::from_chars(current, end, originalIDs[i]);
+        if (error != std::errc()) {
+            throw std::runtime_error("The mapping file '" + inputFile + "' contains only " + std::to_string(i)
+                + " of the " + std::to_string(nodes) + " node IDs.");
+        }
+        current = next;
+    }
+
+    return NodeMapping(std::move(originalIDs));
+}
@@ -0,0 +1,81 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Czech Technical University in Prague
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. */
+
+/******************************************************************************
+* File:             NodeMappingLoader.h
+*
+* Description:      Loader of the node mapping files in the text and the binary format
+*****************************************************************************/
+
+#ifndef SHORTEST_PATHS_NODEMAPPINGLOADER_H
+#define SHORTEST_PATHS_NODEMAPPINGLOADER_H
+
+#include <string>
+#include "../Structures/NodeMapping.h"
+
+/**
+ * Loads the mapping from the original node IDs to the IDs used by the query algorithms. Both the text XenGraph
+ * indices format (described in the README.md of this project, usually with the '.xeni' extension) and the binary
+ * format created by the preprocessor (usually with the '.xidb' extension, see 'NodeMapping::write') are supported,
+ * the format is detected from the header of the file.
+ */
+class NodeMappingLoader {
+public:
+    /**
+     * A simple constructor.
+     *
+     * @param inputFile[in] A path towards the mapping file that should be loaded using this loader.
+     */
+    explicit NodeMappingLoader(std::string inputFile);
+
+    /**
+     * Loads the mapping from the file.
+     *
+     * @return The loaded mapping.
+     */
+    NodeMapping loadMapping();
+
+    /**
+     * Loads the mapping of the nodes of a structure. The mapping must not contain more nodes than the structure,
+     * this happens when a structure preprocessed with '--simplify' is used without its simplification table.
+     *
+     * @param structureNodes[in] The number of nodes the IDs of the structure refer to (the number of nodes of the
+     * graph before the simplification if the structure is used with its simplification table).
+     * @return The loaded mapping. Throws std::runtime_error if the mapping contains more nodes than the structure.
+     */
+    NodeMapping loadMapping(unsigned int structureNodes);
+
+private:
+    /**
+     * Auxiliary function used to parse the text format, the whole file is parsed at once without using streams.
+     *
+     * @param content[in] The content of the file.
+     * @return The parsed mapping.
+     */
+    NodeMapping parseText(const std::string& content);
+
+    std::string inputFile;
+};
+
+
+#endif //SHORTEST_PATHS_NODEMAPPINGLOADER_H
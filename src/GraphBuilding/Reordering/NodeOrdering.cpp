@@ -0,0 +1,192 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Czech Technical University in Prague
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. */
+
+/******************************************************************************
+* File:             NodeOrdering.cpp
+*****************************************************************************/
+
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <tuple>
+#include "NodeOrdering.h"
+#include "../../CCH/NestedDissection.h"
+#include "../../Error/Error.h"
+
+//______________________________________________________________________________________________________________________
+NodeOrdering::Type NodeOrdering::parse(const std::string& name) {
+    if (name == "bfs") {
+        return Type::BFS;
+    }
+    if (name == "hilbert") {
+        return Type::HILBERT;
+    }
+    if (name == "partition") {
+        return Type::PARTITION;
+    }
+    throw input_error("Unknown node ordering '" + name + "', expected 'bfs', 'hilbert' or 'partition'.\n");
+}
+
+//______________________________________________________________________________________________________________________
+std::vector<unsigned int> NodeOrdering::breadthFirst(const SimpleGraph& graph) {
+    const unsigned int nodes = graph.nodes();
+
+    std::vector<std::vector<unsigned int>> adjacency(nodes);
+    for (unsigned int from = 0; from < nodes; from++) {
+        for (const auto& edge : graph.edges(from)) {
+            if (edge.first != from) {
+                adjacency[from].push_back(edge.first);
+                adjacency[edge.first].push_back(from);
+            }
+        }
+    }
+
+    std::vector<unsigned int> firstNeighbour(nodes + 1, 0);
+    std::vector<unsigned int> neighbours;
+    for (unsigned int node = 0; node < nodes; node++) {
+        std::sort(adjacency[node].begin(), adjacency[node].end());
+        adjacency[node].erase(std::unique(adjacency[node].begin(), adjacency[node].end()), adjacency[node].end());
+        neighbours.insert(neighbours.end(), adjacency[node].begin(), adjacency[node].end());
+        firstNeighbour[node + 1] = static_cast<unsigned int>(neighbours.size());
+        adjacency[node] = {};
+    }
+    const auto degree = [&](unsigned int node) {
+        return firstNeighbour[node + 1] - firstNeighbour[node];
+    };
+
+    std::vector<unsigned int> newIDs(nodes, UINT_MAX);
+    std::vector<unsigned int> component(nodes, UINT_MAX);
+    std::vector<unsigned int> queue;
+    std::vector<unsigned int> candidates;
+    unsigned int nextID = 0;
+    for (unsigned int root = 0; root < nodes; root++) {
+        if (newIDs[root] != UINT_MAX) {
+            continue;
+        }
+
+        // A search from any node of the component, the node with the lowest degree in its last level is far from
+        // the rest of the component (pseudo-peripheral), so the levels of the final search are narrow.
+        queue.assign(1, root);
+        component[root] = root;
+        size_t levelBegin = 0;
+        size_t levelEnd = 1;
+        for (size_t i = 0; i < queue.size();) {
+            levelBegin = i;
+            levelEnd = queue.size();
+            for (; i < levelEnd; i++) {
+                for (unsigned int j = firstNeighbour[queue[i]]; j < firstNeighbour[queue[i] + 1]; j++) {
+                    if (component[neighbours[j]] != root) {
+                        component[neighbours[j]] = root;
+                        queue.push_back(neighbours[j]);
+                    }
+                }
+            }
+        }
+        const unsigned int start = *std::min_element(queue.begin() + levelBegin, queue.begin() + levelEnd,
+            [&](unsigned int a, unsigned int b) { return degree(a) < degree(b); });
+
+        queue.assign(1, start);
+        newIDs[start] = nextID++;
+        for (size_t i = 0; i < queue.size(); i++) {
+            candidates.clear();
+            for (unsigned int j = firstNeighbour[queue[i]]; j < firstNeighbour[queue[i] + 1]; j++) {
+                if (newIDs[neighbours[j]] == UINT_MAX) {
+                    candidates.push_back(neighbours[j]);
+                }
+            }
+            std::sort(candidates.begin(), candidates.end(), [&](unsigned int a, unsigned int b) {
+                return std::make_tuple(degree(a), a) < std::make_tuple(degree(b), b);
+            });
+            for (const unsigned int candidate : candidates) {
+                newIDs[candidate] = nextID++;
+                queue.push_back(candidate);
+            }
+        }
+    }
+
+    return newIDs;
+}
+
+//______________________________________________________________________________________________________________________
+std::vector<unsigned int> NodeOrdering::hilbert(const std::vector<std::pair<double, double>>& locations) {
+    const auto nodes = static_cast<unsigned int>(locations.size());
+    if (nodes == 0) {
+        return {};
+    }
+
+    double minX = locations[0].first;
+    double maxX = locations[0].first;
+    double minY = locations[0].second;
+    double maxY = locations[0].second;
+    for (const auto& location : locations) {
+        minX = std::min(minX, location.first);
+        maxX = std::max(maxX, location.first);
+        minY = std::min(minY, location.second);
+        maxY = std::max(maxY, location.second);
+    }
+
+    // Both axes are scaled by the same factor, so the cells of the grid are squares.
+    const double cells = static_cast<double>((1u << HILBERT_BITS) - 1);
+    const double extent = std::max(maxX - minX, maxY - minY);
+    const double scale = extent > 0 ? cells / extent : 0;
+
+    std::vector<std::pair<unsigned long long, unsigned int>> positions(nodes);
+    for (unsigned int node = 0; node < nodes; node++) {
+        const auto x = static_cast<unsigned int>(std::lround((locations[node].first - minX) * scale));
+        const auto y = static_cast<unsigned int>(std::lround((locations[node].second - minY) * scale));
+        positions[node] = {hilbertIndex(x, y), node};
+    }
+    std::sort(positions.begin(), positions.end());
+
+    std::vector<unsigned int> newIDs(nodes);
+    for (unsigned int i = 0; i < nodes; i++) {
+        newIDs[positions[i].second] = i;
+    }
+    return newIDs;
+}
+
+//______________________________________________________________________________________________________________________
+std::vector<unsigned int> NodeOrdering::partition(const SimpleGraph& graph) {
+    return NestedDissection::computeRanks(graph);
+}
+
+//______________________________________________________________________________________________________________________
+unsigned long long NodeOrdering::hilbertIndex(unsigned int x, unsigned int y) {
+    constexpr unsigned int side = 1u << HILBERT_BITS;
+    unsigned long long index = 0;
+    for (unsigned int cell = side / 2; cell > 0; cell /= 2) {
+        const unsigned int right = (x & cell) > 0 ? 1 : 0;
+        const unsigned int up = (y & cell) > 0 ? 1 : 0;
+        index += static_cast<unsigned long long>(cell) * cell * ((3 * right) ^ up);
+
+        // Rotates the quadrant, so that the curve inside it starts and ends at the right corners.
+        if (up == 0) {
+            if (right == 1) {
+                x = side - 1 - x;
+                y = side - 1 - y;
+            }
+            std::swap(x, y);
+        }
+    }
+    return index;
+}
@@ -0,0 +1,108 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Czech Technical University in Prague
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. */
+
+/******************************************************************************
+* File:             NodeOrdering.h
+*
+* Description:      Orderings of the nodes that improve the memory locality
+*                   of the graph structures
+*****************************************************************************/
+
+#ifndef SHORTEST_PATHS_NODEORDERING_H
+#define SHORTEST_PATHS_NODEORDERING_H
+
+#include <string>
+#include <utility>
+#include <vector>
+#include "../Structures/SimpleGraph.h"
+
+/**
+ * Computes orderings of the nodes in which the nodes that are close to each other in the graph get close IDs. Every
+ * structure built by the library stores the data of a node at the index given by its ID, so with such an ordering the
+ * nodes visited by one search are stored close to each other in the memory. The input files usually number the nodes
+ * in the order in which they were exported from the map data, which is close to a random order for large graphs.
+ *
+ * Every function returns the new IDs of the nodes, 'newIDs[i]' is the new ID of the node with the ID 'i'.
+ */
+class NodeOrdering {
+public:
+    /**
+     * The available orderings.
+     */
+    enum class Type {
+        BFS,
+        HILBERT,
+        PARTITION
+    };
+
+    /**
+     * Parses the name of an ordering as used on the command line ('bfs', 'hilbert' or 'partition').
+     *
+     * @param name[in] The name of the ordering.
+     * @return The ordering.
+     */
+    static Type parse(const std::string& name);
+
+    /**
+     * The Cuthill-McKee ordering: a breadth-first search from a pseudo-peripheral node of every connected component,
+     * the neighbours of a node are numbered in the increasing order of their degrees.
+     *
+     * @param graph[in] The graph, both the edge directions and the weights are ignored.
+     * @return The new IDs of the nodes.
+     */
+    static std::vector<unsigned int> breadthFirst(const SimpleGraph& graph);
+
+    /**
+     * Orders the nodes along a Hilbert curve over the bounding box of their locations.
+     *
+     * @param locations[in] The locations of the nodes, the coordinates can be in any projection.
+     * @return The new IDs of the nodes.
+     */
+    static std::vector<unsigned int> hilbert(const std::vector<std::pair<double, double>>& locations);
+
+    /**
+     * Orders the nodes by the nested dissection used by the Customizable Contraction Hierarchies, so every part of
+     * the recursive partition gets a contiguous range of IDs and the separators get the highest IDs of their part.
+     *
+     * @param graph[in] The graph, both the edge directions and the weights are ignored.
+     * @return The new IDs of the nodes.
+     */
+    static std::vector<unsigned int> partition(const SimpleGraph& graph);
+
+private:
+    /**
+     * The number of the cells of the Hilbert curve grid along one axis is 2^HILBERT_BITS.
+     */
+    static constexpr unsigned int HILBERT_BITS = 16;
+
+    /**
+     * Computes the position of a cell of the grid on the Hilbert curve.
+     *
+     * @param x[in] The column of the cell.
+     * @param y[in] The row of the cell.
+     * @return The position of the cell on the curve.
+     */
+    static unsigned long long hilbertIndex(unsigned int x, unsigned int y);
+};
+
+#endif //SHORTEST_PATHS_NODEORDERING_H
@@ -0,0 +1,114 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Czech Technical University in Prague
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. */
+
+/******************************************************************************
+* File:             ReorderedGraphLoader.cpp
+*****************************************************************************/
+
+#include <stdexcept>
+#include "ReorderedGraphLoader.h"
+#include "../Loaders/CsvGraphLoader.h"
+#include "../Structures/SimpleGraph.h"
+#include "../../Error/Error.h"
+
+namespace {
+    /**
+     * Passes the edges to the target graph with the renamed endpoints.
+     */
+    class RenamingGraph : public BaseGraph {
+    public:
+        RenamingGraph(BaseGraph& graph, const std::vector<unsigned int>& newIDs) : graph(graph), newIDs(newIDs) {
+        }
+
+        bool addEdge(unsigned int from, unsigned int to, dist_t weight) override {
+            return graph.addEdge(newIDs[from], newIDs[to], weight);
+        }
+
+        unsigned int nodes() const override {
+            return graph.nodes();
+        }
+
+        bool handlesDuplicateEdges() override {
+            return graph.handlesDuplicateEdges();
+        }
+
+    private:
+        BaseGraph& graph;
+        const std::vector<unsigned int>& newIDs;
+    };
+}
+
+//______________________________________________________________________________________________________________________
+ReorderedGraphLoader::ReorderedGraphLoader(GraphLoader& loader, NodeOrdering::Type ordering) :
+        loader(loader), nodesCnt(loader.nodes()) {
+    if (ordering == NodeOrdering::Type::HILBERT) {
+        auto* csvLoader = dynamic_cast<CsvGraphLoader*>(&loader);
+        if (csvLoader == nullptr) {
+            throw input_error("The Hilbert curve ordering needs the locations of the nodes, which are only available "
+                              "in the csv input format.\n");
+        }
+        std::vector<std::pair<double, double>> locations(nodesCnt);
+        csvLoader->loadLocations(locations);
+        permutation = NodeOrdering::hilbert(locations);
+        return;
+    }
+
+    SimpleGraph graph(nodesCnt);
+    loader.loadGraph(graph, 1);
+    permutation = ordering == NodeOrdering::Type::BFS ? NodeOrdering::breadthFirst(graph)
+                                                      : NodeOrdering::partition(graph);
+}
+
+//______________________________________________________________________________________________________________________
+void ReorderedGraphLoader::loadGraph(BaseGraph& graph, int scaling_factor) {
+    if (graph.nodes() != nodesCnt) {
+        throw std::runtime_error("The graph has " + std::to_string(graph.nodes()) + " nodes, but the reordered graph has "
+                                 + std::to_string(nodesCnt) + " nodes.");
+    }
+    RenamingGraph renamingGraph(graph, permutation);
+    loader.loadGraph(renamingGraph, scaling_factor);
+}
+
+//______________________________________________________________________________________________________________________
+unsigned int ReorderedGraphLoader::nodes() {
+    return nodesCnt;
+}
+
+//______________________________________________________________________________________________________________________
+const std::vector<unsigned int>& ReorderedGraphLoader::newIDs() const {
+    return permutation;
+}
+
+//______________________________________________________________________________________________________________________
+NodeMapping ReorderedGraphLoader::composeMapping(const NodeMapping* mapping) const {
+    if (mapping != nullptr && mapping->nodes() != nodesCnt) {
+        throw input_error("The mapping contains " + std::to_string(mapping->nodes()) + " nodes, but the graph has "
+                          + std::to_string(nodesCnt) + " nodes.\n");
+    }
+
+    std::vector<long long unsigned int> originalIDs(nodesCnt);
+    for (unsigned int node = 0; node < nodesCnt; node++) {
+        originalIDs[permutation[node]] = mapping != nullptr ? mapping->originalID(node) : node;
+    }
+    return NodeMapping(std::move(originalIDs));
+}
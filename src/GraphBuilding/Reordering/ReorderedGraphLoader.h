@@ -0,0 +1,92 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Czech Technical University in Prague
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. */
+
+/******************************************************************************
+* File:             ReorderedGraphLoader.h
+*
+* Description:      Loads a graph with the nodes renumbered by a locality
+*                   improving ordering
+*****************************************************************************/
+
+#ifndef SHORTEST_PATHS_REORDEREDGRAPHLOADER_H
+#define SHORTEST_PATHS_REORDEREDGRAPHLOADER_H
+
+#include <vector>
+#include "../Loaders/GraphLoader.h"
+#include "../Structures/NodeMapping.h"
+#include "NodeOrdering.h"
+
+/**
+ * Renumbers the nodes of a graph while it is being loaded, so that every structure built from the graph stores
+ * the nodes in an order with a better memory locality (see 'NodeOrdering'). The loader is a 'GraphLoader' itself,
+ * so it can be used in place of the loader of the input graph by any preprocessing method, the edges are renamed one
+ * by one as the input loader provides them.
+ *
+ * The queries then have to use the new IDs. 'composeMapping' creates a mapping from the IDs used by the application
+ * to the new IDs, so an application that already uses a mapping file does not have to change anything.
+ */
+class ReorderedGraphLoader : public GraphLoader {
+public:
+    /**
+     * Computes the ordering of the nodes of the input graph.
+     *
+     * @param loader[in] The loader of the input graph. The 'HILBERT' ordering needs the locations of the nodes, so it
+     * is only supported if the loader is a 'CsvGraphLoader'.
+     * @param ordering[in] The ordering of the nodes.
+     */
+    ReorderedGraphLoader(GraphLoader& loader, NodeOrdering::Type ordering);
+
+    /**
+     * Loads the input graph with the renumbered nodes.
+     *
+     * @param graph[in] The graph to load the edges into, it must have 'nodes()' nodes.
+     * @param scaling_factor[in] Each loaded weight is divided by this value.
+     */
+    void loadGraph(BaseGraph& graph, int scaling_factor) override;
+
+    /**
+     * @return The number of nodes of the graph, the renumbering does not change it.
+     */
+    unsigned int nodes() override;
+
+    /**
+     * @return The new IDs of the nodes, 'newIDs()[i]' is the new ID of the node with the ID 'i' in the input graph.
+     */
+    [[nodiscard]] const std::vector<unsigned int>& newIDs() const;
+
+    /**
+     * Composes the renumbering with a mapping of the original node IDs.
+     *
+     * @param mapping[in] The mapping from the original IDs to the IDs of the input graph, or a null pointer if
+     * the queries use the IDs of the input graph.
+     * @return The mapping from the original IDs (or the IDs of the input graph) to the new IDs.
+     */
+    [[nodiscard]] NodeMapping composeMapping(const NodeMapping* mapping) const;
+
+private:
+    GraphLoader& loader;
+    unsigned int nodesCnt;
+    std::vector<unsigned int> permutation;
+};
+
+#endif //SHORTEST_PATHS_REORDEREDGRAPHLOADER_H
@@ -0,0 +1,371 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Czech Technical University in Prague
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. */
+
+/******************************************************************************
+* File:             GraphSimplifier.cpp
+*****************************************************************************/
+
+#include <algorithm>
+#include <stdexcept>
+#include <tuple>
+#include "GraphSimplifier.h"
+
+namespace {
+    constexpr unsigned int NONE = SimplificationTable::NONE;
+
+    /**
+     * Collects the edges exactly as the loader provides them, including the parallel edges.
+     */
+    template<class Edge>
+    class EdgeCollector : public BaseGraph {
+    public:
+        explicit EdgeCollector(unsigned int n) : nodesCnt(n) {
+        }
+
+        bool addEdge(unsigned int from, unsigned int to, dist_t weight) override {
+            edges.push_back({from, to, weight});
+            return true;
+        }
+
+        unsigned int nodes() const override {
+            return nodesCnt;
+        }
+
+        bool handlesDuplicateEdges() override {
+            return true;
+        }
+
+        std::vector<Edge> edges;
+
+    private:
+        unsigned int nodesCnt;
+    };
+}
+
+//______________________________________________________________________________________________________________________
+GraphSimplifier::GraphSimplifier(GraphLoader& loader, int scaling_factor) : scalingFactor(scaling_factor) {
+    const unsigned int n = loader.nodes();
+    // Every chain position needs an index in the table, there are at most three positions per removed chain node.
+    if (3ull * n > SimplificationTable::INDEX_MASK) {
+        throw std::runtime_error("The graph is too large to be simplified.");
+    }
+
+    EdgeCollector<Edge> collector(n);
+    loader.loadGraph(collector, scaling_factor);
+    std::vector<Edge>& edges = collector.edges;
+    stats.nodes = n;
+    stats.edges = edges.size();
+
+    std::sort(edges.begin(), edges.end(), [](const Edge& first, const Edge& second) {
+        return std::tie(first.from, first.to, first.weight) < std::tie(second.from, second.to, second.weight);
+    });
+    size_t unique = 0;
+    for (const Edge& edge : edges) {
+        if (edge.from != edge.to && (unique == 0 || edges[unique - 1].from != edge.from || edges[unique - 1].to != edge.to)) {
+            edges[unique++] = edge;
+        }
+    }
+    edges.resize(unique);
+    stats.parallelEdges = stats.edges - edges.size();
+
+    simplificationTable.slots.assign(n, SimplificationTable::slot(SimplificationTable::CORE, 0));
+    kept.assign(n, false);
+    buildNeighbours(edges);
+    peelTrees();
+    collapseChains();
+    buildCore(edges);
+
+    neighbourOffsets = {};
+    neighbours = {};
+    degrees = {};
+    kept = {};
+    chainShortcuts = {};
+    shortcutChains = {};
+}
+
+//______________________________________________________________________________________________________________________
+void GraphSimplifier::loadGraph(BaseGraph& graph, int scaling_factor) {
+    if (scaling_factor != scalingFactor) {
+        throw std::runtime_error("The simplified graph can only be loaded with the precision loss it was created with.");
+    }
+    for (const Edge& edge : coreEdges) {
+        graph.addEdge(edge.from, edge.to, edge.weight);
+    }
+}
+
+//______________________________________________________________________________________________________________________
+unsigned int GraphSimplifier::nodes() {
+    return simplificationTable.coreNodes();
+}
+
+//______________________________________________________________________________________________________________________
+const SimplificationTable& GraphSimplifier::table() const {
+    return simplificationTable;
+}
+
+//______________________________________________________________________________________________________________________
+const GraphSimplifier::Statistics& GraphSimplifier::statistics() const {
+    return stats;
+}
+
+//______________________________________________________________________________________________________________________
+void GraphSimplifier::buildNeighbours(const std::vector<Edge>& edges) {
+    const unsigned int n = stats.nodes;
+    std::vector<std::pair<unsigned int, Neighbour>> entries;
+    entries.reserve(2 * edges.size());
+    for (const Edge& edge : edges) {
+        entries.push_back({edge.from, {edge.to, edge.weight, NONE}});
+        entries.push_back({edge.to, {edge.from, NONE, edge.weight}});
+    }
+    std::sort(entries.begin(), entries.end(), [](const auto& first, const auto& second) {
+        return std::tie(first.first, first.second.node) < std::tie(second.first, second.second.node);
+    });
+
+    neighbourOffsets.assign(n + 1, 0);
+    neighbours.clear();
+    neighbours.reserve(entries.size());
+    for (size_t i = 0; i < entries.size(); i++) {
+        const auto& [node, neighbour] = entries[i];
+        if (i > 0 && entries[i - 1].first == node && neighbours.back().node == neighbour.node) {
+            neighbours.back().out = std::min(neighbours.back().out, neighbour.out);
+            neighbours.back().in = std::min(neighbours.back().in, neighbour.in);
+        } else {
+            neighbours.push_back(neighbour);
+            neighbourOffsets[node + 1]++;
+        }
+    }
+
+    degrees.resize(n);
+    for (unsigned int i = 0; i < n; i++) {
+        degrees[i] = neighbourOffsets[i + 1];
+        neighbourOffsets[i + 1] += neighbourOffsets[i];
+    }
+}
+
+//______________________________________________________________________________________________________________________
+const GraphSimplifier::Neighbour& GraphSimplifier::findNeighbour(unsigned int node, unsigned int neighbour) const {
+    return *std::find_if(neighbours.begin() + neighbourOffsets[node], neighbours.begin() + neighbourOffsets[node + 1],
+                         [neighbour](const Neighbour& candidate) { return candidate.node == neighbour; });
+}
+
+//______________________________________________________________________________________________________________________
+void GraphSimplifier::peelTrees() {
+    std::vector<unsigned int>& slots = simplificationTable.slots;
+    std::vector<SimplificationTable::TreeNode>& trees = simplificationTable.trees;
+
+    std::vector<unsigned int> stack;
+    for (unsigned int i = 0; i < stats.nodes; i++) {
+        if (degrees[i] == 1) {
+            stack.push_back(i);
+        }
+    }
+
+    // A peeled node first only stores the edges to and from its parent.
+    while (!stack.empty()) {
+        const unsigned int node = stack.back();
+        stack.pop_back();
+        if (SimplificationTable::kind(slots[node]) != SimplificationTable::CORE || degrees[node] != 1) {
+            continue;
+        }
+
+        const Neighbour* parent = &neighbours[neighbourOffsets[node]];
+        while (SimplificationTable::kind(slots[parent->node]) == SimplificationTable::TREE) {
+            parent++;
+        }
+
+        slots[node] = SimplificationTable::slot(SimplificationTable::TREE, static_cast<unsigned int>(trees.size()));
+        trees.push_back({
+                parent->node,
+                parent->node,
+                1,
+                parent->out == NONE ? 0 : parent->out,
+                parent->out == NONE ? 1u : 0u,
+                parent->in == NONE ? 0 : parent->in,
+                parent->in == NONE ? 1u : 0u
+        });
+        degrees[node] = 0;
+        if (--degrees[parent->node] == 1) {
+            stack.push_back(parent->node);
+        }
+    }
+
+    // The nodes closer to the root were peeled later, so their distances are complete when they are needed.
+    for (size_t i = trees.size(); i-- > 0;) {
+        SimplificationTable::TreeNode& treeNode = trees[i];
+        const unsigned int parentSlot = slots[treeNode.parent];
+        if (SimplificationTable::kind(parentSlot) == SimplificationTable::TREE) {
+            const SimplificationTable::TreeNode& parent = trees[SimplificationTable::index(parentSlot)];
+            treeNode.root = parent.root;
+            treeNode.depth = parent.depth + 1;
+            treeNode.up += parent.up;
+            treeNode.upGaps += parent.upGaps;
+            treeNode.down += parent.down;
+            treeNode.downGaps += parent.downGaps;
+        }
+    }
+    stats.treeNodes = static_cast<unsigned int>(trees.size());
+}
+
+//______________________________________________________________________________________________________________________
+void GraphSimplifier::collapseChains() {
+    const std::vector<unsigned int>& slots = simplificationTable.slots;
+    auto chainNode = [&](unsigned int node) {
+        return SimplificationTable::kind(slots[node]) == SimplificationTable::CORE && degrees[node] == 2 && !kept[node];
+    };
+
+    for (unsigned int i = 0; i < stats.nodes; i++) {
+        if (SimplificationTable::kind(slots[i]) != SimplificationTable::CORE || degrees[i] == 2) {
+            continue;
+        }
+        for (unsigned int j = neighbourOffsets[i]; j < neighbourOffsets[i + 1]; j++) {
+            if (chainNode(neighbours[j].node)) {
+                collapseChain(i, neighbours[j].node);
+            }
+        }
+    }
+
+    // The remaining nodes with two neighbours form cycles, one node of each cycle is kept.
+    for (unsigned int i = 0; i < stats.nodes; i++) {
+        if (chainNode(i)) {
+            kept[i] = true;
+            unsigned int j = neighbourOffsets[i];
+            while (SimplificationTable::kind(slots[neighbours[j].node]) == SimplificationTable::TREE) {
+                j++;
+            }
+            collapseChain(i, neighbours[j].node);
+        }
+    }
+
+    stats.chains = simplificationTable.chains();
+    stats.chainNodes = simplificationTable.chainNodes();
+}
+
+//______________________________________________________________________________________________________________________
+void GraphSimplifier::collapseChain(unsigned int endpoint, unsigned int first) {
+    std::vector<unsigned int>& slots = simplificationTable.slots;
+    std::vector<SimplificationTable::ChainPosition>& positions = simplificationTable.positions;
+    const unsigned int chain = simplificationTable.chains();
+    const unsigned int firstPosition = static_cast<unsigned int>(positions.size());
+
+    // 'forward' is the weight of the edge from the previous position, 'backward' of the edge back to it.
+    auto append = [&](unsigned int node, dist_t forward, dist_t backward) {
+        SimplificationTable::ChainPosition position = positions.back();
+        position.node = node;
+        if (forward == NONE) {
+            position.forwardGaps++;
+        } else {
+            position.forward += forward;
+        }
+        if (backward == NONE) {
+            position.backwardGaps++;
+        } else {
+            position.backward += backward;
+        }
+        positions.push_back(position);
+    };
+
+    positions.push_back({endpoint, chain, 0, 0, 0, 0});
+    unsigned int previous = endpoint;
+    unsigned int current = first;
+    while (SimplificationTable::kind(slots[current]) == SimplificationTable::CORE && degrees[current] == 2
+           && !kept[current]) {
+        const Neighbour& link = findNeighbour(current, previous);
+        append(current, link.in, link.out);
+        slots[current] = SimplificationTable::slot(SimplificationTable::CHAIN,
+                                                   static_cast<unsigned int>(positions.size() - 1));
+
+        unsigned int next = neighbourOffsets[current];
+        while (neighbours[next].node == previous
+               || SimplificationTable::kind(slots[neighbours[next].node]) == SimplificationTable::TREE) {
+            next++;
+        }
+        previous = current;
+        current = neighbours[next].node;
+    }
+    const Neighbour& link = findNeighbour(previous, current);
+    append(current, link.out, link.in);
+    simplificationTable.chainRanges.push_back({firstPosition, static_cast<unsigned int>(positions.size() - 1)});
+
+    const SimplificationTable::ChainPosition& last = positions.back();
+    if (endpoint != current) {
+        if (last.forwardGaps == 0) {
+            chainShortcuts.push_back({endpoint, current, last.forward});
+            shortcutChains.push_back(chain);
+        }
+        if (last.backwardGaps == 0) {
+            chainShortcuts.push_back({current, endpoint, last.backward});
+            shortcutChains.push_back(chain);
+        }
+    }
+}
+
+//______________________________________________________________________________________________________________________
+void GraphSimplifier::buildCore(const std::vector<Edge>& edges) {
+    std::vector<unsigned int>& slots = simplificationTable.slots;
+    std::vector<unsigned int>& originalIDs = simplificationTable.originalIDs;
+    for (unsigned int i = 0; i < stats.nodes; i++) {
+        if (SimplificationTable::kind(slots[i]) == SimplificationTable::CORE) {
+            slots[i] = SimplificationTable::slot(SimplificationTable::CORE, static_cast<unsigned int>(originalIDs.size()));
+            originalIDs.push_back(i);
+        }
+    }
+
+    // The original edges between the core nodes and the chain shortcuts, with the chain or 'NONE'.
+    std::vector<std::pair<Edge, unsigned int>> candidates;
+    auto addCandidate = [&](const Edge& edge, unsigned int chain) {
+        const unsigned int fromSlot = slots[edge.from];
+        const unsigned int toSlot = slots[edge.to];
+        if (SimplificationTable::kind(fromSlot) == SimplificationTable::CORE
+            && SimplificationTable::kind(toSlot) == SimplificationTable::CORE) {
+            candidates.push_back({{SimplificationTable::index(fromSlot), SimplificationTable::index(toSlot), edge.weight}, chain});
+        }
+    };
+    for (const Edge& edge : edges) {
+        addCandidate(edge, NONE);
+    }
+    for (size_t i = 0; i < chainShortcuts.size(); i++) {
+        addCandidate(chainShortcuts[i], shortcutChains[i]);
+    }
+
+    // For equal weights, the original edge comes first, so the chain does not have to be unpacked ('NONE' is the
+    // largest value, so it can not be compared with the chains directly).
+    std::sort(candidates.begin(), candidates.end(), [](const auto& first, const auto& second) {
+        const unsigned int firstIsShortcut = first.second == NONE ? 0 : 1;
+        const unsigned int secondIsShortcut = second.second == NONE ? 0 : 1;
+        return std::tie(first.first.from, first.first.to, first.first.weight, firstIsShortcut, first.second)
+               < std::tie(second.first.from, second.first.to, second.first.weight, secondIsShortcut, second.second);
+    });
+    for (size_t i = 0; i < candidates.size(); i++) {
+        const auto& [edge, chain] = candidates[i];
+        if (i > 0 && candidates[i - 1].first.from == edge.from && candidates[i - 1].first.to == edge.to) {
+            continue;
+        }
+        coreEdges.push_back(edge);
+        if (chain != NONE) {
+            simplificationTable.shortcuts.push_back({edge.from, edge.to, chain});
+        }
+    }
+
+    stats.coreNodes = simplificationTable.coreNodes();
+    stats.coreEdges = coreEdges.size();
+}
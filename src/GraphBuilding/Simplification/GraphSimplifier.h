@@ -0,0 +1,149 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Czech Technical University in Prague
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. */
+
+/******************************************************************************
+* File:             GraphSimplifier.h
+*
+* Description:      Removal of dead-end trees, degree-2 chains and parallel
+*                   edges before the preprocessing
+*****************************************************************************/
+
+#ifndef SHORTEST_PATHS_GRAPHSIMPLIFIER_H
+#define SHORTEST_PATHS_GRAPHSIMPLIFIER_H
+
+#include <vector>
+#include "../../constants.h"
+#include "../Loaders/GraphLoader.h"
+#include "SimplificationTable.h"
+
+/**
+ * Simplifies a graph before the preprocessing, so that the preprocessing (and every structure it creates) only works
+ * with a smaller core graph. Road graphs converted from map data contain many nodes that only describe the geometry of
+ * the roads and many dead ends, in the Contraction Hierarchy they would all be contracted one by one. The simplification
+ * has three steps:
+ *
+ * 1. Parallel edges are removed, only the shortest edge between every pair of nodes is kept.
+ * 2. Dead-end trees are peeled: a node with a single neighbour (in either direction) is removed repeatedly, the node
+ *    it was connected to becomes the root of the tree.
+ * 3. Chains of the remaining nodes with exactly two neighbours are replaced by shortcuts between their endpoints.
+ *
+ * The removed nodes are described by a 'SimplificationTable', which answers the queries in the original graph
+ * using the queries in the core graph. The simplifier is itself a 'GraphLoader' of the core graph, so it can be used
+ * in place of the loader of the original graph by any preprocessing method.
+ */
+class GraphSimplifier : public GraphLoader {
+public:
+    /**
+     * The sizes of the original and the core graph.
+     */
+    struct Statistics {
+        unsigned int nodes = 0;
+        size_t edges = 0;
+        size_t parallelEdges = 0;
+        unsigned int coreNodes = 0;
+        size_t coreEdges = 0;
+        unsigned int treeNodes = 0;
+        unsigned int chainNodes = 0;
+        unsigned int chains = 0;
+    };
+
+    /**
+     * Loads the original graph and simplifies it.
+     *
+     * @param loader[in] The loader of the original graph.
+     * @param scaling_factor[in] Each loaded weight is divided by this value, the core graph can only be loaded with the
+     * same value.
+     */
+    GraphSimplifier(GraphLoader& loader, int scaling_factor);
+
+    /**
+     * Loads the core graph.
+     *
+     * @param graph[in] The graph to load the edges into, it must have 'nodes()' nodes.
+     * @param scaling_factor[in] Must be the value the original graph was loaded with, the weights of the chain
+     * shortcuts are sums of the already scaled weights.
+     */
+    void loadGraph(BaseGraph& graph, int scaling_factor) override;
+
+    /**
+     * @return The number of nodes of the core graph.
+     */
+    unsigned int nodes() override;
+
+    /**
+     * @return The table describing the removed nodes.
+     */
+    [[nodiscard]] const SimplificationTable& table() const;
+
+    /**
+     * @return The sizes of the original and the core graph.
+     */
+    [[nodiscard]] const Statistics& statistics() const;
+
+private:
+    /**
+     * An edge of the original or the core graph.
+     */
+    struct Edge {
+        unsigned int from;
+        unsigned int to;
+        dist_t weight;
+    };
+
+    /**
+     * A neighbour of a node in the original graph with the weights of the edges to and from it, 'NONE' if the edge
+     * is missing.
+     */
+    struct Neighbour {
+        unsigned int node;
+        dist_t out;
+        dist_t in;
+    };
+
+    void buildNeighbours(const std::vector<Edge>& edges);
+
+    [[nodiscard]] const Neighbour& findNeighbour(unsigned int node, unsigned int neighbour) const;
+
+    void peelTrees();
+
+    void collapseChains();
+
+    void collapseChain(unsigned int endpoint, unsigned int first);
+
+    void buildCore(const std::vector<Edge>& edges);
+
+    int scalingFactor;
+    std::vector<unsigned int> neighbourOffsets;
+    std::vector<Neighbour> neighbours;
+    // The number of neighbours that are not in a dead-end tree.
+    std::vector<unsigned int> degrees;
+    std::vector<bool> kept;
+    // The shortcuts of the chains (with original IDs) in the order of the chains.
+    std::vector<Edge> chainShortcuts;
+    std::vector<unsigned int> shortcutChains;
+    std::vector<Edge> coreEdges;
+    SimplificationTable simplificationTable;
+    Statistics stats;
+};
+
+#endif //SHORTEST_PATHS_GRAPHSIMPLIFIER_H
@@ -0,0 +1,382 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Czech Technical University in Prague
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. */
+
+/******************************************************************************
+* File:             SimplificationTable.cpp
+*****************************************************************************/
+
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include "SimplificationTable.h"
+
+namespace {
+    template<class T>
+    void writeArray(std::ostream& output, const std::vector<T>& values) {
+        output.write(reinterpret_cast<const char*>(values.data()), static_cast<std::streamsize>(values.size() * sizeof(T)));
+    }
+
+    template<class T>
+    void readArray(std::istream& input, std::vector<T>& values, unsigned int size) {
+        values.resize(size);
+        input.read(reinterpret_cast<char*>(values.data()), static_cast<std::streamsize>(values.size() * sizeof(T)));
+    }
+}
+
+//______________________________________________________________________________________________________________________
+unsigned int SimplificationTable::nodes() const {
+    return static_cast<unsigned int>(slots.size());
+}
+
+//______________________________________________________________________________________________________________________
+unsigned int SimplificationTable::coreNodes() const {
+    return static_cast<unsigned int>(originalIDs.size());
+}
+
+//______________________________________________________________________________________________________________________
+unsigned int SimplificationTable::coreID(const unsigned int node) const {
+    return kind(slots[node]) == CORE ? index(slots[node]) : NONE;
+}
+
+//______________________________________________________________________________________________________________________
+unsigned int SimplificationTable::originalID(const unsigned int coreNode) const {
+    return originalIDs[coreNode];
+}
+
+//______________________________________________________________________________________________________________________
+unsigned int SimplificationTable::treeNodes() const {
+    return static_cast<unsigned int>(trees.size());
+}
+
+//______________________________________________________________________________________________________________________
+unsigned int SimplificationTable::chainNodes() const {
+    // The endpoints of every chain are core nodes.
+    return static_cast<unsigned int>(positions.size() - 2 * chainRanges.size());
+}
+
+//______________________________________________________________________________________________________________________
+unsigned int SimplificationTable::chains() const {
+    return static_cast<unsigned int>(chainRanges.size());
+}
+
+//______________________________________________________________________________________________________________________
+size_t SimplificationTable::memoryUsage() const {
+    return slots.size() * sizeof(unsigned int) + originalIDs.size() * sizeof(unsigned int)
+            + trees.size() * sizeof(TreeNode) + positions.size() * sizeof(ChainPosition)
+            + chainRanges.size() * sizeof(Chain) + shortcuts.size() * sizeof(ChainShortcut);
+}
+
+//______________________________________________________________________________________________________________________
+void SimplificationTable::write(std::ostream& output) const {
+    static_assert(sizeof(TreeNode) == 7 * sizeof(unsigned int) && sizeof(ChainPosition) == 6 * sizeof(unsigned int)
+                  && sizeof(Chain) == 2 * sizeof(unsigned int) && sizeof(ChainShortcut) == 3 * sizeof(unsigned int),
+                  "The records are stored in the binary format as they are.");
+
+    const unsigned int counts[6] = {
+            nodes(),
+            coreNodes(),
+            static_cast<unsigned int>(trees.size()),
+            static_cast<unsigned int>(positions.size()),
+            static_cast<unsigned int>(chainRanges.size()),
+            static_cast<unsigned int>(shortcuts.size())
+    };
+
+    output.write("SIMP", 4);
+    output.write(reinterpret_cast<const char*>(counts), sizeof(counts));
+    writeArray(output, slots);
+    writeArray(output, originalIDs);
+    writeArray(output, trees);
+    writeArray(output, positions);
+    writeArray(output, chainRanges);
+    writeArray(output, shortcuts);
+}
+
+//______________________________________________________________________________________________________________________
+SimplificationTable SimplificationTable::read(std::istream& input) {
+    char header[4];
+    input.read(header, sizeof(header));
+    if (!input || header[0] != 'S' || header[1] != 'I' || header[2] != 'M' || header[3] != 'P') {
+        throw std::runtime_error("The input file is missing the simplification table header.");
+    }
+
+    unsigned int counts[6];
+    input.read(reinterpret_cast<char*>(counts), sizeof(counts));
+    const auto [nodesCnt, coreNodesCnt, treesCnt, positionsCnt, chainsCnt, shortcutsCnt] = counts;
+    if (!input || coreNodesCnt + treesCnt + positionsCnt - 2 * static_cast<size_t>(chainsCnt) != nodesCnt
+        || positionsCnt < 2 * static_cast<size_t>(chainsCnt) || nodesCnt > INDEX_MASK) {
+        throw std::runtime_error("The simplification table header is corrupted.");
+    }
+
+    SimplificationTable table;
+    readArray(input, table.slots, nodesCnt);
+    readArray(input, table.originalIDs, coreNodesCnt);
+    readArray(input, table.trees, treesCnt);
+    readArray(input, table.positions, positionsCnt);
+    readArray(input, table.chainRanges, chainsCnt);
+    readArray(input, table.shortcuts, shortcutsCnt);
+    if (!input) {
+        throw std::runtime_error("The simplification table file is truncated.");
+    }
+
+    const size_t sizes[3] = {coreNodesCnt, positionsCnt, treesCnt};
+    for (const unsigned int slot : table.slots) {
+        if (kind(slot) > TREE || index(slot) >= sizes[kind(slot)]) {
+            throw std::runtime_error("The simplification table is corrupted.");
+        }
+    }
+    for (const Chain& chain : table.chainRanges) {
+        if (chain.first >= chain.last || chain.last >= positionsCnt) {
+            throw std::runtime_error("The simplification table is corrupted.");
+        }
+    }
+
+    return table;
+}
+
+//______________________________________________________________________________________________________________________
+std::unique_ptr<SimplificationTable> SimplificationTable::loadForStructure(
+        const std::string& structureFile,
+        const unsigned int structureNodes) {
+    const std::filesystem::path tablePath = std::filesystem::path(structureFile).replace_extension(".simp");
+    std::ifstream input(tablePath, std::ios::binary);
+    if (!input.is_open()) {
+        return nullptr;
+    }
+
+    auto table = std::make_unique<SimplificationTable>(read(input));
+    if (table->coreNodes() != structureNodes) {
+        throw std::runtime_error("The simplification table '" + tablePath.string() + "' describes a core graph with "
+            + std::to_string(table->coreNodes()) + " nodes, but the structure '" + structureFile + "' has "
+            + std::to_string(structureNodes) + " nodes.");
+    }
+    return table;
+}
+
+//______________________________________________________________________________________________________________________
+unsigned int SimplificationTable::exits(unsigned int node, Exit* result) const {
+    dist_t up = 0;
+    dist_t down = 0;
+    if (kind(slots[node]) == TREE) {
+        const TreeNode& treeNode = trees[index(slots[node])];
+        up = treeNode.upGaps == 0 ? treeNode.up : NONE;
+        down = treeNode.downGaps == 0 ? treeNode.down : NONE;
+        node = treeNode.root;
+    }
+
+    if (kind(slots[node]) == CORE) {
+        result[0] = {index(slots[node]), NONE, up, down};
+        return 1;
+    }
+
+    const unsigned int position = index(slots[node]);
+    const Chain& chain = chainRanges[positions[position].chain];
+    unsigned int cnt = 0;
+    for (const unsigned int endpoint : {chain.first, chain.last}) {
+        result[cnt++] = {
+                index(slots[positions[endpoint].node]),
+                endpoint,
+                add(up, chainDistance(position, endpoint)),
+                add(chainDistance(endpoint, position), down)
+        };
+    }
+    return cnt;
+}
+
+//______________________________________________________________________________________________________________________
+std::pair<dist_t, unsigned int> SimplificationTable::localRoute(const unsigned int start, const unsigned int goal) const {
+    if (start == goal) {
+        return {0, start};
+    }
+
+    std::pair<dist_t, unsigned int> route(NONE, NONE);
+    const unsigned int startAnchor = anchor(start);
+    const unsigned int goalAnchor = anchor(goal);
+    if (kind(slots[start]) == TREE && kind(slots[goal]) == TREE && startAnchor == goalAnchor) {
+        unsigned int first = start;
+        unsigned int second = goal;
+        while (first != second) {
+            const unsigned int firstDepth = depth(first);
+            const unsigned int secondDepth = depth(second);
+            if (firstDepth >= secondDepth) {
+                first = trees[index(slots[first])].parent;
+            }
+            if (secondDepth >= firstDepth) {
+                second = trees[index(slots[second])].parent;
+            }
+        }
+        route = {add(treeDistanceUp(start, first), treeDistanceDown(first, goal)), first};
+    }
+
+    dist_t between = NONE;
+    if (startAnchor == goalAnchor) {
+        between = 0;
+    } else if (kind(slots[startAnchor]) == CHAIN && kind(slots[goalAnchor]) == CHAIN) {
+        const unsigned int startPosition = index(slots[startAnchor]);
+        const unsigned int goalPosition = index(slots[goalAnchor]);
+        if (positions[startPosition].chain == positions[goalPosition].chain) {
+            between = chainDistance(startPosition, goalPosition);
+        }
+    }
+    const dist_t distance = add(add(treeDistanceUp(start, startAnchor), between), treeDistanceDown(goalAnchor, goal));
+    if (distance < route.first) {
+        route = {distance, NONE};
+    }
+    return route;
+}
+
+//______________________________________________________________________________________________________________________
+unsigned int SimplificationTable::anchor(const unsigned int node) const {
+    return kind(slots[node]) == TREE ? trees[index(slots[node])].root : node;
+}
+
+//______________________________________________________________________________________________________________________
+unsigned int SimplificationTable::depth(const unsigned int node) const {
+    return kind(slots[node]) == TREE ? trees[index(slots[node])].depth : 0;
+}
+
+//______________________________________________________________________________________________________________________
+dist_t SimplificationTable::treeDistanceUp(const unsigned int node, const unsigned int ancestor) const {
+    if (node == ancestor) {
+        return 0;
+    }
+    const TreeNode& treeNode = trees[index(slots[node])];
+    if (kind(slots[ancestor]) != TREE) {
+        return treeNode.upGaps == 0 ? treeNode.up : NONE;
+    }
+    const TreeNode& ancestorNode = trees[index(slots[ancestor])];
+    return treeNode.upGaps == ancestorNode.upGaps ? treeNode.up - ancestorNode.up : NONE;
+}
+
+//______________________________________________________________________________________________________________________
+dist_t SimplificationTable::treeDistanceDown(const unsigned int ancestor, const unsigned int node) const {
+    if (node == ancestor) {
+        return 0;
+    }
+    const TreeNode& treeNode = trees[index(slots[node])];
+    if (kind(slots[ancestor]) != TREE) {
+        return treeNode.downGaps == 0 ? treeNode.down : NONE;
+    }
+    const TreeNode& ancestorNode = trees[index(slots[ancestor])];
+    return treeNode.downGaps == ancestorNode.downGaps ? treeNode.down - ancestorNode.down : NONE;
+}
+
+//______________________________________________________________________________________________________________________
+dist_t SimplificationTable::chainDistance(const unsigned int from, const unsigned int to) const {
+    const ChainPosition& fromPosition = positions[from];
+    const ChainPosition& toPosition = positions[to];
+    if (from <= to) {
+        return fromPosition.forwardGaps == toPosition.forwardGaps ? toPosition.forward - fromPosition.forward : NONE;
+    }
+    return fromPosition.backwardGaps == toPosition.backwardGaps ? fromPosition.backward - toPosition.backward : NONE;
+}
+
+//______________________________________________________________________________________________________________________
+void SimplificationTable::appendLocalPath(
+        const unsigned int start,
+        const unsigned int goal,
+        const unsigned int ancestor,
+        std::vector<SimpleEdge>& path) const {
+    if (ancestor != NONE) {
+        appendUpPath(start, ancestor, path);
+        appendDownPath(ancestor, goal, path);
+        return;
+    }
+
+    const unsigned int startAnchor = anchor(start);
+    const unsigned int goalAnchor = anchor(goal);
+    appendUpPath(start, startAnchor, path);
+    if (startAnchor != goalAnchor) {
+        appendChainPath(index(slots[startAnchor]), index(slots[goalAnchor]), path);
+    }
+    appendDownPath(goalAnchor, goal, path);
+}
+
+//______________________________________________________________________________________________________________________
+void SimplificationTable::appendExitPath(const unsigned int start, const Exit& exit, std::vector<SimpleEdge>& path) const {
+    const unsigned int startAnchor = anchor(start);
+    appendUpPath(start, startAnchor, path);
+    if (exit.position != NONE) {
+        appendChainPath(index(slots[startAnchor]), exit.position, path);
+    }
+}
+
+//______________________________________________________________________________________________________________________
+void SimplificationTable::appendEntryPath(const Exit& entry, const unsigned int goal, std::vector<SimpleEdge>& path) const {
+    const unsigned int goalAnchor = anchor(goal);
+    if (entry.position != NONE) {
+        appendChainPath(entry.position, index(slots[goalAnchor]), path);
+    }
+    appendDownPath(goalAnchor, goal, path);
+}
+
+//______________________________________________________________________________________________________________________
+void SimplificationTable::appendCoreEdge(const unsigned int from, const unsigned int to, std::vector<SimpleEdge>& path) const {
+    const auto shortcut = std::lower_bound(shortcuts.begin(), shortcuts.end(), std::make_pair(from, to),
+            [](const ChainShortcut& candidate, const std::pair<unsigned int, unsigned int>& key) {
+        return std::make_pair(candidate.from, candidate.to) < key;
+    });
+    if (shortcut == shortcuts.end() || shortcut->from != from || shortcut->to != to) {
+        path.emplace_back(originalIDs[from], originalIDs[to]);
+        return;
+    }
+
+    const Chain& chain = chainRanges[shortcut->chain];
+    if (positions[chain.first].node == originalIDs[from]) {
+        appendChainPath(chain.first, chain.last, path);
+    } else {
+        appendChainPath(chain.last, chain.first, path);
+    }
+}
+
+//______________________________________________________________________________________________________________________
+void SimplificationTable::appendUpPath(unsigned int node, const unsigned int ancestor, std::vector<SimpleEdge>& path) const {
+    while (node != ancestor) {
+        const unsigned int parent = trees[index(slots[node])].parent;
+        path.emplace_back(node, parent);
+        node = parent;
+    }
+}
+
+//______________________________________________________________________________________________________________________
+void SimplificationTable::appendDownPath(const unsigned int ancestor, unsigned int node, std::vector<SimpleEdge>& path) const {
+    const size_t begin = path.size();
+    while (node != ancestor) {
+        const unsigned int parent = trees[index(slots[node])].parent;
+        path.emplace_back(parent, node);
+        node = parent;
+    }
+    std::reverse(path.begin() + static_cast<std::ptrdiff_t>(begin), path.end());
+}
+
+//______________________________________________________________________________________________________________________
+void SimplificationTable::appendChainPath(unsigned int from, const unsigned int to, std::vector<SimpleEdge>& path) const {
+    while (from < to) {
+        path.emplace_back(positions[from].node, positions[from + 1].node);
+        from++;
+    }
+    while (from > to) {
+        path.emplace_back(positions[from].node, positions[from - 1].node);
+        from--;
+    }
+}
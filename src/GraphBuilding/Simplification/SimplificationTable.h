@@ -0,0 +1,378 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Czech Technical University in Prague
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. */
+
+/******************************************************************************
+* File:             SimplificationTable.h
+*
+* Description:      Reconstruction of the distances and paths of the nodes
+*                   removed by the graph simplification
+*****************************************************************************/
+
+#ifndef SHORTEST_PATHS_SIMPLIFICATIONTABLE_H
+#define SHORTEST_PATHS_SIMPLIFICATIONTABLE_H
+
+#include <algorithm>
+#include <climits>
+#include <istream>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+#include "../../constants.h"
+#include "../Structures/SimpleEdge.h"
+
+class GraphSimplifier;
+
+/**
+ * Describes how the nodes of a graph relate to the smaller core graph created by 'GraphSimplifier', so that distance
+ * and path queries between any nodes of the original graph can be answered exactly using only queries in the core
+ * graph.
+ *
+ * Every node of the original graph is either a core node, a node of a dead-end tree or an inner node of a chain.
+ * A dead-end tree hangs on a single node (its root), which is either a core node or a chain node, and every tree node
+ * stores its parent and its distances to and from the root. A chain is a path of nodes with exactly two neighbours
+ * between two core nodes (its endpoints, which can be the same node), every position of a chain stores the distances
+ * from the first endpoint along the chain in both directions. Missing (one-way) edges are counted separately as gaps,
+ * so the distance between any two nodes of a chain or between a tree node and its ancestor is a difference of two
+ * prefix sums. The core graph contains a shortcut between the two endpoints of every chain, the shortcuts that are
+ * shorter than any other edge between the endpoints are kept, so that the paths using them can be unpacked.
+ *
+ * The table is read-only, any number of threads can use one instance.
+ */
+class SimplificationTable {
+public:
+    /**
+     * The value used for the unknown nodes and the missing distances.
+     */
+    static constexpr unsigned int NONE = UINT_MAX;
+
+    SimplificationTable() = default;
+
+    /**
+     * Returns the shortest distance between two nodes of the original graph.
+     *
+     * @param start[in] The start node (an ID in the original graph).
+     * @param goal[in] The goal node (an ID in the original graph).
+     * @param coreDistance[in] A function returning the shortest distance between two core nodes (IDs in the core graph)
+     * or 'UINT_MAX' if there is no path. It is called at most four times.
+     * @return The shortest distance from start to goal or 'UINT_MAX' if goal is not reachable from start.
+     */
+    template<class CoreDistance>
+    dist_t findDistance(unsigned int start, unsigned int goal, CoreDistance&& coreDistance) const {
+        if (kind(slots[start]) == CORE && kind(slots[goal]) == CORE) {
+            return start == goal ? 0 : coreDistance(index(slots[start]), index(slots[goal]));
+        }
+
+        Exit startExits[2];
+        Exit goalExits[2];
+        const unsigned int startExitsCnt = exits(start, startExits);
+        const unsigned int goalExitsCnt = exits(goal, goalExits);
+
+        dist_t best = localRoute(start, goal).first;
+        for (unsigned int i = 0; i < startExitsCnt; i++) {
+            for (unsigned int j = 0; j < goalExitsCnt; j++) {
+                const dist_t around = add(startExits[i].out, goalExits[j].in);
+                if (around >= best) {
+                    continue;
+                }
+                const dist_t core = startExits[i].node == goalExits[j].node
+                        ? 0 : coreDistance(startExits[i].node, goalExits[j].node);
+                best = std::min(best, add(around, core));
+            }
+        }
+        return best;
+    }
+
+    /**
+     * Returns the shortest path between two nodes of the original graph.
+     *
+     * @param start[in] The start node (an ID in the original graph).
+     * @param goal[in] The goal node (an ID in the original graph).
+     * @param corePath[in] A function returning the shortest distance between two core nodes (IDs in the core graph) or
+     * 'UINT_MAX' if there is no path, and filling the edges of the path (with core IDs) into the vector passed as its
+     * third argument. It is called at most four times.
+     * @param path[out] The edges of the path using the IDs of the original graph, empty if there is no path.
+     * @return The shortest distance from start to goal or 'UINT_MAX' if goal is not reachable from start.
+     */
+    template<class CorePath>
+    dist_t findPath(
+            unsigned int start,
+            unsigned int goal,
+            CorePath&& corePath,
+            std::vector<SimpleEdge>& path) const {
+        path.clear();
+
+        Exit startExits[2];
+        Exit goalExits[2];
+        const unsigned int startExitsCnt = exits(start, startExits);
+        const unsigned int goalExitsCnt = exits(goal, goalExits);
+
+        const std::pair<dist_t, unsigned int> local = localRoute(start, goal);
+        dist_t best = local.first;
+        unsigned int bestStart = NONE;
+        unsigned int bestGoal = NONE;
+        std::vector<SimpleEdge> coreEdges;
+        std::vector<SimpleEdge> bestCoreEdges;
+        for (unsigned int i = 0; i < startExitsCnt; i++) {
+            for (unsigned int j = 0; j < goalExitsCnt; j++) {
+                const dist_t around = add(startExits[i].out, goalExits[j].in);
+                if (around >= best) {
+                    continue;
+                }
+                coreEdges.clear();
+                const dist_t core = startExits[i].node == goalExits[j].node
+                        ? 0 : corePath(startExits[i].node, goalExits[j].node, coreEdges);
+                if (add(around, core) < best) {
+                    best = add(around, core);
+                    bestStart = i;
+                    bestGoal = j;
+                    std::swap(bestCoreEdges, coreEdges);
+                }
+            }
+        }
+
+        if (best == NONE) {
+            return best;
+        }
+        if (bestStart == NONE) {
+            appendLocalPath(start, goal, local.second, path);
+        } else {
+            appendExitPath(start, startExits[bestStart], path);
+            for (const SimpleEdge& edge : bestCoreEdges) {
+                appendCoreEdge(edge.from, edge.to, path);
+            }
+            appendEntryPath(goalExits[bestGoal], goal, path);
+        }
+        return best;
+    }
+
+    /**
+     * @return The number of nodes of the original graph.
+     */
+    [[nodiscard]] unsigned int nodes() const;
+
+    /**
+     * @return The number of nodes of the core graph.
+     */
+    [[nodiscard]] unsigned int coreNodes() const;
+
+    /**
+     * @param node[in] A node of the original graph.
+     * @return The ID of the node in the core graph, or 'NONE' if the node was removed.
+     */
+    [[nodiscard]] unsigned int coreID(unsigned int node) const;
+
+    /**
+     * @param coreNode[in] A node of the core graph.
+     * @return The ID of the node in the original graph.
+     */
+    [[nodiscard]] unsigned int originalID(unsigned int coreNode) const;
+
+    /**
+     * @return The number of removed nodes that belong to the dead-end trees.
+     */
+    [[nodiscard]] unsigned int treeNodes() const;
+
+    /**
+     * @return The number of removed nodes that belong to the chains.
+     */
+    [[nodiscard]] unsigned int chainNodes() const;
+
+    /**
+     * @return The number of the chains.
+     */
+    [[nodiscard]] unsigned int chains() const;
+
+    /**
+     * @return The number of bytes used by the table.
+     */
+    [[nodiscard]] size_t memoryUsage() const;
+
+    /**
+     * Writes the table in the binary '.simp' format (see FORMATS.md).
+     *
+     * @param output[in] The binary output stream.
+     */
+    void write(std::ostream& output) const;
+
+    /**
+     * Reads a table written by 'write'.
+     *
+     * @param input[in] The binary input stream.
+     * @return The table.
+     */
+    static SimplificationTable read(std::istream& input);
+
+    /**
+     * Loads the table of a structure preprocessed from a simplified graph. The preprocessor writes the table next to
+     * the structure, so the table is the file with the path of the structure and the '.simp' extension.
+     *
+     * @param structureFile[in] The path to the structure.
+     * @param structureNodes[in] The number of nodes of the loaded structure.
+     * @return The table, or nullptr if there is no table next to the structure (the structure was preprocessed
+     * without '--simplify'). Throws std::runtime_error if the table does not belong to a graph with
+     * 'structureNodes' core nodes.
+     */
+    static std::unique_ptr<SimplificationTable> loadForStructure(
+            const std::string& structureFile,
+            unsigned int structureNodes);
+
+private:
+    friend class GraphSimplifier;
+
+    enum Kind : unsigned int {
+        CORE = 0,
+        CHAIN = 1,
+        TREE = 2
+    };
+
+    static constexpr unsigned int KIND_SHIFT = 30;
+    static constexpr unsigned int INDEX_MASK = (1u << KIND_SHIFT) - 1;
+
+    /**
+     * A node of a dead-end tree. The distances to and from the root are sums of the weights of the existing edges
+     * on the way, the number of the missing edges is stored in the gaps.
+     */
+    struct TreeNode {
+        unsigned int parent;
+        unsigned int root;
+        unsigned int depth;
+        dist_t up;
+        unsigned int upGaps;
+        dist_t down;
+        unsigned int downGaps;
+    };
+
+    /**
+     * A position of a chain, including the two endpoints. 'forward' is the distance from the first endpoint to this
+     * position, 'backward' the distance from this position to the first endpoint, both without the missing edges.
+     */
+    struct ChainPosition {
+        unsigned int node;
+        unsigned int chain;
+        dist_t forward;
+        unsigned int forwardGaps;
+        dist_t backward;
+        unsigned int backwardGaps;
+    };
+
+    /**
+     * The positions [first, last] of a chain.
+     */
+    struct Chain {
+        unsigned int first;
+        unsigned int last;
+    };
+
+    /**
+     * An edge of the core graph that replaces a chain, 'from' and 'to' are core IDs.
+     */
+    struct ChainShortcut {
+        unsigned int from;
+        unsigned int to;
+        unsigned int chain;
+    };
+
+    /**
+     * A core node through which a removed node can be left or entered, with the distances to and from it. For
+     * chain nodes, 'position' is the position of the endpoint in the chain.
+     */
+    struct Exit {
+        unsigned int node;
+        unsigned int position;
+        dist_t out;
+        dist_t in;
+    };
+
+    static Kind kind(unsigned int slot) {
+        return static_cast<Kind>(slot >> KIND_SHIFT);
+    }
+
+    static unsigned int index(unsigned int slot) {
+        return slot & INDEX_MASK;
+    }
+
+    static unsigned int slot(Kind kind, unsigned int index) {
+        return (static_cast<unsigned int>(kind) << KIND_SHIFT) | index;
+    }
+
+    static dist_t add(dist_t first, dist_t second) {
+        return first == NONE || second == NONE ? NONE : first + second;
+    }
+
+    /**
+     * Finds the core nodes through which the node can be left or entered.
+     *
+     * @param node[in] A node of the original graph.
+     * @param result[out] The exits, one for core and tree nodes hanging on core nodes, two for the other nodes.
+     * @return The number of the exits.
+     */
+    unsigned int exits(unsigned int node, Exit* result) const;
+
+    /**
+     * Finds the shortest path between two nodes that does not pass through any core node other than the anchors of
+     * the nodes (the nodes themselves, or the roots of their trees).
+     *
+     * @param start[in] The start node.
+     * @param goal[in] The goal node.
+     * @return The distance ('NONE' if there is no such path) and the lowest common ancestor of the nodes if the path
+     * only leads through their tree, 'NONE' if it leads through the anchors.
+     */
+    [[nodiscard]] std::pair<dist_t, unsigned int> localRoute(unsigned int start, unsigned int goal) const;
+
+    [[nodiscard]] unsigned int anchor(unsigned int node) const;
+
+    [[nodiscard]] unsigned int depth(unsigned int node) const;
+
+    [[nodiscard]] dist_t treeDistanceUp(unsigned int node, unsigned int ancestor) const;
+
+    [[nodiscard]] dist_t treeDistanceDown(unsigned int ancestor, unsigned int node) const;
+
+    [[nodiscard]] dist_t chainDistance(unsigned int from, unsigned int to) const;
+
+    void appendLocalPath(unsigned int start, unsigned int goal, unsigned int ancestor, std::vector<SimpleEdge>& path) const;
+
+    void appendExitPath(unsigned int start, const Exit& exit, std::vector<SimpleEdge>& path) const;
+
+    void appendEntryPath(const Exit& entry, unsigned int goal, std::vector<SimpleEdge>& path) const;
+
+    void appendCoreEdge(unsigned int from, unsigned int to, std::vector<SimpleEdge>& path) const;
+
+    void appendUpPath(unsigned int node, unsigned int ancestor, std::vector<SimpleEdge>& path) const;
+
+    void appendDownPath(unsigned int ancestor, unsigned int node, std::vector<SimpleEdge>& path) const;
+
+    void appendChainPath(unsigned int from, unsigned int to, std::vector<SimpleEdge>& path) const;
+
+    // The kind of every original node in the two highest bits, the core ID, the tree node or the chain position below.
+    std::vector<unsigned int> slots;
+    std::vector<unsigned int> originalIDs;
+    std::vector<TreeNode> trees;
+    std::vector<ChainPosition> positions;
+    std::vector<Chain> chainRanges;
+    // Sorted by 'from' and 'to'.
+    std::vector<ChainShortcut> shortcuts;
+};
+
+#endif //SHORTEST_PATHS_SIMPLIFICATIONTABLE_H
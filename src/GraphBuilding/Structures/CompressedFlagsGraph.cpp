@@ -0,0 +1,143 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Czech Technical University in Prague
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. */
+
+/******************************************************************************
+* File:             CompressedFlagsGraph.cpp
+*****************************************************************************/
+
+#include <algorithm>
+#include <climits>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+#include "CompressedFlagsGraph.h"
+
+namespace {
+    // the number of bytes 'load' reads after the beginning of the last integer in the array
+    constexpr size_t padding = sizeof(uint64_t) - 1;
+
+    unsigned int bytesNeeded(uint64_t value) {
+        unsigned int bytes = 1;
+        while (bytes < sizeof(uint64_t) && (value >> (8 * bytes)) != 0) {
+            bytes++;
+        }
+        return bytes;
+    }
+
+    void write(std::vector<uint8_t>& output, uint64_t value, unsigned int bytes) {
+        for (unsigned int i = 0; i < bytes; i++) {
+            output.push_back(static_cast<uint8_t>(value >> (8 * i)));
+        }
+    }
+
+    // the gap from the previous target, zigzag encoded for the first edge, so that small negative differences also
+    // take few bytes
+    uint64_t encodeGap(const QueryEdge& edge, int64_t previous, bool first) {
+        const int64_t difference = static_cast<int64_t>(edge.targetNode) - previous;
+        return first ? (static_cast<uint64_t>(difference) << 1) ^ static_cast<uint64_t>(difference >> 63)
+                     : static_cast<uint64_t>(difference);
+    }
+
+    uint64_t encodeWeight(const QueryEdge& edge) {
+        return (static_cast<uint64_t>(edge.weight) << 2) | (edge.forward ? 1u : 0u) | (edge.backward ? 2u : 0u);
+    }
+}
+
+//______________________________________________________________________________________________________________________
+CompressedFlagsGraph::CompressedFlagsGraph(const FlagsGraph<NodeData>& graph)
+        : CompressedFlagsGraph(graph.getNodesData()) {
+    const std::vector<std::vector<QueryEdge>>& neighbours = graph.getNeighbours();
+    std::vector<QueryEdge> sorted;
+    for (const std::vector<QueryEdge>& nodeEdges : neighbours) {
+        sorted.assign(nodeEdges.begin(), nodeEdges.end());
+        addNodeEdges(sorted);
+    }
+}
+
+//______________________________________________________________________________________________________________________
+CompressedFlagsGraph::CompressedFlagsGraph(std::vector<NodeData> nodesData) : nodesData(std::move(nodesData)),
+        edgesCnt(0) {
+    offsets.reserve(this->nodesData.size() + 1);
+    offsets.push_back(0);
+    bytes.resize(padding, 0);
+    if (this->nodesData.empty()) {
+        bytes.shrink_to_fit();
+    }
+}
+
+//______________________________________________________________________________________________________________________
+void CompressedFlagsGraph::addNodeEdges(std::vector<QueryEdge>& edges) {
+    if (offsets.size() > nodesData.size()) {
+        throw std::logic_error("The edges of all the nodes of the compressed query graph have already been added.");
+    }
+    const size_t node = offsets.size() - 1;
+    std::sort(edges.begin(), edges.end(), [](const QueryEdge& a, const QueryEdge& b) {
+        return std::tie(a.targetNode, a.weight, a.forward, a.backward)
+               < std::tie(b.targetNode, b.weight, b.forward, b.backward);
+    });
+
+    unsigned int gapBytes = 1;
+    unsigned int weightBytes = 1;
+    int64_t previous = static_cast<int64_t>(node);
+    for (size_t i = 0; i < edges.size(); i++) {
+        gapBytes = std::max(gapBytes, bytesNeeded(encodeGap(edges[i], previous, i == 0)));
+        weightBytes = std::max(weightBytes, bytesNeeded(encodeWeight(edges[i])));
+        previous = edges[i].targetNode;
+    }
+
+    // the padding is kept at the end of the array, so that the nodes added so far can already be decoded
+    bytes.resize(bytes.size() - padding);
+    if (! edges.empty()) {
+        bytes.push_back(static_cast<uint8_t>((gapBytes - 1) | ((weightBytes - 1) << 4)));
+        previous = static_cast<int64_t>(node);
+        for (size_t i = 0; i < edges.size(); i++) {
+            write(bytes, encodeGap(edges[i], previous, i == 0), gapBytes);
+            write(bytes, encodeWeight(edges[i]), weightBytes);
+            previous = edges[i].targetNode;
+        }
+    }
+    edgesCnt += edges.size();
+    if (bytes.size() > UINT32_MAX) {
+        throw std::runtime_error("The edges of the compressed query graph do not fit into 4 GiB.");
+    }
+    offsets.push_back(static_cast<uint32_t>(bytes.size()));
+    bytes.resize(bytes.size() + padding, 0);
+    if (offsets.size() > nodesData.size()) {
+        bytes.shrink_to_fit();
+    }
+}
+
+//______________________________________________________________________________________________________________________
+unsigned int CompressedFlagsGraph::nodes() const {
+    return static_cast<unsigned int>(nodesData.size());
+}
+
+//______________________________________________________________________________________________________________________
+size_t CompressedFlagsGraph::edges() const {
+    return edgesCnt;
+}
+
+//______________________________________________________________________________________________________________________
+size_t CompressedFlagsGraph::memoryUsage() const {
+    return offsets.capacity() * sizeof(uint32_t) + bytes.capacity() + nodesData.capacity() * sizeof(NodeData);
+}
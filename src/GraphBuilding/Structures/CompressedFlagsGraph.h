@@ -0,0 +1,232 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Czech Technical University in Prague
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. */
+
+/******************************************************************************
+* File:             CompressedFlagsGraph.h
+*
+* Description:      Contraction Hierarchies query graph with the edges encoded
+*                   as variable-length integers
+*****************************************************************************/
+
+#ifndef SHORTEST_PATHS_COMPRESSEDFLAGSGRAPH_H
+#define SHORTEST_PATHS_COMPRESSEDFLAGSGRAPH_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+#include "FlagsGraph.h"
+#include "QueryEdge.h"
+#include "../../CH/Structures/NodeData.h"
+
+/**
+ * A read-only variant of the FlagsGraph for hosts where the Contraction Hierarchy does not fit into memory. It stores
+ * the same edges (each edge at the incident node with the lower rank, with the forward and backward flags), but
+ * instead of a std::vector of 12 byte QueryEdges per node, the edges of all nodes are encoded into one byte array.
+ * The edges of a node are sorted by the target node and stored as two little endian integers per edge:
+ *
+ * - the gap between the target node and the target of the previous edge of the node; for the first edge, it is the
+ *   difference between the target node and the node itself (zigzag encoded, as the target can have a lower ID),
+ * - the weight shifted left by two bits, with the forward flag in bit 0 and the backward flag in bit 1.
+ *
+ * The number of bytes of both integers (1 to 8) is chosen for each node separately, as the smallest one that fits all
+ * its edges, and stored in one header byte before the edges of the node. Unlike variable-length integers with
+ * a continuation bit in every byte, all the edges of a node then have the same size and each integer is decoded
+ * by one unaligned load and a mask without any branches, which matters because the edges are decoded on the fly
+ * in the search loop (when iterating over 'nextNodes'), so the graph can be used with the CHDistanceQueryManager in
+ * place of a FlagsGraph.
+ */
+class CompressedFlagsGraph {
+public:
+    /**
+     * Iterates over the edges of one node, decoding them one by one. Dereferencing gives the current edge in the
+     * QueryEdge form.
+     */
+    class EdgeIterator {
+    public:
+        EdgeIterator(const uint8_t* position, const uint8_t* end, unsigned int node) : position(position), end(end),
+                edge(node, 0, false, false), gapBytes(0), gapMask(0), weightMask(0), stride(0) {
+            if (position == end) {
+                return;
+            }
+            const uint8_t header = *this->position++;
+            gapBytes = (header & 0x7u) + 1;
+            const unsigned int weightBytes = ((header >> 4) & 0x7u) + 1;
+            gapMask = ~0ull >> (64 - 8 * gapBytes);
+            weightMask = ~0ull >> (64 - 8 * weightBytes);
+            stride = gapBytes + weightBytes;
+
+            // zigzag decoding of the signed difference between the first target and the node
+            const uint64_t gap = load(this->position) & gapMask;
+            edge.targetNode += static_cast<unsigned int>((gap >> 1) ^ (~(gap & 1) + 1));
+            decodeWeight();
+        }
+
+        const QueryEdge& operator*() const {
+            return edge;
+        }
+
+        const QueryEdge* operator->() const {
+            return &edge;
+        }
+
+        EdgeIterator& operator++() {
+            position += stride;
+            if (position != end) {
+                edge.targetNode += static_cast<unsigned int>(load(position) & gapMask);
+                decodeWeight();
+            }
+            return *this;
+        }
+
+        bool operator!=(const EdgeIterator& other) const {
+            return position != other.position;
+        }
+
+        bool operator==(const EdgeIterator& other) const {
+            return position == other.position;
+        }
+
+    private:
+        void decodeWeight() {
+            const uint64_t weightAndFlags = load(position + gapBytes) & weightMask;
+            edge.weight = static_cast<unsigned int>(weightAndFlags >> 2);
+            edge.forward = (weightAndFlags & 1) != 0;
+            edge.backward = (weightAndFlags & 2) != 0;
+        }
+
+        const uint8_t* position;
+        const uint8_t* end;
+        QueryEdge edge;
+        unsigned int gapBytes;
+        uint64_t gapMask;
+        uint64_t weightMask;
+        unsigned int stride;
+    };
+
+    /**
+     * The edges of one node, returned by 'nextNodes'.
+     */
+    class EdgeRange {
+    public:
+        EdgeRange(const uint8_t* begin, const uint8_t* end, unsigned int node) : first(begin), last(end), node(node) {
+        }
+
+        [[nodiscard]] EdgeIterator begin() const {
+            return EdgeIterator(first, last, node);
+        }
+
+        [[nodiscard]] EdgeIterator end() const {
+            return EdgeIterator(last, last, node);
+        }
+
+    private:
+        const uint8_t* first;
+        const uint8_t* last;
+        unsigned int node;
+    };
+
+    /**
+     * Encodes the edges of a FlagsGraph and copies its node data (the ranks).
+     *
+     * @param graph[in] The graph to compress, it is not changed and can be deleted afterwards. Throws
+     * std::runtime_error if the encoded edges do not fit into 4 GiB.
+     */
+    explicit CompressedFlagsGraph(const FlagsGraph<NodeData>& graph);
+
+    /**
+     * Creates a graph without any edges, the edges of the nodes are then encoded by 'addNodeEdges' one node after
+     * another. This way, the graph can be built without holding the uncompressed graph in memory
+     * (see 'DDSGLoader::loadCompressedFlagsGraph').
+     *
+     * @param nodesData[in] The data (the ranks) of all the nodes of the graph.
+     */
+    explicit CompressedFlagsGraph(std::vector<NodeData> nodesData);
+
+    /**
+     * Encodes the edges of the next node, that is the node with the ID equal to the number of the previous calls.
+     * The edges have to be added for all the nodes (possibly no edges) before the graph is queried.
+     *
+     * @param edges[in, out] The edges stored at the node, they are sorted by the target node in place. Throws
+     * std::runtime_error if the encoded edges do not fit into 4 GiB and std::logic_error if the edges of all the nodes
+     * have already been added.
+     */
+    void addNodeEdges(std::vector<QueryEdge>& edges);
+
+    /**
+     * Returns the number of nodes in the graph.
+     *
+     * @return The number of nodes in the graph.
+     */
+    [[nodiscard]] unsigned int nodes() const;
+
+    /**
+     * Returns the number of edges in the graph.
+     *
+     * @return The number of edges in the graph.
+     */
+    [[nodiscard]] size_t edges() const;
+
+    /**
+     * Returns all the edges stored at a given node, the same edges as 'FlagsGraph::nextNodes' (but sorted by the
+     * target node).
+     *
+     * @param x[in] The ID of the node we are interested in.
+     * @return The range of the edges, decoded while iterating.
+     */
+    [[nodiscard]] EdgeRange nextNodes(const unsigned int x) const {
+        return EdgeRange(bytes.data() + offsets[x], bytes.data() + offsets[x + 1], x);
+    }
+
+    /**
+     * Returns the data for a certain node.
+     *
+     * @param node[in] The node we are interested in.
+     * @return Reference to the data about the node.
+     */
+    const NodeData& data(unsigned int node) const {
+        return nodesData[node];
+    }
+
+    /**
+     * @return The memory used by the graph (the encoded edges, their offsets and the node data) in bytes.
+     */
+    [[nodiscard]] size_t memoryUsage() const;
+
+private:
+    // Reads 8 bytes, the caller masks out the bytes that do not belong to the value. The byte array is padded, so that
+    // this never reads past its end.
+    static uint64_t load(const uint8_t* position) {
+        uint64_t value;
+        std::memcpy(&value, position, sizeof(value));
+        return value;
+    }
+
+    // the edges of node i (including the header byte) are bytes[offsets[i]] to bytes[offsets[i + 1]]
+    std::vector<uint32_t> offsets;
+    std::vector<uint8_t> bytes;
+    std::vector<NodeData> nodesData;
+    size_t edgesCnt;
+};
+
+#endif //SHORTEST_PATHS_COMPRESSEDFLAGSGRAPH_H
@@ -118,6 +118,13 @@ public:
      */
     unsigned int nodes() const;
 
+    /**
+     * Returns the memory used by the graph (the edges, the std::vectors holding them and the node data) in bytes.
+     *
+     * @return The memory used by the graph in bytes.
+     */
+    size_t memoryUsage() const;
+
     /**
      * Returns all neighbours of a given node 'x'. Keep in mind that this returns neighbour both in the forward and
      * backward direction, so we always have to check if the neighbour is in the correct direction when
@@ -137,32 +144,13 @@ public:
     T &data(unsigned int node);
 
     /**
-     * Auxiliary function used to reset some data that could be changed during queries to their initial state so that
-     * following queries still return correct values.
-     *
-     * @param node[in] The node we want to reset.
-     */
-    virtual void resetForwardInfo(const unsigned int node);
-
-    /**
-     * Auxiliary function used to reset some data that could be changed during queries to their initial state so that
-     * following queries still return correct values.
-     *
-     * @param node[in] The node we want to reset.
-     */
-    virtual void resetBackwardInfo(const unsigned int node);
-
-    /**
+     * Returns the data for a certain node. The queries only read the data, so the graph can be shared by the query
+     * managers of multiple threads.
      *
-     * @param node
-     */
-    virtual void resetForwardStall(const unsigned int node);
-
-    /**
-     *
-     * @param node
+     * @param node[in] The node we are interested in.
+     * @return Reference to the data about the node.
      */
-    virtual void resetBackwardStall(const unsigned int node);
+    const T &data(unsigned int node) const;
 };
 
 #include "FlagsGraph.tpp"
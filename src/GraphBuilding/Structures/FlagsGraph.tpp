@@ -104,6 +104,15 @@ template<class T> unsigned int FlagsGraph<T>::nodes() const {
     return boost::numeric_cast<unsigned int>(neighbours.size());
 }
 
+//______________________________________________________________________________________________________________________
+template<class T> size_t FlagsGraph<T>::memoryUsage() const {
+    size_t bytes = neighbours.capacity() * sizeof(std::vector<QueryEdge>) + nodesData.capacity() * sizeof(T);
+    for (const std::vector<QueryEdge>& edges : neighbours) {
+        bytes += edges.capacity() * sizeof(QueryEdge);
+    }
+    return bytes;
+}
+
 //______________________________________________________________________________________________________________________
 template<class T> const std::vector< QueryEdge > & FlagsGraph<T>::nextNodes(const unsigned int x)const {
     return neighbours.at(x);
@@ -115,28 +124,8 @@ template<class T> T& FlagsGraph<T>::data(unsigned int node) {
 }
 
 //______________________________________________________________________________________________________________________
-template<class T> void FlagsGraph<T>::resetForwardInfo(const unsigned int node) {
-    nodesData[node].forwardDist = UINT_MAX;
-    nodesData[node].forwardSettled = false;
-    nodesData[node].forwardReached = false;
-
-}
-
-//______________________________________________________________________________________________________________________
-template<class T> void FlagsGraph<T>::resetBackwardInfo(const unsigned int node) {
-    nodesData[node].backwardDist = UINT_MAX;
-    nodesData[node].backwardSettled = false;
-    nodesData[node].backwardReached = false;
-}
-
-//______________________________________________________________________________________________________________________
-template<class T> void FlagsGraph<T>::resetForwardStall(const unsigned int node) {
-    nodesData[node].forwardStalled = false;
-}
-
-//______________________________________________________________________________________________________________________
-template<class T> void FlagsGraph<T>::resetBackwardStall(const unsigned int node) {
-    nodesData[node].backwardStalled = false;
+template<class T> const T& FlagsGraph<T>::data(unsigned int node) const {
+    return nodesData[node];
 }
 
 template<class T> const std::vector<std::vector<QueryEdge>>& FlagsGraph<T>::getNeighbours() const {
@@ -35,8 +35,6 @@
 FlagsGraphWithUnpackingData::FlagsGraphWithUnpackingData(unsigned int n) {
     neighbours.resize(n);
     nodesData.resize(n);
-    forwardPrev.resize(n, UINT_MAX);
-    backwardPrev.resize(n, UINT_MAX);
 }
 
 //______________________________________________________________________________________________________________________
@@ -63,62 +61,12 @@ NodeData & FlagsGraphWithUnpackingData::data(unsigned int node) {
 }
 
 //______________________________________________________________________________________________________________________
-void FlagsGraphWithUnpackingData::resetForwardInfo(const unsigned int node) {
-    nodesData[node].forwardDist = UINT_MAX;
-    nodesData[node].forwardSettled = false;
-    nodesData[node].forwardReached = false;
-
-}
-
-//______________________________________________________________________________________________________________________
-void FlagsGraphWithUnpackingData::resetBackwardInfo(const unsigned int node) {
-    nodesData[node].backwardDist = UINT_MAX;
-    nodesData[node].backwardSettled = false;
-    nodesData[node].backwardReached = false;
-}
-
-//______________________________________________________________________________________________________________________
-void FlagsGraphWithUnpackingData::resetForwardStall(const unsigned int node) {
-    nodesData[node].forwardStalled = false;
-}
-
-//______________________________________________________________________________________________________________________
-void FlagsGraphWithUnpackingData::resetBackwardStall(const unsigned int node) {
-    nodesData[node].backwardStalled = false;
-}
-
-//______________________________________________________________________________________________________________________
-void FlagsGraphWithUnpackingData::setForwardPrev(unsigned int x, unsigned int y) {
-    forwardPrev[x] = y;
-}
-
-//______________________________________________________________________________________________________________________
-void FlagsGraphWithUnpackingData::setBackwardPrev(unsigned int x, unsigned int y) {
-    backwardPrev[x] = y;
-}
-
-//______________________________________________________________________________________________________________________
-unsigned int FlagsGraphWithUnpackingData::getForwardPrev(unsigned int x) {
-    return forwardPrev[x];
-}
-
-//______________________________________________________________________________________________________________________
-unsigned int FlagsGraphWithUnpackingData::getBackwardPrev(unsigned int x) {
-    return backwardPrev[x];
-}
-
-//______________________________________________________________________________________________________________________
-void FlagsGraphWithUnpackingData::resetForwardPrev(unsigned int x) {
-    forwardPrev[x] = UINT_MAX;
-}
-
-//______________________________________________________________________________________________________________________
-void FlagsGraphWithUnpackingData::resetBackwardPrev(unsigned int x) {
-    backwardPrev[x] = UINT_MAX;
+const NodeData & FlagsGraphWithUnpackingData::data(unsigned int node) const {
+    return nodesData[node];
 }
 
 //______________________________________________________________________________________________________________________
-unsigned int FlagsGraphWithUnpackingData::getMiddleNode(unsigned int source, unsigned int target, bool direction) {
+unsigned int FlagsGraphWithUnpackingData::getMiddleNode(unsigned int source, unsigned int target, bool direction) const {
     for(size_t i = 0; i < neighbours[source].size(); i++) {
         if (neighbours[source][i].targetNode == target) {
             if (direction == FORWARD && neighbours[source][i].forward) {
@@ -133,7 +81,7 @@ unsigned int FlagsGraphWithUnpackingData::getMiddleNode(unsigned int source, uns
 }
 
 //______________________________________________________________________________________________________________________
-unsigned int FlagsGraphWithUnpackingData::getDistance(unsigned int node1, unsigned int node2, bool direction) {
+unsigned int FlagsGraphWithUnpackingData::getDistance(unsigned int node1, unsigned int node2, bool direction) const {
     unsigned int source = node1;
     unsigned int target = node2;
     if (nodesData[source].rank > nodesData[target].rank) {
@@ -42,26 +42,15 @@ class FlagsGraphWithUnpackingData {
 protected:
     std::vector< std::vector < QueryEdgeWithUnpackingData > > neighbours;
     std::vector< NodeData > nodesData;
-    std::vector<unsigned int> forwardPrev;
-    std::vector<unsigned int> backwardPrev;
 public:
     explicit FlagsGraphWithUnpackingData(unsigned int n);
-    unsigned int getMiddleNode(unsigned int source, unsigned int target, bool direction);
-    unsigned int getDistance(unsigned int node1, unsigned int node2, bool direction);
-    void setForwardPrev(unsigned int x, unsigned int y);
-    void setBackwardPrev(unsigned int x, unsigned int y);
-    unsigned int getForwardPrev(unsigned int x);
-    unsigned int getBackwardPrev(unsigned int x);
-    void resetForwardPrev(unsigned int x);
-    void resetBackwardPrev(unsigned int x);
+    unsigned int getMiddleNode(unsigned int source, unsigned int target, bool direction) const;
+    unsigned int getDistance(unsigned int node1, unsigned int node2, bool direction) const;
     void addEdge(unsigned int from, unsigned int to, unsigned int weight, bool fw, bool bw, unsigned int mNode = UINT_MAX);
     unsigned int nodes() const;
     const std::vector< QueryEdgeWithUnpackingData > & nextNodes(unsigned int x)const;
     NodeData & data(unsigned int node);
-    void resetForwardInfo(unsigned int node);
-    void resetBackwardInfo(unsigned int node);
-    void resetForwardStall(unsigned int node);
-    void resetBackwardStall(unsigned int node);
+    const NodeData & data(unsigned int node) const;
 };
 
 
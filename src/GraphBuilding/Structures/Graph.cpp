@@ -26,6 +26,7 @@
 // Created on: 25.7.18
 //
 
+#include <algorithm>
 #include <cstdio>
 #include <boost/numeric/conversion/cast.hpp>
 #include "Graph.h"
@@ -71,3 +72,22 @@ const std::vector<std::pair<unsigned int, dist_t>> & Graph::incomingEdges(const
 const std::vector<std::pair<unsigned int, dist_t>> & Graph::outgoingEdges(const unsigned int x)const {
     return this->followingNodes.at(x);
 }
+
+//______________________________________________________________________________________________________________________
+bool Graph::isSymmetric() const {
+    // The shortest edges to the neighbours are compared with the shortest edges from the neighbours.
+    const auto shortestEdges = [](std::vector<std::pair<unsigned int, dist_t>> edges) {
+        std::sort(edges.begin(), edges.end());
+        edges.erase(std::unique(edges.begin(), edges.end(), [](const auto& a, const auto& b) {
+            return a.first == b.first;
+        }), edges.end());
+        return edges;
+    };
+
+    for (size_t node = 0; node < followingNodes.size(); node++) {
+        if (shortestEdges(followingNodes[node]) != shortestEdges(previousNodes[node])) {
+            return false;
+        }
+    }
+    return true;
+}
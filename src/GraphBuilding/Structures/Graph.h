@@ -97,6 +97,15 @@ public:
      */
     const std::vector<std::pair<unsigned int, dist_t>> &outgoingEdges(const unsigned int x) const;
 
+    /**
+     * Checks whether the graph is undirected, that is, whether every edge has a reverse edge of the same weight
+     * (only the shortest of parallel edges is considered). The distances in such a graph are symmetric.
+     *
+     * @return True if the shortest edge from u to v has the same weight as the shortest edge from v to u for all the
+     * pairs of nodes.
+     */
+    bool isSymmetric() const;
+
     bool handlesDuplicateEdges() override {
         return false;
     }
@@ -0,0 +1,121 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Czech Technical University in Prague
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. */
+
+/******************************************************************************
+* File:             NodeMapping.cpp
+*****************************************************************************/
+
+#include <stdexcept>
+#include <string>
+#include "NodeMapping.h"
+
+//______________________________________________________________________________________________________________________
+NodeMapping::NodeMapping(std::vector<long long unsigned int> originalIDs) : originalIDs(std::move(originalIDs)) {
+    buildIndex();
+}
+
+//______________________________________________________________________________________________________________________
+unsigned int NodeMapping::internalID(const long long unsigned int originalID) const {
+    const auto iterator = internalIDs.find(originalID);
+    if (iterator == internalIDs.end()) {
+        throw std::out_of_range("The node ID " + std::to_string(originalID) + " is not present in the mapping.");
+    }
+
+    return iterator->second;
+}
+
+//______________________________________________________________________________________________________________________
+bool NodeMapping::contains(const long long unsigned int originalID) const {
+    return internalIDs.count(originalID) != 0;
+}
+
+//______________________________________________________________________________________________________________________
+long long unsigned int NodeMapping::originalID(const unsigned int internalID) const {
+    return originalIDs[internalID];
+}
+
+//______________________________________________________________________________________________________________________
+unsigned int NodeMapping::nodes() const {
+    return static_cast<unsigned int>(originalIDs.size());
+}
+
+//______________________________________________________________________________________________________________________
+size_t NodeMapping::memoryUsage() const {
+    // Every entry of the hash map is a separately allocated node with the key, the value and the next pointer.
+    const size_t entryBytes = sizeof(void*) + sizeof(std::pair<const long long unsigned int, unsigned int>);
+    return originalIDs.size() * sizeof(long long unsigned int) + internalIDs.size() * entryBytes
+        + internalIDs.bucket_count() * sizeof(void*);
+}
+
+//______________________________________________________________________________________________________________________
+void NodeMapping::clear() {
+    originalIDs = {};
+    internalIDs = {};
+}
+
+//______________________________________________________________________________________________________________________
+void NodeMapping::write(std::ostream& output) const {
+    const unsigned int nodesCnt = nodes();
+    const unsigned int padding = 0;
+
+    output.write("XIDB", 4);
+    output.write(reinterpret_cast<const char*>(&nodesCnt), sizeof(nodesCnt));
+    output.write(reinterpret_cast<const char*>(&padding), sizeof(padding));
+    output.write(reinterpret_cast<const char*>(originalIDs.data()), static_cast<std::streamsize>(originalIDs.size() * sizeof(long long unsigned int)));
+}
+
+//______________________________________________________________________________________________________________________
+NodeMapping NodeMapping::read(std::istream& input) {
+    char header[4];
+    input.read(header, sizeof(header));
+    if (!input || header[0] != 'X' || header[1] != 'I' || header[2] != 'D' || header[3] != 'B') {
+        throw std::runtime_error("The input file is missing the binary node mapping header.");
+    }
+
+    unsigned int nodesCnt;
+    unsigned int padding;
+    input.read(reinterpret_cast<char*>(&nodesCnt), sizeof(nodesCnt));
+    input.read(reinterpret_cast<char*>(&padding), sizeof(padding));
+    if (!input) {
+        throw std::runtime_error("The binary node mapping header is corrupted.");
+    }
+
+    NodeMapping mapping;
+    mapping.originalIDs.resize(nodesCnt);
+    input.read(reinterpret_cast<char*>(mapping.originalIDs.data()), static_cast<std::streamsize>(nodesCnt * sizeof(long long unsigned int)));
+    if (!input) {
+        throw std::runtime_error("The binary node mapping file is truncated.");
+    }
+    mapping.buildIndex();
+
+    return mapping;
+}
+
+//______________________________________________________________________________________________________________________
+void NodeMapping::buildIndex() {
+    internalIDs.reserve(originalIDs.size());
+    for (unsigned int i = 0; i < originalIDs.size(); i++) {
+        // emplace keeps the first occurrence of a duplicate ID
+        internalIDs.emplace(originalIDs[i], i);
+    }
+}
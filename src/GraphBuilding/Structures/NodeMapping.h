@@ -0,0 +1,127 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Czech Technical University in Prague
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. */
+
+/******************************************************************************
+* File:             NodeMapping.h
+*
+* Description:      Compact mapping between the original and the internal node IDs
+*****************************************************************************/
+
+#ifndef SHORTEST_PATHS_NODEMAPPING_H
+#define SHORTEST_PATHS_NODEMAPPING_H
+
+#include <istream>
+#include <ostream>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * Mapping from the original node IDs (used for example in the query sets or by the applications using the library)
+ * to the IDs used by the query algorithms and back. The internal IDs are the positions of the original IDs in the
+ * mapping file, so the reverse mapping is a plain array, the forward mapping is a hash map.
+ *
+ * The mapping can be stored in a binary format (see 'write'), which is loaded without parsing the IDs from text.
+ */
+class NodeMapping {
+public:
+    /**
+     * Creates an empty mapping.
+     */
+    NodeMapping() = default;
+
+    /**
+     * Creates the mapping from the original IDs of all the nodes.
+     *
+     * @param originalIDs[in] The original IDs, 'originalIDs[i]' is the original ID of the node with the internal ID 'i'.
+     * If some original ID is present multiple times, its first occurrence is used for the forward mapping.
+     */
+    explicit NodeMapping(std::vector<long long unsigned int> originalIDs);
+
+    /**
+     * Finds the internal ID of a node.
+     *
+     * @param originalID[in] The original ID of the node.
+     * @return The internal ID of the node. Throws std::out_of_range if the ID is not present in the mapping.
+     */
+    unsigned int internalID(long long unsigned int originalID) const;
+
+    /**
+     * Checks whether an original ID is present in the mapping.
+     *
+     * @param originalID[in] The original ID of the node.
+     * @return True if the mapping contains the ID.
+     */
+    bool contains(long long unsigned int originalID) const;
+
+    /**
+     * Returns the original ID of a node.
+     *
+     * @param internalID[in] The internal ID of the node, it must be lower than 'nodes()'.
+     * @return The original ID of the node.
+     */
+    long long unsigned int originalID(unsigned int internalID) const;
+
+    /**
+     * @return The number of nodes in the mapping.
+     */
+    unsigned int nodes() const;
+
+    /**
+     * @return The approximate number of bytes occupied by the mapping.
+     */
+    size_t memoryUsage() const;
+
+    /**
+     * Releases all the memory used by the mapping, the mapping is empty afterwards.
+     */
+    void clear();
+
+    /**
+     * Writes the mapping in the binary format. The format starts with the 'XIDB' header followed by the number of
+     * nodes and four padding bytes (both 32-bit). Then the original IDs in the order of the internal IDs (64-bit)
+     * follow.
+     *
+     * @param output[in, out] The binary stream the mapping will be written to.
+     */
+    void write(std::ostream& output) const;
+
+    /**
+     * Reads the mapping written by 'write'.
+     *
+     * @param input[in, out] The binary stream the mapping will be read from.
+     * @return The loaded mapping.
+     */
+    static NodeMapping read(std::istream& input);
+
+private:
+    /**
+     * Fills the forward mapping from 'originalIDs'.
+     */
+    void buildIndex();
+
+    std::vector<long long unsigned int> originalIDs;
+    std::unordered_map<long long unsigned int, unsigned int> internalIDs;
+};
+
+
+#endif //SHORTEST_PATHS_NODEMAPPING_H
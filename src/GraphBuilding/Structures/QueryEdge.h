@@ -52,6 +52,14 @@ public:
      */
     QueryEdge(const QueryEdge & x);
 
+    /**
+     * Copies another edge into this instance.
+     *
+     * @param x[in] Another instance of the class we want to copy.
+     * @return This instance.
+     */
+    QueryEdge & operator=(const QueryEdge & x) = default;
+
     unsigned int weight;
     unsigned int targetNode;
     bool forward;
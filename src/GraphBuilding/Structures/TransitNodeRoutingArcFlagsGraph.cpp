@@ -67,7 +67,7 @@ void TransitNodeRoutingArcFlagsGraph::addBackwardAccessNode(
 }
 
 //______________________________________________________________________________________________________________________
-unsigned int TransitNodeRoutingArcFlagsGraph::findTNRAFDistance(unsigned int start, unsigned int goal) {
+unsigned int TransitNodeRoutingArcFlagsGraph::findTNRAFDistance(unsigned int start, unsigned int goal, QueryStatistics* statistics) const {
 	unsigned int shortestDistance = UINT_MAX;
 	unsigned int sourceRegion = nodesData[start].region;
 	unsigned int targetRegion = nodesData[goal].region;
@@ -76,31 +76,23 @@ unsigned int TransitNodeRoutingArcFlagsGraph::findTNRAFDistance(unsigned int sta
 		if (forwardAccessNodes[start][i].regionFlags[targetRegion]) {
 			for (size_t j = 0; j < backwardAccessNodes[goal].size(); j++) {
 				if (backwardAccessNodes[goal][j].regionFlags[sourceRegion]) {
-					unsigned int id1 = transitNodeMapping[forwardAccessNodes[start][i].accessNodeID];
-					unsigned int id2 = transitNodeMapping[backwardAccessNodes[goal][j].accessNodeID];
+					COUNT_QUERY_STATISTIC(statistics, accessNodePairs, 1);
+					unsigned int id1 = transitNodeMapping.at(forwardAccessNodes[start][i].accessNodeID);
+					unsigned int id2 = transitNodeMapping.at(backwardAccessNodes[goal][j].accessNodeID);
 					unsigned int newDistance = forwardAccessNodes[start][i].distanceToNode + transitNodesDistanceTable[
 						id1][id2] + backwardAccessNodes[goal][j].distanceToNode;
 					if (newDistance < shortestDistance && transitNodesDistanceTable[id1][id2] != UINT_MAX) {
 						shortestDistance = newDistance;
 					}
+				} else {
+					COUNT_QUERY_STATISTIC(statistics, arcFlagPrunes, 1);
 				}
 			}
+		} else {
+			COUNT_QUERY_STATISTIC(statistics, arcFlagPrunes, backwardAccessNodes[goal].size());
 		}
 	}
 
 	return shortestDistance;
 }
 
-//______________________________________________________________________________________________________________________
-void TransitNodeRoutingArcFlagsGraph::resetForwardInfo(const unsigned int node) {
-	nodesData[node].forwardDist = UINT_MAX;
-	nodesData[node].forwardSettled = false;
-	nodesData[node].forwardReached = false;
-}
-
-//______________________________________________________________________________________________________________________
-void TransitNodeRoutingArcFlagsGraph::resetBackwardInfo(const unsigned int node) {
-	nodesData[node].backwardDist = UINT_MAX;
-	nodesData[node].backwardSettled = false;
-	nodesData[node].backwardReached = false;
-}
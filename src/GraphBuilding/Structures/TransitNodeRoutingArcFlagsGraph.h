@@ -109,30 +109,13 @@ public:
      *
      * @param start[in] The start node of the query.
      * @param goal[in] The goal node of the query.
+     * @param statistics[in] Optional statistics the numbers of evaluated and discarded access node pairs are added to.
      * @return Returns the shortest distance from start to goal, or 'UINT_MAX' if goal is not reachable from start.
      */
     unsigned int findTNRAFDistance(
             unsigned int start,
-            unsigned int goal);
-
-protected:
-    /**
-     * Auxiliary function used to reset some data that could be changed during queries to their initial state so that
-     * following queries still return correct values.
-     *
-     * @param node[in] The node we want to reset.
-     */
-    void resetForwardInfo(
-            const unsigned int node) override;
-
-    /**
-     * Auxiliary function used to reset some data that could be changed during queries to their initial state so that
-     * following queries still return correct values.
-     *
-     * @param node[in] The node we want to reset.
-     */
-    void resetBackwardInfo(
-            const unsigned int node) override;
+            unsigned int goal,
+            QueryStatistics* statistics = nullptr) const;
 };
 
 
@@ -32,6 +32,7 @@
 
 #include "FlagsGraph.h"
 #include "../../TNR/Structures/AccessNodeData.h"
+#include "../../CH/Structures/QueryStatistics.h"
 #include "../../DistanceMatrix/Distance_matrix_travel_time_provider.h"
 
 /**
@@ -84,7 +85,7 @@ public:
      */
     bool isLocalQuery(
             unsigned int start,
-            unsigned int goal);
+            unsigned int goal) const;
 
     /**
      * Finds the distance between two nodes based on the TNR data-structure. This is used for the non-local queries.
@@ -93,11 +94,13 @@ public:
      *
      * @param start[in] The start node of the query.
      * @param goal[in] The target node of the query.
+     * @param statistics[in] Optional statistics the number of evaluated access node pairs is added to.
      * @return Returns the shortest distance from start to goal or 'UINT_MAX' if they are not connected.
      */
     unsigned int findTNRDistance(
             unsigned int start,
-            unsigned int goal);
+            unsigned int goal,
+            QueryStatistics* statistics = nullptr) const;
 
     /**
      * Used to establish a mapping from IDs in the graph to IDs in the transit node set.
@@ -22,7 +22,7 @@ TransitNodeRoutingGraph<T, A>::~TransitNodeRoutingGraph() = default;
 
 //______________________________________________________________________________________________________________________
 template<class T, class A>
-bool TransitNodeRoutingGraph<T, A>::isLocalQuery(unsigned int start, unsigned int goal) {
+bool TransitNodeRoutingGraph<T, A>::isLocalQuery(unsigned int start, unsigned int goal) const {
 	for (size_t k = 0; k < forwardSearchSpaces[start].size(); k++) {
 		for (size_t m = 0; m < backwardSearchSpaces[goal].size(); m++) {
 			if (forwardSearchSpaces[start][k] == backwardSearchSpaces[goal][m]) {
@@ -35,13 +35,14 @@ bool TransitNodeRoutingGraph<T, A>::isLocalQuery(unsigned int start, unsigned in
 
 //______________________________________________________________________________________________________________________
 template<class T, class A>
-unsigned int TransitNodeRoutingGraph<T, A>::findTNRDistance(unsigned int start, unsigned int goal) {
+unsigned int TransitNodeRoutingGraph<T, A>::findTNRDistance(unsigned int start, unsigned int goal, QueryStatistics* statistics) const {
 	unsigned int shortestDistance = UINT_MAX;
+	COUNT_QUERY_STATISTIC(statistics, accessNodePairs, forwardAccessNodes[start].size() * backwardAccessNodes[goal].size());
 
 	for (size_t i = 0; i < forwardAccessNodes[start].size(); i++) {
 		for (size_t j = 0; j < backwardAccessNodes[goal].size(); j++) {
-			unsigned int id1 = transitNodeMapping[forwardAccessNodes[start][i].accessNodeID];
-			unsigned int id2 = transitNodeMapping[backwardAccessNodes[goal][j].accessNodeID];
+			unsigned int id1 = transitNodeMapping.at(forwardAccessNodes[start][i].accessNodeID);
+			unsigned int id2 = transitNodeMapping.at(backwardAccessNodes[goal][j].accessNodeID);
 			unsigned int newDistance = forwardAccessNodes[start][i].distanceToNode + transitNodesDistanceTable[id1][id2]
 				+ backwardAccessNodes[goal][j].distanceToNode;
 			if (newDistance < shortestDistance && transitNodesDistanceTable[id1][id2] != UINT_MAX) {
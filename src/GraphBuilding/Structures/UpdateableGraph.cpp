@@ -139,6 +139,60 @@ void UpdateableGraph::getNodesWithHighestRank(std::vector< unsigned int > & high
     }
 }
 
+//______________________________________________________________________________________________________________________
+void UpdateableGraph::writeState(std::ostream &output) const {
+    unsigned int n = nodes();
+    output.write((char *) &n, sizeof(n));
+    output.write((char *) ranks.data(), std::streamsize(n * sizeof(unsigned int)));
+    for (unsigned int i = 0; i < n; i++) {
+        unsigned int edgesCnt = boost::numeric_cast<unsigned int>(followingNodes[i].size());
+        output.write((char *) &edgesCnt, sizeof(edgesCnt));
+        for (const auto &[target, data] : followingNodes[i]) {
+            output.write((char *) &target, sizeof(target));
+            output.write((char *) &data.weight, sizeof(data.weight));
+            output.write((char *) &data.middleNode, sizeof(data.middleNode));
+            output.write((char *) &data.isShortcut, sizeof(data.isShortcut));
+        }
+    }
+}
+
+//______________________________________________________________________________________________________________________
+void UpdateableGraph::readState(std::istream &input) {
+    unsigned int n;
+    input.read((char *) &n, sizeof(n));
+    if (n != nodes()) {
+        throw std::runtime_error("The saved graph has " + std::to_string(n) + " nodes instead of "
+                                 + std::to_string(nodes()) + ".");
+    }
+
+    std::vector<unsigned int> newRanks(n);
+    input.read((char *) newRanks.data(), std::streamsize(n * sizeof(unsigned int)));
+    std::vector<std::unordered_map<unsigned int, PreprocessingEdgeData> > newFollowingNodes(n);
+    std::vector<std::unordered_map<unsigned int, dist_t> > newPreviousNodes(n);
+    for (unsigned int i = 0; i < n; i++) {
+        unsigned int edgesCnt;
+        input.read((char *) &edgesCnt, sizeof(edgesCnt));
+        for (unsigned int j = 0; j < edgesCnt; j++) {
+            unsigned int target, middleNode;
+            dist_t weight;
+            bool shortcut;
+            input.read((char *) &target, sizeof(target));
+            input.read((char *) &weight, sizeof(weight));
+            input.read((char *) &middleNode, sizeof(middleNode));
+            input.read((char *) &shortcut, sizeof(shortcut));
+            if (target >= n) {
+                throw std::runtime_error("The saved graph contains an edge to a nonexistent node.");
+            }
+            newFollowingNodes[i].insert(std::make_pair(target, PreprocessingEdgeData(weight, middleNode, shortcut)));
+            newPreviousNodes[target].insert(std::make_pair(i, weight));
+        }
+    }
+
+    ranks.swap(newRanks);
+    followingNodes.swap(newFollowingNodes);
+    previousNodes.swap(newPreviousNodes);
+}
+
 //______________________________________________________________________________________________________________________
 void UpdateableGraph::flushInDdsgFormat(std::string filePath) {
     std::vector < OutputEdge > edges;
@@ -177,6 +177,24 @@ public:
      */
     void outputAsXenGraph(std::string filePath);
 
+    /**
+     * Writes the complete state of the graph (all the edges including the shortcuts and their middle nodes, and
+     * the ranks) in a binary form into a stream. This is used to save the Contraction Hierarchy into a checkpoint
+     * before the graph is modified by the later preprocessing phases.
+     *
+     * @param output[in] The stream into which the state should be written.
+     */
+    void writeState(std::ostream &output) const;
+
+    /**
+     * Replaces the state of the graph with a state written by 'writeState'. The graph is only modified after the whole
+     * state was read successfully. The stream should be set to throw exceptions on failure, otherwise a truncated
+     * input can not be detected.
+     *
+     * @param input[in] The stream from which the state should be read.
+     */
+    void readState(std::istream &input);
+
     /**
      * Tries to insert an edge from one node to another with the given weight into the graph. The edge is not inserted
      * if there already exists an edge connecting the two nodes with a lower weight.
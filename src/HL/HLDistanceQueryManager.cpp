@@ -0,0 +1,201 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Czech Technical University in Prague
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. */
+
+/******************************************************************************
+* File:             HLDistanceQueryManager.cpp
+*****************************************************************************/
+
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include "HLDistanceQueryManager.h"
+
+namespace {
+#if defined(__SSE2__) && !defined(__AVX2__)
+    // SSE2 has no unsigned 32-bit minimum, the values are compared as signed after flipping the sign bit
+    inline __m128i minUnsigned(__m128i a, __m128i b) {
+        const __m128i sign = _mm_set1_epi32(INT_MIN);
+        const __m128i greater = _mm_cmpgt_epi32(_mm_xor_si128(a, sign), _mm_xor_si128(b, sign));
+        return _mm_or_si128(_mm_and_si128(greater, b), _mm_andnot_si128(greater, a));
+    }
+#endif
+}
+
+//______________________________________________________________________________________________________________________
+HLDistanceQueryManager::HLDistanceQueryManager(const HubLabels& labels, Intersection intersection) : labels(labels),
+        intersection(intersection) {
+}
+
+//______________________________________________________________________________________________________________________
+unsigned int HLDistanceQueryManager::findDistance(unsigned int start, unsigned int goal) const {
+    if (labels.compressed()) {
+        return intersectCompressed(labels.compressedLabel(start, true), labels.compressedLabel(goal, false));
+    }
+    if (intersection == Intersection::SIMD) {
+        return intersectSimd(labels.label(start, true), labels.label(goal, false));
+    }
+    return intersectMerge(labels.label(start, true), labels.label(goal, false));
+}
+
+//______________________________________________________________________________________________________________________
+const char* HLDistanceQueryManager::simdInstructionSet() {
+#if defined(__AVX2__)
+    return "AVX2";
+#elif defined(__SSE2__)
+    return "SSE2";
+#else
+    return "none";
+#endif
+}
+
+//______________________________________________________________________________________________________________________
+unsigned int HLDistanceQueryManager::intersectMerge(const HubLabels::Label& forward, const HubLabels::Label& backward) {
+    uint64_t best = UINT_MAX;
+    size_t i = 0;
+    size_t j = 0;
+    while (i < forward.size && j < backward.size) {
+        if (forward.hubs[i] < backward.hubs[j]) {
+            i++;
+        } else if (forward.hubs[i] > backward.hubs[j]) {
+            j++;
+        } else {
+            best = std::min(best, static_cast<uint64_t>(forward.distances[i]) + backward.distances[j]);
+            i++;
+            j++;
+        }
+    }
+    return static_cast<unsigned int>(best);
+}
+
+//______________________________________________________________________________________________________________________
+unsigned int HLDistanceQueryManager::intersectSimd(const HubLabels::Label& forward, const HubLabels::Label& backward) {
+    size_t i = 0;
+    size_t j = 0;
+    unsigned int best = UINT_MAX;
+
+    // The blocks are compared all-to-all by rotating the backward block, the sums of the lanes with different hubs
+    // are replaced by UINT_MAX. The sums saturate at UINT_MAX like in 'intersectMerge': adding b to min(f, ~b) can not
+    // overflow and gives UINT_MAX whenever f + b would. Then the block with the smaller last hub is skipped (both if they are equal), none of
+    // its hubs can be found in the rest of the other label.
+#if defined(__AVX2__)
+    const __m256i rotation = _mm256_setr_epi32(1, 2, 3, 4, 5, 6, 7, 0);
+    const __m256i ones = _mm256_set1_epi32(-1);
+    __m256i minimum = ones;
+    while (i + 8 <= forward.size && j + 8 <= backward.size) {
+        const __m256i forwardHubs = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(forward.hubs + i));
+        const __m256i forwardDistances = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(forward.distances + i));
+        __m256i backwardHubs = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(backward.hubs + j));
+        __m256i backwardDistances = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(backward.distances + j));
+        for (int r = 0; r < 8; r++) {
+            const __m256i equal = _mm256_cmpeq_epi32(forwardHubs, backwardHubs);
+            const __m256i sums = _mm256_add_epi32(
+                    backwardDistances, _mm256_min_epu32(forwardDistances, _mm256_xor_si256(backwardDistances, ones)));
+            minimum = _mm256_min_epu32(minimum, _mm256_or_si256(sums, _mm256_xor_si256(equal, ones)));
+            backwardHubs = _mm256_permutevar8x32_epi32(backwardHubs, rotation);
+            backwardDistances = _mm256_permutevar8x32_epi32(backwardDistances, rotation);
+        }
+
+        const uint32_t forwardLast = forward.hubs[i + 7];
+        const uint32_t backwardLast = backward.hubs[j + 7];
+        i += forwardLast <= backwardLast ? 8 : 0;
+        j += backwardLast <= forwardLast ? 8 : 0;
+    }
+
+    alignas(32) uint32_t lanes[8];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), minimum);
+    best = *std::min_element(lanes, lanes + 8);
+#elif defined(__SSE2__)
+    const __m128i ones = _mm_set1_epi32(-1);
+    __m128i minimum = ones;
+    while (i + 4 <= forward.size && j + 4 <= backward.size) {
+        const __m128i forwardHubs = _mm_loadu_si128(reinterpret_cast<const __m128i*>(forward.hubs + i));
+        const __m128i forwardDistances = _mm_loadu_si128(reinterpret_cast<const __m128i*>(forward.distances + i));
+        __m128i backwardHubs = _mm_loadu_si128(reinterpret_cast<const __m128i*>(backward.hubs + j));
+        __m128i backwardDistances = _mm_loadu_si128(reinterpret_cast<const __m128i*>(backward.distances + j));
+        for (int r = 0; r < 4; r++) {
+            const __m128i equal = _mm_cmpeq_epi32(forwardHubs, backwardHubs);
+            const __m128i sums = _mm_add_epi32(
+                    backwardDistances, minUnsigned(forwardDistances, _mm_xor_si128(backwardDistances, ones)));
+            minimum = minUnsigned(minimum, _mm_or_si128(sums, _mm_xor_si128(equal, ones)));
+            backwardHubs = _mm_shuffle_epi32(backwardHubs, _MM_SHUFFLE(0, 3, 2, 1));
+            backwardDistances = _mm_shuffle_epi32(backwardDistances, _MM_SHUFFLE(0, 3, 2, 1));
+        }
+
+        const uint32_t forwardLast = forward.hubs[i + 3];
+        const uint32_t backwardLast = backward.hubs[j + 3];
+        i += forwardLast <= backwardLast ? 4 : 0;
+        j += backwardLast <= forwardLast ? 4 : 0;
+    }
+
+    alignas(16) uint32_t lanes[4];
+    _mm_store_si128(reinterpret_cast<__m128i*>(lanes), minimum);
+    best = *std::min_element(lanes, lanes + 4);
+#endif
+
+    const HubLabels::Label forwardRest{forward.hubs + i, forward.distances + i, forward.size - i};
+    const HubLabels::Label backwardRest{backward.hubs + j, backward.distances + j, backward.size - j};
+    return std::min(best, intersectMerge(forwardRest, backwardRest));
+}
+
+//______________________________________________________________________________________________________________________
+unsigned int HLDistanceQueryManager::intersectCompressed(
+        const HubLabels::CompressedLabel& forward,
+        const HubLabels::CompressedLabel& backward) {
+    uint64_t best = UINT_MAX;
+    const uint8_t* forwardPosition = forward.begin;
+    const uint8_t* backwardPosition = backward.begin;
+    if (forwardPosition == forward.end || backwardPosition == backward.end) {
+        return UINT_MAX;
+    }
+
+    uint32_t forwardHub = 0;
+    uint32_t forwardDistance;
+    uint32_t backwardHub = 0;
+    uint32_t backwardDistance;
+    HubLabels::decode(forwardPosition, forwardHub, forwardDistance);
+    HubLabels::decode(backwardPosition, backwardHub, backwardDistance);
+    while (true) {
+        if (forwardHub == backwardHub) {
+            best = std::min(best, static_cast<uint64_t>(forwardDistance) + backwardDistance);
+        }
+        if (forwardHub <= backwardHub) {
+            if (forwardPosition == forward.end) {
+                break;
+            }
+            HubLabels::decode(forwardPosition, forwardHub, forwardDistance);
+        } else {
+            if (backwardPosition == backward.end) {
+                break;
+            }
+            HubLabels::decode(backwardPosition, backwardHub, backwardDistance);
+        }
+    }
+    return static_cast<unsigned int>(best);
+}
@@ -0,0 +1,93 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Czech Technical University in Prague
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. */
+
+/******************************************************************************
+* File:             HLDistanceQueryManager.h
+*
+* Description:      Distance queries using the hub labels
+*****************************************************************************/
+
+#ifndef SHORTEST_PATHS_HLDISTANCEQUERYMANAGER_H
+#define SHORTEST_PATHS_HLDISTANCEQUERYMANAGER_H
+
+#include "Structures/HubLabels.h"
+
+/**
+ * Answers the distance queries using the hub labels: the distance is the minimum of forward(start)[h] + backward(goal)[h]
+ * over the hubs h common to the forward label of the start node and the backward label of the goal node. Both labels
+ * are sorted by the hub, so the common hubs are found by a single merge-like pass over the two labels.
+ *
+ * The SIMD variant compares blocks of 8 (AVX2) or 4 (SSE2) hubs of one label with all the rotations of a block of the
+ * other label and keeps the minimum of the matched sums in a vector register, the rest of the labels is merged
+ * the same way as in the scalar variant. Compressed labels are always decoded and merged in the scalar way.
+ *
+ * The manager does not have any query state, the labels are only read, so one manager can be used by any number of
+ * threads.
+ */
+class HLDistanceQueryManager {
+public:
+    /**
+     * The way the two labels are intersected.
+     */
+    enum class Intersection {
+        MERGE,
+        SIMD
+    };
+
+    /**
+     * A simple constructor.
+     *
+     * @param labels[in] The labels, they must outlive the manager.
+     * @param intersection[in] The intersection variant used for uncompressed labels. The SIMD variant falls back to
+     * the merge if the library was compiled without SSE2 or AVX2 support.
+     */
+    explicit HLDistanceQueryManager(const HubLabels& labels, Intersection intersection = Intersection::SIMD);
+
+    /**
+     * Finds the shortest distance.
+     *
+     * @param start[in] The start node for the query.
+     * @param goal[in] The goal node for the query.
+     * @return Returns the shortest distance from start to goal or 'UINT_MAX' if goal is not reachable from start.
+     */
+    [[nodiscard]] unsigned int findDistance(unsigned int start, unsigned int goal) const;
+
+    /**
+     * @return The name of the instruction set used by the SIMD variant ("AVX2", "SSE2" or "none").
+     */
+    static const char* simdInstructionSet();
+
+private:
+    static unsigned int intersectMerge(const HubLabels::Label& forward, const HubLabels::Label& backward);
+
+    static unsigned int intersectSimd(const HubLabels::Label& forward, const HubLabels::Label& backward);
+
+    static unsigned int intersectCompressed(
+            const HubLabels::CompressedLabel& forward,
+            const HubLabels::CompressedLabel& backward);
+
+    const HubLabels& labels;
+    Intersection intersection;
+};
+
+#endif //SHORTEST_PATHS_HLDISTANCEQUERYMANAGER_H
@@ -0,0 +1,186 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Czech Technical University in Prague
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. */
+
+/******************************************************************************
+* File:             HubLabelsBuilder.cpp
+*****************************************************************************/
+
+#include <algorithm>
+#include <climits>
+#include <functional>
+#include <numeric>
+#include <utility>
+#include <boost/numeric/conversion/cast.hpp>
+#include "HubLabelsBuilder.h"
+
+/**
+ * The search state of one thread, reused by all the searches of the thread. The arrays are invalidated by increasing
+ * the stamp, so a search only touches the nodes it reaches.
+ */
+class HubLabelsBuilder::Workspace {
+public:
+    explicit Workspace(unsigned int nodes) : distances(nodes, UINT_MAX), stamps(nodes, 0),
+                                             hubDistances(nodes, UINT_MAX), hubStamps(nodes, 0) {
+    }
+
+    /**
+     * Runs the pruned upward search from the source and returns its label sorted by the hub.
+     */
+    std::vector<HubLabelEntry> computeLabel(
+            FlagsGraph<NodeData>& graph,
+            const std::vector<unsigned int>& positions,
+            unsigned int source,
+            bool forward,
+            const std::vector<std::vector<HubLabelEntry>>& opposite) {
+        if (++currentStamp == 0) {
+            std::fill(stamps.begin(), stamps.end(), 0);
+            std::fill(hubStamps.begin(), hubStamps.end(), 0);
+            currentStamp = 1;
+        }
+
+        std::vector<HubLabelEntry> label;
+        const auto greater = std::greater<std::pair<dist_t, unsigned int>>();
+        stamps[source] = currentStamp;
+        distances[source] = 0;
+        heap.emplace_back(0, source);
+        while (! heap.empty()) {
+            std::pop_heap(heap.begin(), heap.end(), greater);
+            const auto [length, node] = heap.back();
+            heap.pop_back();
+            if (length > distances[node] || (node != source && pruned(length, opposite[node]))) {
+                continue;
+            }
+
+            const unsigned int hub = positions[node];
+            label.push_back(HubLabelEntry{hub, length});
+            hubStamps[hub] = currentStamp;
+            hubDistances[hub] = length;
+
+            for (const QueryEdge& edge : graph.nextNodes(node)) {
+                if (! (forward ? edge.forward : edge.backward)) {
+                    continue;
+                }
+
+                const dist_t newLength = length + edge.weight;
+                if (stamps[edge.targetNode] == currentStamp && newLength >= distances[edge.targetNode]) {
+                    continue;
+                }
+                stamps[edge.targetNode] = currentStamp;
+                distances[edge.targetNode] = newLength;
+                heap.emplace_back(newLength, edge.targetNode);
+                std::push_heap(heap.begin(), heap.end(), greater);
+            }
+        }
+
+        std::sort(label.begin(), label.end(), [](const HubLabelEntry& a, const HubLabelEntry& b) {
+            return a.hub < b.hub;
+        });
+        return label;
+    }
+
+private:
+    // true if the label computed so far and the finished label of the settled node give a shorter distance
+    bool pruned(dist_t length, const std::vector<HubLabelEntry>& nodeLabel) const {
+        for (const HubLabelEntry& entry : nodeLabel) {
+            if (hubStamps[entry.hub] == currentStamp
+                && static_cast<uint64_t>(hubDistances[entry.hub]) + entry.distance < length) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    std::vector<dist_t> distances;
+    std::vector<unsigned int> stamps;
+    std::vector<dist_t> hubDistances;
+    std::vector<unsigned int> hubStamps;
+    unsigned int currentStamp = 0;
+    std::vector<std::pair<dist_t, unsigned int>> heap;
+};
+
+//______________________________________________________________________________________________________________________
+HubLabels HubLabelsBuilder::build(
+        FlagsGraph<NodeData>& graph,
+        bool compressed) {
+    std::vector<std::vector<HubLabelEntry>> forward;
+    std::vector<std::vector<HubLabelEntry>> backward;
+    computeLabels(graph, forward, backward);
+    return HubLabels::create(forward, backward, compressed);
+}
+
+//______________________________________________________________________________________________________________________
+void HubLabelsBuilder::computeLabels(
+        FlagsGraph<NodeData>& graph,
+        std::vector<std::vector<HubLabelEntry>>& forward,
+        std::vector<std::vector<HubLabelEntry>>& backward) {
+    const unsigned int nodes = graph.nodes();
+
+    // the hubs are numbered by the rank, so that the position of a hub is the same in all the labels
+    std::vector<unsigned int> order(nodes);
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&graph](unsigned int a, unsigned int b) {
+        return std::make_pair(graph.data(a).rank, a) < std::make_pair(graph.data(b).rank, b);
+    });
+    std::vector<unsigned int> positions(nodes);
+    for (unsigned int i = 0; i < nodes; i++) {
+        positions[order[i]] = i;
+    }
+
+    const std::vector<std::vector<unsigned int>> levels = computeLevels(graph, order);
+
+    forward.assign(nodes, std::vector<HubLabelEntry>());
+    backward.assign(nodes, std::vector<HubLabelEntry>());
+    #pragma omp parallel
+    {
+        Workspace workspace(nodes);
+        for (const std::vector<unsigned int>& level : levels) {
+            const int levelSize = boost::numeric_cast<int>(level.size());
+            #pragma omp for schedule(dynamic, 16)
+            for (int i = 0; i < levelSize; i++) {
+                const unsigned int node = level[i];
+                forward[node] = workspace.computeLabel(graph, positions, node, true, backward);
+                backward[node] = workspace.computeLabel(graph, positions, node, false, forward);
+            }
+        }
+    }
+}
+
+//______________________________________________________________________________________________________________________
+std::vector<std::vector<unsigned int>> HubLabelsBuilder::computeLevels(
+        FlagsGraph<NodeData>& graph,
+        const std::vector<unsigned int>& order) {
+    std::vector<unsigned int> nodeLevels(graph.nodes(), 0);
+    std::vector<std::vector<unsigned int>> levels;
+    for (auto it = order.rbegin(); it != order.rend(); ++it) {
+        unsigned int level = 0;
+        for (const QueryEdge& edge : graph.nextNodes(*it)) {
+            level = std::max(level, nodeLevels[edge.targetNode] + 1);
+        }
+        nodeLevels[*it] = level;
+        if (level >= levels.size()) {
+            levels.resize(level + 1);
+        }
+        levels[level].push_back(*it);
+    }
+    return levels;
+}
@@ -0,0 +1,86 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Czech Technical University in Prague
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. */
+
+/******************************************************************************
+* File:             HubLabelsBuilder.h
+*
+* Description:      Computation of the hub labels from a Contraction Hierarchy
+*****************************************************************************/
+
+#ifndef SHORTEST_PATHS_HUBLABELSBUILDER_H
+#define SHORTEST_PATHS_HUBLABELSBUILDER_H
+
+#include <vector>
+#include "Structures/HubLabels.h"
+#include "../GraphBuilding/Structures/FlagsGraph.h"
+
+/**
+ * Computes the hub labels from a Contraction Hierarchy as described in "A Hub-Based Labeling Algorithm for Shortest
+ * Paths on Road Networks" by Ittai Abraham, Daniel Delling, Andrew V. Goldberg and Renato F. Werneck. The forward
+ * label of a node is its forward upward search space, the backward label its backward upward search space.
+ *
+ * The labels are pruned while they are being computed: when the upward search from a node settles a node u, the
+ * distance is checked with a label query between the part of the label computed so far and the (already finished)
+ * label of u in the opposite direction. If the query finds a shorter path, the distance to u is not a shortest
+ * distance, u is not added to the label and the search does not continue from u. Such nodes are never needed by the
+ * queries, so the pruned labels answer all queries correctly and are usually several times smaller.
+ *
+ * The labels of all the nodes a search reaches have to be finished before the search starts, so the nodes are split
+ * into levels by the height above them in the hierarchy: the nodes without any upward edges form the level 0 and every
+ * other node is one level below its highest upward neighbour. The levels are processed from the top of the hierarchy
+ * in order, the nodes of one level are independent and are processed in parallel using OpenMP.
+ */
+class HubLabelsBuilder {
+public:
+    /**
+     * Computes the labels.
+     *
+     * @param graph[in] The Contraction Hierarchy, each edge stored at its lower ranked endpoint.
+     * @param compressed[in] Whether to use the compressed layout for the result.
+     * @return The labels. The hubs are identified by their position in the order of the nodes by the rank.
+     */
+    static HubLabels build(
+            FlagsGraph<NodeData>& graph,
+            bool compressed);
+
+    /**
+     * Computes the labels of the individual nodes, sorted by the hub.
+     *
+     * @param graph[in] The Contraction Hierarchy, each edge stored at its lower ranked endpoint.
+     * @param forward[out] The forward labels.
+     * @param backward[out] The backward labels.
+     */
+    static void computeLabels(
+            FlagsGraph<NodeData>& graph,
+            std::vector<std::vector<HubLabelEntry>>& forward,
+            std::vector<std::vector<HubLabelEntry>>& backward);
+
+private:
+    class Workspace;
+
+    static std::vector<std::vector<unsigned int>> computeLevels(
+            FlagsGraph<NodeData>& graph,
+            const std::vector<unsigned int>& order);
+};
+
+#endif //SHORTEST_PATHS_HUBLABELSBUILDER_H
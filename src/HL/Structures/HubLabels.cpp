@@ -0,0 +1,251 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Czech Technical University in Prague
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. */
+
+/******************************************************************************
+* File:             HubLabels.cpp
+*****************************************************************************/
+
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include "HubLabels.h"
+
+namespace {
+    constexpr char magic[4] = {'H', 'L', 'B', '1'};
+    constexpr uint32_t compressedFlag = 1;
+
+    // magic, nodes, flags, reserved, entries and payload bytes of both directions
+    constexpr size_t headerSize = 4 + 3 * sizeof(uint32_t) + 4 * sizeof(uint64_t);
+
+    size_t padded(size_t bytes) {
+        return (bytes + 7) / 8 * 8;
+    }
+
+    void writeVarint(std::vector<uint8_t>& output, uint32_t value) {
+        while (value >= 0x80u) {
+            output.push_back(static_cast<uint8_t>(value | 0x80u));
+            value >>= 7;
+        }
+        output.push_back(static_cast<uint8_t>(value));
+    }
+
+    // The payload of one direction: the hubs and the distances, or the encoded bytes in the compressed layout.
+    struct Payload {
+        std::vector<uint64_t> offsets;
+        std::vector<uint32_t> hubs;
+        std::vector<uint32_t> distances;
+        std::vector<uint8_t> bytes;
+        uint64_t entries = 0;
+
+        [[nodiscard]] size_t fileSize(bool compressed) const {
+            const size_t payload = compressed ? padded(bytes.size())
+                                              : 2 * padded(hubs.size() * sizeof(uint32_t));
+            return offsets.size() * sizeof(uint64_t) + payload;
+        }
+    };
+
+    Payload buildPayload(const std::vector<std::vector<HubLabelEntry>>& labels, bool compressed) {
+        Payload payload;
+        payload.offsets.reserve(labels.size() + 1);
+        payload.offsets.push_back(0);
+        for (const auto& label : labels) {
+            payload.entries += label.size();
+            if (compressed) {
+                uint32_t previousHub = 0;
+                for (const HubLabelEntry& entry : label) {
+                    writeVarint(payload.bytes, entry.hub - previousHub);
+                    writeVarint(payload.bytes, entry.distance);
+                    previousHub = entry.hub;
+                }
+                payload.offsets.push_back(payload.bytes.size());
+            } else {
+                for (const HubLabelEntry& entry : label) {
+                    payload.hubs.push_back(entry.hub);
+                    payload.distances.push_back(entry.distance);
+                }
+                payload.offsets.push_back(payload.hubs.size());
+            }
+        }
+        return payload;
+    }
+
+    char* copyPadded(char* position, const void* source, size_t bytes) {
+        std::memcpy(position, source, bytes);
+        return position + padded(bytes);
+    }
+}
+
+//______________________________________________________________________________________________________________________
+HubLabels::HubLabels() : data(nullptr), size(0), nodesCnt(0), isCompressed(false) {
+}
+
+//______________________________________________________________________________________________________________________
+HubLabels::HubLabels(HubLabels&& other) noexcept = default;
+
+//______________________________________________________________________________________________________________________
+HubLabels& HubLabels::operator=(HubLabels&& other) noexcept = default;
+
+//______________________________________________________________________________________________________________________
+HubLabels::~HubLabels() = default;
+
+//______________________________________________________________________________________________________________________
+HubLabels HubLabels::create(
+        const std::vector<std::vector<HubLabelEntry>>& forward,
+        const std::vector<std::vector<HubLabelEntry>>& backward,
+        bool compressed) {
+    const Payload payloads[2] = {buildPayload(forward, compressed), buildPayload(backward, compressed)};
+
+    HubLabels labels;
+    labels.size = headerSize + payloads[0].fileSize(compressed) + payloads[1].fileSize(compressed);
+    labels.buffer.assign((labels.size + 7) / 8, 0);
+    char* position = reinterpret_cast<char*>(labels.buffer.data());
+
+    const auto nodes = static_cast<uint32_t>(forward.size());
+    const uint32_t flags = compressed ? compressedFlag : 0;
+    const uint32_t reserved = 0;
+    std::memcpy(position, magic, sizeof(magic));
+    std::memcpy(position + 4, &nodes, sizeof(nodes));
+    std::memcpy(position + 8, &flags, sizeof(flags));
+    std::memcpy(position + 12, &reserved, sizeof(reserved));
+    for (unsigned int direction = 0; direction < 2; direction++) {
+        const uint64_t bytes = payloads[direction].bytes.size();
+        std::memcpy(position + 16 + 8 * direction, &payloads[direction].entries, sizeof(uint64_t));
+        std::memcpy(position + 32 + 8 * direction, &bytes, sizeof(uint64_t));
+    }
+    position += headerSize;
+
+    for (const Payload& payload : payloads) {
+        position = copyPadded(position, payload.offsets.data(), payload.offsets.size() * sizeof(uint64_t));
+        if (compressed) {
+            position = copyPadded(position, payload.bytes.data(), payload.bytes.size());
+        } else {
+            position = copyPadded(position, payload.hubs.data(), payload.hubs.size() * sizeof(uint32_t));
+            position = copyPadded(position, payload.distances.data(), payload.distances.size() * sizeof(uint32_t));
+        }
+    }
+
+    labels.data = reinterpret_cast<const char*>(labels.buffer.data());
+    labels.parse();
+    return labels;
+}
+
+//______________________________________________________________________________________________________________________
+HubLabels HubLabels::load(const std::string& path, bool mapped) {
+    HubLabels labels;
+    if (mapped) {
+        try {
+            const boost::interprocess::file_mapping file(path.c_str(), boost::interprocess::read_only);
+            labels.region = std::make_unique<boost::interprocess::mapped_region>(file, boost::interprocess::read_only);
+        } catch (const boost::interprocess::interprocess_exception& e) {
+            throw std::runtime_error("Couldn't map file '" + path + "': " + e.what());
+        }
+        labels.data = static_cast<const char*>(labels.region->get_address());
+        labels.size = labels.region->get_size();
+    } else {
+        std::ifstream input(path, std::ios::binary | std::ios::ate);
+        if (!input.is_open()) {
+            throw std::runtime_error("Couldn't open file '" + path + "'!");
+        }
+        labels.size = static_cast<size_t>(input.tellg());
+        labels.buffer.resize((labels.size + 7) / 8);
+        input.seekg(0);
+        input.read(reinterpret_cast<char*>(labels.buffer.data()), static_cast<std::streamsize>(labels.size));
+        if (!input) {
+            throw std::runtime_error("Couldn't read file '" + path + "'!");
+        }
+        labels.data = reinterpret_cast<const char*>(labels.buffer.data());
+    }
+
+    labels.parse();
+    return labels;
+}
+
+//______________________________________________________________________________________________________________________
+void HubLabels::write(std::ostream& output) const {
+    output.write(data, static_cast<std::streamsize>(size));
+}
+
+//______________________________________________________________________________________________________________________
+unsigned int HubLabels::nodes() const {
+    return nodesCnt;
+}
+
+//______________________________________________________________________________________________________________________
+bool HubLabels::compressed() const {
+    return isCompressed;
+}
+
+//______________________________________________________________________________________________________________________
+uint64_t HubLabels::entries(bool forward) const {
+    return directions[forward ? 0 : 1].entries;
+}
+
+//______________________________________________________________________________________________________________________
+size_t HubLabels::memoryUsage() const {
+    return size;
+}
+
+//______________________________________________________________________________________________________________________
+void HubLabels::parse() {
+    if (size < headerSize || std::memcmp(data, magic, sizeof(magic)) != 0) {
+        throw std::runtime_error("The input file is missing the Hub Labels header.");
+    }
+
+    uint32_t flags;
+    uint64_t bytes[2];
+    std::memcpy(&nodesCnt, data + 4, sizeof(nodesCnt));
+    std::memcpy(&flags, data + 8, sizeof(flags));
+    isCompressed = (flags & compressedFlag) != 0;
+
+    size_t position = headerSize;
+    for (unsigned int direction = 0; direction < 2; direction++) {
+        Direction& current = directions[direction];
+        std::memcpy(&current.entries, data + 16 + 8 * direction, sizeof(uint64_t));
+        std::memcpy(&bytes[direction], data + 32 + 8 * direction, sizeof(uint64_t));
+
+        const size_t offsetsSize = (static_cast<size_t>(nodesCnt) + 1) * sizeof(uint64_t);
+        const size_t payloadSize = isCompressed ? padded(bytes[direction])
+                                                : 2 * padded(current.entries * sizeof(uint32_t));
+        if (position + offsetsSize + payloadSize > size) {
+            throw std::runtime_error("The Hub Labels file is truncated.");
+        }
+
+        // every section starts at a multiple of 8 bytes and the data are at least 8-byte aligned
+        current.offsets = reinterpret_cast<const uint64_t*>(data + position);
+        position += offsetsSize;
+        if (isCompressed) {
+            current.bytes = reinterpret_cast<const uint8_t*>(data + position);
+        } else {
+            current.hubs = reinterpret_cast<const uint32_t*>(data + position);
+            current.distances = reinterpret_cast<const uint32_t*>(data + position + padded(current.entries * sizeof(uint32_t)));
+        }
+        position += payloadSize;
+
+        const uint64_t expectedEnd = isCompressed ? bytes[direction] : current.entries;
+        if (current.offsets[0] != 0 || current.offsets[nodesCnt] != expectedEnd) {
+            throw std::runtime_error("The Hub Labels file is corrupted.");
+        }
+    }
+}
@@ -0,0 +1,220 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Czech Technical University in Prague
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. */
+
+/******************************************************************************
+* File:             HubLabels.h
+*
+* Description:      Forward and backward hub labels in a flat, memory-mappable
+*                   layout
+*****************************************************************************/
+
+#ifndef SHORTEST_PATHS_HUBLABELS_H
+#define SHORTEST_PATHS_HUBLABELS_H
+
+#include <cstdint>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace boost::interprocess {
+    class mapped_region;
+}
+
+/**
+ * One entry of a hub label: the hub (identified by its position in the Contraction Hierarchy order, so that the hubs
+ * of all labels are sorted the same way) and the distance between the node and the hub.
+ */
+struct HubLabelEntry {
+    uint32_t hub;
+    uint32_t distance;
+};
+
+/**
+ * The forward and backward hub labels of all nodes. The forward label of a node contains the distances from the node
+ * to its hubs, the backward label the distances from the hubs to the node. The shortest distance from s to t is the
+ * minimum of forward(s)[h] + backward(t)[h] over the hubs h common to both labels.
+ *
+ * The labels are kept in exactly the same layout as in the '.hl' file (see FORMATS.md), so a loaded file can be
+ * either read into memory or memory-mapped and used directly. For each direction, there is an offset array followed
+ * either by the hubs and the distances as two separate arrays of 32-bit values (so that the hubs can be compared
+ * using SIMD instructions), or, in the compressed variant, by a byte stream with the hub deltas and the distances
+ * encoded as variable-length integers.
+ *
+ * The labels are read-only, any number of query managers (threads) can share one instance.
+ */
+class HubLabels {
+public:
+    /**
+     * A label in the uncompressed layout.
+     */
+    struct Label {
+        const uint32_t* hubs;
+        const uint32_t* distances;
+        size_t size;
+    };
+
+    /**
+     * A label in the compressed layout: the encoded bytes [begin, end).
+     */
+    struct CompressedLabel {
+        const uint8_t* begin;
+        const uint8_t* end;
+    };
+
+    HubLabels();
+
+    HubLabels(HubLabels&& other) noexcept;
+
+    HubLabels& operator=(HubLabels&& other) noexcept;
+
+    HubLabels(const HubLabels&) = delete;
+
+    HubLabels& operator=(const HubLabels&) = delete;
+
+    ~HubLabels();
+
+    /**
+     * Creates the flat layout from the labels of the individual nodes.
+     *
+     * @param forward[in] The forward labels, each sorted by the hub.
+     * @param backward[in] The backward labels, each sorted by the hub.
+     * @param compressed[in] Whether to use the compressed layout.
+     * @return The labels.
+     */
+    static HubLabels create(
+            const std::vector<std::vector<HubLabelEntry>>& forward,
+            const std::vector<std::vector<HubLabelEntry>>& backward,
+            bool compressed);
+
+    /**
+     * Loads the labels from a file written by 'write'.
+     *
+     * @param path[in] The path to the '.hl' file.
+     * @param mapped[in] If true, the file is memory-mapped instead of read into memory, so its pages are shared by all
+     * the processes using the same file and only the touched pages are ever loaded.
+     * @return The labels.
+     */
+    static HubLabels load(const std::string& path, bool mapped);
+
+    /**
+     * Writes the labels in the '.hl' format.
+     *
+     * @param output[in] The binary output stream.
+     */
+    void write(std::ostream& output) const;
+
+    /**
+     * @return The number of nodes.
+     */
+    [[nodiscard]] unsigned int nodes() const;
+
+    /**
+     * @return True if the labels use the compressed layout.
+     */
+    [[nodiscard]] bool compressed() const;
+
+    /**
+     * @param forward[in] True for the forward labels, false for the backward labels.
+     * @return The number of entries of all the labels in the given direction.
+     */
+    [[nodiscard]] uint64_t entries(bool forward) const;
+
+    /**
+     * @return The size of the labels in bytes (the same as the size of the file).
+     */
+    [[nodiscard]] size_t memoryUsage() const;
+
+    /**
+     * Returns a label in the uncompressed layout, must not be called for compressed labels.
+     *
+     * @param node[in] The node.
+     * @param forward[in] True for the forward label, false for the backward label.
+     * @return The label.
+     */
+    [[nodiscard]] Label label(unsigned int node, bool forward) const {
+        const uint64_t* offsets = directions[forward ? 0 : 1].offsets;
+        const size_t begin = offsets[node];
+        return Label{directions[forward ? 0 : 1].hubs + begin, directions[forward ? 0 : 1].distances + begin,
+                     static_cast<size_t>(offsets[node + 1] - begin)};
+    }
+
+    /**
+     * Returns a label in the compressed layout, must not be called for uncompressed labels.
+     *
+     * @param node[in] The node.
+     * @param forward[in] True for the forward label, false for the backward label.
+     * @return The label.
+     */
+    [[nodiscard]] CompressedLabel compressedLabel(unsigned int node, bool forward) const {
+        const uint64_t* offsets = directions[forward ? 0 : 1].offsets;
+        const uint8_t* bytes = directions[forward ? 0 : 1].bytes;
+        return CompressedLabel{bytes + offsets[node], bytes + offsets[node + 1]};
+    }
+
+    /**
+     * Decodes one entry of a compressed label.
+     *
+     * @param position[in, out] The position of the entry, moved after the entry.
+     * @param hub[in, out] The hub of the previous entry (0 before the first one), replaced by the hub of this entry.
+     * @param distance[out] The distance of this entry.
+     */
+    static void decode(const uint8_t*& position, uint32_t& hub, uint32_t& distance) {
+        hub += readVarint(position);
+        distance = readVarint(position);
+    }
+
+private:
+    struct Direction {
+        const uint64_t* offsets = nullptr;
+        const uint32_t* hubs = nullptr;
+        const uint32_t* distances = nullptr;
+        const uint8_t* bytes = nullptr;
+        uint64_t entries = 0;
+    };
+
+    static uint32_t readVarint(const uint8_t*& position) {
+        uint32_t value = *position & 0x7Fu;
+        unsigned int shift = 7;
+        while (*position++ & 0x80u) {
+            value |= static_cast<uint32_t>(*position & 0x7Fu) << shift;
+            shift += 7;
+        }
+        return value;
+    }
+
+    void parse();
+
+    // either 'buffer' (created or read labels) or 'region' (mapped file) holds the data 'data' points to
+    std::vector<uint64_t> buffer;
+    std::unique_ptr<boost::interprocess::mapped_region> region;
+    const char* data;
+    size_t size;
+
+    unsigned int nodesCnt;
+    bool isCompressed;
+    Direction directions[2];
+};
+
+#endif //SHORTEST_PATHS_HUBLABELS_H
@@ -0,0 +1,487 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Czech Technical University in Prague
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. */
+
+/******************************************************************************
+* File:             shortestPathsModule.cpp
+*
+* Description:      Native Python extension module exposing the query managers
+*                   of the library with batch queries over NumPy arrays
+*****************************************************************************/
+
+#define PY_SSIZE_T_CLEAN
+#include <Python.h>
+
+#include <algorithm>
+#include <climits>
+#include <cstring>
+#include <exception>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <omp.h>
+#include "API/CHDistanceQueryManagerAPI.h"
+#include "API/TNRDistanceQueryManagerAPI.h"
+#include "API/TNRAFDistanceQueryManagerAPI.h"
+#include "API/DMDistanceQueryManagerAPI.h"
+
+// The module only uses the buffer protocol, so it does not depend on the NumPy headers. The conversion of the inputs
+// to contiguous int64 arrays and the allocation of the results is done by the 'shortestdistances.queries' wrapper.
+
+namespace {
+
+/**
+ * Translates the given exception to the corresponding Python exception. Unknown node IDs (the mapping throws
+ * 'std::out_of_range') are reported as 'KeyError', everything else as 'RuntimeError'.
+ */
+void setPythonError(const std::exception_ptr& error) {
+    try {
+        std::rethrow_exception(error);
+    } catch (const std::out_of_range& e) {
+        PyErr_SetString(PyExc_KeyError, e.what());
+    } catch (const std::exception& e) {
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+    } catch (...) {
+        PyErr_SetString(PyExc_RuntimeError, "Unknown C++ exception.");
+    }
+}
+
+/**
+ * A contiguous one-dimensional buffer of 64-bit signed integers obtained through the buffer protocol. The buffer is
+ * released in the destructor.
+ */
+class Int64Buffer {
+public:
+    Int64Buffer() = default;
+    Int64Buffer(const Int64Buffer&) = delete;
+    Int64Buffer& operator=(const Int64Buffer&) = delete;
+
+    ~Int64Buffer() {
+        if (acquired) {
+            PyBuffer_Release(&view);
+        }
+    }
+
+    /**
+     * Acquires the buffer of the given object. Sets a Python exception and returns false if the object does not
+     * provide a C-contiguous buffer of native 64-bit signed integers.
+     *
+     * @param object[in] The object providing the buffer (usually a NumPy array).
+     * @param writable[in] Whether the buffer is written to.
+     * @param name[in] The name of the argument used in the error messages.
+     */
+    bool acquire(PyObject* object, bool writable, const char* name) {
+        const int flags = PyBUF_C_CONTIGUOUS | PyBUF_FORMAT | (writable ? PyBUF_WRITABLE : 0);
+        if (PyObject_GetBuffer(object, &view, flags) != 0) {
+            return false;
+        }
+        acquired = true;
+
+        const char* format = view.format ? view.format : "B";
+        if (*format == '@' || *format == '=' || (*format == '<' && PY_LITTLE_ENDIAN)) {
+            ++format;
+        }
+        if (view.itemsize != 8 || (std::strcmp(format, "q") != 0 && std::strcmp(format, "l") != 0)) {
+            PyErr_Format(PyExc_TypeError, "'%s' has to be a contiguous array of int64 values.", name);
+            return false;
+        }
+        return true;
+    }
+
+    Py_ssize_t size() const {
+        return view.len / view.itemsize;
+    }
+
+    long long* data() const {
+        return static_cast<long long*>(view.buf);
+    }
+
+private:
+    Py_buffer view = {};
+    bool acquired = false;
+};
+
+/**
+ * The methods whose API classes answer the batches themselves using the 'BatchQueryExecutor'.
+ */
+template <class APIClass>
+struct ExecutorMethod {
+    using API = APIClass;
+
+    static void distanceQueries(API& api, unsigned int, const long long* s, const long long* g, long long* d, int n) {
+        api.distanceQueries(s, g, d, n);
+    }
+
+    static void setThreads(API& api, unsigned int threads) {
+        api.setThreads(threads);
+    }
+};
+
+//______________________________________________________________________________________________________________________
+struct CHMethod : ExecutorMethod<CHDistanceQueryManagerAPI> {
+    static constexpr const char* typeName = "_shortestpaths.CHQueryManager";
+
+    static void initialize(API& api, const std::string& structureFile, const std::string& mappingFile) {
+        api.initializeCH(structureFile, mappingFile);
+    }
+};
+
+//______________________________________________________________________________________________________________________
+struct TNRMethod : ExecutorMethod<TNRDistanceQueryManagerAPI> {
+    static constexpr const char* typeName = "_shortestpaths.TNRQueryManager";
+
+    static void initialize(API& api, const std::string& structureFile, const std::string& mappingFile) {
+        api.initializeTNR(structureFile, mappingFile);
+    }
+};
+
+//______________________________________________________________________________________________________________________
+struct TNRAFMethod : ExecutorMethod<TNRAFDistanceQueryManagerAPI> {
+    static constexpr const char* typeName = "_shortestpaths.TNRAFQueryManager";
+
+    static void initialize(API& api, const std::string& structureFile, const std::string& mappingFile) {
+        api.initializeTNRAF(structureFile, mappingFile);
+    }
+};
+
+//______________________________________________________________________________________________________________________
+struct DMMethod {
+    using API = DMDistanceQueryManagerAPI;
+    static constexpr const char* typeName = "_shortestpaths.DMQueryManager";
+
+    static void initialize(API& api, const std::string& structureFile, const std::string& mappingFile) {
+        api.initializeDM(structureFile, mappingFile);
+    }
+
+    // The distance matrix lookups do not modify any state, so the threads can share the matrix.
+    static void distanceQueries(
+            API& api,
+            unsigned int threads,
+            const long long* s,
+            const long long* g,
+            long long* d,
+            int n) {
+        std::exception_ptr error = nullptr;
+
+        #pragma omp parallel for num_threads(static_cast<int>(threads)) schedule(static)
+        for (int i = 0; i < n; ++i) {
+            try {
+                d[i] = api.distanceQuery(
+                        static_cast<long long unsigned int>(s[i]),
+                        static_cast<long long unsigned int>(g[i]));
+            } catch (...) {
+                #pragma omp critical
+                if (!error) {
+                    error = std::current_exception();
+                }
+            }
+        }
+
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+
+    static void setThreads(API&, unsigned int) {}
+};
+
+/**
+ * The Python object wrapping one of the API classes. The API object (including 'initialized' and 'threads') is only
+ * used with the mutex locked, see 'callLocked'.
+ */
+template <class Method>
+struct QueryManagerObject {
+    PyObject_HEAD
+    typename Method::API* api;
+    std::mutex* mutex;
+    bool initialized;
+    unsigned int threads;
+};
+
+//______________________________________________________________________________________________________________________
+template <class Method>
+void clearStructures(QueryManagerObject<Method>* self) {
+    if (self->initialized) {
+        self->api->clearStructures();
+        self->initialized = false;
+    }
+}
+
+//______________________________________________________________________________________________________________________
+template <class Method>
+void checkInitialized(QueryManagerObject<Method>* self) {
+    if (!self->initialized) {
+        throw std::runtime_error("The query manager has been closed.");
+    }
+}
+
+/**
+ * Calls 'function' with the GIL released and the mutex of the object locked. The other Python threads keep running,
+ * but only one of them uses the API object at a time: its query managers keep the state of the running query, and
+ * the structures must not be replaced or released while a batch is being answered. The mutex is only locked after
+ * the GIL is released and unlocked before the GIL is acquired again, so the two locks cannot deadlock.
+ *
+ * @return False if the function threw, the Python exception is then set.
+ */
+template <class Method, class Function>
+bool callLocked(QueryManagerObject<Method>* self, const Function& function) {
+    std::exception_ptr error = nullptr;
+    Py_BEGIN_ALLOW_THREADS
+    {
+        std::lock_guard<std::mutex> lock(*self->mutex);
+        try {
+            function();
+        } catch (...) {
+            error = std::current_exception();
+        }
+    }
+    Py_END_ALLOW_THREADS
+    if (error) {
+        setPythonError(error);
+        return false;
+    }
+    return true;
+}
+
+//______________________________________________________________________________________________________________________
+template <class Method>
+PyObject* queryManagerNew(PyTypeObject* type, PyObject*, PyObject*) {
+    auto* self = reinterpret_cast<QueryManagerObject<Method>*>(type->tp_alloc(type, 0));
+    if (self == nullptr) {
+        return nullptr;
+    }
+    self->api = new(std::nothrow) typename Method::API();
+    self->mutex = new(std::nothrow) std::mutex();
+    self->initialized = false;
+    self->threads = 1;
+    if (self->api == nullptr || self->mutex == nullptr) {
+        Py_DECREF(self);
+        return PyErr_NoMemory();
+    }
+    return reinterpret_cast<PyObject*>(self);
+}
+
+//______________________________________________________________________________________________________________________
+template <class Method>
+int queryManagerInit(PyObject* object, PyObject* args, PyObject* kwargs) {
+    auto* self = reinterpret_cast<QueryManagerObject<Method>*>(object);
+    static const char* keywords[] = {"structure_file", "mapping_file", nullptr};
+    const char* structureFile;
+    const char* mappingFile;
+    if (!PyArg_ParseTupleAndKeywords(
+            args, kwargs, "ss", const_cast<char**>(keywords), &structureFile, &mappingFile)) {
+        return -1;
+    }
+
+    const bool loaded = callLocked(self, [&]() {
+        clearStructures(self);
+        Method::initialize(*self->api, structureFile, mappingFile);
+        self->initialized = true;
+    });
+    return loaded ? 0 : -1;
+}
+
+//______________________________________________________________________________________________________________________
+template <class Method>
+void queryManagerDealloc(PyObject* object) {
+    auto* self = reinterpret_cast<QueryManagerObject<Method>*>(object);
+    PyTypeObject* type = Py_TYPE(object);
+    // No other thread can use the object any more, so the mutex does not have to be locked.
+    clearStructures(self);
+    delete self->api;
+    delete self->mutex;
+    type->tp_free(object);
+    Py_DECREF(type);
+}
+
+//______________________________________________________________________________________________________________________
+template <class Method>
+PyObject* queryManagerDistance(PyObject* object, PyObject* args) {
+    auto* self = reinterpret_cast<QueryManagerObject<Method>*>(object);
+    unsigned long long start;
+    unsigned long long goal;
+    if (!PyArg_ParseTuple(args, "KK", &start, &goal)) {
+        return nullptr;
+    }
+
+    unsigned int distance = 0;
+    if (!callLocked(self, [&]() {
+        checkInitialized(self);
+        distance = self->api->distanceQuery(start, goal);
+    })) {
+        return nullptr;
+    }
+    return PyLong_FromUnsignedLong(distance);
+}
+
+//______________________________________________________________________________________________________________________
+template <class Method>
+PyObject* queryManagerDistances(PyObject* object, PyObject* args) {
+    auto* self = reinterpret_cast<QueryManagerObject<Method>*>(object);
+    PyObject* startsObject;
+    PyObject* goalsObject;
+    PyObject* distancesObject;
+    if (!PyArg_ParseTuple(args, "OOO", &startsObject, &goalsObject, &distancesObject)) {
+        return nullptr;
+    }
+
+    Int64Buffer starts, goals, distances;
+    if (!starts.acquire(startsObject, false, "starts")
+            || !goals.acquire(goalsObject, false, "goals")
+            || !distances.acquire(distancesObject, true, "distances")) {
+        return nullptr;
+    }
+    if (starts.size() != goals.size() || starts.size() != distances.size()) {
+        PyErr_SetString(PyExc_ValueError, "'starts', 'goals' and 'distances' have to have the same length.");
+        return nullptr;
+    }
+
+    if (!callLocked(self, [&]() {
+        checkInitialized(self);
+        // The API takes the count as an int, so huge batches are split into chunks.
+        for (Py_ssize_t offset = 0; offset < starts.size(); offset += INT_MAX) {
+            const int count = static_cast<int>(std::min<Py_ssize_t>(starts.size() - offset, INT_MAX));
+            Method::distanceQueries(
+                    *self->api,
+                    self->threads,
+                    starts.data() + offset,
+                    goals.data() + offset,
+                    distances.data() + offset,
+                    count);
+        }
+    })) {
+        return nullptr;
+    }
+    Py_RETURN_NONE;
+}
+
+//______________________________________________________________________________________________________________________
+template <class Method>
+PyObject* queryManagerSetThreads(PyObject* object, PyObject* args) {
+    auto* self = reinterpret_cast<QueryManagerObject<Method>*>(object);
+    unsigned int threads;
+    if (!PyArg_ParseTuple(args, "I", &threads)) {
+        return nullptr;
+    }
+    if (threads == 0) {
+        PyErr_SetString(PyExc_ValueError, "At least one thread has to be used.");
+        return nullptr;
+    }
+
+    if (!callLocked(self, [&]() {
+        Method::setThreads(*self->api, threads);
+        self->threads = threads;
+    })) {
+        return nullptr;
+    }
+    Py_RETURN_NONE;
+}
+
+//______________________________________________________________________________________________________________________
+template <class Method>
+PyObject* queryManagerClose(PyObject* object, PyObject*) {
+    auto* self = reinterpret_cast<QueryManagerObject<Method>*>(object);
+    if (!callLocked(self, [&]() { clearStructures(self); })) {
+        return nullptr;
+    }
+    Py_RETURN_NONE;
+}
+
+//______________________________________________________________________________________________________________________
+template <class Method>
+PyTypeObject* createType() {
+    static PyMethodDef methods[] = {
+        {"distance", queryManagerDistance<Method>, METH_VARARGS,
+            "distance(start, goal)\n--\n\nReturns the distance between two nodes given by their original IDs."},
+        {"distances", queryManagerDistances<Method>, METH_VARARGS,
+            "distances(starts, goals, distances)\n--\n\nAnswers a batch of queries. All three arguments are "
+            "contiguous int64 buffers of the same length, the results are written to 'distances'. The GIL is "
+            "released while the queries are answered. Calls from other threads using the same query manager wait "
+            "until the batch is finished."},
+        {"set_threads", queryManagerSetThreads<Method>, METH_VARARGS,
+            "set_threads(threads)\n--\n\nSets the number of threads used by 'distances'."},
+        {"close", queryManagerClose<Method>, METH_NOARGS,
+            "close()\n--\n\nReleases the data structures, the query manager cannot be used afterwards."},
+        {nullptr, nullptr, 0, nullptr}
+    };
+    static PyType_Slot slots[] = {
+        {Py_tp_new, reinterpret_cast<void*>(queryManagerNew<Method>)},
+        {Py_tp_init, reinterpret_cast<void*>(queryManagerInit<Method>)},
+        {Py_tp_dealloc, reinterpret_cast<void*>(queryManagerDealloc<Method>)},
+        {Py_tp_methods, methods},
+        {0, nullptr}
+    };
+    static PyType_Spec spec = {
+        Method::typeName,
+        static_cast<int>(sizeof(QueryManagerObject<Method>)),
+        0,
+        Py_TPFLAGS_DEFAULT,
+        slots
+    };
+    return reinterpret_cast<PyTypeObject*>(PyType_FromSpec(&spec));
+}
+
+//______________________________________________________________________________________________________________________
+template <class Method>
+bool addType(PyObject* module, const char* name) {
+    PyTypeObject* type = createType<Method>();
+    if (type == nullptr) {
+        return false;
+    }
+    if (PyModule_AddObject(module, name, reinterpret_cast<PyObject*>(type)) != 0) {
+        Py_DECREF(type);
+        return false;
+    }
+    return true;
+}
+
+PyModuleDef moduleDefinition = {
+    PyModuleDef_HEAD_INIT,
+    "_shortestpaths",
+    "Native query managers of the shortest paths library. Use the 'shortestdistances.queries' module instead of "
+    "using this module directly.",
+    -1,
+    nullptr,
+    nullptr,
+    nullptr,
+    nullptr,
+    nullptr
+};
+
+}
+
+//______________________________________________________________________________________________________________________
+PyMODINIT_FUNC PyInit__shortestpaths() {
+    PyObject* module = PyModule_Create(&moduleDefinition);
+    if (module == nullptr) {
+        return nullptr;
+    }
+    if (!addType<CHMethod>(module, "CHQueryManager")
+            || !addType<TNRMethod>(module, "TNRQueryManager")
+            || !addType<TNRAFMethod>(module, "TNRAFQueryManager")
+            || !addType<DMMethod>(module, "DMQueryManager")
+            || PyModule_AddIntConstant(module, "UNREACHABLE", static_cast<long>(UINT_MAX)) != 0) {
+        Py_DECREF(module);
+        return nullptr;
+    }
+    return module;
+}
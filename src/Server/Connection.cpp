@@ -0,0 +1,142 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Czech Technical University in Prague
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. */
+
+/******************************************************************************
+* File:             Connection.cpp
+*****************************************************************************/
+
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include "Connection.h"
+
+//______________________________________________________________________________________________________________________
+Connection::Connection(int socket) : socket(socket) {
+}
+
+//______________________________________________________________________________________________________________________
+Connection::Connection(Connection&& other) noexcept
+    : socket(std::exchange(other.socket, -1)), outputBuffer(std::move(other.outputBuffer)) {
+}
+
+//______________________________________________________________________________________________________________________
+Connection& Connection::operator=(Connection&& other) noexcept {
+    if (this != &other) {
+        if (socket >= 0) {
+            close(socket);
+        }
+        socket = std::exchange(other.socket, -1);
+        outputBuffer = std::move(other.outputBuffer);
+    }
+    return *this;
+}
+
+//______________________________________________________________________________________________________________________
+Connection::~Connection() {
+    if (socket >= 0) {
+        close(socket);
+    }
+}
+
+//______________________________________________________________________________________________________________________
+Connection Connection::connect(const std::string& socketPath) {
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+    if (socketPath.size() >= sizeof(address.sun_path)) {
+        throw std::runtime_error("The socket path '" + socketPath + "' is too long.");
+    }
+    std::strcpy(address.sun_path, socketPath.c_str());
+
+    const int fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0) {
+        throw std::runtime_error(std::string("Couldn't create a socket: ") + std::strerror(errno));
+    }
+    Connection connection(fd);
+    if (::connect(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0) {
+        throw std::runtime_error("Couldn't connect to '" + socketPath + "': " + std::strerror(errno));
+    }
+    return connection;
+}
+
+//______________________________________________________________________________________________________________________
+void Connection::read(void* buffer, size_t size) {
+    if (!tryRead(buffer, size)) {
+        throw std::runtime_error("The connection was closed by the other side.");
+    }
+}
+
+//______________________________________________________________________________________________________________________
+bool Connection::tryRead(void* buffer, size_t size) {
+    char* position = static_cast<char*>(buffer);
+    size_t received = 0;
+    while (received < size) {
+        const ssize_t count = recv(socket, position + received, size - received, 0);
+        if (count < 0 && errno == EINTR) {
+            continue;
+        }
+        if (count < 0) {
+            throw std::runtime_error(std::string("Couldn't read from the socket: ") + std::strerror(errno));
+        }
+        if (count == 0) {
+            if (received == 0) {
+                return false;
+            }
+            throw std::runtime_error("The connection was closed in the middle of a message.");
+        }
+        received += static_cast<size_t>(count);
+    }
+    return true;
+}
+
+//______________________________________________________________________________________________________________________
+void Connection::write(const void* data, size_t size) {
+    const char* bytes = static_cast<const char*>(data);
+    outputBuffer.insert(outputBuffer.end(), bytes, bytes + size);
+}
+
+//______________________________________________________________________________________________________________________
+void Connection::flush() {
+    size_t sent = 0;
+    while (sent < outputBuffer.size()) {
+        // MSG_NOSIGNAL: a closed peer results in EPIPE instead of killing the process with SIGPIPE
+        const ssize_t count = send(socket, outputBuffer.data() + sent, outputBuffer.size() - sent, MSG_NOSIGNAL);
+        if (count < 0 && errno == EINTR) {
+            continue;
+        }
+        if (count < 0) {
+            outputBuffer.clear();
+            throw std::runtime_error(std::string("Couldn't write to the socket: ") + std::strerror(errno));
+        }
+        sent += static_cast<size_t>(count);
+    }
+    outputBuffer.clear();
+}
+
+//______________________________________________________________________________________________________________________
+void Connection::shutdown() {
+    ::shutdown(socket, SHUT_RDWR);
+}
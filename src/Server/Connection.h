@@ -0,0 +1,134 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Czech Technical University in Prague
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. */
+
+/******************************************************************************
+* File:             Connection.h
+*
+* Description:      Blocking Unix domain socket connection with buffered writes
+*****************************************************************************/
+
+#ifndef SHORTEST_PATHS_CONNECTION_H
+#define SHORTEST_PATHS_CONNECTION_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+/**
+ * A blocking connection over a Unix domain socket used by both the query server and its clients. The values are read
+ * and written as raw bytes in the native byte order. The written data are buffered until 'flush' is called, so that
+ * each message is sent using as few system calls as possible. The socket is closed in the destructor.
+ */
+class Connection {
+public:
+    /**
+     * Takes the ownership of an already connected socket.
+     *
+     * @param socket[in] The file descriptor of the socket.
+     */
+    explicit Connection(int socket);
+
+    Connection(Connection&& other) noexcept;
+
+    Connection& operator=(Connection&& other) noexcept;
+
+    Connection(const Connection&) = delete;
+
+    Connection& operator=(const Connection&) = delete;
+
+    ~Connection();
+
+    /**
+     * Connects to the server listening on the given socket path.
+     *
+     * @param socketPath[in] The path of the Unix domain socket.
+     * @return The established connection.
+     */
+    static Connection connect(const std::string& socketPath);
+
+    /**
+     * Reads exactly 'size' bytes. Throws 'std::runtime_error' if the connection is closed or broken.
+     *
+     * @param buffer[out] The memory the data are read into.
+     * @param size[in] The number of bytes to read.
+     */
+    void read(void* buffer, size_t size);
+
+    /**
+     * Same as 'read', but returns false if the peer closed the connection before sending any of the bytes. This is
+     * used to detect the end of the communication between two messages.
+     *
+     * @param buffer[out] The memory the data are read into.
+     * @param size[in] The number of bytes to read.
+     * @return False if the connection was closed before the first byte, true if all the bytes were read.
+     */
+    bool tryRead(void* buffer, size_t size);
+
+    template <class T>
+    T read() {
+        T value;
+        read(&value, sizeof(T));
+        return value;
+    }
+
+    template <class T>
+    void readArray(std::vector<T>& values, size_t count) {
+        values.resize(count);
+        read(values.data(), count * sizeof(T));
+    }
+
+    /**
+     * Appends the data to the output buffer, they are sent by 'flush'.
+     *
+     * @param data[in] The data to send.
+     * @param size[in] The number of bytes to send.
+     */
+    void write(const void* data, size_t size);
+
+    template <class T>
+    void write(const T& value) {
+        write(&value, sizeof(T));
+    }
+
+    template <class T>
+    void writeArray(const T* values, size_t count) {
+        write(values, count * sizeof(T));
+    }
+
+    /**
+     * Sends all the buffered data. Throws 'std::runtime_error' if the connection is broken.
+     */
+    void flush();
+
+    /**
+     * Shuts the socket down, which makes the blocking reads of other threads return. The socket itself is closed
+     * in the destructor.
+     */
+    void shutdown();
+
+private:
+    int socket;
+    std::vector<char> outputBuffer;
+};
+
+#endif //SHORTEST_PATHS_CONNECTION_H
@@ -0,0 +1,258 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Czech Technical University in Prague
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. */
+
+/******************************************************************************
+* File:             QueryBackend.cpp
+*****************************************************************************/
+
+#include <atomic>
+#include <climits>
+#include <fstream>
+#include <stdexcept>
+#include <omp.h>
+#include "QueryBackend.h"
+#include "../CCH/CCHCustomizer.h"
+#include "../CCH/CCHDistanceQueryManager.h"
+#include "../CH/CHDistanceQueryManager.h"
+#include "../CH/CHPathQueryManager.h"
+#include "../TNR/TNRDistanceQueryManager.h"
+#include "../TNRAF/TNRAFDistanceQueryManager.h"
+#include "../GraphBuilding/Loaders/DDSGLoader.h"
+#include "../GraphBuilding/Loaders/TNRGLoader.h"
+#include "../GraphBuilding/Loaders/TGAFLoader.h"
+#include "../GraphBuilding/Loaders/XenGraphLoader.h"
+#include "../Error/Error.h"
+
+namespace {
+
+/**
+ * Contraction Hierarchies backend with the unpacking data, which can answer the path queries.
+ */
+class CHPathQueryBackend : public QueryBackend {
+public:
+    CHPathQueryBackend(
+            FlagsGraphWithUnpackingData* graph,
+            unsigned int threads,
+            std::unique_ptr<const SimplificationTable> simplification)
+            : graph(graph), simplification(std::move(simplification)) {
+        executor.initialize(*graph, threads);
+    }
+
+    unsigned int nodes() const override {
+        return simplification ? simplification->nodes() : graph->nodes();
+    }
+
+    void distances(
+            const std::vector<long long>& starts,
+            const std::vector<long long>& goals,
+            std::vector<long long>& distances) override {
+        distances.resize(starts.size());
+        executor.forEach(static_cast<int>(starts.size()), [&](CHPathQueryManager& queryManager, int i) {
+            auto coreDistance = [&queryManager](unsigned int from, unsigned int to) {
+                return queryManager.findDistanceOnly(from, to);
+            };
+            const auto start = static_cast<unsigned int>(starts[i]);
+            const auto goal = static_cast<unsigned int>(goals[i]);
+            distances[i] = simplification ? simplification->findDistance(start, goal, coreDistance)
+                                          : coreDistance(start, goal);
+        });
+    }
+
+    bool supportsPaths() const override {
+        return true;
+    }
+
+    void paths(
+            const std::vector<std::pair<unsigned int, unsigned int>>& queries,
+            std::vector<unsigned int>& distances,
+            std::vector<std::vector<unsigned int>>& paths) override {
+        distances.resize(queries.size());
+        paths.assign(queries.size(), {});
+        executor.forEach(static_cast<int>(queries.size()), [&](CHPathQueryManager& queryManager, int i) {
+            auto corePath = [&queryManager](unsigned int from, unsigned int to, std::vector<SimpleEdge>& coreEdges) {
+                return queryManager.findPath(from, to, coreEdges);
+            };
+            std::vector<SimpleEdge> edges;
+            distances[i] = simplification
+                    ? simplification->findPath(queries[i].first, queries[i].second, corePath, edges)
+                    : corePath(queries[i].first, queries[i].second, edges);
+            if (distances[i] == UINT_MAX) {
+                return;
+            }
+            paths[i].push_back(queries[i].first);
+            for (const SimpleEdge& edge : edges) {
+                paths[i].push_back(edge.to);
+            }
+        }, 1);
+    }
+
+private:
+    std::unique_ptr<const FlagsGraphWithUnpackingData> graph;
+    std::unique_ptr<const SimplificationTable> simplification;
+    BatchQueryExecutor<FlagsGraphWithUnpackingData, CHPathQueryManager> executor;
+};
+
+/**
+ * Customizable Contraction Hierarchies backend. The query managers only read the structure, so all the threads
+ * share it, and the metric can be replaced by a newly customized one while the queries are being answered. The metric
+ * of a structure preprocessed from a simplified graph can not be replaced, the new weights would describe the graph
+ * before the simplification.
+ */
+class CCHQueryBackend : public QueryBackend {
+public:
+    CCHQueryBackend(const std::string& structureFile, unsigned int threads) {
+        std::ifstream input(structureFile, std::ios::binary);
+        if (!input.is_open()) {
+            throw input_error("Couldn't open file '" + structureFile + "'!\n");
+        }
+
+        std::vector<dist_t> weights;
+        topology = CCHTopology::read(input, weights);
+        metric.store(std::make_shared<const CCHMetric>(CCHCustomizer::customize(topology, weights)));
+        simplification = SimplificationTable::loadForStructure(structureFile, topology.nodes());
+        for (unsigned int i = 0; i < std::max(threads, 1u); i++) {
+            managers.push_back(std::make_unique<CCHDistanceQueryManager>(topology, metric.load()));
+        }
+    }
+
+    unsigned int nodes() const override {
+        return simplification ? simplification->nodes() : topology.nodes();
+    }
+
+    void distances(
+            const std::vector<long long>& starts,
+            const std::vector<long long>& goals,
+            std::vector<long long>& distances) override {
+        const std::shared_ptr<const CCHMetric> current = metric.load();
+        for (auto& manager : managers) {
+            manager->setMetric(current);
+        }
+
+        distances.resize(starts.size());
+        const int count = static_cast<int>(starts.size());
+        #pragma omp parallel for num_threads(static_cast<int>(managers.size())) schedule(dynamic, 256)
+        for (int i = 0; i < count; i++) {
+            CCHDistanceQueryManager& manager = *managers[static_cast<size_t>(omp_get_thread_num())];
+            const auto start = static_cast<unsigned int>(starts[static_cast<size_t>(i)]);
+            const auto goal = static_cast<unsigned int>(goals[static_cast<size_t>(i)]);
+            distances[static_cast<size_t>(i)] = simplification
+                    ? simplification->findDistance(start, goal, [&manager](unsigned int from, unsigned int to) {
+                        return manager.findDistance(from, to);
+                    })
+                    : manager.findDistance(start, goal);
+        }
+    }
+
+    bool supportsCustomization() const override {
+        return !simplification;
+    }
+
+    void customize(const std::string& graphFile) override {
+        if (simplification) {
+            throw std::logic_error("The weights of a structure preprocessed with '--simplify' can not be changed.");
+        }
+        XenGraphLoader graphLoader(graphFile);
+        SimpleGraph graph(graphLoader.nodes());
+        graphLoader.loadGraph(graph, 1);
+
+        const std::vector<dist_t> weights = topology.edgeWeights(graph);
+        metric.store(std::make_shared<const CCHMetric>(CCHCustomizer::customize(topology, weights)));
+    }
+
+private:
+    CCHTopology topology;
+    std::unique_ptr<const SimplificationTable> simplification;
+    std::atomic<std::shared_ptr<const CCHMetric>> metric;
+    std::vector<std::unique_ptr<CCHDistanceQueryManager>> managers;
+};
+
+}
+
+//______________________________________________________________________________________________________________________
+bool QueryBackend::supportsPaths() const {
+    return false;
+}
+
+//______________________________________________________________________________________________________________________
+void QueryBackend::paths(
+        const std::vector<std::pair<unsigned int, unsigned int>>&,
+        std::vector<unsigned int>&,
+        std::vector<std::vector<unsigned int>>&) {
+    throw std::logic_error("The path queries are not supported by this method.");
+}
+
+//______________________________________________________________________________________________________________________
+bool QueryBackend::supportsCustomization() const {
+    return false;
+}
+
+//______________________________________________________________________________________________________________________
+void QueryBackend::customize(const std::string&) {
+    throw std::logic_error("The weights can only be changed for the 'cch' method.");
+}
+
+//______________________________________________________________________________________________________________________
+std::unique_ptr<QueryBackend> QueryBackend::create(
+        const std::string& method,
+        const std::string& structureFile,
+        unsigned int threads,
+        bool paths) {
+    if (paths && method != "ch") {
+        throw input_error("The path queries are only supported for the 'ch' method.\n");
+    }
+
+    if (method == "ch") {
+        DDSGLoader chLoader = DDSGLoader(structureFile);
+        if (paths) {
+            std::unique_ptr<FlagsGraphWithUnpackingData> graph(chLoader.loadFlagsGraphWithUnpackingData());
+            auto simplification = SimplificationTable::loadForStructure(structureFile, graph->nodes());
+            return std::make_unique<CHPathQueryBackend>(graph.release(), threads, std::move(simplification));
+        }
+        std::unique_ptr<FlagsGraph<NodeData>> graph(chLoader.loadFlagsGraph());
+        auto simplification = SimplificationTable::loadForStructure(structureFile, graph->nodes());
+        return std::make_unique<ExecutorQueryBackend<FlagsGraph<NodeData>, CHDistanceQueryManager<NodeData>>>(
+                graph.release(), threads, std::move(simplification));
+    }
+
+    if (method == "cch") {
+        return std::make_unique<CCHQueryBackend>(structureFile, threads);
+    }
+
+    if (method == "tnr") {
+        TNRGLoader tnrLoader = TNRGLoader(structureFile);
+        std::unique_ptr<TransitNodeRoutingGraph<NodeData>> graph(tnrLoader.loadTNRforDistanceQueries());
+        auto simplification = SimplificationTable::loadForStructure(structureFile, graph->nodes());
+        return std::make_unique<ExecutorQueryBackend<TransitNodeRoutingGraph<NodeData>, TNRDistanceQueryManager>>(
+                graph.release(), threads, std::move(simplification));
+    }
+
+    if (method == "tnraf") {
+        TGAFLoader tnrafLoader = TGAFLoader(structureFile);
+        std::unique_ptr<TransitNodeRoutingArcFlagsGraph> graph(tnrafLoader.loadTNRAFforDistanceQueries());
+        auto simplification = SimplificationTable::loadForStructure(structureFile, graph->nodes());
+        return std::make_unique<ExecutorQueryBackend<TransitNodeRoutingArcFlagsGraph, TNRAFDistanceQueryManager>>(
+                graph.release(), threads, std::move(simplification));
+    }
+
+    throw input_error("Invalid method '" + method + "' for the query server, use 'ch', 'cch', 'tnr' or 'tnraf'.\n");
+}
@@ -0,0 +1,165 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Czech Technical University in Prague
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. */
+
+/******************************************************************************
+* File:             QueryBackend.h
+*
+* Description:      Query methods used by the query server
+*****************************************************************************/
+
+#ifndef SHORTEST_PATHS_QUERYBACKEND_H
+#define SHORTEST_PATHS_QUERYBACKEND_H
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+#include "../API/BatchQueryExecutor.h"
+#include "../GraphBuilding/Simplification/SimplificationTable.h"
+
+/**
+ * Answers the batches collected by the query server using one of the methods. All the node IDs are the internal IDs
+ * of the data structure, the server translates them. The batches are answered in parallel using one query manager
+ * per thread. The data structure is loaded once and shared by all the threads, the query managers only read it and
+ * keep the state of the running query themselves. If the structure was preprocessed from a simplified graph, the node
+ * IDs are the IDs of the graph before the simplification and the queries are answered through the simplification
+ * table.
+ */
+class QueryBackend {
+public:
+    virtual ~QueryBackend() = default;
+
+    /**
+     * @return The number of nodes in the data structure, valid node IDs are lower than this.
+     */
+    virtual unsigned int nodes() const = 0;
+
+    /**
+     * Answers the distance queries from 'starts[i]' to 'goals[i]'.
+     *
+     * @param starts[in] The start nodes of the queries.
+     * @param goals[in] The goal nodes of the queries, the vector has the same size as 'starts'.
+     * @param distances[out] The distances, 'UINT_MAX' is used for unreachable goals. The vector is resized.
+     */
+    virtual void distances(
+            const std::vector<long long>& starts,
+            const std::vector<long long>& goals,
+            std::vector<long long>& distances) = 0;
+
+    /**
+     * @return True if the backend can answer path queries.
+     */
+    virtual bool supportsPaths() const;
+
+    /**
+     * Answers the path queries. Only the backends for which 'supportsPaths' returns true implement this function,
+     * the other ones throw 'std::logic_error'.
+     *
+     * @param queries[in] The start and goal nodes of the queries.
+     * @param distances[out] The distances, 'UINT_MAX' is used for unreachable goals. The vector is resized.
+     * @param paths[out] The nodes on the paths including the start and the goal. The path is empty if the goal is
+     * not reachable. The vector is resized.
+     */
+    virtual void paths(
+            const std::vector<std::pair<unsigned int, unsigned int>>& queries,
+            std::vector<unsigned int>& distances,
+            std::vector<std::vector<unsigned int>>& paths);
+
+    /**
+     * @return True if the weights of the graph can be replaced using 'customize'.
+     */
+    virtual bool supportsCustomization() const;
+
+    /**
+     * Replaces the weights of the graph while the queries are being answered, the batches that already started
+     * finish with the previous weights. Only the backends for which 'supportsCustomization' returns true implement
+     * this function, the other ones throw 'std::logic_error'.
+     *
+     * @param graphFile[in] The path to the graph with the new weights in the XenGraph format.
+     */
+    virtual void customize(const std::string& graphFile);
+
+    /**
+     * Loads the data structure for the given method. If the structure was preprocessed with '--simplify', its
+     * simplification table (the '.simp' file next to the structure) is loaded as well.
+     *
+     * @param method[in] One of 'ch', 'cch', 'tnr' and 'tnraf'.
+     * @param structureFile[in] The path to the data structure created by the preprocessor for the method.
+     * @param threads[in] The number of threads used to answer the batches.
+     * @param paths[in] Whether path queries should be supported. This is only possible for 'ch', the path queries
+     * require the unpacking data of the shortcuts, so the slower path query manager is then used for the distance
+     * queries as well.
+     * @return The backend answering the queries.
+     */
+    static std::unique_ptr<QueryBackend> create(
+            const std::string& method,
+            const std::string& structureFile,
+            unsigned int threads,
+            bool paths);
+};
+
+/**
+ * A backend answering the distance queries using a query manager that provides
+ * 'findDistance(unsigned int, unsigned int)'.
+ *
+ * @tparam Graph The data structure used by the query manager.
+ * @tparam QueryManager The query manager.
+ */
+template <class Graph, class QueryManager>
+class ExecutorQueryBackend : public QueryBackend {
+public:
+    /**
+     * @param graph[in] The loaded data structure, the backend takes the ownership of it.
+     * @param threads[in] The number of threads used to answer the batches.
+     * @param simplification[in] The simplification table of the structure, or nullptr if it was preprocessed without
+     * the simplification.
+     */
+    ExecutorQueryBackend(
+            Graph* graph,
+            unsigned int threads,
+            std::unique_ptr<const SimplificationTable> simplification = nullptr)
+            : graph(graph), simplification(std::move(simplification)) {
+        executor.initialize(*graph, threads, this->simplification.get());
+    }
+
+    unsigned int nodes() const override {
+        return simplification ? simplification->nodes() : graph->nodes();
+    }
+
+    void distances(
+            const std::vector<long long>& starts,
+            const std::vector<long long>& goals,
+            std::vector<long long>& distances) override {
+        distances.resize(starts.size());
+        executor.run(starts.data(), goals.data(), distances.data(), static_cast<int>(starts.size()), [](long long id) {
+            return static_cast<unsigned int>(id);
+        });
+    }
+
+private:
+    std::unique_ptr<const Graph> graph;
+    std::unique_ptr<const SimplificationTable> simplification;
+    BatchQueryExecutor<Graph, QueryManager> executor;
+};
+
+#endif //SHORTEST_PATHS_QUERYBACKEND_H
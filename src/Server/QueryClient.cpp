@@ -0,0 +1,113 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Czech Technical University in Prague
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. */
+
+/******************************************************************************
+* File:             QueryClient.cpp
+*****************************************************************************/
+
+#include <cstdint>
+#include <stdexcept>
+#include "QueryClient.h"
+#include "ServerProtocol.h"
+
+using ServerProtocol::RequestType;
+using ServerProtocol::ResponseStatus;
+
+//______________________________________________________________________________________________________________________
+QueryClient::QueryClient(const std::string& socketPath) : connection(Connection::connect(socketPath)) {
+}
+
+//______________________________________________________________________________________________________________________
+unsigned int QueryClient::distance(unsigned long long start, unsigned long long goal) {
+    connection.write(RequestType::DISTANCES);
+    connection.write(static_cast<uint32_t>(1));
+    connection.write(start);
+    connection.write(goal);
+    finishRequest();
+
+    std::vector<unsigned int> distances;
+    readDistances(distances);
+    return distances.at(0);
+}
+
+//______________________________________________________________________________________________________________________
+void QueryClient::distances(
+        const std::vector<std::pair<unsigned long long, unsigned long long>>& queries,
+        std::vector<unsigned int>& distances) {
+    connection.write(RequestType::DISTANCES);
+    connection.write(static_cast<uint32_t>(queries.size()));
+    for (const auto& query : queries) {
+        connection.write(query.first);
+        connection.write(query.second);
+    }
+    finishRequest();
+    readDistances(distances);
+}
+
+//______________________________________________________________________________________________________________________
+unsigned int QueryClient::path(
+        unsigned long long start,
+        unsigned long long goal,
+        std::vector<unsigned long long>& path) {
+    connection.write(RequestType::PATH);
+    connection.write(start);
+    connection.write(goal);
+    finishRequest();
+
+    const auto distance = connection.read<uint32_t>();
+    const auto nodes = connection.read<uint32_t>();
+    connection.readArray(path, nodes);
+    return distance;
+}
+
+//______________________________________________________________________________________________________________________
+void QueryClient::matrix(
+        const std::vector<unsigned long long>& sources,
+        const std::vector<unsigned long long>& targets,
+        std::vector<unsigned int>& distances) {
+    connection.write(RequestType::MATRIX);
+    connection.write(static_cast<uint32_t>(sources.size()));
+    connection.write(static_cast<uint32_t>(targets.size()));
+    connection.writeArray(sources.data(), sources.size());
+    connection.writeArray(targets.data(), targets.size());
+    finishRequest();
+    readDistances(distances);
+}
+
+//______________________________________________________________________________________________________________________
+void QueryClient::finishRequest() {
+    connection.flush();
+    if (connection.read<ResponseStatus>() == ResponseStatus::OK) {
+        return;
+    }
+
+    std::string message(connection.read<uint32_t>(), '\0');
+    connection.read(message.data(), message.size());
+    throw std::runtime_error(message);
+}
+
+//______________________________________________________________________________________________________________________
+void QueryClient::readDistances(std::vector<unsigned int>& distances) {
+    const auto count = connection.read<uint32_t>();
+    connection.readArray(distances, count);
+}
@@ -0,0 +1,102 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Czech Technical University in Prague
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. */
+
+/******************************************************************************
+* File:             QueryClient.h
+*
+* Description:      Client of the query server
+*****************************************************************************/
+
+#ifndef SHORTEST_PATHS_QUERYCLIENT_H
+#define SHORTEST_PATHS_QUERYCLIENT_H
+
+#include <string>
+#include <utility>
+#include <vector>
+#include "Connection.h"
+
+/**
+ * A client of the query server. Each client uses its own connection, a single client must not be used from
+ * multiple threads at once. Errors reported by the server are thrown as 'std::runtime_error'.
+ */
+class QueryClient {
+public:
+    /**
+     * Connects to the server.
+     *
+     * @param socketPath[in] The path of the Unix domain socket the server listens on.
+     */
+    explicit QueryClient(const std::string& socketPath);
+
+    /**
+     * @param start[in] The start node of the query.
+     * @param goal[in] The goal node of the query.
+     * @return The shortest distance from 'start' to 'goal' or 'UINT_MAX' if the goal is not reachable.
+     */
+    unsigned int distance(unsigned long long start, unsigned long long goal);
+
+    /**
+     * Answers multiple distance queries using a single request.
+     *
+     * @param queries[in] The start and goal nodes of the queries.
+     * @param distances[out] The distances, 'UINT_MAX' for unreachable goals. The vector is resized.
+     */
+    void distances(
+            const std::vector<std::pair<unsigned long long, unsigned long long>>& queries,
+            std::vector<unsigned int>& distances);
+
+    /**
+     * Finds the shortest path. The server has to support path queries.
+     *
+     * @param start[in] The start node of the query.
+     * @param goal[in] The goal node of the query.
+     * @param path[out] The nodes on the path including the start and the goal, empty if the goal is not reachable.
+     * @return The shortest distance from 'start' to 'goal' or 'UINT_MAX' if the goal is not reachable.
+     */
+    unsigned int path(unsigned long long start, unsigned long long goal, std::vector<unsigned long long>& path);
+
+    /**
+     * Computes the distances from all the sources to all the targets.
+     *
+     * @param sources[in] The start nodes.
+     * @param targets[in] The goal nodes.
+     * @param distances[out] The distances row by row, 'distances[i * targets.size() + j]' is the distance from
+     * 'sources[i]' to 'targets[j]'. The vector is resized.
+     */
+    void matrix(
+            const std::vector<unsigned long long>& sources,
+            const std::vector<unsigned long long>& targets,
+            std::vector<unsigned int>& distances);
+
+private:
+    /**
+     * Sends the buffered request and reads the status of the response. Throws the error sent by the server.
+     */
+    void finishRequest();
+
+    void readDistances(std::vector<unsigned int>& distances);
+
+    Connection connection;
+};
+
+#endif //SHORTEST_PATHS_QUERYCLIENT_H
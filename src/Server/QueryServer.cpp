@@ -0,0 +1,391 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Czech Technical University in Prague
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. */
+
+/******************************************************************************
+* File:             QueryServer.cpp
+*****************************************************************************/
+
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include "QueryServer.h"
+
+using ServerProtocol::RequestType;
+using ServerProtocol::ResponseStatus;
+
+//______________________________________________________________________________________________________________________
+QueryServer::QueryServer(QueryBackend& backend, const NodeMapping* mapping, unsigned int maxBatch)
+    : backend(backend), mapping(mapping), maxBatch(maxBatch) {
+}
+
+//______________________________________________________________________________________________________________________
+QueryServer::~QueryServer() {
+    if (listeningSocket >= 0) {
+        close(listeningSocket);
+        unlink(socketPath.c_str());
+    }
+}
+
+//______________________________________________________________________________________________________________________
+void QueryServer::listen(const std::string& socketPath) {
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+    if (socketPath.size() >= sizeof(address.sun_path)) {
+        throw std::runtime_error("The socket path '" + socketPath + "' is too long.");
+    }
+    std::strcpy(address.sun_path, socketPath.c_str());
+
+    struct stat existing{};
+    if (lstat(socketPath.c_str(), &existing) == 0) {
+        if (!S_ISSOCK(existing.st_mode)) {
+            throw std::runtime_error("The file '" + socketPath + "' already exists and it is not a socket.");
+        }
+        unlink(socketPath.c_str());
+    }
+
+    listeningSocket = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (listeningSocket < 0) {
+        throw std::runtime_error(std::string("Couldn't create a socket: ") + std::strerror(errno));
+    }
+    if (bind(listeningSocket, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0
+            || ::listen(listeningSocket, SOMAXCONN) != 0) {
+        const std::string error = std::strerror(errno);
+        close(listeningSocket);
+        listeningSocket = -1;
+        throw std::runtime_error("Couldn't listen on '" + socketPath + "': " + error);
+    }
+    this->socketPath = socketPath;
+}
+
+//______________________________________________________________________________________________________________________
+void QueryServer::run() {
+    std::thread dispatcher(&QueryServer::dispatch, this);
+    std::string acceptError;
+
+    while (true) {
+        const int client = accept(listeningSocket, nullptr, nullptr);
+        if (client < 0) {
+            if (errno == EINTR || errno == ECONNABORTED) {
+                continue;
+            }
+            // 'stop' shuts the listening socket down, which makes 'accept' fail
+            if (!stopRequested) {
+                acceptError = std::strerror(errno);
+            }
+            break;
+        }
+
+        std::lock_guard lock(connectionsMutex);
+        auto connection = std::make_shared<Connection>(client);
+        std::thread thread([this, connection]() {
+            serve(*connection);
+            std::lock_guard lock(connectionsMutex);
+            auto finished = connections.find(std::this_thread::get_id());
+            finishedThreads.push_back(std::move(finished->second.first));
+            connections.erase(finished);
+            connectionsChanged.notify_all();
+        });
+        const auto id = thread.get_id();
+        connections.emplace(id, std::make_pair(std::move(thread), std::move(connection)));
+
+        for (std::thread& finished : finishedThreads) {
+            finished.join();
+        }
+        finishedThreads.clear();
+    }
+
+    {
+        std::unique_lock lock(connectionsMutex);
+        for (auto& entry : connections) {
+            entry.second.second->shutdown();
+        }
+        connectionsChanged.wait(lock, [this]() { return connections.empty(); });
+        for (std::thread& finished : finishedThreads) {
+            finished.join();
+        }
+        finishedThreads.clear();
+    }
+
+    {
+        std::lock_guard lock(mutex);
+        stopping = true;
+    }
+    queueChanged.notify_all();
+    dispatcher.join();
+
+    if (!acceptError.empty()) {
+        throw std::runtime_error("Couldn't accept a connection: " + acceptError);
+    }
+}
+
+//______________________________________________________________________________________________________________________
+void QueryServer::stop() {
+    stopRequested = true;
+    ::shutdown(listeningSocket, SHUT_RDWR);
+}
+
+//______________________________________________________________________________________________________________________
+QueryServerStatistics QueryServer::statistics() {
+    std::lock_guard lock(mutex);
+    return counters;
+}
+
+//______________________________________________________________________________________________________________________
+void QueryServer::serve(Connection& connection) {
+    try {
+        uint32_t type;
+        while (connection.tryRead(&type, sizeof(type))) {
+            auto request = std::make_shared<Request>();
+            request->type = static_cast<RequestType>(type);
+            try {
+                readRequest(connection, *request);
+            } catch (const std::out_of_range& e) {
+                writeError(connection, e.what());
+                connection.flush();
+                continue;
+            }
+
+            if (request->type == RequestType::PATH && !backend.supportsPaths()) {
+                writeError(connection, "The server was started without the support for path queries.");
+            } else {
+                submit(request);
+                writeResponse(connection, *request);
+            }
+            connection.flush();
+        }
+    } catch (const std::runtime_error& e) {
+        // the client is most likely gone, so there is nobody to report the error to
+        try {
+            writeError(connection, e.what());
+            connection.flush();
+        } catch (const std::runtime_error&) {
+        }
+    }
+}
+
+//______________________________________________________________________________________________________________________
+void QueryServer::readRequest(Connection& connection, Request& request) {
+    std::vector<unsigned long long> starts;
+    std::vector<unsigned long long> goals;
+
+    switch (request.type) {
+        case RequestType::DISTANCES: {
+            const auto count = connection.read<uint32_t>();
+            if (count > ServerProtocol::MAX_QUERIES_PER_REQUEST) {
+                throw std::runtime_error("The request contains too many queries.");
+            }
+            std::vector<unsigned long long> pairs;
+            connection.readArray(pairs, 2 * static_cast<size_t>(count));
+            starts.reserve(count);
+            goals.reserve(count);
+            for (size_t i = 0; i < pairs.size(); i += 2) {
+                starts.push_back(pairs[i]);
+                goals.push_back(pairs[i + 1]);
+            }
+            break;
+        }
+        case RequestType::PATH: {
+            starts.push_back(connection.read<unsigned long long>());
+            goals.push_back(connection.read<unsigned long long>());
+            break;
+        }
+        case RequestType::MATRIX: {
+            const auto sources = connection.read<uint32_t>();
+            const auto targets = connection.read<uint32_t>();
+            if (static_cast<uint64_t>(sources) * targets > ServerProtocol::MAX_QUERIES_PER_REQUEST) {
+                throw std::runtime_error("The request contains too many queries.");
+            }
+            std::vector<unsigned long long> sourceIDs;
+            std::vector<unsigned long long> targetIDs;
+            connection.readArray(sourceIDs, sources);
+            connection.readArray(targetIDs, targets);
+            starts.reserve(static_cast<size_t>(sources) * targets);
+            goals.reserve(static_cast<size_t>(sources) * targets);
+            for (unsigned long long source : sourceIDs) {
+                for (unsigned long long target : targetIDs) {
+                    starts.push_back(source);
+                    goals.push_back(target);
+                }
+            }
+            break;
+        }
+        default:
+            throw std::runtime_error("Unknown request type " + std::to_string(static_cast<uint32_t>(request.type))
+                                     + ".");
+    }
+
+    translateIDs(starts, request.starts);
+    translateIDs(goals, request.goals);
+}
+
+//______________________________________________________________________________________________________________________
+void QueryServer::translateIDs(
+        const std::vector<unsigned long long>& ids,
+        std::vector<long long>& internalIDs) const {
+    internalIDs.resize(ids.size());
+    for (size_t i = 0; i < ids.size(); ++i) {
+        if (mapping) {
+            internalIDs[i] = mapping->internalID(ids[i]);
+        } else if (ids[i] < backend.nodes()) {
+            internalIDs[i] = static_cast<long long>(ids[i]);
+        } else {
+            throw std::out_of_range("The node ID " + std::to_string(ids[i]) + " is out of range, the graph has "
+                                    + std::to_string(backend.nodes()) + " nodes.");
+        }
+    }
+}
+
+//______________________________________________________________________________________________________________________
+void QueryServer::writeResponse(Connection& connection, const Request& request) {
+    if (!request.error.empty()) {
+        writeError(connection, request.error);
+        return;
+    }
+
+    connection.write(ResponseStatus::OK);
+    if (request.type == RequestType::PATH) {
+        connection.write(static_cast<uint32_t>(request.distances[0]));
+        connection.write(static_cast<uint32_t>(request.path.size()));
+        for (unsigned int node : request.path) {
+            connection.write(mapping ? mapping->originalID(node) : static_cast<unsigned long long>(node));
+        }
+        return;
+    }
+
+    connection.write(static_cast<uint32_t>(request.distances.size()));
+    std::vector<uint32_t> distances(request.distances.begin(), request.distances.end());
+    connection.writeArray(distances.data(), distances.size());
+}
+
+//______________________________________________________________________________________________________________________
+void QueryServer::writeError(Connection& connection, const std::string& message) {
+    connection.write(ResponseStatus::ERROR);
+    connection.write(static_cast<uint32_t>(message.size()));
+    connection.write(message.data(), message.size());
+}
+
+//______________________________________________________________________________________________________________________
+void QueryServer::submit(const std::shared_ptr<Request>& request) {
+    std::unique_lock lock(mutex);
+    queue.push_back(request);
+    queueChanged.notify_one();
+    requestsDone.wait(lock, [&request]() { return request->done; });
+}
+
+//______________________________________________________________________________________________________________________
+void QueryServer::dispatch() {
+    std::vector<std::shared_ptr<Request>> batch;
+    while (true) {
+        {
+            std::unique_lock lock(mutex);
+            queueChanged.wait(lock, [this]() { return stopping || !queue.empty(); });
+            if (queue.empty()) {
+                return;
+            }
+
+            size_t queries = 0;
+            while (!queue.empty() && (batch.empty() || queries + queue.front()->starts.size() <= maxBatch)) {
+                queries += queue.front()->starts.size();
+                batch.push_back(std::move(queue.front()));
+                queue.pop_front();
+            }
+        }
+
+        answer(batch);
+
+        {
+            std::lock_guard lock(mutex);
+            for (const auto& request : batch) {
+                request->done = true;
+                counters.queries += request->starts.size();
+            }
+            counters.requests += batch.size();
+            ++counters.batches;
+        }
+        requestsDone.notify_all();
+        batch.clear();
+    }
+}
+
+//______________________________________________________________________________________________________________________
+void QueryServer::answer(std::vector<std::shared_ptr<Request>>& batch) {
+    std::vector<long long> starts;
+    std::vector<long long> goals;
+    std::vector<long long> distances;
+    std::vector<std::pair<unsigned int, unsigned int>> pathQueries;
+    for (const auto& request : batch) {
+        if (request->type == RequestType::PATH) {
+            pathQueries.emplace_back(request->starts[0], request->goals[0]);
+        } else {
+            starts.insert(starts.end(), request->starts.begin(), request->starts.end());
+            goals.insert(goals.end(), request->goals.begin(), request->goals.end());
+        }
+    }
+
+    std::string distancesError;
+    std::string pathsError;
+    std::vector<unsigned int> pathDistances;
+    std::vector<std::vector<unsigned int>> paths;
+    try {
+        if (!starts.empty()) {
+            backend.distances(starts, goals, distances);
+        }
+    } catch (const std::exception& e) {
+        distancesError = e.what();
+    }
+    try {
+        if (!pathQueries.empty()) {
+            backend.paths(pathQueries, pathDistances, paths);
+        }
+    } catch (const std::exception& e) {
+        pathsError = e.what();
+    }
+
+    size_t offset = 0;
+    size_t pathIndex = 0;
+    for (const auto& request : batch) {
+        if (request->type == RequestType::PATH) {
+            if (pathsError.empty()) {
+                request->distances.assign(1, pathDistances[pathIndex]);
+                request->path = std::move(paths[pathIndex]);
+            } else {
+                request->error = pathsError;
+            }
+            ++pathIndex;
+        } else {
+            if (distancesError.empty()) {
+                const auto begin = distances.begin() + static_cast<std::ptrdiff_t>(offset);
+                request->distances.assign(begin, begin + static_cast<std::ptrdiff_t>(request->starts.size()));
+            } else {
+                request->error = distancesError;
+            }
+            offset += request->starts.size();
+        }
+    }
+}
@@ -0,0 +1,165 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Czech Technical University in Prague
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. */
+
+/******************************************************************************
+* File:             QueryServer.h
+*
+* Description:      Local query server coalescing concurrent requests into batches
+*****************************************************************************/
+
+#ifndef SHORTEST_PATHS_QUERYSERVER_H
+#define SHORTEST_PATHS_QUERYSERVER_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "Connection.h"
+#include "QueryBackend.h"
+#include "ServerProtocol.h"
+#include "../GraphBuilding/Structures/NodeMapping.h"
+
+/**
+ * Counters of the work done by the server since it started.
+ */
+struct QueryServerStatistics {
+    size_t requests = 0;
+    size_t queries = 0;
+    size_t batches = 0;
+};
+
+/**
+ * A server answering distance, path and matrix queries over a Unix domain socket (see 'ServerProtocol.h' for the
+ * protocol). The data structure is loaded only once and shared by all the clients, so multiple processes on the same
+ * machine do not need their own copies.
+ *
+ * Every client connection is served by its own thread, which reads the requests, translates the node IDs and
+ * passes the requests to a single dispatcher thread. The dispatcher takes all the requests waiting in the queue
+ * (up to 'maxBatch' queries), answers them as one batch on the thread pool of the backend and wakes the connection
+ * threads up. The requests arriving while a batch is being answered are therefore coalesced into the next batch.
+ */
+class QueryServer {
+public:
+    /**
+     * @param backend[in] The backend answering the queries, it has to outlive the server.
+     * @param mapping[in] The mapping of the original node IDs, or nullptr if the clients use the internal IDs.
+     * It has to outlive the server.
+     * @param maxBatch[in] The number of queries after which no more requests are added to a batch. Larger requests
+     * are still answered in a single batch.
+     */
+    QueryServer(QueryBackend& backend, const NodeMapping* mapping, unsigned int maxBatch);
+
+    QueryServer(const QueryServer&) = delete;
+
+    QueryServer& operator=(const QueryServer&) = delete;
+
+    /**
+     * Closes the listening socket and removes the socket file. 'run' has to have finished before.
+     */
+    ~QueryServer();
+
+    /**
+     * Creates the socket and starts listening on it. A stale socket file left by a previous server is replaced,
+     * any other existing file causes an error.
+     *
+     * @param socketPath[in] The path of the Unix domain socket.
+     */
+    void listen(const std::string& socketPath);
+
+    /**
+     * Accepts and serves the clients until 'stop' is called. Before returning, all the client connections are
+     * closed and the pending requests are answered. Throws 'std::runtime_error' if accepting the connections fails
+     * for any other reason.
+     */
+    void run();
+
+    /**
+     * Makes 'run' return. This function can be called from any thread.
+     */
+    void stop();
+
+    /**
+     * @return The number of requests, queries and batches answered so far.
+     */
+    QueryServerStatistics statistics();
+
+private:
+    struct Request {
+        ServerProtocol::RequestType type;
+        std::vector<long long> starts;
+        std::vector<long long> goals;
+        std::vector<long long> distances;
+        std::vector<unsigned int> path;
+        std::string error;
+        bool done = false;
+    };
+
+    void serve(Connection& connection);
+
+    /**
+     * Reads the rest of the request after its type. Throws 'std::runtime_error' if the request is invalid and the
+     * connection can not continue, and 'std::out_of_range' if some node ID is unknown (the rest of the request is
+     * read anyway, so the connection can continue).
+     */
+    void readRequest(Connection& connection, Request& request);
+
+    void writeResponse(Connection& connection, const Request& request);
+
+    static void writeError(Connection& connection, const std::string& message);
+
+    void submit(const std::shared_ptr<Request>& request);
+
+    void dispatch();
+
+    void answer(std::vector<std::shared_ptr<Request>>& batch);
+
+    void translateIDs(const std::vector<unsigned long long>& ids, std::vector<long long>& internalIDs) const;
+
+    QueryBackend& backend;
+    const NodeMapping* mapping;
+    unsigned int maxBatch;
+
+    std::string socketPath;
+    int listeningSocket = -1;
+    std::atomic<bool> stopRequested = false;
+
+    std::mutex mutex;
+    std::condition_variable queueChanged;
+    std::condition_variable requestsDone;
+    std::deque<std::shared_ptr<Request>> queue;
+    bool stopping = false;
+    QueryServerStatistics counters;
+
+    std::mutex connectionsMutex;
+    std::condition_variable connectionsChanged;
+    std::map<std::thread::id, std::pair<std::thread, std::shared_ptr<Connection>>> connections;
+    std::vector<std::thread> finishedThreads;
+};
+
+#endif //SHORTEST_PATHS_QUERYSERVER_H
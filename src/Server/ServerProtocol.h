@@ -0,0 +1,72 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Czech Technical University in Prague
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. */
+
+/******************************************************************************
+* File:             ServerProtocol.h
+*
+* Description:      Binary protocol of the query server
+*****************************************************************************/
+
+#ifndef SHORTEST_PATHS_SERVERPROTOCOL_H
+#define SHORTEST_PATHS_SERVERPROTOCOL_H
+
+#include <cstdint>
+
+/**
+ * The query server communicates over a Unix domain socket using a simple binary protocol. All the values are sent in
+ * the native byte order, as the server is only reachable from the local machine. A connection can be used for any
+ * number of requests, each request is answered before the next one is read.
+ *
+ * Requests start with the request type (uint32):
+ * - DISTANCES: uint32 count, then 'count' pairs of uint64 start and goal IDs.
+ * - PATH: uint64 start ID, uint64 goal ID.
+ * - MATRIX: uint32 source count, uint32 target count, uint64 source IDs, uint64 target IDs.
+ *
+ * Responses start with the status (uint32):
+ * - OK for DISTANCES and MATRIX: uint32 count, then 'count' uint32 distances (the matrix is sent row by row).
+ * - OK for PATH: uint32 distance, uint32 node count, then the uint64 IDs of the nodes on the path.
+ * - ERROR: uint32 message length, then the message (not null terminated).
+ *
+ * The node IDs are the original IDs if the server uses a mapping file and the internal IDs otherwise.
+ * Unreachable goals have the distance UINT32_MAX and an empty path.
+ */
+namespace ServerProtocol {
+    enum class RequestType : uint32_t {
+        DISTANCES = 1,
+        PATH = 2,
+        MATRIX = 3
+    };
+
+    enum class ResponseStatus : uint32_t {
+        OK = 0,
+        ERROR = 1
+    };
+
+    /**
+     * The maximal number of distances in a single DISTANCES or MATRIX request. Larger requests are refused and the
+     * connection is closed.
+     */
+    constexpr uint32_t MAX_QUERIES_PER_REQUEST = 1u << 24;
+}
+
+#endif //SHORTEST_PATHS_SERVERPROTOCOL_H
@@ -29,7 +29,7 @@
 #include "TNRDistanceQueryManager.h"
 
 //______________________________________________________________________________________________________________________
-TNRDistanceQueryManager::TNRDistanceQueryManager(TransitNodeRoutingGraph<NodeData>& graph) : graph(graph), fallbackCHmanager(graph) {
+TNRDistanceQueryManager::TNRDistanceQueryManager(const TransitNodeRoutingGraph<NodeData>& graph) : graph(graph), fallbackCHmanager(graph), statistics(nullptr) {
 
 }
 
@@ -39,9 +39,16 @@ unsigned int TNRDistanceQueryManager::findDistance(const unsigned int start, con
         return 0;
     } else {
         if (graph.isLocalQuery(start, goal)) { // Is local query, fallback to some other distance manager, here CH
+            COUNT_QUERY_STATISTIC(statistics, localQueryFallbacks, 1);
             return fallbackCHmanager.findDistance(start, goal);
         } else { // Not local query, TNR can be used.
-            return graph.findTNRDistance(start, goal);
+            return graph.findTNRDistance(start, goal, statistics);
         }
     }
 }
+
+//______________________________________________________________________________________________________________________
+void TNRDistanceQueryManager::setStatistics(QueryStatistics* queryStatistics) {
+    statistics = queryStatistics;
+    fallbackCHmanager.setStatistics(queryStatistics);
+}
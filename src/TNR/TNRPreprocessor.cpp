@@ -41,52 +41,62 @@
 
 //______________________________________________________________________________________________________________________
 void
-TNRPreprocessor::preprocessUsingCH(UpdateableGraph &graph, std::string outputPath, unsigned int transitNodesAmount) {
+TNRPreprocessor::preprocessUsingCH(UpdateableGraph &graph, std::string outputPath, unsigned int transitNodesAmount,
+                                   const PreprocessingCheckpoints &checkpoints) {
     std::cout << "Getting transit nodes" << std::endl;
     std::vector<unsigned int> transitNodes(transitNodesAmount);
     graph.getNodesWithHighestRank(transitNodes, transitNodesAmount);
 
-    std::cout << "Computing transit nodes distance table" << std::endl;
     FlagsGraph chGraph(graph);
     CHDistanceQueryManager qm(chGraph);
     std::vector<std::vector<unsigned int> > transitNodesDistanceTable(transitNodesAmount,
                                                                       std::vector<unsigned int>(transitNodesAmount));
-    for (unsigned int i = 0; i < transitNodesAmount; i++) {
-        if (i % 100 == 0) {
-            std::cout << "\rComputed '" << i << "' transit nodes distance table rows.";
-        }
-        for (unsigned int j = 0; j < transitNodesAmount; j++) {
-            if (i == j) {
-                transitNodesDistanceTable[i][j] = 0;
-            } else {
-                transitNodesDistanceTable[i][j] = qm.findDistance(transitNodes[i], transitNodes[j]);
+    if (!loadTransitNodesDistanceTable(checkpoints, transitNodesAmount, transitNodesDistanceTable)) {
+        std::cout << "Computing transit nodes distance table" << std::endl;
+        for (unsigned int i = 0; i < transitNodesAmount; i++) {
+            if (i % 100 == 0) {
+                std::cout << "\rComputed '" << i << "' transit nodes distance table rows.";
+            }
+            for (unsigned int j = 0; j < transitNodesAmount; j++) {
+                if (i == j) {
+                    transitNodesDistanceTable[i][j] = 0;
+                } else {
+                    transitNodesDistanceTable[i][j] = qm.findDistance(transitNodes[i], transitNodes[j]);
+                }
             }
         }
-    }
 
-    std::cout << "\rComputed the transit nodes distance table." << std::endl;
+        std::cout << "\rComputed the transit nodes distance table." << std::endl;
+        saveTransitNodesDistanceTable(checkpoints, transitNodesAmount, transitNodesDistanceTable);
+    }
 
-    std::cout << "Computing access nodes" << std::endl;
     std::vector<std::vector<AccessNodeData> > forwardAccessNodes(graph.nodes());
     std::vector<std::vector<AccessNodeData> > backwardAccessNodes(graph.nodes());
     std::vector<std::vector<unsigned int> > forwardSearchSpaces(graph.nodes());
     std::vector<std::vector<unsigned int> > backwardSearchSpaces(graph.nodes());
-    std::unordered_map<unsigned int, unsigned int> transitNodesMapping;
-    for (unsigned int i = 0; i < transitNodesAmount; i++) {
-        transitNodesMapping.insert(std::make_pair(transitNodes[i], i));
-    }
+    const std::string accessParameters = "mode=fast tnodes=" + std::to_string(transitNodesAmount);
+    if (!loadAccessNodes(checkpoints, accessParameters, forwardAccessNodes, backwardAccessNodes, forwardSearchSpaces,
+                         backwardSearchSpaces)) {
+        std::cout << "Computing access nodes" << std::endl;
+        std::unordered_map<unsigned int, unsigned int> transitNodesMapping;
+        for (unsigned int i = 0; i < transitNodesAmount; i++) {
+            transitNodesMapping.insert(std::make_pair(transitNodes[i], i));
+        }
+
+        for (unsigned int i = 0; i < graph.nodes(); i++) {
+            if (i % 100 == 0) {
+                std::cout << "\rComputed access nodes for '" << i << "' nodes.";
+            }
 
-    for (unsigned int i = 0; i < graph.nodes(); i++) {
-        if (i % 100 == 0) {
-            std::cout << "\rComputed access nodes for '" << i << "' nodes.";
+            findForwardAccessNodes(i, forwardAccessNodes[i], forwardSearchSpaces[i], transitNodesMapping, chGraph);
+            findBackwardAccessNodes(i, backwardAccessNodes[i], backwardSearchSpaces[i], transitNodesMapping, chGraph);
         }
 
-        findForwardAccessNodes(i, forwardAccessNodes[i], forwardSearchSpaces[i], transitNodesMapping, chGraph);
-        findBackwardAccessNodes(i, backwardAccessNodes[i], backwardSearchSpaces[i], transitNodesMapping, chGraph);
+        std::cout << "\rComputed acess nodes for all the nodes in the graph." << std::endl;
+        saveAccessNodes(checkpoints, accessParameters, forwardAccessNodes, backwardAccessNodes, forwardSearchSpaces,
+                        backwardSearchSpaces);
     }
 
-    std::cout << "\rComputed acess nodes for all the nodes in the graph." << std::endl;
-
     std::vector<std::pair<unsigned int, QueryEdge> > allEdges;
     chGraph.getEdgesForFlushing(allEdges);
 
@@ -96,56 +106,66 @@ TNRPreprocessor::preprocessUsingCH(UpdateableGraph &graph, std::string outputPat
 
 //______________________________________________________________________________________________________________________
 void TNRPreprocessor::preprocessUsingCHslower(UpdateableGraph& graph, Graph& originalGraph, std::string outputPath,
-                                              unsigned int transitNodesAmount) {
+                                              unsigned int transitNodesAmount,
+                                              const PreprocessingCheckpoints &checkpoints) {
     std::cout << "Getting transit nodes" << std::endl;
     std::vector<unsigned int> transitNodes(transitNodesAmount);
     graph.getNodesWithHighestRank(transitNodes, transitNodesAmount);
 
-    std::cout << "Computing transit nodes distance table" << std::endl;
     FlagsGraph chGraph(graph);
     CHDistanceQueryManager qm(chGraph);
     std::vector<std::vector<unsigned int> > transitNodesDistanceTable(transitNodesAmount,
                                                                       std::vector<unsigned int>(transitNodesAmount));
-    for (unsigned int i = 0; i < transitNodesAmount; i++) {
-        if (i % 100 == 0) {
-            std::cout << "\rComputed '" << i << "' transit nodes distance table rows.";
-        }
+    if (!loadTransitNodesDistanceTable(checkpoints, transitNodesAmount, transitNodesDistanceTable)) {
+        std::cout << "Computing transit nodes distance table" << std::endl;
+        for (unsigned int i = 0; i < transitNodesAmount; i++) {
+            if (i % 100 == 0) {
+                std::cout << "\rComputed '" << i << "' transit nodes distance table rows.";
+            }
 
-        std::vector<unsigned int> distancesFromNodeI(originalGraph.nodes());
-        BasicDijkstra::computeOneToAllDistances(transitNodes[i], originalGraph, distancesFromNodeI);
-        for (unsigned int j = 0; j < transitNodesAmount; j++) {
-            transitNodesDistanceTable[i][j] = distancesFromNodeI[transitNodes[j]];
+            std::vector<unsigned int> distancesFromNodeI(originalGraph.nodes());
+            BasicDijkstra::computeOneToAllDistances(transitNodes[i], originalGraph, distancesFromNodeI);
+            for (unsigned int j = 0; j < transitNodesAmount; j++) {
+                transitNodesDistanceTable[i][j] = distancesFromNodeI[transitNodes[j]];
+            }
         }
-    }
 
-    std::cout << "\rComputed the transit nodes distance table." << std::endl;
+        std::cout << "\rComputed the transit nodes distance table." << std::endl;
+        saveTransitNodesDistanceTable(checkpoints, transitNodesAmount, transitNodesDistanceTable);
+    }
 
-    std::cout << "Computing access nodes" << std::endl;
     std::vector<std::vector<AccessNodeData> > forwardAccessNodes(graph.nodes());
     std::vector<std::vector<AccessNodeData> > backwardAccessNodes(graph.nodes());
     std::vector<std::vector<unsigned int> > forwardSearchSpaces(graph.nodes());
     std::vector<std::vector<unsigned int> > backwardSearchSpaces(graph.nodes());
-    std::unordered_map<unsigned int, unsigned int> transitNodesMapping;
-    for (unsigned int i = 0; i < transitNodesAmount; i++) {
-        transitNodesMapping.insert(std::make_pair(transitNodes[i], i));
-    }
+    const std::string accessParameters = "mode=slow tnodes=" + std::to_string(transitNodesAmount);
+    if (!loadAccessNodes(checkpoints, accessParameters, forwardAccessNodes, backwardAccessNodes, forwardSearchSpaces,
+                         backwardSearchSpaces)) {
+        std::cout << "Computing access nodes" << std::endl;
+        std::unordered_map<unsigned int, unsigned int> transitNodesMapping;
+        for (unsigned int i = 0; i < transitNodesAmount; i++) {
+            transitNodesMapping.insert(std::make_pair(transitNodes[i], i));
+        }
+
+        for (unsigned int i = 0; i < graph.nodes(); i++) {
+            if (i % 100 == 0) {
+                std::cout << "\rComputed access nodes for '" << i << "' nodes.";
+            }
 
-    for (unsigned int i = 0; i < graph.nodes(); i++) {
-        if (i % 100 == 0) {
-            std::cout << "\rComputed access nodes for '" << i << "' nodes.";
-        }
-
-        std::vector<unsigned int> forwardDistsFromNode(graph.nodes());
-        BasicDijkstra::computeOneToAllDistances(i, originalGraph, forwardDistsFromNode);
-        findForwardAccessNodes(i, forwardAccessNodes[i], forwardSearchSpaces[i], transitNodesMapping,
-                               forwardDistsFromNode, chGraph);
-        std::vector<unsigned int> backwardDistsFromNode(graph.nodes());
-        BasicDijkstra::computeOneToAllDistancesInReversedGraph(i, originalGraph, backwardDistsFromNode);
-        findBackwardAccessNodes(i, backwardAccessNodes[i], backwardSearchSpaces[i], transitNodesMapping,
-                                backwardDistsFromNode, chGraph);
-    }
+            std::vector<unsigned int> forwardDistsFromNode(graph.nodes());
+            BasicDijkstra::computeOneToAllDistances(i, originalGraph, forwardDistsFromNode);
+            findForwardAccessNodes(i, forwardAccessNodes[i], forwardSearchSpaces[i], transitNodesMapping,
+                                   forwardDistsFromNode, chGraph);
+            std::vector<unsigned int> backwardDistsFromNode(graph.nodes());
+            BasicDijkstra::computeOneToAllDistancesInReversedGraph(i, originalGraph, backwardDistsFromNode);
+            findBackwardAccessNodes(i, backwardAccessNodes[i], backwardSearchSpaces[i], transitNodesMapping,
+                                    backwardDistsFromNode, chGraph);
+        }
 
-    std::cout << "\rComputed acess nodes for all the nodes in the graph." << std::endl;
+        std::cout << "\rComputed acess nodes for all the nodes in the graph." << std::endl;
+        saveAccessNodes(checkpoints, accessParameters, forwardAccessNodes, backwardAccessNodes, forwardSearchSpaces,
+                        backwardSearchSpaces);
+    }
 
     std::vector<std::pair<unsigned int, QueryEdge> > allEdges;
     chGraph.getEdgesForFlushing(allEdges);
@@ -156,91 +176,190 @@ void TNRPreprocessor::preprocessUsingCHslower(UpdateableGraph& graph, Graph& ori
 
 //______________________________________________________________________________________________________________________
 void TNRPreprocessor::preprocessWithDMvalidation(UpdateableGraph &graph, Graph &originalGraph, std::string outputPath,
-                                                 unsigned int transitNodesAmount, unsigned int intSize) {
+                                                 unsigned int transitNodesAmount, unsigned int intSize,
+                                                 const PreprocessingCheckpoints &checkpoints) {
     std::cout << "Getting transit nodes" << std::endl;
     std::vector<unsigned int> transitNodes(transitNodesAmount);
     graph.getNodesWithHighestRank(transitNodes, transitNodesAmount);
 
     FlagsGraph chGraph(graph);
 
-    DistanceMatrixInterface* distanceMatrix;
-    if (intSize == 16) {
-        DistanceMatrixComputorSlow<uint_least16_t> dmComputor;
-        dmComputor.computeDistanceMatrix(originalGraph);
-        distanceMatrix = new Distance_matrix_travel_time_provider(dmComputor.getDistanceMatrixInstance(), originalGraph.nodes());
-    } else if (intSize == 32) {
-        DistanceMatrixComputorSlow<uint_least32_t> dmComputor;
-        dmComputor.computeDistanceMatrix(originalGraph);
-        distanceMatrix = new Distance_matrix_travel_time_provider(dmComputor.getDistanceMatrixInstance(), originalGraph.nodes());
-    } else {
-        DistanceMatrixComputorSlow<dist_t> dmComputor;
-        dmComputor.computeDistanceMatrix(originalGraph);
-        distanceMatrix = new Distance_matrix_travel_time_provider(dmComputor.getDistanceMatrixInstance(), originalGraph.nodes());
-    }
-
-    std::cout << "Computing transit nodes distance table" << std::endl;
     std::vector<std::vector<unsigned int> > transitNodesDistanceTable(transitNodesAmount,
                                                                       std::vector<unsigned int>(transitNodesAmount));
-    for (unsigned int i = 0; i < transitNodesAmount; i++) {
-        for (unsigned int j = 0; j < transitNodesAmount; j++) {
-                transitNodesDistanceTable[i][j] = distanceMatrix->findDistance(transitNodes[i], transitNodes[j]);
-        }
-    }
-
-    std::cout << "Computing access nodes" << std::endl;
     std::vector<std::vector<AccessNodeData> > forwardAccessNodes(graph.nodes());
     std::vector<std::vector<AccessNodeData> > backwardAccessNodes(graph.nodes());
     std::vector<std::vector<unsigned int> > forwardSearchSpaces(graph.nodes());
     std::vector<std::vector<unsigned int> > backwardSearchSpaces(graph.nodes());
-    std::unordered_map<unsigned int, unsigned int> transitNodesMapping;
-    for (unsigned int i = 0; i < transitNodesAmount; i++) {
-        transitNodesMapping.insert(std::make_pair(transitNodes[i], i));
-    }
+    const std::string accessParameters = "mode=dm tnodes=" + std::to_string(transitNodesAmount);
+    const bool tableLoaded = loadTransitNodesDistanceTable(checkpoints, transitNodesAmount, transitNodesDistanceTable);
+    const bool accessNodesLoaded = loadAccessNodes(checkpoints, accessParameters, forwardAccessNodes,
+                                                   backwardAccessNodes, forwardSearchSpaces, backwardSearchSpaces);
+    if (!tableLoaded || !accessNodesLoaded) {
+        DistanceMatrixInterface* distanceMatrix = createDistanceMatrix(originalGraph, intSize, false);
+
+        if (!tableLoaded) {
+            std::cout << "Computing transit nodes distance table" << std::endl;
+            for (unsigned int i = 0; i < transitNodesAmount; i++) {
+                for (unsigned int j = 0; j < transitNodesAmount; j++) {
+                    transitNodesDistanceTable[i][j] = distanceMatrix->findDistance(transitNodes[i], transitNodes[j]);
+                }
+            }
+            saveTransitNodesDistanceTable(checkpoints, transitNodesAmount, transitNodesDistanceTable);
+        }
 
-    for (unsigned int i = 0; i < graph.nodes(); i++) {
-        if (i % 100 == 0) {
-            std::cout << "\rComputed forward access nodes for '" << i << "' nodes.";
+        if (!accessNodesLoaded) {
+            std::cout << "Computing access nodes" << std::endl;
+            std::unordered_map<unsigned int, unsigned int> transitNodesMapping;
+            for (unsigned int i = 0; i < transitNodesAmount; i++) {
+                transitNodesMapping.insert(std::make_pair(transitNodes[i], i));
+            }
+
+            for (unsigned int i = 0; i < graph.nodes(); i++) {
+                if (i % 100 == 0) {
+                    std::cout << "\rComputed forward access nodes for '" << i << "' nodes.";
+                }
+
+                findForwardAccessNodes(i, forwardAccessNodes[i], forwardSearchSpaces[i], transitNodesMapping, chGraph,
+                                       *distanceMatrix);
+            }
+
+            std::cout << "\rComputed forward acess nodes for all the nodes in the graph." << std::endl;
+
+            delete distanceMatrix;
+            distanceMatrix = createDistanceMatrix(originalGraph, intSize, true);
+
+            for (unsigned int i = 0; i < graph.nodes(); i++) {
+                if (i % 100 == 0) {
+                    std::cout << "\rComputed backward access nodes for '" << i << "' nodes.";
+                }
+
+                findBackwardAccessNodes(i, backwardAccessNodes[i], backwardSearchSpaces[i], transitNodesMapping,
+                                        chGraph, *distanceMatrix);
+            }
+
+            std::cout << "\rComputed backward acess nodes for all the nodes in the graph." << std::endl;
+            saveAccessNodes(checkpoints, accessParameters, forwardAccessNodes, backwardAccessNodes,
+                            forwardSearchSpaces, backwardSearchSpaces);
         }
 
-        findForwardAccessNodes(i, forwardAccessNodes[i], forwardSearchSpaces[i], transitNodesMapping, chGraph,
-                               *distanceMatrix);
+        delete distanceMatrix;
     }
 
-    std::cout << "\rComputed forward acess nodes for all the nodes in the graph." << std::endl;
+    std::vector<std::pair<unsigned int, QueryEdge> > allEdges;
+    chGraph.getEdgesForFlushing(allEdges);
+
+    outputGraph(outputPath, graph, allEdges, transitNodes, transitNodesDistanceTable, forwardAccessNodes,
+                backwardAccessNodes, forwardSearchSpaces, backwardSearchSpaces, transitNodesAmount);
+}
 
-    delete distanceMatrix;
+//______________________________________________________________________________________________________________________
+DistanceMatrixInterface *TNRPreprocessor::createDistanceMatrix(Graph &originalGraph, unsigned int intSize,
+                                                               bool reversed) {
     if (intSize == 16) {
         DistanceMatrixComputorSlow<uint_least16_t> dmComputor;
-        dmComputor.computeDistanceMatrixInReversedGraph(originalGraph);
-        distanceMatrix = new Distance_matrix_travel_time_provider(dmComputor.getDistanceMatrixInstance(), originalGraph.nodes());
+        if (reversed) {
+            dmComputor.computeDistanceMatrixInReversedGraph(originalGraph);
+        } else {
+            dmComputor.computeDistanceMatrix(originalGraph);
+        }
+        return new Distance_matrix_travel_time_provider(dmComputor.getDistanceMatrixInstance(), originalGraph.nodes());
     } else if (intSize == 32) {
         DistanceMatrixComputorSlow<uint_least32_t> dmComputor;
-        dmComputor.computeDistanceMatrixInReversedGraph(originalGraph);
-        distanceMatrix = new Distance_matrix_travel_time_provider(dmComputor.getDistanceMatrixInstance(), originalGraph.nodes());
+        if (reversed) {
+            dmComputor.computeDistanceMatrixInReversedGraph(originalGraph);
+        } else {
+            dmComputor.computeDistanceMatrix(originalGraph);
+        }
+        return new Distance_matrix_travel_time_provider(dmComputor.getDistanceMatrixInstance(), originalGraph.nodes());
     } else {
         DistanceMatrixComputorSlow<dist_t> dmComputor;
-        dmComputor.computeDistanceMatrixInReversedGraph(originalGraph);
-        distanceMatrix = new Distance_matrix_travel_time_provider(dmComputor.getDistanceMatrixInstance(), originalGraph.nodes());
+        if (reversed) {
+            dmComputor.computeDistanceMatrixInReversedGraph(originalGraph);
+        } else {
+            dmComputor.computeDistanceMatrix(originalGraph);
+        }
+        return new Distance_matrix_travel_time_provider(dmComputor.getDistanceMatrixInstance(), originalGraph.nodes());
     }
+}
 
-    for (unsigned int i = 0; i < graph.nodes(); i++) {
-        if (i % 100 == 0) {
-            std::cout << "\rComputed backward access nodes for '" << i << "' nodes.";
-        }
+//______________________________________________________________________________________________________________________
+bool TNRPreprocessor::loadTransitNodesDistanceTable(const PreprocessingCheckpoints &checkpoints,
+                                                    unsigned int transitNodesAmount,
+                                                    std::vector<std::vector<unsigned int> > &transitNodesDistanceTable) {
+    return checkpoints.load("transit-table", "tnodes=" + std::to_string(transitNodesAmount), [&](std::istream &input) {
+        transitNodesDistanceTable = PreprocessingCheckpoints::readTable<unsigned int>(input);
+    });
+}
 
-        findBackwardAccessNodes(i, backwardAccessNodes[i], backwardSearchSpaces[i], transitNodesMapping, chGraph,
-                                *distanceMatrix);
+//______________________________________________________________________________________________________________________
+void TNRPreprocessor::saveTransitNodesDistanceTable(
+        const PreprocessingCheckpoints &checkpoints,
+        unsigned int transitNodesAmount,
+        const std::vector<std::vector<unsigned int> > &transitNodesDistanceTable) {
+    checkpoints.save("transit-table", "tnodes=" + std::to_string(transitNodesAmount), [&](std::ostream &output) {
+        PreprocessingCheckpoints::writeTable(output, transitNodesDistanceTable);
+    });
+}
+
+namespace {
+
+void writeAccessNodeTable(std::ostream &output, const std::vector<std::vector<AccessNodeData> > &accessNodes) {
+    PreprocessingCheckpoints::writeValue<uint64_t>(output, accessNodes.size());
+    for (const auto &nodeAccessNodes : accessNodes) {
+        PreprocessingCheckpoints::writeValue<uint32_t>(output, boost::numeric_cast<uint32_t>(nodeAccessNodes.size()));
+        for (const auto &accessNode : nodeAccessNodes) {
+            PreprocessingCheckpoints::writeValue(output, accessNode.accessNodeID);
+            PreprocessingCheckpoints::writeValue(output, accessNode.distanceToNode);
+        }
     }
+}
 
-    std::cout << "\rComputed backward acess nodes for all the nodes in the graph." << std::endl;
+std::vector<std::vector<AccessNodeData> > readAccessNodeTable(std::istream &input) {
+    std::vector<std::vector<AccessNodeData> > accessNodes(PreprocessingCheckpoints::readValue<uint64_t>(input));
+    for (auto &nodeAccessNodes : accessNodes) {
+        const auto count = PreprocessingCheckpoints::readValue<uint32_t>(input);
+        nodeAccessNodes.reserve(count);
+        for (uint32_t i = 0; i < count; i++) {
+            const auto id = PreprocessingCheckpoints::readValue<unsigned int>(input);
+            const auto distance = PreprocessingCheckpoints::readValue<unsigned int>(input);
+            nodeAccessNodes.emplace_back(id, distance);
+        }
+    }
+    return accessNodes;
+}
 
-    delete distanceMatrix;
+}
 
-    std::vector<std::pair<unsigned int, QueryEdge> > allEdges;
-    chGraph.getEdgesForFlushing(allEdges);
+//______________________________________________________________________________________________________________________
+bool TNRPreprocessor::loadAccessNodes(const PreprocessingCheckpoints &checkpoints, const std::string &parameters,
+                                      std::vector<std::vector<AccessNodeData> > &forwardAccessNodes,
+                                      std::vector<std::vector<AccessNodeData> > &backwardAccessNodes,
+                                      std::vector<std::vector<unsigned int> > &forwardSearchSpaces,
+                                      std::vector<std::vector<unsigned int> > &backwardSearchSpaces) {
+    return checkpoints.load("tnr-access-nodes", parameters, [&](std::istream &input) {
+        auto forward = readAccessNodeTable(input);
+        auto backward = readAccessNodeTable(input);
+        auto forwardSpaces = PreprocessingCheckpoints::readTable<unsigned int>(input);
+        auto backwardSpaces = PreprocessingCheckpoints::readTable<unsigned int>(input);
+        forwardAccessNodes = std::move(forward);
+        backwardAccessNodes = std::move(backward);
+        forwardSearchSpaces = std::move(forwardSpaces);
+        backwardSearchSpaces = std::move(backwardSpaces);
+    });
+}
 
-    outputGraph(outputPath, graph, allEdges, transitNodes, transitNodesDistanceTable, forwardAccessNodes,
-                backwardAccessNodes, forwardSearchSpaces, backwardSearchSpaces, transitNodesAmount);
+//______________________________________________________________________________________________________________________
+void TNRPreprocessor::saveAccessNodes(const PreprocessingCheckpoints &checkpoints, const std::string &parameters,
+                                      const std::vector<std::vector<AccessNodeData> > &forwardAccessNodes,
+                                      const std::vector<std::vector<AccessNodeData> > &backwardAccessNodes,
+                                      const std::vector<std::vector<unsigned int> > &forwardSearchSpaces,
+                                      const std::vector<std::vector<unsigned int> > &backwardSearchSpaces) {
+    checkpoints.save("tnr-access-nodes", parameters, [&](std::ostream &output) {
+        writeAccessNodeTable(output, forwardAccessNodes);
+        writeAccessNodeTable(output, backwardAccessNodes);
+        PreprocessingCheckpoints::writeTable(output, forwardSearchSpaces);
+        PreprocessingCheckpoints::writeTable(output, backwardSearchSpaces);
+    });
 }
 
 //______________________________________________________________________________________________________________________
@@ -35,6 +35,7 @@
 #include "../GraphBuilding/Structures/FlagsGraph.h"
 #include "../GraphBuilding/Loaders/XenGraphLoader.h"
 #include "../DistanceMatrix/Distance_matrix_travel_time_provider.h"
+#include "../Checkpoint/PreprocessingCheckpoints.h"
 
 
 
@@ -60,11 +61,13 @@ public:
      * @param graph[in] The input graph in the UpdateableGraph format.
      * @param outputPath[in] The desired output path where the obtained data structure will be output.
      * @param transitNodesAmount[in] The desired amount of transit nodes.
+     * @param checkpoints[in] The checkpoints for the transit node distance table and for the access nodes.
      */
     static void preprocessUsingCH(
             UpdateableGraph & graph,
             std::string outputPath,
-            unsigned int transitNodesAmount = 1000);
+            unsigned int transitNodesAmount = 1000,
+            const PreprocessingCheckpoints & checkpoints = PreprocessingCheckpoints());
 
     /**
      * Builds Transit Node Routing structures based on Contraction Hierarchies.
@@ -79,12 +82,14 @@ public:
      * preprocessing process.
      * @param outputPath[in] The desired output path where the obtained data structure will be output.
      * @param transitNodesAmount[in] The desired amount of transit nodes.
+     * @param checkpoints[in] The checkpoints for the transit node distance table and for the access nodes.
      */
     static void preprocessUsingCHslower(
             UpdateableGraph & graph,
             Graph & originalGraph,
             std::string outputPath,
-            unsigned int transitNodesAmount = 1000);
+            unsigned int transitNodesAmount = 1000,
+            const PreprocessingCheckpoints & checkpoints = PreprocessingCheckpoints());
 
     /**
      * Build Transit Node Routing structures based on Contraction Hierarchies.
@@ -98,15 +103,94 @@ public:
      * preprocessing process.
      * @param outputPath[in] The desired output path where the obtained data structure will be output.
      * @param transitNodesAmount[in] The desired amount of transit nodes.
+     * @param checkpoints[in] The checkpoints for the transit node distance table and for the access nodes. The distance
+     * matrices are not computed at all if both phases are loaded from the checkpoints.
      */
     static void preprocessWithDMvalidation(
             UpdateableGraph & graph,
             Graph & originalGraph,
             std::string outputPath,
             unsigned int transitNodesAmount = 1000,
-            unsigned int intSize = 0);
+            unsigned int intSize = 0,
+            const PreprocessingCheckpoints & checkpoints = PreprocessingCheckpoints());
 
 protected:
+    /**
+     * Computes the full distance matrix of a graph used by the 'preprocessWithDMvalidation' function.
+     *
+     * @param originalGraph[in] The graph.
+     * @param intSize[in] The size of the integers used to store the distances (16, 32 or 0 for the default type).
+     * @param reversed[in] If true, the distance matrix is computed for the graph with all the edges reversed.
+     * @return The new distance matrix, owned by the caller.
+     */
+    static DistanceMatrixInterface * createDistanceMatrix(
+            Graph & originalGraph,
+            unsigned int intSize,
+            bool reversed);
+
+    /**
+     * Tries to load the transit node distance table from its checkpoint. The table does not depend on
+     * the preprocessing mode, so the checkpoint is shared by all the Transit Node Routing variants.
+     *
+     * @param checkpoints[in] The checkpoints.
+     * @param transitNodesAmount[in] The size of the transit node set.
+     * @param transitNodesDistanceTable[out] The loaded table.
+     * @return True if the table was loaded.
+     */
+    static bool loadTransitNodesDistanceTable(
+            const PreprocessingCheckpoints & checkpoints,
+            unsigned int transitNodesAmount,
+            std::vector < std::vector < unsigned int > > & transitNodesDistanceTable);
+
+    /**
+     * Saves the transit node distance table into its checkpoint.
+     *
+     * @param checkpoints[in] The checkpoints.
+     * @param transitNodesAmount[in] The size of the transit node set.
+     * @param transitNodesDistanceTable[in] The table.
+     */
+    static void saveTransitNodesDistanceTable(
+            const PreprocessingCheckpoints & checkpoints,
+            unsigned int transitNodesAmount,
+            const std::vector < std::vector < unsigned int > > & transitNodesDistanceTable);
+
+    /**
+     * Tries to load the forward and backward access nodes and search spaces of all nodes from their checkpoint.
+     *
+     * @param checkpoints[in] The checkpoints.
+     * @param parameters[in] The description of the preprocessing mode and of the size of the transit node set.
+     * @param forwardAccessNodes[out] The loaded forward access nodes.
+     * @param backwardAccessNodes[out] The loaded backward access nodes.
+     * @param forwardSearchSpaces[out] The loaded forward search spaces.
+     * @param backwardSearchSpaces[out] The loaded backward search spaces.
+     * @return True if the access nodes were loaded.
+     */
+    static bool loadAccessNodes(
+            const PreprocessingCheckpoints & checkpoints,
+            const std::string & parameters,
+            std::vector < std::vector < AccessNodeData > > & forwardAccessNodes,
+            std::vector < std::vector < AccessNodeData > > & backwardAccessNodes,
+            std::vector < std::vector < unsigned int > > & forwardSearchSpaces,
+            std::vector < std::vector < unsigned int > > & backwardSearchSpaces);
+
+    /**
+     * Saves the forward and backward access nodes and search spaces of all nodes into their checkpoint.
+     *
+     * @param checkpoints[in] The checkpoints.
+     * @param parameters[in] The description of the preprocessing mode and of the size of the transit node set.
+     * @param forwardAccessNodes[in] The forward access nodes.
+     * @param backwardAccessNodes[in] The backward access nodes.
+     * @param forwardSearchSpaces[in] The forward search spaces.
+     * @param backwardSearchSpaces[in] The backward search spaces.
+     */
+    static void saveAccessNodes(
+            const PreprocessingCheckpoints & checkpoints,
+            const std::string & parameters,
+            const std::vector < std::vector < AccessNodeData > > & forwardAccessNodes,
+            const std::vector < std::vector < AccessNodeData > > & backwardAccessNodes,
+            const std::vector < std::vector < unsigned int > > & forwardSearchSpaces,
+            const std::vector < std::vector < unsigned int > > & backwardSearchSpaces);
+
     /**
      * Outputs the created Transit Node Routing data-structure with all the information required for the query algorithm
      * into a binary file.
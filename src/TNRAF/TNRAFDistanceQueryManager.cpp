@@ -29,7 +29,7 @@
 #include "TNRAFDistanceQueryManager.h"
 
 //______________________________________________________________________________________________________________________
-TNRAFDistanceQueryManager::TNRAFDistanceQueryManager(TransitNodeRoutingArcFlagsGraph& graph) : graph(graph), fallbackCHmanager(graph) {
+TNRAFDistanceQueryManager::TNRAFDistanceQueryManager(const TransitNodeRoutingArcFlagsGraph& graph) : graph(graph), fallbackCHmanager(graph), statistics(nullptr) {
 
 }
 
@@ -39,9 +39,16 @@ unsigned int TNRAFDistanceQueryManager::findDistance(const unsigned int start, c
         return 0;
     } else {
         if (graph.isLocalQuery(start, goal)) { // Is local query, fallback to some other distance manager, here CH
+            COUNT_QUERY_STATISTIC(statistics, localQueryFallbacks, 1);
             return fallbackCHmanager.findDistance(start, goal);
         } else { // Not local query, TNR can be used.
-            return graph.findTNRAFDistance(start, goal);
+            return graph.findTNRAFDistance(start, goal, statistics);
         }
     }
 }
+
+//______________________________________________________________________________________________________________________
+void TNRAFDistanceQueryManager::setStatistics(QueryStatistics* queryStatistics) {
+    statistics = queryStatistics;
+    fallbackCHmanager.setStatistics(queryStatistics);
+}
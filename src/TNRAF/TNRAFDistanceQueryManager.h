@@ -45,7 +45,7 @@ public:
      * @param graph[in] The Transit Node Routing with Arc Flags data structure that will be used to answer queries.
      */
     explicit TNRAFDistanceQueryManager(
-            TransitNodeRoutingArcFlagsGraph& graph);
+            const TransitNodeRoutingArcFlagsGraph& graph);
 
     /**
      * Actually finds the distance between two targets. If start != goal, this function first invokes the locality
@@ -64,9 +64,20 @@ public:
             const unsigned int start,
             const unsigned int goal);
 
+    /**
+     * Enables or disables the collection of the search statistics, including the statistics of the Contraction
+     * Hierarchies fallback. When enabled, the following queries add their counters to the given instance, which is
+     * not reset between the queries.
+     *
+     * @param queryStatistics[in] The instance the counters are added to, or nullptr to disable the collection.
+     */
+    void setStatistics(
+            QueryStatistics* queryStatistics);
+
 private:
-    TransitNodeRoutingArcFlagsGraph& graph;
+    const TransitNodeRoutingArcFlagsGraph& graph;
     CHDistanceQueryManager<NodeDataRegions> fallbackCHmanager;
+    QueryStatistics* statistics;
 };
 
 
@@ -27,15 +27,35 @@
 //
 
 #include "TNRAFDistanceQueryManagerWithMapping.h"
-#include "../GraphBuilding/Loaders/XenGraphLoader.h"
+#include "../GraphBuilding/Loaders/NodeMappingLoader.h"
 
 //______________________________________________________________________________________________________________________
-TNRAFDistanceQueryManagerWithMapping::TNRAFDistanceQueryManagerWithMapping(TransitNodeRoutingArcFlagsGraph & g, std::string mappingFilepath) : qm(g) {
-    XenGraphLoader mappingLoader(mappingFilepath);
-    mappingLoader.loadNodesMapping(mapping);
+TNRAFDistanceQueryManagerWithMapping::TNRAFDistanceQueryManagerWithMapping(
+        TransitNodeRoutingArcFlagsGraph& g,
+        std::string mappingFilepath,
+        const SimplificationTable* simplification) : qm(g), simplification(simplification) {
+    NodeMappingLoader mappingLoader(mappingFilepath);
+    mapping = mappingLoader.loadMapping(simplification ? simplification->nodes() : g.nodes());
 }
 
 //______________________________________________________________________________________________________________________
 unsigned int TNRAFDistanceQueryManagerWithMapping::findDistance(const long long unsigned int start, const long long unsigned int goal) {
-    return qm.findDistance(mapping.at(start), mapping.at(goal));
-}
\ No newline at end of file
+    const unsigned int internalStart = mapping.internalID(start);
+    const unsigned int internalGoal = mapping.internalID(goal);
+    if (simplification) {
+        return simplification->findDistance(internalStart, internalGoal, [this](unsigned int from, unsigned int to) {
+            return qm.findDistance(from, to);
+        });
+    }
+    return qm.findDistance(internalStart, internalGoal);
+}
+
+//______________________________________________________________________________________________________________________
+void TNRAFDistanceQueryManagerWithMapping::setStatistics(QueryStatistics* queryStatistics) {
+    qm.setStatistics(queryStatistics);
+}
+
+//______________________________________________________________________________________________________________________
+unsigned int TNRAFDistanceQueryManagerWithMapping::internalID(const long long unsigned int originalID) const {
+    return mapping.internalID(originalID);
+}
@@ -29,6 +29,8 @@
 #include <iostream>
 #include <climits>
 #include <fstream>
+#include <cstdio>
+#include <stdexcept>
 #include <boost/numeric/conversion/cast.hpp>
 #include "../DistanceMatrix/DistanceMatrixComputorSlow.h"
 #include "TNRAFPreprocessor.h"
@@ -38,6 +40,7 @@
 #include "../Dijkstra/DijkstraNode.h"
 #include "../Dijkstra/BasicDijkstra.h"
 #include "../benchmark.h"
+#include "../Checkpoint/PreprocessingCheckpoints.h"
 
 //______________________________________________________________________________________________________________________
 void TNRAFPreprocessor::preprocessUsingCH(
@@ -47,33 +50,80 @@ void TNRAFPreprocessor::preprocessUsingCH(
 	unsigned int transitNodesAmount,
 	unsigned int regionsCnt,
 	unsigned int dmIntSize,
-	TNRAFPreprocessingMode mode
+	TNRAFPreprocessingMode mode,
+	const PreprocessingCheckpoints & checkpoints,
+	const TNRAFMemoryBudget & memoryBudget
 ) {
+	const auto phaseFinished = [&memoryBudget](const std::string & phase) {
+		if (memoryBudget.phaseFinished) {
+			memoryBudget.phaseFinished(phase);
+		}
+	};
+
 	std::cout << "Getting transit nodes" << std::endl;
 	std::vector<unsigned int> transitNodes(transitNodesAmount);
 	graph.getNodesWithHighestRank(transitNodes, transitNodesAmount);
 
-	std::cout << "Computing transit nodes distance table" << std::endl;
 	FlagsGraph<NodeDataRegions> chGraph(graph);
 	CHDistanceQueryManager qm(chGraph);
 
-	// compute dm between transit nodes - this dm is computed in all modes
+	// all the modes give the same results, so the checkpoints only depend on the sizes of the transit node set and
+	// of the region set
+	const std::string accessParameters = "tnodes=" + std::to_string(transitNodesAmount) + " regions="
+		+ std::to_string(regionsCnt);
+
 	std::vector<std::vector<unsigned int> > transitNodesDistanceTable(transitNodesAmount,std::vector<unsigned int>(transitNodesAmount));
-	if (mode == TNRAFPreprocessingMode::DM) {
+	std::vector<std::vector<AccessNodeDataArcFlags> > forwardAccessNodes(graph.nodes());
+	std::vector<std::vector<AccessNodeDataArcFlags> > backwardAccessNodes(graph.nodes());
+	std::vector<std::vector<unsigned int> > forwardSearchSpaces(graph.nodes());
+	std::vector<std::vector<unsigned int> > backwardSearchSpaces(graph.nodes());
+
+	const auto readForward = [&](std::istream & input) {
+		auto accessNodes = readAccessNodes(input);
+		forwardSearchSpaces = PreprocessingCheckpoints::readTable<unsigned int>(input);
+		forwardAccessNodes = std::move(accessNodes);
+	};
+	const auto writeForward = [&](std::ostream & output) {
+		writeAccessNodes(output, forwardAccessNodes);
+		PreprocessingCheckpoints::writeTable(output, forwardSearchSpaces);
+	};
+	const auto readBackward = [&](std::istream & input) {
+		auto accessNodes = readAccessNodes(input);
+		backwardSearchSpaces = PreprocessingCheckpoints::readTable<unsigned int>(input);
+		backwardAccessNodes = std::move(accessNodes);
+	};
+	const auto writeBackward = [&](std::ostream & output) {
+		writeAccessNodes(output, backwardAccessNodes);
+		PreprocessingCheckpoints::writeTable(output, backwardSearchSpaces);
+	};
+
+	const bool tableLoaded = loadTransitNodesDistanceTable(checkpoints, transitNodesAmount, transitNodesDistanceTable);
+	const bool forwardFlagsLoaded = checkpoints.load("tnraf-forward-flags", accessParameters, readForward);
+	const bool forwardAccessNodesLoaded = forwardFlagsLoaded
+		|| checkpoints.load("tnraf-forward-access-nodes", accessParameters, readForward);
+
+	// compute dm between transit nodes - this dm is computed in all modes
+	if (mode == TNRAFPreprocessingMode::DM && (! tableLoaded || ! forwardFlagsLoaded)) {
 		std::cout
 			<< "Computing the auxiliary distance matrix for transit node set distance matrix and access nodes forward direction."
 			<< std::endl;
 		this->forward_dm_computation_time_ms_ = benchmark<std::chrono::milliseconds>(
             &TNRAFPreprocessor::generateDistanceMatrix, this, std::ref(originalGraph), dmIntSize, true);
 		std::cout << "Distance matrix computed." << std::endl;
-
-		fillTransitNodeDistanceTable(transitNodes, transitNodesDistanceTable, transitNodesAmount);
-	} else {
-		computeTransitNodeDistanceTable(transitNodes, transitNodesDistanceTable, transitNodesAmount, originalGraph);
+	}
+	if (! tableLoaded) {
+		std::cout << "Computing transit nodes distance table" << std::endl;
+		if (mode == TNRAFPreprocessingMode::DM) {
+			fillTransitNodeDistanceTable(transitNodes, transitNodesDistanceTable, transitNodesAmount);
+		} else {
+			computeTransitNodeDistanceTable(transitNodes, transitNodesDistanceTable, transitNodesAmount, originalGraph);
+		}
+		saveTransitNodesDistanceTable(checkpoints, transitNodesAmount, transitNodesDistanceTable);
+		phaseFinished("transit node distance table");
 	}
 
 	// compute dm from transit nodes to all nodes - this dm is computed only for fast mode
-	if (mode == TNRAFPreprocessingMode::FAST) {
+	if (mode == TNRAFPreprocessingMode::FAST && ! forwardAccessNodesLoaded) {
 		std::cout << "Computing all-nodes to transit-nodes distance matrix (FAST mode, forward)." << std::endl;
         this->forward_dm_computation_time_ms_ = benchmark<std::chrono::milliseconds>([&]() {
             if (dmIntSize == 16) {
@@ -85,58 +135,66 @@ void TNRAFPreprocessor::preprocessUsingCH(
             }
         });
 		std::cout << "\nAll-nodes to transit-nodes distance matrix computed for " << transitNodesAmount << " transit nodes (forward)." << std::endl;
+		phaseFinished("forward distance matrix");
 	}
 
 	Regions_with_borders regions = generateClustering(originalGraph, regionsCnt);
 
-	std::vector<std::vector<AccessNodeDataArcFlags> > forwardAccessNodes(graph.nodes());
-	std::vector<std::vector<AccessNodeDataArcFlags> > backwardAccessNodes(graph.nodes());
-	std::vector<std::vector<unsigned int> > forwardSearchSpaces(graph.nodes());
-	std::vector<std::vector<unsigned int> > backwardSearchSpaces(graph.nodes());
 	std::unordered_map<unsigned int, unsigned int> transitNodesMapping;
 	for (unsigned int i = 0; i < transitNodesAmount; i++) {
 		transitNodesMapping.insert(std::make_pair(transitNodes[i], i));
 	}
 
-    this->forward_access_nodes_computation_time_ms_ = benchmark<std::chrono::milliseconds>(
-        &TNRAFPreprocessor::process_forward_access_nodes, this,
-        originalGraph.nodes(), std::ref(forwardAccessNodes), std::ref(forwardSearchSpaces),
-        std::ref(transitNodesMapping), std::ref(chGraph), std::ref(originalGraph), std::ref(regions), mode);
+	// the slow mode verifies the access node candidates using the Contraction Hierarchy instead of a distance matrix
+	if (mode == TNRAFPreprocessingMode::SLOW) {
+		transitNodeDistanceOracle = std::make_unique<TransitNodeDistanceOracle>(chGraph, transitNodes);
+	}
 
-	// forward arc flags computation
-	if(mode == TNRAFPreprocessingMode::DM) {
-		this->forward_arc_flags_computation_time_ms_ = benchmark<std::chrono::milliseconds>(
-			&TNRAFPreprocessor::compute_arc_flags<TNRAFPreprocessingMode::DM>, this,
-			std::ref(forwardAccessNodes), std::ref(originalGraph), std::ref(regions), true
-		);
+	if (! forwardAccessNodesLoaded) {
+		this->forward_access_nodes_computation_time_ms_ = benchmark<std::chrono::milliseconds>(
+			&TNRAFPreprocessor::process_forward_access_nodes, this,
+			originalGraph.nodes(), std::ref(forwardAccessNodes), std::ref(forwardSearchSpaces),
+			std::ref(transitNodesMapping), std::ref(chGraph), std::ref(regions), mode);
+		checkpoints.save("tnraf-forward-access-nodes", accessParameters, writeForward);
+		phaseFinished("forward access nodes");
 	}
-	else if(mode == TNRAFPreprocessingMode::FAST) {
-		this->forward_arc_flags_computation_time_ms_ = benchmark<std::chrono::milliseconds>(
-			&TNRAFPreprocessor::compute_arc_flags<TNRAFPreprocessingMode::FAST>, this,
-			std::ref(forwardAccessNodes), std::ref(originalGraph), std::ref(regions), true
-		);
+
+	// forward arc flags computation
+	if (! forwardFlagsLoaded) {
+		computeArcFlags(mode, forwardAccessNodes, originalGraph, regions, true);
+		checkpoints.save("tnraf-forward-flags", accessParameters, writeForward);
+		phaseFinished("forward arc flags");
 	}
-	else {
-		this->forward_arc_flags_computation_time_ms_ = benchmark<std::chrono::milliseconds>(
-			&TNRAFPreprocessor::compute_arc_flags<TNRAFPreprocessingMode::SLOW>, this,
-			std::ref(forwardAccessNodes), std::ref(originalGraph), std::ref(regions), true
-		);
+
+	// the forward access nodes are only needed for the output from now on
+	all_transit_dm.reset();
+	CompactAccessNodes forwardCompact = compactAccessNodes(forwardAccessNodes, forwardSearchSpaces, regionsCnt);
+	const bool forwardSpilled = memoryBudget.bytes != 0;
+	const std::string spillPath = memoryBudget.spillPath.empty() ? outputPath + ".tgaf.spill" : memoryBudget.spillPath;
+	if (forwardSpilled) {
+		spillAccessNodes(spillPath, forwardCompact);
+		forwardCompact = CompactAccessNodes();
 	}
 
 
 	// BACKWARD ACCESS NODE COMPUTATION
 
-	if (mode == TNRAFPreprocessingMode::DM) {
+	const bool backwardFlagsLoaded = checkpoints.load("tnraf-backward-flags", accessParameters, readBackward);
+	const bool backwardAccessNodesLoaded = backwardFlagsLoaded
+		|| checkpoints.load("tnraf-backward-access-nodes", accessParameters, readBackward);
+
+	delete distanceMatrix;
+	distanceMatrix = nullptr; // Ensure it's null before potential reassignment
+	if (mode == TNRAFPreprocessingMode::DM && ! backwardFlagsLoaded) {
 		std::cout << "Computing the auxiliary distance matrix for backward direction." << std::endl;
-		delete distanceMatrix;
-        distanceMatrix = nullptr; // Ensure it's null before potential reassignment
 		this->backward_dm_computation_time_ms_ = benchmark<std::chrono::milliseconds>(
             &TNRAFPreprocessor::generateDistanceMatrix, this, std::ref(originalGraph), dmIntSize, false);
 		std::cout << "Distance matrix computed." << std::endl;
+		phaseFinished("backward distance matrix");
 	}
 
 	// compute dm from all nodes to transit nodes - this dm is computed only for fast mode
-	if (mode == TNRAFPreprocessingMode::FAST) {
+	if (mode == TNRAFPreprocessingMode::FAST && ! backwardAccessNodesLoaded) {
 		std::cout << "Computing all-nodes to transit-nodes distance matrix (FAST mode, backward)." << std::endl;
         this->backward_dm_computation_time_ms_ = benchmark<std::chrono::milliseconds>([&]() {
             if (dmIntSize == 16) {
@@ -148,45 +206,248 @@ void TNRAFPreprocessor::preprocessUsingCH(
             }
         });
 		std::cout << "\nAll-nodes to transit-nodes distance matrix computed for " << transitNodesAmount << " transit nodes (backward)." << std::endl;
+		phaseFinished("backward distance matrix");
 	}
 
-    this->backward_access_nodes_computation_time_ms_ = benchmark<std::chrono::milliseconds>(
-        &TNRAFPreprocessor::process_backward_access_nodes, this,
-        originalGraph.nodes(), std::ref(backwardAccessNodes), std::ref(backwardSearchSpaces),
-        std::ref(transitNodesMapping), std::ref(chGraph), std::ref(originalGraph), std::ref(regions), mode);
+	if (! backwardAccessNodesLoaded) {
+		this->backward_access_nodes_computation_time_ms_ = benchmark<std::chrono::milliseconds>(
+			&TNRAFPreprocessor::process_backward_access_nodes, this,
+			originalGraph.nodes(), std::ref(backwardAccessNodes), std::ref(backwardSearchSpaces),
+			std::ref(transitNodesMapping), std::ref(chGraph), std::ref(regions), mode);
+		checkpoints.save("tnraf-backward-access-nodes", accessParameters, writeBackward);
+		phaseFinished("backward access nodes");
+	}
 
 	// backward arc flags computation
+	if (! backwardFlagsLoaded) {
+		computeArcFlags(mode, backwardAccessNodes, originalGraph, regions, false);
+		checkpoints.save("tnraf-backward-flags", accessParameters, writeBackward);
+		phaseFinished("backward arc flags");
+	}
+
+	// FINAL STEPS
+	delete distanceMatrix;
+	distanceMatrix = nullptr;
+	all_transit_dm.reset();
+	transitNodeDistanceOracle.reset();
+	searchDistances = std::vector<unsigned int>();
+	searchSettled = std::vector<bool>();
+	transitNodesMapping = std::unordered_map<unsigned int, unsigned int>();
+
+	const CompactAccessNodes backwardCompact = compactAccessNodes(backwardAccessNodes, backwardSearchSpaces, regionsCnt);
+	if (forwardSpilled) {
+		forwardCompact = restoreAccessNodes(spillPath);
+	}
+
+	std::vector<std::pair<unsigned int, QueryEdge> > allEdges;
+	chGraph.getEdgesForFlushing(allEdges);
+
+	outputGraph(outputPath, graph, allEdges, transitNodes, transitNodesDistanceTable, forwardCompact,
+				backwardCompact, transitNodesAmount, regions, regionsCnt);
+	phaseFinished("output");
+}
+
+//______________________________________________________________________________________________________________________
+size_t TNRAFPreprocessor::auxiliaryMemoryUsage(
+	TNRAFPreprocessingMode mode,
+	unsigned int nodes,
+	unsigned int transitNodesAmount,
+	unsigned int dmIntSize
+) {
+	const size_t entrySize = (dmIntSize == 16 || dmIntSize == 32) ? dmIntSize / 8 : sizeof(dist_t);
+	switch (mode) {
+		case TNRAFPreprocessingMode::DM:
+			return static_cast<size_t>(nodes) * nodes * entrySize;
+		case TNRAFPreprocessingMode::FAST:
+			return static_cast<size_t>(nodes) * transitNodesAmount * entrySize;
+		default:
+			return 0;
+	}
+}
+
+//______________________________________________________________________________________________________________________
+TNRAFPreprocessingMode TNRAFPreprocessor::chooseMode(
+	TNRAFPreprocessingMode requested,
+	unsigned int nodes,
+	unsigned int transitNodesAmount,
+	unsigned int dmIntSize,
+	size_t budget
+) {
+	if (requested == TNRAFPreprocessingMode::DM
+		&& auxiliaryMemoryUsage(TNRAFPreprocessingMode::DM, nodes, transitNodesAmount, dmIntSize) <= budget) {
+		return TNRAFPreprocessingMode::DM;
+	}
+	if (requested != TNRAFPreprocessingMode::SLOW
+		&& auxiliaryMemoryUsage(TNRAFPreprocessingMode::FAST, nodes, transitNodesAmount, dmIntSize) <= budget) {
+		return TNRAFPreprocessingMode::FAST;
+	}
+	return TNRAFPreprocessingMode::SLOW;
+}
+
+//______________________________________________________________________________________________________________________
+TNRAFPreprocessor::CompactAccessNodes TNRAFPreprocessor::compactAccessNodes(
+	std::vector<std::vector<AccessNodeDataArcFlags>> & accessNodes,
+	std::vector<std::vector<unsigned int>> & searchSpaces,
+	unsigned int regionsCnt
+) {
+	CompactAccessNodes compact;
+	compact.accessNodeOffsets.reserve(accessNodes.size() + 1);
+	compact.searchSpaceOffsets.reserve(searchSpaces.size() + 1);
+
+	size_t accessNodesCnt = 0;
+	for (const auto & nodeAccessNodes : accessNodes) {
+		accessNodesCnt += nodeAccessNodes.size();
+	}
+	compact.accessNodes.reserve(accessNodesCnt);
+
+	std::vector<uint32_t> powersOf2(regionsCnt);
+	initPowersOf2(powersOf2);
+	compact.accessNodeOffsets.push_back(0);
+	for (auto & nodeAccessNodes : accessNodes) {
+		for (const auto & accessNode : nodeAccessNodes) {
+			uint32_t regionFlags = 0;
+			for (unsigned int k = 0; k < regionsCnt; k++) {
+				if (accessNode.regionFlags[k]) {
+					regionFlags |= powersOf2[k];
+				}
+			}
+			compact.accessNodes.push_back({accessNode.accessNodeID, accessNode.distanceToNode, regionFlags});
+		}
+		compact.accessNodeOffsets.push_back(compact.accessNodes.size());
+		std::vector<AccessNodeDataArcFlags>().swap(nodeAccessNodes);
+	}
+	std::vector<std::vector<AccessNodeDataArcFlags>>().swap(accessNodes);
+
+	size_t searchSpacesSize = 0;
+	for (const auto & searchSpace : searchSpaces) {
+		searchSpacesSize += searchSpace.size();
+	}
+	compact.searchSpaces.reserve(searchSpacesSize);
+
+	compact.searchSpaceOffsets.push_back(0);
+	for (auto & searchSpace : searchSpaces) {
+		compact.searchSpaces.insert(compact.searchSpaces.end(), searchSpace.begin(), searchSpace.end());
+		compact.searchSpaceOffsets.push_back(compact.searchSpaces.size());
+		std::vector<unsigned int>().swap(searchSpace);
+	}
+	std::vector<std::vector<unsigned int>>().swap(searchSpaces);
+
+	return compact;
+}
+
+//______________________________________________________________________________________________________________________
+void TNRAFPreprocessor::spillAccessNodes(const std::string & path, const CompactAccessNodes & accessNodes) {
+	std::ofstream output(path, std::ios::binary);
+	if (! output.is_open()) {
+		throw std::runtime_error("Couldn't open the temporary file '" + path + "' for writing.");
+	}
+
+	PreprocessingCheckpoints::writeVector(output, accessNodes.accessNodeOffsets);
+	PreprocessingCheckpoints::writeVector(output, accessNodes.accessNodes);
+	PreprocessingCheckpoints::writeVector(output, accessNodes.searchSpaceOffsets);
+	PreprocessingCheckpoints::writeVector(output, accessNodes.searchSpaces);
+
+	output.close();
+	if (! output) {
+		throw std::runtime_error("Couldn't write the temporary file '" + path + "'.");
+	}
+}
+
+//______________________________________________________________________________________________________________________
+TNRAFPreprocessor::CompactAccessNodes TNRAFPreprocessor::restoreAccessNodes(const std::string & path) {
+	std::ifstream input(path, std::ios::binary);
+	if (! input.is_open()) {
+		throw std::runtime_error("Couldn't open the temporary file '" + path + "'.");
+	}
+
+	CompactAccessNodes accessNodes;
+	accessNodes.accessNodeOffsets = PreprocessingCheckpoints::readVector<size_t>(input);
+	accessNodes.accessNodes = PreprocessingCheckpoints::readVector<CompactAccessNodes::AccessNode>(input);
+	accessNodes.searchSpaceOffsets = PreprocessingCheckpoints::readVector<size_t>(input);
+	accessNodes.searchSpaces = PreprocessingCheckpoints::readVector<unsigned int>(input);
+	if (! input) {
+		throw std::runtime_error("Couldn't read the temporary file '" + path + "'.");
+	}
+
+	input.close();
+	std::remove(path.c_str());
+	return accessNodes;
+}
+
+//______________________________________________________________________________________________________________________
+void TNRAFPreprocessor::computeArcFlags(
+	TNRAFPreprocessingMode mode,
+	std::vector<std::vector<AccessNodeDataArcFlags>> & accessNodes,
+	Graph & originalGraph,
+	Regions_with_borders & regions,
+	bool forward
+) {
+	auto & time = forward ? this->forward_arc_flags_computation_time_ms_ : this->backward_arc_flags_computation_time_ms_;
 	if(mode == TNRAFPreprocessingMode::DM) {
-		this->backward_arc_flags_computation_time_ms_ = benchmark<std::chrono::milliseconds>(
+		time = benchmark<std::chrono::milliseconds>(
 			&TNRAFPreprocessor::compute_arc_flags<TNRAFPreprocessingMode::DM>, this,
-			std::ref(backwardAccessNodes), std::ref(originalGraph), std::ref(regions), false
+			std::ref(accessNodes), std::ref(originalGraph), std::ref(regions), forward
 		);
 	}
 	else if(mode == TNRAFPreprocessingMode::FAST) {
-		this->backward_arc_flags_computation_time_ms_ = benchmark<std::chrono::milliseconds>(
+		time = benchmark<std::chrono::milliseconds>(
 			&TNRAFPreprocessor::compute_arc_flags<TNRAFPreprocessingMode::FAST>, this,
-			std::ref(backwardAccessNodes), std::ref(originalGraph), std::ref(regions), false
+			std::ref(accessNodes), std::ref(originalGraph), std::ref(regions), forward
 		);
 	}
 	else {
-		this->backward_arc_flags_computation_time_ms_ = benchmark<std::chrono::milliseconds>(
+		time = benchmark<std::chrono::milliseconds>(
 			&TNRAFPreprocessor::compute_arc_flags<TNRAFPreprocessingMode::SLOW>, this,
-			std::ref(backwardAccessNodes), std::ref(originalGraph), std::ref(regions), false
+			std::ref(accessNodes), std::ref(originalGraph), std::ref(regions), forward
 		);
 	}
+}
 
-	// FINAL STEPS
-	if (mode == TNRAFPreprocessingMode::DM) {
-		delete distanceMatrix;
-		distanceMatrix = NULL;
+//______________________________________________________________________________________________________________________
+void TNRAFPreprocessor::writeAccessNodes(
+	std::ostream & output,
+	const std::vector<std::vector<AccessNodeDataArcFlags>> & accessNodes
+) {
+	PreprocessingCheckpoints::writeValue<uint64_t>(output, accessNodes.size());
+	for (const auto & nodeAccessNodes : accessNodes) {
+		PreprocessingCheckpoints::writeValue<uint32_t>(output, boost::numeric_cast<uint32_t>(nodeAccessNodes.size()));
+		for (const auto & accessNode : nodeAccessNodes) {
+			PreprocessingCheckpoints::writeValue(output, accessNode.accessNodeID);
+			PreprocessingCheckpoints::writeValue(output, accessNode.distanceToNode);
+			PreprocessingCheckpoints::writeValue(output, accessNode.tnr_index);
+			PreprocessingCheckpoints::writeValue<uint32_t>(output, boost::numeric_cast<uint32_t>(accessNode.regionFlags.size()));
+			std::vector<uint64_t> flags((accessNode.regionFlags.size() + 63) / 64, 0);
+			for (size_t region = 0; region < accessNode.regionFlags.size(); region++) {
+				if (accessNode.regionFlags[region]) {
+					flags[region / 64] |= uint64_t(1) << (region % 64);
+				}
+			}
+			output.write(reinterpret_cast<const char *>(flags.data()), std::streamsize(flags.size() * sizeof(uint64_t)));
+		}
 	}
+}
 
-	std::vector<std::pair<unsigned int, QueryEdge> > allEdges;
-	chGraph.getEdgesForFlushing(allEdges);
-
-	outputGraph(outputPath, graph, allEdges, transitNodes, transitNodesDistanceTable, forwardAccessNodes,
-				backwardAccessNodes, forwardSearchSpaces, backwardSearchSpaces, transitNodesAmount, regions,
-				regionsCnt);
+//______________________________________________________________________________________________________________________
+std::vector<std::vector<AccessNodeDataArcFlags>> TNRAFPreprocessor::readAccessNodes(std::istream & input) {
+	std::vector<std::vector<AccessNodeDataArcFlags>> accessNodes(PreprocessingCheckpoints::readValue<uint64_t>(input));
+	for (auto & nodeAccessNodes : accessNodes) {
+		const auto count = PreprocessingCheckpoints::readValue<uint32_t>(input);
+		nodeAccessNodes.reserve(count);
+		for (uint32_t i = 0; i < count; i++) {
+			const auto id = PreprocessingCheckpoints::readValue<unsigned int>(input);
+			const auto distance = PreprocessingCheckpoints::readValue<unsigned int>(input);
+			const auto tnrIndex = PreprocessingCheckpoints::readValue<short>(input);
+			const auto flagsCnt = PreprocessingCheckpoints::readValue<uint32_t>(input);
+			std::vector<uint64_t> flags((flagsCnt + 63) / 64);
+			input.read(reinterpret_cast<char *>(flags.data()), std::streamsize(flags.size() * sizeof(uint64_t)));
+			nodeAccessNodes.emplace_back(id, distance, flagsCnt, static_cast<unsigned short>(tnrIndex));
+			for (uint32_t region = 0; region < flagsCnt; region++) {
+				nodeAccessNodes.back().regionFlags[region] = (flags[region / 64] >> (region % 64)) & 1;
+			}
+			nodeAccessNodes.back().tnr_index = tnrIndex;
+		}
+	}
+	return accessNodes;
 }
 
 //______________________________________________________________________________________________________________________
@@ -196,7 +457,6 @@ void TNRAFPreprocessor::process_forward_access_nodes(
     std::vector<std::vector<unsigned int>>& searchSpacesVec,
     std::unordered_map<unsigned int, unsigned int>& transitNodesMap,
     FlagsGraph<NodeDataRegions>& chGraphInstance,
-    Graph& origGraphInstance,
     Regions_with_borders& regionsInstance,
     TNRAFPreprocessingMode currentMode
 ) {
@@ -210,7 +470,6 @@ void TNRAFPreprocessor::process_forward_access_nodes(
 	        searchSpacesVec[i],
 	        transitNodesMap,
 	        chGraphInstance,
-	        origGraphInstance,
 	        regionsInstance,
 	        currentMode
         );
@@ -225,7 +484,6 @@ void TNRAFPreprocessor::process_backward_access_nodes(
     std::vector<std::vector<unsigned int>>& searchSpacesVec,
     std::unordered_map<unsigned int, unsigned int>& transitNodesMap,
     FlagsGraph<NodeDataRegions>& chGraphInstance,
-    Graph& origGraphInstance,
     Regions_with_borders& regionsInstance,
     TNRAFPreprocessingMode currentMode
 ) {
@@ -234,7 +492,7 @@ void TNRAFPreprocessor::process_backward_access_nodes(
             std::cout << "\rComputed backward access nodes for '" << i << "' nodes.";
         }
         find_backward_access_nodes_for_single_node(i, accessNodesVec[i], searchSpacesVec[i], transitNodesMap, chGraphInstance,
-                                origGraphInstance, regionsInstance, currentMode);
+                                regionsInstance, currentMode);
     }
     std::cout << "\rComputed backward access nodes for all nodes in the graph." << std::endl;
 }
@@ -312,10 +570,8 @@ void TNRAFPreprocessor::outputGraph(
 	std::vector<std::pair<unsigned int, QueryEdge> > &allEdges,
 	std::vector<unsigned int> &transitNodes,
 	std::vector<std::vector<unsigned int> > &transitNodesDistanceTable,
-	std::vector<std::vector<AccessNodeDataArcFlags> > &forwardAccessNodes,
-	std::vector<std::vector<AccessNodeDataArcFlags> > &backwardAccessNodes,
-	std::vector<std::vector<unsigned int> > &forwardSearchSpaces,
-	std::vector<std::vector<unsigned int> > &backwardSearchSpaces,
+	const CompactAccessNodes &forwardAccessNodes,
+	const CompactAccessNodes &backwardAccessNodes,
 	unsigned int transitNodesAmount, Regions_with_borders &regions,
 	unsigned int regionsCnt
 ) {
@@ -391,62 +647,38 @@ void TNRAFPreprocessor::outputGraph(
 		}
 	}
 
-	// Output the access nodes (their arc flags are also output here).
-	std::vector<uint32_t> powersOf2(regionsCnt);
-	initPowersOf2(powersOf2);
-	for (unsigned int i = 0; i < graph.nodes(); i++) {
-		unsigned int fwSize = boost::numeric_cast<unsigned int>(forwardAccessNodes[i].size());
-		output.write((char *) &fwSize, sizeof(fwSize));
-		for (unsigned int j = 0; j < fwSize; j++) {
-			output.write((char *) &forwardAccessNodes[i][j].accessNodeID,
-						 sizeof(forwardAccessNodes[i][j].accessNodeID));
-			output.write((char *) &forwardAccessNodes[i][j].distanceToNode,
-						 sizeof(forwardAccessNodes[i][j].distanceToNode));
-			uint32_t regionsOutput = 0;
-			for (unsigned int k = 0; k < regionsCnt; k++) {
-				if (forwardAccessNodes[i][j].regionFlags[k]) {
-					regionsOutput = regionsOutput | powersOf2[k];
-				}
-			}
-			output.write((char *) &regionsOutput, sizeof(regionsOutput));
-		}
-		unsigned int bwSize = boost::numeric_cast<unsigned int>(backwardAccessNodes[i].size());
-		output.write((char *) &bwSize, sizeof(bwSize));
-		for (unsigned int j = 0; j < bwSize; j++) {
-			output.write((char *) &backwardAccessNodes[i][j].accessNodeID,
-						 sizeof(backwardAccessNodes[i][j].accessNodeID));
-			output.write((char *) &backwardAccessNodes[i][j].distanceToNode,
-						 sizeof(backwardAccessNodes[i][j].distanceToNode));
-			uint32_t regionsOutput = 0;
-			for (unsigned int k = 0; k < regionsCnt; k++) {
-				if (backwardAccessNodes[i][j].regionFlags[k]) {
-					regionsOutput = regionsOutput | powersOf2[k];
-				}
-			}
-
-			output.write((char *) &regionsOutput, sizeof(regionsOutput));
+	// Output the access nodes (their arc flags are already packed into one mask each).
+	const auto writeAccessNodes = [&output](const CompactAccessNodes & accessNodes, unsigned int node) {
+		const size_t begin = accessNodes.accessNodeOffsets[node];
+		const size_t end = accessNodes.accessNodeOffsets[node + 1];
+		unsigned int size = boost::numeric_cast<unsigned int>(end - begin);
+		output.write((char *) &size, sizeof(size));
+		for (size_t j = begin; j < end; j++) {
+			const auto & accessNode = accessNodes.accessNodes[j];
+			output.write((char *) &accessNode.accessNodeID, sizeof(accessNode.accessNodeID));
+			output.write((char *) &accessNode.distanceToNode, sizeof(accessNode.distanceToNode));
+			output.write((char *) &accessNode.regionFlags, sizeof(accessNode.regionFlags));
 		}
+	};
+	for (unsigned int i = 0; i < graph.nodes(); i++) {
+		writeAccessNodes(forwardAccessNodes, i);
+		writeAccessNodes(backwardAccessNodes, i);
 	}
 
 	// Output search spaces (those are needed for the locality filter).
 	printf("Will now output search spaces.\n");
+	const auto writeSearchSpace = [&output](const CompactAccessNodes & accessNodes, unsigned int node) {
+		const size_t begin = accessNodes.searchSpaceOffsets[node];
+		unsigned int size = boost::numeric_cast<unsigned int>(accessNodes.searchSpaceOffsets[node + 1] - begin);
+		output.write((char *) &size, sizeof(size));
+		output.write((char *) (accessNodes.searchSpaces.data() + begin), std::streamsize(size * sizeof(unsigned int)));
+		return size;
+	};
 	unsigned int fwSearchSpaceSum = 0;
 	unsigned int bwSearchSpaceSum = 0;
 	for (unsigned int i = 0; i < graph.nodes(); i++) {
-		unsigned int fwSearchSpaceSize = boost::numeric_cast<unsigned int>(forwardSearchSpaces[i].size());
-		output.write((char *) &fwSearchSpaceSize, sizeof(fwSearchSpaceSize));
-		for (unsigned int j = 0; j < fwSearchSpaceSize; j++) {
-			output.write((char *) &forwardSearchSpaces[i][j], sizeof(forwardSearchSpaces[i][j]));
-		}
-		fwSearchSpaceSum += fwSearchSpaceSize;
-
-		unsigned int bwSearchSpaceSize = boost::numeric_cast<unsigned int>(backwardSearchSpaces[i].size());
-		output.write((char *) &bwSearchSpaceSize, sizeof(bwSearchSpaceSize));
-		for (unsigned int j = 0; j < bwSearchSpaceSize; j++) {
-			output.write((char *) &backwardSearchSpaces[i][j], sizeof(backwardSearchSpaces[i][j]));
-		}
-		bwSearchSpaceSum += bwSearchSpaceSize;
-
+		fwSearchSpaceSum += writeSearchSpace(forwardAccessNodes, i);
+		bwSearchSpaceSum += writeSearchSpace(backwardAccessNodes, i);
 	}
 
 	printf("Average forward search space size: %lf\n", (double) fwSearchSpaceSum / nodes);
@@ -462,14 +694,19 @@ void TNRAFPreprocessor::find_forward_access_nodes_for_single_node(
 	std::vector<unsigned int>& forwardSearchSpace,
 	std::unordered_map<unsigned int, unsigned int>& transitNodes,
 	FlagsGraph<NodeDataRegions>& graph,
-	Graph& originalGraph,
 	Regions_with_borders& regions,
 	TNRAFPreprocessingMode mode
 ) {
 	auto cmp = [](DijkstraNode left, DijkstraNode right) { return (left.weight) > (right.weight); };
 	std::priority_queue<DijkstraNode, std::vector<DijkstraNode>, decltype(cmp)> forwardQ(cmp);
-	std::vector<unsigned int> distances(graph.nodes(), UINT_MAX);
-	std::vector<bool> settled(graph.nodes(), false);
+	// the arrays are shared by the searches from all the nodes, only the reached nodes are reset afterwards
+	std::vector<unsigned int> & distances = searchDistances;
+	std::vector<bool> & settled = searchSettled;
+	if (distances.size() != graph.nodes()) {
+		distances.assign(graph.nodes(), UINT_MAX);
+		settled.assign(graph.nodes(), false);
+	}
+	std::vector<unsigned int> reachedNodes{source};
 
 	forwardQ.push(DijkstraNode(source, 0));
 
@@ -511,6 +748,9 @@ void TNRAFPreprocessor::find_forward_access_nodes_for_single_node(
 				if (graph.data((*iter).targetNode).rank > graph.data(curNode).rank) {
 					unsigned int newlen = curLen + (*iter).weight;
 					if (newlen < distances[(*iter).targetNode]) {
+						if (distances[(*iter).targetNode] == UINT_MAX) {
+							reachedNodes.push_back((*iter).targetNode);
+						}
 						distances[(*iter).targetNode] = newlen;
 						forwardQ.push(DijkstraNode((*iter).targetNode, newlen));
 					}
@@ -520,10 +760,13 @@ void TNRAFPreprocessor::find_forward_access_nodes_for_single_node(
 
 	}
 
-	std::vector<unsigned int> distancesFromNode;
+	for (unsigned int node : reachedNodes) {
+		distances[node] = UINT_MAX;
+		settled[node] = false;
+	}
+
 	if (mode == TNRAFPreprocessingMode::SLOW) {
-		distancesFromNode.resize(originalGraph.nodes());
-		BasicDijkstra::computeOneToAllDistances(source, originalGraph, distancesFromNode);
+		transitNodeDistanceOracle->setNode(source, true);
 	}
 	for (size_t i = 0; i < accessNodesSuperset.size(); i++) {
 		auto access_node = accessNodesSuperset[i];
@@ -543,7 +786,7 @@ void TNRAFPreprocessor::find_forward_access_nodes_for_single_node(
 			}
 		}
 		else {
-			unsigned int realDistance = distancesFromNode[access_node_id];
+			unsigned int realDistance = transitNodeDistanceOracle->distance(transitNodes.at(access_node_id));
 			if (realDistance == access_node_distance) {
 				accessNodes.push_back(accessNodesSuperset[i]);
 			}
@@ -556,13 +799,19 @@ void TNRAFPreprocessor::find_backward_access_nodes_for_single_node(
 	unsigned int source, std::vector<AccessNodeDataArcFlags> &accessNodes,
 	std::vector<unsigned int> &backwardSearchSpace,
 	std::unordered_map<unsigned int, unsigned int> &transitNodes,
-	FlagsGraph<NodeDataRegions>& graph, Graph &originalGraph, Regions_with_borders &regions,
+	FlagsGraph<NodeDataRegions>& graph, Regions_with_borders &regions,
 	TNRAFPreprocessingMode useDistanceMatrix
 ) {
 	auto cmp = [](DijkstraNode left, DijkstraNode right) { return (left.weight) > (right.weight); };
 	std::priority_queue<DijkstraNode, std::vector<DijkstraNode>, decltype(cmp)> backwardQ(cmp);
-	std::vector<unsigned int> distances(graph.nodes(), UINT_MAX);
-	std::vector<bool> settled(graph.nodes(), false);
+	// the arrays are shared by the searches from all the nodes, only the reached nodes are reset afterwards
+	std::vector<unsigned int> & distances = searchDistances;
+	std::vector<bool> & settled = searchSettled;
+	if (distances.size() != graph.nodes()) {
+		distances.assign(graph.nodes(), UINT_MAX);
+		settled.assign(graph.nodes(), false);
+	}
+	std::vector<unsigned int> reachedNodes{source};
 
 	backwardQ.push(DijkstraNode(source, 0));
 
@@ -604,6 +853,9 @@ void TNRAFPreprocessor::find_backward_access_nodes_for_single_node(
 				if (graph.data((*iter).targetNode).rank > graph.data(curNode).rank) {
 					unsigned int newlen = curLen + (*iter).weight;
 					if (newlen < distances[(*iter).targetNode]) {
+						if (distances[(*iter).targetNode] == UINT_MAX) {
+							reachedNodes.push_back((*iter).targetNode);
+						}
 						distances[(*iter).targetNode] = newlen;
 						backwardQ.push(DijkstraNode((*iter).targetNode, newlen));
 					}
@@ -613,10 +865,13 @@ void TNRAFPreprocessor::find_backward_access_nodes_for_single_node(
 
 	}
 
-	std::vector<unsigned int> distancesFromNode;
+	for (unsigned int node : reachedNodes) {
+		distances[node] = UINT_MAX;
+		settled[node] = false;
+	}
+
 	if (useDistanceMatrix == TNRAFPreprocessingMode::SLOW) {
-		distancesFromNode.resize(originalGraph.nodes());
-		BasicDijkstra::computeOneToAllDistancesInReversedGraph(source, originalGraph, distancesFromNode);
+		transitNodeDistanceOracle->setNode(source, false);
 	}
 	for (size_t i = 0; i < accessNodesSuperset.size(); i++) {
 		auto access_node = accessNodesSuperset[i];
@@ -636,7 +891,7 @@ void TNRAFPreprocessor::find_backward_access_nodes_for_single_node(
 			}
 		}
 		else {
-			unsigned int realDistance = distancesFromNode[access_node_id];
+			unsigned int realDistance = transitNodeDistanceOracle->distance(transitNodes.at(access_node_id));
 			if (realDistance == access_node_distance) {
 				accessNodes.emplace_back(accessNodesSuperset[i]);
 			}
@@ -37,13 +37,41 @@
 #include "../DistanceMatrix/Distance_matrix_travel_time_provider.h"
 #include "../TNRAF/Structures/NodeDataRegions.h"
 #include "TNRAFPreprocessingMode.h"
+#include "TransitNodeDistanceOracle.h"
 #include "../Dijkstra/BasicDijkstra.h"
+#include "../Checkpoint/PreprocessingCheckpoints.h"
 #include <boost/numeric/conversion/cast.hpp>
 #include <iostream>
 #include <vector>
 #include <string>
 #include <memory>
 #include <chrono>
+#include <functional>
+
+/**
+ * Limits the memory used by the Transit Node Routing with Arc Flags preprocessing. The access nodes of both directions
+ * are always stored in compact arrays once their Arc Flags are computed, with a budget the forward access nodes are
+ * additionally spilled into a temporary file while the backward access nodes are computed.
+ */
+struct TNRAFMemoryBudget {
+    /**
+     * The number of bytes the auxiliary structures may use, 0 means that the memory is not limited. The mode
+     * itself is chosen by 'TNRAFPreprocessor::chooseMode' before the preprocessing starts.
+     */
+    size_t bytes = 0;
+
+    /**
+     * The path of the temporary file for the spilled forward access nodes, the output path with the '.tgaf.spill'
+     * suffix if empty.
+     */
+    std::string spillPath;
+
+    /**
+     * Called at the end of every phase of the preprocessing with the name of the phase, this is used to report
+     * the peak memory usage of the phases.
+     */
+    std::function<void(const std::string &)> phaseFinished;
+};
 
 /**
  * This class is responsible for creating a Transit Node Routing with Arc Flags data-structure based on a given
@@ -67,7 +95,8 @@ public:
      * This should be used if you have more resources available during the preprocessing phase than during
      * the actual queries. If the flag is set to false, the preprocessing will be much slower, but will require
      * less memory and it should then be possible to complete it even on machines where there is not enough memory
-     * for the faster mode.
+     * for the faster mode. In the slow mode, the access node candidates are verified by the TransitNodeDistanceOracle
+     * using the Contraction Hierarchy, only the Arc Flags computation runs Dijkstra's Algorithm on the original graph.
      *
      * @param graph[in] The input graph in the form of an UpdateableGraph.
      * @param originalGraph[in] A copy of the input graph in the simple Graph class form. This is used for example when
@@ -77,6 +106,10 @@ public:
      * @param regionsCnt[in] The desired amount of regions for the Arc Flags.
      * @param useDistanceMatrix[in] A flag indicating whether the slower or the faster but more memory consuming
      * preprocessing mode should be used.
+     * @param checkpoints[in] The checkpoints for the transit node distance table, the forward and backward access nodes
+     * and the forward and backward Arc Flags. Phases loaded from the checkpoints are skipped, together with
+     * the auxiliary distance matrices only they need.
+     * @param memoryBudget[in] The memory limit of the preprocessing and the callback reporting the finished phases.
      */
     void preprocessUsingCH(
             UpdateableGraph & graph,
@@ -85,7 +118,44 @@ public:
             unsigned int transitNodesDesired,
             unsigned int regionsCnt,
             unsigned int dmIntSize,
-            TNRAFPreprocessingMode dm_mode);
+            TNRAFPreprocessingMode dm_mode,
+            const PreprocessingCheckpoints & checkpoints = PreprocessingCheckpoints(),
+            const TNRAFMemoryBudget & memoryBudget = TNRAFMemoryBudget());
+
+    /**
+     * Estimates the memory used by the auxiliary distance matrix of a preprocessing mode: the full distance matrix in
+     * the 'dm' mode and the all-to-transit distance matrix in the 'fast' mode. The 'slow' mode needs no matrix.
+     *
+     * @param mode[in] The preprocessing mode.
+     * @param nodes[in] The number of nodes of the graph.
+     * @param transitNodesAmount[in] The size of the transit node set.
+     * @param dmIntSize[in] The size of the integers in the matrix in bits, 0 for the native size.
+     * @return The size of the matrix in bytes.
+     */
+    static size_t auxiliaryMemoryUsage(
+            TNRAFPreprocessingMode mode,
+            unsigned int nodes,
+            unsigned int transitNodesAmount,
+            unsigned int dmIntSize);
+
+    /**
+     * Chooses the preprocessing mode for a memory budget. The requested mode is used if its auxiliary distance matrix
+     * fits into the budget, otherwise the modes needing less memory are tried ('dm', then 'fast', then 'slow').
+     * All the modes give the same results.
+     *
+     * @param requested[in] The requested preprocessing mode.
+     * @param nodes[in] The number of nodes of the graph.
+     * @param transitNodesAmount[in] The size of the transit node set.
+     * @param dmIntSize[in] The size of the integers in the matrices in bits, 0 for the native size.
+     * @param budget[in] The number of bytes the auxiliary structures may use.
+     * @return The chosen mode, 'slow' if no matrix fits.
+     */
+    static TNRAFPreprocessingMode chooseMode(
+            TNRAFPreprocessingMode requested,
+            unsigned int nodes,
+            unsigned int transitNodesAmount,
+            unsigned int dmIntSize,
+            size_t budget);
 
     /**
      * Auxiliary function in order to make sure the powers of 2 are precomputed.
@@ -103,6 +173,59 @@ public:
     std::chrono::milliseconds getBackwardArcFlagsComputationTimeMs() const { return backward_arc_flags_computation_time_ms_; }
 
 protected:
+    /**
+     * The access nodes and the search spaces of all nodes in one direction, stored in four arrays instead of one
+     * std::vector per node. The Arc Flags of an access node are stored in one 32 bit mask, which is also how they are
+     * written into the output file.
+     */
+    struct CompactAccessNodes {
+        struct AccessNode {
+            unsigned int accessNodeID;
+            unsigned int distanceToNode;
+            uint32_t regionFlags;
+        };
+
+        // the access nodes of the node 'i' are 'accessNodes[accessNodeOffsets[i]]' to
+        // 'accessNodes[accessNodeOffsets[i + 1] - 1]', the same holds for the search spaces
+        std::vector<size_t> accessNodeOffsets;
+        std::vector<AccessNode> accessNodes;
+        std::vector<size_t> searchSpaceOffsets;
+        std::vector<unsigned int> searchSpaces;
+    };
+
+    /**
+     * Moves the access nodes with their Arc Flags and the search spaces of one direction into the compact arrays.
+     * The per-node vectors are released node by node, so the data is never held twice.
+     *
+     * @param accessNodes[in, out] The access nodes for each node, cleared by this function.
+     * @param searchSpaces[in, out] The search spaces for each node, cleared by this function.
+     * @param regionsCnt[in] The number of regions, at most 32.
+     * @return The compact access nodes.
+     */
+    static CompactAccessNodes compactAccessNodes(
+            std::vector<std::vector<AccessNodeDataArcFlags>> & accessNodes,
+            std::vector<std::vector<unsigned int>> & searchSpaces,
+            unsigned int regionsCnt);
+
+    /**
+     * Writes the compact access nodes into a temporary file, so that they do not occupy the memory while the other
+     * direction is computed.
+     *
+     * @param path[in] The path of the temporary file.
+     * @param accessNodes[in] The compact access nodes.
+     */
+    static void spillAccessNodes(
+            const std::string & path,
+            const CompactAccessNodes & accessNodes);
+
+    /**
+     * Reads the compact access nodes written by 'spillAccessNodes' and removes the temporary file.
+     *
+     * @param path[in] The path of the temporary file.
+     * @return The compact access nodes.
+     */
+    static CompactAccessNodes restoreAccessNodes(
+            const std::string & path);
 
     /**
      * Outputs the created Transit Node Routing with Arc Flags data-structure with all the information required for
@@ -114,10 +237,8 @@ protected:
      * shortcuts).
      * @param transitNodes[in] A std::vector containing the IDs of the nodes that were chosen as transit nodes.
      * @param transitNodesDistanceTable[in] 2D matrix containing pairwise distances between all pairs of transit nodes.
-     * @param forwardAccessNodes[in] Contains forward access nodes for each node with all their information.
-     * @param backwardAccessNodes[in] Contains backward access nodes for each node with all their information.
-     * @param forwardSearchSpaces[in] Contains forward search spaces for each node.
-     * @param backwardSearchSpaces[in] Contains backward search spaces for each node.
+     * @param forwardAccessNodes[in] Contains forward access nodes and forward search spaces for each node.
+     * @param backwardAccessNodes[in] Contains backward access nodes and backward search spaces for each node.
      * @param transitNodesAmount[in] Denotes the number of transit nodes.
      * @param regions[in] A structure with all information about the regions for Arc Flags.
      * @param regionsCnt[in] Denotes the number of regions.
@@ -128,10 +249,8 @@ protected:
             std::vector < std::pair< unsigned int, QueryEdge > > & allEdges,
             std::vector < unsigned int > & transitNodes,
             std::vector < std::vector < unsigned int > > & transitNodesDistanceTable,
-            std::vector < std::vector < AccessNodeDataArcFlags > > & forwardAccessNodes,
-            std::vector < std::vector < AccessNodeDataArcFlags > > & backwardAccessNodes,
-            std::vector < std::vector < unsigned int > > & forwardSearchSpaces,
-            std::vector < std::vector < unsigned int > > & backwardSearchSpaces,
+            const CompactAccessNodes & forwardAccessNodes,
+            const CompactAccessNodes & backwardAccessNodes,
             unsigned int transitNodesAmount,
             Regions_with_borders & regions,
             unsigned int regionsCnt);
@@ -179,7 +298,6 @@ protected:
      * @param transitNodes[in] Mapping from node IDs to their positions in the transit node distance matrix. Nodes that
      * are not transit nodes are not present in this table.
      * @param graph[in]
-     * @param originalGraph[in]
      * @param regions[in]
      * @param mode[in]
      */
@@ -189,7 +307,6 @@ protected:
         std::vector<unsigned int>& forwardSearchSpace,
         std::unordered_map<unsigned int, unsigned int>& transitNodes,
         FlagsGraph<NodeDataRegions>& graph,
-        Graph& originalGraph,
         Regions_with_borders& regions,
         TNRAFPreprocessingMode mode
     );
@@ -207,7 +324,6 @@ protected:
      * @param transitNodes[in] Mapping from node IDs to their positions in the transit node distance matrix. Nodes that
      * are not transit nodes are not present in this table.
      * @param graph[in]
-     * @param originalGraph[in]
      * @param regions[in]
      * @param useDistanceMatrix[in]
      */
@@ -216,7 +332,7 @@ protected:
             std::vector <AccessNodeDataArcFlags> & accessNodes,
             std::vector < unsigned int > & backwardSearchSpace,
             std::unordered_map< unsigned int, unsigned int > & transitNodes,
-            FlagsGraph<NodeDataRegions>& graph, Graph & originalGraph,
+            FlagsGraph<NodeDataRegions>& graph,
             Regions_with_borders & regions,
             TNRAFPreprocessingMode useDistanceMatrix);
 
@@ -362,12 +478,54 @@ protected:
      */
     static void initPowersOf2(std::vector<uint32_t> & powersOf2);
 
+    /**
+     * Computes the Arc Flags for one direction using the 'compute_arc_flags' variant for the given preprocessing mode
+     * and records the time it took.
+     *
+     * @param mode[in] The preprocessing mode.
+     * @param accessNodes[in, out] The access nodes for which the flags need to be computed.
+     * @param originalGraph[in] The original graph.
+     * @param regions[in] The structure containing all the information about the regions for the Arc Flags.
+     * @param forward[in] True for the forward access nodes, false for the backward access nodes.
+     */
+    void computeArcFlags(
+            TNRAFPreprocessingMode mode,
+            std::vector<std::vector<AccessNodeDataArcFlags>> & accessNodes,
+            Graph & originalGraph,
+            Regions_with_borders & regions,
+            bool forward);
+
+    /**
+     * Writes the access nodes of all nodes including their Arc Flags into a checkpoint.
+     *
+     * @param output[in] The checkpoint stream.
+     * @param accessNodes[in] The access nodes for each node.
+     */
+    static void writeAccessNodes(
+            std::ostream & output,
+            const std::vector<std::vector<AccessNodeDataArcFlags>> & accessNodes);
+
+    /**
+     * Reads access nodes written by 'writeAccessNodes' from a checkpoint.
+     *
+     * @param input[in] The checkpoint stream.
+     * @return The access nodes for each node.
+     */
+    static std::vector<std::vector<AccessNodeDataArcFlags>> readAccessNodes(
+            std::istream & input);
+
 private:
 	void generateDistanceMatrix(Graph& originalGraph, unsigned int dmIntSize, bool forward);
 	DistanceMatrixInterface* distanceMatrix = nullptr;
 
 	std::unique_ptr<DistanceMatrixInterface> all_transit_dm = nullptr;
 
+	std::unique_ptr<TransitNodeDistanceOracle> transitNodeDistanceOracle = nullptr;
+
+	// workspace of the access node searches, reused for all the nodes
+	std::vector<unsigned int> searchDistances;
+	std::vector<bool> searchSettled;
+
     // Benchmarking timers
     std::chrono::milliseconds forward_dm_computation_time_ms_{0};
     std::chrono::milliseconds backward_dm_computation_time_ms_{0};
@@ -388,8 +546,10 @@ private:
         unsigned int num_rows = originalGraph.nodes();
         unsigned int num_cols = transitNodesAmount;
 
-        // 1. Create and populate the 2D matrix as before
-        std::vector<std::vector<DataType>>* temp_2d_matrix = new std::vector<std::vector<DataType>>(num_rows, std::vector<DataType>(num_cols));
+        // The matrix of the other direction is released first, so that both are never held at once. The distances
+        // are written directly into the row-major array the provider takes over.
+        all_transit_dm.reset();
+        std::unique_ptr<DataType[]> one_d_array = std::make_unique<DataType[]>(static_cast<size_t>(num_rows) * num_cols);
         std::vector<unsigned int> distances_per_one_transit_node(num_rows);
 
         for (unsigned int c = 0; c < num_cols; ++c) { // Iterate by column (transit node index)
@@ -401,7 +561,7 @@ private:
         		BasicDijkstra::computeOneToAllDistances(transit_node_id, originalGraph, distances_per_one_transit_node);
         	}
             for (unsigned int r = 0; r < num_rows; ++r) {
-                (*temp_2d_matrix)[r][c] = boost::numeric_cast<DataType>(distances_per_one_transit_node[r]);
+                one_d_array[static_cast<size_t>(r) * num_cols + c] = boost::numeric_cast<DataType>(distances_per_one_transit_node[r]);
             }
             if (c % 10 == 0 && num_cols > 10) {
                  std::cout << "\rProcessed " << c << "/" << num_cols << " transit nodes for all-to-transit DM (" << dataTypeForLog << ").";
@@ -411,18 +571,6 @@ private:
              std::cout << "\rProcessed " << num_cols << "/" << num_cols << " transit nodes for all-to-transit DM (" << dataTypeForLog << ").";
         }
 
-        // 2. Convert the 2D matrix to a 1D std::unique_ptr<DataType[]>
-        std::unique_ptr<DataType[]> one_d_array = std::make_unique<DataType[]>(static_cast<size_t>(num_rows) * num_cols);
-        for (unsigned int r = 0; r < num_rows; ++r) {
-            for (unsigned int c = 0; c < num_cols; ++c) {
-                one_d_array[static_cast<size_t>(r) * num_cols + c] = (*temp_2d_matrix)[r][c];
-            }
-        }
-
-        // 3. Clean up the temporary 2D matrix
-        delete temp_2d_matrix;
-
-        // 4. Create the provider using the 1D array
         all_transit_dm = std::make_unique<Distance_matrix_travel_time_provider<DataType>>(std::move(one_d_array), num_rows, num_cols);
     }
 
@@ -432,7 +580,6 @@ private:
         std::vector<std::vector<unsigned int>>& searchSpacesVec,
         std::unordered_map<unsigned int, unsigned int>& transitNodesMap,
         FlagsGraph<NodeDataRegions>& chGraphInstance,
-        Graph& origGraphInstance,
         Regions_with_borders& regionsInstance,
         TNRAFPreprocessingMode currentMode
     );
@@ -443,7 +590,6 @@ private:
         std::vector<std::vector<unsigned int>>& searchSpacesVec,
         std::unordered_map<unsigned int, unsigned int>& transitNodesMap,
         FlagsGraph<NodeDataRegions>& chGraphInstance,
-        Graph& origGraphInstance,
         Regions_with_borders& regionsInstance,
         TNRAFPreprocessingMode currentMode
     );
@@ -0,0 +1,112 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Czech Technical University in Prague
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. */
+
+/******************************************************************************
+* File:             TransitNodeDistanceOracle.cpp
+*****************************************************************************/
+
+#include <algorithm>
+#include <climits>
+#include <functional>
+#include "TransitNodeDistanceOracle.h"
+
+//______________________________________________________________________________________________________________________
+TransitNodeDistanceOracle::TransitNodeDistanceOracle(
+        FlagsGraph<NodeDataRegions> & graph,
+        const std::vector<unsigned int> & transitNodes
+) : graph(graph), ranks(graph.nodes()), forwardSpaces(transitNodes.size()), backwardSpaces(transitNodes.size()),
+    distances(graph.nodes(), UINT_MAX), stamps(graph.nodes(), 0) {
+    for (unsigned int i = 0; i < graph.nodes(); i++) {
+        ranks[i] = graph.data(i).rank;
+    }
+
+    for (size_t i = 0; i < transitNodes.size(); i++) {
+        upwardSearch(transitNodes[i], true);
+        for (unsigned int node : reached) {
+            forwardSpaces[i].emplace_back(node, distances[node]);
+        }
+        upwardSearch(transitNodes[i], false);
+        for (unsigned int node : reached) {
+            backwardSpaces[i].emplace_back(node, distances[node]);
+        }
+    }
+}
+
+//______________________________________________________________________________________________________________________
+void TransitNodeDistanceOracle::setNode(unsigned int node, bool forward) {
+    upwardSearch(node, forward);
+    forwardNode = forward;
+}
+
+//______________________________________________________________________________________________________________________
+dist_t TransitNodeDistanceOracle::distance(unsigned int transitNodeIndex) const {
+    // the search from the node is met by the search from the transit node in the opposite direction
+    const auto & transitNodeSpace = forwardNode ? backwardSpaces[transitNodeIndex] : forwardSpaces[transitNodeIndex];
+    dist_t best = UINT_MAX;
+    for (const auto & [node, transitNodeDistance] : transitNodeSpace) {
+        if (stamps[node] == currentStamp) {
+            best = std::min(best, distances[node] + transitNodeDistance);
+        }
+    }
+    return best;
+}
+
+//______________________________________________________________________________________________________________________
+void TransitNodeDistanceOracle::upwardSearch(unsigned int source, bool forward) {
+    if (++currentStamp == 0) {
+        std::fill(stamps.begin(), stamps.end(), 0);
+        currentStamp = 1;
+    }
+    reached.clear();
+
+    const auto greater = std::greater<std::pair<dist_t, unsigned int>>();
+    stamps[source] = currentStamp;
+    distances[source] = 0;
+    reached.push_back(source);
+    heap.emplace_back(0, source);
+    while (! heap.empty()) {
+        std::pop_heap(heap.begin(), heap.end(), greater);
+        const auto [length, node] = heap.back();
+        heap.pop_back();
+        if (length > distances[node]) {
+            continue;
+        }
+
+        for (const QueryEdge & edge : graph.nextNodes(node)) {
+            if (! (forward ? edge.forward : edge.backward) || ranks[edge.targetNode] <= ranks[node]) {
+                continue;
+            }
+
+            const dist_t newLength = length + edge.weight;
+            if (stamps[edge.targetNode] != currentStamp) {
+                stamps[edge.targetNode] = currentStamp;
+                reached.push_back(edge.targetNode);
+            } else if (newLength >= distances[edge.targetNode]) {
+                continue;
+            }
+            distances[edge.targetNode] = newLength;
+            heap.emplace_back(newLength, edge.targetNode);
+            std::push_heap(heap.begin(), heap.end(), greater);
+        }
+    }
+}
@@ -0,0 +1,101 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Czech Technical University in Prague
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. */
+
+/******************************************************************************
+* File:             TransitNodeDistanceOracle.h
+*
+* Description:      Exact distances between any node and the transit nodes
+*                   using the upward searches of the Contraction Hierarchy
+*****************************************************************************/
+
+#ifndef SHORTEST_PATHS_TRANSITNODEDISTANCEORACLE_H
+#define SHORTEST_PATHS_TRANSITNODEDISTANCEORACLE_H
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include "../constants.h"
+#include "../GraphBuilding/Structures/FlagsGraph.h"
+#include "Structures/NodeDataRegions.h"
+
+/**
+ * Computes the exact distances between a node and the transit nodes, used by the 'slow' preprocessing mode to verify
+ * the access node candidates without a one-to-all Dijkstra from every node of the graph.
+ *
+ * A distance in a Contraction Hierarchy is the minimum over the nodes met by a forward upward search from the source
+ * and a backward upward search from the target. The transit nodes are the nodes with the highest ranks, so the upward
+ * searches from them are tiny. They are computed once in the constructor, and the distances from one node to all its
+ * candidates then only cost one upward search from the node plus a scan of the candidates' stored searches.
+ * The memory required is two node-sized arrays reused by all the searches and the stored transit node searches.
+ */
+class TransitNodeDistanceOracle {
+public:
+    /**
+     * Precomputes the upward searches in both directions from all the transit nodes.
+     *
+     * @param graph[in] The Contraction Hierarchy.
+     * @param transitNodes[in] The transit nodes, their positions in this std::vector are their indices.
+     */
+    TransitNodeDistanceOracle(
+            FlagsGraph<NodeDataRegions> & graph,
+            const std::vector<unsigned int> & transitNodes);
+
+    /**
+     * Runs the upward search from a node. The following calls of 'distance' return the distances for this node.
+     *
+     * @param node[in] The node.
+     * @param forward[in] True for the distances from the node to the transit nodes, false for the distances from
+     * the transit nodes to the node.
+     */
+    void setNode(
+            unsigned int node,
+            bool forward);
+
+    /**
+     * @param transitNodeIndex[in] The index of a transit node.
+     * @return The exact distance between the node given to 'setNode' and the transit node, in the direction given to
+     * 'setNode'. UINT_MAX if there is no path.
+     */
+    dist_t distance(
+            unsigned int transitNodeIndex) const;
+
+private:
+    void upwardSearch(unsigned int source, bool forward);
+
+    FlagsGraph<NodeDataRegions> & graph;
+    std::vector<unsigned int> ranks;
+
+    // nodes reached by the upward searches from the transit nodes with their distances, the forward searches are
+    // used for the distances to the node, the backward searches for the distances from the node
+    std::vector<std::vector<std::pair<unsigned int, dist_t>>> forwardSpaces;
+    std::vector<std::vector<std::pair<unsigned int, dist_t>>> backwardSpaces;
+    bool forwardNode = true;
+
+    std::vector<dist_t> distances;
+    std::vector<uint32_t> stamps;
+    uint32_t currentStamp = 0;
+    std::vector<unsigned int> reached;
+    std::vector<std::pair<dist_t, unsigned int>> heap;
+};
+
+#endif //SHORTEST_PATHS_TRANSITNODEDISTANCEORACLE_H
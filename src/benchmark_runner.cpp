@@ -29,11 +29,13 @@
 #include <fstream>
 #include <iostream>
 #include <functional>
+#include <memory>
 #include <initializer_list>
 #include <filesystem>
 #include <boost/program_options.hpp>
 #include <boost/optional/optional_io.hpp>
 #include <tuple>
+#include <type_traits>
 #include "DistanceMatrix/Distance_matrix_travel_time_provider.h"
 #include "GraphBuilding/Loaders/TNRGLoader.h"
 #include "GraphBuilding/Structures/UpdateableGraph.h"
@@ -41,6 +43,8 @@
 #include "GraphBuilding/Loaders/TripsLoader.h"
 #include "GraphBuilding/Loaders/DDSGLoader.h"
 #include "Benchmarking/CHBenchmark.h"
+#include "Benchmarking/CCHBenchmark.h"
+#include "Benchmarking/HLBenchmark.h"
 #include "Benchmarking/TNRBenchmark.h"
 #include "Benchmarking/TNRAFBenchmark.h"
 #include "Benchmarking/DistanceMatrixBenchmark.h"
@@ -49,10 +53,33 @@
 #include "GraphBuilding/Loaders/TGAFLoader.h"
 #include "Benchmarking/DijkstraBenchmark.h"
 #include "Benchmarking/AstarBenchmark.h"
+#include "Benchmarking/LatencyBenchmark.h"
+#include "Benchmarking/MappingBenchmark.h"
 #include "Benchmarking/LocationTransformer.h"
 #include "Error/Error.h"
 #include "GraphBuilding/Loaders/CsvGraphLoader.h"
 #include "DistanceMatrix/DistanceMatrixComputorSlow.h"
+#include "Dijkstra/BasicDijkstra.h"
+#include "Dijkstra/DijkstraEngine.h"
+#include "Benchmarking/CorrectnessValidator.h"
+#include "GraphBuilding/Loaders/XenGraphLoader.h"
+#include "Astar/ALTQueryManager.h"
+#include "Astar/Astar.h"
+#include "Astar/Landmarks.h"
+#include "CH/CHDistanceQueryManager.h"
+#include "CCH/CCHCustomizer.h"
+#include "CCH/CCHDistanceQueryManager.h"
+#include "HL/HLDistanceQueryManager.h"
+#include "HL/Structures/HubLabels.h"
+#include "Timer/Timer.h"
+#include "TNR/TNRDistanceQueryManager.h"
+#include "TNRAF/TNRAFDistanceQueryManager.h"
+#include "GraphBuilding/Loaders/NodeMappingLoader.h"
+#include "GraphBuilding/Simplification/SimplificationTable.h"
+#include "GraphBuilding/Reordering/ReorderedGraphLoader.h"
+#ifndef _MSC_VER
+#include "Server/QueryClient.h"
+#endif
 
 
 constexpr auto INVALID_FORMAT_INFO = "Please, make sure that your call has the right format. If not sure,\n"
@@ -60,7 +87,15 @@ constexpr auto INVALID_FORMAT_INFO = "Please, make sure that your call has the r
 									 "with examples.\n";
 
 /**
- * Benchmarks the basic Dijkstra's algorithm implementation using a given graph in the XenGraph input format and a given
+ * The options of the 'dijkstra' method, set by the '--dijkstra-heap' and '--bidirectional' arguments.
+ */
+struct DijkstraOptions {
+	DijkstraEngine::Heap heap = DijkstraEngine::Heap::RADIX;
+	bool bidirectional = false;
+};
+
+/**
+ * Benchmarks the Dijkstra's algorithm implementation using a given graph in the XenGraph input format and a given
  * set of queries. Prints out the sum of the time required by all the queries in seconds and the average time
  * needed for one query in milliseconds. Additionally, the caller can specify an optional output file path,
  * where all the computed distances will be output. Those distances can then be for example compared with distances
@@ -73,13 +108,15 @@ constexpr auto INVALID_FORMAT_INFO = "Please, make sure that your call has the r
  * to use them for example for verification purposes.
  * @param outputDistances[in] Specifies whether the computed distances should be output into a plain text file or not.
  * If the parameter is set to 'true', distances are output into a file, otherwise they are not.
+ * @param dijkstraOptions[in] The priority queue and the direction of the search.
  * @return Total time in seconds.
  */
 double benchmarkDijkstra(
 	const std::string& inputFilePath,
 	const std::string& queriesFilePath,
 	const std::string& distancesOutputPath = "",
-	bool outputDistances = false) {
+	bool outputDistances = false,
+	const DijkstraOptions& dijkstraOptions = {}) {
 	TripsLoader tripsLoader = TripsLoader(queriesFilePath);
 	std::vector<std::pair<unsigned int, unsigned int> > trips;
 	tripsLoader.loadTrips(trips);
@@ -89,7 +126,8 @@ double benchmarkDijkstra(
 	csvGraphLoader.loadGraph(dijkstraGraph, 1);
 
 	std::vector<unsigned int> dijkstraDistances(trips.size());
-	double dijkstraTime = DijkstraBenchmark::benchmark(trips, dijkstraGraph, dijkstraDistances);
+	double dijkstraTime = DijkstraBenchmark::benchmark(trips, dijkstraGraph, dijkstraDistances, dijkstraOptions.heap,
+		dijkstraOptions.bidirectional);
 
 	std::cout << "Run " << trips.size() << " queries using Dijkstra's algorithm in " << dijkstraTime << " seconds." << std::endl;
 	std::cout << "That means " << (dijkstraTime / (double) trips.size()) * 1000 << " ms per query." << std::endl;
@@ -111,7 +149,7 @@ double benchmarkDijkstra(
 }
 
 /**
- * Benchmarks the basic Dijkstra's algorithm implementation using a given graph in the XenGraph input format and a given
+ * Benchmarks the Dijkstra's algorithm implementation using a given graph in the XenGraph input format and a given
  * set of queries. Prints out the sum of the time required by all the queries in seconds and the average time
  * needed for one query in milliseconds. Additionally, the caller can specify an optional output file path,
  * where all the computed distances will be output. Those distances can then be for example compared with distances
@@ -126,6 +164,7 @@ double benchmarkDijkstra(
  * to use them for example for verification purposes.
  * @param outputDistances[in] Specifies whether the computed distances should be output into a plain text file or not.
  * If the parameter is set to 'true', distances are output into a file, otherwise they are not.
+ * @param dijkstraOptions[in] The priority queue and the direction of the search.
  * @return Total time in seconds.
  */
 double benchmarkDijkstraWithMapping(
@@ -133,7 +172,8 @@ double benchmarkDijkstraWithMapping(
 	const std::string& queriesFilePath,
 	const std::string& mappingFilePath,
 	const std::string& distancesOutputPath = "",
-	bool outputDistances = false) {
+	bool outputDistances = false,
+	const DijkstraOptions& dijkstraOptions = {}) {
 	TripsLoader tripsLoader = TripsLoader(queriesFilePath);
 	std::vector<std::pair<long long unsigned int, long long unsigned int> > trips;
 	tripsLoader.loadLongLongTrips(trips);
@@ -144,7 +184,7 @@ double benchmarkDijkstraWithMapping(
 
 	std::vector<unsigned int> dijkstraDistances(trips.size());
 	double dijkstraTime = DijkstraBenchmark::benchmarkUsingMapping(trips, dijkstraGraph, dijkstraDistances,
-		mappingFilePath);
+		mappingFilePath, dijkstraOptions.heap, dijkstraOptions.bidirectional);
 
 	std::cout << "Run " << trips.size() << " queries using Dijkstra's algorithm in " << dijkstraTime << " seconds" << std::endl;
 	std::cout << "using '" << mappingFilePath << "' as mapping." << std::endl;
@@ -283,6 +323,156 @@ double benchmarkAstarWithMapping(
 	return aStarTime;
 }
 
+/**
+ * Loads the graph and the landmarks written by the ALT preprocessing.
+ *
+ * @param inputFilePath[in] Path to the '.alt' file.
+ * @param graph[out] The loaded graph.
+ * @return The landmarks.
+ */
+Landmarks loadALT(const std::string& inputFilePath, std::unique_ptr<Graph>& graph) {
+	std::ifstream input(inputFilePath, std::ios::binary);
+	if (!input.is_open()) {
+		throw input_error("Couldn't open file '" + inputFilePath + "'.\n");
+	}
+
+	return Landmarks::read(input, graph);
+}
+
+/**
+ * Benchmarks the bidirectional ALT (landmark) A* algorithm using the graph and landmarks created by the preprocessor
+ * and a given set of queries. Otherwise works the same as 'benchmarkAstar'.
+ *
+ * @param inputFilePath[in] Path to the '.alt' file containing the graph and the landmarks.
+ * @param queriesFilePath[in] Path to the file containing the queries used for the benchmark.
+ * @param distancesOutputPath[in] Optional path where the computed distances can be output if the caller wants
+ * to use them for example for verification purposes.
+ * @param outputDistances[in] Specifies whether the computed distances should be output into a plain text file or not.
+ * @return Total time in seconds.
+ */
+double benchmarkALT(
+	const std::string& inputFilePath,
+	const std::string& queriesFilePath,
+	const std::string& distancesOutputPath = "",
+	bool outputDistances = false) {
+	TripsLoader tripsLoader = TripsLoader(queriesFilePath);
+	std::vector<std::pair<unsigned int, unsigned int> > trips;
+	tripsLoader.loadTrips(trips);
+
+	std::unique_ptr<Graph> graph;
+	const Landmarks landmarks = loadALT(inputFilePath, graph);
+
+	std::vector<unsigned int> altDistances(trips.size());
+	double altTime = AstarBenchmark::benchmarkALT(trips, *graph, landmarks, altDistances);
+
+	std::cout << "Run " << trips.size() << " queries using ALT algorithm with " << landmarks.count() << " landmarks in " << altTime << " seconds." << std::endl;
+	std::cout << "That means " << (altTime / (double) trips.size()) * 1000 << " ms per query." << std::endl;
+
+	if (outputDistances) {
+		std::cout << "Now outputting distances to '" << distancesOutputPath << "'." << std::endl;
+
+		std::ofstream output;
+		output.open(distancesOutputPath);
+
+		output << queriesFilePath << std::endl;
+		for (size_t i = 0; i < trips.size(); ++i) {
+			output << altDistances[i] << std::endl;
+		}
+
+		output.close();
+	}
+	return altTime;
+}
+
+/**
+ * Benchmarks the bidirectional ALT (landmark) A* algorithm using the original node IDs in the queries. Otherwise works
+ * the same as 'benchmarkALT'.
+ *
+ * @param inputFilePath[in] Path to the '.alt' file containing the graph and the landmarks.
+ * @param queriesFilePath[in] Path to the file containing the queries used for the benchmark.
+ * @param mappingFilePath[in] Path to the file containing the mapping from original IDs (used in the queries) to IDs
+ * used internally in the data structure and the query algorithm.
+ * @param distancesOutputPath[in] Optional path where the computed distances can be output if the caller wants
+ * to use them for example for verification purposes.
+ * @param outputDistances[in] Specifies whether the computed distances should be output into a plain text file or not.
+ * @return Total time in seconds.
+ */
+double benchmarkALTwithMapping(
+	const std::string& inputFilePath,
+	const std::string& queriesFilePath,
+	const std::string& mappingFilePath,
+	const std::string& distancesOutputPath = "",
+	bool outputDistances = false) {
+	TripsLoader tripsLoader = TripsLoader(queriesFilePath);
+	std::vector<std::pair<long long unsigned int, long long unsigned int> > trips;
+	tripsLoader.loadLongLongTrips(trips);
+
+	std::unique_ptr<Graph> graph;
+	const Landmarks landmarks = loadALT(inputFilePath, graph);
+
+	std::vector<unsigned int> altDistances(trips.size());
+	double altTime = AstarBenchmark::benchmarkALTUsingMapping(trips, *graph, landmarks, altDistances, mappingFilePath);
+
+	std::cout << "Run " << trips.size() << " queries using ALT algorithm with " << landmarks.count() << " landmarks in " << altTime << " seconds" << std::endl;
+	std::cout << "using '" << mappingFilePath << "' as mapping." << std::endl;
+	std::cout << "That means " << (altTime / (double) trips.size()) * 1000 << " ms per query." << std::endl;
+
+	if (outputDistances) {
+		std::cout << "Now outputting distances to '" << distancesOutputPath << "'." << std::endl;
+
+		std::ofstream output;
+		output.open(distancesOutputPath);
+
+		output << queriesFilePath << std::endl;
+		for (size_t i = 0; i < trips.size(); ++i) {
+			output << altDistances[i] << std::endl;
+		}
+
+		output.close();
+	}
+	return altTime;
+}
+
+/**
+ * Loads the Contraction Hierarchy, prints the memory used by the query graph and answers the given queries. The
+ * compressed query graph is encoded while the file is being read, without loading the uncompressed graph, so the
+ * memory saving and the query times can be compared with a run without the compression.
+ *
+ * @param inputFilePath[in] Path to the file containing the precomputed Contraction Hierarchies data structure.
+ * @param trips[in] The queries.
+ * @param distances[out] The computed distances.
+ * @param compressed[in] Whether to answer the queries using the compressed query graph.
+ * @param mappingFilePath[in] Path to the mapping file, or an empty string if the queries use the internal IDs.
+ * @return Total time in seconds.
+ */
+template<class TripType>
+double runCHBenchmark(
+	const std::string& inputFilePath,
+	const std::vector<std::pair<TripType, TripType>>& trips,
+	std::vector<unsigned int>& distances,
+	bool compressed,
+	const std::string& mappingFilePath = "") {
+	DDSGLoader chLoader = DDSGLoader(inputFilePath);
+	if (!compressed) {
+		std::unique_ptr<FlagsGraph<NodeData>> ch(chLoader.loadFlagsGraph());
+		std::cout << "The query graph takes " << (double) ch->memoryUsage() / (1024 * 1024) << " MiB." << std::endl;
+		if constexpr (std::is_same_v<TripType, unsigned int>) {
+			return CHBenchmark::benchmark(trips, *ch, distances);
+		} else {
+			return CHBenchmark::benchmarkUsingMapping(trips, *ch, distances, mappingFilePath);
+		}
+	}
+
+	std::unique_ptr<CompressedFlagsGraph> compressedCh(chLoader.loadCompressedFlagsGraph());
+	std::cout << "The compressed query graph takes " << (double) compressedCh->memoryUsage() / (1024 * 1024)
+			  << " MiB." << std::endl;
+	if constexpr (std::is_same_v<TripType, unsigned int>) {
+		return CHBenchmark::benchmark(trips, *compressedCh, distances);
+	} else {
+		return CHBenchmark::benchmarkUsingMapping(trips, *compressedCh, distances, mappingFilePath);
+	}
+}
+
 /**
  * Benchmarks the Contraction Hierarchies query algorithm using a given precomputed data structure and a given
  * set of queries. Prints out the sum of the time required by all the queries in seconds and the average time
@@ -296,24 +486,21 @@ double benchmarkAstarWithMapping(
  * to use them for example for verification purposes.
  * @param outputDistances[in] Specifies whether the computed distances should be output into a plain text file or not.
  * If the parameter is set to 'true', distances are output into a file, otherwise they are not.
+ * @param compressed[in] Whether to answer the queries using the compressed query graph (see CompressedFlagsGraph).
  * @return Total time in seconds.
  */
 double benchmarkCH(
 	const std::string& inputFilePath,
 	const std::string& queriesFilePath,
 	const std::string& distancesOutputPath = "",
-	bool outputDistances = false) {
+	bool outputDistances = false,
+	bool compressed = false) {
 	TripsLoader tripsLoader = TripsLoader(queriesFilePath);
 	std::vector<std::pair<unsigned int, unsigned int> > trips;
 	tripsLoader.loadTrips(trips);
 
-	DDSGLoader chLoader = DDSGLoader(inputFilePath);
-	FlagsGraph<NodeData>* ch = chLoader.loadFlagsGraph();
-
 	std::vector<unsigned int> chDistances(trips.size());
-	double chTime = CHBenchmark::benchmark(trips, *ch, chDistances);
-
-	delete ch;
+	double chTime = runCHBenchmark(inputFilePath, trips, chDistances, compressed);
 
 	std::cout << "Run " << trips.size() << " queries using Contraction Hierarchies query algorithm in " << chTime << " seconds." << std::endl;
 	std::cout << "That means " << (chTime / (double) trips.size()) * 1000 << " ms per query." << std::endl;
@@ -349,6 +536,7 @@ double benchmarkCH(
  * to use them for example for verification purposes.
  * @param outputDistances[in] Specifies whether the computed distances should be output into a plain text file or not.
  * If the parameter is set to 'true', distances are output into a file, otherwise they are not.
+ * @param compressed[in] Whether to answer the queries using the compressed query graph (see CompressedFlagsGraph).
  * @return Total time in seconds.
  */
 double benchmarkCHwithMapping(
@@ -356,18 +544,14 @@ double benchmarkCHwithMapping(
 	const std::string& queriesFilePath,
 	const std::string& mappingFilePath,
 	const std::string& distancesOutputPath = "",
-	bool outputDistances = false) {
+	bool outputDistances = false,
+	bool compressed = false) {
 	TripsLoader tripsLoader = TripsLoader(queriesFilePath);
 	std::vector<std::pair<long long unsigned int, long long unsigned int> > trips;
 	tripsLoader.loadLongLongTrips(trips);
 
-	DDSGLoader chLoader = DDSGLoader(inputFilePath);
-	FlagsGraph<NodeData>* ch = chLoader.loadFlagsGraph();
-
 	std::vector<unsigned int> chDistances(trips.size());
-	double chTime = CHBenchmark::benchmarkUsingMapping(trips, *ch, chDistances, mappingFilePath);
-
-	delete ch;
+	double chTime = runCHBenchmark(inputFilePath, trips, chDistances, compressed, mappingFilePath);
 
 	std::cout << "Run " << trips.size() << " queries using Contraction Hierarchies query algorithm in " << chTime << " seconds" << std::endl;
 	std::cout << "using '" << mappingFilePath << "' as mapping." << std::endl;
@@ -390,21 +574,45 @@ double benchmarkCHwithMapping(
 }
 
 /**
- * Benchmarks the Transit Node Routing query algorithm using a given precomputed data structure and a given
- * set of queries. Prints out the sum of the time required by all the queries in seconds and the average time
- * needed for one query in milliseconds. Additionally, the caller can specify an optional output file path,
- * where all the computed distances will be output. Those distances can then be for example compared with distances
- * computed by some other method to ensure correctness.
+ * Loads a Customizable Contraction Hierarchy written by the preprocessor and customizes it for the weights stored
+ * alongside the topology. The customization time is printed, so that it can be compared with the query times.
  *
- * @param inputFilePath[in] Path to the file containing the precomputed Transit Node Routing data structure.
+ * @param inputFilePath[in] Path to the file containing the Customizable Contraction Hierarchy.
+ * @param topology[out] The loaded topology.
+ * @return The customized metric.
+ */
+std::shared_ptr<const CCHMetric> loadCCH(const std::string& inputFilePath, CCHTopology& topology) {
+	std::ifstream input(inputFilePath, std::ios::binary);
+	if (!input.is_open()) {
+		throw input_error("Couldn't open file '" + inputFilePath + "'.\n");
+	}
+
+	std::vector<dist_t> weights;
+	topology = CCHTopology::read(input, weights);
+
+	Timer customizationTimer("CCH customization");
+	customizationTimer.begin();
+	auto metric = std::make_shared<const CCHMetric>(CCHCustomizer::customize(topology, weights));
+	customizationTimer.finish();
+
+	std::cout << "Customized " << topology.arcs() << " arcs in " << customizationTimer.getRealTimeSeconds()
+			  << " seconds." << std::endl;
+	return metric;
+}
+
+/**
+ * Benchmarks the Customizable Contraction Hierarchies query algorithm using a given precomputed data structure and
+ * a given set of queries. The structure is customized before the benchmark, the customization time is printed
+ * separately and not included in the query time. Otherwise works the same as 'benchmarkCH'.
+ *
+ * @param inputFilePath[in] Path to the file containing the Customizable Contraction Hierarchy.
  * @param queriesFilePath[in] Path to the file containing the queries used for the benchmark.
  * @param distancesOutputPath[in] Optional path where the computed distances can be output if the caller wants
  * to use them for example for verification purposes.
  * @param outputDistances[in] Specifies whether the computed distances should be output into a plain text file or not.
- * If the parameter is set to 'true', distances are output into a file, otherwise they are not.
  * @return Total time in seconds.
  */
-double benchmarkTNR(
+double benchmarkCCH(
 	const std::string& inputFilePath,
 	const std::string& queriesFilePath,
 	const std::string& distancesOutputPath = "",
@@ -413,16 +621,14 @@ double benchmarkTNR(
 	std::vector<std::pair<unsigned int, unsigned int> > trips;
 	tripsLoader.loadTrips(trips);
 
-	TNRGLoader tnrLoader = TNRGLoader(inputFilePath);
-	TransitNodeRoutingGraph<NodeData>* tnrGraph = tnrLoader.loadTNRforDistanceQueries();
-
-	std::vector<unsigned int> tnrDistances(trips.size());
-	double tnrTime = TNRBenchmark::benchmark(trips, *tnrGraph, tnrDistances);
+	CCHTopology topology;
+	auto metric = loadCCH(inputFilePath, topology);
 
-	delete tnrGraph;
+	std::vector<unsigned int> cchDistances(trips.size());
+	double cchTime = CCHBenchmark::benchmark(trips, topology, metric, cchDistances);
 
-	std::cout << "Run " << trips.size() << " queries using Transit Node Routing query algorithm in " << tnrTime << " seconds." << std::endl;
-	std::cout << "That means " << (tnrTime / (double) trips.size()) * 1000 << " ms per query." << std::endl;
+	std::cout << "Run " << trips.size() << " queries using Customizable Contraction Hierarchies query algorithm in " << cchTime << " seconds." << std::endl;
+	std::cout << "That means " << (cchTime / (double) trips.size()) * 1000 << " ms per query." << std::endl;
 
 	if (outputDistances) {
 		std::cout << "Now outputting distances to '" << distancesOutputPath << "'." << std::endl;
@@ -432,32 +638,28 @@ double benchmarkTNR(
 
 		output << queriesFilePath << std::endl;
 		for(size_t i = 0; i < trips.size(); ++i) {
-			output << tnrDistances[i] << std::endl;
+			output << cchDistances[i] << std::endl;
 		}
 
 		output.close();
 	}
-	return tnrTime;
+	return cchTime;
 }
 
 /**
- * Benchmarks the Transit Node Routing query algorithm using a given precomputed data structure, a given set of queries
- * and a given mapping. Prints out the sum of the time required by all the queries in seconds and the average time
- * needed for one query in milliseconds. Additionally, the caller can specify an optional output file path,
- * where all the computed distances will be output. Those distances can then be for example compared with distances
- * computed by some other method to ensure correctness.
+ * Benchmarks the Customizable Contraction Hierarchies query algorithm using a given precomputed data structure,
+ * a given set of queries and a given mapping. Otherwise works the same as 'benchmarkCCH'.
  *
- * @param inputFilePath[in] Path to the file containing the precomputed Transit Node Routing data structure.
+ * @param inputFilePath[in] Path to the file containing the Customizable Contraction Hierarchy.
  * @param queriesFilePath[in] Path to the file containing the queries used for the benchmark.
  * @param mappingFilePath[in] Path to the file containing the mapping from original IDs (used in the queries) to IDs
  * used internally in the data structure and the query algorithm.
  * @param distancesOutputPath[in] Optional path where the computed distances can be output if the caller wants
  * to use them for example for verification purposes.
  * @param outputDistances[in] Specifies whether the computed distances should be output into a plain text file or not.
- * If the parameter is set to 'true', distances are output into a file, otherwise they are not.
  * @return Total time in seconds.
  */
-double benchmarkTNRwithMapping(
+double benchmarkCCHwithMapping(
 	const std::string& inputFilePath,
 	const std::string& queriesFilePath,
 	const std::string& mappingFilePath,
@@ -467,16 +669,15 @@ double benchmarkTNRwithMapping(
 	std::vector<std::pair<long long unsigned int, long long unsigned int> > trips;
 	tripsLoader.loadLongLongTrips(trips);
 
-	TNRGLoader tnrLoader = TNRGLoader(inputFilePath);
-	TransitNodeRoutingGraph<NodeData>* tnrGraph = tnrLoader.loadTNRforDistanceQueries();
-
-	std::vector<unsigned int> tnrDistances(trips.size());
-	double tnrTime = TNRBenchmark::benchmarkWithMapping(trips, *tnrGraph, tnrDistances, mappingFilePath);
+	CCHTopology topology;
+	auto metric = loadCCH(inputFilePath, topology);
 
-	delete tnrGraph;
+	std::vector<unsigned int> cchDistances(trips.size());
+	double cchTime = CCHBenchmark::benchmarkUsingMapping(trips, topology, metric, cchDistances, mappingFilePath);
 
-	std::cout << "Run " << trips.size() << " queries using Transit Node Routing query algorithm in " << tnrTime << " seconds." << std::endl;
-	std::cout << "That means " << (tnrTime / (double) trips.size()) * 1000 << " ms per query." << std::endl;
+	std::cout << "Run " << trips.size() << " queries using Customizable Contraction Hierarchies query algorithm in " << cchTime << " seconds" << std::endl;
+	std::cout << "using '" << mappingFilePath << "' as mapping." << std::endl;
+	std::cout << "That means " << (cchTime / (double) trips.size()) * 1000 << " ms per query." << std::endl;
 
 	if (outputDistances) {
 		std::cout << "Now outputting distances to '" << distancesOutputPath << "'." << std::endl;
@@ -486,31 +687,71 @@ double benchmarkTNRwithMapping(
 
 		output << queriesFilePath << std::endl;
 		for(size_t i = 0; i < trips.size(); ++i) {
-			output << tnrDistances[i] << std::endl;
+			output << cchDistances[i] << std::endl;
 		}
 
 		output.close();
 	}
-	return tnrTime;
+	return cchTime;
 }
 
 /**
- * Benchmarks the Transit Node Routing with Arc Flags query algorithm using a given precomputed data structure and
- * a given set of queries. Prints out the sum of the time required by all the queries in seconds and the average time
- * needed for one query in milliseconds. Additionally, the caller can specify an optional output file path,
- * where all the computed distances will be output. Those distances can then be for example compared with distances
- * computed by some other method to ensure correctness.
+ * Memory-maps the hub labels written by the preprocessor and prints their size.
  *
- * @param inputFilePath[in] Path to the file containing the precomputed Transit Node Routing with Arc Flags data
- * structure.
+ * @param inputFilePath[in] Path to the file containing the hub labels.
+ * @return The labels.
+ */
+HubLabels loadHL(const std::string& inputFilePath) {
+	HubLabels labels = HubLabels::load(inputFilePath, true);
+	const double nodes = std::max(1u, labels.nodes());
+	std::cout << "Loaded " << (labels.compressed() ? "compressed " : "") << "hub labels of " << labels.nodes()
+			  << " nodes, " << (double) labels.entries(true) / nodes << " forward and "
+			  << (double) labels.entries(false) / nodes << " backward hubs per node, "
+			  << (double) labels.memoryUsage() / (1024 * 1024) << " MiB." << std::endl;
+	return labels;
+}
+
+/**
+ * Prints the time of the scalar merge intersection of the uncompressed labels, so that it can be compared with the
+ * SIMD variant used by the benchmark.
+ *
+ * @param labels[in] The hub labels.
+ * @param trips[in] The queries.
+ * @param mappingFilePath[in] Path to the mapping file, or an empty string if the queries use the internal IDs.
+ */
+template<class TripType>
+void printHLMergeTime(
+	const HubLabels& labels,
+	const std::vector<std::pair<TripType, TripType>>& trips,
+	const std::string& mappingFilePath = "") {
+	if (labels.compressed()) {
+		return;
+	}
+
+	std::vector<unsigned int> distances(trips.size());
+	double mergeTime;
+	if constexpr (std::is_same_v<TripType, unsigned int>) {
+		mergeTime = HLBenchmark::benchmark(trips, labels, HLDistanceQueryManager::Intersection::MERGE, distances);
+	} else {
+		mergeTime = HLBenchmark::benchmarkUsingMapping(trips, labels, HLDistanceQueryManager::Intersection::MERGE,
+			distances, mappingFilePath);
+	}
+	std::cout << "The scalar merge intersection takes " << (mergeTime / (double) trips.size()) * 1000
+			  << " ms per query (SIMD: " << HLDistanceQueryManager::simdInstructionSet() << ")." << std::endl;
+}
+
+/**
+ * Benchmarks the Hub Labeling query algorithm using the labels created by the preprocessor and a given set of queries.
+ * The labels are memory-mapped. Otherwise works the same as 'benchmarkCH'.
+ *
+ * @param inputFilePath[in] Path to the file containing the hub labels.
  * @param queriesFilePath[in] Path to the file containing the queries used for the benchmark.
  * @param distancesOutputPath[in] Optional path where the computed distances can be output if the caller wants
  * to use them for example for verification purposes.
  * @param outputDistances[in] Specifies whether the computed distances should be output into a plain text file or not.
- * If the parameter is set to 'true', distances are output into a file, otherwise they are not.
  * @return Total time in seconds.
  */
-double benchmarkTNRAF(
+double benchmarkHL(
 	const std::string& inputFilePath,
 	const std::string& queriesFilePath,
 	const std::string& distancesOutputPath = "",
@@ -519,16 +760,14 @@ double benchmarkTNRAF(
 	std::vector<std::pair<unsigned int, unsigned int> > trips;
 	tripsLoader.loadTrips(trips);
 
-	TGAFLoader tnrafLoader = TGAFLoader(inputFilePath);
-	TransitNodeRoutingArcFlagsGraph* tnrafGraph = tnrafLoader.loadTNRAFforDistanceQueries();
-
-	std::vector<unsigned int> tnrafDistances(trips.size());
-	double tnrafTime = TNRAFBenchmark::benchmark(trips, *tnrafGraph, tnrafDistances);
+	const HubLabels labels = loadHL(inputFilePath);
 
-	delete tnrafGraph;
+	std::vector<unsigned int> hlDistances(trips.size());
+	double hlTime = HLBenchmark::benchmark(trips, labels, HLDistanceQueryManager::Intersection::SIMD, hlDistances);
 
-	std::cout << "Run " << trips.size() << " queries using Transit Node Routing query algorithm in " << tnrafTime << " seconds." << std::endl;
-	std::cout << "That means " << (tnrafTime / (double) trips.size()) * 1000 << " ms per query." << std::endl;
+	std::cout << "Run " << trips.size() << " queries using Hub Labeling query algorithm in " << hlTime << " seconds." << std::endl;
+	std::cout << "That means " << (hlTime / (double) trips.size()) * 1000 << " ms per query." << std::endl;
+	printHLMergeTime(labels, trips);
 
 	if (outputDistances) {
 		std::cout << "Now outputting distances to '" << distancesOutputPath << "'." << std::endl;
@@ -538,33 +777,28 @@ double benchmarkTNRAF(
 
 		output << queriesFilePath << std::endl;
 		for(size_t i = 0; i < trips.size(); ++i) {
-			output << tnrafDistances[i] << std::endl;
+			output << hlDistances[i] << std::endl;
 		}
 
 		output.close();
 	}
-	return tnrafTime;
+	return hlTime;
 }
 
 /**
- * Benchmarks the Transit Node Routing with Arc Flags query algorithm using a given precomputed data structure,
- * a given set of queries and a given mapping. Prints out the sum of the time required by all the queries in seconds
- * and the average time needed for one query in milliseconds. Additionally, the caller can specify an optional
- * output file path, where all the computed distances will be output. Those distances can then be for example
- * compared with distances computed by some other method to ensure correctness.
+ * Benchmarks the Hub Labeling query algorithm using the labels created by the preprocessor, a given set of queries
+ * and a given mapping. Otherwise works the same as 'benchmarkHL'.
  *
- * @param inputFilePath[in] Path to the file containing the precomputed Transit Node Routing with Arc Flags data
- * structure.
+ * @param inputFilePath[in] Path to the file containing the hub labels.
  * @param queriesFilePath[in] Path to the file containing the queries used for the benchmark.
  * @param mappingFilePath[in] Path to the file containing the mapping from original IDs (used in the queries) to IDs
  * used internally in the data structure and the query algorithm.
  * @param distancesOutputPath[in] Optional path where the computed distances can be output if the caller wants
  * to use them for example for verification purposes.
  * @param outputDistances[in] Specifies whether the computed distances should be output into a plain text file or not.
- * If the parameter is set to 'true', distances are output into a file, otherwise they are not.
  * @return Total time in seconds.
  */
-double benchmarkTNRAFwithMapping(
+double benchmarkHLwithMapping(
 	const std::string& inputFilePath,
 	const std::string& queriesFilePath,
 	const std::string& mappingFilePath,
@@ -574,16 +808,16 @@ double benchmarkTNRAFwithMapping(
 	std::vector<std::pair<long long unsigned int, long long unsigned int> > trips;
 	tripsLoader.loadLongLongTrips(trips);
 
-	TGAFLoader tnrafLoader = TGAFLoader(inputFilePath);
-	TransitNodeRoutingArcFlagsGraph* tnrafGraph = tnrafLoader.loadTNRAFforDistanceQueries();
-
-	std::vector<unsigned int> tnrafDistances(trips.size());
-	double tnrafTime = TNRAFBenchmark::benchmarkWithMapping(trips, *tnrafGraph, tnrafDistances, mappingFilePath);
+	const HubLabels labels = loadHL(inputFilePath);
 
-	delete tnrafGraph;
+	std::vector<unsigned int> hlDistances(trips.size());
+	double hlTime = HLBenchmark::benchmarkUsingMapping(trips, labels, HLDistanceQueryManager::Intersection::SIMD,
+		hlDistances, mappingFilePath);
 
-	std::cout << "Run " << trips.size() << " queries using Transit Node Routing query algorithm in " << tnrafTime << " seconds." << std::endl;
-	std::cout << "That means " << (tnrafTime / (double) trips.size()) * 1000 << " ms per query." << std::endl;
+	std::cout << "Run " << trips.size() << " queries using Hub Labeling query algorithm in " << hlTime << " seconds" << std::endl;
+	std::cout << "using '" << mappingFilePath << "' as mapping." << std::endl;
+	std::cout << "That means " << (hlTime / (double) trips.size()) * 1000 << " ms per query." << std::endl;
+	printHLMergeTime(labels, trips, mappingFilePath);
 
 	if (outputDistances) {
 		std::cout << "Now outputting distances to '" << distancesOutputPath << "'." << std::endl;
@@ -593,22 +827,22 @@ double benchmarkTNRAFwithMapping(
 
 		output << queriesFilePath << std::endl;
 		for(size_t i = 0; i < trips.size(); ++i) {
-			output << tnrafDistances[i] << std::endl;
+			output << hlDistances[i] << std::endl;
 		}
 
 		output.close();
 	}
-	return tnrafTime;
+	return hlTime;
 }
 
 /**
- * Benchmarks the Distance Matrix method using a given precomputed data structure and a given set of queries.
- * Prints out the sum of the time required by all the queries in seconds and the average time needed for one query
- * in milliseconds. Additionally, the caller can specify an optional output file path, where all the computed
- * distances will be output. Those distances can then be for example * compared with distances computed by some
- * other method to ensure correctness.
+ * Benchmarks the Transit Node Routing query algorithm using a given precomputed data structure and a given
+ * set of queries. Prints out the sum of the time required by all the queries in seconds and the average time
+ * needed for one query in milliseconds. Additionally, the caller can specify an optional output file path,
+ * where all the computed distances will be output. Those distances can then be for example compared with distances
+ * computed by some other method to ensure correctness.
  *
- * @param inputFilePath[in] Path to the file containing the precomputed distance matrix.
+ * @param inputFilePath[in] Path to the file containing the precomputed Transit Node Routing data structure.
  * @param queriesFilePath[in] Path to the file containing the queries used for the benchmark.
  * @param distancesOutputPath[in] Optional path where the computed distances can be output if the caller wants
  * to use them for example for verification purposes.
@@ -616,7 +850,7 @@ double benchmarkTNRAFwithMapping(
  * If the parameter is set to 'true', distances are output into a file, otherwise they are not.
  * @return Total time in seconds.
  */
-double benchmarkDM(
+double benchmarkTNR(
 	const std::string& inputFilePath,
 	const std::string& queriesFilePath,
 	const std::string& distancesOutputPath = "",
@@ -625,16 +859,16 @@ double benchmarkDM(
 	std::vector<std::pair<unsigned int, unsigned int> > trips;
 	tripsLoader.loadTrips(trips);
 
-	DistanceMatrixLoader dmLoader = DistanceMatrixLoader(inputFilePath);
-	DistanceMatrixInterface* dm = dmLoader.loadHDF();
+	TNRGLoader tnrLoader = TNRGLoader(inputFilePath);
+	TransitNodeRoutingGraph<NodeData>* tnrGraph = tnrLoader.loadTNRforDistanceQueries();
 
-	std::vector<unsigned int> dmDistances(trips.size());
-	double dmTime = DistanceMatrixBenchmark::benchmark(trips, *dm, dmDistances);
+	std::vector<unsigned int> tnrDistances(trips.size());
+	double tnrTime = TNRBenchmark::benchmark(trips, *tnrGraph, tnrDistances);
 
-	delete dm;
+	delete tnrGraph;
 
-	std::cout << "Run " << trips.size() << " queries using Distance Matrix in " << dmTime << " seconds." << std::endl;
-	std::cout << "That means " << (dmTime / (double) trips.size()) * 1000 << " ms per query." << std::endl;
+	std::cout << "Run " << trips.size() << " queries using Transit Node Routing query algorithm in " << tnrTime << " seconds." << std::endl;
+	std::cout << "That means " << (tnrTime / (double) trips.size()) * 1000 << " ms per query." << std::endl;
 
 	if (outputDistances) {
 		std::cout << "Now outputting distances to '" << distancesOutputPath << "'." << std::endl;
@@ -644,22 +878,22 @@ double benchmarkDM(
 
 		output << queriesFilePath << std::endl;
 		for(size_t i = 0; i < trips.size(); ++i) {
-			output << dmDistances[i] << std::endl;
+			output << tnrDistances[i] << std::endl;
 		}
 
 		output.close();
 	}
-	return dmTime;
+	return tnrTime;
 }
 
 /**
- * Benchmarks the Distance Matrix method using a given precomputed data structure, a given set of queries and a given
- * mapping. Prints out the sum of the time required by all the queries in seconds and the average time needed for one
- * query in milliseconds. Additionally, the caller can specify an optional output file path, where all the computed
- * distances will be output. Those distances can then be for example compared with distances computed by some other
- * method to ensure correctness.
+ * Benchmarks the Transit Node Routing query algorithm using a given precomputed data structure, a given set of queries
+ * and a given mapping. Prints out the sum of the time required by all the queries in seconds and the average time
+ * needed for one query in milliseconds. Additionally, the caller can specify an optional output file path,
+ * where all the computed distances will be output. Those distances can then be for example compared with distances
+ * computed by some other method to ensure correctness.
  *
- * @param inputFilePath[in] Path to the file containing the precomputed distance matrix.
+ * @param inputFilePath[in] Path to the file containing the precomputed Transit Node Routing data structure.
  * @param queriesFilePath[in] Path to the file containing the queries used for the benchmark.
  * @param mappingFilePath[in] Path to the file containing the mapping from original IDs (used in the queries) to IDs
  * used internally in the data structure and the query algorithm.
@@ -669,7 +903,7 @@ double benchmarkDM(
  * If the parameter is set to 'true', distances are output into a file, otherwise they are not.
  * @return Total time in seconds.
  */
-double benchmarkDMwithMapping(
+double benchmarkTNRwithMapping(
 	const std::string& inputFilePath,
 	const std::string& queriesFilePath,
 	const std::string& mappingFilePath,
@@ -679,13 +913,177 @@ double benchmarkDMwithMapping(
 	std::vector<std::pair<long long unsigned int, long long unsigned int> > trips;
 	tripsLoader.loadLongLongTrips(trips);
 
-	DistanceMatrixLoader dmLoader = DistanceMatrixLoader(inputFilePath);
-	Distance_matrix_travel_time_provider<dist_t>* dm = dmLoader.loadXDM();
+	TNRGLoader tnrLoader = TNRGLoader(inputFilePath);
+	TransitNodeRoutingGraph<NodeData>* tnrGraph = tnrLoader.loadTNRforDistanceQueries();
 
-	std::vector<unsigned int> dmDistances(trips.size());
-	double dmTime = DistanceMatrixBenchmark::benchmarkUsingMapping(trips, *dm, dmDistances, mappingFilePath);
+	std::vector<unsigned int> tnrDistances(trips.size());
+	double tnrTime = TNRBenchmark::benchmarkWithMapping(trips, *tnrGraph, tnrDistances, mappingFilePath);
 
-	delete dm;
+	delete tnrGraph;
+
+	std::cout << "Run " << trips.size() << " queries using Transit Node Routing query algorithm in " << tnrTime << " seconds." << std::endl;
+	std::cout << "That means " << (tnrTime / (double) trips.size()) * 1000 << " ms per query." << std::endl;
+
+	if (outputDistances) {
+		std::cout << "Now outputting distances to '" << distancesOutputPath << "'." << std::endl;
+
+		std::ofstream output;
+		output.open(distancesOutputPath);
+
+		output << queriesFilePath << std::endl;
+		for(size_t i = 0; i < trips.size(); ++i) {
+			output << tnrDistances[i] << std::endl;
+		}
+
+		output.close();
+	}
+	return tnrTime;
+}
+
+/**
+ * Benchmarks the Transit Node Routing with Arc Flags query algorithm using a given precomputed data structure and
+ * a given set of queries. Prints out the sum of the time required by all the queries in seconds and the average time
+ * needed for one query in milliseconds. Additionally, the caller can specify an optional output file path,
+ * where all the computed distances will be output. Those distances can then be for example compared with distances
+ * computed by some other method to ensure correctness.
+ *
+ * @param inputFilePath[in] Path to the file containing the precomputed Transit Node Routing with Arc Flags data
+ * structure.
+ * @param queriesFilePath[in] Path to the file containing the queries used for the benchmark.
+ * @param distancesOutputPath[in] Optional path where the computed distances can be output if the caller wants
+ * to use them for example for verification purposes.
+ * @param outputDistances[in] Specifies whether the computed distances should be output into a plain text file or not.
+ * If the parameter is set to 'true', distances are output into a file, otherwise they are not.
+ * @return Total time in seconds.
+ */
+double benchmarkTNRAF(
+	const std::string& inputFilePath,
+	const std::string& queriesFilePath,
+	const std::string& distancesOutputPath = "",
+	bool outputDistances = false) {
+	TripsLoader tripsLoader = TripsLoader(queriesFilePath);
+	std::vector<std::pair<unsigned int, unsigned int> > trips;
+	tripsLoader.loadTrips(trips);
+
+	TGAFLoader tnrafLoader = TGAFLoader(inputFilePath);
+	TransitNodeRoutingArcFlagsGraph* tnrafGraph = tnrafLoader.loadTNRAFforDistanceQueries();
+
+	std::vector<unsigned int> tnrafDistances(trips.size());
+	double tnrafTime = TNRAFBenchmark::benchmark(trips, *tnrafGraph, tnrafDistances);
+
+	delete tnrafGraph;
+
+	std::cout << "Run " << trips.size() << " queries using Transit Node Routing query algorithm in " << tnrafTime << " seconds." << std::endl;
+	std::cout << "That means " << (tnrafTime / (double) trips.size()) * 1000 << " ms per query." << std::endl;
+
+	if (outputDistances) {
+		std::cout << "Now outputting distances to '" << distancesOutputPath << "'." << std::endl;
+
+		std::ofstream output;
+		output.open(distancesOutputPath);
+
+		output << queriesFilePath << std::endl;
+		for(size_t i = 0; i < trips.size(); ++i) {
+			output << tnrafDistances[i] << std::endl;
+		}
+
+		output.close();
+	}
+	return tnrafTime;
+}
+
+/**
+ * Benchmarks the Transit Node Routing with Arc Flags query algorithm using a given precomputed data structure,
+ * a given set of queries and a given mapping. Prints out the sum of the time required by all the queries in seconds
+ * and the average time needed for one query in milliseconds. Additionally, the caller can specify an optional
+ * output file path, where all the computed distances will be output. Those distances can then be for example
+ * compared with distances computed by some other method to ensure correctness.
+ *
+ * @param inputFilePath[in] Path to the file containing the precomputed Transit Node Routing with Arc Flags data
+ * structure.
+ * @param queriesFilePath[in] Path to the file containing the queries used for the benchmark.
+ * @param mappingFilePath[in] Path to the file containing the mapping from original IDs (used in the queries) to IDs
+ * used internally in the data structure and the query algorithm.
+ * @param distancesOutputPath[in] Optional path where the computed distances can be output if the caller wants
+ * to use them for example for verification purposes.
+ * @param outputDistances[in] Specifies whether the computed distances should be output into a plain text file or not.
+ * If the parameter is set to 'true', distances are output into a file, otherwise they are not.
+ * @return Total time in seconds.
+ */
+double benchmarkTNRAFwithMapping(
+	const std::string& inputFilePath,
+	const std::string& queriesFilePath,
+	const std::string& mappingFilePath,
+	const std::string& distancesOutputPath = "",
+	bool outputDistances = false) {
+	TripsLoader tripsLoader = TripsLoader(queriesFilePath);
+	std::vector<std::pair<long long unsigned int, long long unsigned int> > trips;
+	tripsLoader.loadLongLongTrips(trips);
+
+	TGAFLoader tnrafLoader = TGAFLoader(inputFilePath);
+	TransitNodeRoutingArcFlagsGraph* tnrafGraph = tnrafLoader.loadTNRAFforDistanceQueries();
+
+	std::vector<unsigned int> tnrafDistances(trips.size());
+	double tnrafTime = TNRAFBenchmark::benchmarkWithMapping(trips, *tnrafGraph, tnrafDistances, mappingFilePath);
+
+	delete tnrafGraph;
+
+	std::cout << "Run " << trips.size() << " queries using Transit Node Routing query algorithm in " << tnrafTime << " seconds." << std::endl;
+	std::cout << "That means " << (tnrafTime / (double) trips.size()) * 1000 << " ms per query." << std::endl;
+
+	if (outputDistances) {
+		std::cout << "Now outputting distances to '" << distancesOutputPath << "'." << std::endl;
+
+		std::ofstream output;
+		output.open(distancesOutputPath);
+
+		output << queriesFilePath << std::endl;
+		for(size_t i = 0; i < trips.size(); ++i) {
+			output << tnrafDistances[i] << std::endl;
+		}
+
+		output.close();
+	}
+	return tnrafTime;
+}
+
+/**
+ * Benchmarks the Distance Matrix method using a given precomputed data structure and a given set of queries.
+ * Prints out the sum of the time required by all the queries in seconds and the average time needed for one query
+ * in milliseconds. Additionally, the caller can specify an optional output file path, where all the computed
+ * distances will be output. Those distances can then be for example * compared with distances computed by some
+ * other method to ensure correctness.
+ *
+ * @param inputFilePath[in] Path to the file containing the precomputed distance matrix (HDF5, or CDM if the file has the
+ * '.cdm' extension).
+ * @param queriesFilePath[in] Path to the file containing the queries used for the benchmark.
+ * @param distancesOutputPath[in] Optional path where the computed distances can be output if the caller wants
+ * to use them for example for verification purposes.
+ * @param outputDistances[in] Specifies whether the computed distances should be output into a plain text file or not.
+ * If the parameter is set to 'true', distances are output into a file, otherwise they are not.
+ * @return Total time in seconds.
+ */
+double benchmarkDM(
+	const std::string& inputFilePath,
+	const std::string& queriesFilePath,
+	const std::string& distancesOutputPath = "",
+	bool outputDistances = false) {
+	TripsLoader tripsLoader = TripsLoader(queriesFilePath);
+	std::vector<std::pair<unsigned int, unsigned int> > trips;
+	tripsLoader.loadTrips(trips);
+
+	DistanceMatrixLoader dmLoader = DistanceMatrixLoader(inputFilePath);
+	DistanceMatrixInterface* dm;
+	if (std::filesystem::path(inputFilePath).extension() == ".cdm") {
+		dm = dmLoader.loadCDM();
+	} else {
+		dm = dmLoader.loadHDF();
+	}
+
+	std::vector<unsigned int> dmDistances(trips.size());
+	double dmTime = DistanceMatrixBenchmark::benchmark(trips, *dm, dmDistances);
+
+	delete dm;
 
 	std::cout << "Run " << trips.size() << " queries using Distance Matrix in " << dmTime << " seconds." << std::endl;
 	std::cout << "That means " << (dmTime / (double) trips.size()) * 1000 << " ms per query." << std::endl;
@@ -706,6 +1104,762 @@ double benchmarkDMwithMapping(
 	return dmTime;
 }
 
+/**
+ * Benchmarks the Distance Matrix method using a given precomputed data structure, a given set of queries and a given
+ * mapping. Prints out the sum of the time required by all the queries in seconds and the average time needed for one
+ * query in milliseconds. Additionally, the caller can specify an optional output file path, where all the computed
+ * distances will be output. Those distances can then be for example compared with distances computed by some other
+ * method to ensure correctness.
+ *
+ * @param inputFilePath[in] Path to the file containing the precomputed distance matrix (XDM, or CDM if the file has the
+ * '.cdm' extension).
+ * @param queriesFilePath[in] Path to the file containing the queries used for the benchmark.
+ * @param mappingFilePath[in] Path to the file containing the mapping from original IDs (used in the queries) to IDs
+ * used internally in the data structure and the query algorithm.
+ * @param distancesOutputPath[in] Optional path where the computed distances can be output if the caller wants
+ * to use them for example for verification purposes.
+ * @param outputDistances[in] Specifies whether the computed distances should be output into a plain text file or not.
+ * If the parameter is set to 'true', distances are output into a file, otherwise they are not.
+ * @return Total time in seconds.
+ */
+double benchmarkDMwithMapping(
+	const std::string& inputFilePath,
+	const std::string& queriesFilePath,
+	const std::string& mappingFilePath,
+	const std::string& distancesOutputPath = "",
+	bool outputDistances = false) {
+	TripsLoader tripsLoader = TripsLoader(queriesFilePath);
+	std::vector<std::pair<long long unsigned int, long long unsigned int> > trips;
+	tripsLoader.loadLongLongTrips(trips);
+
+	DistanceMatrixLoader dmLoader = DistanceMatrixLoader(inputFilePath);
+	DistanceMatrixInterface* dm;
+	if (std::filesystem::path(inputFilePath).extension() == ".cdm") {
+		dm = dmLoader.loadCDM();
+	} else {
+		dm = dmLoader.loadXDM();
+	}
+
+	std::vector<unsigned int> dmDistances(trips.size());
+	double dmTime = DistanceMatrixBenchmark::benchmarkUsingMapping(trips, *dm, dmDistances, mappingFilePath);
+
+	delete dm;
+
+	std::cout << "Run " << trips.size() << " queries using Distance Matrix in " << dmTime << " seconds." << std::endl;
+	std::cout << "That means " << (dmTime / (double) trips.size()) * 1000 << " ms per query." << std::endl;
+
+	if (outputDistances) {
+		std::cout << "Now outputting distances to '" << distancesOutputPath << "'." << std::endl;
+
+		std::ofstream output;
+		output.open(distancesOutputPath);
+
+		output << queriesFilePath << std::endl;
+		for(size_t i = 0; i < trips.size(); ++i) {
+			output << dmDistances[i] << std::endl;
+		}
+
+		output.close();
+	}
+	return dmTime;
+}
+
+/**
+ * Opens the distance matrix as a paged (out-of-core) matrix. Files with the '.xdm' extension are opened as XDM,
+ * everything else as HDF5.
+ *
+ * @param inputFilePath[in] Path to the file containing the precomputed distance matrix.
+ * @param rowsPerBlock[in] The number of consecutive rows loaded at once.
+ * @param cachedBlocks[in] The maximum number of blocks kept in memory.
+ * @return The paged distance matrix.
+ */
+std::unique_ptr<DistanceMatrixPagedInterface> loadPagedDM(
+	const std::string& inputFilePath,
+	unsigned int rowsPerBlock,
+	unsigned int cachedBlocks) {
+	DistanceMatrixLoader dmLoader = DistanceMatrixLoader(inputFilePath);
+	if (std::filesystem::path(inputFilePath).extension() == ".xdm") {
+		return std::unique_ptr<DistanceMatrixPagedInterface>(dmLoader.loadXDMPaged(rowsPerBlock, cachedBlocks));
+	}
+	return std::unique_ptr<DistanceMatrixPagedInterface>(dmLoader.loadHDFPaged(rowsPerBlock, cachedBlocks));
+}
+
+/**
+ * Prints the number of cache hits and misses of the paged distance matrix and resets the counters.
+ *
+ * @param dm[in] The paged distance matrix.
+ */
+void printPagedDMStatistics(const DistanceMatrixPagedInterface& dm) {
+	const auto hits = dm.cacheHits();
+	const auto misses = dm.cacheMisses();
+	const auto total = hits + misses;
+	std::cout << "Cache hits: " << hits << ", misses: " << misses;
+	if (total > 0) {
+		std::cout << " (hit rate " << (double) hits / (double) total * 100.0 << " %)";
+	}
+	std::cout << "." << std::endl;
+	dm.resetCacheStatistics();
+}
+
+/**
+ * Benchmarks the paged (out-of-core) Distance Matrix. Only 'cachedBlocks' blocks of 'rowsPerBlock' rows are kept in
+ * memory at once, the rest is read from the disk on demand. The queries are run three times: in the original (random)
+ * order, sorted by the start node (row-local access) and as a single batch. The time of the first run is returned,
+ * so that the result is comparable with the in-memory 'dm' method. The distances from the first run are output
+ * if requested.
+ *
+ * @param inputFilePath[in] Path to the file containing the precomputed distance matrix (XDM or HDF5).
+ * @param queriesFilePath[in] Path to the file containing the queries used for the benchmark.
+ * @param rowsPerBlock[in] The number of consecutive rows loaded at once.
+ * @param cachedBlocks[in] The maximum number of blocks kept in memory.
+ * @param distancesOutputPath[in] Optional path where the computed distances can be output if the caller wants
+ * to use them for example for verification purposes.
+ * @param outputDistances[in] Specifies whether the computed distances should be output into a plain text file or not.
+ * If the parameter is set to 'true', distances are output into a file, otherwise they are not.
+ * @return Total time in seconds.
+ */
+double benchmarkDMPaged(
+	const std::string& inputFilePath,
+	const std::string& queriesFilePath,
+	unsigned int rowsPerBlock,
+	unsigned int cachedBlocks,
+	const std::string& distancesOutputPath = "",
+	bool outputDistances = false) {
+	TripsLoader tripsLoader = TripsLoader(queriesFilePath);
+	std::vector<std::pair<unsigned int, unsigned int> > trips;
+	tripsLoader.loadTrips(trips);
+
+	auto dm = loadPagedDM(inputFilePath, rowsPerBlock, cachedBlocks);
+	std::cout << "Paged distance matrix with " << dm->nodes() << " nodes, cache capacity "
+		<< dm->cacheCapacityBytes() / 1024 << " KiB." << std::endl;
+
+	std::vector<unsigned int> dmDistances(trips.size());
+	double dmTime = DistanceMatrixBenchmark::benchmark(trips, *dm, dmDistances);
+	std::cout << "Run " << trips.size() << " queries using paged Distance Matrix in " << dmTime << " seconds." << std::endl;
+	std::cout << "That means " << (dmTime / (double) trips.size()) * 1000 << " ms per query." << std::endl;
+	printPagedDMStatistics(*dm);
+
+	std::vector<unsigned int> otherDistances(trips.size());
+	double rowLocalTime = DistanceMatrixBenchmark::benchmarkRowLocal(trips, *dm, otherDistances);
+	std::cout << "Row-local order: " << rowLocalTime << " seconds, " << (rowLocalTime / (double) trips.size()) * 1000 << " ms per query." << std::endl;
+	printPagedDMStatistics(*dm);
+
+	double batchTime = DistanceMatrixBenchmark::benchmarkBatch(trips, *dm, otherDistances);
+	std::cout << "Batch: " << batchTime << " seconds, " << (batchTime / (double) trips.size()) * 1000 << " ms per query." << std::endl;
+	printPagedDMStatistics(*dm);
+
+	if (outputDistances) {
+		std::cout << "Now outputting distances to '" << distancesOutputPath << "'." << std::endl;
+
+		std::ofstream output;
+		output.open(distancesOutputPath);
+
+		output << queriesFilePath << std::endl;
+		for(size_t i = 0; i < trips.size(); ++i) {
+			output << dmDistances[i] << std::endl;
+		}
+
+		output.close();
+	}
+	return dmTime;
+}
+
+/**
+ * Benchmarks the paged (out-of-core) Distance Matrix using a given mapping. See 'benchmarkDMPaged' and
+ * 'benchmarkDMwithMapping'.
+ *
+ * @param inputFilePath[in] Path to the file containing the precomputed distance matrix (XDM or HDF5).
+ * @param queriesFilePath[in] Path to the file containing the queries used for the benchmark.
+ * @param mappingFilePath[in] Path to the file containing the mapping from original IDs (used in the queries) to IDs
+ * used internally in the data structure and the query algorithm.
+ * @param rowsPerBlock[in] The number of consecutive rows loaded at once.
+ * @param cachedBlocks[in] The maximum number of blocks kept in memory.
+ * @param distancesOutputPath[in] Optional path where the computed distances can be output if the caller wants
+ * to use them for example for verification purposes.
+ * @param outputDistances[in] Specifies whether the computed distances should be output into a plain text file or not.
+ * If the parameter is set to 'true', distances are output into a file, otherwise they are not.
+ * @return Total time in seconds.
+ */
+double benchmarkDMPagedWithMapping(
+	const std::string& inputFilePath,
+	const std::string& queriesFilePath,
+	const std::string& mappingFilePath,
+	unsigned int rowsPerBlock,
+	unsigned int cachedBlocks,
+	const std::string& distancesOutputPath = "",
+	bool outputDistances = false) {
+	TripsLoader tripsLoader = TripsLoader(queriesFilePath);
+	std::vector<std::pair<long long unsigned int, long long unsigned int> > trips;
+	tripsLoader.loadLongLongTrips(trips);
+
+	auto dm = loadPagedDM(inputFilePath, rowsPerBlock, cachedBlocks);
+
+	std::vector<unsigned int> dmDistances(trips.size());
+	double dmTime = DistanceMatrixBenchmark::benchmarkUsingMapping(trips, *dm, dmDistances, mappingFilePath);
+
+	std::cout << "Run " << trips.size() << " queries using paged Distance Matrix in " << dmTime << " seconds" << std::endl;
+	std::cout << "using '" << mappingFilePath << "' as mapping." << std::endl;
+	std::cout << "That means " << (dmTime / (double) trips.size()) * 1000 << " ms per query." << std::endl;
+	printPagedDMStatistics(*dm);
+
+	if (outputDistances) {
+		std::cout << "Now outputting distances to '" << distancesOutputPath << "'." << std::endl;
+
+		std::ofstream output;
+		output.open(distancesOutputPath);
+
+		output << queriesFilePath << std::endl;
+		for(size_t i = 0; i < trips.size(); ++i) {
+			output << dmDistances[i] << std::endl;
+		}
+
+		output.close();
+	}
+	return dmTime;
+}
+
+/**
+ * Loads the query set and translates the node IDs to the IDs used internally in the data structures if a mapping file
+ * is given.
+ *
+ * @param queriesFilePath[in] Path to the file containing the queries.
+ * @param mappingFilePath[in] Path to the mapping file, or an empty string if the queries use the internal IDs.
+ * @return The queries using the internal IDs.
+ */
+std::vector<std::pair<unsigned int, unsigned int> > loadTripsWithInternalIDs(
+	const std::string& queriesFilePath,
+	const std::string& mappingFilePath) {
+	TripsLoader tripsLoader = TripsLoader(queriesFilePath);
+	std::vector<std::pair<unsigned int, unsigned int> > trips;
+	if (mappingFilePath.empty()) {
+		tripsLoader.loadTrips(trips);
+	} else {
+		std::vector<std::pair<long long unsigned int, long long unsigned int> > originalTrips;
+		tripsLoader.loadLongLongTrips(originalTrips);
+
+		NodeMappingLoader mappingLoader(mappingFilePath);
+		NodeMapping mapping = mappingLoader.loadMapping();
+
+		trips.reserve(originalTrips.size());
+		for (const auto& trip : originalTrips) {
+			trips.emplace_back(mapping.internalID(trip.first), mapping.internalID(trip.second));
+		}
+	}
+	return trips;
+}
+
+/**
+ * Loads the data structure for the given method and returns a factory that creates a query function for each benchmark
+ * thread. None of the methods modifies the data structure when answering queries, so all threads share one instance.
+ * The query state of ALT, CH, CCH, TNR and TNRAF lives in the per-thread query manager, the memory-mapped hub labels
+ * are only read.
+ *
+ * @param method[in] The benchmarked method.
+ * @param inputFilePath[in] Path to the file containing the graph or the precomputed data structure.
+ * @param withMapping[in] Whether the queries use the original IDs. This only changes the Distance Matrix format
+ * (XDM instead of HDF5), the same way as in 'benchmarkDMwithMapping'.
+ * @param dijkstraOptions[in] The options of the 'dijkstra' method, every thread gets its own 'DijkstraEngine'.
+ * @param ordering[in] The 'dijkstra' and 'astar' methods renumber the nodes of the graph by this ordering when it is
+ * loaded (see 'ReorderedGraphLoader'), the query functions still take the IDs of the input graph. Empty if the nodes
+ * keep their IDs.
+ * @return The query function factory.
+ */
+LatencyBenchmark::QueryFunctionFactory createQueryFunctionFactory(
+	const std::string& method,
+	const std::string& inputFilePath,
+	bool withMapping,
+	const DijkstraOptions& dijkstraOptions = {},
+	const std::string& ordering = "") {
+	if (method == "dijkstra" || method == "astar") {
+		CsvGraphLoader csvGraphLoader = CsvGraphLoader(inputFilePath);
+		std::unique_ptr<ReorderedGraphLoader> reorderedLoader;
+		if (!ordering.empty()) {
+			reorderedLoader = std::make_unique<ReorderedGraphLoader>(csvGraphLoader, NodeOrdering::parse(ordering));
+		}
+		GraphLoader& graphLoader = reorderedLoader ? static_cast<GraphLoader&>(*reorderedLoader) : csvGraphLoader;
+		auto graph = std::make_shared<Graph>(graphLoader.nodes());
+		graphLoader.loadGraph(*graph, 1);
+
+		LatencyBenchmark::QueryFunctionFactory factory;
+		if (method == "dijkstra") {
+			factory = [graph, dijkstraOptions](unsigned int) -> LatencyBenchmark::QueryFunction {
+				auto engine = std::make_shared<DijkstraEngine>(*graph, dijkstraOptions.heap);
+				if (dijkstraOptions.bidirectional) {
+					return [graph, engine](unsigned int start, unsigned int goal) {
+						return engine->runBidirectional(start, goal);
+					};
+				}
+				return [graph, engine](unsigned int start, unsigned int goal) { return engine->run(start, goal); };
+			};
+		} else {
+			auto gpsLocations = std::vector<std::pair<double, double>>(csvGraphLoader.nodes());
+			auto projectedLocations = std::make_shared<std::vector<std::pair<double, double>>>();
+			csvGraphLoader.loadLocations(gpsLocations);
+			if (reorderedLoader) {
+				std::vector<std::pair<double, double>> reorderedLocations(gpsLocations.size());
+				for (size_t node = 0; node < gpsLocations.size(); ++node) {
+					reorderedLocations[reorderedLoader->newIDs()[node]] = gpsLocations[node];
+				}
+				gpsLocations.swap(reorderedLocations);
+			}
+			LocationTransformer::transformLocations(gpsLocations, *projectedLocations);
+			factory = [graph, projectedLocations](unsigned int) -> LatencyBenchmark::QueryFunction {
+				return [graph, projectedLocations](unsigned int start, unsigned int goal) {
+					return Astar::run(start, goal, *graph, *projectedLocations);
+				};
+			};
+		}
+
+		if (!reorderedLoader) {
+			return factory;
+		}
+		auto newIDs = std::make_shared<const std::vector<unsigned int>>(reorderedLoader->newIDs());
+		return [factory = std::move(factory), newIDs](unsigned int thread) -> LatencyBenchmark::QueryFunction {
+			auto query = factory(thread);
+			return [newIDs, query](unsigned int start, unsigned int goal) {
+				return query((*newIDs)[start], (*newIDs)[goal]);
+			};
+		};
+	}
+
+	if (method == "alt") {
+		std::unique_ptr<Graph> loadedGraph;
+		auto landmarks = std::make_shared<const Landmarks>(loadALT(inputFilePath, loadedGraph));
+		std::shared_ptr<const Graph> graph(std::move(loadedGraph));
+		return [graph, landmarks](unsigned int) -> LatencyBenchmark::QueryFunction {
+			auto queryManager = std::make_shared<ALTQueryManager>(*graph, *landmarks);
+			return [graph, landmarks, queryManager](unsigned int start, unsigned int goal) {
+				return queryManager->findDistance(start, goal);
+			};
+		};
+	}
+
+	if (method == "ch") {
+		DDSGLoader chLoader = DDSGLoader(inputFilePath);
+		std::shared_ptr<FlagsGraph<NodeData>> ch(chLoader.loadFlagsGraph());
+		return [ch](unsigned int) -> LatencyBenchmark::QueryFunction {
+			auto queryManager = std::make_shared<CHDistanceQueryManager<NodeData>>(*ch);
+			return [ch, queryManager](unsigned int start, unsigned int goal) {
+				return queryManager->findDistance(start, goal);
+			};
+		};
+	}
+
+	if (method == "cch") {
+		auto topology = std::make_shared<CCHTopology>();
+		auto metric = loadCCH(inputFilePath, *topology);
+		return [topology, metric](unsigned int) -> LatencyBenchmark::QueryFunction {
+			auto queryManager = std::make_shared<CCHDistanceQueryManager>(*topology, metric);
+			return [topology, queryManager](unsigned int start, unsigned int goal) {
+				return queryManager->findDistance(start, goal);
+			};
+		};
+	}
+
+	if (method == "hl") {
+		auto labels = std::make_shared<const HubLabels>(loadHL(inputFilePath));
+		auto queryManager = std::make_shared<const HLDistanceQueryManager>(*labels);
+		return [labels, queryManager](unsigned int) -> LatencyBenchmark::QueryFunction {
+			return [labels, queryManager](unsigned int start, unsigned int goal) {
+				return queryManager->findDistance(start, goal);
+			};
+		};
+	}
+
+	if (method == "tnr") {
+		TNRGLoader tnrLoader = TNRGLoader(inputFilePath);
+		std::shared_ptr<TransitNodeRoutingGraph<NodeData>> tnrGraph(tnrLoader.loadTNRforDistanceQueries());
+		return [tnrGraph](unsigned int) -> LatencyBenchmark::QueryFunction {
+			auto queryManager = std::make_shared<TNRDistanceQueryManager>(*tnrGraph);
+			return [tnrGraph, queryManager](unsigned int start, unsigned int goal) {
+				return queryManager->findDistance(start, goal);
+			};
+		};
+	}
+
+	if (method == "tnraf") {
+		TGAFLoader tnrafLoader = TGAFLoader(inputFilePath);
+		std::shared_ptr<TransitNodeRoutingArcFlagsGraph> tnrafGraph(tnrafLoader.loadTNRAFforDistanceQueries());
+		return [tnrafGraph](unsigned int) -> LatencyBenchmark::QueryFunction {
+			auto queryManager = std::make_shared<TNRAFDistanceQueryManager>(*tnrafGraph);
+			return [tnrafGraph, queryManager](unsigned int start, unsigned int goal) {
+				return queryManager->findDistance(start, goal);
+			};
+		};
+	}
+
+	if (method == "dm") {
+		DistanceMatrixLoader dmLoader = DistanceMatrixLoader(inputFilePath);
+		std::shared_ptr<DistanceMatrixInterface> dm;
+		if (std::filesystem::path(inputFilePath).extension() == ".cdm") {
+			dm.reset(dmLoader.loadCDM());
+		} else if (withMapping) {
+			dm.reset(dmLoader.loadXDM());
+		} else {
+			dm.reset(dmLoader.loadHDF());
+		}
+		return [dm](unsigned int) -> LatencyBenchmark::QueryFunction {
+			return [dm](unsigned int start, unsigned int goal) { return dm->findDistance(start, goal); };
+		};
+	}
+
+	if (method == "dm-paged") {
+		throw input_error("The latency benchmark does not support the 'dm-paged' method, the paged distance matrix "
+						  "can not be shared between threads.\n");
+	}
+
+	throw input_error("Invalid method '" + method + "' for the Benchmark command.\n");
+}
+
+/**
+ * Wraps the query functions created by a factory for a structure preprocessed from a simplified graph (see
+ * 'GraphSimplifier'), so that they answer the queries using the IDs of the original graph, including the nodes
+ * removed by the simplification. The table is shared by all threads.
+ *
+ * @param factory[in] The factory of the query functions for the core graph.
+ * @param simplificationFilePath[in] Path to the '.simp' file written by the preprocessor together with the structure.
+ * @return The query function factory for the original graph.
+ */
+LatencyBenchmark::QueryFunctionFactory createSimplifiedQueryFunctionFactory(
+	LatencyBenchmark::QueryFunctionFactory factory,
+	const std::string& simplificationFilePath) {
+	std::ifstream input(simplificationFilePath, std::ios::binary);
+	if (!input.is_open()) {
+		throw input_error("Couldn't open file '" + simplificationFilePath + "'.\n");
+	}
+	auto table = std::make_shared<const SimplificationTable>(SimplificationTable::read(input));
+	std::cout << "Loaded the simplification table of " << table->nodes() << " nodes, " << table->coreNodes()
+			  << " of them are in the core graph." << std::endl;
+
+	return [factory = std::move(factory), table](unsigned int thread) -> LatencyBenchmark::QueryFunction {
+		auto query = factory(thread);
+		return [table, query](unsigned int start, unsigned int goal) {
+			return table->findDistance(start, goal, query);
+		};
+	};
+}
+
+/**
+ * Prints the statistics of a latency benchmark run, writes them into the report and optionally outputs the computed
+ * distances.
+ *
+ * @param statistics[in] The statistics of the run.
+ * @param distances[in] The distances computed during the run.
+ * @param method[in] The benchmarked method.
+ * @param queriesFilePath[in] Path to the file containing the queries used for the benchmark.
+ * @param reportPath[in] Path to the report. JSON reports are overwritten, CSV reports are appended to.
+ * @param reportFormat[in] The format of the report, either 'json' or 'csv'.
+ * @param distancesOutputPath[in] Path where the computed distances are output if 'outputDistances' is set.
+ * @param outputDistances[in] Specifies whether the computed distances should be output into a plain text file or not.
+ */
+void reportLatency(
+	const LatencyStatistics& statistics,
+	const std::vector<unsigned int>& distances,
+	const std::string& method,
+	const std::string& queriesFilePath,
+	const std::string& reportPath,
+	const std::string& reportFormat,
+	const std::string& distancesOutputPath,
+	bool outputDistances) {
+	LatencyBenchmark::print(statistics, std::cout);
+
+	if (reportFormat == "csv") {
+		LatencyBenchmark::appendCsv(statistics, method, queriesFilePath, reportPath);
+	} else {
+		LatencyBenchmark::writeJson(statistics, method, queriesFilePath, reportPath);
+	}
+	std::cout << "Latency report written to '" << reportPath << "'." << std::endl;
+
+	if (outputDistances) {
+		std::cout << "Now outputting distances to '" << distancesOutputPath << "'." << std::endl;
+
+		std::ofstream output;
+		output.open(distancesOutputPath);
+
+		output << queriesFilePath << std::endl;
+		for(size_t i = 0; i < distances.size(); ++i) {
+			output << distances[i] << std::endl;
+		}
+
+		output.close();
+	}
+}
+
+/**
+ * Benchmarks the given method in the latency mode. Every query is timed separately and the latency percentiles,
+ * the latency histogram and the throughput are printed and written into a JSON or CSV report. The queries can be run
+ * using multiple threads, in which case the throughput of all the threads together is measured. If a mapping file
+ * is given, the queries are translated to the internal IDs before the measurement starts, so the mapping lookup
+ * is not included in the latencies.
+ *
+ * @param method[in] The benchmarked method.
+ * @param inputFilePath[in] Path to the file containing the graph or the precomputed data structure.
+ * @param queriesFilePath[in] Path to the file containing the queries used for the benchmark.
+ * @param mappingFilePath[in] Path to the mapping file, or an empty string if the queries use the internal IDs.
+ * @param threads[in] The number of threads used to run the queries.
+ * @param warmupQueries[in] The number of queries each thread runs before the measurement starts.
+ * @param reportFormat[in] The format of the report, either 'json' or 'csv'.
+ * @param reportPath[in] Path to the report. JSON reports are overwritten, CSV reports are appended to.
+ * @param distancesOutputPath[in] Optional path where the computed distances can be output if the caller wants
+ * to use them for example for verification purposes.
+ * @param outputDistances[in] Specifies whether the computed distances should be output into a plain text file or not.
+ * If the parameter is set to 'true', distances are output into a file, otherwise they are not.
+ * @param dijkstraOptions[in] The options of the 'dijkstra' method.
+ * @param simplificationFilePath[in] Path to the simplification table if the structure was preprocessed from
+ * a simplified graph, or an empty string.
+ * @param ordering[in] The ordering the 'dijkstra' and 'astar' methods renumber the graph by, or an empty string.
+ * @return Total time in seconds.
+ */
+double benchmarkLatency(
+	const std::string& method,
+	const std::string& inputFilePath,
+	const std::string& queriesFilePath,
+	const std::string& mappingFilePath,
+	unsigned int threads,
+	size_t warmupQueries,
+	const std::string& reportFormat,
+	const std::string& reportPath,
+	const std::string& distancesOutputPath = "",
+	bool outputDistances = false,
+	const DijkstraOptions& dijkstraOptions = {},
+	const std::string& simplificationFilePath = "",
+	const std::string& ordering = "") {
+	if (reportFormat != "json" && reportFormat != "csv") {
+		throw input_error("Invalid report format '" + reportFormat + "', use 'json' or 'csv'.\n");
+	}
+
+	auto trips = loadTripsWithInternalIDs(queriesFilePath, mappingFilePath);
+
+	auto factory = createQueryFunctionFactory(method, inputFilePath, !mappingFilePath.empty(), dijkstraOptions,
+		ordering);
+	if (!simplificationFilePath.empty()) {
+		factory = createSimplifiedQueryFunctionFactory(std::move(factory), simplificationFilePath);
+	}
+
+	std::vector<unsigned int> distances(trips.size());
+	auto statistics = LatencyBenchmark::benchmark(trips, factory, threads, warmupQueries, distances);
+	reportLatency(statistics, distances, method, queriesFilePath, reportPath, reportFormat, distancesOutputPath,
+		outputDistances);
+	return statistics.totalSeconds;
+}
+
+#ifndef _MSC_VER
+/**
+ * Drives a running query server (see 'server_runner.cpp') as a local load generator. Every thread opens its own
+ * connection and sends the queries one by one as separate requests, so the measured latencies include the round
+ * trip through the socket and the time a request waits to be coalesced into a batch by the server. The node IDs from
+ * the query set are sent unchanged, so if they are original IDs, the server has to be started with a mapping file.
+ *
+ * @param socketPath[in] The path of the socket the server listens on.
+ * @param queriesFilePath[in] Path to the file containing the queries used for the benchmark.
+ * @param threads[in] The number of client threads (connections) sending the queries concurrently.
+ * @param warmupQueries[in] The number of queries each thread runs before the measurement starts.
+ * @param reportFormat[in] The format of the report, either 'json' or 'csv'.
+ * @param reportPath[in] Path to the report. JSON reports are overwritten, CSV reports are appended to.
+ * @param distancesOutputPath[in] Optional path where the computed distances can be output if the caller wants
+ * to use them for example for verification purposes.
+ * @param outputDistances[in] Specifies whether the computed distances should be output into a plain text file or not.
+ * @return Total time in seconds.
+ */
+double benchmarkServer(
+	const std::string& socketPath,
+	const std::string& queriesFilePath,
+	unsigned int threads,
+	size_t warmupQueries,
+	const std::string& reportFormat,
+	const std::string& reportPath,
+	const std::string& distancesOutputPath = "",
+	bool outputDistances = false) {
+	if (reportFormat != "json" && reportFormat != "csv") {
+		throw input_error("Invalid report format '" + reportFormat + "', use 'json' or 'csv'.\n");
+	}
+
+	auto originalTrips = std::make_shared<std::vector<std::pair<long long unsigned int, long long unsigned int>>>();
+	TripsLoader tripsLoader = TripsLoader(queriesFilePath);
+	tripsLoader.loadLongLongTrips(*originalTrips);
+
+	// The latency benchmark works with 32-bit node IDs, so it gets the indices of the trips instead and the query
+	// function looks the 64-bit IDs up.
+	std::vector<std::pair<unsigned int, unsigned int>> trips(originalTrips->size());
+	for (unsigned int i = 0; i < trips.size(); ++i) {
+		trips[i] = {i, i};
+	}
+
+	auto factory = [&socketPath, originalTrips](unsigned int) -> LatencyBenchmark::QueryFunction {
+		auto client = std::make_shared<QueryClient>(socketPath);
+		return [client, originalTrips](unsigned int trip, unsigned int) {
+			return client->distance((*originalTrips)[trip].first, (*originalTrips)[trip].second);
+		};
+	};
+
+	std::vector<unsigned int> distances(trips.size());
+	auto statistics = LatencyBenchmark::benchmark(trips, factory, threads, warmupQueries, distances);
+	reportLatency(statistics, distances, "server", queriesFilePath, reportPath, reportFormat, distancesOutputPath,
+		outputDistances);
+	return statistics.totalSeconds;
+}
+#endif
+
+/**
+ * Runs the queries once more with the search statistics enabled and prints the total, mean and maximum of every
+ * counter. This is done in a separate run so that the counting does not influence the measured times. Optionally,
+ * the statistics of every single query are written into a CSV file together with the start and goal node, so that
+ * expensive queries can be related to the parts of the graph they belong to.
+ *
+ * @param method[in] The benchmarked method, one of 'alt', 'ch', 'cch', 'tnr' and 'tnraf'.
+ * @param inputFilePath[in] Path to the file containing the precomputed data structure.
+ * @param queriesFilePath[in] Path to the file containing the queries used for the benchmark.
+ * @param mappingFilePath[in] Path to the mapping file, or an empty string if the queries use the internal IDs.
+ * @param statisticsOutputPath[in] Path to the per-query CSV file, or an empty string if it should not be written.
+ */
+void collectQueryStatistics(
+	const std::string& method,
+	const std::string& inputFilePath,
+	const std::string& queriesFilePath,
+	const std::string& mappingFilePath,
+	const std::string& statisticsOutputPath) {
+#ifdef SHORTEST_PATHS_NO_QUERY_STATISTICS
+	throw input_error("The query statistics were disabled at compile time (the QUERY_STATISTICS CMake option).\n");
+#endif
+	auto trips = loadTripsWithInternalIDs(queriesFilePath, mappingFilePath);
+	std::vector<QueryStatistics> statistics(trips.size());
+
+	auto run = [&](auto& queryManager) {
+		for (size_t i = 0; i < trips.size(); ++i) {
+			queryManager.setStatistics(&statistics[i]);
+			queryManager.findDistance(trips[i].first, trips[i].second);
+		}
+		queryManager.setStatistics(nullptr);
+	};
+
+	if (method == "alt") {
+		std::unique_ptr<Graph> graph;
+		const Landmarks landmarks = loadALT(inputFilePath, graph);
+		ALTQueryManager queryManager(*graph, landmarks);
+		run(queryManager);
+	} else if (method == "ch") {
+		DDSGLoader chLoader = DDSGLoader(inputFilePath);
+		std::unique_ptr<FlagsGraph<NodeData>> ch(chLoader.loadFlagsGraph());
+		CHDistanceQueryManager<NodeData> queryManager(*ch);
+		run(queryManager);
+	} else if (method == "cch") {
+		CCHTopology topology;
+		auto metric = loadCCH(inputFilePath, topology);
+		CCHDistanceQueryManager queryManager(topology, metric);
+		run(queryManager);
+	} else if (method == "tnr") {
+		TNRGLoader tnrLoader = TNRGLoader(inputFilePath);
+		std::unique_ptr<TransitNodeRoutingGraph<NodeData>> tnrGraph(tnrLoader.loadTNRforDistanceQueries());
+		TNRDistanceQueryManager queryManager(*tnrGraph);
+		run(queryManager);
+	} else if (method == "tnraf") {
+		TGAFLoader tnrafLoader = TGAFLoader(inputFilePath);
+		std::unique_ptr<TransitNodeRoutingArcFlagsGraph> tnrafGraph(tnrafLoader.loadTNRAFforDistanceQueries());
+		TNRAFDistanceQueryManager queryManager(*tnrafGraph);
+		run(queryManager);
+	} else {
+		throw input_error("Query statistics are only available for the 'alt', 'ch', 'cch', 'tnr' and 'tnraf' methods.\n");
+	}
+
+	const std::vector<std::pair<std::string, size_t QueryStatistics::*>> counters = {
+		{"settled nodes", &QueryStatistics::settledNodes},
+		{"relaxed edges", &QueryStatistics::relaxedEdges},
+		{"stalled nodes", &QueryStatistics::stalledNodes},
+		{"heap pushes", &QueryStatistics::heapPushes},
+		{"local query fallbacks", &QueryStatistics::localQueryFallbacks},
+		{"access node pairs", &QueryStatistics::accessNodePairs},
+		{"arc flag prunes", &QueryStatistics::arcFlagPrunes},
+	};
+
+	std::cout << "Query statistics (total / mean / max per query):" << std::endl;
+	for (const auto& [name, counter] : counters) {
+		size_t total = 0;
+		size_t maximum = 0;
+		for (const auto& queryStatistics : statistics) {
+			total += queryStatistics.*counter;
+			maximum = std::max(maximum, queryStatistics.*counter);
+		}
+		const double mean = trips.empty() ? 0 : (double) total / (double) trips.size();
+		std::cout << "  " << name << ": " << total << " / " << mean << " / " << maximum << std::endl;
+	}
+
+	if (!statisticsOutputPath.empty()) {
+		std::cout << "Now outputting query statistics to '" << statisticsOutputPath << "'." << std::endl;
+
+		std::ofstream output;
+		output.open(statisticsOutputPath);
+
+		output << "start,goal,settled_nodes,relaxed_edges,stalled_nodes,heap_pushes,local_query_fallbacks,"
+				  "access_node_pairs,arc_flag_prunes" << std::endl;
+		for (size_t i = 0; i < trips.size(); ++i) {
+			output << trips[i].first << "," << trips[i].second;
+			for (const auto& counter : counters) {
+				output << "," << statistics[i].*counter.second;
+			}
+			output << std::endl;
+		}
+
+		output.close();
+	}
+}
+
+/**
+ * Answers the queries once more using the benchmarked method and compares every distance with a Dijkstra search on the
+ * original graph. Every mismatch is printed, so this can be used to validate a preprocessed structure against the graph
+ * it was created from without a precomputed file with the correct distances.
+ *
+ * @param method[in] The benchmarked method.
+ * @param inputFilePath[in] Path to the file containing the graph or the precomputed data structure.
+ * @param queriesFilePath[in] Path to the file containing the queries used for the benchmark.
+ * @param mappingFilePath[in] Path to the mapping file, or an empty string if the queries use the internal IDs.
+ * @param graphFilePath[in] Path to the original graph, either in the XenGraph format (.xeng) or in the CSV format.
+ * @param dijkstraOptions[in] The options of the 'dijkstra' method, the heap is also used by the reference search.
+ * @param simplificationFilePath[in] Path to the simplification table if the structure was preprocessed from
+ * a simplified graph, or an empty string.
+ * @param ordering[in] The ordering the 'dijkstra' and 'astar' methods renumber the graph by, or an empty string.
+ * @return The number of mismatches.
+ */
+size_t validateDistances(
+	const std::string& method,
+	const std::string& inputFilePath,
+	const std::string& queriesFilePath,
+	const std::string& mappingFilePath,
+	const std::string& graphFilePath,
+	const DijkstraOptions& dijkstraOptions,
+	const std::string& simplificationFilePath = "",
+	const std::string& ordering = "") {
+	auto trips = loadTripsWithInternalIDs(queriesFilePath, mappingFilePath);
+
+	auto factory = createQueryFunctionFactory(method, inputFilePath, !mappingFilePath.empty(), dijkstraOptions,
+		ordering);
+	if (!simplificationFilePath.empty()) {
+		factory = createSimplifiedQueryFunctionFactory(std::move(factory), simplificationFilePath);
+	}
+	auto query = factory(0);
+	std::vector<dist_t> distances(trips.size());
+	for (size_t i = 0; i < trips.size(); ++i) {
+		distances[i] = query(trips[i].first, trips[i].second);
+	}
+
+	std::unique_ptr<GraphLoader> graphLoader;
+	if (std::filesystem::path(graphFilePath).extension() == ".xeng") {
+		graphLoader = std::make_unique<XenGraphLoader>(graphFilePath);
+	} else {
+		graphLoader = std::make_unique<CsvGraphLoader>(graphFilePath);
+	}
+	Graph graph(graphLoader->nodes());
+	graphLoader->loadGraph(graph, 1);
+
+	Timer timer("Validation against Dijkstra");
+	timer.begin();
+	size_t mismatches = CorrectnessValidator::validateAgainstDijkstra(trips, distances, graph, dijkstraOptions.heap);
+	timer.finish();
+
+	std::cout << "Validated " << trips.size() << " distances against Dijkstra's algorithm on '" << graphFilePath
+			  << "' in " << timer.getRealTimeSeconds() << " seconds, " << mismatches << " mismatches." << std::endl;
+	return mismatches;
+}
+
 /**
  * @mainpage Shortest Paths computation library
  *
@@ -732,8 +1886,15 @@ int main(int argc, char* argv[]) {
 	setvbuf(stdout, NULL, _IONBF, 0);
 
 	boost::optional<std::string> method, inputFormat, inputPath, outputFormat, outputPath, preprocessingMode,
-		inputStructure, querySet, mappingFile;
-	boost::optional<unsigned int> tnodesCnt, dmIntSize, precisionLoss;
+		inputStructure, querySet, mappingFile, reportFormat, reportPath, queryStatisticsPath, dijkstraHeap,
+		validationGraph, simplificationFile, reorder;
+	boost::optional<unsigned int> tnodesCnt, dmIntSize, precisionLoss, dmBlockRows, dmCachedBlocks, threads;
+	boost::optional<size_t> warmupQueries;
+	bool latency = false;
+	bool queryStatistics = false;
+	bool bidirectional = false;
+	bool compressedCH = false;
+	bool mappingBenchmark = false;
 
 	// Declare the supported options.
 	boost::program_options::options_description allOptions("Allowed options");
@@ -750,7 +1911,23 @@ int main(int argc, char* argv[]) {
 		("precision-loss", boost::program_options::value(&precisionLoss)->default_value(1))
 		("input-structure", boost::program_options::value(&inputStructure))
 		("query-set", boost::program_options::value(&querySet))
-		("mapping-file", boost::program_options::value(&mappingFile));
+		("mapping-file", boost::program_options::value(&mappingFile))
+		("mapping-benchmark", boost::program_options::bool_switch(&mappingBenchmark))
+		("dm-block-rows", boost::program_options::value(&dmBlockRows)->default_value(64))
+		("dm-cached-blocks", boost::program_options::value(&dmCachedBlocks)->default_value(256))
+		("latency", boost::program_options::bool_switch(&latency))
+		("threads", boost::program_options::value(&threads)->default_value(1))
+		("warmup", boost::program_options::value(&warmupQueries)->default_value(0))
+		("report-format", boost::program_options::value(&reportFormat)->default_value(std::string("json")))
+		("report-path", boost::program_options::value(&reportPath))
+		("query-statistics", boost::program_options::bool_switch(&queryStatistics))
+		("query-statistics-path", boost::program_options::value(&queryStatisticsPath))
+		("dijkstra-heap", boost::program_options::value(&dijkstraHeap)->default_value(std::string("radix")))
+		("bidirectional", boost::program_options::bool_switch(&bidirectional))
+		("compressed-ch", boost::program_options::bool_switch(&compressedCH))
+		("validation-graph", boost::program_options::value(&validationGraph))
+		("simplification-file", boost::program_options::value(&simplificationFile))
+		("reorder", boost::program_options::value(&reorder));
 
 	boost::program_options::positional_options_description p;
 
@@ -770,33 +1947,102 @@ int main(int argc, char* argv[]) {
 			throw input_error("Missing one or more required options (-m <method> / --input-structure <path to structure file> / --query-set <path to query set file>) for the Benchmark command.\n");
 		}
 
+		DijkstraOptions dijkstraOptions;
+		dijkstraOptions.heap = DijkstraEngine::parseHeap(*dijkstraHeap);
+		dijkstraOptions.bidirectional = bidirectional;
+
 		std::unordered_map<std::string, std::function<double(std::string, std::string, std::string, std::string, bool)>> benchmarkMapFunctions = {
-			{"dijkstra", benchmarkDijkstraWithMapping},
+			{"dijkstra", [&](std::string input, std::string queries, std::string mapping, std::string out, bool outputDistances) {
+				return benchmarkDijkstraWithMapping(input, queries, mapping, out, outputDistances, dijkstraOptions);
+			}},
 			{"astar", benchmarkAstarWithMapping},
-			{"ch", benchmarkCHwithMapping},
+			{"alt", benchmarkALTwithMapping},
+			{"ch", [&](std::string input, std::string queries, std::string mapping, std::string out, bool outputDistances) {
+				return benchmarkCHwithMapping(input, queries, mapping, out, outputDistances, compressedCH);
+			}},
+			{"cch", benchmarkCCHwithMapping},
+			{"hl", benchmarkHLwithMapping},
 			{"tnr", benchmarkTNRwithMapping},
 			{"tnraf", benchmarkTNRAFwithMapping},
 			{"dm", benchmarkDMwithMapping},
+			{"dm-paged", [&](std::string input, std::string queries, std::string mapping, std::string out, bool outputDistances) {
+				return benchmarkDMPagedWithMapping(input, queries, mapping, *dmBlockRows, *dmCachedBlocks, out, outputDistances);
+			}},
 		};
 
 		std::unordered_map<std::string, std::function<double(std::string, std::string, std::string, bool)>> benchmarkFunctions = {
-			{"dijkstra", benchmarkDijkstra},
+			{"dijkstra", [&](std::string input, std::string queries, std::string out, bool outputDistances) {
+				return benchmarkDijkstra(input, queries, out, outputDistances, dijkstraOptions);
+			}},
 			{"astar", benchmarkAstar},
-			{"ch", benchmarkCH},
+			{"alt", benchmarkALT},
+			{"ch", [&](std::string input, std::string queries, std::string out, bool outputDistances) {
+				return benchmarkCH(input, queries, out, outputDistances, compressedCH);
+			}},
+			{"cch", benchmarkCCH},
+			{"hl", benchmarkHL},
 			{"tnr", benchmarkTNR},
 			{"tnraf", benchmarkTNRAF},
 			{"dm", benchmarkDM},
+			{"dm-paged", [&](std::string input, std::string queries, std::string out, bool outputDistances) {
+				return benchmarkDMPaged(input, queries, *dmBlockRows, *dmCachedBlocks, out, outputDistances);
+			}},
 		};
 
+#ifndef _MSC_VER
+		if (*method == "server") {
+			std::string path = reportPath ? *reportPath : "latency." + *reportFormat;
+			benchmarkServer(*inputStructure, *querySet, *threads, *warmupQueries, *reportFormat, path,
+				outputPath ? *outputPath : "", outputPath.has_value());
+			return 0;
+		}
+#endif
+
 		if (!benchmarkFunctions.contains(*method)) {
 			throw input_error("Invalid method '" + *method + "' for the Benchmark command.\n");
 		}
 
+		if (simplificationFile) {
+			if (*method == "dijkstra" || *method == "astar" || *method == "dm" || *method == "dm-paged") {
+				throw input_error("The simplification file can only be used with the ch, cch, alt, hl, tnr and tnraf methods.\n");
+			}
+			if (queryStatistics || queryStatisticsPath) {
+				throw input_error("The query statistics can not be collected with a simplification file.\n");
+			}
+		}
+
+		if (compressedCH) {
+			if (*method != "ch") {
+				throw input_error("The compressed query graph can only be used with the ch method.\n");
+			}
+			if (latency || simplificationFile) {
+				throw input_error("The compressed query graph can not be used with --latency or a simplification file.\n");
+			}
+		}
+
+		if (reorder) {
+			if (*method != "dijkstra" && *method != "astar") {
+				throw input_error("The graph can only be reordered by the dijkstra and astar methods, the other structures are reordered by the preprocessor.\n");
+			}
+			if (queryStatistics || queryStatisticsPath) {
+				throw input_error("The query statistics can not be collected with a reordered graph.\n");
+			}
+		}
+
+		if (mappingBenchmark && !mappingFile) {
+			throw input_error("The mapping benchmark requires a mapping file (--mapping-file).\n");
+		}
+
 		auto mem = Memory();
 		mem.init();
 
 		double totalTime;
-		if (mappingFile) {
+		if (latency || simplificationFile || reorder) {
+			std::string path = reportPath ? *reportPath : "latency." + *reportFormat;
+			totalTime = benchmarkLatency(*method, *inputStructure, *querySet, mappingFile ? *mappingFile : "", *threads,
+				*warmupQueries, *reportFormat, path, outputPath ? *outputPath : "", outputPath.has_value(), dijkstraOptions,
+				simplificationFile ? *simplificationFile : "", reorder ? *reorder : "");
+		} else if (mappingFile) {
 			auto func = benchmarkMapFunctions.at(*method);
 			if (outputPath) {
 				totalTime = func(*inputStructure, *querySet, *mappingFile, *outputPath, true);
@@ -817,6 +2063,23 @@ int main(int argc, char* argv[]) {
 		output << totalTime << std::endl;
 		output << mem.get_max_memory_usage() << std::endl;
 		output.close();
+
+		if (mappingBenchmark) {
+			std::vector<std::pair<long long unsigned int, long long unsigned int> > originalTrips;
+			TripsLoader tripsLoader = TripsLoader(*querySet);
+			tripsLoader.loadLongLongTrips(originalTrips);
+			MappingBenchmark::benchmark(originalTrips, *mappingFile);
+		}
+
+		if (queryStatistics || queryStatisticsPath) {
+			collectQueryStatistics(*method, *inputStructure, *querySet, mappingFile ? *mappingFile : "",
+				queryStatisticsPath ? *queryStatisticsPath : "");
+		}
+
+		if (validationGraph) {
+			validateDistances(*method, *inputStructure, *querySet, mappingFile ? *mappingFile : "", *validationGraph,
+				dijkstraOptions, simplificationFile ? *simplificationFile : "", reorder ? *reorder : "");
+		}
 	}
 	catch (input_error& e) {
 		std::cout << "Input Error: " << e.what();
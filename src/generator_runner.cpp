@@ -0,0 +1,178 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Czech Technical University in Prague
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. */
+
+/******************************************************************************
+* File:             generator_runner.cpp
+*
+* Description:      Entry point of the synthetic road network generator
+*****************************************************************************/
+
+#include <iostream>
+#include <set>
+#include <sstream>
+#include <string>
+#include <boost/program_options.hpp>
+#include <boost/optional/optional_io.hpp>
+#include "Error/Error.h"
+#include "GraphBuilding/Generators/QuerySetGenerator.h"
+#include "GraphBuilding/Generators/RoadNetworkGenerator.h"
+#include "Timer/Timer.h"
+
+/**
+ * Splits a comma separated list and checks that every item is one of the allowed values. The value 'all' selects all
+ * the allowed values.
+ *
+ * @param list[in] The comma separated list.
+ * @param allowed[in] The allowed values.
+ * @param name[in] The name of the option, used in the error message.
+ * @return The selected values.
+ */
+std::set<std::string> parseList(const std::string& list, const std::set<std::string>& allowed, const std::string& name) {
+	if (list == "all") {
+		return allowed;
+	}
+
+	std::set<std::string> values;
+	std::stringstream stream(list);
+	std::string value;
+	while (std::getline(stream, value, ',')) {
+		if (!allowed.contains(value)) {
+			throw input_error("Invalid value '" + value + "' of the '--" + name + "' option.\n");
+		}
+		values.insert(value);
+	}
+	return values;
+}
+
+/**
+ * Generates a synthetic road network (see 'RoadNetworkGenerator') in the requested graph formats together with the
+ * requested query sets, so that the scaling of the methods can be measured on graphs of any size.
+ */
+int main(int argc, char* argv[]) {
+	setvbuf(stdout, NULL, _IONBF, 0);
+
+	RoadNetworkGenerator::Options networkOptions;
+	boost::optional<std::string> outputPath, outputFormats, queryTypes;
+	boost::optional<unsigned int> queries, localRank;
+
+	boost::program_options::options_description allOptions("Allowed options");
+	allOptions.add_options()
+		("help", "produce help message")
+		("nodes,n", boost::program_options::value(&networkOptions.nodes)->required())
+		("seed", boost::program_options::value(&networkOptions.seed)->default_value(1))
+		("spacing", boost::program_options::value(&networkOptions.spacing)->default_value(100))
+		("arterial-spacing", boost::program_options::value(&networkOptions.arterialSpacing)->default_value(8))
+		("highway-spacing", boost::program_options::value(&networkOptions.highwaySpacing)->default_value(64))
+		("highway-exit-spacing", boost::program_options::value(&networkOptions.highwayExitSpacing)->default_value(4))
+		("one-way", boost::program_options::value(&networkOptions.oneWayProbability)->default_value(0.2))
+		("missing", boost::program_options::value(&networkOptions.missingProbability)->default_value(0.05))
+		("grid-order", boost::program_options::bool_switch(&networkOptions.gridOrder))
+		("output-path,o", boost::program_options::value(&outputPath))
+		("output-format", boost::program_options::value(&outputFormats)->default_value(std::string("xengraph")))
+		("queries", boost::program_options::value(&queries)->default_value(1000))
+		("query-types", boost::program_options::value(&queryTypes)->default_value(std::string("random")))
+		("local-rank", boost::program_options::value(&localRank)->default_value(4096));
+
+	try {
+		boost::program_options::variables_map vm;
+		boost::program_options::store(boost::program_options::parse_command_line(argc, argv, allOptions), vm);
+
+		if (vm.count("help")) {
+			printf("To generate a synthetic road network, please provide the following options:\n"
+				   "-n <nodes>\n-o <output path>\n[--output-format] [--queries] [--query-types] [--seed] and the "
+				   "network parameters described in the README\n");
+			return 0;
+		}
+
+		boost::program_options::notify(vm);
+		if (!outputPath) {
+			throw input_error("Missing the required option -o <output path> for the generator.\n");
+		}
+
+		const auto formats = parseList(*outputFormats, {"xengraph", "dimacs", "csv", "adj"}, "output-format");
+		const auto types = parseList(*queryTypes, {"random", "rank", "local", "long"}, "query-types");
+
+		Timer generationTimer("Network generation");
+		generationTimer.begin();
+		const auto network = RoadNetworkGenerator(networkOptions).generate();
+		generationTimer.finish();
+		std::cout << "Generated a network with " << network.nodes() << " nodes and " << network.edges() << " edges in "
+				  << generationTimer.getRealTimeSeconds() << " seconds." << std::endl;
+
+		if (formats.contains("xengraph")) {
+			network.writeXenGraph(*outputPath + ".xeng");
+		}
+		if (formats.contains("dimacs")) {
+			network.writeDIMACS(*outputPath + ".gr");
+		}
+		if (formats.contains("csv")) {
+			network.writeCsv(*outputPath);
+		}
+		if (formats.contains("adj")) {
+			if (*outputFormats == "all" && network.nodes() > SyntheticRoadNetwork::ADJACENCY_MATRIX_MAX_NODES) {
+				std::cout << "Skipping the adjacency matrix format, the network is too large for it." << std::endl;
+			} else {
+				network.writeAdjacencyMatrix(*outputPath + ".csv");
+			}
+		}
+
+		if (*queries == 0) {
+			return 0;
+		}
+
+		Timer queriesTimer("Query set generation");
+		queriesTimer.begin();
+		QuerySetGenerator queryGenerator(network, networkOptions.seed);
+		if (types.contains("random")) {
+			QuerySetGenerator::write(queryGenerator.random(*queries), *outputPath + "_random.txt");
+		}
+		if (types.contains("local")) {
+			QuerySetGenerator::write(queryGenerator.local(*queries, *localRank), *outputPath + "_local.txt");
+		}
+		if (types.contains("long")) {
+			QuerySetGenerator::write(queryGenerator.longDistance(*queries), *outputPath + "_long.txt");
+		}
+		if (types.contains("rank")) {
+			const auto sets = queryGenerator.byDijkstraRank(*queries);
+			for (size_t rank = 1; rank < sets.size(); rank++) {
+				QuerySetGenerator::write(sets[rank], *outputPath + "_rank" + std::to_string(rank) + ".txt");
+			}
+		}
+		queriesTimer.finish();
+		std::cout << "Generated the query sets in " << queriesTimer.getRealTimeSeconds() << " seconds." << std::endl;
+	}
+	catch (input_error& e) {
+		std::cout << "Input Error: " << e.what();
+		return 1;
+	}
+	catch (const boost::program_options::error& e) {
+		std::cout << "Input Error: " << e.what() << std::endl;
+		return 1;
+	}
+	catch (const std::exception& e) {
+		std::cout << "Error: " << e.what() << std::endl;
+		return 1;
+	}
+
+	return 0;
+}
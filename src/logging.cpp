@@ -6,8 +6,13 @@
 
 
 
-void set_up_logger(const fs::path& directory_path) {
-	const auto console_sink = std::make_shared<spdlog::sinks::stdout_sink_st>();
+void set_up_logger(const fs::path& directory_path, bool console_to_stderr) {
+	spdlog::sink_ptr console_sink;
+	if (console_to_stderr) {
+		console_sink = std::make_shared<spdlog::sinks::stderr_sink_st>();
+	} else {
+		console_sink = std::make_shared<spdlog::sinks::stdout_sink_st>();
+	}
 	console_sink->set_level(spdlog::level::info);
 
 	const std::string log_filepath = fmt::format("{}/log.txt", directory_path.string());
@@ -5,4 +5,4 @@
 
 namespace fs = std::filesystem;
 
-void set_up_logger(const fs::path& directory_path);
\ No newline at end of file
+void set_up_logger(const fs::path& directory_path, bool console_to_stderr = false);
\ No newline at end of file
@@ -30,6 +30,7 @@
 #include <initializer_list>
 #include <memory>
 #include <filesystem>
+#include <fstream>
 #include <boost/program_options.hpp>
 #include <boost/optional/optional_io.hpp>
 #include <tuple>
@@ -38,9 +39,17 @@
 #include "GraphBuilding/Loaders/GraphLoader.h"
 #include "GraphBuilding/Loaders/TNRGLoader.h"
 #include "GraphBuilding/Loaders/XenGraphLoader.h"
+#include "GraphBuilding/Loaders/NodeMappingLoader.h"
+#include "GraphBuilding/Simplification/GraphSimplifier.h"
+#include "GraphBuilding/Reordering/ReorderedGraphLoader.h"
 #include "GraphBuilding/Structures/UpdateableGraph.h"
 #include "Timer/Timer.h"
 #include "CH/CHPreprocessor.h"
+#include "Checkpoint/PreprocessingCheckpoints.h"
+#include "Astar/Landmarks.h"
+#include "CCH/CCHCustomizer.h"
+#include "CCH/NestedDissection.h"
+#include "HL/HubLabelsBuilder.h"
 #include "TNR/TNRPreprocessor.h"
 #include "TNRAF/TNRAFPreprocessor.h"
 #include "Benchmarking/memory.h"
@@ -52,6 +61,10 @@
 #include "DistanceMatrix/DistanceMatrixXdmOutputter.h"
 #include "DistanceMatrix/DistanceMatrixCsvOutputter.h"
 #include "DistanceMatrix/DistanceMatrixHdfOutputter.h"
+#include "DistanceMatrix/DistanceMatrixCdmOutputter.h"
+#include "DistanceMatrix/DistanceMatrixOutputStream.h"
+#include "DistanceMatrix/DistanceMatrixUpdater.h"
+#include "GraphBuilding/Loaders/DistanceMatrixLoader.h"
 #include "TNRAF/TNRAFPreprocessingMode.h"
 #include "memory.h"
 #include "benchmark.h"
@@ -61,23 +74,65 @@ constexpr auto INVALID_FORMAT_INFO = "Please, make sure that your call has the r
                                      "refer to 'README.md' for a complete overview of use cases for this application\n"
                                      "with examples.\n";
 
+/**
+ * The '--checkpoint-dir' and '--resume' options of the CH, TNR and TNRAF preprocessing.
+ */
+struct CheckpointOptions {
+    std::string directory;
+    bool resume = false;
+
+    /**
+     * Creates the checkpoints for a run, a disabled instance if no checkpoint directory was given.
+     *
+     * @param graph[in] The input graph before the preprocessing.
+     * @return The checkpoints.
+     */
+    PreprocessingCheckpoints create(const UpdateableGraph& graph) const {
+        if (directory.empty()) {
+            return PreprocessingCheckpoints();
+        }
+        return PreprocessingCheckpoints(directory, resume, graph);
+    }
+};
+
+/**
+ * Computes the Contraction Hierarchy for the graph, or restores it from its checkpoint. The graph is left in the state
+ * the 'CHPreprocessor' leaves it in, so the caller still has to add the original edges back.
+ *
+ * @param graph[in, out] The graph that will be contracted.
+ * @param checkpoints[in] The checkpoints.
+ */
+void contractGraph(
+        UpdateableGraph& graph,
+        const PreprocessingCheckpoints& checkpoints) {
+    if (checkpoints.load("ch", "", [&](std::istream& input) { graph.readState(input); })) {
+        return;
+    }
+
+    CHPreprocessor::preprocessForDDSG(graph);
+    checkpoints.save("ch", "", [&](std::ostream& output) { graph.writeState(output); });
+}
+
 /**
  * This function will create the Contraction Hierarchies data structure based on a given input file.
  *
  * @param graphLoader TODO
  * @param outputFilePath[in] Contains the desired output file path for the precomputed CH data structure.
+ * @param checkpointOptions[in] Where to save the checkpoints and whether to resume from them.
  */
 void createCH(
         GraphLoader& graphLoader,
         const std::string& outputFilePath,
-        int scaling_factor) {
+        int scaling_factor,
+        const CheckpointOptions& checkpointOptions) {
     Timer timer("Contraction Hierarchies from DIMACS preprocessing");
 
     UpdateableGraph graph(graphLoader.nodes());
     graphLoader.loadGraph(graph, scaling_factor);
+    const PreprocessingCheckpoints checkpoints = checkpointOptions.create(graph);
 
     timer.begin();
-    CHPreprocessor::preprocessForDDSG(graph);
+    contractGraph(graph, checkpoints);
     timer.finish();
 
     graphLoader.loadGraph(graph, scaling_factor);
@@ -86,6 +141,147 @@ void createCH(
     timer.printMeasuredTime();
 }
 
+/**
+ * This function will create the Customizable Contraction Hierarchies data structure based on a given input file.
+ * Only the metric-independent part is computed here, the weights from the input file are stored with it and
+ * the structure is customized for them when it is loaded. One customization is run here as well to report its time.
+ *
+ * @param graphLoader[in] The loader of the input graph.
+ * @param outputFilePath[in] Contains the desired output file path for the precomputed CCH data structure,
+ * the '.cch' extension will be added.
+ * @param scaling_factor[in] Each loaded weight is divided by this value.
+ */
+void createCCH(
+        GraphLoader& graphLoader,
+        const std::string& outputFilePath,
+        int scaling_factor) {
+    Timer timer("Customizable Contraction Hierarchies preprocessing");
+
+    SimpleGraph graph(graphLoader.nodes());
+    graphLoader.loadGraph(graph, scaling_factor);
+
+    timer.begin();
+    const CCHTopology topology = CCHTopology::build(graph, NestedDissection::computeRanks(graph));
+    timer.finish();
+    const std::vector<dist_t> weights = topology.edgeWeights(graph);
+
+    Timer customizationTimer("Customizable Contraction Hierarchies customization");
+    customizationTimer.begin();
+    CCHCustomizer::customize(topology, weights);
+    customizationTimer.finish();
+
+    std::ofstream output;
+    output.open(outputFilePath + ".cch", std::ios::binary);
+    if (!output.is_open()) {
+        throw std::runtime_error("Couldn't open file '" + outputFilePath + ".cch'!");
+    }
+    topology.write(output, weights);
+    output.close();
+
+    std::cout << "The hierarchy has " << topology.arcs() << " arcs for " << topology.edges() << " original edges."
+              << std::endl;
+    timer.printMeasuredTime();
+    customizationTimer.printMeasuredTime();
+}
+
+/**
+ * This function will create the Hub Labeling data structure based on a given input file. The labels are computed from
+ * the Contraction Hierarchy of the graph, the hierarchy itself is not stored.
+ *
+ * @param graphLoader[in] The loader of the input graph.
+ * @param outputFilePath[in] Contains the desired output file path, the '.hl' suffix is appended.
+ * @param scaling_factor[in] The precision loss applied to the edge weights.
+ * @param compressedLabels[in] Whether to store the labels in the compressed layout.
+ * @param checkpointOptions[in] Where to save the checkpoints and whether to resume from them.
+ */
+void createHL(
+        GraphLoader& graphLoader,
+        const std::string& outputFilePath,
+        int scaling_factor,
+        bool compressedLabels,
+        const CheckpointOptions& checkpointOptions) {
+    Timer chTimer("Contraction Hierarchies preprocessing");
+
+    UpdateableGraph graph(graphLoader.nodes());
+    graphLoader.loadGraph(graph, scaling_factor);
+    const PreprocessingCheckpoints checkpoints = checkpointOptions.create(graph);
+
+    chTimer.begin();
+    contractGraph(graph, checkpoints);
+    chTimer.finish();
+
+    graphLoader.loadGraph(graph, scaling_factor);
+    FlagsGraph<NodeData> ch(graph);
+
+    Timer timer("Hub Labeling preprocessing");
+    timer.begin();
+    const HubLabels labels = HubLabelsBuilder::build(ch, compressedLabels);
+    timer.finish();
+
+    std::ofstream output;
+    output.open(outputFilePath + ".hl", std::ios::binary);
+    if (!output.is_open()) {
+        throw std::runtime_error("Couldn't open file '" + outputFilePath + ".hl'!");
+    }
+    labels.write(output);
+    output.close();
+
+    const double nodes = std::max(1u, labels.nodes());
+    std::cout << "The labels have " << (double) labels.entries(true) / nodes << " forward and "
+              << (double) labels.entries(false) / nodes << " backward hubs per node, "
+              << (double) labels.memoryUsage() / (1024 * 1024) << " MiB." << std::endl;
+    chTimer.printMeasuredTime();
+    timer.printMeasuredTime();
+}
+
+/**
+ * This function will select the landmarks for the ALT algorithm and compute their distances. The output file contains
+ * the graph together with the landmark distances, so it is the only input the ALT queries need.
+ *
+ * @param landmarksCnt[in] The number of landmarks.
+ * @param selection[in] The landmark selection strategy, either 'farthest' or 'avoid'.
+ * @param graphLoader[in] The loader of the input graph.
+ * @param outputFilePath[in] Contains the desired output file path, the '.alt' suffix is appended.
+ * @param scaling_factor[in] The precision loss applied to the edge weights.
+ */
+void createALT(
+        unsigned int landmarksCnt,
+        const std::string& selection,
+        GraphLoader& graphLoader,
+        const std::string& outputFilePath,
+        int scaling_factor) {
+    Landmarks::Selection landmarkSelection;
+    try {
+        landmarkSelection = Landmarks::parseSelection(selection);
+    } catch (const std::invalid_argument& e) {
+        throw input_error(std::string(e.what()) + "\n");
+    }
+    if (landmarksCnt == 0 || landmarksCnt > graphLoader.nodes()) {
+        throw input_error("The number of landmarks must be between 1 and the number of nodes.\n");
+    }
+
+    Timer timer("ALT landmarks preprocessing");
+
+    Graph graph(graphLoader.nodes());
+    graphLoader.loadGraph(graph, scaling_factor);
+
+    timer.begin();
+    const Landmarks landmarks = Landmarks::select(graph, landmarksCnt, landmarkSelection);
+    timer.finish();
+
+    std::ofstream output;
+    output.open(outputFilePath + ".alt", std::ios::binary);
+    if (!output.is_open()) {
+        throw std::runtime_error("Couldn't open file '" + outputFilePath + ".alt'!");
+    }
+    landmarks.write(output, graph);
+    output.close();
+
+    std::cout << "Selected " << landmarks.count() << " landmarks using the '" << selection << "' strategy."
+              << std::endl;
+    timer.printMeasuredTime();
+}
+
 /**
  * This function will create the Transit Node Routing data structure based on a given input file.
  * In this case, the preprocessing mode is the 'fast' mode.
@@ -93,25 +289,28 @@ void createCH(
  * @param transitNodeSetSize[in] The desired size of the transit nodes set.
  * @param graphLoader TODO
  * @param outputFilePath[in] Contains the desired output file path for the precomputed TNR data structure.
+ * @param checkpointOptions[in] Where to save the checkpoints and whether to resume from them.
  */
 void createTNRFast(
         unsigned int transitNodeSetSize,
         GraphLoader& graphLoader,
         const std::string& outputFilePath,
-        int scaling_factor) {
+        int scaling_factor,
+        const CheckpointOptions& checkpointOptions) {
     Timer timer("Transit Node Routing preprocessing (fast mode)");
 
     UpdateableGraph graph(graphLoader.nodes());
     graphLoader.loadGraph(graph, scaling_factor);
+    const PreprocessingCheckpoints checkpoints = checkpointOptions.create(graph);
 
     timer.begin();
-    CHPreprocessor::preprocessForDDSG(graph);
+    contractGraph(graph, checkpoints);
     timer.finish();
 
     graphLoader.loadGraph(graph, scaling_factor);
 
     timer.begin();
-    TNRPreprocessor::preprocessUsingCH(graph, outputFilePath, transitNodeSetSize);
+    TNRPreprocessor::preprocessUsingCH(graph, outputFilePath, transitNodeSetSize, checkpoints);
     timer.finish();
 
     timer.printMeasuredTime();
@@ -124,27 +323,30 @@ void createTNRFast(
  * @param transitNodeSetSize[in] The desired size of the transit nodes set.
  * @param graphLoader TODO
  * @param outputFilePath[in] Contains the desired output file path for the precomputed TNR data structure.
+ * @param checkpointOptions[in] Where to save the checkpoints and whether to resume from them.
  */
 void createTNRSlow(
         unsigned int transitNodeSetSize,
         GraphLoader& graphLoader,
         const std::string& outputFilePath,
-        int scaling_factor) {
+        int scaling_factor,
+        const CheckpointOptions& checkpointOptions) {
     Timer timer("Transit Node Routing preprocessing (slow mode)");
 
     UpdateableGraph graph(graphLoader.nodes());
     graphLoader.loadGraph(graph, scaling_factor);
     Graph* originalGraph = graph.createCopy();
+    const PreprocessingCheckpoints checkpoints = checkpointOptions.create(graph);
 
     timer.begin();
-    CHPreprocessor::preprocessForDDSG(graph);
+    contractGraph(graph, checkpoints);
     timer.finish();
 
     graphLoader.loadGraph(graph, scaling_factor);
 
     timer.begin();
     TNRPreprocessor::preprocessUsingCHslower(
-        graph, *originalGraph, outputFilePath, transitNodeSetSize);
+        graph, *originalGraph, outputFilePath, transitNodeSetSize, checkpoints);
     timer.finish();
 
     delete originalGraph;
@@ -159,27 +361,31 @@ void createTNRSlow(
  * @param transitNodeSetSize[in] The desired size of the transit nodes set.
  * @param graphLoader TODO
  * @param outputFilePath[in] Contains the desired output file path for the precomputed TNR data structure.
+ * @param checkpointOptions[in] Where to save the checkpoints and whether to resume from them.
  */
 void createTNRUsingDM(
         unsigned int transitNodeSetSize,
         unsigned int intSize,
         GraphLoader& graphLoader,
         const std::string& outputFilePath,
-        int scaling_factor) {
+        int scaling_factor,
+        const CheckpointOptions& checkpointOptions) {
     Timer timer("Transit Node Routing preprocessing (using distance matrix)");
 
     UpdateableGraph graph(graphLoader.nodes());
     graphLoader.loadGraph(graph, scaling_factor);
     Graph* originalGraph = graph.createCopy();
+    const PreprocessingCheckpoints checkpoints = checkpointOptions.create(graph);
 
     timer.begin();
-    CHPreprocessor::preprocessForDDSG(graph);
+    contractGraph(graph, checkpoints);
     timer.finish();
 
     graphLoader.loadGraph(graph, scaling_factor);
 
     timer.begin();
-    TNRPreprocessor::preprocessWithDMvalidation(graph, *originalGraph, outputFilePath, transitNodeSetSize, intSize);
+    TNRPreprocessor::preprocessWithDMvalidation(graph, *originalGraph, outputFilePath, transitNodeSetSize, intSize,
+                                                checkpoints);
     timer.finish();
 
     delete originalGraph;
@@ -196,6 +402,7 @@ void createTNRUsingDM(
  * @param transitNodeSetSize[in] Contains the argument determining the desired size of the transit node set.
  * @param graphLoader TODO
  * @param outputFilePath[in] Contains the desired output file path for the precomputed data structure.
+ * @param checkpointOptions[in] Where to save the checkpoints and whether to resume from them.
  */
 void createTNR(
         std::string preprocessingMode,
@@ -203,13 +410,15 @@ void createTNR(
         unsigned int dmIntSize,
         GraphLoader& graphLoader,
         const std::string& outputFilePath,
-        int scaling_factor) {
+        int scaling_factor,
+        const CheckpointOptions& checkpointOptions) {
     if (preprocessingMode == "fast") {
-        createTNRFast(transitNodeSetSize, graphLoader, outputFilePath, scaling_factor);
+        createTNRFast(transitNodeSetSize, graphLoader, outputFilePath, scaling_factor, checkpointOptions);
     } else if (preprocessingMode == "slow") {
-        createTNRSlow(transitNodeSetSize, graphLoader, outputFilePath, scaling_factor);
+        createTNRSlow(transitNodeSetSize, graphLoader, outputFilePath, scaling_factor, checkpointOptions);
     } else if (preprocessingMode == "dm") {
-        createTNRUsingDM(transitNodeSetSize, dmIntSize, graphLoader, outputFilePath, scaling_factor);
+        createTNRUsingDM(transitNodeSetSize, dmIntSize, graphLoader, outputFilePath, scaling_factor,
+                         checkpointOptions);
     } else {
         throw input_error(std::string("Unknown preprocessing mode '") + preprocessingMode +
                           "' for Transit Node Routing preprocessing.\n" + INVALID_FORMAT_INFO);
@@ -225,6 +434,10 @@ void createTNR(
  * @param transitNodeSetSize[in] Contains the argument determining the desired size of the transit node set.
  * @param graphLoader TODO
  * @param outputFilePath[in] Contains the desired output file path for the precomputed data structure.
+ * @param checkpointOptions[in] Where to save the checkpoints and whether to resume from them.
+ * @param memoryBudgetMiB[in] The memory the whole preprocessing may use in MiB, 0 means no limit. With a budget, the
+ * preprocessing mode is downgraded if its auxiliary distance matrix does not fit, and the forward access nodes are
+ * spilled into a temporary file during the backward phase.
  */
 void createTNRAF(
 	const std::string& preprocessingMode,
@@ -232,7 +445,9 @@ void createTNRAF(
 	unsigned int dmIntSize,
 	GraphLoader& graphLoader,
 	const std::string& outputFilePath,
-	int scaling_factor
+	int scaling_factor,
+	const CheckpointOptions& checkpointOptions,
+	unsigned int memoryBudgetMiB
 ) {
 	TNRAFPreprocessingMode mode;
     if (preprocessingMode == "slow") {
@@ -253,15 +468,46 @@ void createTNRAF(
 	UpdateableGraph graph(graphLoader.nodes());
 	graphLoader.loadGraph(graph, scaling_factor);
 	Graph* originalGraph = graph.createCopy();
+	const PreprocessingCheckpoints checkpoints = checkpointOptions.create(graph);
 
 	timer.begin();
-	auto ch_time_ms = benchmark(CHPreprocessor::preprocessForDDSG, graph);
+	auto ch_time_ms = benchmark(contractGraph, graph, checkpoints);
 	timer.finish();
 
 	graph.add_edges(*originalGraph);
 
 	auto num_regions = std::min(graph.nodes(), 32u);
 
+	TNRAFMemoryBudget memoryBudget;
+	if (memoryBudgetMiB != 0) {
+		// the graphs and the Contraction Hierarchy are already in the memory, only the rest of the budget is available
+		// for the auxiliary structures
+		const size_t budget = static_cast<size_t>(memoryBudgetMiB) * 1024 * 1024;
+		const size_t used = static_cast<size_t>(get_current_memory_usage()) * 1024;
+		memoryBudget.bytes = budget > used ? budget - used : 1;
+		memoryBudget.spillPath = outputFilePath + ".tgaf.spill";
+
+		const TNRAFPreprocessingMode chosenMode = TNRAFPreprocessor::chooseMode(
+			mode, graph.nodes(), transitNodeSetSize, dmIntSize, memoryBudget.bytes);
+		std::cout << "Memory budget: " << memoryBudgetMiB << " MiB, " << used / (1024 * 1024)
+				  << " MiB used after the contraction, the auxiliary distance matrix of the '" << preprocessingMode
+				  << "' mode needs " << TNRAFPreprocessor::auxiliaryMemoryUsage(mode, graph.nodes(), transitNodeSetSize, dmIntSize) / (1024 * 1024)
+				  << " MiB." << std::endl;
+		if (chosenMode != mode) {
+			std::cout << "The preprocessing mode was changed to '"
+					  << (chosenMode == TNRAFPreprocessingMode::FAST ? "fast" : "slow")
+					  << "' to fit into the memory budget." << std::endl;
+			mode = chosenMode;
+		}
+
+		memoryBudget.phaseFinished = [](const std::string & phase) {
+			std::cout << "Memory after the phase '" << phase << "': peak " << get_peak_memory_usage() << " KiB, current "
+					  << get_current_memory_usage() << " KiB" << std::endl;
+			reset_peak_memory_usage();
+		};
+		reset_peak_memory_usage();
+	}
+
 	timer.begin();
 	TNRAFPreprocessor tnraf_preprocessor;
 	auto tnraf_time_ms = benchmark(
@@ -273,7 +519,9 @@ void createTNRAF(
 		transitNodeSetSize,
 		num_regions,
 		dmIntSize,
-		mode
+		mode,
+		checkpoints,
+		memoryBudget
 	);
 	timer.finish();
 
@@ -315,20 +563,33 @@ Distance_matrix_travel_time_provider<IntType>* computeDistanceMatrix(GraphLoader
     return computor.getDistanceMatrixInstance();
 }*/
 
+/**
+ * Computes the full distance matrix and stores it in the given format.
+ *
+ * @param outputFormat[in] One of 'xdm', 'csv', 'hdf' and 'cdm'.
+ * @param preprocessingMode[in] One of 'slow', 'fast' and 'floyd-warshall'.
+ * @param graphLoader[in] The loader of the graph.
+ * @param outputFilePath[in] The path of the output file without the extension.
+ * @param scaling_factor[in] The precision loss.
+ * @param symmetric[in] Whether to store only the upper triangle of the matrix if the graph is undirected.
+ */
 template<class IntType>
 void createDM(
         const std::string& outputFormat,
         const std::string& preprocessingMode,
         GraphLoader& graphLoader,
         const std::string& outputFilePath,
-        int scaling_factor) {
+        int scaling_factor,
+        bool symmetric) {
     std::unique_ptr<DistanceMatrixOutputter<IntType>> outputter{nullptr};
-    bool fast = false;
+    DistanceMatrixPreprocessingMode mode;
 
     if (preprocessingMode == "slow") {
-        //dm.computeDistanceMatrix(false, graphLoader, scaling_factor, "Distance Matrix preprocessing");
+        mode = DistanceMatrixPreprocessingMode::SLOW;
     } else if (preprocessingMode == "fast") {
-        fast = true;
+        mode = DistanceMatrixPreprocessingMode::FAST;
+    } else if (preprocessingMode == "floyd-warshall") {
+        mode = DistanceMatrixPreprocessingMode::FLOYD_WARSHALL;
     } else {
         throw input_error(std::string("Unknown preprocessing mode '") + preprocessingMode +
                           "' for Distance Matrix preprocessing.\n" + INVALID_FORMAT_INFO);
@@ -340,15 +601,191 @@ void createDM(
         outputter = std::unique_ptr<DistanceMatrixCsvOutputter<IntType>> { new DistanceMatrixCsvOutputter<IntType>()};
     } else if (outputFormat == "hdf") {
         outputter = std::unique_ptr<DistanceMatrixHdfOutputter<IntType>>{ new DistanceMatrixHdfOutputter<IntType>() };
+    } else if (outputFormat == "cdm") {
+        outputter = std::unique_ptr<DistanceMatrixCdmOutputter<IntType>>{ new DistanceMatrixCdmOutputter<IntType>() };
     } else {
         throw input_error(std::string("Unknown output type '") + outputFormat +
                           "' for Distance Matrix preprocessing.\n" + INVALID_FORMAT_INFO);
     }
-    auto dm = std::make_unique<Distance_matrix_travel_time_provider<IntType>>(fast, graphLoader, scaling_factor);
+    auto dm = std::make_unique<Distance_matrix_travel_time_provider<IntType>>(mode, graphLoader, scaling_factor, symmetric);
     outputter->store(*dm, outputFilePath);
 }
 
 
+/**
+ * Recomputes the rows of a distance matrix that can be affected by the differences between two versions of a graph
+ * and writes them into the HDF5 file in place.
+ *
+ * @param dm[in, out] The distance matrix loaded from the file.
+ * @param matrixFilePath[in] The path to the HDF5 file the matrix was loaded from.
+ * @param previous[in] The graph the matrix was computed for.
+ * @param current[in] The graph with the new weights.
+ */
+template<class IntType>
+void updateDMRows(
+        Distance_matrix_travel_time_provider<IntType>& dm,
+        const std::string& matrixFilePath,
+        const Graph& previous,
+        const Graph& current) {
+    if (dm.getLayout() != DistanceMatrixLayout::FULL) {
+        throw input_error("Only full distance matrices can be updated in place, the matrix in '" + matrixFilePath
+                          + "' contains only the upper triangle, preprocess it without --symmetric.\n");
+    }
+
+    Timer timer("Distance Matrix update");
+    timer.begin();
+
+    const std::vector<EdgeWeightChange> changes = DistanceMatrixUpdater<IntType>::changedEdges(previous, current);
+    const std::vector<unsigned int> rows = DistanceMatrixUpdater<IntType>::affectedRows(dm, changes);
+    const unsigned int changedRows = DistanceMatrixUpdater<IntType>::recomputeRows(dm, current, rows);
+    DistanceMatrixHdfOutputter<IntType>::storeRows(dm, matrixFilePath, rows);
+
+    timer.finish();
+    std::cout << changes.size() << " edges changed, recomputed " << rows.size() << " of " << dm.nodes()
+              << " rows, " << changedRows << " of them contain new distances." << std::endl;
+    timer.printMeasuredTime();
+}
+
+/**
+ * Updates a distance matrix stored in the HDF5 format after some edge weights changed, only the affected rows are
+ * recomputed (see 'DistanceMatrixUpdater').
+ *
+ * @param matrixFilePath[in] The path to the HDF5 file with the distance matrix computed for the previous graph.
+ * @param previousGraphLoader[in] The loader of the graph the matrix was computed for.
+ * @param graphLoader[in] The loader of the graph with the new weights.
+ * @param scaling_factor[in] The precision loss the matrix was computed with.
+ */
+void updateDM(
+        const std::string& matrixFilePath,
+        GraphLoader& previousGraphLoader,
+        GraphLoader& graphLoader,
+        int scaling_factor) {
+    if (std::filesystem::path(matrixFilePath).extension() != ".hdf5") {
+        throw input_error("Only distance matrices in the HDF5 format can be updated in place.\n");
+    }
+
+    Graph previous(previousGraphLoader.nodes());
+    previousGraphLoader.loadGraph(previous, scaling_factor);
+    Graph current(graphLoader.nodes());
+    graphLoader.loadGraph(current, scaling_factor);
+
+    DistanceMatrixLoader dmLoader(matrixFilePath);
+    std::unique_ptr<DistanceMatrixInterface> dm(dmLoader.loadHDF());
+    if (auto* dm16 = dynamic_cast<Distance_matrix_travel_time_provider<uint_least16_t>*>(dm.get())) {
+        updateDMRows(*dm16, matrixFilePath, previous, current);
+    } else if (auto* dm32 = dynamic_cast<Distance_matrix_travel_time_provider<uint_least32_t>*>(dm.get())) {
+        updateDMRows(*dm32, matrixFilePath, previous, current);
+    } else {
+        updateDMRows(dynamic_cast<Distance_matrix_travel_time_provider<dist_t>&>(*dm), matrixFilePath, previous,
+                     current);
+    }
+}
+
+/**
+ * Converts a mapping file (the text XenGraph indices format) into the binary format that can be loaded without any
+ * parsing. The binary mapping can be used anywhere a mapping file is expected.
+ *
+ * @param inputFilePath[in] The path to the mapping file.
+ * @param outputFilePath[in] The path to the output file, the '.xidb' extension will be added.
+ */
+void createMapping(const std::string& inputFilePath, const std::string& outputFilePath) {
+    NodeMappingLoader mappingLoader(inputFilePath);
+    const NodeMapping mapping = mappingLoader.loadMapping();
+
+    std::ofstream output;
+    output.open(outputFilePath + ".xidb", std::ios::binary);
+    if (!output.is_open()) {
+        throw std::runtime_error("Couldn't open file '" + outputFilePath + ".xidb'!");
+    }
+
+    mapping.write(output);
+    output.close();
+    std::cout << "Stored the mapping of " << mapping.nodes() << " nodes." << std::endl;
+}
+
+/**
+ * Renumbers the nodes of the input graph by a locality improving ordering before the preprocessing (see
+ * 'ReorderedGraphLoader') and writes the mapping from the IDs used in the queries to the new IDs into a file with
+ * the '.xidb' suffix (the binary mapping format, see 'createMapping').
+ *
+ * @param graphLoader[in] The loader of the input graph.
+ * @param ordering[in] The name of the ordering, 'bfs', 'hilbert' or 'partition'.
+ * @param mappingFilePath[in] The mapping of the original IDs to the IDs of the input graph, it is composed with
+ * the renumbering. If empty, the written mapping maps the IDs of the input graph to the new IDs.
+ * @param outputFilePath[in] Contains the desired output file path, the '.xidb' suffix is appended.
+ * @return The loader of the renumbered graph.
+ */
+std::unique_ptr<ReorderedGraphLoader> reorderGraph(
+        GraphLoader& graphLoader,
+        const std::string& ordering,
+        const std::string& mappingFilePath,
+        const std::string& outputFilePath) {
+    const NodeOrdering::Type type = NodeOrdering::parse(ordering);
+    NodeMapping inputMapping;
+    if (!mappingFilePath.empty()) {
+        NodeMappingLoader mappingLoader(mappingFilePath);
+        inputMapping = mappingLoader.loadMapping();
+    }
+
+    Timer timer("Node reordering");
+    timer.begin();
+    auto reorderedLoader = std::make_unique<ReorderedGraphLoader>(graphLoader, type);
+    timer.finish();
+
+    const NodeMapping mapping = reorderedLoader->composeMapping(mappingFilePath.empty() ? nullptr : &inputMapping);
+    std::ofstream output;
+    output.open(outputFilePath + ".xidb", std::ios::binary);
+    if (!output.is_open()) {
+        throw std::runtime_error("Couldn't open file '" + outputFilePath + ".xidb'!");
+    }
+    mapping.write(output);
+    output.close();
+
+    std::cout << "Renumbered " << reorderedLoader->nodes() << " nodes using the '" << ordering << "' ordering, the queries "
+              << "have to use the mapping '" << outputFilePath << ".xidb'." << std::endl;
+    timer.printMeasuredTime();
+    return reorderedLoader;
+}
+
+/**
+ * Simplifies the input graph before the preprocessing (see 'GraphSimplifier') and writes the table needed to answer
+ * the queries involving the removed nodes into a file with the '.simp' suffix.
+ *
+ * @param graphLoader[in] The loader of the input graph.
+ * @param outputFilePath[in] Contains the desired output file path, the '.simp' suffix is appended.
+ * @param scaling_factor[in] The precision loss applied to the edge weights.
+ * @return The simplifier, which is used as the loader of the simplified graph.
+ */
+std::unique_ptr<GraphSimplifier> simplifyGraph(
+        GraphLoader& graphLoader,
+        const std::string& outputFilePath,
+        int scaling_factor) {
+    Timer timer("Graph simplification");
+    timer.begin();
+    auto simplifier = std::make_unique<GraphSimplifier>(graphLoader, scaling_factor);
+    timer.finish();
+
+    std::ofstream output;
+    output.open(outputFilePath + ".simp", std::ios::binary);
+    if (!output.is_open()) {
+        throw std::runtime_error("Couldn't open file '" + outputFilePath + ".simp'!");
+    }
+    simplifier->table().write(output);
+    output.close();
+
+    const GraphSimplifier::Statistics& statistics = simplifier->statistics();
+    std::cout << "Simplified the graph from " << statistics.nodes << " nodes and " << statistics.edges << " edges to "
+              << statistics.coreNodes << " nodes ("
+              << 100.0 * statistics.coreNodes / std::max(1u, statistics.nodes) << " %) and " << statistics.coreEdges
+              << " edges." << std::endl;
+    std::cout << "Removed " << statistics.treeNodes << " nodes of dead-end trees, " << statistics.chainNodes
+              << " nodes of " << statistics.chains << " chains and " << statistics.parallelEdges
+              << " parallel edges and loops, the simplification table takes "
+              << (double) simplifier->table().memoryUsage() / (1024 * 1024) << " MiB." << std::endl;
+    timer.printMeasuredTime();
+    return simplifier;
+}
+
 /**
  * TODO
  */
@@ -393,8 +830,9 @@ int main(int argc, char* argv[]) {
 		setvbuf(stdout, NULL, _IONBF, 0);
 
 		boost::optional<std::string> method, inputFormat, inputPath, outputFormat, outputPath, preprocessingMode,
-		inputStructure, querySet, mappingFile;
-		boost::optional<unsigned int> tnodesCnt, dmIntSize, precisionLoss;
+		inputStructure, querySet, mappingFile, previousGraph;
+		boost::optional<std::string> landmarkSelection, checkpointDir, reorder;
+		boost::optional<unsigned int> tnodesCnt, dmIntSize, precisionLoss, landmarksCnt, memoryBudget;
 
 		// Declare the supported options.
 		boost::program_options::options_description allOptions("Allowed options");
@@ -411,7 +849,17 @@ int main(int argc, char* argv[]) {
 				("precision-loss", boost::program_options::value(&precisionLoss)->default_value(1))
 				("input-structure", boost::program_options::value(&inputStructure))
 				("query-set", boost::program_options::value(&querySet))
-				("mapping-file", boost::program_options::value(&mappingFile));
+				("mapping-file", boost::program_options::value(&mappingFile))
+				("previous-graph", boost::program_options::value(&previousGraph))
+				("landmarks", boost::program_options::value(&landmarksCnt)->default_value(16))
+				("landmark-selection", boost::program_options::value(&landmarkSelection)->default_value(std::string("farthest")))
+				("checkpoint-dir", boost::program_options::value(&checkpointDir))
+				("resume", boost::program_options::bool_switch())
+				("compressed-labels", boost::program_options::bool_switch())
+				("simplify", boost::program_options::bool_switch())
+				("symmetric", boost::program_options::bool_switch())
+				("reorder", boost::program_options::value(&reorder))
+				("memory-budget", boost::program_options::value(&memoryBudget));
 
 		boost::program_options::variables_map vm;
 		boost::program_options::store(
@@ -429,6 +877,11 @@ int main(int argc, char* argv[]) {
 				throw input_error("Missing one or more required options (-m <method> / -i <input_file>) for the Create command.\n");
 			}
 
+			if (*method == "mapping") {
+				createMapping(*inputPath, outputPath ? *outputPath : "out");
+				return 0;
+			}
+
 			if (!inputFormat) {
 				auto extension = std::filesystem::path(*inputPath).extension();
 
@@ -443,39 +896,111 @@ int main(int argc, char* argv[]) {
 				outputPath.emplace("out");
 			}
 
-			set_up_logger(outputPath.get());
+			const bool streamOutput = DistanceMatrixOutputStream::isStandardOutput(*outputPath);
+			if (streamOutput) {
+				if (*method != "dm" || (outputFormat && *outputFormat != "xdm" && *outputFormat != "csv")) {
+					throw input_error("Only a distance matrix in the xdm or csv format can be written to the standard output (-o -).\n");
+				}
+				// The standard output carries only the matrix, all the messages go to the standard error.
+				std::cout.rdbuf(std::cerr.rdbuf());
+			}
+
+			set_up_logger(streamOutput ? std::filesystem::path(".") : std::filesystem::path(outputPath.get()), streamOutput);
+
+			CheckpointOptions checkpointOptions;
+			checkpointOptions.resume = vm["resume"].as<bool>();
+			if (checkpointDir) {
+				if (*method != "ch" && *method != "hl" && *method != "tnr" && *method != "tnraf") {
+					throw input_error("Checkpoints (--checkpoint-dir) are only supported by the ch, hl, tnr and tnraf methods.\n");
+				}
+				checkpointOptions.directory = *checkpointDir;
+			} else if (checkpointOptions.resume) {
+				throw input_error("The --resume option requires --checkpoint-dir <directory>.\n");
+			}
+
+			if (memoryBudget && *method != "tnraf") {
+				throw input_error("The memory budget (--memory-budget) is only supported by the tnraf method.\n");
+			}
+
+			const bool symmetric = vm["symmetric"].as<bool>();
+			if (symmetric && *method != "dm") {
+				throw input_error("The --symmetric option is only supported by the dm method.\n");
+			}
+
+			GraphLoader* inputGraphLoader = newGraphLoader(*inputFormat, *inputPath);
+
+			Timer totalTimer("Preprocessing including the graph reordering and simplification");
+			totalTimer.begin();
+			std::unique_ptr<ReorderedGraphLoader> reorderedLoader;
+			if (reorder) {
+				if (*method == "dm-update") {
+					throw input_error("The node reordering (--reorder) is not supported by the distance matrix update, the matrix uses the IDs of the input graph.\n");
+				}
+				reorderedLoader = reorderGraph(*inputGraphLoader, *reorder, mappingFile ? *mappingFile : "", *outputPath);
+			} else if (mappingFile) {
+				throw input_error("The mapping file (--mapping-file) is only used together with the node reordering (--reorder).\n");
+			}
+			GraphLoader* orderedGraphLoader = reorderedLoader ? reorderedLoader.get() : inputGraphLoader;
 
-			GraphLoader* graphLoader = newGraphLoader(*inputFormat, *inputPath);
+			std::unique_ptr<GraphSimplifier> simplifier;
+			if (vm["simplify"].as<bool>()) {
+				if (*method == "dm" || *method == "dm-update") {
+					throw input_error("The graph simplification (--simplify) is not supported by the distance matrix, it has to contain all the nodes.\n");
+				}
+				simplifier = simplifyGraph(*orderedGraphLoader, *outputPath, boost::numeric_cast<int>(*precisionLoss));
+			}
+			GraphLoader* graphLoader = simplifier ? simplifier.get() : orderedGraphLoader;
 
 			if (*method == "ch") {
-				createCH(*graphLoader, *outputPath, *precisionLoss);
+				createCH(*graphLoader, *outputPath, *precisionLoss, checkpointOptions);
+			} else if (*method == "cch") {
+				createCCH(*graphLoader, *outputPath, *precisionLoss);
+			} else if (*method == "alt") {
+				createALT(*landmarksCnt, *landmarkSelection, *graphLoader, *outputPath, *precisionLoss);
+			} else if (*method == "hl") {
+				createHL(*graphLoader, *outputPath, *precisionLoss, vm["compressed-labels"].as<bool>(), checkpointOptions);
 			} else if (*method == "tnr") {
 				if (!preprocessingMode || !tnodesCnt) {
 					throw input_error("Missing one or more required options (--preprocessing-mode <fast/slow/dm> / --tnodes-cnt <cnt>) for TNR creation.\n");
 				}
-				createTNR(*preprocessingMode, *tnodesCnt, *dmIntSize, *graphLoader, *outputPath, *precisionLoss);
+				createTNR(*preprocessingMode, *tnodesCnt, *dmIntSize, *graphLoader, *outputPath, *precisionLoss,
+						  checkpointOptions);
 			} else if (*method == "tnraf") {
 				if (!preprocessingMode || !tnodesCnt) {
 					throw input_error("Missing one or more required options (--preprocessing-mode <slow/dm> / --tnodes-cnt <cnt>) for TNRAF creation.\n");
 				}
-				auto total_time_ms = benchmark(createTNRAF, *preprocessingMode, *tnodesCnt, *dmIntSize, *graphLoader, *outputPath, *precisionLoss);
+				auto total_time_ms = benchmark(createTNRAF, *preprocessingMode, *tnodesCnt, *dmIntSize, *graphLoader, *outputPath, *precisionLoss, checkpointOptions,
+										   memoryBudget ? *memoryBudget : 0);
 				std::cout << "Total time: " << static_cast<double>(total_time_ms.count()) / 1000 << " seconds\n";
 			} else if (*method == "dm") {
 				if (!preprocessingMode || !outputFormat) {
-					throw input_error("Missing one or more required options (--preprocessing-mode <fast/slow> / --output-format <xdm/csv/hdf>) for DM creation.\n");
+					throw input_error("Missing one or more required options (--preprocessing-mode <fast/slow/floyd-warshall> / --output-format <xdm/csv/hdf/cdm>) for DM creation.\n");
 				}
 
 				if (*dmIntSize == 16) {
-					createDM<uint_least16_t>(*outputFormat, *preprocessingMode, *graphLoader, *outputPath, boost::numeric_cast<int>(*precisionLoss));
+					createDM<uint_least16_t>(*outputFormat, *preprocessingMode, *graphLoader, *outputPath, boost::numeric_cast<int>(*precisionLoss), symmetric);
 				} else if (*dmIntSize == 32) {
-					createDM<uint_least32_t>(*outputFormat, *preprocessingMode, *graphLoader, *outputPath, boost::numeric_cast<int>(*precisionLoss));
+					createDM<uint_least32_t>(*outputFormat, *preprocessingMode, *graphLoader, *outputPath, boost::numeric_cast<int>(*precisionLoss), symmetric);
 				} else {
-					createDM<dist_t>(*outputFormat, *preprocessingMode, *graphLoader, *outputPath, boost::numeric_cast<int>(*precisionLoss));
+					createDM<dist_t>(*outputFormat, *preprocessingMode, *graphLoader, *outputPath, boost::numeric_cast<int>(*precisionLoss), symmetric);
+				}
+			} else if (*method == "dm-update") {
+				if (!inputStructure || !previousGraph) {
+					throw input_error("Missing one or more required options (--input-structure <hdf5 distance matrix> / --previous-graph <graph file>) for DM update.\n");
 				}
+
+				std::unique_ptr<GraphLoader> previousGraphLoader(newGraphLoader(*inputFormat, *previousGraph));
+				updateDM(*inputStructure, *previousGraphLoader, *graphLoader, boost::numeric_cast<int>(*precisionLoss));
 			} else {
 				throw input_error("Invalid method name '" + *method + "'.\n");
 			}
-			delete graphLoader;
+			totalTimer.finish();
+			if (simplifier || reorderedLoader) {
+				totalTimer.printMeasuredTime();
+			}
+			simplifier.reset();
+			reorderedLoader.reset();
+			delete inputGraphLoader;
 
 			std::cout << "Max memory usage: " << get_max_memory_usage() << " Kib\n";
 		}
@@ -7,6 +7,34 @@
 
 #include "memory.h"
 #include <cmath>
+#include <fstream>
+#include <string>
+
+namespace {
+	// the maximum memory usage before the last 'reset_peak_memory_usage' call, the reset also clears the maximum
+	// reported by 'getrusage'
+	unsigned long long max_memory_usage_before_reset = 0;
+
+	/**
+	 * Reads a value in kibytes from '/proc/self/status' (Linux only).
+	 *
+	 * @param field[in] The name of the field including the colon, for example 'VmRSS:'.
+	 * @return The value, or 0 if the field is not available.
+	 */
+	unsigned long long read_status_field(const std::string& field) {
+		std::ifstream status("/proc/self/status");
+		std::string name;
+		while (status >> name) {
+			if (name == field) {
+				unsigned long long value = 0;
+				status >> value;
+				return value;
+			}
+			status.ignore(256, '\n');
+		}
+		return 0;
+	}
+}
 
 unsigned long long get_max_memory_usage() {
 	unsigned long long max_mem;
@@ -22,6 +50,34 @@ unsigned long long get_max_memory_usage() {
 		max_mem = usage.ru_maxrss;
 	#endif
 
-	return max_mem;
+	return max_mem > max_memory_usage_before_reset ? max_mem : max_memory_usage_before_reset;
 }
 
+unsigned long long get_current_memory_usage() {
+	#if defined(_MSC_VER)
+		PROCESS_MEMORY_COUNTERS pmc;
+		K32GetProcessMemoryInfo(GetCurrentProcess(), &pmc, sizeof(pmc));
+		return static_cast<unsigned long long>(std::round(static_cast<double>(pmc.WorkingSetSize) / 1024));
+	#else
+		const unsigned long long current = read_status_field("VmRSS:");
+		return current != 0 ? current : get_max_memory_usage();
+	#endif
+}
+
+bool reset_peak_memory_usage() {
+	max_memory_usage_before_reset = get_max_memory_usage();
+
+	// writing 5 into 'clear_refs' resets the peak resident set size reported as 'VmHWM' in '/proc/self/status'
+	std::ofstream clearRefs("/proc/self/clear_refs");
+	if (!clearRefs.is_open()) {
+		return false;
+	}
+	clearRefs << "5";
+	clearRefs.close();
+	return !clearRefs.fail();
+}
+
+unsigned long long get_peak_memory_usage() {
+	const unsigned long long peak = read_status_field("VmHWM:");
+	return peak != 0 ? peak : get_max_memory_usage();
+}
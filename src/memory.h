@@ -4,3 +4,23 @@
  * @return the maximum memory usage of the program in kibytes (KiB)
  */
 unsigned long long get_max_memory_usage();
+
+/**
+ * @brief Get the current memory usage (the resident set size) of the program in kibytes (KiB)
+ * @return the current memory usage of the program in kibytes (KiB), or the maximum memory usage where the current
+ * usage is not available
+ */
+unsigned long long get_current_memory_usage();
+
+/**
+ * @brief Starts a new measurement of the peak memory usage, see 'get_peak_memory_usage'. Only supported on Linux.
+ * @return true if the measurement was restarted
+ */
+bool reset_peak_memory_usage();
+
+/**
+ * @brief Get the peak memory usage of the program since the last 'reset_peak_memory_usage' call in kibytes (KiB)
+ * @return the peak memory usage in kibytes (KiB), the maximum memory usage of the whole run where the reset is not
+ * supported
+ */
+unsigned long long get_peak_memory_usage();
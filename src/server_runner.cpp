@@ -0,0 +1,160 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Czech Technical University in Prague
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. */
+
+/******************************************************************************
+* File:             server_runner.cpp
+*
+* Description:      Entry point of the query server
+*****************************************************************************/
+
+#include <atomic>
+#include <csignal>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <boost/program_options.hpp>
+#include <boost/optional/optional_io.hpp>
+#include "Error/Error.h"
+#include "GraphBuilding/Loaders/NodeMappingLoader.h"
+#include "Server/QueryBackend.h"
+#include "Server/QueryServer.h"
+#include "Timer/Timer.h"
+
+/**
+ * Loads the data structure once and answers the queries of local clients over a Unix domain socket until the process
+ * receives SIGINT or SIGTERM. The protocol is described in 'Server/ServerProtocol.h', 'Server/QueryClient.h' is
+ * a ready-made client. With the 'cch' method, SIGHUP makes the server load the graph given by '--weights' again and
+ * customize the structure for its weights without interrupting the queries.
+ */
+int main(int argc, char* argv[]) {
+	setvbuf(stdout, NULL, _IONBF, 0);
+
+	boost::optional<std::string> method, inputStructure, mappingFile, socketPath, weightsFile;
+	boost::optional<unsigned int> threads, maxBatch;
+	bool paths = false;
+
+	boost::program_options::options_description allOptions("Allowed options");
+	allOptions.add_options()
+		("help", "produce help message")
+		("method,m", boost::program_options::value(&method))
+		("input-structure", boost::program_options::value(&inputStructure))
+		("mapping-file", boost::program_options::value(&mappingFile))
+		("weights", boost::program_options::value(&weightsFile))
+		("socket", boost::program_options::value(&socketPath)->default_value(std::string("shortestPaths.sock")))
+		("threads", boost::program_options::value(&threads)->default_value(1))
+		("max-batch", boost::program_options::value(&maxBatch)->default_value(4096))
+		("paths", boost::program_options::bool_switch(&paths));
+
+	try {
+		boost::program_options::variables_map vm;
+		boost::program_options::store(boost::program_options::parse_command_line(argc, argv, allOptions), vm);
+		boost::program_options::notify(vm);
+
+		if (vm.count("help")) {
+			printf("To run the query server, please provide the following options:\n"
+				   "-m <method>\n--input-structure\n[--mapping-file] [--socket] [--threads] [--max-batch] [--paths] [--weights]\n");
+			return 0;
+		}
+
+		if (!method || !inputStructure) {
+			throw input_error("Missing one or more required options (-m <method> / --input-structure <path to "
+							  "structure file>) for the query server.\n");
+		}
+
+		if (weightsFile && *method != "cch") {
+			throw input_error("The weights can only be changed for the 'cch' method.\n");
+		}
+
+		// the signals are handled by a dedicated thread, all the other threads inherit the blocked mask
+		sigset_t signals;
+		sigemptyset(&signals);
+		sigaddset(&signals, SIGINT);
+		sigaddset(&signals, SIGTERM);
+		sigaddset(&signals, SIGHUP);
+		pthread_sigmask(SIG_BLOCK, &signals, nullptr);
+
+		Timer loadingTimer("Loading the structures");
+		loadingTimer.begin();
+		auto backend = QueryBackend::create(*method, *inputStructure, *threads, paths);
+		std::unique_ptr<NodeMapping> mapping;
+		if (mappingFile) {
+			NodeMappingLoader mappingLoader(*mappingFile);
+			mapping = std::make_unique<NodeMapping>(mappingLoader.loadMapping(backend->nodes()));
+		}
+		loadingTimer.finish();
+		std::cout << "Loaded a structure with " << backend->nodes() << " nodes in "
+				  << loadingTimer.getRealTimeSeconds() << " seconds." << std::endl;
+
+		QueryServer server(*backend, mapping.get(), *maxBatch);
+		server.listen(*socketPath);
+		std::cout << "Listening on '" << *socketPath << "' with " << *threads << " thread(s)." << std::endl;
+
+		std::atomic<bool> signalled = false;
+		std::thread signalHandler([&signals, &server, &signalled, &backend, &weightsFile]() {
+			int signal;
+			while (sigwait(&signals, &signal) == 0 && signal == SIGHUP) {
+				if (!weightsFile) {
+					std::cout << "Ignoring SIGHUP, no weights file was given." << std::endl;
+					continue;
+				}
+
+				Timer customizationTimer("Customization");
+				customizationTimer.begin();
+				try {
+					backend->customize(*weightsFile);
+					customizationTimer.finish();
+					std::cout << "Customized the weights from '" << *weightsFile << "' in "
+							  << customizationTimer.getRealTimeSeconds() << " seconds." << std::endl;
+				} catch (const std::exception& e) {
+					std::cout << "The customization failed, the previous weights are kept: " << e.what() << std::endl;
+				}
+			}
+			signalled = true;
+			server.stop();
+		});
+		try {
+			server.run();
+		} catch (...) {
+			if (!signalled) {
+				pthread_kill(signalHandler.native_handle(), SIGTERM);
+			}
+			signalHandler.join();
+			throw;
+		}
+		signalHandler.join();
+
+		const auto statistics = server.statistics();
+		std::cout << "Answered " << statistics.requests << " requests with " << statistics.queries << " queries in "
+				  << statistics.batches << " batches." << std::endl;
+	}
+	catch (input_error& e) {
+		std::cout << "Input Error: " << e.what();
+		return 1;
+	}
+	catch (const std::exception& e) {
+		std::cout << "Error: " << e.what() << std::endl;
+		return 1;
+	}
+
+	return 0;
+}